@@ -0,0 +1,56 @@
+/*
+
+    Traced loader mode of glad. With GLAD_TRACE defined and src/glad_trace.c
+    linked in, gladLoadGLLoader points every core entry point at a wrapper
+    that times the call and counts it:
+
+        g++ -DGLAD_TRACE file.cpp glad.c glad_trace.c -lglfw3 -lpthread -ldl
+
+    Without GLAD_TRACE, glad_trace.c is empty and glad.c loads the driver's
+    pointers as before. learnopengl/gl_trace.h turns the counters into a
+    per-frame report. Tracing follows the one context of the thread that
+    loaded glad and is not thread safe.
+
+    src/glad_trace.c is generated by src/tools/glad_trace.cpp.
+
+*/
+
+#ifndef __glad_trace_h_
+#define __glad_trace_h_
+
+#include <glad/glad.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* calls counted by the log2 of their ticks */
+#define GLAD_TRACE_BUCKETS 32
+
+typedef struct GLADtraceentry {
+    const char* name;
+    unsigned long long calls;
+    unsigned long long ticks;
+    unsigned long long histogram[GLAD_TRACE_BUCKETS];
+} GLADtraceentry;
+
+/* one entry per traced entry point, counted since the last reset */
+GLAPI GLADtraceentry glad_trace_entries[];
+GLAPI const int glad_trace_entry_count;
+/* the entries called since the last reset, in order of their first call */
+GLAPI int glad_trace_touched[];
+GLAPI int glad_trace_touched_count;
+/* nonzero: glGetError after every call, each error printed with the call's name */
+GLAPI int glad_trace_check_errors;
+
+/* the trace's clock: the time stamp counter on x86, nanoseconds elsewhere */
+GLAPI unsigned long long glad_trace_ticks(void);
+GLAPI void glad_trace_reset(void);
+/* called by gladLoadGLLoader */
+GLAPI void glad_trace_install(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
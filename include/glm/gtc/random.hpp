@@ -27,6 +27,13 @@ namespace glm
 	/// @addtogroup gtc_random
 	/// @{
 
+	/// Seed the generator of the calling thread. Every thread draws from its own
+	/// xoshiro128** generator; unseeded, the threads get the seeds 0, 1, 2... in
+	/// the order of their first draw.
+	///
+	/// @see gtc_random
+	GLM_FUNC_DECL void seedRandom(uint64 Seed);
+
 	/// Generate random numbers in the interval [Min, Max], according a linear distribution
 	///
 	/// @param Min Minimum value included in the sampling
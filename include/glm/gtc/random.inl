@@ -2,63 +2,98 @@
 #include "../exponential.hpp"
 #include "../trigonometric.hpp"
 #include "../detail/type_vec1.hpp"
-#include <cstdlib>
-#include <ctime>
+#include <atomic>
 #include <cassert>
 #include <cmath>
 
 namespace glm{
 namespace detail
 {
-	template <length_t L, typename T, qualifier Q>
-	struct compute_rand
+	// xoshiro128** (Blackman and Vigna); one generator per thread stands in for
+	// std::rand, which is slow, has a short period and is locked by some libcs
+	struct random_xoshiro128
 	{
-		GLM_FUNC_QUALIFIER static vec<L, T, Q> call();
+		uint32 s[4];
 	};
 
-	template <qualifier P>
-	struct compute_rand<1, uint8, P>
+	GLM_FUNC_QUALIFIER uint32 random_rotl(uint32 x, int k)
 	{
-		GLM_FUNC_QUALIFIER static vec<1, uint8, P> call()
-		{
-			return vec<1, uint8, P>(
-				static_cast<uint8>(std::rand() % std::numeric_limits<uint8>::max()));
-		}
-	};
+		return (x << k) | (x >> (32 - k));
+	}
 
-	template <qualifier P>
-	struct compute_rand<2, uint8, P>
+	GLM_FUNC_QUALIFIER uint32 random_next(uint32& s0, uint32& s1, uint32& s2, uint32& s3)
 	{
-		GLM_FUNC_QUALIFIER static vec<2, uint8, P> call()
-		{
-			return vec<2, uint8, P>(
-				std::rand() % std::numeric_limits<uint8>::max(),
-				std::rand() % std::numeric_limits<uint8>::max());
-		}
-	};
+		uint32 const Result = random_rotl(s1 * 5u, 7) * 9u;
+		uint32 const t = s1 << 9;
+		s2 ^= s0;
+		s3 ^= s1;
+		s1 ^= s2;
+		s0 ^= s3;
+		s2 ^= t;
+		s3 = random_rotl(s3, 11);
+		return Result;
+	}
+
+	GLM_FUNC_QUALIFIER uint64 random_splitmix64(uint64& x)
+	{
+		uint64 z = (x += 0x9e3779b97f4a7c15ull);
+		z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+		z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+		return z ^ (z >> 31);
+	}
+
+	GLM_FUNC_QUALIFIER void random_seed(random_xoshiro128& Generator, uint64 Seed)
+	{
+		uint64 const a = random_splitmix64(Seed);
+		uint64 const b = random_splitmix64(Seed);
+		Generator.s[0] = static_cast<uint32>(a);
+		Generator.s[1] = static_cast<uint32>(a >> 32);
+		Generator.s[2] = static_cast<uint32>(b);
+		Generator.s[3] = static_cast<uint32>(b >> 32);
+	}
 
-	template <qualifier P>
-	struct compute_rand<3, uint8, P>
+	// 0, 1, 2... for the threads in the order they first ask, so a program
+	// that does not seed still draws the same numbers on every run
+	inline uint64 random_thread_seed()
 	{
-		GLM_FUNC_QUALIFIER static vec<3, uint8, P> call()
+		static std::atomic<uint64> Next(0);
+		return Next++;
+	}
+
+	inline random_xoshiro128& random_thread_generator()
+	{
+		static thread_local random_xoshiro128 Generator;
+		static thread_local bool Seeded = false;
+		if(!Seeded)
 		{
-			return vec<3, uint8, P>(
-				std::rand() % std::numeric_limits<uint8>::max(),
-				std::rand() % std::numeric_limits<uint8>::max(),
-				std::rand() % std::numeric_limits<uint8>::max());
+			random_seed(Generator, random_thread_seed());
+			Seeded = true;
 		}
+		return Generator;
+	}
+
+	inline uint32 random_thread_next()
+	{
+		random_xoshiro128& g = random_thread_generator();
+		return random_next(g.s[0], g.s[1], g.s[2], g.s[3]);
+	}
+
+	template <length_t L, typename T, qualifier Q>
+	struct compute_rand
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call();
 	};
 
-	template <qualifier P>
-	struct compute_rand<4, uint8, P>
+	// the high bits of each draw, xoshiro's low bits are its weakest
+	template <length_t L, qualifier Q>
+	struct compute_rand<L, uint8, Q>
 	{
-		GLM_FUNC_QUALIFIER static vec<4, uint8, P> call()
+		GLM_FUNC_QUALIFIER static vec<L, uint8, Q> call()
 		{
-			return vec<4, uint8, P>(
-				std::rand() % std::numeric_limits<uint8>::max(),
-				std::rand() % std::numeric_limits<uint8>::max(),
-				std::rand() % std::numeric_limits<uint8>::max(),
-				std::rand() % std::numeric_limits<uint8>::max());
+			vec<L, uint8, Q> Result;
+			for(length_t i = 0; i < L; ++i)
+				Result[i] = static_cast<uint8>(random_thread_next() >> 24);
+			return Result;
 		}
 	};
 
@@ -67,9 +102,10 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static vec<L, uint16, Q> call()
 		{
-			return
-				(vec<L, uint16, Q>(compute_rand<L, uint8, Q>::call()) << static_cast<uint16>(8)) |
-				(vec<L, uint16, Q>(compute_rand<L, uint8, Q>::call()) << static_cast<uint16>(0));
+			vec<L, uint16, Q> Result;
+			for(length_t i = 0; i < L; ++i)
+				Result[i] = static_cast<uint16>(random_thread_next() >> 16);
+			return Result;
 		}
 	};
 
@@ -78,9 +114,10 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static vec<L, uint32, Q> call()
 		{
-			return
-				(vec<L, uint32, Q>(compute_rand<L, uint16, Q>::call()) << static_cast<uint32>(16)) |
-				(vec<L, uint32, Q>(compute_rand<L, uint16, Q>::call()) << static_cast<uint32>(0));
+			vec<L, uint32, Q> Result;
+			for(length_t i = 0; i < L; ++i)
+				Result[i] = random_thread_next();
+			return Result;
 		}
 	};
 
@@ -89,9 +126,13 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static vec<L, uint64, Q> call()
 		{
-			return
-				(vec<L, uint64, Q>(compute_rand<L, uint32, Q>::call()) << static_cast<uint64>(32)) |
-				(vec<L, uint64, Q>(compute_rand<L, uint32, Q>::call()) << static_cast<uint64>(0));
+			vec<L, uint64, Q> Result;
+			for(length_t i = 0; i < L; ++i)
+			{
+				uint64 const High = random_thread_next();
+				Result[i] = (High << 32) | random_thread_next();
+			}
+			return Result;
 		}
 	};
 
@@ -201,6 +242,11 @@ namespace detail
 	};
 }//namespace detail
 
+	inline void seedRandom(uint64 Seed)
+	{
+		detail::random_seed(detail::random_thread_generator(), Seed);
+	}
+
 	template<typename genType>
 	GLM_FUNC_QUALIFIER genType linearRand(genType Min, genType Max)
 	{
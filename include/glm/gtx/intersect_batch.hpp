@@ -0,0 +1,94 @@
+/// @ref gtx_intersect_batch
+/// @file glm/gtx/intersect_batch.hpp
+///
+/// @see core (dependence)
+/// @see gtx_intersect (dependence)
+///
+/// @defgroup gtx_intersect_batch GLM_GTX_intersect_batch
+/// @ingroup gtx
+///
+/// Include <glm/gtx/intersect_batch.hpp> to use the features of this extension.
+///
+/// Test one ray or line against many triangles or spheres stored as
+/// structures of arrays.
+///
+/// The primitives are tested 4, 8 or 16 at a time in SIMD registers depending
+/// on the ISA found at run time (SSE2, AVX2, AVX-512F), the ones past the last
+/// whole group with the functions of gtx_intersect. Every lane runs the same
+/// operations in the same order as those functions without fusing a multiply
+/// and an add, so the hits, distances and positions are theirs, bit for bit,
+/// where those are not compiled with fused multiply-adds either.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtx/intersect.hpp"
+#include "../simd/cpuid.h"
+
+#include <cstddef>
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_intersect_batch is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	else
+#		pragma message("GLM: GLM_GTX_intersect_batch extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_intersect_batch
+	/// @{
+
+	/// count triangles, vertex k of triangle i at (x[k][i], y[k][i], z[k][i]).
+	struct triangleBatch
+	{
+		float const* x[3];
+		float const* y[3];
+		float const* z[3];
+		std::size_t count;
+	};
+
+	/// count spheres, sphere i centered at (x[i], y[i], z[i]) with the squared
+	/// radius radiusSquared[i].
+	struct sphereBatch
+	{
+		float const* x;
+		float const* y;
+		float const* z;
+		float const* radiusSquared;
+		std::size_t count;
+	};
+
+	/// intersectRayTriangle against every triangle of the batch. Bit i % 32 of
+	/// hitMask[i / 32] is set when triangle i is hit, and then baryPositions[i]
+	/// and distances[i] hold what intersectRayTriangle gives; the other entries
+	/// are left undefined. hitMask has (count + 31) / 32 words.
+	/// Returns the number of triangles hit.
+	/// @see gtx_intersect_batch
+	GLM_FUNC_DECL std::size_t intersectRayTriangleBatch(vec3 const& orig, vec3 const& dir, triangleBatch const& triangles,
+		uint32* hitMask, vec2* baryPositions, float* distances);
+
+	/// intersectLineTriangle against every triangle of the batch, with the hit
+	/// mask as in intersectRayTriangleBatch and positions[i] set for the hits.
+	/// Returns the number of triangles hit.
+	/// @see gtx_intersect_batch
+	GLM_FUNC_DECL std::size_t intersectLineTriangleBatch(vec3 const& orig, vec3 const& dir, triangleBatch const& triangles,
+		uint32* hitMask, vec3* positions);
+
+	/// intersectRaySphere, the squared radius form, against every sphere of the
+	/// batch, with the hit mask as in intersectRayTriangleBatch and
+	/// distances[i] set for the hits. Returns the number of spheres hit.
+	/// @see gtx_intersect_batch
+	GLM_FUNC_DECL std::size_t intersectRaySphereBatch(vec3 const& rayStarting, vec3 const& rayNormalizedDirection, sphereBatch const& spheres,
+		uint32* hitMask, float* distances);
+
+	/// Name of the instruction set the batch functions run with on this machine.
+	/// @see gtx_intersect_batch
+	GLM_FUNC_DECL char const* intersectBatchIsa();
+
+	/// @}
+}// namespace glm
+
+#include "intersect_batch.inl"
@@ -0,0 +1,224 @@
+/// @ref gtx_intersect_batch
+///
+// The lane kernels of intersect_batch_lanes.inl test the whole groups of 4, 8
+// or 16 primitives; the batch functions below test the rest with
+// gtx_intersect, so without wide kernels everything goes through it.
+
+#include <cstring>
+#include <limits>
+
+#if GLM_SIMD_WIDE_KERNELS
+#	include <immintrin.h>
+#endif
+
+#if GLM_COMPILER & GLM_COMPILER_GCC
+#	pragma GCC push_options
+#	pragma GCC optimize("fp-contract=off")
+#endif
+
+namespace glm{
+namespace detail
+{
+	// Test the whole groups of a batch and return how many primitives they held
+	typedef std::size_t (*intersect_ray_triangle_func)(vec3 const& Orig, vec3 const& Dir, triangleBatch const& Triangles,
+		uint32* HitMask, vec2* BaryPositions, float* Distances);
+	typedef std::size_t (*intersect_line_triangle_func)(vec3 const& Orig, vec3 const& Dir, triangleBatch const& Triangles,
+		uint32* HitMask, vec3* Positions);
+	typedef std::size_t (*intersect_ray_sphere_func)(vec3 const& Start, vec3 const& Dir, sphereBatch const& Spheres,
+		uint32* HitMask, float* Distances);
+
+	// the scalar kernels leave every primitive to the functions of gtx_intersect
+	inline std::size_t intersect_ray_triangle_scalar(vec3 const&, vec3 const&, triangleBatch const&, uint32*, vec2*, float*)
+	{
+		return 0;
+	}
+
+	inline std::size_t intersect_line_triangle_scalar(vec3 const&, vec3 const&, triangleBatch const&, uint32*, vec3*)
+	{
+		return 0;
+	}
+
+	inline std::size_t intersect_ray_sphere_scalar(vec3 const&, vec3 const&, sphereBatch const&, uint32*, float*)
+	{
+		return 0;
+	}
+
+#if GLM_SIMD_WIDE_KERNELS
+	typedef float intersect_f4 __attribute__((vector_size(16)));
+	typedef float intersect_f8 __attribute__((vector_size(32)));
+	typedef float intersect_f16 __attribute__((vector_size(64)));
+}//namespace detail
+}//namespace glm
+
+// One copy of the lane kernels per instruction set, each compiled for its own target
+#	define GLM_INTERSECT_LANES_NAMESPACE intersect_sse2
+#	define GLM_INTERSECT_LANES_TYPE intersect_f4
+#	define GLM_INTERSECT_LANES_SQRT(x) _mm_sqrt_ps(x)
+#	define GLM_INTERSECT_LANES_BITS(m) static_cast<uint32>(_mm_movemask_ps(reinterpret_cast<__m128>(m)))
+#	define GLM_INTERSECT_LANES_TARGET "sse2"
+#	define GLM_INTERSECT_LANES_ATTRIB GLM_TARGET_SSE2
+#	include "intersect_batch_lanes.inl"
+#	undef GLM_INTERSECT_LANES_NAMESPACE
+#	undef GLM_INTERSECT_LANES_TYPE
+#	undef GLM_INTERSECT_LANES_SQRT
+#	undef GLM_INTERSECT_LANES_BITS
+#	undef GLM_INTERSECT_LANES_TARGET
+#	undef GLM_INTERSECT_LANES_ATTRIB
+
+#	define GLM_INTERSECT_LANES_NAMESPACE intersect_avx2
+#	define GLM_INTERSECT_LANES_TYPE intersect_f8
+#	define GLM_INTERSECT_LANES_SQRT(x) _mm256_sqrt_ps(x)
+#	define GLM_INTERSECT_LANES_BITS(m) static_cast<uint32>(_mm256_movemask_ps(reinterpret_cast<__m256>(m)))
+#	define GLM_INTERSECT_LANES_TARGET "avx2,fma"
+#	define GLM_INTERSECT_LANES_ATTRIB GLM_TARGET_AVX2
+#	include "intersect_batch_lanes.inl"
+#	undef GLM_INTERSECT_LANES_NAMESPACE
+#	undef GLM_INTERSECT_LANES_TYPE
+#	undef GLM_INTERSECT_LANES_SQRT
+#	undef GLM_INTERSECT_LANES_BITS
+#	undef GLM_INTERSECT_LANES_TARGET
+#	undef GLM_INTERSECT_LANES_ATTRIB
+
+#	define GLM_INTERSECT_LANES_NAMESPACE intersect_avx512f
+#	define GLM_INTERSECT_LANES_TYPE intersect_f16
+// the masked form, _mm512_sqrt_ps trips -Wmaybe-uninitialized in GCC 12
+#	define GLM_INTERSECT_LANES_SQRT(x) _mm512_mask_sqrt_ps(x, 0xffff, x)
+#	define GLM_INTERSECT_LANES_BITS(m) static_cast<uint32>(_mm512_cmpneq_epi32_mask(reinterpret_cast<__m512i>(m), _mm512_setzero_si512()))
+#	define GLM_INTERSECT_LANES_TARGET "avx512f,avx2,fma"
+#	define GLM_INTERSECT_LANES_ATTRIB GLM_TARGET_AVX512F
+#	include "intersect_batch_lanes.inl"
+#	undef GLM_INTERSECT_LANES_NAMESPACE
+#	undef GLM_INTERSECT_LANES_TYPE
+#	undef GLM_INTERSECT_LANES_SQRT
+#	undef GLM_INTERSECT_LANES_BITS
+#	undef GLM_INTERSECT_LANES_TARGET
+#	undef GLM_INTERSECT_LANES_ATTRIB
+
+namespace glm{
+namespace detail
+{
+#endif//GLM_SIMD_WIDE_KERNELS
+
+	// AVX without AVX2 runs the SSE2 kernels, like the other batch extensions
+	inline int intersect_batch_isa()
+	{
+#		if GLM_SIMD_WIDE_KERNELS
+			int const Isa = glm_simd_isa();
+			if(Isa & GLM_SIMD_ISA_AVX512F)
+				return GLM_SIMD_ISA_AVX512F;
+			if(Isa & GLM_SIMD_ISA_AVX2)
+				return GLM_SIMD_ISA_AVX2;
+			if(Isa & GLM_SIMD_ISA_SSE2)
+				return GLM_SIMD_ISA_SSE2;
+#		endif
+		return GLM_SIMD_ISA_NONE;
+	}
+
+	template<typename F>
+	F intersect_batch_select(F Scalar, F Sse2, F Avx2, F Avx512f)
+	{
+		switch(intersect_batch_isa())
+		{
+		case GLM_SIMD_ISA_AVX512F: return Avx512f;
+		case GLM_SIMD_ISA_AVX2: return Avx2;
+		case GLM_SIMD_ISA_SSE2: return Sse2;
+		default: return Scalar;
+		}
+	}
+
+	inline std::size_t intersect_batch_clear(uint32* HitMask, std::size_t Count)
+	{
+		std::size_t const Words = (Count + 31) / 32;
+		std::memset(HitMask, 0, Words * sizeof(uint32));
+		return Words;
+	}
+
+	inline std::size_t intersect_batch_count(uint32 const* HitMask, std::size_t Words)
+	{
+		std::size_t Hits = 0;
+		for(std::size_t w = 0; w < Words; ++w)
+			for(uint32 Bits = HitMask[w]; Bits; Bits &= Bits - 1)
+				++Hits;
+		return Hits;
+	}
+
+	inline vec3 intersect_batch_vertex(triangleBatch const& Triangles, int Vertex, std::size_t i)
+	{
+		return vec3(Triangles.x[Vertex][i], Triangles.y[Vertex][i], Triangles.z[Vertex][i]);
+	}
+
+	// The batch functions with a given kernel, so that each instruction set's
+	// can be compared with gtx_intersect
+	inline std::size_t intersect_ray_triangle_batch(intersect_ray_triangle_func Kernel, vec3 const& Orig, vec3 const& Dir,
+		triangleBatch const& Triangles, uint32* HitMask, vec2* BaryPositions, float* Distances)
+	{
+		std::size_t const Words = intersect_batch_clear(HitMask, Triangles.count);
+		for(std::size_t i = Kernel(Orig, Dir, Triangles, HitMask, BaryPositions, Distances); i < Triangles.count; ++i)
+			if(intersectRayTriangle(Orig, Dir, intersect_batch_vertex(Triangles, 0, i), intersect_batch_vertex(Triangles, 1, i),
+				intersect_batch_vertex(Triangles, 2, i), BaryPositions[i], Distances[i]))
+				HitMask[i / 32] |= 1u << (i % 32);
+		return intersect_batch_count(HitMask, Words);
+	}
+
+	inline std::size_t intersect_line_triangle_batch(intersect_line_triangle_func Kernel, vec3 const& Orig, vec3 const& Dir,
+		triangleBatch const& Triangles, uint32* HitMask, vec3* Positions)
+	{
+		std::size_t const Words = intersect_batch_clear(HitMask, Triangles.count);
+		for(std::size_t i = Kernel(Orig, Dir, Triangles, HitMask, Positions); i < Triangles.count; ++i)
+			if(intersectLineTriangle(Orig, Dir, intersect_batch_vertex(Triangles, 0, i), intersect_batch_vertex(Triangles, 1, i),
+				intersect_batch_vertex(Triangles, 2, i), Positions[i]))
+				HitMask[i / 32] |= 1u << (i % 32);
+		return intersect_batch_count(HitMask, Words);
+	}
+
+	inline std::size_t intersect_ray_sphere_batch(intersect_ray_sphere_func Kernel, vec3 const& Start, vec3 const& Dir,
+		sphereBatch const& Spheres, uint32* HitMask, float* Distances)
+	{
+		std::size_t const Words = intersect_batch_clear(HitMask, Spheres.count);
+		for(std::size_t i = Kernel(Start, Dir, Spheres, HitMask, Distances); i < Spheres.count; ++i)
+			if(intersectRaySphere(Start, Dir, vec3(Spheres.x[i], Spheres.y[i], Spheres.z[i]), Spheres.radiusSquared[i], Distances[i]))
+				HitMask[i / 32] |= 1u << (i % 32);
+		return intersect_batch_count(HitMask, Words);
+	}
+}//namespace detail
+
+#if GLM_SIMD_WIDE_KERNELS
+#	define GLM_INTERSECT_BATCH_FUNC(Name) detail::intersect_batch_select(detail::Name##_scalar, \
+		detail::intersect_sse2::Name##_groups, detail::intersect_avx2::Name##_groups, detail::intersect_avx512f::Name##_groups)
+#else
+#	define GLM_INTERSECT_BATCH_FUNC(Name) detail::intersect_batch_select(detail::Name##_scalar, \
+		detail::Name##_scalar, detail::Name##_scalar, detail::Name##_scalar)
+#endif
+
+	GLM_FUNC_QUALIFIER std::size_t intersectRayTriangleBatch(vec3 const& orig, vec3 const& dir, triangleBatch const& triangles,
+		uint32* hitMask, vec2* baryPositions, float* distances)
+	{
+		static detail::intersect_ray_triangle_func const Kernel = GLM_INTERSECT_BATCH_FUNC(intersect_ray_triangle);
+		return detail::intersect_ray_triangle_batch(Kernel, orig, dir, triangles, hitMask, baryPositions, distances);
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t intersectLineTriangleBatch(vec3 const& orig, vec3 const& dir, triangleBatch const& triangles,
+		uint32* hitMask, vec3* positions)
+	{
+		static detail::intersect_line_triangle_func const Kernel = GLM_INTERSECT_BATCH_FUNC(intersect_line_triangle);
+		return detail::intersect_line_triangle_batch(Kernel, orig, dir, triangles, hitMask, positions);
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t intersectRaySphereBatch(vec3 const& rayStarting, vec3 const& rayNormalizedDirection, sphereBatch const& spheres,
+		uint32* hitMask, float* distances)
+	{
+		static detail::intersect_ray_sphere_func const Kernel = GLM_INTERSECT_BATCH_FUNC(intersect_ray_sphere);
+		return detail::intersect_ray_sphere_batch(Kernel, rayStarting, rayNormalizedDirection, spheres, hitMask, distances);
+	}
+
+#undef GLM_INTERSECT_BATCH_FUNC
+
+	GLM_FUNC_QUALIFIER char const* intersectBatchIsa()
+	{
+		return glm_simd_isa_name(detail::intersect_batch_isa());
+	}
+}//namespace glm
+
+#if GLM_COMPILER & GLM_COMPILER_GCC
+#	pragma GCC pop_options
+#endif
@@ -0,0 +1,172 @@
+/// @ref gtx_intersect_batch
+///
+// Lane kernels of GLM_GTX_intersect_batch. intersect_batch.inl includes this
+// file once per instruction set after defining:
+//   GLM_INTERSECT_LANES_NAMESPACE  namespace of this copy
+//   GLM_INTERSECT_LANES_TYPE       float vector type with 4, 8 or 16 lanes
+//   GLM_INTERSECT_LANES_SQRT       square root intrinsic of that width
+//   GLM_INTERSECT_LANES_BITS       lane mask to the low bits of a uint32
+//   GLM_INTERSECT_LANES_TARGET     GCC target string of this copy
+//   GLM_INTERSECT_LANES_ATTRIB     target attribute of the group entry points
+// Lane l of a register holds primitive First + l. Each kernel tests the whole
+// groups of N and returns how many primitives that covered.
+
+#if GLM_COMPILER & GLM_COMPILER_GCC
+#	pragma GCC push_options
+#	define GLM_INTERSECT_LANES_PRAGMA(x) _Pragma(#x)
+#	define GLM_INTERSECT_LANES_TARGET_PRAGMA(t) GLM_INTERSECT_LANES_PRAGMA(GCC target(t))
+	GLM_INTERSECT_LANES_TARGET_PRAGMA(GLM_INTERSECT_LANES_TARGET)
+#	undef GLM_INTERSECT_LANES_TARGET_PRAGMA
+#	undef GLM_INTERSECT_LANES_PRAGMA
+#	pragma GCC optimize("fp-contract=off")
+#endif
+
+namespace glm{
+namespace detail{
+namespace GLM_INTERSECT_LANES_NAMESPACE
+{
+	typedef GLM_INTERSECT_LANES_TYPE V;
+	typedef decltype(V() < V()) M;
+
+	int const N = static_cast<int>(sizeof(V) / sizeof(float));
+
+	GLM_WIDE_INLINE V intersect_lanes_load(float const* p)
+	{
+		V v;
+		std::memcpy(&v, p, sizeof(V));
+		return v;
+	}
+
+	GLM_WIDE_INLINE void intersect_lanes_hits(uint32* HitMask, std::size_t First, uint32 Bits)
+	{
+		HitMask[First / 32] |= Bits << (First % 32);
+	}
+
+	// The operations of intersectRayTriangle, with both of its determinant
+	// signs evaluated and the lanes taking the one they have
+	GLM_INTERSECT_LANES_ATTRIB inline std::size_t intersect_ray_triangle_groups(vec3 const& Orig, vec3 const& Dir, triangleBatch const& Triangles,
+		uint32* HitMask, vec2* BaryPositions, float* Distances)
+	{
+		float const Epsilon = std::numeric_limits<float>::epsilon();
+		std::size_t const Whole = Triangles.count / N * N;
+		for(std::size_t First = 0; First < Whole; First += N)
+		{
+			V const x0 = intersect_lanes_load(Triangles.x[0] + First);
+			V const y0 = intersect_lanes_load(Triangles.y[0] + First);
+			V const z0 = intersect_lanes_load(Triangles.z[0] + First);
+			V const e1x = intersect_lanes_load(Triangles.x[1] + First) - x0;
+			V const e1y = intersect_lanes_load(Triangles.y[1] + First) - y0;
+			V const e1z = intersect_lanes_load(Triangles.z[1] + First) - z0;
+			V const e2x = intersect_lanes_load(Triangles.x[2] + First) - x0;
+			V const e2y = intersect_lanes_load(Triangles.y[2] + First) - y0;
+			V const e2z = intersect_lanes_load(Triangles.z[2] + First) - z0;
+
+			// p = cross(dir, edge2), det = dot(edge1, p)
+			V const px = Dir.y * e2z - e2y * Dir.z;
+			V const py = Dir.z * e2x - e2z * Dir.x;
+			V const pz = Dir.x * e2y - e2x * Dir.y;
+			V const Det = e1x * px + e1y * py + e1z * pz;
+
+			// u = dot(orig - vert0, p), v = dot(dir, cross(orig - vert0, edge1))
+			V const dx = Orig.x - x0;
+			V const dy = Orig.y - y0;
+			V const dz = Orig.z - z0;
+			V const u = dx * px + dy * py + dz * pz;
+			V const qx = dy * e1z - e1y * dz;
+			V const qy = dz * e1x - e1z * dx;
+			V const qz = dx * e1y - e1x * dy;
+			V const v = Dir.x * qx + Dir.y * qy + Dir.z * qz;
+
+			M const Front = (Det > Epsilon) & ~(u < 0.0f) & ~(u > Det) & ~(v < 0.0f) & ~(u + v > Det);
+			M const Back = (Det < -Epsilon) & ~(u > 0.0f) & ~(u < Det) & ~(v > 0.0f) & ~(u + v < Det);
+			uint32 const Bits = GLM_INTERSECT_LANES_BITS(Front | Back);
+
+			V const InvDet = 1.0f / Det;
+			V const Distance = (e2x * qx + e2y * qy + e2z * qz) * InvDet;
+			std::memcpy(Distances + First, &Distance, sizeof(V));
+			intersect_lanes_hits(HitMask, First, Bits);
+			for(int l = 0; l < N; ++l)
+				if(Bits >> l & 1u)
+					BaryPositions[First + l] = vec2(u[l] * InvDet[l], v[l] * InvDet[l]);
+		}
+		return Whole;
+	}
+
+	// The operations of intersectLineTriangle
+	GLM_INTERSECT_LANES_ATTRIB inline std::size_t intersect_line_triangle_groups(vec3 const& Orig, vec3 const& Dir, triangleBatch const& Triangles,
+		uint32* HitMask, vec3* Positions)
+	{
+		float const Epsilon = std::numeric_limits<float>::epsilon();
+		std::size_t const Whole = Triangles.count / N * N;
+		for(std::size_t First = 0; First < Whole; First += N)
+		{
+			V const x0 = intersect_lanes_load(Triangles.x[0] + First);
+			V const y0 = intersect_lanes_load(Triangles.y[0] + First);
+			V const z0 = intersect_lanes_load(Triangles.z[0] + First);
+			V const e1x = intersect_lanes_load(Triangles.x[1] + First) - x0;
+			V const e1y = intersect_lanes_load(Triangles.y[1] + First) - y0;
+			V const e1z = intersect_lanes_load(Triangles.z[1] + First) - z0;
+			V const e2x = intersect_lanes_load(Triangles.x[2] + First) - x0;
+			V const e2y = intersect_lanes_load(Triangles.y[2] + First) - y0;
+			V const e2z = intersect_lanes_load(Triangles.z[2] + First) - z0;
+
+			V const px = Dir.y * e2z - e2y * Dir.z;
+			V const py = Dir.z * e2x - e2z * Dir.x;
+			V const pz = Dir.x * e2y - e2x * Dir.y;
+			V const Det = e1x * px + e1y * py + e1z * pz;
+			V const InvDet = 1.0f / Det;
+
+			V const tx = Orig.x - x0;
+			V const ty = Orig.y - y0;
+			V const tz = Orig.z - z0;
+			V const y = (tx * px + ty * py + tz * pz) * InvDet;
+			V const cx = ty * e1z - e1y * tz;
+			V const cy = tz * e1x - e1z * tx;
+			V const cz = tx * e1y - e1x * ty;
+			V const z = (Dir.x * cx + Dir.y * cy + Dir.z * cz) * InvDet;
+			V const x = (e2x * cx + e2y * cy + e2z * cz) * InvDet;
+
+			M const Flat = (Det > -Epsilon) & (Det < Epsilon);
+			M const Hit = ~Flat & ~(y < 0.0f) & ~(y > 1.0f) & ~(z < 0.0f) & ~(y + z > 1.0f);
+			uint32 const Bits = GLM_INTERSECT_LANES_BITS(Hit);
+
+			intersect_lanes_hits(HitMask, First, Bits);
+			for(int l = 0; l < N; ++l)
+				if(Bits >> l & 1u)
+					Positions[First + l] = vec3(x[l], y[l], z[l]);
+		}
+		return Whole;
+	}
+
+	// The operations of intersectRaySphere; the lanes that miss take the
+	// square root of a negative number and are masked out
+	GLM_INTERSECT_LANES_ATTRIB inline std::size_t intersect_ray_sphere_groups(vec3 const& Start, vec3 const& Dir, sphereBatch const& Spheres,
+		uint32* HitMask, float* Distances)
+	{
+		float const Epsilon = std::numeric_limits<float>::epsilon();
+		std::size_t const Whole = Spheres.count / N * N;
+		for(std::size_t First = 0; First < Whole; First += N)
+		{
+			V const dx = intersect_lanes_load(Spheres.x + First) - Start.x;
+			V const dy = intersect_lanes_load(Spheres.y + First) - Start.y;
+			V const dz = intersect_lanes_load(Spheres.z + First) - Start.z;
+			V const RadiusSquared = intersect_lanes_load(Spheres.radiusSquared + First);
+
+			V const t0 = dx * Dir.x + dy * Dir.y + dz * Dir.z;
+			V const DSquared = (dx * dx + dy * dy + dz * dz) - t0 * t0;
+			V const t1 = GLM_INTERSECT_LANES_SQRT(RadiusSquared - DSquared);
+			V const Distance = t0 > t1 + Epsilon ? t0 - t1 : t0 + t1;
+
+			M const Hit = ~(DSquared > RadiusSquared) & (Distance > Epsilon);
+			std::memcpy(Distances + First, &Distance, sizeof(V));
+			intersect_lanes_hits(HitMask, First, GLM_INTERSECT_LANES_BITS(Hit));
+		}
+		return Whole;
+	}
+}//namespace GLM_INTERSECT_LANES_NAMESPACE
+}//namespace detail
+}//namespace glm
+
+#if GLM_COMPILER & GLM_COMPILER_GCC
+#	pragma GCC pop_options
+#endif
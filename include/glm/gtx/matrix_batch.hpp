@@ -0,0 +1,59 @@
+/// @ref gtx_matrix_batch
+/// @file glm/gtx/matrix_batch.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_matrix_batch GLM_GTX_matrix_batch
+/// @ingroup gtx
+///
+/// Include <glm/gtx/matrix_batch.hpp> to use the features of this extension.
+///
+/// Multiply, invert and transform arrays of single precision mat4 at once.
+/// The kernel (SSE2, AVX, AVX2+FMA or AVX-512F) is picked at run time from
+/// CPUID, independently of GLM_ARCH.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../simd/matrix_wide.h"
+
+#include <cstddef>
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_matrix_batch is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	else
+#		pragma message("GLM: GLM_GTX_matrix_batch extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_matrix_batch
+	/// @{
+
+	/// out[i] = a[i] * b[i] for i in [0, count). out may alias b.
+	/// @see gtx_matrix_batch
+	template<qualifier Q>
+	GLM_FUNC_DECL void mulBatch(mat<4, 4, float, Q> const* a, mat<4, 4, float, Q> const* b, mat<4, 4, float, Q>* out, std::size_t count);
+
+	/// out[i] = a * b[i] for i in [0, count), e.g. view-projection times every model matrix.
+	/// @see gtx_matrix_batch
+	template<qualifier Q>
+	GLM_FUNC_DECL void mulBatch(mat<4, 4, float, Q> const& a, mat<4, 4, float, Q> const* b, mat<4, 4, float, Q>* out, std::size_t count);
+
+	/// out[i] = inverse(in[i]) for i in [0, count).
+	/// @see gtx_matrix_batch
+	template<qualifier Q>
+	GLM_FUNC_DECL void inverseBatch(mat<4, 4, float, Q> const* in, mat<4, 4, float, Q>* out, std::size_t count);
+
+	/// out[i] = m * in[i] for i in [0, count). out may alias in.
+	/// @see gtx_matrix_batch
+	template<qualifier Q>
+	GLM_FUNC_DECL void transformBatch(mat<4, 4, float, Q> const& m, vec<4, float, Q> const* in, vec<4, float, Q>* out, std::size_t count);
+
+	/// @}
+}// namespace glm
+
+#include "matrix_batch.inl"
@@ -0,0 +1,28 @@
+/// @ref gtx_matrix_batch
+
+namespace glm
+{
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void mulBatch(mat<4, 4, float, Q> const* a, mat<4, 4, float, Q> const* b, mat<4, 4, float, Q>* out, std::size_t count)
+	{
+		glm_mat4_batch().mul(&a[0][0][0], 16, &b[0][0][0], &out[0][0][0], count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void mulBatch(mat<4, 4, float, Q> const& a, mat<4, 4, float, Q> const* b, mat<4, 4, float, Q>* out, std::size_t count)
+	{
+		glm_mat4_batch().mul(&a[0][0], 0, &b[0][0][0], &out[0][0][0], count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void inverseBatch(mat<4, 4, float, Q> const* in, mat<4, 4, float, Q>* out, std::size_t count)
+	{
+		glm_mat4_batch().inverse(&in[0][0][0], &out[0][0][0], count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void transformBatch(mat<4, 4, float, Q> const& m, vec<4, float, Q> const* in, vec<4, float, Q>* out, std::size_t count)
+	{
+		glm_mat4_batch().transform(&m[0][0], &in[0][0], &out[0][0], count);
+	}
+}//namespace glm
@@ -0,0 +1,80 @@
+/// @ref gtx_noise_batch
+/// @file glm/gtx/noise_batch.hpp
+///
+/// @see core (dependence)
+/// @see gtc_noise (dependence)
+///
+/// @defgroup gtx_noise_batch GLM_GTX_noise_batch
+/// @ingroup gtx
+///
+/// Include <glm/gtx/noise_batch.hpp> to use the features of this extension.
+///
+/// Fill a strided float buffer with perlin or simplex noise sampled on a
+/// regular 2D or 3D grid, optionally summed over fBm octaves.
+///
+/// Samples are evaluated in structure-of-arrays form, 4, 8 or 16 points per
+/// instruction depending on the ISA found at run time (SSE2, AVX2+FMA,
+/// AVX-512F), and rows are split across threads. Results match glm::perlin
+/// and glm::simplex within float rounding. Coordinates must stay within
+/// +/-2^31, the range of the float to int conversion used for floor().
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/noise.hpp"
+#include "../simd/cpuid.h"
+
+#include <cstddef>
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_noise_batch is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	else
+#		pragma message("GLM: GLM_GTX_noise_batch extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_noise_batch
+	/// @{
+
+	/// Fractal Brownian motion parameters: octave o is sampled at frequency
+	/// lacunarity^o and weighted by gain^o. One octave is the plain noise.
+	struct noiseOctaves
+	{
+		int count = 1;
+		float lacunarity = 2.0f;
+		float gain = 0.5f;
+	};
+
+	/// out[y * rowStride + x] = perlin(origin + vec2(x, y) * step) for x < width, y < height.
+	/// threads == 0 uses every hardware thread.
+	/// @see gtx_noise_batch
+	GLM_FUNC_DECL void perlinGrid(vec2 const& origin, vec2 const& step, int width, int height,
+		float* out, std::size_t rowStride, noiseOctaves const& octaves = noiseOctaves(), unsigned threads = 0);
+
+	/// out[z * sliceStride + y * rowStride + x] = perlin(origin + vec3(x, y, z) * step).
+	/// @see gtx_noise_batch
+	GLM_FUNC_DECL void perlinGrid(vec3 const& origin, vec3 const& step, int width, int height, int depth,
+		float* out, std::size_t rowStride, std::size_t sliceStride, noiseOctaves const& octaves = noiseOctaves(), unsigned threads = 0);
+
+	/// Same as perlinGrid with glm::simplex.
+	/// @see gtx_noise_batch
+	GLM_FUNC_DECL void simplexGrid(vec2 const& origin, vec2 const& step, int width, int height,
+		float* out, std::size_t rowStride, noiseOctaves const& octaves = noiseOctaves(), unsigned threads = 0);
+
+	/// Same as perlinGrid with glm::simplex.
+	/// @see gtx_noise_batch
+	GLM_FUNC_DECL void simplexGrid(vec3 const& origin, vec3 const& step, int width, int height, int depth,
+		float* out, std::size_t rowStride, std::size_t sliceStride, noiseOctaves const& octaves = noiseOctaves(), unsigned threads = 0);
+
+	/// Name of the instruction set the grid functions run with on this machine.
+	/// @see gtx_noise_batch
+	GLM_FUNC_DECL char const* noiseGridIsa();
+
+	/// @}
+}// namespace glm
+
+#include "noise_batch.inl"
@@ -0,0 +1,252 @@
+/// @ref gtx_noise_batch
+///
+// The lane kernels below are the glm::perlin and glm::simplex code of
+// gtc/noise.inl with every vec4 of corners unrolled into one SIMD register
+// per corner component, so each instruction advances N grid points. The
+// operation order follows the scalar code to keep the results within
+// rounding of it.
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace glm{
+namespace detail
+{
+	struct noise_grid_job
+	{
+		float origin[3];
+		float step[3];
+		int width;
+		int height;
+		float* out;
+		std::size_t rowStride;
+		std::size_t sliceStride;
+		noiseOctaves octaves;
+	};
+
+	// Fills rows [Begin, End) of the job; row r is y = r % height, z = r / height
+	typedef void (*noise_grid_rows_func)(noise_grid_job const& Job, int Begin, int End);
+
+	struct noise_perlin2_scalar
+	{
+		static float scalar(vec3 const& p) { return perlin(vec2(p)); }
+	};
+
+	struct noise_perlin3_scalar
+	{
+		static float scalar(vec3 const& p) { return perlin(p); }
+	};
+
+	struct noise_simplex2_scalar
+	{
+		static float scalar(vec3 const& p) { return simplex(vec2(p)); }
+	};
+
+	struct noise_simplex3_scalar
+	{
+		static float scalar(vec3 const& p) { return simplex(p); }
+	};
+
+	template<typename Noise>
+	void noise_grid_rows_scalar(noise_grid_job const& Job, int Begin, int End)
+	{
+		for(int r = Begin; r < End; ++r)
+		{
+			int const y = r % Job.height;
+			int const z = r / Job.height;
+			float* Row = Job.out + z * Job.sliceStride + y * Job.rowStride;
+			float const py = Job.origin[1] + static_cast<float>(y) * Job.step[1];
+			float const pz = Job.origin[2] + static_cast<float>(z) * Job.step[2];
+			for(int x = 0; x < Job.width; ++x)
+			{
+				vec3 const p(Job.origin[0] + static_cast<float>(x) * Job.step[0], py, pz);
+				float Sum = 0.0f;
+				float Frequency = 1.0f;
+				float Amplitude = 1.0f;
+				for(int o = 0; o < Job.octaves.count; ++o)
+				{
+					Sum += Amplitude * Noise::scalar(p * Frequency);
+					Frequency *= Job.octaves.lacunarity;
+					Amplitude *= Job.octaves.gain;
+				}
+				Row[x] = Sum;
+			}
+		}
+	}
+
+#if GLM_SIMD_WIDE_KERNELS
+	typedef float noise_f4 __attribute__((vector_size(16)));
+	typedef int noise_i4 __attribute__((vector_size(16)));
+	typedef float noise_f8 __attribute__((vector_size(32)));
+	typedef int noise_i8 __attribute__((vector_size(32)));
+	typedef float noise_f16 __attribute__((vector_size(64)));
+	typedef int noise_i16 __attribute__((vector_size(64)));
+
+	template<typename V> struct noise_int;
+	template<> struct noise_int<noise_f4> { typedef noise_i4 type; };
+	template<> struct noise_int<noise_f8> { typedef noise_i8 type; };
+	template<> struct noise_int<noise_f16> { typedef noise_i16 type; };
+
+}//namespace detail
+}//namespace glm
+
+// One copy of the lane kernels per instruction set, each compiled for its own target
+#	define GLM_NOISE_LANES_NAMESPACE noise_sse2
+#	define GLM_NOISE_LANES_TYPE noise_f4
+#	define GLM_NOISE_LANES_TARGET "sse2"
+#	define GLM_NOISE_LANES_ATTRIB GLM_TARGET_SSE2
+#	include "noise_batch_lanes.inl"
+#	undef GLM_NOISE_LANES_NAMESPACE
+#	undef GLM_NOISE_LANES_TYPE
+#	undef GLM_NOISE_LANES_TARGET
+#	undef GLM_NOISE_LANES_ATTRIB
+
+#	define GLM_NOISE_LANES_NAMESPACE noise_avx2
+#	define GLM_NOISE_LANES_TYPE noise_f8
+#	define GLM_NOISE_LANES_TARGET "avx2,fma"
+#	define GLM_NOISE_LANES_ATTRIB GLM_TARGET_AVX2
+#	include "noise_batch_lanes.inl"
+#	undef GLM_NOISE_LANES_NAMESPACE
+#	undef GLM_NOISE_LANES_TYPE
+#	undef GLM_NOISE_LANES_TARGET
+#	undef GLM_NOISE_LANES_ATTRIB
+
+#	define GLM_NOISE_LANES_NAMESPACE noise_avx512f
+#	define GLM_NOISE_LANES_TYPE noise_f16
+#	define GLM_NOISE_LANES_TARGET "avx512f,avx2,fma"
+#	define GLM_NOISE_LANES_ATTRIB GLM_TARGET_AVX512F
+#	include "noise_batch_lanes.inl"
+#	undef GLM_NOISE_LANES_NAMESPACE
+#	undef GLM_NOISE_LANES_TYPE
+#	undef GLM_NOISE_LANES_TARGET
+#	undef GLM_NOISE_LANES_ATTRIB
+
+namespace glm{
+namespace detail
+{
+#endif//GLM_SIMD_WIDE_KERNELS
+
+	// AVX without AVX2 has no 256-bit integer compares, it runs the SSE2 kernels
+	inline int noise_grid_isa()
+	{
+#		if GLM_SIMD_WIDE_KERNELS
+			int const Isa = glm_simd_isa();
+			if(Isa & GLM_SIMD_ISA_AVX512F)
+				return GLM_SIMD_ISA_AVX512F;
+			if(Isa & GLM_SIMD_ISA_AVX2)
+				return GLM_SIMD_ISA_AVX2;
+			if(Isa & GLM_SIMD_ISA_SSE2)
+				return GLM_SIMD_ISA_SSE2;
+#		endif
+		return GLM_SIMD_ISA_NONE;
+	}
+
+	inline noise_grid_rows_func noise_grid_rows_select(noise_grid_rows_func Scalar, noise_grid_rows_func Sse2, noise_grid_rows_func Avx2, noise_grid_rows_func Avx512f)
+	{
+		switch(noise_grid_isa())
+		{
+		case GLM_SIMD_ISA_AVX512F: return Avx512f;
+		case GLM_SIMD_ISA_AVX2: return Avx2;
+		case GLM_SIMD_ISA_SSE2: return Sse2;
+		default: return Scalar;
+		}
+	}
+
+	// Splits the rows in contiguous blocks, one per thread; the calling thread takes the last block
+	inline void noise_grid_run(noise_grid_rows_func Rows, noise_grid_job const& Job, int RowCount, unsigned Threads)
+	{
+		if(Job.width <= 0 || RowCount <= 0)
+			return;
+
+		if(Threads == 0)
+			Threads = std::thread::hardware_concurrency();
+		// below a few rows per thread the thread start costs more than it saves
+		unsigned const MinRows = 4;
+		unsigned const MaxThreads = static_cast<unsigned>(RowCount) / MinRows;
+		if(Threads > MaxThreads)
+			Threads = MaxThreads;
+		if(Threads <= 1)
+		{
+			Rows(Job, 0, RowCount);
+			return;
+		}
+
+		std::vector<std::thread> Workers;
+		Workers.reserve(Threads - 1);
+		int Begin = 0;
+		for(unsigned t = 0; t < Threads - 1; ++t)
+		{
+			int const End = static_cast<int>(static_cast<long long>(RowCount) * (t + 1) / Threads);
+			Workers.emplace_back(Rows, std::cref(Job), Begin, End);
+			Begin = End;
+		}
+		Rows(Job, Begin, RowCount);
+		for(std::size_t t = 0; t < Workers.size(); ++t)
+			Workers[t].join();
+	}
+
+	inline noise_grid_job noise_grid_make_job(vec3 const& origin, vec3 const& step, int width, int height, float* out, std::size_t rowStride, std::size_t sliceStride, noiseOctaves const& octaves)
+	{
+		noise_grid_job Job;
+		for(int i = 0; i < 3; ++i)
+		{
+			Job.origin[i] = origin[i];
+			Job.step[i] = step[i];
+		}
+		Job.width = width;
+		Job.height = height;
+		Job.out = out;
+		Job.rowStride = rowStride;
+		Job.sliceStride = sliceStride;
+		Job.octaves = octaves;
+		return Job;
+	}
+}//namespace detail
+
+#if GLM_SIMD_WIDE_KERNELS
+#	define GLM_NOISE_GRID_ROWS(Name) detail::noise_grid_rows_select(detail::noise_grid_rows_scalar<detail::Name##_scalar>, \
+		detail::noise_sse2::Name##_rows, detail::noise_avx2::Name##_rows, detail::noise_avx512f::Name##_rows)
+#else
+#	define GLM_NOISE_GRID_ROWS(Name) detail::noise_grid_rows_select(detail::noise_grid_rows_scalar<detail::Name##_scalar>, 0, 0, 0)
+#endif
+
+	GLM_FUNC_QUALIFIER void perlinGrid(vec2 const& origin, vec2 const& step, int width, int height,
+		float* out, std::size_t rowStride, noiseOctaves const& octaves, unsigned threads)
+	{
+		static detail::noise_grid_rows_func const Rows = GLM_NOISE_GRID_ROWS(noise_perlin2);
+		detail::noise_grid_job const Job = detail::noise_grid_make_job(vec3(origin, 0.0f), vec3(step, 0.0f), width, height, out, rowStride, 0, octaves);
+		detail::noise_grid_run(Rows, Job, height, threads);
+	}
+
+	GLM_FUNC_QUALIFIER void perlinGrid(vec3 const& origin, vec3 const& step, int width, int height, int depth,
+		float* out, std::size_t rowStride, std::size_t sliceStride, noiseOctaves const& octaves, unsigned threads)
+	{
+		static detail::noise_grid_rows_func const Rows = GLM_NOISE_GRID_ROWS(noise_perlin3);
+		detail::noise_grid_job const Job = detail::noise_grid_make_job(origin, step, width, height, out, rowStride, sliceStride, octaves);
+		detail::noise_grid_run(Rows, Job, height * depth, threads);
+	}
+
+	GLM_FUNC_QUALIFIER void simplexGrid(vec2 const& origin, vec2 const& step, int width, int height,
+		float* out, std::size_t rowStride, noiseOctaves const& octaves, unsigned threads)
+	{
+		static detail::noise_grid_rows_func const Rows = GLM_NOISE_GRID_ROWS(noise_simplex2);
+		detail::noise_grid_job const Job = detail::noise_grid_make_job(vec3(origin, 0.0f), vec3(step, 0.0f), width, height, out, rowStride, 0, octaves);
+		detail::noise_grid_run(Rows, Job, height, threads);
+	}
+
+	GLM_FUNC_QUALIFIER void simplexGrid(vec3 const& origin, vec3 const& step, int width, int height, int depth,
+		float* out, std::size_t rowStride, std::size_t sliceStride, noiseOctaves const& octaves, unsigned threads)
+	{
+		static detail::noise_grid_rows_func const Rows = GLM_NOISE_GRID_ROWS(noise_simplex3);
+		detail::noise_grid_job const Job = detail::noise_grid_make_job(origin, step, width, height, out, rowStride, sliceStride, octaves);
+		detail::noise_grid_run(Rows, Job, height * depth, threads);
+	}
+
+#undef GLM_NOISE_GRID_ROWS
+
+	GLM_FUNC_QUALIFIER char const* noiseGridIsa()
+	{
+		return glm_simd_isa_name(detail::noise_grid_isa());
+	}
+}//namespace glm
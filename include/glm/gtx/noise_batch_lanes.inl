@@ -0,0 +1,381 @@
+/// @ref gtx_noise_batch
+///
+// Lane kernels of GLM_GTX_noise_batch. noise_batch.inl includes this file
+// once per instruction set after defining:
+//   GLM_NOISE_LANES_NAMESPACE  namespace of this copy
+//   GLM_NOISE_LANES_TYPE       float vector type with 4, 8 or 16 lanes
+//   GLM_NOISE_LANES_TARGET     GCC target string of this copy
+//   GLM_NOISE_LANES_ATTRIB     target attribute of the row entry points
+// With GCC every helper is compiled for the target of its caller, so the
+// 256 and 512-bit vectors never cross a function boundary of another ABI.
+
+#if GLM_COMPILER & GLM_COMPILER_GCC
+#	pragma GCC push_options
+#	define GLM_NOISE_LANES_PRAGMA(x) _Pragma(#x)
+#	define GLM_NOISE_LANES_TARGET_PRAGMA(t) GLM_NOISE_LANES_PRAGMA(GCC target(t))
+	GLM_NOISE_LANES_TARGET_PRAGMA(GLM_NOISE_LANES_TARGET)
+#	undef GLM_NOISE_LANES_TARGET_PRAGMA
+#	undef GLM_NOISE_LANES_PRAGMA
+// FMA contraction would move h = 1 - |x| - |y| of the simplex gradients
+// across 0 on lattice points where the scalar code lands exactly on it and
+// flip the gradient, so every operation is rounded like in glm::simplex.
+#	pragma GCC optimize("fp-contract=off")
+#endif
+
+namespace glm{
+namespace detail{
+namespace GLM_NOISE_LANES_NAMESPACE
+{
+	typedef GLM_NOISE_LANES_TYPE V;
+	typedef noise_int<V>::type I;
+
+	GLM_WIDE_INLINE V noise_floor(V const& x)
+	{
+		V const t = __builtin_convertvector(__builtin_convertvector(x, I), V);
+		return t + __builtin_convertvector(t > x, V); // true is -1
+	}
+
+	GLM_WIDE_INLINE V noise_fract(V const& x)
+	{
+		return x - noise_floor(x);
+	}
+
+	GLM_WIDE_INLINE V noise_abs(V const& x)
+	{
+		return reinterpret_cast<V>(reinterpret_cast<I>(x) & 0x7fffffff);
+	}
+
+	// step(Edge, x)
+	GLM_WIDE_INLINE V noise_step(V const& Edge, V const& x)
+	{
+		return x < Edge ? V{} : V{} + 1.0f;
+	}
+
+	GLM_WIDE_INLINE V noise_max(V const& a, V const& b)
+	{
+		return a < b ? b : a;
+	}
+
+	GLM_WIDE_INLINE V noise_min(V const& a, V const& b)
+	{
+		return b < a ? b : a;
+	}
+
+	GLM_WIDE_INLINE V noise_mix(V const& x, V const& y, V const& a)
+	{
+		return x * (1.0f - a) + y * a;
+	}
+
+	// glm::mod(x, 289)
+	GLM_WIDE_INLINE V noise_mod(V const& x)
+	{
+		return x - 289.0f * noise_floor(x / 289.0f);
+	}
+
+	GLM_WIDE_INLINE V noise_mod289(V const& x)
+	{
+		return x - noise_floor(x * (1.0f / 289.0f)) * 289.0f;
+	}
+
+	GLM_WIDE_INLINE V noise_permute(V const& x)
+	{
+		return noise_mod289(((x * 34.0f) + 1.0f) * x);
+	}
+
+	GLM_WIDE_INLINE V noise_taylorInvSqrt(V const& r)
+	{
+		return 1.79284291400159f - 0.85373472095314f * r;
+	}
+
+	GLM_WIDE_INLINE V noise_fade(V const& t)
+	{
+		return (t * t * t) * (t * (t * 6.0f - 15.0f) + 10.0f);
+	}
+
+	// One corner of the 2D perlin noise: gradient from the hash i, dotted with the offset (fx, fy)
+	GLM_WIDE_INLINE V noise_perlin2_corner(V const& i, V const& fx, V const& fy)
+	{
+		V gx = 2.0f * noise_fract(i / 41.0f) - 1.0f;
+		V gy = noise_abs(gx) - 0.5f;
+		V const tx = noise_floor(gx + 0.5f);
+		gx = gx - tx;
+		V const norm = noise_taylorInvSqrt(gx * gx + gy * gy);
+		gx *= norm;
+		gy *= norm;
+		return gx * fx + gy * fy;
+	}
+
+	GLM_WIDE_INLINE V noise_perlin2(V const& px, V const& py, V const&)
+	{
+		V const Pi0x = noise_mod(noise_floor(px));
+		V const Pi0y = noise_mod(noise_floor(py));
+		V const Pi1x = noise_mod(noise_floor(px) + 1.0f);
+		V const Pi1y = noise_mod(noise_floor(py) + 1.0f);
+		V const Pf0x = noise_fract(px);
+		V const Pf0y = noise_fract(py);
+		V const Pf1x = Pf0x - 1.0f;
+		V const Pf1y = Pf0y - 1.0f;
+
+		V const p0 = noise_permute(Pi0x);
+		V const p1 = noise_permute(Pi1x);
+		V const n00 = noise_perlin2_corner(noise_permute(p0 + Pi0y), Pf0x, Pf0y);
+		V const n10 = noise_perlin2_corner(noise_permute(p1 + Pi0y), Pf1x, Pf0y);
+		V const n01 = noise_perlin2_corner(noise_permute(p0 + Pi1y), Pf0x, Pf1y);
+		V const n11 = noise_perlin2_corner(noise_permute(p1 + Pi1y), Pf1x, Pf1y);
+
+		V const fadeX = noise_fade(Pf0x);
+		V const fadeY = noise_fade(Pf0y);
+		V const nx0 = noise_mix(n00, n10, fadeX);
+		V const nx1 = noise_mix(n01, n11, fadeX);
+		return 2.3f * noise_mix(nx0, nx1, fadeY);
+	}
+
+	GLM_WIDE_INLINE V noise_perlin3_corner(V const& ixy, V const& fx, V const& fy, V const& fz)
+	{
+		V gx = ixy * (1.0f / 7.0f);
+		V gy = noise_fract(noise_floor(gx) * (1.0f / 7.0f)) - 0.5f;
+		gx = noise_fract(gx);
+		V const gz = 0.5f - noise_abs(gx) - noise_abs(gy);
+		V const sz = noise_step(gz, V{});
+		gx -= sz * (noise_step(V{}, gx) - 0.5f);
+		gy -= sz * (noise_step(V{}, gy) - 0.5f);
+		V const norm = noise_taylorInvSqrt(gx * gx + gy * gy + gz * gz);
+		return (gx * norm) * fx + (gy * norm) * fy + (gz * norm) * fz;
+	}
+
+	GLM_WIDE_INLINE V noise_perlin3(V const& px, V const& py, V const& pz)
+	{
+		V const Fx = noise_floor(px);
+		V const Fy = noise_floor(py);
+		V const Fz = noise_floor(pz);
+		V const Pi0x = noise_mod289(Fx);
+		V const Pi0y = noise_mod289(Fy);
+		V const Pi0z = noise_mod289(Fz);
+		V const Pi1x = noise_mod289(Fx + 1.0f);
+		V const Pi1y = noise_mod289(Fy + 1.0f);
+		V const Pi1z = noise_mod289(Fz + 1.0f);
+		V const Pf0x = px - Fx;
+		V const Pf0y = py - Fy;
+		V const Pf0z = pz - Fz;
+		V const Pf1x = Pf0x - 1.0f;
+		V const Pf1y = Pf0y - 1.0f;
+		V const Pf1z = Pf0z - 1.0f;
+
+		V const p0 = noise_permute(Pi0x);
+		V const p1 = noise_permute(Pi1x);
+		V const ixy00 = noise_permute(p0 + Pi0y);
+		V const ixy10 = noise_permute(p1 + Pi0y);
+		V const ixy01 = noise_permute(p0 + Pi1y);
+		V const ixy11 = noise_permute(p1 + Pi1y);
+
+		V const n000 = noise_perlin3_corner(noise_permute(ixy00 + Pi0z), Pf0x, Pf0y, Pf0z);
+		V const n100 = noise_perlin3_corner(noise_permute(ixy10 + Pi0z), Pf1x, Pf0y, Pf0z);
+		V const n010 = noise_perlin3_corner(noise_permute(ixy01 + Pi0z), Pf0x, Pf1y, Pf0z);
+		V const n110 = noise_perlin3_corner(noise_permute(ixy11 + Pi0z), Pf1x, Pf1y, Pf0z);
+		V const n001 = noise_perlin3_corner(noise_permute(ixy00 + Pi1z), Pf0x, Pf0y, Pf1z);
+		V const n101 = noise_perlin3_corner(noise_permute(ixy10 + Pi1z), Pf1x, Pf0y, Pf1z);
+		V const n011 = noise_perlin3_corner(noise_permute(ixy01 + Pi1z), Pf0x, Pf1y, Pf1z);
+		V const n111 = noise_perlin3_corner(noise_permute(ixy11 + Pi1z), Pf1x, Pf1y, Pf1z);
+
+		V const fadeX = noise_fade(Pf0x);
+		V const fadeY = noise_fade(Pf0y);
+		V const fadeZ = noise_fade(Pf0z);
+		V const nz00 = noise_mix(n000, n001, fadeZ);
+		V const nz10 = noise_mix(n100, n101, fadeZ);
+		V const nz01 = noise_mix(n010, n011, fadeZ);
+		V const nz11 = noise_mix(n110, n111, fadeZ);
+		V const nyz0 = noise_mix(nz00, nz01, fadeY);
+		V const nyz1 = noise_mix(nz10, nz11, fadeY);
+		return 2.2f * noise_mix(nyz0, nyz1, fadeX);
+	}
+
+	// One corner of the 2D simplex noise, (x, y) is the offset from the corner
+	GLM_WIDE_INLINE V noise_simplex2_corner(V const& p, V const& x, V const& y)
+	{
+		V m = noise_max(0.5f - (x * x + y * y), V{});
+		m = m * m;
+		m = m * m;
+		V const gx = 2.0f * noise_fract(p * 0.024390243902439f) - 1.0f;
+		V const h = noise_abs(gx) - 0.5f;
+		V const ox = noise_floor(gx + 0.5f);
+		V const a0 = gx - ox;
+		m *= 1.79284291400159f - 0.85373472095314f * (a0 * a0 + h * h);
+		return m * (a0 * x + h * y);
+	}
+
+	GLM_WIDE_INLINE V noise_simplex2(V const& vx, V const& vy, V const&)
+	{
+		float const C0 = 0.211324865405187f;
+		float const C1 = 0.366025403784439f;
+		float const C2 = -0.577350269189626f;
+
+		// First corner
+		V const s = vx * C1 + vy * C1;
+		V ix = noise_floor(vx + s);
+		V iy = noise_floor(vy + s);
+		V const t = ix * C0 + iy * C0;
+		V const x0 = vx - ix + t;
+		V const y0 = vy - iy + t;
+
+		// Other corners
+		V const i1x = x0 > y0 ? V{} + 1.0f : V{};
+		V const i1y = 1.0f - i1x;
+		V const x1 = x0 + C0 - i1x;
+		V const y1 = y0 + C0 - i1y;
+		V const x2 = x0 + C2;
+		V const y2 = y0 + C2;
+
+		// Permutations
+		ix = noise_mod(ix);
+		iy = noise_mod(iy);
+		V const p0 = noise_permute(noise_permute(iy) + ix);
+		V const p1 = noise_permute(noise_permute(iy + i1y) + ix + i1x);
+		V const p2 = noise_permute(noise_permute(iy + 1.0f) + ix + 1.0f);
+
+		V const n = noise_simplex2_corner(p0, x0, y0)
+			+ noise_simplex2_corner(p1, x1, y1)
+			+ noise_simplex2_corner(p2, x2, y2);
+		return 130.0f * n;
+	}
+
+	// One corner of the 3D simplex noise, p is the corner hash and (x, y, z) the offset from the corner
+	GLM_WIDE_INLINE V noise_simplex3_corner(V const& p, V const& x, V const& y, V const& z)
+	{
+		// Gradients: 7x7 points over a square, mapped onto an octahedron.
+		float const n_ = 0.142857142857f; // 1.0/7.0
+		float const nsx = n_ * 2.0f;
+		float const nsy = n_ * 0.5f - 1.0f;
+		float const nsz = n_;
+
+		V const j = p - 49.0f * noise_floor(p * nsz * nsz); // mod(p,7*7)
+		V const x_ = noise_floor(j * nsz);
+		V const y_ = noise_floor(j - 7.0f * x_); // mod(j,N)
+
+		V const gx = x_ * nsx + nsy;
+		V const gy = y_ * nsx + nsy;
+		V const h = 1.0f - noise_abs(gx) - noise_abs(gy);
+
+		V const sh = -noise_step(h, V{});
+		V const ax = gx + (noise_floor(gx) * 2.0f + 1.0f) * sh;
+		V const ay = gy + (noise_floor(gy) * 2.0f + 1.0f) * sh;
+
+		V const norm = noise_taylorInvSqrt(ax * ax + ay * ay + h * h);
+		V m = noise_max(0.6f - (x * x + y * y + z * z), V{});
+		m = m * m;
+		return (m * m) * ((ax * norm) * x + (ay * norm) * y + (h * norm) * z);
+	}
+
+	GLM_WIDE_INLINE V noise_simplex3(V const& vx, V const& vy, V const& vz)
+	{
+		float const Cx = 1.0f / 6.0f;
+		float const Cy = 1.0f / 3.0f;
+
+		// First corner
+		V const s = vx * Cy + vy * Cy + vz * Cy;
+		V ix = noise_floor(vx + s);
+		V iy = noise_floor(vy + s);
+		V iz = noise_floor(vz + s);
+		V const t = ix * Cx + iy * Cx + iz * Cx;
+		V const x0 = vx - ix + t;
+		V const y0 = vy - iy + t;
+		V const z0 = vz - iz + t;
+
+		// Other corners
+		V const gx = noise_step(y0, x0);
+		V const gy = noise_step(z0, y0);
+		V const gz = noise_step(x0, z0);
+		V const lx = 1.0f - gx;
+		V const ly = 1.0f - gy;
+		V const lz = 1.0f - gz;
+		V const i1x = noise_min(gx, lz);
+		V const i1y = noise_min(gy, lx);
+		V const i1z = noise_min(gz, ly);
+		V const i2x = noise_max(gx, lz);
+		V const i2y = noise_max(gy, lx);
+		V const i2z = noise_max(gz, ly);
+
+		V const x1 = x0 - i1x + Cx;
+		V const y1 = y0 - i1y + Cx;
+		V const z1 = z0 - i1z + Cx;
+		V const x2 = x0 - i2x + Cy;
+		V const y2 = y0 - i2y + Cy;
+		V const z2 = z0 - i2z + Cy;
+		V const x3 = x0 - 0.5f;
+		V const y3 = y0 - 0.5f;
+		V const z3 = z0 - 0.5f;
+
+		// Permutations
+		ix = noise_mod289(ix);
+		iy = noise_mod289(iy);
+		iz = noise_mod289(iz);
+		V const p0 = noise_permute(noise_permute(noise_permute(iz) + iy) + ix);
+		V const p1 = noise_permute(noise_permute(noise_permute(iz + i1z) + iy + i1y) + ix + i1x);
+		V const p2 = noise_permute(noise_permute(noise_permute(iz + i2z) + iy + i2y) + ix + i2x);
+		V const p3 = noise_permute(noise_permute(noise_permute(iz + 1.0f) + iy + 1.0f) + ix + 1.0f);
+
+		V const n = noise_simplex3_corner(p0, x0, y0, z0)
+			+ noise_simplex3_corner(p1, x1, y1, z1)
+			+ noise_simplex3_corner(p2, x2, y2, z2)
+			+ noise_simplex3_corner(p3, x3, y3, z3);
+		return 42.0f * n;
+	}
+
+	template<V (*Eval)(V const&, V const&, V const&)>
+	GLM_WIDE_INLINE void noise_grid_rows(noise_grid_job const& Job, int Begin, int End)
+	{
+		int const N = static_cast<int>(sizeof(V) / sizeof(float));
+		V Lane;
+		for(int l = 0; l < N; ++l)
+			Lane[l] = static_cast<float>(l);
+
+		for(int r = Begin; r < End; ++r)
+		{
+			int const y = r % Job.height;
+			int const z = r / Job.height;
+			float* Row = Job.out + z * Job.sliceStride + y * Job.rowStride;
+			float const py = Job.origin[1] + static_cast<float>(y) * Job.step[1];
+			float const pz = Job.origin[2] + static_cast<float>(z) * Job.step[2];
+			for(int x = 0; x < Job.width; x += N)
+			{
+				V const px = Job.origin[0] + (static_cast<float>(x) + Lane) * Job.step[0];
+				V Sum = V{};
+				float Frequency = 1.0f;
+				float Amplitude = 1.0f;
+				for(int o = 0; o < Job.octaves.count; ++o)
+				{
+					Sum += Amplitude * Eval(px * Frequency, V{} + py * Frequency, V{} + pz * Frequency);
+					Frequency *= Job.octaves.lacunarity;
+					Amplitude *= Job.octaves.gain;
+				}
+				int const Count = Job.width - x < N ? Job.width - x : N;
+				std::memcpy(Row + x, &Sum, Count * sizeof(float));
+			}
+		}
+	}
+
+	GLM_NOISE_LANES_ATTRIB inline void noise_perlin2_rows(noise_grid_job const& Job, int Begin, int End)
+	{
+		noise_grid_rows<noise_perlin2>(Job, Begin, End);
+	}
+
+	GLM_NOISE_LANES_ATTRIB inline void noise_perlin3_rows(noise_grid_job const& Job, int Begin, int End)
+	{
+		noise_grid_rows<noise_perlin3>(Job, Begin, End);
+	}
+
+	GLM_NOISE_LANES_ATTRIB inline void noise_simplex2_rows(noise_grid_job const& Job, int Begin, int End)
+	{
+		noise_grid_rows<noise_simplex2>(Job, Begin, End);
+	}
+
+	GLM_NOISE_LANES_ATTRIB inline void noise_simplex3_rows(noise_grid_job const& Job, int Begin, int End)
+	{
+		noise_grid_rows<noise_simplex3>(Job, Begin, End);
+	}
+}//namespace GLM_NOISE_LANES_NAMESPACE
+}//namespace detail
+}//namespace glm
+
+#if GLM_COMPILER & GLM_COMPILER_GCC
+#	pragma GCC pop_options
+#endif
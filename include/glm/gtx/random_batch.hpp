@@ -0,0 +1,81 @@
+/// @ref gtx_random_batch
+/// @file glm/gtx/random_batch.hpp
+///
+/// @see core (dependence)
+/// @see gtc_random (dependence)
+///
+/// @defgroup gtx_random_batch GLM_GTX_random_batch
+/// @ingroup gtx
+///
+/// Include <glm/gtx/random_batch.hpp> to use the features of this extension.
+///
+/// Fill arrays with uniform, gaussian or on-sphere samples drawn from 16
+/// interleaved xoshiro128** streams.
+///
+/// Sample i comes from stream i % 16, so the streams advance 4, 8 or 16 at a
+/// time in SIMD registers depending on the ISA found at run time (SSE2,
+/// AVX2, AVX-512F) and the output for a seed is the same, bit for bit, on
+/// every machine. Gaussian samples use the 256 layer ziggurat of Marsaglia
+/// and Tsang; the rare samples outside a layer's rectangle are finished with
+/// scalar code on their own stream. On-sphere samples are normalized
+/// gaussian triples.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/random.hpp"
+#include "../simd/cpuid.h"
+
+#include <cstddef>
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_random_batch is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	else
+#		pragma message("GLM: GLM_GTX_random_batch extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_random_batch
+	/// @{
+
+	/// The state of 16 xoshiro128** generators, word w of stream s at state[w][s].
+	/// A set is used by one thread at a time; give each thread its own.
+	struct randomStreams
+	{
+		uint32 state[4][16];
+	};
+
+	/// Seeds the 16 streams from one 64-bit seed.
+	/// @see gtx_random_batch
+	GLM_FUNC_DECL void seedRandomStreams(randomStreams& streams, uint64 seed);
+
+	/// The calling thread's streams, seeded on first use like the generators of
+	/// gtc_random: 0, 1, 2... in the order the threads first ask.
+	/// @see gtx_random_batch
+	GLM_FUNC_DECL randomStreams& threadRandomStreams();
+
+	/// out[i] uniform in [Min, Max) for i < count.
+	/// @see gtx_random_batch
+	GLM_FUNC_DECL void linearRandBatch(randomStreams& streams, float Min, float Max, float* out, std::size_t count);
+
+	/// out[i] normal with the given mean and standard deviation for i < count.
+	/// Unlike gaussRand, Deviation is not squared.
+	/// @see gtx_random_batch
+	GLM_FUNC_DECL void gaussRandBatch(randomStreams& streams, float Mean, float Deviation, float* out, std::size_t count);
+
+	/// out[i] uniform on the sphere of the given radius for i < count.
+	/// @see gtx_random_batch
+	GLM_FUNC_DECL void sphericalRandBatch(randomStreams& streams, float Radius, vec3* out, std::size_t count);
+
+	/// Name of the instruction set the batch functions run with on this machine.
+	/// @see gtx_random_batch
+	GLM_FUNC_DECL char const* randomBatchIsa();
+
+	/// @}
+}// namespace glm
+
+#include "random_batch.inl"
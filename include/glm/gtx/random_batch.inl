@@ -0,0 +1,324 @@
+/// @ref gtx_random_batch
+///
+// The scalar functions below are the reference: sample i is drawn from stream
+// i % 16 by the same operations, in the same order, as the lane kernels of
+// random_batch_lanes.inl draw it for N streams at once. Neither side fuses a
+// multiply and an add, so both round alike.
+
+#include <cmath>
+#include <cstring>
+
+#if GLM_SIMD_WIDE_KERNELS
+#	include <immintrin.h>
+#endif
+
+#if GLM_COMPILER & GLM_COMPILER_GCC
+#	pragma GCC push_options
+#	pragma GCC optimize("fp-contract=off")
+#endif
+
+namespace glm{
+namespace detail
+{
+	int const random_stream_count = 16;
+
+	// Marsaglia and Tsang's ziggurat of 256 layers for a draw u: the layer is
+	// u & 255 and j = int32(u) >> 8, 24 bits with the sign. Inside the layer's
+	// rectangle, |j| < k[layer], the sample is j * w[layer]; that takes all
+	// but 0.7% of the draws.
+	struct random_ziggurat
+	{
+		int32 k[256];
+		float w[256];
+		float f[256]; // exp(-x^2 / 2) at the outer edge of each layer
+	};
+
+	inline random_ziggurat random_ziggurat_build()
+	{
+		double const m = 8388608.0; // 2^23, the range of |j|
+		double const v = 4.92867323399e-3; // area of a layer
+		double d = 3.6541528853610088; // start of the tail
+		double t = d;
+		double const q = v / std::exp(-0.5 * d * d);
+
+		random_ziggurat Z;
+		Z.k[0] = static_cast<int32>((d / q) * m);
+		Z.k[1] = 0;
+		Z.w[0] = static_cast<float>(q / m);
+		Z.w[255] = static_cast<float>(d / m);
+		Z.f[0] = 1.0f;
+		Z.f[255] = static_cast<float>(std::exp(-0.5 * d * d));
+		for(int i = 254; i >= 1; --i)
+		{
+			d = std::sqrt(-2.0 * std::log(v / d + std::exp(-0.5 * d * d)));
+			Z.k[i + 1] = static_cast<int32>((d / t) * m);
+			t = d;
+			Z.f[i] = static_cast<float>(std::exp(-0.5 * d * d));
+			Z.w[i] = static_cast<float>(d / m);
+		}
+		return Z;
+	}
+
+	inline random_ziggurat const& random_ziggurat_tables()
+	{
+		static random_ziggurat const Tables = random_ziggurat_build();
+		return Tables;
+	}
+
+	inline uint32 random_stream_next(randomStreams& Streams, int Stream)
+	{
+		return random_next(Streams.state[0][Stream], Streams.state[1][Stream], Streams.state[2][Stream], Streams.state[3][Stream]);
+	}
+
+	// [0, 1) from the high 24 bits
+	inline float random_unit(uint32 u)
+	{
+		return static_cast<float>(static_cast<int32>(u >> 8)) * (1.0f / 16777216.0f);
+	}
+
+	inline float random_linear_sample(randomStreams& Streams, int Stream, float Min, float Scale)
+	{
+		return Min + random_unit(random_stream_next(Streams, Stream)) * Scale;
+	}
+
+	// A draw outside its layer's rectangle: the wedge of the layer, or past the
+	// last layer the tail, both by rejection on the same generator, given as
+	// its four words.
+	inline float random_gauss_fix(uint32& s0, uint32& s1, uint32& s2, uint32& s3, int32 j, int32 Layer)
+	{
+		random_ziggurat const& Z = random_ziggurat_tables();
+		float const r = 3.654153f;
+		for(;;)
+		{
+			float x = static_cast<float>(j) * Z.w[Layer];
+			if(Layer == 0)
+			{
+				float y;
+				do
+				{
+					x = -std::log(random_unit(random_next(s0, s1, s2, s3)) + 0.5f / 16777216.0f) * (1.0f / r);
+					y = -std::log(random_unit(random_next(s0, s1, s2, s3)) + 0.5f / 16777216.0f);
+				} while(y + y < x * x);
+				return j > 0 ? r + x : -r - x;
+			}
+			if(Z.f[Layer] + random_unit(random_next(s0, s1, s2, s3)) * (Z.f[Layer - 1] - Z.f[Layer]) < std::exp(-0.5f * x * x))
+				return x;
+
+			uint32 const u = random_next(s0, s1, s2, s3);
+			Layer = static_cast<int32>(u & 255u);
+			j = static_cast<int32>(u) >> 8;
+			if((j < 0 ? -j : j) < Z.k[Layer])
+				return static_cast<float>(j) * Z.w[Layer];
+		}
+	}
+
+	inline float random_gauss_sample(randomStreams& Streams, int Stream)
+	{
+		random_ziggurat const& Z = random_ziggurat_tables();
+		uint32 const u = random_stream_next(Streams, Stream);
+		int32 const Layer = static_cast<int32>(u & 255u);
+		int32 const j = static_cast<int32>(u) >> 8;
+		if((j < 0 ? -j : j) < Z.k[Layer])
+			return static_cast<float>(j) * Z.w[Layer];
+		return random_gauss_fix(Streams.state[0][Stream], Streams.state[1][Stream], Streams.state[2][Stream], Streams.state[3][Stream], j, Layer);
+	}
+
+	inline vec3 random_sphere_sample(randomStreams& Streams, int Stream, float Radius)
+	{
+		float const x = random_gauss_sample(Streams, Stream);
+		float const y = random_gauss_sample(Streams, Stream);
+		float const z = random_gauss_sample(Streams, Stream);
+		float const Scale = Radius / std::sqrt(x * x + y * y + z * z);
+		return vec3(x * Scale, y * Scale, z * Scale);
+	}
+
+	// Fills Rounds * 16 samples, sample r * 16 + s from stream s
+	typedef void (*random_linear_func)(randomStreams& Streams, float Min, float Scale, float* Out, std::size_t Rounds);
+	typedef void (*random_gauss_func)(randomStreams& Streams, float Mean, float Deviation, float* Out, std::size_t Rounds);
+	typedef void (*random_sphere_func)(randomStreams& Streams, float Radius, vec3* Out, std::size_t Rounds);
+
+	inline void random_linear_scalar(randomStreams& Streams, float Min, float Scale, float* Out, std::size_t Rounds)
+	{
+		for(std::size_t r = 0; r < Rounds; ++r)
+			for(int s = 0; s < random_stream_count; ++s)
+				Out[r * random_stream_count + s] = random_linear_sample(Streams, s, Min, Scale);
+	}
+
+	inline void random_gauss_scalar(randomStreams& Streams, float Mean, float Deviation, float* Out, std::size_t Rounds)
+	{
+		for(std::size_t r = 0; r < Rounds; ++r)
+			for(int s = 0; s < random_stream_count; ++s)
+				Out[r * random_stream_count + s] = Mean + Deviation * random_gauss_sample(Streams, s);
+	}
+
+	inline void random_sphere_scalar(randomStreams& Streams, float Radius, vec3* Out, std::size_t Rounds)
+	{
+		for(std::size_t r = 0; r < Rounds; ++r)
+			for(int s = 0; s < random_stream_count; ++s)
+				Out[r * random_stream_count + s] = random_sphere_sample(Streams, s, Radius);
+	}
+
+#if GLM_SIMD_WIDE_KERNELS
+	typedef float random_f4 __attribute__((vector_size(16)));
+	typedef int random_i4 __attribute__((vector_size(16)));
+	typedef unsigned int random_u4 __attribute__((vector_size(16)));
+	typedef float random_f8 __attribute__((vector_size(32)));
+	typedef int random_i8 __attribute__((vector_size(32)));
+	typedef unsigned int random_u8 __attribute__((vector_size(32)));
+	typedef float random_f16 __attribute__((vector_size(64)));
+	typedef int random_i16 __attribute__((vector_size(64)));
+	typedef unsigned int random_u16 __attribute__((vector_size(64)));
+
+	template<typename V> struct random_lanes;
+	template<> struct random_lanes<random_f4> { typedef random_i4 int_type; typedef random_u4 uint_type; };
+	template<> struct random_lanes<random_f8> { typedef random_i8 int_type; typedef random_u8 uint_type; };
+	template<> struct random_lanes<random_f16> { typedef random_i16 int_type; typedef random_u16 uint_type; };
+
+}//namespace detail
+}//namespace glm
+
+// One copy of the lane kernels per instruction set, each compiled for its own target
+#	define GLM_RANDOM_LANES_NAMESPACE random_sse2
+#	define GLM_RANDOM_LANES_TYPE random_f4
+#	define GLM_RANDOM_LANES_SQRT(x) _mm_sqrt_ps(x)
+#	define GLM_RANDOM_LANES_TARGET "sse2"
+#	define GLM_RANDOM_LANES_ATTRIB GLM_TARGET_SSE2
+#	include "random_batch_lanes.inl"
+#	undef GLM_RANDOM_LANES_NAMESPACE
+#	undef GLM_RANDOM_LANES_TYPE
+#	undef GLM_RANDOM_LANES_SQRT
+#	undef GLM_RANDOM_LANES_TARGET
+#	undef GLM_RANDOM_LANES_ATTRIB
+
+#	define GLM_RANDOM_LANES_NAMESPACE random_avx2
+#	define GLM_RANDOM_LANES_TYPE random_f8
+#	define GLM_RANDOM_LANES_SQRT(x) _mm256_sqrt_ps(x)
+#	define GLM_RANDOM_LANES_TARGET "avx2,fma"
+#	define GLM_RANDOM_LANES_ATTRIB GLM_TARGET_AVX2
+#	include "random_batch_lanes.inl"
+#	undef GLM_RANDOM_LANES_NAMESPACE
+#	undef GLM_RANDOM_LANES_TYPE
+#	undef GLM_RANDOM_LANES_SQRT
+#	undef GLM_RANDOM_LANES_TARGET
+#	undef GLM_RANDOM_LANES_ATTRIB
+
+#	define GLM_RANDOM_LANES_NAMESPACE random_avx512f
+#	define GLM_RANDOM_LANES_TYPE random_f16
+// the masked form, _mm512_sqrt_ps trips -Wmaybe-uninitialized in GCC 12
+#	define GLM_RANDOM_LANES_SQRT(x) _mm512_mask_sqrt_ps(x, 0xffff, x)
+#	define GLM_RANDOM_LANES_TARGET "avx512f,avx2,fma"
+#	define GLM_RANDOM_LANES_ATTRIB GLM_TARGET_AVX512F
+#	include "random_batch_lanes.inl"
+#	undef GLM_RANDOM_LANES_NAMESPACE
+#	undef GLM_RANDOM_LANES_TYPE
+#	undef GLM_RANDOM_LANES_SQRT
+#	undef GLM_RANDOM_LANES_TARGET
+#	undef GLM_RANDOM_LANES_ATTRIB
+
+namespace glm{
+namespace detail
+{
+#endif//GLM_SIMD_WIDE_KERNELS
+
+	// AVX without AVX2 has no 256-bit integer shifts, it runs the SSE2 kernels
+	inline int random_batch_isa()
+	{
+#		if GLM_SIMD_WIDE_KERNELS
+			int const Isa = glm_simd_isa();
+			if(Isa & GLM_SIMD_ISA_AVX512F)
+				return GLM_SIMD_ISA_AVX512F;
+			if(Isa & GLM_SIMD_ISA_AVX2)
+				return GLM_SIMD_ISA_AVX2;
+			if(Isa & GLM_SIMD_ISA_SSE2)
+				return GLM_SIMD_ISA_SSE2;
+#		endif
+		return GLM_SIMD_ISA_NONE;
+	}
+
+	template<typename F>
+	F random_batch_select(F Scalar, F Sse2, F Avx2, F Avx512f)
+	{
+		switch(random_batch_isa())
+		{
+		case GLM_SIMD_ISA_AVX512F: return Avx512f;
+		case GLM_SIMD_ISA_AVX2: return Avx2;
+		case GLM_SIMD_ISA_SSE2: return Sse2;
+		default: return Scalar;
+		}
+	}
+}//namespace detail
+
+#if GLM_SIMD_WIDE_KERNELS
+#	define GLM_RANDOM_BATCH_FUNC(Name) detail::random_batch_select(detail::Name##_scalar, \
+		detail::random_sse2::Name##_rounds, detail::random_avx2::Name##_rounds, detail::random_avx512f::Name##_rounds)
+#else
+#	define GLM_RANDOM_BATCH_FUNC(Name) detail::random_batch_select(detail::Name##_scalar, \
+		detail::Name##_scalar, detail::Name##_scalar, detail::Name##_scalar)
+#endif
+
+	GLM_FUNC_QUALIFIER void seedRandomStreams(randomStreams& streams, uint64 seed)
+	{
+		for(int s = 0; s < detail::random_stream_count; ++s)
+		{
+			uint64 const a = detail::random_splitmix64(seed);
+			uint64 const b = detail::random_splitmix64(seed);
+			streams.state[0][s] = static_cast<uint32>(a);
+			streams.state[1][s] = static_cast<uint32>(a >> 32);
+			streams.state[2][s] = static_cast<uint32>(b);
+			streams.state[3][s] = static_cast<uint32>(b >> 32);
+		}
+	}
+
+	GLM_FUNC_QUALIFIER randomStreams& threadRandomStreams()
+	{
+		static thread_local randomStreams Streams;
+		static thread_local bool Seeded = false;
+		if(!Seeded)
+		{
+			seedRandomStreams(Streams, detail::random_thread_seed());
+			Seeded = true;
+		}
+		return Streams;
+	}
+
+	// The whole rounds of 16 go to the kernel, the samples past them are drawn
+	// one by one from streams 0, 1, 2...
+	GLM_FUNC_QUALIFIER void linearRandBatch(randomStreams& streams, float Min, float Max, float* out, std::size_t count)
+	{
+		static detail::random_linear_func const Rounds = GLM_RANDOM_BATCH_FUNC(random_linear);
+		std::size_t const Whole = count / detail::random_stream_count;
+		float const Scale = Max - Min;
+		Rounds(streams, Min, Scale, out, Whole);
+		for(std::size_t i = Whole * detail::random_stream_count; i < count; ++i)
+			out[i] = detail::random_linear_sample(streams, static_cast<int>(i % detail::random_stream_count), Min, Scale);
+	}
+
+	GLM_FUNC_QUALIFIER void gaussRandBatch(randomStreams& streams, float Mean, float Deviation, float* out, std::size_t count)
+	{
+		static detail::random_gauss_func const Rounds = GLM_RANDOM_BATCH_FUNC(random_gauss);
+		std::size_t const Whole = count / detail::random_stream_count;
+		Rounds(streams, Mean, Deviation, out, Whole);
+		for(std::size_t i = Whole * detail::random_stream_count; i < count; ++i)
+			out[i] = Mean + Deviation * detail::random_gauss_sample(streams, static_cast<int>(i % detail::random_stream_count));
+	}
+
+	GLM_FUNC_QUALIFIER void sphericalRandBatch(randomStreams& streams, float Radius, vec3* out, std::size_t count)
+	{
+		static detail::random_sphere_func const Rounds = GLM_RANDOM_BATCH_FUNC(random_sphere);
+		std::size_t const Whole = count / detail::random_stream_count;
+		Rounds(streams, Radius, out, Whole);
+		for(std::size_t i = Whole * detail::random_stream_count; i < count; ++i)
+			out[i] = detail::random_sphere_sample(streams, static_cast<int>(i % detail::random_stream_count), Radius);
+	}
+
+#undef GLM_RANDOM_BATCH_FUNC
+
+	GLM_FUNC_QUALIFIER char const* randomBatchIsa()
+	{
+		return glm_simd_isa_name(detail::random_batch_isa());
+	}
+}//namespace glm
+
+#if GLM_COMPILER & GLM_COMPILER_GCC
+#	pragma GCC pop_options
+#endif
@@ -0,0 +1,184 @@
+/// @ref gtx_random_batch
+///
+// Lane kernels of GLM_GTX_random_batch. random_batch.inl includes this file
+// once per instruction set after defining:
+//   GLM_RANDOM_LANES_NAMESPACE  namespace of this copy
+//   GLM_RANDOM_LANES_TYPE       float vector type with 4, 8 or 16 lanes
+//   GLM_RANDOM_LANES_SQRT       square root intrinsic of that width
+//   GLM_RANDOM_LANES_TARGET     GCC target string of this copy
+//   GLM_RANDOM_LANES_ATTRIB     target attribute of the round entry points
+// Lane l of a register holds stream First + l; the 16 streams are walked
+// N at a time, each group through every round, with its state in registers.
+
+#if GLM_COMPILER & GLM_COMPILER_GCC
+#	pragma GCC push_options
+#	define GLM_RANDOM_LANES_PRAGMA(x) _Pragma(#x)
+#	define GLM_RANDOM_LANES_TARGET_PRAGMA(t) GLM_RANDOM_LANES_PRAGMA(GCC target(t))
+	GLM_RANDOM_LANES_TARGET_PRAGMA(GLM_RANDOM_LANES_TARGET)
+#	undef GLM_RANDOM_LANES_TARGET_PRAGMA
+#	undef GLM_RANDOM_LANES_PRAGMA
+#	pragma GCC optimize("fp-contract=off")
+#endif
+
+namespace glm{
+namespace detail{
+namespace GLM_RANDOM_LANES_NAMESPACE
+{
+	typedef GLM_RANDOM_LANES_TYPE V;
+	typedef random_lanes<V>::int_type I;
+	typedef random_lanes<V>::uint_type U;
+
+	int const N = static_cast<int>(sizeof(V) / sizeof(float));
+
+	struct random_lanes_state
+	{
+		U s0, s1, s2, s3;
+	};
+
+	GLM_WIDE_INLINE void random_lanes_load(randomStreams const& Streams, int First, random_lanes_state& State)
+	{
+		std::memcpy(&State.s0, &Streams.state[0][First], sizeof(U));
+		std::memcpy(&State.s1, &Streams.state[1][First], sizeof(U));
+		std::memcpy(&State.s2, &Streams.state[2][First], sizeof(U));
+		std::memcpy(&State.s3, &Streams.state[3][First], sizeof(U));
+	}
+
+	GLM_WIDE_INLINE void random_lanes_store(randomStreams& Streams, int First, random_lanes_state const& State)
+	{
+		std::memcpy(&Streams.state[0][First], &State.s0, sizeof(U));
+		std::memcpy(&Streams.state[1][First], &State.s1, sizeof(U));
+		std::memcpy(&Streams.state[2][First], &State.s2, sizeof(U));
+		std::memcpy(&Streams.state[3][First], &State.s3, sizeof(U));
+	}
+
+	GLM_WIDE_INLINE U random_lanes_rotl(U const& x, int k)
+	{
+		return (x << k) | (x >> (32 - k));
+	}
+
+	// xoshiro128**, the multiplies by 5 and 9 as shifts and adds
+	GLM_WIDE_INLINE U random_lanes_next(random_lanes_state& State)
+	{
+		U const Five = State.s1 + (State.s1 << 2);
+		U const Rotated = random_lanes_rotl(Five, 7);
+		U const Result = Rotated + (Rotated << 3);
+		U const t = State.s1 << 9;
+		State.s2 ^= State.s0;
+		State.s3 ^= State.s1;
+		State.s1 ^= State.s2;
+		State.s0 ^= State.s3;
+		State.s2 ^= t;
+		State.s3 = random_lanes_rotl(State.s3, 11);
+		return Result;
+	}
+
+	GLM_WIDE_INLINE V random_lanes_unit(U const& u)
+	{
+		return __builtin_convertvector(reinterpret_cast<I>(u >> 8), V) * (1.0f / 16777216.0f);
+	}
+
+	// One ziggurat draw on each stream of the group. The lanes outside their
+	// layer's rectangle are finished by the scalar code on their own words of
+	// the state, taken out of the registers and put back.
+	GLM_WIDE_INLINE V random_lanes_gauss(random_lanes_state& State, random_ziggurat const& Z)
+	{
+		U const u = random_lanes_next(State);
+		I const Layer = reinterpret_cast<I>(u & 255u);
+		I const j = reinterpret_cast<I>(u) >> 8;
+		int32 LayerOf[N], KOf[N];
+		float WOf[N];
+		std::memcpy(LayerOf, &Layer, sizeof(I));
+		for(int l = 0; l < N; ++l)
+		{
+			KOf[l] = Z.k[LayerOf[l]];
+			WOf[l] = Z.w[LayerOf[l]];
+		}
+		I k;
+		V w;
+		std::memcpy(&k, KOf, sizeof(I));
+		std::memcpy(&w, WOf, sizeof(V));
+		V x = __builtin_convertvector(j, V) * w;
+
+		I const Sign = j >> 31;
+		I const Outside = ((j ^ Sign) - Sign) >= k;
+		uint64 Words[N / 2];
+		std::memcpy(Words, &Outside, sizeof(I));
+		uint64 Any = 0;
+		for(int i = 0; i < N / 2; ++i)
+			Any |= Words[i];
+		if(Any)
+		{
+			for(int l = 0; l < N; ++l)
+				if(Outside[l])
+				{
+					uint32 s0 = State.s0[l], s1 = State.s1[l], s2 = State.s2[l], s3 = State.s3[l];
+					x[l] = random_gauss_fix(s0, s1, s2, s3, j[l], LayerOf[l]);
+					State.s0[l] = s0;
+					State.s1[l] = s1;
+					State.s2[l] = s2;
+					State.s3[l] = s3;
+				}
+		}
+		return x;
+	}
+
+	GLM_RANDOM_LANES_ATTRIB inline void random_linear_rounds(randomStreams& Streams, float Min, float Scale, float* Out, std::size_t Rounds)
+	{
+		for(int First = 0; First < random_stream_count; First += N)
+		{
+			random_lanes_state State;
+			random_lanes_load(Streams, First, State);
+			for(std::size_t r = 0; r < Rounds; ++r)
+			{
+				V const x = Min + random_lanes_unit(random_lanes_next(State)) * Scale;
+				std::memcpy(Out + r * random_stream_count + First, &x, sizeof(V));
+			}
+			random_lanes_store(Streams, First, State);
+		}
+	}
+
+	GLM_RANDOM_LANES_ATTRIB inline void random_gauss_rounds(randomStreams& Streams, float Mean, float Deviation, float* Out, std::size_t Rounds)
+	{
+		random_ziggurat const& Z = random_ziggurat_tables();
+		for(int First = 0; First < random_stream_count; First += N)
+		{
+			random_lanes_state State;
+			random_lanes_load(Streams, First, State);
+			for(std::size_t r = 0; r < Rounds; ++r)
+			{
+				V const x = Mean + Deviation * random_lanes_gauss(State, Z);
+				std::memcpy(Out + r * random_stream_count + First, &x, sizeof(V));
+			}
+			random_lanes_store(Streams, First, State);
+		}
+	}
+
+	GLM_RANDOM_LANES_ATTRIB inline void random_sphere_rounds(randomStreams& Streams, float Radius, vec3* Out, std::size_t Rounds)
+	{
+		random_ziggurat const& Z = random_ziggurat_tables();
+		for(int First = 0; First < random_stream_count; First += N)
+		{
+			random_lanes_state State;
+			random_lanes_load(Streams, First, State);
+			for(std::size_t r = 0; r < Rounds; ++r)
+			{
+				V const x = random_lanes_gauss(State, Z);
+				V const y = random_lanes_gauss(State, Z);
+				V const z = random_lanes_gauss(State, Z);
+				V const Length2 = x * x + y * y + z * z;
+				V const Scale = Radius / GLM_RANDOM_LANES_SQRT(Length2);
+				V const px = x * Scale, py = y * Scale, pz = z * Scale;
+				vec3* Row = Out + r * random_stream_count + First;
+				for(int l = 0; l < N; ++l)
+					Row[l] = vec3(px[l], py[l], pz[l]);
+			}
+			random_lanes_store(Streams, First, State);
+		}
+	}
+}//namespace GLM_RANDOM_LANES_NAMESPACE
+}//namespace detail
+}//namespace glm
+
+#if GLM_COMPILER & GLM_COMPILER_GCC
+#	pragma GCC pop_options
+#endif
@@ -0,0 +1,144 @@
+/// @ref simd
+/// @file glm/simd/cpuid.h
+///
+/// Runtime detection of the x86 SIMD instruction sets usable by this process.
+/// GLM_ARCH only describes what the translation unit was compiled for; this
+/// asks the CPU (and the OS, through XCR0) what the machine actually runs.
+
+#pragma once
+
+#include "platform.h"
+
+#define GLM_SIMD_ISA_NONE		(0x00000000)
+#define GLM_SIMD_ISA_SSE2		(0x00000001)
+#define GLM_SIMD_ISA_AVX		(0x00000002)
+#define GLM_SIMD_ISA_AVX2		(0x00000004)	// AVX2 and FMA3
+#define GLM_SIMD_ISA_AVX512F	(0x00000008)
+
+// Kernels for ISAs above the compile-time GLM_ARCH rely on per-function target
+// attributes and on the GCC/Clang vector extensions (arithmetic operators on
+// __m128/__m256/__m512 and vector_size types), so they are GCC/Clang only.
+#if (GLM_ARCH & GLM_ARCH_X86_BIT) && (GLM_COMPILER & (GLM_COMPILER_GCC | GLM_COMPILER_CLANG))
+#	define GLM_SIMD_WIDE_KERNELS 1
+#	define GLM_TARGET_SSE2 __attribute__((target("sse2")))
+#	define GLM_TARGET_AVX __attribute__((target("avx")))
+#	define GLM_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#	define GLM_TARGET_AVX512F __attribute__((target("avx512f,avx2,fma")))
+#	define GLM_WIDE_INLINE inline __attribute__((__always_inline__))
+#else
+#	define GLM_SIMD_WIDE_KERNELS 0
+#	define GLM_WIDE_INLINE inline
+#endif
+
+#if (GLM_ARCH & GLM_ARCH_X86_BIT) && (GLM_COMPILER & (GLM_COMPILER_GCC | GLM_COMPILER_CLANG))
+#	include <cpuid.h>
+#	define GLM_SIMD_HAS_CPUID 1
+#elif (GLM_ARCH & GLM_ARCH_X86_BIT) && (GLM_COMPILER & GLM_COMPILER_VC)
+#	include <intrin.h>
+#	define GLM_SIMD_HAS_CPUID 1
+#else
+#	define GLM_SIMD_HAS_CPUID 0
+#endif
+
+#if GLM_SIMD_HAS_CPUID
+
+inline void glm_cpuid(unsigned int leaf, unsigned int subleaf, unsigned int regs[4])
+{
+#	if GLM_COMPILER & GLM_COMPILER_VC
+		int r[4];
+		__cpuidex(r, static_cast<int>(leaf), static_cast<int>(subleaf));
+		for(int i = 0; i < 4; ++i)
+			regs[i] = static_cast<unsigned int>(r[i]);
+#	else
+		__cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#	endif
+}
+
+inline unsigned long long glm_xgetbv0()
+{
+#	if GLM_COMPILER & GLM_COMPILER_VC
+		return _xgetbv(0);
+#	else
+		unsigned int eax, edx;
+		__asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+		return (static_cast<unsigned long long>(edx) << 32) | eax;
+#	endif
+}
+
+/// Queries CPUID once and returns the GLM_SIMD_ISA_* bits.
+inline int glm_simd_detect_isa()
+{
+	unsigned int regs[4];
+	glm_cpuid(0, 0, regs);
+	unsigned int const MaxLeaf = regs[0];
+
+	int Isa = GLM_SIMD_ISA_NONE;
+	glm_cpuid(1, 0, regs);
+	unsigned int const Ecx1 = regs[2];
+	unsigned int const Edx1 = regs[3];
+	if(Edx1 & (1u << 26))
+		Isa |= GLM_SIMD_ISA_SSE2;
+
+	// the OS must save the wide registers on context switches, check XCR0 too
+	bool const OSXSave = (Ecx1 & (1u << 27)) != 0;
+	unsigned long long const XCR0 = OSXSave ? glm_xgetbv0() : 0;
+	bool const YmmState = (XCR0 & 0x06) == 0x06;
+	bool const ZmmState = (XCR0 & 0xE6) == 0xE6;
+
+	if(YmmState && (Ecx1 & (1u << 28)))
+		Isa |= GLM_SIMD_ISA_AVX;
+
+	if(MaxLeaf >= 7)
+	{
+		glm_cpuid(7, 0, regs);
+		unsigned int const Ebx7 = regs[1];
+		bool const Fma = (Ecx1 & (1u << 12)) != 0;
+		if((Isa & GLM_SIMD_ISA_AVX) && Fma && (Ebx7 & (1u << 5)))
+			Isa |= GLM_SIMD_ISA_AVX2;
+		if((Isa & GLM_SIMD_ISA_AVX2) && ZmmState && (Ebx7 & (1u << 16)))
+			Isa |= GLM_SIMD_ISA_AVX512F;
+	}
+	return Isa;
+}
+
+#else//GLM_SIMD_HAS_CPUID
+
+inline int glm_simd_detect_isa()
+{
+	return GLM_SIMD_ISA_NONE;
+}
+
+#endif//GLM_SIMD_HAS_CPUID
+
+/// Cached result of glm_simd_detect_isa().
+inline int glm_simd_isa()
+{
+	static int const Isa = glm_simd_detect_isa();
+	return Isa;
+}
+
+/// Returns the widest GLM_SIMD_ISA_* bit set in Isa.
+inline int glm_simd_best_isa(int Isa)
+{
+	if(Isa & GLM_SIMD_ISA_AVX512F)
+		return GLM_SIMD_ISA_AVX512F;
+	if(Isa & GLM_SIMD_ISA_AVX2)
+		return GLM_SIMD_ISA_AVX2;
+	if(Isa & GLM_SIMD_ISA_AVX)
+		return GLM_SIMD_ISA_AVX;
+	if(Isa & GLM_SIMD_ISA_SSE2)
+		return GLM_SIMD_ISA_SSE2;
+	return GLM_SIMD_ISA_NONE;
+}
+
+inline char const* glm_simd_isa_name(int Isa)
+{
+	switch(glm_simd_best_isa(Isa))
+	{
+	case GLM_SIMD_ISA_AVX512F: return "avx512f";
+	case GLM_SIMD_ISA_AVX2: return "avx2";
+	case GLM_SIMD_ISA_AVX: return "avx";
+	case GLM_SIMD_ISA_SSE2: return "sse2";
+	default: return "scalar";
+	}
+}
@@ -0,0 +1,491 @@
+/// @ref simd
+/// @file glm/simd/matrix_wide.h
+///
+/// Batched mat4 kernels for 128, 256 and 512-bit registers, selected at run
+/// time from CPUID so a binary built for baseline x86-64 still uses AVX2 or
+/// AVX-512 where the machine has them.
+///
+/// Matrices are 16 contiguous floats in GLM's column-major order, vectors are
+/// 4 contiguous floats. No alignment is required.
+///
+/// - mul:       out[i] = a[i] * b[i]; a 256-bit register holds two columns and
+///              a 512-bit register a whole matrix.
+/// - transform: out[i] = m * v[i]; two (AVX) or four (AVX-512) vectors per
+///              instruction.
+/// - inverse:   matrices are transposed into structure-of-arrays form so each
+///              lane of a register belongs to a different matrix: 4, 8 or 16
+///              inverses per instruction.
+
+#pragma once
+
+#include "cpuid.h"
+
+#include <cstddef>
+#include <cstring>
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+#	include "matrix.h"
+#endif
+
+#if GLM_SIMD_WIDE_KERNELS
+#	include <immintrin.h>
+#endif
+
+typedef void (*glm_mat4_mul_batch_func)(float const* a, std::size_t strideA, float const* b, float* out, std::size_t count);
+typedef void (*glm_mat4_inverse_batch_func)(float const* in, float* out, std::size_t count);
+typedef void (*glm_mat4_transform_batch_func)(float const* m, float const* in, float* out, std::size_t count);
+
+struct glm_mat4_batch_kernels
+{
+	int isa;
+	glm_mat4_mul_batch_func mul;
+	glm_mat4_inverse_batch_func inverse;
+	glm_mat4_transform_batch_func transform;
+};
+
+///////////////////////////////////////////////////////////////////////////////////
+// Baseline: the existing SSE2 kernels when compiled with intrinsics, scalar otherwise
+
+inline void glm_mat4_mul_batch_base(float const* a, std::size_t strideA, float const* b, float* out, std::size_t count)
+{
+	for(std::size_t i = 0; i < count; ++i, a += strideA, b += 16, out += 16)
+	{
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+		glm_vec4 A[4], B[4], R[4];
+		for(int c = 0; c < 4; ++c)
+		{
+			A[c] = _mm_loadu_ps(a + c * 4);
+			B[c] = _mm_loadu_ps(b + c * 4);
+		}
+		glm_mat4_mul(A, B, R);
+		for(int c = 0; c < 4; ++c)
+			_mm_storeu_ps(out + c * 4, R[c]);
+#	else
+		float R[16];
+		for(int c = 0; c < 4; ++c)
+		for(int r = 0; r < 4; ++r)
+			R[c * 4 + r] = a[r] * b[c * 4] + a[4 + r] * b[c * 4 + 1] + a[8 + r] * b[c * 4 + 2] + a[12 + r] * b[c * 4 + 3];
+		std::memcpy(out, R, sizeof(R));
+#	endif
+	}
+}
+
+inline void glm_mat4_transform_batch_base(float const* m, float const* in, float* out, std::size_t count)
+{
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+		glm_vec4 M[4] = {_mm_loadu_ps(m), _mm_loadu_ps(m + 4), _mm_loadu_ps(m + 8), _mm_loadu_ps(m + 12)};
+		for(std::size_t i = 0; i < count; ++i)
+			_mm_storeu_ps(out + i * 4, glm_mat4_mul_vec4(M, _mm_loadu_ps(in + i * 4)));
+#	else
+		for(std::size_t i = 0; i < count; ++i, in += 4, out += 4)
+		{
+			float const x = in[0], y = in[1], z = in[2], w = in[3];
+			for(int r = 0; r < 4; ++r)
+				out[r] = m[r] * x + m[4 + r] * y + m[8 + r] * z + m[12 + r] * w;
+		}
+#	endif
+}
+
+// Laplace expansion with 2x2 sub-determinants. V is either float or a vector
+// type where every lane belongs to a different matrix; m is indexed [col * 4 + row].
+template<typename V>
+GLM_WIDE_INLINE void glm_mat4_inverse_lanes(V const m[16], V out[16])
+{
+	V const s0 = m[0] * m[5] - m[4] * m[1];
+	V const s1 = m[0] * m[6] - m[4] * m[2];
+	V const s2 = m[0] * m[7] - m[4] * m[3];
+	V const s3 = m[1] * m[6] - m[5] * m[2];
+	V const s4 = m[1] * m[7] - m[5] * m[3];
+	V const s5 = m[2] * m[7] - m[6] * m[3];
+
+	V const c5 = m[10] * m[15] - m[14] * m[11];
+	V const c4 = m[9] * m[15] - m[13] * m[11];
+	V const c3 = m[9] * m[14] - m[13] * m[10];
+	V const c2 = m[8] * m[15] - m[12] * m[11];
+	V const c1 = m[8] * m[14] - m[12] * m[10];
+	V const c0 = m[8] * m[13] - m[12] * m[9];
+
+	V const Det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+	V const InvDet = 1.0f / Det;
+
+	out[0]  = ( m[5] * c5 - m[6] * c4 + m[7] * c3) * InvDet;
+	out[1]  = (-m[1] * c5 + m[2] * c4 - m[3] * c3) * InvDet;
+	out[2]  = ( m[13] * s5 - m[14] * s4 + m[15] * s3) * InvDet;
+	out[3]  = (-m[9] * s5 + m[10] * s4 - m[11] * s3) * InvDet;
+	out[4]  = (-m[4] * c5 + m[6] * c2 - m[7] * c1) * InvDet;
+	out[5]  = ( m[0] * c5 - m[2] * c2 + m[3] * c1) * InvDet;
+	out[6]  = (-m[12] * s5 + m[14] * s2 - m[15] * s1) * InvDet;
+	out[7]  = ( m[8] * s5 - m[10] * s2 + m[11] * s1) * InvDet;
+	out[8]  = ( m[4] * c4 - m[5] * c2 + m[7] * c0) * InvDet;
+	out[9]  = (-m[0] * c4 + m[1] * c2 - m[3] * c0) * InvDet;
+	out[10] = ( m[12] * s4 - m[13] * s2 + m[15] * s0) * InvDet;
+	out[11] = (-m[8] * s4 + m[9] * s2 - m[11] * s0) * InvDet;
+	out[12] = (-m[4] * c3 + m[5] * c1 - m[6] * c0) * InvDet;
+	out[13] = ( m[0] * c3 - m[1] * c1 + m[2] * c0) * InvDet;
+	out[14] = (-m[12] * s3 + m[13] * s1 - m[14] * s0) * InvDet;
+	out[15] = ( m[8] * s3 - m[9] * s1 + m[10] * s0) * InvDet;
+}
+
+inline void glm_mat4_inverse_batch_base(float const* in, float* out, std::size_t count)
+{
+	for(std::size_t i = 0; i < count; ++i, in += 16, out += 16)
+	{
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+		glm_vec4 M[4], R[4];
+		for(int c = 0; c < 4; ++c)
+			M[c] = _mm_loadu_ps(in + c * 4);
+		glm_mat4_inverse(M, R);
+		for(int c = 0; c < 4; ++c)
+			_mm_storeu_ps(out + c * 4, R[c]);
+#	else
+		float R[16];
+		glm_mat4_inverse_lanes<float>(in, R);
+		std::memcpy(out, R, sizeof(R));
+#	endif
+	}
+}
+
+#if GLM_SIMD_WIDE_KERNELS
+
+// Runs Group, which inverts exactly N matrices, over the whole batch. A partial
+// last group is padded with identity matrices in a local buffer.
+#define GLM_MAT4_INVERSE_GROUPS(N, Group, in, out, count) \
+	{ \
+		std::size_t i = 0; \
+		for(; i + (N) <= (count); i += (N)) \
+			Group((in) + i * 16, (out) + i * 16); \
+		if(i < (count)) \
+		{ \
+			static float const Identity[16] = {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1}; \
+			std::size_t const n = (count) - i; \
+			alignas(64) float Tmp[(N) * 16]; \
+			for(std::size_t l = 0; l < (N); ++l) \
+				std::memcpy(Tmp + l * 16, l < n ? (in) + (i + l) * 16 : Identity, 16 * sizeof(float)); \
+			Group(Tmp, Tmp); \
+			std::memcpy((out) + i * 16, Tmp, n * 16 * sizeof(float)); \
+		} \
+	}
+
+///////////////////////////////////////////////////////////////////////////////////
+// SSE2, structure-of-arrays inverse: 4 matrices per instruction
+
+GLM_TARGET_SSE2 GLM_WIDE_INLINE void glm_mat4_inverse4_sse2(float const* in, float* out)
+{
+	__m128 M[16], R[16];
+	for(int c = 0; c < 4; ++c)
+	{
+		__m128 r0 = _mm_loadu_ps(in + 0 + c * 4);
+		__m128 r1 = _mm_loadu_ps(in + 16 + c * 4);
+		__m128 r2 = _mm_loadu_ps(in + 32 + c * 4);
+		__m128 r3 = _mm_loadu_ps(in + 48 + c * 4);
+		_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+		M[c * 4 + 0] = r0;
+		M[c * 4 + 1] = r1;
+		M[c * 4 + 2] = r2;
+		M[c * 4 + 3] = r3;
+	}
+	glm_mat4_inverse_lanes<__m128>(M, R);
+	for(int c = 0; c < 4; ++c)
+	{
+		__m128 r0 = R[c * 4 + 0], r1 = R[c * 4 + 1], r2 = R[c * 4 + 2], r3 = R[c * 4 + 3];
+		_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+		_mm_storeu_ps(out + 0 + c * 4, r0);
+		_mm_storeu_ps(out + 16 + c * 4, r1);
+		_mm_storeu_ps(out + 32 + c * 4, r2);
+		_mm_storeu_ps(out + 48 + c * 4, r3);
+	}
+}
+
+GLM_TARGET_SSE2 inline void glm_mat4_inverse_batch_sse2(float const* in, float* out, std::size_t count)
+{
+	GLM_MAT4_INVERSE_GROUPS(4, glm_mat4_inverse4_sse2, in, out, count)
+}
+
+///////////////////////////////////////////////////////////////////////////////////
+// 8x8 transpose shared by the 256 and 512-bit inverses
+
+GLM_TARGET_AVX GLM_WIDE_INLINE void glm_transpose8_avx(__m256 r[8])
+{
+	__m256 const t0 = _mm256_unpacklo_ps(r[0], r[1]);
+	__m256 const t1 = _mm256_unpackhi_ps(r[0], r[1]);
+	__m256 const t2 = _mm256_unpacklo_ps(r[2], r[3]);
+	__m256 const t3 = _mm256_unpackhi_ps(r[2], r[3]);
+	__m256 const t4 = _mm256_unpacklo_ps(r[4], r[5]);
+	__m256 const t5 = _mm256_unpackhi_ps(r[4], r[5]);
+	__m256 const t6 = _mm256_unpacklo_ps(r[6], r[7]);
+	__m256 const t7 = _mm256_unpackhi_ps(r[6], r[7]);
+	__m256 const u0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+	__m256 const u1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+	__m256 const u2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+	__m256 const u3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+	__m256 const u4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+	__m256 const u5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+	__m256 const u6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+	__m256 const u7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+	r[0] = _mm256_permute2f128_ps(u0, u4, 0x20);
+	r[1] = _mm256_permute2f128_ps(u1, u5, 0x20);
+	r[2] = _mm256_permute2f128_ps(u2, u6, 0x20);
+	r[3] = _mm256_permute2f128_ps(u3, u7, 0x20);
+	r[4] = _mm256_permute2f128_ps(u0, u4, 0x31);
+	r[5] = _mm256_permute2f128_ps(u1, u5, 0x31);
+	r[6] = _mm256_permute2f128_ps(u2, u6, 0x31);
+	r[7] = _mm256_permute2f128_ps(u3, u7, 0x31);
+}
+
+// loads 8 matrices as 16 registers, register e holding element e of every matrix
+GLM_TARGET_AVX GLM_WIDE_INLINE void glm_mat4_load8_avx(float const* in, __m256 M[16])
+{
+	for(int l = 0; l < 8; ++l)
+	{
+		M[l] = _mm256_loadu_ps(in + l * 16);
+		M[8 + l] = _mm256_loadu_ps(in + l * 16 + 8);
+	}
+	glm_transpose8_avx(M);
+	glm_transpose8_avx(M + 8);
+}
+
+GLM_TARGET_AVX GLM_WIDE_INLINE void glm_mat4_store8_avx(__m256 M[16], float* out)
+{
+	glm_transpose8_avx(M);
+	glm_transpose8_avx(M + 8);
+	for(int l = 0; l < 8; ++l)
+	{
+		_mm256_storeu_ps(out + l * 16, M[l]);
+		_mm256_storeu_ps(out + l * 16 + 8, M[8 + l]);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////
+// AVX: two columns per register
+
+GLM_TARGET_AVX inline void glm_mat4_mul_batch_avx(float const* a, std::size_t strideA, float const* b, float* out, std::size_t count)
+{
+	for(std::size_t i = 0; i < count; ++i, a += strideA, b += 16, out += 16)
+	{
+		__m256 const a0 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(a + 0));
+		__m256 const a1 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(a + 4));
+		__m256 const a2 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(a + 8));
+		__m256 const a3 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(a + 12));
+		for(int c = 0; c < 16; c += 8)
+		{
+			// low lane holds column c/4 of b, high lane the next one
+			__m256 const bc = _mm256_loadu_ps(b + c);
+			__m256 r = _mm256_mul_ps(a0, _mm256_shuffle_ps(bc, bc, 0x00));
+			r = _mm256_add_ps(r, _mm256_mul_ps(a1, _mm256_shuffle_ps(bc, bc, 0x55)));
+			r = _mm256_add_ps(r, _mm256_mul_ps(a2, _mm256_shuffle_ps(bc, bc, 0xAA)));
+			r = _mm256_add_ps(r, _mm256_mul_ps(a3, _mm256_shuffle_ps(bc, bc, 0xFF)));
+			_mm256_storeu_ps(out + c, r);
+		}
+	}
+}
+
+GLM_TARGET_AVX inline void glm_mat4_transform_batch_avx(float const* m, float const* in, float* out, std::size_t count)
+{
+	__m256 const m0 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(m + 0));
+	__m256 const m1 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(m + 4));
+	__m256 const m2 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(m + 8));
+	__m256 const m3 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(m + 12));
+	std::size_t i = 0;
+	for(; i + 2 <= count; i += 2)
+	{
+		__m256 const v = _mm256_loadu_ps(in + i * 4);
+		__m256 r = _mm256_mul_ps(m0, _mm256_shuffle_ps(v, v, 0x00));
+		r = _mm256_add_ps(r, _mm256_mul_ps(m1, _mm256_shuffle_ps(v, v, 0x55)));
+		r = _mm256_add_ps(r, _mm256_mul_ps(m2, _mm256_shuffle_ps(v, v, 0xAA)));
+		r = _mm256_add_ps(r, _mm256_mul_ps(m3, _mm256_shuffle_ps(v, v, 0xFF)));
+		_mm256_storeu_ps(out + i * 4, r);
+	}
+	if(i < count)
+		glm_mat4_transform_batch_base(m, in + i * 4, out + i * 4, count - i);
+}
+
+GLM_TARGET_AVX GLM_WIDE_INLINE void glm_mat4_inverse8_avx(float const* in, float* out)
+{
+	__m256 M[16], R[16];
+	glm_mat4_load8_avx(in, M);
+	glm_mat4_inverse_lanes<__m256>(M, R);
+	glm_mat4_store8_avx(R, out);
+}
+
+GLM_TARGET_AVX inline void glm_mat4_inverse_batch_avx(float const* in, float* out, std::size_t count)
+{
+	GLM_MAT4_INVERSE_GROUPS(8, glm_mat4_inverse8_avx, in, out, count)
+}
+
+///////////////////////////////////////////////////////////////////////////////////
+// AVX2 + FMA
+
+GLM_TARGET_AVX2 inline void glm_mat4_mul_batch_avx2(float const* a, std::size_t strideA, float const* b, float* out, std::size_t count)
+{
+	for(std::size_t i = 0; i < count; ++i, a += strideA, b += 16, out += 16)
+	{
+		__m256 const a0 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(a + 0));
+		__m256 const a1 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(a + 4));
+		__m256 const a2 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(a + 8));
+		__m256 const a3 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(a + 12));
+		__m256 const b01 = _mm256_loadu_ps(b);
+		__m256 const b23 = _mm256_loadu_ps(b + 8);
+		__m256 r01 = _mm256_mul_ps(a0, _mm256_shuffle_ps(b01, b01, 0x00));
+		__m256 r23 = _mm256_mul_ps(a0, _mm256_shuffle_ps(b23, b23, 0x00));
+		r01 = _mm256_fmadd_ps(a1, _mm256_shuffle_ps(b01, b01, 0x55), r01);
+		r23 = _mm256_fmadd_ps(a1, _mm256_shuffle_ps(b23, b23, 0x55), r23);
+		r01 = _mm256_fmadd_ps(a2, _mm256_shuffle_ps(b01, b01, 0xAA), r01);
+		r23 = _mm256_fmadd_ps(a2, _mm256_shuffle_ps(b23, b23, 0xAA), r23);
+		r01 = _mm256_fmadd_ps(a3, _mm256_shuffle_ps(b01, b01, 0xFF), r01);
+		r23 = _mm256_fmadd_ps(a3, _mm256_shuffle_ps(b23, b23, 0xFF), r23);
+		_mm256_storeu_ps(out, r01);
+		_mm256_storeu_ps(out + 8, r23);
+	}
+}
+
+GLM_TARGET_AVX2 inline void glm_mat4_transform_batch_avx2(float const* m, float const* in, float* out, std::size_t count)
+{
+	__m256 const m0 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(m + 0));
+	__m256 const m1 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(m + 4));
+	__m256 const m2 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(m + 8));
+	__m256 const m3 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(m + 12));
+	std::size_t i = 0;
+	for(; i + 2 <= count; i += 2)
+	{
+		__m256 const v = _mm256_loadu_ps(in + i * 4);
+		__m256 r = _mm256_mul_ps(m0, _mm256_shuffle_ps(v, v, 0x00));
+		r = _mm256_fmadd_ps(m1, _mm256_shuffle_ps(v, v, 0x55), r);
+		r = _mm256_fmadd_ps(m2, _mm256_shuffle_ps(v, v, 0xAA), r);
+		r = _mm256_fmadd_ps(m3, _mm256_shuffle_ps(v, v, 0xFF), r);
+		_mm256_storeu_ps(out + i * 4, r);
+	}
+	if(i < count)
+		glm_mat4_transform_batch_base(m, in + i * 4, out + i * 4, count - i);
+}
+
+GLM_TARGET_AVX2 GLM_WIDE_INLINE void glm_mat4_inverse8_avx2(float const* in, float* out)
+{
+	__m256 M[16], R[16];
+	glm_mat4_load8_avx(in, M);
+	glm_mat4_inverse_lanes<__m256>(M, R);
+	glm_mat4_store8_avx(R, out);
+}
+
+GLM_TARGET_AVX2 inline void glm_mat4_inverse_batch_avx2(float const* in, float* out, std::size_t count)
+{
+	GLM_MAT4_INVERSE_GROUPS(8, glm_mat4_inverse8_avx2, in, out, count)
+}
+
+///////////////////////////////////////////////////////////////////////////////////
+// AVX-512F: a whole matrix or four vectors per register
+// (maskz broadcasts avoid GCC's -Wuninitialized false positive on the undefined source)
+
+GLM_TARGET_AVX512F inline void glm_mat4_mul_batch_avx512(float const* a, std::size_t strideA, float const* b, float* out, std::size_t count)
+{
+	for(std::size_t i = 0; i < count; ++i, a += strideA, b += 16, out += 16)
+	{
+		__m512 const a0 = _mm512_maskz_broadcast_f32x4(0xFFFF, _mm_loadu_ps(a + 0));
+		__m512 const a1 = _mm512_maskz_broadcast_f32x4(0xFFFF, _mm_loadu_ps(a + 4));
+		__m512 const a2 = _mm512_maskz_broadcast_f32x4(0xFFFF, _mm_loadu_ps(a + 8));
+		__m512 const a3 = _mm512_maskz_broadcast_f32x4(0xFFFF, _mm_loadu_ps(a + 12));
+		// 128-bit lane c of bc holds column c of b
+		__m512 const bc = _mm512_loadu_ps(b);
+		__m512 r = _mm512_mul_ps(a0, _mm512_shuffle_ps(bc, bc, 0x00));
+		r = _mm512_fmadd_ps(a1, _mm512_shuffle_ps(bc, bc, 0x55), r);
+		r = _mm512_fmadd_ps(a2, _mm512_shuffle_ps(bc, bc, 0xAA), r);
+		r = _mm512_fmadd_ps(a3, _mm512_shuffle_ps(bc, bc, 0xFF), r);
+		_mm512_storeu_ps(out, r);
+	}
+}
+
+GLM_TARGET_AVX512F inline void glm_mat4_transform_batch_avx512(float const* m, float const* in, float* out, std::size_t count)
+{
+	__m512 const m0 = _mm512_maskz_broadcast_f32x4(0xFFFF, _mm_loadu_ps(m + 0));
+	__m512 const m1 = _mm512_maskz_broadcast_f32x4(0xFFFF, _mm_loadu_ps(m + 4));
+	__m512 const m2 = _mm512_maskz_broadcast_f32x4(0xFFFF, _mm_loadu_ps(m + 8));
+	__m512 const m3 = _mm512_maskz_broadcast_f32x4(0xFFFF, _mm_loadu_ps(m + 12));
+	std::size_t i = 0;
+	for(; i + 4 <= count; i += 4)
+	{
+		__m512 const v = _mm512_loadu_ps(in + i * 4);
+		__m512 r = _mm512_mul_ps(m0, _mm512_shuffle_ps(v, v, 0x00));
+		r = _mm512_fmadd_ps(m1, _mm512_shuffle_ps(v, v, 0x55), r);
+		r = _mm512_fmadd_ps(m2, _mm512_shuffle_ps(v, v, 0xAA), r);
+		r = _mm512_fmadd_ps(m3, _mm512_shuffle_ps(v, v, 0xFF), r);
+		_mm512_storeu_ps(out + i * 4, r);
+	}
+	if(i < count)
+		glm_mat4_transform_batch_avx2(m, in + i * 4, out + i * 4, count - i);
+}
+
+GLM_TARGET_AVX512F GLM_WIDE_INLINE void glm_mat4_inverse16_avx512(float const* in, float* out)
+{
+	__m256 Lo[16], Hi[16];
+	glm_mat4_load8_avx(in, Lo);
+	glm_mat4_load8_avx(in + 8 * 16, Hi);
+	__m512 M[16], R[16];
+	for(int e = 0; e < 16; ++e)
+		M[e] = _mm512_castpd_ps(_mm512_maskz_insertf64x4(0xFF, _mm512_castpd256_pd512(_mm256_castps_pd(Lo[e])), _mm256_castps_pd(Hi[e]), 1));
+	glm_mat4_inverse_lanes<__m512>(M, R);
+	for(int e = 0; e < 16; ++e)
+	{
+		Lo[e] = _mm256_castpd_ps(_mm512_maskz_extractf64x4_pd(0xF, _mm512_castps_pd(R[e]), 0));
+		Hi[e] = _mm256_castpd_ps(_mm512_maskz_extractf64x4_pd(0xF, _mm512_castps_pd(R[e]), 1));
+	}
+	glm_mat4_store8_avx(Lo, out);
+	glm_mat4_store8_avx(Hi, out + 8 * 16);
+}
+
+GLM_TARGET_AVX512F inline void glm_mat4_inverse_batch_avx512(float const* in, float* out, std::size_t count)
+{
+	GLM_MAT4_INVERSE_GROUPS(16, glm_mat4_inverse16_avx512, in, out, count)
+}
+
+#endif//GLM_SIMD_WIDE_KERNELS
+
+///////////////////////////////////////////////////////////////////////////////////
+// Dispatch
+
+/// Kernels for the widest ISA allowed by Isa (GLM_SIMD_ISA_* bits). Useful to
+/// force a path, e.g. for benchmarks; glm_mat4_batch() picks from CPUID.
+inline glm_mat4_batch_kernels glm_mat4_batch_kernels_for(int Isa)
+{
+	glm_mat4_batch_kernels k = {GLM_SIMD_ISA_NONE, glm_mat4_mul_batch_base, glm_mat4_inverse_batch_base, glm_mat4_transform_batch_base};
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+		k.isa = GLM_SIMD_ISA_SSE2;
+#	endif
+#	if GLM_SIMD_WIDE_KERNELS
+		switch(glm_simd_best_isa(Isa))
+		{
+		case GLM_SIMD_ISA_AVX512F:
+			k.isa = GLM_SIMD_ISA_AVX512F;
+			k.mul = glm_mat4_mul_batch_avx512;
+			k.inverse = glm_mat4_inverse_batch_avx512;
+			k.transform = glm_mat4_transform_batch_avx512;
+			break;
+		case GLM_SIMD_ISA_AVX2:
+			k.isa = GLM_SIMD_ISA_AVX2;
+			k.mul = glm_mat4_mul_batch_avx2;
+			k.inverse = glm_mat4_inverse_batch_avx2;
+			k.transform = glm_mat4_transform_batch_avx2;
+			break;
+		case GLM_SIMD_ISA_AVX:
+			k.isa = GLM_SIMD_ISA_AVX;
+			k.mul = glm_mat4_mul_batch_avx;
+			k.inverse = glm_mat4_inverse_batch_avx;
+			k.transform = glm_mat4_transform_batch_avx;
+			break;
+		case GLM_SIMD_ISA_SSE2:
+			k.isa = GLM_SIMD_ISA_SSE2;
+			k.inverse = glm_mat4_inverse_batch_sse2;
+			break;
+		default:
+			break;
+		}
+#	else
+		(void)Isa;
+#	endif
+	return k;
+}
+
+/// Kernels selected once for the running CPU.
+inline glm_mat4_batch_kernels const& glm_mat4_batch()
+{
+	static glm_mat4_batch_kernels const Kernels = glm_mat4_batch_kernels_for(glm_simd_isa());
+	return Kernels;
+}
@@ -0,0 +1,397 @@
+#ifndef BROADPHASE_H
+#define BROADPHASE_H
+
+#include <glm/glm.hpp>
+
+#include <learnopengl/job_system.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// Sweep and prune broadphase over 2D boxes: the pairs of boxes that overlap,
+// touching counting as overlapping, without testing every pair.
+//
+// Both axes keep their sorted array of box endpoints from one update to the
+// next. Boxes move a little between updates, so the arrays are nearly sorted
+// and an insertion sort puts them back in order with a few shifts a box.
+// When it needs too many, because boxes were teleported or added in bulk,
+// the sort gives up and the array is rebuilt with a radix sort over the job
+// system. The pairs are then found along the axis where the boxes overlap
+// least: the boxes are laid out in the order of their mins on it, each with
+// its bounds on both axes, and each scans the boxes after it up to its max,
+// in parallel.
+//
+//   SweepAndPrune broadphase;
+//   uint32_t quad = broadphase.add(min, max);
+//   ...
+//   broadphase.move(quad, min, max);          // every box that moved
+//   broadphase.update();
+//   for (glm::uvec2 pair : broadphase.pairs())
+//       ... pair.x and pair.y overlap
+
+// The bounds of a box rotated by angle (radians) around its center.
+inline void obbBounds(glm::vec2 center, glm::vec2 halfExtents, float angle, glm::vec2& min, glm::vec2& max)
+{
+    float c = std::fabs(std::cos(angle)), s = std::fabs(std::sin(angle));
+    glm::vec2 extent(c * halfExtents.x + s * halfExtents.y, s * halfExtents.x + c * halfExtents.y);
+    min = center - extent;
+    max = center + extent;
+}
+
+class SweepAndPrune
+{
+public:
+    // the insertion sort gives up past this many shifts an endpoint, about
+    // where the radix sort gets faster
+    static const size_t SHIFT_BUDGET = 16;
+    // below this many endpoints the sorts and the scan stay on the calling thread
+    static const size_t PARALLEL_ENDPOINTS = 16384;
+    static const size_t SCAN_CHUNKS = 64;
+
+    SweepAndPrune() : removed(0), lastShifts(0), lastRebuilds(0), lastAxis(0) {}
+
+    // memory for boxCount boxes and pairCount pairs, so that adding that many
+    // and updating do not allocate
+    void reserve(size_t boxCount, size_t pairCount)
+    {
+        boxes.reserve(boxCount);
+        alive.reserve(boxCount);
+        freeBoxes.reserve(boxCount);
+        endpoints[0].reserve(boxCount * 2);
+        endpoints[1].reserve(boxCount * 2);
+        minIndex.reserve(boxCount);
+        pendingBoxes.reserve(boxCount);
+        scratch.reserve(boxCount * 2);
+        sweep.reserve(boxCount);
+        histograms.reserve(256);
+        found.reserve(pairCount);
+    }
+
+    uint32_t add(glm::vec2 min, glm::vec2 max)
+    {
+        uint32_t box;
+        if (freeBoxes.empty())
+        {
+            box = (uint32_t)boxes.size();
+            boxes.push_back(Box{ min, max });
+            alive.push_back(1);
+        }
+        else
+        {
+            box = freeBoxes.back();
+            freeBoxes.pop_back();
+            boxes[box] = Box{ min, max };
+            alive[box] = 1;
+        }
+        // the endpoints join the arrays in the next update
+        pendingBoxes.push_back(box);
+        return box;
+    }
+
+    // the id may be given out again by add() after the next update
+    void remove(uint32_t box)
+    {
+        alive[box] = 0;
+        removed++;
+    }
+
+    void move(uint32_t box, glm::vec2 min, glm::vec2 max)
+    {
+        boxes[box].min = min;
+        boxes[box].max = max;
+    }
+
+    // Sorts the endpoints by the boxes' current bounds and finds the pairs.
+    void update();
+
+    // pairs of box ids, the smaller id first, as of the last update
+    const std::vector<glm::uvec2>& pairs() const { return found; }
+
+    size_t boxCount() const { return endpoints[0].size() / 2; }
+    // shifts the insertion sorts made in the last update, over both axes
+    size_t shiftCount() const { return lastShifts; }
+    // axes the last update rebuilt with the radix sort, 0 to 2
+    int rebuildCount() const { return lastRebuilds; }
+    // axis the last update scanned for pairs, 0 for x
+    int scanAxis() const { return lastAxis; }
+
+private:
+    struct Box
+    {
+        glm::vec2 min, max;
+    };
+
+    // ref is the box id times two, plus one for its max
+    struct Endpoint
+    {
+        float value;
+        uint32_t ref;
+    };
+
+    // a box as the scan sees it: its bounds on the scanned axis, then on the other
+    struct Sweep
+    {
+        float min, max, otherMin, otherMax;
+        uint32_t box;
+    };
+
+    // at equal values a min sorts before a max, so touching boxes overlap
+    static bool before(const Endpoint& a, const Endpoint& b)
+    {
+        return a.value < b.value || (a.value == b.value && (a.ref & 1) < (b.ref & 1));
+    }
+
+    // float order as unsigned order
+    static uint32_t radixKey(float value)
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits ^ ((uint32_t)((int32_t)bits >> 31) | 0x80000000u);
+    }
+
+    float value(int axis, uint32_t ref) const
+    {
+        const Box& box = boxes[ref >> 1];
+        return (ref & 1) ? box.max[axis] : box.min[axis];
+    }
+
+    // false when it ran out of shifts; the array is then unsorted but still
+    // holds every endpoint
+    bool insertionSort(std::vector<Endpoint>& array, size_t& shifts) const
+    {
+        size_t budget = array.size() * SHIFT_BUDGET;
+        for (size_t i = 1; i < array.size(); i++)
+        {
+            Endpoint e = array[i];
+            size_t j = i;
+            while (j > 0 && before(e, array[j - 1]))
+            {
+                array[j] = array[j - 1];
+                j--;
+            }
+            shifts += i - j;
+            array[j] = e;
+            if (shifts > budget)
+                return false;
+        }
+        return true;
+    }
+
+    void radixSort(std::vector<Endpoint>& array);
+    void sortAxis(int axis);
+    void scan(size_t chunk, size_t chunks, std::vector<glm::uvec2>& out) const;
+
+    std::vector<Box> boxes;
+    std::vector<uint8_t> alive;
+    std::vector<uint32_t> freeBoxes;
+    std::vector<uint32_t> pendingBoxes;
+    size_t removed;
+
+    std::vector<Endpoint> endpoints[2];
+    // index of each box's min in the array being costed, by box
+    std::vector<uint32_t> minIndex;
+    std::vector<Endpoint> scratch;
+    std::vector<uint32_t> histograms;
+    std::vector<Sweep> sweep;
+    std::vector<glm::uvec2> found;
+    std::vector<std::vector<glm::uvec2>> chunkPairs;
+
+    size_t lastShifts;
+    int lastRebuilds;
+    int lastAxis;
+};
+
+// LSD radix sort on the float keys, 8 bits a pass. Each pass histograms and
+// scatters the array in one chunk a thread, so it stays stable: mins, which
+// a rebuild lays out before maxes, stay first at equal values. Passes where
+// every key has the same digit are skipped.
+inline void SweepAndPrune::radixSort(std::vector<Endpoint>& array)
+{
+    size_t count = array.size();
+    if (count == 0)
+        return;
+    scratch.resize(count);
+    size_t chunks = count >= PARALLEL_ENDPOINTS ? jobSystem().threadCount() : 1;
+    histograms.resize(chunks * 256);
+    Endpoint* from = array.data();
+    Endpoint* to = scratch.data();
+    auto chunkBegin = [count, chunks](size_t c) { return count * c / chunks; };
+
+    for (int shift = 0; shift < 32; shift += 8)
+    {
+        std::fill(histograms.begin(), histograms.end(), 0u);
+        auto histogram = [&](size_t first, size_t last) {
+            for (size_t c = first; c < last; c++)
+            {
+                uint32_t* h = &histograms[c * 256];
+                for (size_t i = chunkBegin(c); i < chunkBegin(c + 1); i++)
+                    h[radixKey(from[i].value) >> shift & 255]++;
+            }
+        };
+        if (chunks > 1)
+            jobSystem().parallelFor(0, chunks, 1, histogram);
+        else
+            histogram(0, 1);
+
+        uint32_t digit = radixKey(from[0].value) >> shift & 255;
+        size_t same = 0;
+        for (size_t c = 0; c < chunks; c++)
+            same += histograms[c * 256 + digit];
+        if (same == count)
+            continue;
+
+        // offsets: digit by digit, chunk by chunk within a digit
+        uint32_t total = 0;
+        for (int d = 0; d < 256; d++)
+            for (size_t c = 0; c < chunks; c++)
+            {
+                uint32_t n = histograms[c * 256 + d];
+                histograms[c * 256 + d] = total;
+                total += n;
+            }
+
+        auto scatter = [&](size_t first, size_t last) {
+            for (size_t c = first; c < last; c++)
+            {
+                uint32_t* h = &histograms[c * 256];
+                for (size_t i = chunkBegin(c); i < chunkBegin(c + 1); i++)
+                    to[h[radixKey(from[i].value) >> shift & 255]++] = from[i];
+            }
+        };
+        if (chunks > 1)
+            jobSystem().parallelFor(0, chunks, 1, scatter);
+        else
+            scatter(0, 1);
+        std::swap(from, to);
+    }
+    if (from != array.data())
+        std::memcpy(array.data(), from, count * sizeof(Endpoint));
+}
+
+inline void SweepAndPrune::sortAxis(int axis)
+{
+    std::vector<Endpoint>& array = endpoints[axis];
+    for (Endpoint& e : array)
+        e.value = value(axis, e.ref);
+
+    // new boxes go at the end; a few are sorted in, more than a quarter of
+    // the boxes already there make a rebuild
+    bool rebuild = pendingBoxes.size() * 4 > array.size() / 2;
+    for (uint32_t box : pendingBoxes)
+        array.push_back(Endpoint{ boxes[box].min[axis], box << 1 });
+    for (uint32_t box : pendingBoxes)
+        array.push_back(Endpoint{ boxes[box].max[axis], box << 1 | 1 });
+
+    if (!rebuild && insertionSort(array, lastShifts))
+        return;
+
+    // mins first, so the stable sort keeps them first at equal values
+    size_t count = array.size() / 2, mins = 0, maxes = count;
+    scratch.resize(array.size());
+    for (const Endpoint& e : array)
+        scratch[(e.ref & 1) ? maxes++ : mins++] = e;
+    array.swap(scratch);
+    radixSort(array);
+    lastRebuilds++;
+}
+
+// The pairs of the boxes in this chunk of the sweep: each is paired with the
+// boxes after it whose min is not past its max, when they overlap on the
+// other axis too. Most of the boxes tested do not, so the test has no branch:
+// every box is written to a small buffer and kept only when it overlaps, and
+// the buffer goes to the pairs when full.
+inline void SweepAndPrune::scan(size_t chunk, size_t chunks, std::vector<glm::uvec2>& out) const
+{
+    const Sweep* order = sweep.data();
+    size_t count = sweep.size(), begin = count * chunk / chunks, end = count * (chunk + 1) / chunks;
+    out.clear();
+    uint32_t hits[64];
+    size_t n = 0;
+    auto flush = [&](uint32_t a) {
+        for (size_t k = 0; k < n; k++)
+            out.push_back(a < hits[k] ? glm::uvec2(a, hits[k]) : glm::uvec2(hits[k], a));
+        n = 0;
+    };
+    for (size_t i = begin; i < end; i++)
+    {
+        const Sweep a = order[i];
+        for (size_t j = i + 1; j < count && order[j].min <= a.max; j++)
+        {
+            hits[n] = order[j].box;
+            n += (order[j].otherMin <= a.otherMax) & (a.otherMin <= order[j].otherMax);
+            if (n == 64)
+                flush(a.box);
+        }
+        flush(a.box);
+    }
+}
+
+inline void SweepAndPrune::update()
+{
+    lastShifts = 0;
+    lastRebuilds = 0;
+
+    // removed boxes leave both arrays, which keep their order
+    if (removed)
+    {
+        for (int axis = 0; axis < 2; axis++)
+        {
+            std::vector<Endpoint>& array = endpoints[axis];
+            array.erase(std::remove_if(array.begin(), array.end(), [this](const Endpoint& e) { return !alive[e.ref >> 1]; }),
+                        array.end());
+        }
+        // a box added and removed before an update never had endpoints
+        pendingBoxes.erase(std::remove_if(pendingBoxes.begin(), pendingBoxes.end(), [this](uint32_t box) { return !alive[box]; }),
+                           pendingBoxes.end());
+        freeBoxes.clear();
+        for (uint32_t box = 0; box < boxes.size(); box++)
+            if (!alive[box])
+                freeBoxes.push_back(box);
+    }
+    sortAxis(0);
+    sortAxis(1);
+    pendingBoxes.clear();
+    removed = 0;
+
+    // what scanning each axis would cost: the endpoints between every box's two
+    size_t cost[2] = { 0, 0 };
+    minIndex.resize(boxes.size());
+    for (int axis = 0; axis < 2; axis++)
+    {
+        const std::vector<Endpoint>& array = endpoints[axis];
+        for (size_t i = 0; i < array.size(); i++)
+            if (array[i].ref & 1)
+                cost[axis] += i - minIndex[array[i].ref >> 1];
+            else
+                minIndex[array[i].ref >> 1] = (uint32_t)i;
+    }
+    lastAxis = cost[1] < cost[0] ? 1 : 0;
+
+    int other = 1 - lastAxis;
+    sweep.clear();
+    for (const Endpoint& e : endpoints[lastAxis])
+        if (!(e.ref & 1))
+        {
+            const Box& box = boxes[e.ref >> 1];
+            sweep.push_back(Sweep{ box.min[lastAxis], box.max[lastAxis], box.min[other], box.max[other], e.ref >> 1 });
+        }
+
+    found.clear();
+    if (endpoints[lastAxis].size() < PARALLEL_ENDPOINTS)
+    {
+        scan(0, 1, found);
+        return;
+    }
+    chunkPairs.resize(SCAN_CHUNKS);
+    jobSystem().parallelFor(0, SCAN_CHUNKS, 1, [this](size_t first, size_t last) {
+        for (size_t c = first; c < last; c++)
+            scan(c, SCAN_CHUNKS, chunkPairs[c]);
+    });
+    for (const std::vector<glm::uvec2>& chunk : chunkPairs)
+        found.insert(found.end(), chunk.begin(), chunk.end());
+}
+
+#endif
@@ -0,0 +1,463 @@
+#ifndef BVH_H
+#define BVH_H
+
+#include <glm/glm.hpp>
+#include <glm/gtx/intersect.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Mouse picking: a ray through the cursor, cast into a bounding volume
+// hierarchy over the triangles of the scene's objects. The hierarchy is
+// built with the surface area heuristic over 16 bins an axis and keeps up to
+// four triangles a leaf; the triangles are stored in world space, so a scene
+// that moves is gathered and built again before it is picked.
+//
+//   Bvh bvh;
+//   bvh.addMesh(PLAYER, vertices, 3, indices, 2, model);
+//   bvh.build();
+//   RayHit hit = bvh.intersect(cursorRay(camera.GetInverseViewProjectionMatrix(),
+//                                        cursor, viewport, camera.IsReverseZ()));
+//   if (hit.hit)
+//       ... hit.object, hit.triangle, hit.barycentric
+//
+// intersect() also takes an array of rays, which are walked through the
+// hierarchy sixteen at a time: each node's box is tested against every ray
+// of the packet still inside it, so a bundle of nearby rays loads each node
+// and triangle once.
+
+struct Ray
+{
+    glm::vec3 origin;
+    glm::vec3 direction;
+};
+
+// barycentric are the weights of the triangle's second and third vertices
+struct RayHit
+{
+    bool hit = false;
+    float distance = 0.0f;
+    int object = -1;
+    uint32_t triangle = 0;
+    glm::vec2 barycentric = glm::vec2(0.0f);
+};
+
+// The ray from the cursor (in pixels, y down as GLFW reports it) away from
+// the eye, through the near plane and a point behind it. reverseZ is the
+// camera's: the near plane is then at depth 1 instead of -1.
+inline Ray cursorRay(const glm::mat4& inverseViewProjection, glm::vec2 cursor, glm::vec2 viewport, bool reverseZ = false)
+{
+    glm::vec2 ndc(2.0f * cursor.x / viewport.x - 1.0f, 1.0f - 2.0f * cursor.y / viewport.y);
+    glm::vec4 nearPoint = inverseViewProjection * glm::vec4(ndc, reverseZ ? 1.0f : -1.0f, 1.0f);
+    glm::vec4 farPoint = inverseViewProjection * glm::vec4(ndc, reverseZ ? 0.5f : 0.0f, 1.0f);
+    glm::vec3 origin = glm::vec3(nearPoint) / nearPoint.w;
+    return Ray{ origin, glm::normalize(glm::vec3(farPoint) / farPoint.w - origin) };
+}
+
+class Bvh
+{
+public:
+    static const int LEAF_SIZE = 4;
+    static const int BINS = 16;
+    static const int PACKET = 16;
+    // deeper nodes stay leaves, which bounds the traversal stacks
+    static const int MAX_DEPTH = 60;
+
+    // clear() keeps the memory, so a scene gathered and built again every
+    // pick allocates only when it grows past what reserve() made room for
+    void clear()
+    {
+        triangles.clear();
+        nodes.clear();
+    }
+
+    void reserve(size_t triangleCount)
+    {
+        triangles.reserve(triangleCount);
+        // a tree of n leaves has 2n - 1 nodes, and a leaf has at least one triangle
+        nodes.reserve(triangleCount * 2);
+        boxes.reserve(triangleCount);
+        centers.reserve(triangleCount);
+        splits.reserve(MAX_DEPTH + 2);
+    }
+
+    // triangleCount triangles of object, three indices each into positions,
+    // whose vertices are stride floats apart; model takes them to world space
+    void addMesh(int object, const float* positions, size_t stride, const uint32_t* indices, size_t triangleCount,
+                 const glm::mat4& model = glm::mat4(1.0f))
+    {
+        for (size_t t = 0; t < triangleCount; t++)
+        {
+            Triangle triangle;
+            glm::vec3* corners[3] = { &triangle.v0, &triangle.v1, &triangle.v2 };
+            for (int c = 0; c < 3; c++)
+            {
+                const float* p = positions + (size_t)indices[t * 3 + c] * stride;
+                *corners[c] = glm::vec3(model * glm::vec4(p[0], p[1], p[2], 1.0f));
+            }
+            triangle.object = object;
+            triangle.index = (uint32_t)t;
+            triangles.push_back(triangle);
+        }
+    }
+
+    void build();
+
+    RayHit intersect(const Ray& ray) const;
+    void intersect(const Ray* rays, RayHit* hits, size_t count) const;
+
+    size_t triangleCount() const { return triangles.size(); }
+    size_t nodeCount() const { return nodes.size(); }
+
+private:
+    struct Triangle
+    {
+        glm::vec3 v0, v1, v2;
+        int object;
+        uint32_t index;
+    };
+
+    // 32 bytes; an inner node's children are nodes leftOrFirst and
+    // leftOrFirst + 1, a leaf's are count triangles from leftOrFirst
+    struct Node
+    {
+        glm::vec3 min;
+        uint32_t leftOrFirst;
+        glm::vec3 max;
+        uint32_t count;
+    };
+
+    struct Bounds
+    {
+        glm::vec3 min = glm::vec3(1e30f);
+        glm::vec3 max = glm::vec3(-1e30f);
+
+        void grow(glm::vec3 p)
+        {
+            min = glm::min(min, p);
+            max = glm::max(max, p);
+        }
+        void grow(const Bounds& b)
+        {
+            min = glm::min(min, b.min);
+            max = glm::max(max, b.max);
+        }
+        float area() const
+        {
+            glm::vec3 e = max - min;
+            return e.x < 0.0f ? 0.0f : e.x * e.y + e.y * e.z + e.z * e.x;
+        }
+    };
+
+    // a ray with the reciprocal of its direction, for the slab tests
+    struct Slab
+    {
+        glm::vec3 origin, inverse;
+    };
+
+    static Slab slab(const Ray& ray)
+    {
+        glm::vec3 inverse;
+        for (int a = 0; a < 3; a++)
+            inverse[a] = ray.direction[a] != 0.0f ? 1.0f / ray.direction[a] : 1e30f;
+        return Slab{ ray.origin, inverse };
+    }
+
+    // distance to where the ray enters the box, 1e30 if it misses it or
+    // enters it beyond limit
+    static float enter(const Node& node, const Slab& s, float limit)
+    {
+        glm::vec3 t0 = (node.min - s.origin) * s.inverse;
+        glm::vec3 t1 = (node.max - s.origin) * s.inverse;
+        glm::vec3 near = glm::min(t0, t1), far = glm::max(t0, t1);
+        float tNear = std::max(std::max(near.x, near.y), std::max(near.z, 0.0f));
+        float tFar = std::min(std::min(far.x, far.y), std::min(far.z, limit));
+        return tNear <= tFar ? tNear : 1e30f;
+    }
+
+    static glm::vec3 centroid(const Triangle& t) { return (t.v0 + t.v1 + t.v2) * (1.0f / 3.0f); }
+
+    // keeps the hit when the triangle is nearer than the one found so far;
+    // glm's test is two-sided and takes the ray as a line, so the distance
+    // has to be checked to be ahead of the origin
+    static void test(const Triangle& t, const Ray& ray, RayHit& hit)
+    {
+        glm::vec2 barycentric;
+        float distance;
+        if (glm::intersectRayTriangle(ray.origin, ray.direction, t.v0, t.v1, t.v2, barycentric, distance) && distance >= 0.0f &&
+            (!hit.hit || distance < hit.distance))
+        {
+            hit.hit = true;
+            hit.distance = distance;
+            hit.object = t.object;
+            hit.triangle = t.index;
+            hit.barycentric = barycentric;
+        }
+    }
+
+    void fit(Node& node) const
+    {
+        Bounds b;
+        for (uint32_t i = 0; i < node.count; i++)
+        {
+            const Triangle& t = triangles[node.leftOrFirst + i];
+            b.grow(t.v0);
+            b.grow(t.v1);
+            b.grow(t.v2);
+        }
+        node.min = b.min;
+        node.max = b.max;
+    }
+
+    std::vector<Triangle> triangles;
+    std::vector<Node> nodes;
+    // build() scratch: each triangle's bounds and centroid, reordered along
+    // with it, and the nodes left to split with their depth
+    std::vector<Bounds> boxes;
+    std::vector<glm::vec3> centers;
+    std::vector<glm::uvec2> splits;
+};
+
+inline void Bvh::build()
+{
+    nodes.clear();
+    if (triangles.empty())
+        return;
+    reserve(triangles.size());
+    nodes.push_back(Node{ glm::vec3(0.0f), 0, glm::vec3(0.0f), (uint32_t)triangles.size() });
+    fit(nodes[0]);
+
+    boxes.assign(triangles.size(), Bounds());
+    centers.resize(triangles.size());
+    for (size_t i = 0; i < triangles.size(); i++)
+    {
+        boxes[i].grow(triangles[i].v0);
+        boxes[i].grow(triangles[i].v1);
+        boxes[i].grow(triangles[i].v2);
+        centers[i] = centroid(triangles[i]);
+    }
+
+    splits.assign(1, glm::uvec2(0, 0));
+    while (!splits.empty())
+    {
+        uint32_t index = splits.back().x, depth = splits.back().y;
+        splits.pop_back();
+        Node node = nodes[index];
+        if (node.count <= LEAF_SIZE || depth >= MAX_DEPTH)
+            continue;
+        uint32_t first = node.leftOrFirst, end = first + node.count;
+
+        // the bins are laid over the bounds of the centroids, on all three
+        // axes in one pass
+        Bounds centroids;
+        for (uint32_t i = first; i < end; i++)
+            centroids.grow(centers[i]);
+        glm::vec3 scale;
+        for (int axis = 0; axis < 3; axis++)
+        {
+            float extent = centroids.max[axis] - centroids.min[axis];
+            scale[axis] = extent > 0.0f ? BINS / extent : 0.0f;
+        }
+        Bounds bins[3][BINS];
+        uint32_t counts[3][BINS] = {};
+        for (uint32_t i = first; i < end; i++)
+        {
+            glm::vec3 position = (centers[i] - centroids.min) * scale;
+            for (int axis = 0; axis < 3; axis++)
+            {
+                int bin = std::min(BINS - 1, (int)position[axis]);
+                counts[axis][bin]++;
+                bins[axis][bin].grow(boxes[i]);
+            }
+        }
+
+        // the cost of splitting after each bin, swept from both ends
+        float bestCost = 1e30f;
+        int bestAxis = -1, bestSplit = 0;
+        Bounds bestLeft, bestRight;
+        for (int axis = 0; axis < 3; axis++)
+        {
+            if (scale[axis] == 0.0f)
+                continue;
+            Bounds lefts[BINS - 1];
+            uint32_t leftCount[BINS - 1];
+            Bounds left;
+            uint32_t sum = 0;
+            for (int b = 0; b < BINS - 1; b++)
+            {
+                left.grow(bins[axis][b]);
+                sum += counts[axis][b];
+                lefts[b] = left;
+                leftCount[b] = sum;
+            }
+            Bounds right;
+            sum = 0;
+            for (int b = BINS - 1; b > 0; b--)
+            {
+                right.grow(bins[axis][b]);
+                sum += counts[axis][b];
+                float cost = leftCount[b - 1] * lefts[b - 1].area() + sum * right.area();
+                if (leftCount[b - 1] && sum && cost < bestCost)
+                {
+                    bestCost = cost;
+                    bestAxis = axis;
+                    bestSplit = b;
+                    bestLeft = lefts[b - 1];
+                    bestRight = right;
+                }
+            }
+        }
+
+        // a leaf when no split is cheaper than testing every triangle
+        Bounds bounds;
+        bounds.min = node.min;
+        bounds.max = node.max;
+        if (bestAxis < 0 || bestCost >= node.count * bounds.area())
+            continue;
+
+        uint32_t i = first, j = end;
+        while (i < j)
+        {
+            if (std::min(BINS - 1, (int)((centers[i][bestAxis] - centroids.min[bestAxis]) * scale[bestAxis])) < bestSplit)
+                i++;
+            else
+            {
+                --j;
+                std::swap(triangles[i], triangles[j]);
+                std::swap(boxes[i], boxes[j]);
+                std::swap(centers[i], centers[j]);
+            }
+        }
+
+        uint32_t left = (uint32_t)nodes.size();
+        nodes.push_back(Node{ bestLeft.min, first, bestLeft.max, i - first });
+        nodes.push_back(Node{ bestRight.min, i, bestRight.max, end - i });
+        nodes[index].leftOrFirst = left;
+        nodes[index].count = 0;
+        splits.push_back(glm::uvec2(left, depth + 1));
+        splits.push_back(glm::uvec2(left + 1, depth + 1));
+    }
+}
+
+inline RayHit Bvh::intersect(const Ray& ray) const
+{
+    RayHit hit;
+    if (nodes.empty())
+        return hit;
+    Slab s = slab(ray);
+    float limit = 1e30f;
+    if (enter(nodes[0], s, limit) == 1e30f)
+        return hit;
+
+    uint32_t stack[MAX_DEPTH + 2];
+    int top = 0;
+    stack[top++] = 0;
+    while (top)
+    {
+        const Node& node = nodes[stack[--top]];
+        if (node.count)
+        {
+            for (uint32_t i = 0; i < node.count; i++)
+                test(triangles[node.leftOrFirst + i], ray, hit);
+            if (hit.hit)
+                limit = hit.distance;
+            continue;
+        }
+        // the nearer child is walked first, the farther one only if it is
+        // still nearer than the closest hit by then
+        uint32_t near = node.leftOrFirst, far = near + 1;
+        float tNear = enter(nodes[near], s, limit), tFar = enter(nodes[far], s, limit);
+        if (tFar < tNear)
+        {
+            std::swap(near, far);
+            std::swap(tNear, tFar);
+        }
+        if (tFar != 1e30f)
+            stack[top++] = far;
+        if (tNear != 1e30f)
+            stack[top++] = near;
+    }
+    return hit;
+}
+
+inline void Bvh::intersect(const Ray* rays, RayHit* hits, size_t count) const
+{
+    for (size_t first = 0; first < count; first += PACKET)
+    {
+        int n = (int)std::min<size_t>(PACKET, count - first);
+        const Ray* packet = rays + first;
+        RayHit* out = hits + first;
+        Slab slabs[PACKET];
+        float limits[PACKET];
+        uint32_t rootMask = 0;
+        for (int r = 0; r < n; r++)
+        {
+            out[r] = RayHit();
+            slabs[r] = slab(packet[r]);
+            limits[r] = 1e30f;
+            if (!nodes.empty() && enter(nodes[0], slabs[r], limits[r]) != 1e30f)
+                rootMask |= 1u << r;
+        }
+        if (!rootMask)
+            continue;
+
+        // each entry carries the rays that entered the node's box
+        struct Entry
+        {
+            uint32_t node, mask;
+        };
+        Entry stack[MAX_DEPTH + 2];
+        int top = 0;
+        stack[top++] = Entry{ 0, rootMask };
+        while (top)
+        {
+            Entry entry = stack[--top];
+            const Node& node = nodes[entry.node];
+            if (node.count)
+            {
+                for (uint32_t i = 0; i < node.count; i++)
+                {
+                    const Triangle& t = triangles[node.leftOrFirst + i];
+                    for (int r = 0; r < n; r++)
+                        if (entry.mask >> r & 1)
+                            test(t, packet[r], out[r]);
+                }
+                for (int r = 0; r < n; r++)
+                    if (entry.mask >> r & 1 && out[r].hit)
+                        limits[r] = out[r].distance;
+                continue;
+            }
+            // both children against the packet; the one the packet reaches
+            // first is walked first
+            Entry near = { node.leftOrFirst, 0 }, far = { node.leftOrFirst + 1, 0 };
+            float tNear = 1e30f, tFar = 1e30f;
+            for (int r = 0; r < n; r++)
+            {
+                if (!(entry.mask >> r & 1))
+                    continue;
+                float a = enter(nodes[near.node], slabs[r], limits[r]);
+                float b = enter(nodes[far.node], slabs[r], limits[r]);
+                if (a != 1e30f)
+                {
+                    near.mask |= 1u << r;
+                    tNear = std::min(tNear, a);
+                }
+                if (b != 1e30f)
+                {
+                    far.mask |= 1u << r;
+                    tFar = std::min(tFar, b);
+                }
+            }
+            if (tFar < tNear)
+                std::swap(near, far);
+            if (far.mask)
+                stack[top++] = far;
+            if (near.mask)
+                stack[top++] = near;
+        }
+    }
+}
+
+#endif
@@ -4,6 +4,7 @@
 #include <glad/glad.h>
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
 
 #include <vector>
 
@@ -21,9 +22,15 @@ const float PITCH       =  0.0f;
 const float SPEED       =  2.5f;
 const float SENSITIVITY =  0.1f;
 const float ZOOM        =  90.0f;
+const float NEAR_PLANE  =  0.1f;
+const float FAR_PLANE   =  100.0f;
 
 
-// An abstract camera class that processes input and calculates the corresponding Euler Angles, Vectors and Matrices for use in OpenGL
+// An abstract camera class that processes input and calculates the corresponding orientation, Vectors and Matrices for use in OpenGL.
+//
+// Mouse input is only accumulated; the orientation quaternion and the Front/Right/Up vectors are rebuilt once,
+// the next time something needs them, so the cost per frame does not depend on how many events GLFW delivers.
+// View, projection, view-projection and their inverses are cached and rebuilt only when their inputs change.
 class Camera
 {
 public:
@@ -33,6 +40,7 @@ public:
     glm::vec3 Up;
     glm::vec3 Right;
     glm::vec3 WorldUp;
+    glm::quat Orientation;
     // euler Angles
     float Yaw;
     float Pitch;
@@ -60,15 +68,112 @@ public:
         updateCameraVectors();
     }
 
-    // returns the view matrix calculated using Euler Angles and the LookAt Matrix
-    glm::mat4 GetViewMatrix()
+    // sets the projection parameters; the projection matrix is rebuilt lazily. With reverseZ the projection
+    // maps near to depth 1 and infinity to depth 0, which needs glClipControl(GL_LOWER_LEFT, GL_ZERO_TO_ONE),
+    // glDepthFunc(GL_GREATER) and glClearDepth(0.0)
+    void SetPerspective(float aspect, float nearPlane = NEAR_PLANE, float farPlane = FAR_PLANE, bool reverseZ = false)
     {
-        return glm::lookAt(Position, Position + Front, Up);
+        this->aspect = aspect;
+        this->nearPlane = nearPlane;
+        this->farPlane = farPlane;
+        this->reverseZ = reverseZ;
+        projDirty = true;
+    }
+
+    // changes only the aspect ratio, e.g. on a resize, keeping the planes and depth mapping
+    void SetAspect(float aspect)
+    {
+        this->aspect = aspect;
+        projDirty = true;
+    }
+
+    float GetAspect() const { return aspect; }
+    float GetNearPlane() const { return nearPlane; }
+    float GetFarPlane() const { return farPlane; }
+    bool IsReverseZ() const { return reverseZ; }
+
+    // applies the mouse movement accumulated since the last call. Called implicitly by every getter,
+    // call it once per frame after polling events to keep the work in one place.
+    void Update()
+    {
+        if (pendingX != 0.0f || pendingY != 0.0f)
+            applyMouseMovement();
+    }
+
+    // returns the view matrix calculated from the orientation quaternion
+    const glm::mat4& GetViewMatrix()
+    {
+        Update();
+        if (viewDirty || Position != viewPosition)
+        {
+            // rows of the rotation are the camera axes, no lookAt needed
+            view = glm::mat4(1.0f);
+            view[0][0] = Right.x;  view[1][0] = Right.y;  view[2][0] = Right.z;
+            view[0][1] = Up.x;     view[1][1] = Up.y;     view[2][1] = Up.z;
+            view[0][2] = -Front.x; view[1][2] = -Front.y; view[2][2] = -Front.z;
+            view[3][0] = -glm::dot(Right, Position);
+            view[3][1] = -glm::dot(Up, Position);
+            view[3][2] =  glm::dot(Front, Position);
+            viewPosition = Position;
+            viewDirty = false;
+            derivedDirty = true;
+        }
+        return view;
+    }
+
+    const glm::mat4& GetProjectionMatrix()
+    {
+        if (projDirty || Zoom != projZoom)
+        {
+            if (reverseZ)
+            {
+                // infinite far plane, depth = near / -z_view
+                float f = 1.0f / glm::tan(glm::radians(Zoom) * 0.5f);
+                projection = glm::mat4(0.0f);
+                projection[0][0] = f / aspect;
+                projection[1][1] = f;
+                projection[2][3] = -1.0f;
+                projection[3][2] = nearPlane;
+            }
+            else
+            {
+                projection = glm::perspective(glm::radians(Zoom), aspect, nearPlane, farPlane);
+            }
+            projZoom = Zoom;
+            projDirty = false;
+            derivedDirty = true;
+        }
+        return projection;
+    }
+
+    const glm::mat4& GetViewProjectionMatrix()
+    {
+        updateDerived();
+        return viewProjection;
+    }
+
+    const glm::mat4& GetInverseViewMatrix()
+    {
+        updateDerived();
+        return inverseView;
+    }
+
+    const glm::mat4& GetInverseProjectionMatrix()
+    {
+        updateDerived();
+        return inverseProjection;
+    }
+
+    const glm::mat4& GetInverseViewProjectionMatrix()
+    {
+        updateDerived();
+        return inverseViewProjection;
     }
 
     // processes input received from any keyboard-like input system. Accepts input parameter in the form of camera defined ENUM (to abstract it from windowing systems)
     void ProcessKeyboard(Camera_Movement direction, float deltaTime)
     {
+        Update();
         float velocity = MovementSpeed * deltaTime;
         if (direction == FORWARD)
             Position += Front * velocity;
@@ -81,16 +186,56 @@ public:
     }
 
     // processes input received from a mouse input system. Expects the offset value in both the x and y direction.
+    // The offsets are only accumulated here; see Update().
     void ProcessMouseMovement(float xoffset, float yoffset, GLboolean constrainPitch = true)
     {
-        xoffset *= MouseSensitivity;
-        yoffset *= MouseSensitivity;
+        pendingX += xoffset;
+        pendingY += yoffset;
+        pendingConstrain = constrainPitch;
+    }
 
-        Yaw   += xoffset;
-        Pitch += yoffset;
+    // processes input received from a mouse scroll-wheel event. Only requires input on the vertical wheel-axis
+    void ProcessMouseScroll(float yoffset)
+    {
+        Zoom -= (float)yoffset;
+        if (Zoom < 1.0f)
+            Zoom = 1.0f;
+        if (Zoom > ZOOM)
+            Zoom = ZOOM;
+    }
+
+private:
+    // projection options, set through SetPerspective and SetAspect so projDirty follows them
+    float aspect = 1.0f;
+    float nearPlane = NEAR_PLANE;
+    float farPlane = FAR_PLANE;
+    bool reverseZ = false;
+
+    glm::mat4 view;
+    glm::mat4 projection;
+    glm::mat4 viewProjection;
+    glm::mat4 inverseView;
+    glm::mat4 inverseProjection;
+    glm::mat4 inverseViewProjection;
+    glm::vec3 viewPosition = glm::vec3(0.0f);
+    float projZoom = 0.0f;
+    bool viewDirty = true;
+    bool projDirty = true;
+    bool derivedDirty = true;
+
+    float pendingX = 0.0f;
+    float pendingY = 0.0f;
+    GLboolean pendingConstrain = true;
+
+    void applyMouseMovement()
+    {
+        Yaw   += pendingX * MouseSensitivity;
+        Pitch += pendingY * MouseSensitivity;
+        pendingX = 0.0f;
+        pendingY = 0.0f;
 
         // make sure that when pitch is out of bounds, screen doesn't get flipped
-        if (constrainPitch)
+        if (pendingConstrain)
         {
             if (Pitch > 89.0f)
                 Pitch = 89.0f;
@@ -98,33 +243,36 @@ public:
                 Pitch = -89.0f;
         }
 
-        // update Front, Right and Up Vectors using the updated Euler angles
+        // update Front, Right and Up Vectors using the updated angles
         updateCameraVectors();
     }
 
-    // processes input received from a mouse scroll-wheel event. Only requires input on the vertical wheel-axis
-    void ProcessMouseScroll(float yoffset)
+    void updateDerived()
     {
-        Zoom -= (float)yoffset;
-        if (Zoom < 1.0f)
-            Zoom = 1.0f;
-        if (Zoom > ZOOM)
-            Zoom = ZOOM; 
+        GetViewMatrix();
+        GetProjectionMatrix();
+        if (!derivedDirty)
+            return;
+        viewProjection = projection * view;
+        // the view matrix is rigid, so its inverse is the transposed rotation and the camera position
+        inverseView = glm::mat4(glm::vec4(Right, 0.0f), glm::vec4(Up, 0.0f), glm::vec4(-Front, 0.0f), glm::vec4(Position, 1.0f));
+        inverseProjection = glm::inverse(projection);
+        inverseViewProjection = inverseView * inverseProjection;
+        derivedDirty = false;
     }
 
-private:
-    // calculates the front vector from the Camera's (updated) Euler Angles
+    // calculates the orientation quaternion and the basis vectors from the Camera's Euler Angles
     void updateCameraVectors()
     {
-        // calculate the new Front vector
-        glm::vec3 front;
-        front.x = cos(glm::radians(Yaw)) * cos(glm::radians(Pitch));
-        front.y = sin(glm::radians(Pitch));
-        front.z = sin(glm::radians(Yaw)) * cos(glm::radians(Pitch));
-        Front = glm::normalize(front);
-        // also re-calculate the Right and Up vector
-        Right = glm::normalize(glm::cross(Front, WorldUp));  // normalize the vectors, because their length gets closer to 0 the more you look up or down which results in slower movement.
-        Up    = glm::normalize(glm::cross(Right, Front));
+        // same convention as the Euler formulation: yaw of -90 looks down -z, yaw turns around +y, pitch around the local x axis
+        glm::quat yaw = glm::angleAxis(glm::radians(-(Yaw + 90.0f)), glm::vec3(0.0f, 1.0f, 0.0f));
+        glm::quat pitch = glm::angleAxis(glm::radians(Pitch), glm::vec3(1.0f, 0.0f, 0.0f));
+        Orientation = glm::normalize(yaw * pitch);
+        Front = Orientation * glm::vec3(0.0f, 0.0f, -1.0f);
+        // derive Right from WorldUp like lookAt does, so the camera never rolls
+        Right = glm::normalize(glm::cross(Front, WorldUp));
+        Up    = glm::cross(Right, Front);
+        viewDirty = true;
     }
 };
 #endif
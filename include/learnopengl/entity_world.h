@@ -0,0 +1,469 @@
+#ifndef ENTITY_WORLD_H
+#define ENTITY_WORLD_H
+
+#include <learnopengl/job_system.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+// Entities grouped by archetype, the exact set of component types they have.
+// Each archetype keeps one contiguous array per component type (structure of
+// arrays), so a query hands systems plain arrays to loop over instead of
+// objects to visit. Components must be trivially copyable: rows are moved
+// with memcpy when entities are destroyed or change archetype.
+//
+// The world is not synchronized. Systems may run in parallel (EntitySchedule)
+// and split their rows across threads (eachParallel), but creating,
+// destroying or changing the components of entities must happen between runs.
+
+typedef uint32_t Entity;   // slot index in the low 24 bits, generation in the high 8
+const Entity NULL_ENTITY = 0xffffffffu;
+const unsigned MAX_COMPONENT_TYPES = 64;
+typedef uint64_t ComponentMask;
+
+inline std::vector<size_t>& componentSizes()
+{
+    static std::vector<size_t> sizes;
+    return sizes;
+}
+
+inline unsigned registerComponent(size_t size)
+{
+    std::vector<size_t>& sizes = componentSizes();
+    if (sizes.size() == MAX_COMPONENT_TYPES)
+    {
+        std::cout << "ERROR::ENTITY_WORLD::TOO_MANY_COMPONENT_TYPES" << std::endl;
+        std::abort();
+    }
+    sizes.push_back(size);
+    return (unsigned)sizes.size() - 1;
+}
+
+// Dense id of a component type, assigned on first use. Create entities of
+// every type before systems run in parallel, the registry isn't locked.
+template<typename T>
+unsigned componentTypeId()
+{
+    static_assert(std::is_trivially_copyable<T>::value, "components are moved with memcpy");
+    static_assert(alignof(T) <= alignof(std::max_align_t), "component arrays are only max_align_t aligned");
+    static unsigned id = registerComponent(sizeof(T));
+    return id;
+}
+
+// T and const T are the same component
+template<typename T>
+unsigned componentId()
+{
+    return componentTypeId<typename std::remove_const<T>::type>();
+}
+
+template<typename... Ts>
+ComponentMask componentMask()
+{
+    return (ComponentMask(0) | ... | (ComponentMask(1) << componentId<Ts>()));
+}
+
+// const components in a query or system are only read
+template<typename... Ts>
+ComponentMask writtenComponentMask()
+{
+    return (ComponentMask(0) | ... | (std::is_const<Ts>::value ? ComponentMask(0) : ComponentMask(1) << componentId<Ts>()));
+}
+
+// Calls fn(begin, end) over [0, count) in pieces run as jobs; threads caps
+// how many threads the range is cut for (0: all of the job system's), and
+// ranges under two pieces of minPerThread stay on the calling thread.
+template<typename F>
+void parallelRanges(size_t count, unsigned threads, F fn, size_t minPerThread = 16384)
+{
+    JobSystem& jobs = jobSystem();
+    if (threads == 0 || threads > jobs.threadCount())
+        threads = jobs.threadCount();
+    if (threads <= 1 || count < 2 * minPerThread)
+    {
+        fn((size_t)0, count);
+        return;
+    }
+    // a few pieces per thread so the ones that finish early can steal
+    size_t grain = count / (threads * 4);
+    jobs.parallelFor(0, count, grain > minPerThread ? grain : minPerThread, fn);
+}
+
+class Archetype
+{
+public:
+    explicit Archetype(ComponentMask mask) : mask(mask)
+    {
+        for (unsigned id = 0; id < MAX_COMPONENT_TYPES; id++)
+        {
+            columnIndex[id] = -1;
+            if (mask & (ComponentMask(1) << id))
+            {
+                columnIndex[id] = (int)columns.size();
+                columns.push_back(Column{ id, componentSizes()[id], {} });
+            }
+        }
+    }
+
+    ComponentMask components() const { return mask; }
+    size_t size() const { return entities.size(); }
+    const Entity* entityArray() const { return entities.data(); }
+
+    bool has(unsigned id) const { return columnIndex[id] >= 0; }
+
+    // array of T for every row, nullptr when the archetype has no T
+    template<typename T>
+    T* array()
+    {
+        int c = columnIndex[componentId<T>()];
+        return c < 0 ? nullptr : (T*)columns[c].data.data();
+    }
+
+private:
+    friend class EntityWorld;
+
+    struct Column
+    {
+        unsigned id;
+        size_t elementSize;
+        std::vector<unsigned char> data;
+    };
+
+    ComponentMask mask;
+    std::vector<Entity> entities;
+    std::vector<Column> columns;
+    int columnIndex[MAX_COMPONENT_TYPES];
+
+    void reserve(size_t rows)
+    {
+        entities.reserve(rows);
+        for (Column& c : columns)
+            c.data.reserve(rows * c.elementSize);
+    }
+
+    // appends a row with every component zeroed
+    size_t push(Entity e)
+    {
+        entities.push_back(e);
+        for (Column& c : columns)
+            c.data.resize(c.data.size() + c.elementSize);
+        return entities.size() - 1;
+    }
+
+    void* at(unsigned id, size_t row)
+    {
+        Column& c = columns[columnIndex[id]];
+        return c.data.data() + row * c.elementSize;
+    }
+
+    // moves the last row into row; returns the entity that moved, if any
+    Entity swapRemove(size_t row)
+    {
+        size_t last = entities.size() - 1;
+        Entity moved = NULL_ENTITY;
+        if (row != last)
+        {
+            moved = entities[last];
+            entities[row] = moved;
+            for (Column& c : columns)
+                std::memcpy(c.data.data() + row * c.elementSize, c.data.data() + last * c.elementSize, c.elementSize);
+        }
+        entities.pop_back();
+        for (Column& c : columns)
+            c.data.resize(c.data.size() - c.elementSize);
+        return moved;
+    }
+};
+
+class EntityWorld
+{
+public:
+    EntityWorld() {}
+    EntityWorld(const EntityWorld&) = delete;
+    EntityWorld& operator=(const EntityWorld&) = delete;
+
+    template<typename... Ts>
+    Entity create(const Ts&... components)
+    {
+        Entity e = allocate();
+        Archetype& a = archetype(componentMask<Ts...>());
+        place(e, a);
+        size_t row = records[index(e)].row;
+        (std::memcpy(a.at(componentId<Ts>(), row), &components, sizeof(Ts)), ...);
+        return e;
+    }
+
+    // room for rows more entities with exactly the components Ts
+    template<typename... Ts>
+    void reserve(size_t rows)
+    {
+        Archetype& a = archetype(componentMask<Ts...>());
+        a.reserve(a.size() + rows);
+        records.reserve(records.size() + rows);
+    }
+
+    void destroy(Entity e)
+    {
+        if (!alive(e))
+            return;
+        Record& r = records[index(e)];
+        unplace(archetypes[r.archetype], r.row);
+        r.archetype = NO_ARCHETYPE;
+        r.generation++;
+        freeSlots.push_back(index(e));
+        living--;
+    }
+
+    bool alive(Entity e) const
+    {
+        uint32_t i = index(e);
+        return e != NULL_ENTITY && i < records.size() && records[i].archetype != NO_ARCHETYPE && records[i].generation == generation(e);
+    }
+
+    template<typename T>
+    T* get(Entity e)
+    {
+        if (!alive(e))
+            return nullptr;
+        const Record& r = records[index(e)];
+        Archetype& a = archetypes[r.archetype];
+        return a.has(componentId<T>()) ? (T*)a.at(componentId<T>(), r.row) : nullptr;
+    }
+
+    // adds or overwrites T, moving the entity to the archetype with T
+    template<typename T>
+    void add(Entity e, const T& component)
+    {
+        if (!alive(e))
+            return;
+        unsigned id = componentId<T>();
+        Record& r = records[index(e)];
+        if (!archetypes[r.archetype].has(id))
+            move(e, archetypes[r.archetype].components() | (ComponentMask(1) << id));
+        std::memcpy(archetypes[records[index(e)].archetype].at(id, records[index(e)].row), &component, sizeof(T));
+    }
+
+    template<typename T>
+    void remove(Entity e)
+    {
+        if (!alive(e))
+            return;
+        ComponentMask mask = archetypes[records[index(e)].archetype].components();
+        ComponentMask bit = ComponentMask(1) << componentId<T>();
+        if (mask & bit)
+            move(e, mask & ~bit);
+    }
+
+    size_t count() const { return living; }
+
+    // Calls fn(count, T1*, T2*, ...) once for every archetype that has all of
+    // Ts, with that archetype's arrays.
+    template<typename... Ts, typename F>
+    void each(F fn)
+    {
+        ComponentMask mask = componentMask<Ts...>();
+        for (Archetype& a : archetypes)
+            if ((a.components() & mask) == mask && a.size() > 0)
+                fn(a.size(), a.array<Ts>()...);
+    }
+
+    // each() with every archetype's rows split across threads; fn gets the
+    // arrays already offset to its range.
+    template<typename... Ts, typename F>
+    void eachParallel(F fn, unsigned threads = 0)
+    {
+        ComponentMask mask = componentMask<Ts...>();
+        for (Archetype& a : archetypes)
+        {
+            if ((a.components() & mask) != mask || a.size() == 0)
+                continue;
+            std::tuple<Ts*...> arrays(a.array<Ts>()...);
+            parallelRanges(a.size(), threads, [&](size_t begin, size_t end)
+            {
+                fn(end - begin, (std::get<Ts*>(arrays) + begin)...);
+            });
+        }
+    }
+
+    // rows of all archetypes that have Ts, for sizing output buffers
+    template<typename... Ts>
+    size_t countWith()
+    {
+        ComponentMask mask = componentMask<Ts...>();
+        size_t total = 0;
+        for (Archetype& a : archetypes)
+            if ((a.components() & mask) == mask)
+                total += a.size();
+        return total;
+    }
+
+private:
+    struct Record
+    {
+        uint32_t archetype;
+        uint32_t row;
+        uint8_t generation;
+    };
+
+    static const uint32_t NO_ARCHETYPE = 0xffffffffu;
+    static const uint32_t INDEX_BITS = 24;
+    static const uint32_t INDEX_MASK = (1u << INDEX_BITS) - 1;
+
+    std::vector<Archetype> archetypes;
+    std::vector<Record> records;
+    std::vector<uint32_t> freeSlots;
+    size_t living = 0;
+
+    static uint32_t index(Entity e) { return e & INDEX_MASK; }
+    static uint8_t generation(Entity e) { return (uint8_t)(e >> INDEX_BITS); }
+
+    Entity allocate()
+    {
+        uint32_t i;
+        if (!freeSlots.empty())
+        {
+            i = freeSlots.back();
+            freeSlots.pop_back();
+        }
+        else
+        {
+            if (records.size() >= INDEX_MASK)   // the last index is NULL_ENTITY's
+            {
+                std::cout << "ERROR::ENTITY_WORLD::TOO_MANY_ENTITIES" << std::endl;
+                std::abort();
+            }
+            i = (uint32_t)records.size();
+            records.push_back(Record{ NO_ARCHETYPE, 0, 0 });
+        }
+        living++;
+        return i | ((Entity)records[i].generation << INDEX_BITS);
+    }
+
+    Archetype& archetype(ComponentMask mask)
+    {
+        for (Archetype& a : archetypes)
+            if (a.components() == mask)
+                return a;
+        archetypes.emplace_back(mask);
+        return archetypes.back();
+    }
+
+    uint32_t archetypeIndex(const Archetype& a) const { return (uint32_t)(&a - archetypes.data()); }
+
+    void place(Entity e, Archetype& a)
+    {
+        Record& r = records[index(e)];
+        r.archetype = archetypeIndex(a);
+        r.row = (uint32_t)a.push(e);
+    }
+
+    void unplace(Archetype& a, size_t row)
+    {
+        Entity moved = a.swapRemove(row);
+        if (moved != NULL_ENTITY)
+            records[index(moved)].row = (uint32_t)row;
+    }
+
+    // copies the components both archetypes share, new ones start zeroed
+    void move(Entity e, ComponentMask mask)
+    {
+        uint32_t from = records[index(e)].archetype;
+        size_t fromRow = records[index(e)].row;
+        Archetype& to = archetype(mask);   // may reallocate archetypes, index again below
+        place(e, to);
+        Archetype& source = archetypes[from];
+        size_t toRow = records[index(e)].row;
+        for (Archetype::Column& c : source.columns)
+            if (to.has(c.id))
+                std::memcpy(to.at(c.id, toRow), c.data.data() + fromRow * c.elementSize, c.elementSize);
+        unplace(source, fromRow);
+    }
+};
+
+// A unit of work over the world plus the components it reads and writes,
+// which EntitySchedule uses to decide what may run at the same time. Systems
+// that issue GL calls set mainThread so they stay on the context's thread.
+struct EntitySystem
+{
+    const char* name;
+    ComponentMask reads;
+    ComponentMask writes;
+    bool mainThread;
+    std::function<void(EntityWorld&)> run;
+
+    bool conflicts(const EntitySystem& other) const
+    {
+        return (writes & (other.reads | other.writes)) || (other.writes & reads) || (mainThread && other.mainThread);
+    }
+};
+
+// system reading the const and writing the other component types in Ts
+template<typename... Ts, typename F>
+EntitySystem entitySystem(const char* name, F fn, bool mainThread = false)
+{
+    EntitySystem s;
+    s.name = name;
+    s.writes = writtenComponentMask<Ts...>();
+    s.reads = componentMask<Ts...>() & ~s.writes;
+    s.mainThread = mainThread;
+    s.run = fn;
+    return s;
+}
+
+// Runs systems in the order they were added, packing consecutive systems
+// whose component access doesn't conflict into one batch whose members run
+// as parallel jobs. A system never overtakes an earlier one it conflicts
+// with.
+class EntitySchedule
+{
+public:
+    void add(const EntitySystem& system)
+    {
+        if (batches.empty())
+            batches.emplace_back();
+        for (size_t i : batches.back())
+        {
+            if (systems[i].conflicts(system))
+            {
+                batches.emplace_back();
+                break;
+            }
+        }
+        batches.back().push_back(systems.size());
+        systems.push_back(system);
+    }
+
+    // call from the GL thread, mainThread systems run on the caller
+    void run(EntityWorld& world)
+    {
+        JobSystem& jobs = jobSystem();
+        for (const std::vector<size_t>& batch : batches)
+        {
+            // the main thread system, or else the last one, runs on this thread
+            size_t local = batch.back();
+            for (size_t i : batch)
+                if (systems[i].mainThread)
+                    local = i;
+            JobCounter counter;
+            for (size_t i : batch)
+                if (i != local)
+                    jobs.run(counter, [this, i, &world]() { systems[i].run(world); });
+            systems[local].run(world);
+            jobs.wait(counter);
+        }
+    }
+
+    size_t batchCount() const { return batches.size(); }
+
+private:
+    std::vector<EntitySystem> systems;
+    std::vector<std::vector<size_t>> batches;
+};
+#endif
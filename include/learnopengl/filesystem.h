@@ -3,7 +3,18 @@
 
 #include <string>
 #include <cstdlib>
-#include "root_directory.h" // This is a configuration file generated by CMake.
+// root_directory.h is generated by the upstream CMake build and isn't part of
+// this tree; without it paths resolve relative to the binary. Shaders and
+// images are found through resources.pak first, see learnopengl/resource_pack.h.
+#if defined(__has_include)
+#if __has_include("root_directory.h")
+#include "root_directory.h"
+#define LOGL_HAS_ROOT_DIRECTORY
+#endif
+#endif
+#ifndef LOGL_HAS_ROOT_DIRECTORY
+static const char* const logl_root = nullptr;
+#endif
 
 class FileSystem
 {
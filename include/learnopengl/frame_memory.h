@@ -0,0 +1,569 @@
+#ifndef FRAME_MEMORY_H
+#define FRAME_MEMORY_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory_resource>
+#include <new>
+#include <utility>
+
+// Memory for code that runs every frame:
+//
+//   LinearArena    bump allocator, everything is released at once by reset()
+//   FixedPool      equal sized slots recycled through a free list
+//   ObjectPool<T>  FixedPool that constructs and destroys T
+//   ArenaResource / PoolResource
+//                  std::pmr::memory_resource views of the two, for
+//                  std::pmr::vector, std::pmr::string, ...
+//   frameMemory()  process wide arena reset by beginFrame(), plus the
+//                  allocation counts of the last frame
+//
+// The stb_image hooks at the end route its decode buffers through the same
+// counters, and into an arena while an ArenaScope is active.
+
+struct MemoryCounters
+{
+    size_t heapAllocations = 0;   // operator new (see LOGL_COUNT_HEAP_ALLOCATIONS), stb_image and arena/pool growth
+    size_t heapBytes = 0;
+    size_t arenaAllocations = 0;  // from the frame arena
+    size_t arenaBytes = 0;
+};
+
+// Process wide heap totals; relaxed atomics since stb_image decodes on worker
+// threads. Arenas and pools belong to one thread and count for themselves.
+struct MemoryStats
+{
+    std::atomic<size_t> heapAllocations{0};
+    std::atomic<size_t> heapBytes{0};
+
+    void heap(size_t size)
+    {
+        heapAllocations.fetch_add(1, std::memory_order_relaxed);
+        heapBytes.fetch_add(size, std::memory_order_relaxed);
+    }
+
+    MemoryCounters snapshot() const
+    {
+        MemoryCounters c;
+        c.heapAllocations = heapAllocations.load(std::memory_order_relaxed);
+        c.heapBytes = heapBytes.load(std::memory_order_relaxed);
+        return c;
+    }
+};
+
+inline MemoryStats& memoryStats()
+{
+    static MemoryStats stats;
+    return stats;
+}
+
+inline MemoryCounters operator-(const MemoryCounters& a, const MemoryCounters& b)
+{
+    MemoryCounters c;
+    c.heapAllocations = a.heapAllocations - b.heapAllocations;
+    c.heapBytes = a.heapBytes - b.heapBytes;
+    c.arenaAllocations = a.arenaAllocations - b.arenaAllocations;
+    c.arenaBytes = a.arenaBytes - b.arenaBytes;
+    return c;
+}
+
+// malloc that shows up in the heap counters
+inline void* countedMalloc(size_t size)
+{
+    memoryStats().heap(size);
+    return std::malloc(size);
+}
+
+inline size_t memoryAlignUp(size_t value, size_t align)
+{
+    return (value + align - 1) & ~(align - 1);
+}
+
+// Bump allocator over a chain of heap blocks. Allocation is an aligned pointer
+// increment, deallocation does nothing and reset() frees everything at once.
+// A frame that outgrows the first block chains more; reset() then replaces the
+// chain with one block of the combined size, so after the first frames a
+// steady workload never touches the heap.
+class LinearArena
+{
+public:
+    explicit LinearArena(size_t capacity = 1 << 20) { grow(capacity); }
+    ~LinearArena() { release(); }
+
+    LinearArena(const LinearArena&) = delete;
+    LinearArena& operator=(const LinearArena&) = delete;
+
+    void* allocate(size_t size, size_t align = alignof(std::max_align_t))
+    {
+        size_t offset = alignedOffset(align);
+        if (offset + size > head->size)
+        {
+            grow(size + align > head->size * 2 ? size + align : head->size * 2);
+            offset = alignedOffset(align);
+        }
+        allocations++;
+        allocatedBytes += size;
+        last = offset;
+        used = offset + size;
+        return head->data() + offset;
+    }
+
+    template<typename T>
+    T* allocate(size_t count)
+    {
+        return (T*)allocate(count * sizeof(T), alignof(T));
+    }
+
+    // Grows or shrinks p, the most recent allocation, in place when it fits;
+    // anything else is copied to a new allocation.
+    void* reallocate(void* p, size_t oldSize, size_t newSize, size_t align = alignof(std::max_align_t))
+    {
+        if (p == head->data() + last && last + newSize <= head->size)
+        {
+            if (newSize > oldSize)
+                allocatedBytes += newSize - oldSize;
+            used = last + newSize;
+            return p;
+        }
+        void* q = allocate(newSize, align);
+        if (p)
+            std::memcpy(q, p, oldSize < newSize ? oldSize : newSize);
+        return q;
+    }
+
+    // Everything allocated so far becomes invalid.
+    void reset()
+    {
+        if (head->next)
+        {
+            size_t total = capacity();
+            release();
+            grow(total);
+        }
+        used = 0;
+        last = 0;
+    }
+
+    bool owns(const void* p) const
+    {
+        for (Block* b = head; b; b = b->next)
+            if ((const char*)p >= b->data() && (const char*)p < b->data() + b->size)
+                return true;
+        return false;
+    }
+
+    // bytes handed out from the current block
+    size_t bytesUsed() const { return used; }
+
+    size_t capacity() const
+    {
+        size_t total = 0;
+        for (Block* b = head; b; b = b->next)
+            total += b->size;
+        return total;
+    }
+
+    // running totals over the arena's life
+    size_t allocationCount() const { return allocations; }
+    size_t allocatedByteCount() const { return allocatedBytes; }
+
+private:
+    struct alignas(std::max_align_t) Block
+    {
+        Block* next;
+        size_t size;
+
+        char* data() { return (char*)(this + 1); }
+        const char* data() const { return (const char*)(this + 1); }
+    };
+
+    Block* head = nullptr;
+    size_t used = 0;
+    size_t last = 0;
+    size_t allocations = 0;
+    size_t allocatedBytes = 0;
+
+    // the first offset past used whose address, not just offset, is aligned:
+    // block data is only aligned to max_align_t
+    size_t alignedOffset(size_t align) const
+    {
+        uintptr_t base = (uintptr_t)head->data();
+        return memoryAlignUp(base + used, align) - base;
+    }
+
+    void grow(size_t size)
+    {
+        Block* b = (Block*)countedMalloc(sizeof(Block) + size);
+        if (!b)
+        {
+            std::cout << "ERROR::FRAME_MEMORY::OUT_OF_MEMORY: " << size << " bytes" << std::endl;
+            std::abort();
+        }
+        b->next = head;
+        b->size = size;
+        head = b;
+        used = 0;
+        last = 0;
+    }
+
+    void release()
+    {
+        while (head)
+        {
+            Block* next = head->next;
+            std::free(head);
+            head = next;
+        }
+    }
+};
+
+// Slots of one size and alignment carved out of chunks and recycled through
+// an intrusive free list. Chunks go back to the heap only with the pool, so
+// a pool that has reached its working size never allocates again.
+class FixedPool
+{
+public:
+    FixedPool(size_t slotSize, size_t slotAlign = alignof(std::max_align_t), size_t slotsPerChunk = 256)
+        : slotAlign(slotAlign < alignof(void*) ? alignof(void*) : slotAlign),
+          slotSize(memoryAlignUp(slotSize < sizeof(void*) ? sizeof(void*) : slotSize, this->slotAlign)),
+          slotsPerChunk(slotsPerChunk)
+    {
+    }
+    ~FixedPool()
+    {
+        while (chunks)
+        {
+            Chunk* next = chunks->next;
+            std::free(chunks);
+            chunks = next;
+        }
+    }
+
+    FixedPool(const FixedPool&) = delete;
+    FixedPool& operator=(const FixedPool&) = delete;
+
+    void* allocate()
+    {
+        if (!freeList)
+            grow();
+        Slot* s = freeList;
+        freeList = s->next;
+        liveSlots++;
+        allocations++;
+        return s;
+    }
+
+    void deallocate(void* p)
+    {
+        Slot* s = (Slot*)p;
+        s->next = freeList;
+        freeList = s;
+        liveSlots--;
+    }
+
+    size_t size() const { return slotSize; }
+    size_t alignment() const { return slotAlign; }
+    size_t live() const { return liveSlots; }
+    size_t allocationCount() const { return allocations; }
+
+private:
+    struct Slot { Slot* next; };
+    struct Chunk { Chunk* next; };
+
+    size_t slotAlign;
+    size_t slotSize;
+    size_t slotsPerChunk;
+    Chunk* chunks = nullptr;
+    Slot* freeList = nullptr;
+    size_t liveSlots = 0;
+    size_t allocations = 0;
+
+    void grow()
+    {
+        size_t header = memoryAlignUp(sizeof(Chunk), slotAlign);
+        char* memory = (char*)countedMalloc(header + slotSize * slotsPerChunk + slotAlign);
+        if (!memory)
+        {
+            std::cout << "ERROR::FRAME_MEMORY::OUT_OF_MEMORY: pool chunk" << std::endl;
+            std::abort();
+        }
+        Chunk* c = (Chunk*)memory;
+        c->next = chunks;
+        chunks = c;
+        // malloc only promises max_align_t, slots may want more
+        char* first = (char*)memoryAlignUp((size_t)(memory + header), slotAlign);
+        for (size_t i = slotsPerChunk; i-- > 0;)
+        {
+            Slot* s = (Slot*)(first + i * slotSize);
+            s->next = freeList;
+            freeList = s;
+        }
+    }
+};
+
+template<typename T>
+class ObjectPool
+{
+public:
+    explicit ObjectPool(size_t objectsPerChunk = 256) : pool(sizeof(T), alignof(T), objectsPerChunk) {}
+
+    template<typename... Args>
+    T* create(Args&&... args)
+    {
+        return new (pool.allocate()) T(std::forward<Args>(args)...);
+    }
+
+    void destroy(T* object)
+    {
+        object->~T();
+        pool.deallocate(object);
+    }
+
+    size_t live() const { return pool.live(); }
+
+private:
+    FixedPool pool;
+};
+
+// std::pmr view of an arena. Deallocation is a no-op, memory comes back with
+// the arena's reset(), so containers using it must not outlive that.
+class ArenaResource : public std::pmr::memory_resource
+{
+public:
+    explicit ArenaResource(LinearArena& arena) : arena(arena) {}
+
+private:
+    LinearArena& arena;
+
+    void* do_allocate(size_t bytes, size_t align) override { return arena.allocate(bytes, align); }
+    void do_deallocate(void*, size_t, size_t) override {}
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+// std::pmr view of a pool for node based containers (std::pmr::list, map,
+// unordered_map nodes); requests that don't fit a slot go to upstream.
+class PoolResource : public std::pmr::memory_resource
+{
+public:
+    explicit PoolResource(FixedPool& pool, std::pmr::memory_resource* upstream = std::pmr::new_delete_resource())
+        : pool(pool), upstream(upstream)
+    {
+    }
+
+private:
+    FixedPool& pool;
+    std::pmr::memory_resource* upstream;
+
+    bool fits(size_t bytes, size_t align) const { return bytes <= pool.size() && align <= pool.alignment(); }
+
+    void* do_allocate(size_t bytes, size_t align) override
+    {
+        return fits(bytes, align) ? pool.allocate() : upstream->allocate(bytes, align);
+    }
+    void do_deallocate(void* p, size_t bytes, size_t align) override
+    {
+        if (fits(bytes, align))
+            pool.deallocate(p);
+        else
+            upstream->deallocate(p, bytes, align);
+    }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+// Scratch memory of the frame being rendered. Call beginFrame() once at the
+// top of the render loop: it records what the previous frame allocated and
+// resets the arena, so anything taken from arena() or resource() lives until
+// the next beginFrame().
+class FrameMemory
+{
+public:
+    explicit FrameMemory(size_t capacity = 1 << 20) : scratch(capacity), scratchResource(scratch) {}
+
+    void beginFrame()
+    {
+        MemoryCounters now = memoryStats().snapshot();
+        now.arenaAllocations = scratch.allocationCount();
+        now.arenaBytes = scratch.allocatedByteCount();
+        if (frames > 0)
+            previous = now - frameStart;
+        frameStart = now;
+        frames++;
+        scratch.reset();
+    }
+
+    LinearArena& arena() { return scratch; }
+    std::pmr::memory_resource* resource() { return &scratchResource; }
+
+    // what the frame before the current one allocated
+    const MemoryCounters& lastFrame() const { return previous; }
+    size_t frameCount() const { return frames; }
+
+private:
+    LinearArena scratch;
+    ArenaResource scratchResource;
+    MemoryCounters frameStart;
+    MemoryCounters previous;
+    size_t frames = 0;
+};
+
+inline FrameMemory& frameMemory()
+{
+    static FrameMemory memory;
+    return memory;
+}
+
+// Reports a steady-state frame that still allocated from the heap, once per
+// run. warmupFrames lets the first frames fill pools, arenas and driver
+// caches. Returns false when the last frame allocated.
+inline bool checkFrameAllocations(size_t warmupFrames = 60)
+{
+    const FrameMemory& memory = frameMemory();
+    if (memory.frameCount() <= warmupFrames || memory.lastFrame().heapAllocations == 0)
+        return true;
+    static bool reported = false;
+    if (!reported)
+    {
+        std::cout << "ERROR::FRAME_MEMORY::HEAP_ALLOCATION_IN_FRAME: " << memory.lastFrame().heapAllocations
+                  << " allocations, " << memory.lastFrame().heapBytes << " bytes in frame " << memory.frameCount() - 1 << std::endl;
+        reported = true;
+    }
+    return false;
+}
+
+// stb_image allocations. Each block carries a small header with its size and
+// origin, so STBI_FREE and STBI_REALLOC work whichever scope the block came
+// from. Inside an ArenaScope blocks come from that arena and freeing them is
+// a no-op; otherwise they come from the counted heap.
+struct StbiBlockHeader
+{
+    size_t size;
+    size_t fromArena;
+    size_t pad[2];   // keeps the data 16 byte aligned for the SIMD kernels
+};
+
+inline LinearArena*& stbiArena()
+{
+    thread_local LinearArena* arena = nullptr;
+    return arena;
+}
+
+// Sends stb_image allocations on this thread to an arena for the scope's
+// lifetime; the arena must outlive every image decoded in the scope. Decode
+// worker threads are not covered and use the heap.
+class ArenaScope
+{
+public:
+    explicit ArenaScope(LinearArena& arena) : saved(stbiArena()) { stbiArena() = &arena; }
+    ~ArenaScope() { stbiArena() = saved; }
+
+    ArenaScope(const ArenaScope&) = delete;
+    ArenaScope& operator=(const ArenaScope&) = delete;
+
+private:
+    LinearArena* saved;
+};
+
+inline void* stbiMemoryMalloc(size_t size)
+{
+    LinearArena* arena = stbiArena();
+    StbiBlockHeader* h = arena ? (StbiBlockHeader*)arena->allocate(sizeof(StbiBlockHeader) + size, 16)
+                               : (StbiBlockHeader*)countedMalloc(sizeof(StbiBlockHeader) + size);
+    if (!h)
+        return nullptr;
+    h->size = size;
+    h->fromArena = arena != nullptr;
+    return h + 1;
+}
+
+inline void stbiMemoryFree(void* p)
+{
+    if (!p)
+        return;
+    StbiBlockHeader* h = (StbiBlockHeader*)p - 1;
+    if (!h->fromArena)
+        std::free(h);
+}
+
+inline void* stbiMemoryRealloc(void* p, size_t newSize)
+{
+    if (!p)
+        return stbiMemoryMalloc(newSize);
+    StbiBlockHeader* h = (StbiBlockHeader*)p - 1;
+    LinearArena* arena = stbiArena();
+    if (h->fromArena && arena && arena->owns(h))
+    {
+        h = (StbiBlockHeader*)arena->reallocate(h, sizeof(StbiBlockHeader) + h->size, sizeof(StbiBlockHeader) + newSize, 16);
+        h->size = newSize;
+        return h + 1;
+    }
+    if (!h->fromArena && !arena)
+    {
+        memoryStats().heap(newSize);
+        h = (StbiBlockHeader*)std::realloc(h, sizeof(StbiBlockHeader) + newSize);
+        if (!h)
+            return nullptr;
+        h->size = newSize;
+        return h + 1;
+    }
+    // moves between the heap and an arena
+    void* q = stbiMemoryMalloc(newSize);
+    if (q)
+    {
+        std::memcpy(q, p, h->size < newSize ? h->size : newSize);
+        stbiMemoryFree(p);
+    }
+    return q;
+}
+
+// Define LOGL_STBI_FRAME_MEMORY before including this header in the
+// translation unit that defines STB_IMAGE_IMPLEMENTATION, and include it
+// before stb_image.h, to install the hooks above.
+#ifdef LOGL_STBI_FRAME_MEMORY
+#define STBI_MALLOC(size) stbiMemoryMalloc(size)
+#define STBI_REALLOC(p, newSize) stbiMemoryRealloc(p, newSize)
+#define STBI_FREE(p) stbiMemoryFree(p)
+#endif
+
+// Define LOGL_COUNT_HEAP_ALLOCATIONS in exactly one translation unit of a
+// program to count every operator new in memoryStats(). C allocations
+// (malloc in GLFW, the driver) are not seen.
+#ifdef LOGL_COUNT_HEAP_ALLOCATIONS
+// out of line so GCC doesn't pair the inlined malloc/free with new/delete and
+// warn about a mismatch
+#ifdef __GNUC__
+__attribute__((noinline))
+#endif
+void* countedOperatorNew(size_t size) noexcept
+{
+    memoryStats().heap(size);
+    return std::malloc(size ? size : 1);
+}
+#ifdef __GNUC__
+__attribute__((noinline))
+#endif
+void countedOperatorDelete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void* operator new(size_t size)
+{
+    if (void* p = countedOperatorNew(size))
+        return p;
+    throw std::bad_alloc();
+}
+void* operator new[](size_t size) { return operator new(size); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return countedOperatorNew(size); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return countedOperatorNew(size); }
+void operator delete(void* p) noexcept { countedOperatorDelete(p); }
+void operator delete[](void* p) noexcept { countedOperatorDelete(p); }
+void operator delete(void* p, size_t) noexcept { countedOperatorDelete(p); }
+void operator delete[](void* p, size_t) noexcept { countedOperatorDelete(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { countedOperatorDelete(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { countedOperatorDelete(p); }
+#endif
+#endif
@@ -0,0 +1,145 @@
+#ifndef GL_TRACE_H
+#define GL_TRACE_H
+
+#include <cstdio>
+
+#ifdef GLAD_TRACE
+#include <glad/glad_trace.h>
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#endif
+
+// Per-frame cost of every GL entry point, from glad's traced loader mode
+// (glad/glad_trace.h). Calls between beginFrame() and endFrame() are added
+// up; loading and setup outside a frame are not. The report ranks the entry
+// points by their time a frame, with calls a frame and the median and 99th
+// percentile of a single call. Times are spent on the CPU inside the driver.
+// The GPU's work shows up only where the driver waits for it, in glFinish,
+// glReadPixels or a swap.
+//
+// Without GLAD_TRACE every member is empty and the calls compile away.
+//
+//   GLTrace trace;
+//   trace.checkErrors(true);   // glGetError after every call
+//   while (...)
+//   {
+//       trace.beginFrame();
+//       ... draw ...
+//       trace.endFrame();
+//   }
+//   trace.report(stderr, 15);
+#ifdef GLAD_TRACE
+class GLTrace
+{
+public:
+    void checkErrors(bool on) { glad_trace_check_errors = on ? 1 : 0; }
+
+    void beginFrame()
+    {
+        if (frames == 0 && totals.empty())
+        {
+            totals.resize(glad_trace_entry_count);
+            firstTicks = glad_trace_ticks();
+            firstTime = std::chrono::steady_clock::now();
+        }
+        glad_trace_reset();
+        frameStart = std::chrono::steady_clock::now();
+    }
+
+    void endFrame()
+    {
+        frameTime += std::chrono::steady_clock::now() - frameStart;
+        for (int i = 0; i < glad_trace_touched_count; i++)
+        {
+            int id = glad_trace_touched[i];
+            const GLADtraceentry& entry = glad_trace_entries[id];
+            Total& total = totals[id];
+            total.calls += entry.calls;
+            total.ticks += entry.ticks;
+            for (int b = 0; b < GLAD_TRACE_BUCKETS; b++)
+                total.histogram[b] += entry.histogram[b];
+        }
+        glad_trace_reset();
+        frames++;
+    }
+
+    // the top entry points by time a frame, then forgets the frames so far
+    void report(FILE* out, int top = 20)
+    {
+        if (frames == 0)
+            return;
+        std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - firstTime;
+        double nsPerTick = elapsed.count() / (double)(glad_trace_ticks() - firstTicks);
+
+        std::vector<int> ranked;
+        double glTicks = 0.0;
+        for (int id = 0; id < (int)totals.size(); id++)
+        {
+            if (totals[id].calls == 0)
+                continue;
+            ranked.push_back(id);
+            glTicks += (double)totals[id].ticks;
+        }
+        std::sort(ranked.begin(), ranked.end(), [&](int a, int b) { return totals[a].ticks > totals[b].ticks; });
+
+        double frameMs = std::chrono::duration<double, std::milli>(frameTime).count() / frames;
+        double glMs = glTicks * nsPerTick * 1e-6 / frames;
+        std::fprintf(out, "GL over %d frames: %.3f ms a frame in GL of %.3f ms (%.0f%%)\n", frames, glMs, frameMs,
+                     frameMs > 0.0 ? 100.0 * glMs / frameMs : 0.0);
+        std::fprintf(out, "  %-32s %12s %10s %6s %10s %10s\n", "entry point", "calls/frame", "us/frame", "share",
+                     "median us", "p99 us");
+        for (int i = 0; i < (int)ranked.size() && i < top; i++)
+        {
+            const Total& total = totals[ranked[i]];
+            double us = (double)total.ticks * nsPerTick * 1e-3 / frames;
+            std::fprintf(out, "  %-32s %12.1f %10.1f %5.1f%% %10.3f %10.3f\n", glad_trace_entries[ranked[i]].name,
+                         (double)total.calls / frames, us, glTicks > 0.0 ? 100.0 * total.ticks / glTicks : 0.0,
+                         percentile(total, 0.5) * nsPerTick * 1e-3, percentile(total, 0.99) * nsPerTick * 1e-3);
+        }
+
+        std::fill(totals.begin(), totals.end(), Total());
+        frames = 0;
+        frameTime = std::chrono::steady_clock::duration::zero();
+    }
+
+private:
+    struct Total
+    {
+        unsigned long long calls = 0;
+        unsigned long long ticks = 0;
+        unsigned long long histogram[GLAD_TRACE_BUCKETS] = {};
+    };
+
+    std::vector<Total> totals;
+    int frames = 0;
+    unsigned long long firstTicks = 0;
+    std::chrono::steady_clock::time_point firstTime, frameStart;
+    std::chrono::steady_clock::duration frameTime = std::chrono::steady_clock::duration::zero();
+
+    // the upper end, in ticks, of the histogram bucket holding the quantile
+    static double percentile(const Total& total, double quantile)
+    {
+        unsigned long long seen = 0, wanted = (unsigned long long)(quantile * total.calls);
+        for (int b = 0; b < GLAD_TRACE_BUCKETS; b++)
+        {
+            seen += total.histogram[b];
+            if (seen > wanted)
+                return (double)(2ull << b);
+        }
+        return (double)(2ull << (GLAD_TRACE_BUCKETS - 1));
+    }
+};
+#else
+class GLTrace
+{
+public:
+    void checkErrors(bool) {}
+    void beginFrame() {}
+    void endFrame() {}
+    void report(FILE*, int = 20) {}
+};
+#endif
+
+#endif
@@ -0,0 +1,345 @@
+#ifndef GPU_RESOURCES_H
+#define GPU_RESOURCES_H
+
+#include <glad/glad.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <unordered_map>
+#include <vector>
+
+// What a GPU allocation is for; bytes are counted per category.
+enum GpuCategory {
+    GPU_VERTICES,
+    GPU_INSTANCES,
+    GPU_INDICES,
+    GPU_UNIFORMS,
+    GPU_TEXTURES,
+    GPU_RENDER_TARGETS,
+    GPU_PROGRAMS,
+    GPU_VERTEX_ARRAYS,
+    GPU_CATEGORY_COUNT
+};
+
+const char* const GPU_CATEGORY_NAMES[GPU_CATEGORY_COUNT] = {
+    "vertices", "instances", "indices", "uniforms", "textures", "render targets", "programs", "vertex arrays"
+};
+
+enum GpuObjectType { GPU_BUFFER, GPU_VERTEX_ARRAY, GPU_TEXTURE, GPU_PROGRAM };
+
+const char* const GPU_OBJECT_NAMES[] = { "buffer", "vertex array", "texture", "program" };
+
+// A GL object owned by exactly one handle. It can be moved but not copied,
+// and it goes back to gpuResources() when the handle is destroyed, reset or
+// assigned over. Handles come from the GpuResources create functions.
+template <GpuObjectType T>
+class GpuHandle
+{
+public:
+    GpuHandle() {}
+    ~GpuHandle() { reset(); }
+
+    GpuHandle(GpuHandle&& other) noexcept : name(other.name) { other.name = 0; }
+    GpuHandle& operator=(GpuHandle&& other) noexcept
+    {
+        if (this != &other)
+        {
+            reset();
+            name = other.name;
+            other.name = 0;
+        }
+        return *this;
+    }
+
+    GpuHandle(const GpuHandle&) = delete;
+    GpuHandle& operator=(const GpuHandle&) = delete;
+
+    GLuint id() const { return name; }
+    explicit operator bool() const { return name != 0; }
+
+    void reset();
+
+private:
+    friend class GpuResources;
+    explicit GpuHandle(GLuint name) : name(name) {}
+
+    GLuint name = 0;
+};
+
+typedef GpuHandle<GPU_BUFFER> GpuBuffer;
+typedef GpuHandle<GPU_VERTEX_ARRAY> GpuVertexArray;
+typedef GpuHandle<GPU_TEXTURE> GpuTexture;
+typedef GpuHandle<GPU_PROGRAM> GpuProgram;
+
+// Creates the buffers, vertex arrays, textures and programs behind the
+// handles, and keeps a record of every live one: its category, its bytes
+// and a label for the reports. Names are generated in batches. A mutable
+// buffer that is released has its storage orphaned and its name reused.
+// Static data goes into immutable storage (glBufferStorage) when the
+// context has it, so the driver can place it once and never track writes.
+//
+// Labels are not copied, pass string literals. Everything runs on the GL
+// thread.
+//
+//   GpuVertexArray vao = gpuResources().createVertexArray("quad");
+//   glBindVertexArray(vao.id());
+//   GpuBuffer vbo = gpuResources().createStaticBuffer(GPU_VERTICES, GL_ARRAY_BUFFER, sizeof(v), v, "quad");
+//   ...
+//   gpuResources().report(stdout);
+//   ... before the context goes away, once the owners are destroyed:
+//   shaderCache().clear();
+//   gpuResources().shutdown();   // prints every resource still alive
+class GpuResources
+{
+public:
+    // bound to target, filled once and never written again
+    GpuBuffer createStaticBuffer(GpuCategory category, GLenum target, GLsizeiptr bytes, const void* data, const char* label)
+    {
+        GLuint name = generate(GPU_BUFFER);
+        glBindBuffer(target, name);
+        bool immutable = GLAD_GL_VERSION_4_4 || GLAD_GL_ARB_buffer_storage;
+        if (immutable)
+            glBufferStorage(target, bytes, data, 0);
+        else
+            glBufferData(target, bytes, data, GL_STATIC_DRAW);
+        track(GPU_BUFFER, name, category, (size_t)bytes, label, immutable);
+        return GpuBuffer(name);
+    }
+
+    // bound to target, respecified or rewritten while it lives; data may be NULL
+    GpuBuffer createDynamicBuffer(GpuCategory category, GLenum target, GLsizeiptr bytes, const void* data, GLenum usage,
+                                  const char* label)
+    {
+        GLuint name = generate(GPU_BUFFER);
+        glBindBuffer(target, name);
+        glBufferData(target, bytes, data, usage);
+        track(GPU_BUFFER, name, category, (size_t)bytes, label, false);
+        return GpuBuffer(name);
+    }
+
+    // new storage for a dynamic buffer bound to target, to grow or orphan it
+    void respecify(const GpuBuffer& buffer, GLenum target, GLsizeiptr bytes, const void* data, GLenum usage)
+    {
+        glBufferData(target, bytes, data, usage);
+        resize(GPU_BUFFER, buffer.id(), (size_t)bytes);
+    }
+
+    GpuVertexArray createVertexArray(const char* label)
+    {
+        GLuint name = generate(GPU_VERTEX_ARRAY);
+        track(GPU_VERTEX_ARRAY, name, GPU_VERTEX_ARRAYS, 0, label, false);
+        return GpuVertexArray(name);
+    }
+
+    // bound to target; its storage is specified by the caller, who reports
+    // the bytes with setTextureBytes
+    GpuTexture createTexture(GpuCategory category, GLenum target, const char* label)
+    {
+        GLuint name = generate(GPU_TEXTURE);
+        glBindTexture(target, name);
+        track(GPU_TEXTURE, name, category, 0, label, false);
+        return GpuTexture(name);
+    }
+
+    void setTextureBytes(const GpuTexture& texture, size_t bytes) { resize(GPU_TEXTURE, texture.id(), bytes); }
+
+    // takes over a linked program; its size is the length of its binary where
+    // the driver reports one
+    GpuProgram adoptProgram(GLuint program, const char* label)
+    {
+        GLint binaryLength = 0;
+        if (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_get_program_binary)
+            glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
+        track(GPU_PROGRAM, program, GPU_PROGRAMS, (size_t)binaryLength, label, true);
+        return GpuProgram(program);
+    }
+
+    size_t bytes(GpuCategory category) const { return categories[category].bytes; }
+    size_t count(GpuCategory category) const { return categories[category].count; }
+    size_t totalBytes() const
+    {
+        size_t total = 0;
+        for (const Usage& usage : categories)
+            total += usage.bytes;
+        return total;
+    }
+    size_t liveCount() const { return records.size(); }
+
+    // live objects and bytes by category, with the peak bytes of each
+    void report(FILE* out) const
+    {
+        std::fprintf(out, "GPU memory: %zu objects, %.1f KB\n", records.size(), totalBytes() / 1024.0);
+        for (int c = 0; c < GPU_CATEGORY_COUNT; c++)
+        {
+            const Usage& usage = categories[c];
+            if (usage.count == 0 && usage.peakBytes == 0)
+                continue;
+            std::fprintf(out, "  %-16s %6zu objects %10.1f KB   peak %10.1f KB\n", GPU_CATEGORY_NAMES[c], usage.count,
+                         usage.bytes / 1024.0, usage.peakBytes / 1024.0);
+        }
+    }
+
+    // Prints every object still alive as a leak and deletes the pooled
+    // names; returns the number of leaks. Call it before the context goes
+    // away. Handles released afterwards, by destructors at exit, are only
+    // forgotten, without any GL calls.
+    size_t shutdown()
+    {
+        for (const auto& r : records)
+        {
+            const Record& record = r.second;
+            std::cout << "ERROR::GPU_RESOURCES::LEAK " << GPU_OBJECT_NAMES[r.first >> 32] << " " << (GLuint)r.first
+                      << " (" << GPU_CATEGORY_NAMES[record.category] << ", " << record.bytes << " B) " << record.label << std::endl;
+        }
+        if (!freeNames[GPU_BUFFER].empty())
+            glDeleteBuffers((GLsizei)freeNames[GPU_BUFFER].size(), freeNames[GPU_BUFFER].data());
+        if (!freeNames[GPU_VERTEX_ARRAY].empty())
+            glDeleteVertexArrays((GLsizei)freeNames[GPU_VERTEX_ARRAY].size(), freeNames[GPU_VERTEX_ARRAY].data());
+        if (!freeNames[GPU_TEXTURE].empty())
+            glDeleteTextures((GLsizei)freeNames[GPU_TEXTURE].size(), freeNames[GPU_TEXTURE].data());
+        for (std::vector<GLuint>& names : freeNames)
+            names.clear();
+        closed = true;
+        return records.size();
+    }
+
+    // hands the object back: a mutable buffer to the pool, anything else to GL
+    template <GpuObjectType T>
+    void release(GpuHandle<T>& handle)
+    {
+        GLuint name = handle.name;
+        handle.name = 0;
+        auto it = records.find(key(T, name));
+        if (it == records.end())
+            return;
+        bool immutable = it->second.immutable;
+        untrack(it);
+        if (closed)
+            return;
+        switch (T)
+        {
+        case GPU_BUFFER:
+            if (immutable)
+            {
+                glDeleteBuffers(1, &name);
+                break;
+            }
+            // orphan the storage, the name keeps its buffer object for the next create
+            glBindBuffer(GL_COPY_WRITE_BUFFER, name);
+            glBufferData(GL_COPY_WRITE_BUFFER, 0, NULL, GL_STATIC_DRAW);
+            glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+            freeNames[GPU_BUFFER].push_back(name);
+            break;
+        case GPU_VERTEX_ARRAY:
+            glDeleteVertexArrays(1, &name);
+            break;
+        case GPU_TEXTURE:
+            glDeleteTextures(1, &name);
+            break;
+        case GPU_PROGRAM:
+            glDeleteProgram(name);
+            break;
+        }
+    }
+
+    // names generated against those recycled, for the pool's hit rate
+    size_t generatedNames() const { return generated; }
+    size_t recycledNames() const { return recycled; }
+
+private:
+    static const GLsizei NAME_BATCH = 32;
+
+    struct Record
+    {
+        GpuCategory category;
+        size_t bytes;
+        const char* label;
+        bool immutable;
+    };
+
+    struct Usage
+    {
+        size_t count = 0;
+        size_t bytes = 0;
+        size_t peakBytes = 0;
+    };
+
+    std::unordered_map<uint64_t, Record> records;
+    Usage categories[GPU_CATEGORY_COUNT];
+    // names without an object behind them yet, and released mutable buffers
+    std::vector<GLuint> freeNames[3];
+    size_t generated = 0, recycled = 0;
+    bool closed = false;
+
+    static uint64_t key(GpuObjectType type, GLuint name) { return (uint64_t)type << 32 | name; }
+
+    GLuint generate(GpuObjectType type)
+    {
+        closed = false;
+        std::vector<GLuint>& names = freeNames[type];
+        if (names.empty())
+        {
+            names.resize(NAME_BATCH);
+            if (type == GPU_BUFFER)
+                glGenBuffers(NAME_BATCH, names.data());
+            else if (type == GPU_VERTEX_ARRAY)
+                glGenVertexArrays(NAME_BATCH, names.data());
+            else
+                glGenTextures(NAME_BATCH, names.data());
+            generated += NAME_BATCH;
+        }
+        else
+        {
+            recycled++;
+        }
+        GLuint name = names.back();
+        names.pop_back();
+        return name;
+    }
+
+    void track(GpuObjectType type, GLuint name, GpuCategory category, size_t bytes, const char* label, bool immutable)
+    {
+        closed = false;
+        records[key(type, name)] = Record{ category, 0, label, immutable };
+        categories[category].count++;
+        resize(type, name, bytes);
+    }
+
+    void untrack(std::unordered_map<uint64_t, Record>::iterator it)
+    {
+        Usage& usage = categories[it->second.category];
+        usage.count--;
+        usage.bytes -= it->second.bytes;
+        records.erase(it);
+    }
+
+    void resize(GpuObjectType type, GLuint name, size_t bytes)
+    {
+        auto it = records.find(key(type, name));
+        if (it == records.end())
+            return;
+        Usage& usage = categories[it->second.category];
+        usage.bytes = usage.bytes - it->second.bytes + bytes;
+        usage.peakBytes = std::max(usage.peakBytes, usage.bytes);
+        it->second.bytes = bytes;
+    }
+};
+
+// process wide manager; never destroyed, so handles in static objects can
+// still release into it at exit
+inline GpuResources& gpuResources()
+{
+    static GpuResources* resources = new GpuResources();
+    return *resources;
+}
+
+template <GpuObjectType T>
+void GpuHandle<T>::reset()
+{
+    if (name)
+        gpuResources().release(*this);
+}
+
+#endif
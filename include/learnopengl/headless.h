@@ -0,0 +1,249 @@
+#ifndef HEADLESS_H
+#define HEADLESS_H
+
+#include <glad/glad.h>
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+// GL without a window: an EGL context on Mesa's surfaceless platform (which
+// is llvmpipe on a machine without a GPU), else on a pbuffer of the default
+// display, rendering into a framebuffer object that stands in for the
+// window's back buffer. Link with -lEGL.
+//
+//   HeadlessContext gl;
+//   if (!gl.create(512, 512)) return -1;
+//   ... draw as usual, gl.bind() after binding other framebuffers ...
+//   gl.readPixels(pixels);   // waits for the frame
+class HeadlessContext
+{
+public:
+    HeadlessContext() {}
+    ~HeadlessContext() { destroy(); }
+
+    HeadlessContext(const HeadlessContext&) = delete;
+    HeadlessContext& operator=(const HeadlessContext&) = delete;
+
+    // 3.3 core like the demos' windows ask for; loads glad and binds the target
+    bool create(int targetWidth, int targetHeight)
+    {
+        PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+        const char* clientExtensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+        bool surfaceless = getPlatformDisplay && clientExtensions && std::strstr(clientExtensions, "EGL_MESA_platform_surfaceless");
+        if (surfaceless)
+            display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+        if (display == EGL_NO_DISPLAY || !eglInitialize(display, NULL, NULL))
+        {
+            surfaceless = false;
+            display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+            if (display == EGL_NO_DISPLAY || !eglInitialize(display, NULL, NULL))
+            {
+                std::cout << "ERROR::HEADLESS::NO_EGL_DISPLAY" << std::endl;
+                return false;
+            }
+        }
+        if (!eglBindAPI(EGL_OPENGL_API))
+        {
+            std::cout << "ERROR::HEADLESS::NO_OPENGL_API" << std::endl;
+            return false;
+        }
+
+        const EGLint configAttributes[] = {
+            EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+            EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+            EGL_RED_SIZE, 8, EGL_GREEN_SIZE, 8, EGL_BLUE_SIZE, 8,
+            EGL_NONE
+        };
+        EGLConfig config;
+        EGLint configs = 0;
+        if (!eglChooseConfig(display, configAttributes, &config, 1, &configs) || configs == 0)
+        {
+            std::cout << "ERROR::HEADLESS::NO_EGL_CONFIG" << std::endl;
+            return false;
+        }
+        const EGLint contextAttributes[] = {
+            EGL_CONTEXT_MAJOR_VERSION, 3,
+            EGL_CONTEXT_MINOR_VERSION, 3,
+            EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+            EGL_NONE
+        };
+        context = eglCreateContext(display, config, EGL_NO_CONTEXT, contextAttributes);
+        if (context == EGL_NO_CONTEXT)
+        {
+            std::cout << "ERROR::HEADLESS::CONTEXT_CREATION_FAILED 0x" << std::hex << eglGetError() << std::dec << std::endl;
+            return false;
+        }
+        // the pbuffer is never drawn to, it only gives the context a surface
+        // where EGL_KHR_surfaceless_context is missing
+        const char* extensions = eglQueryString(display, EGL_EXTENSIONS);
+        if (!surfaceless && !(extensions && std::strstr(extensions, "EGL_KHR_surfaceless_context")))
+        {
+            const EGLint surfaceAttributes[] = { EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE };
+            surface = eglCreatePbufferSurface(display, config, surfaceAttributes);
+        }
+        if (!eglMakeCurrent(display, surface, surface, context))
+        {
+            std::cout << "ERROR::HEADLESS::MAKE_CURRENT_FAILED 0x" << std::hex << eglGetError() << std::dec << std::endl;
+            return false;
+        }
+        if (!gladLoadGLLoader((GLADloadproc)eglGetProcAddress))
+        {
+            std::cout << "ERROR::HEADLESS::GLAD_LOAD_FAILED" << std::endl;
+            return false;
+        }
+
+        glGenFramebuffers(1, &framebuffer);
+        glGenRenderbuffers(1, &colorBuffer);
+        glGenRenderbuffers(1, &depthBuffer);
+        return resize(targetWidth, targetHeight);
+    }
+
+    // like resizing the window: new storage for the target, contents undefined
+    bool resize(int targetWidth, int targetHeight)
+    {
+        width = targetWidth;
+        height = targetHeight;
+        glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+        glBindRenderbuffer(GL_RENDERBUFFER, colorBuffer);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, colorBuffer);
+        glBindRenderbuffer(GL_RENDERBUFFER, depthBuffer);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, depthBuffer);
+        glBindRenderbuffer(GL_RENDERBUFFER, 0);
+        if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+        {
+            std::cout << "ERROR::HEADLESS::FRAMEBUFFER_INCOMPLETE" << std::endl;
+            return false;
+        }
+        bind();
+        return true;
+    }
+
+    void destroy()
+    {
+        if (context != EGL_NO_CONTEXT)
+        {
+            glDeleteFramebuffers(1, &framebuffer);
+            glDeleteRenderbuffers(1, &colorBuffer);
+            glDeleteRenderbuffers(1, &depthBuffer);
+            framebuffer = colorBuffer = depthBuffer = 0;
+            eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+            eglDestroyContext(display, context);
+            context = EGL_NO_CONTEXT;
+        }
+        if (surface != EGL_NO_SURFACE)
+        {
+            eglDestroySurface(display, surface);
+            surface = EGL_NO_SURFACE;
+        }
+        if (display != EGL_NO_DISPLAY)
+        {
+            eglTerminate(display);
+            display = EGL_NO_DISPLAY;
+        }
+    }
+
+    // what the window's framebuffer 0 is for the demos
+    void bind()
+    {
+        glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+        glViewport(0, 0, width, height);
+    }
+
+    // RGBA8 (r in the low byte), bottom row first; returns once the frame
+    // has finished rendering
+    void readPixels(std::vector<uint32_t>& pixels)
+    {
+        pixels.resize((size_t)width * height);
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+        glPixelStorei(GL_PACK_ALIGNMENT, 4);
+        glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+    }
+
+    const char* renderer() const { return (const char*)glGetString(GL_RENDERER); }
+
+    int width = 0, height = 0;
+
+private:
+    EGLDisplay display = EGL_NO_DISPLAY;
+    EGLContext context = EGL_NO_CONTEXT;
+    EGLSurface surface = EGL_NO_SURFACE;
+    GLuint framebuffer = 0, colorBuffer = 0, depthBuffer = 0;
+};
+
+// Summary of per-frame times in milliseconds.
+struct FrameStats
+{
+    size_t frames = 0;
+    double minMs = 0.0, meanMs = 0.0, medianMs = 0.0, p95Ms = 0.0, p99Ms = 0.0, maxMs = 0.0;
+};
+
+inline FrameStats frameStats(std::vector<double> ms)
+{
+    FrameStats stats;
+    if (ms.empty())
+        return stats;
+    std::sort(ms.begin(), ms.end());
+    double sum = 0.0;
+    for (double m : ms)
+        sum += m;
+    // nearest rank percentiles
+    auto percentile = [&](double p) { return ms[std::min(ms.size() - 1, (size_t)(p * ms.size()))]; };
+    stats.frames = ms.size();
+    stats.minMs = ms.front();
+    stats.maxMs = ms.back();
+    stats.meanMs = sum / ms.size();
+    stats.medianMs = percentile(0.5);
+    stats.p95Ms = percentile(0.95);
+    stats.p99Ms = percentile(0.99);
+    return stats;
+}
+
+// FNV-1a over the pixels, to tell whether two runs rendered the same frame
+inline uint64_t frameChecksum(const std::vector<uint32_t>& pixels)
+{
+    uint64_t hash = 14695981039346656037ull;
+    for (uint32_t p : pixels)
+        for (int i = 0; i < 4; i++)
+        {
+            hash ^= (p >> (i * 8)) & 0xff;
+            hash *= 1099511628211ull;
+        }
+    return hash;
+}
+
+// binary PPM, top row first, alpha dropped
+inline bool writeFramePPM(const char* path, const std::vector<uint32_t>& pixels, int width, int height)
+{
+    FILE* file = std::fopen(path, "wb");
+    if (!file)
+    {
+        std::cout << "ERROR::HEADLESS::CANNOT_WRITE " << path << std::endl;
+        return false;
+    }
+    std::fprintf(file, "P6\n%d %d\n255\n", width, height);
+    std::vector<unsigned char> row((size_t)width * 3);
+    for (int y = height - 1; y >= 0; y--)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            uint32_t p = pixels[(size_t)y * width + x];
+            row[x * 3 + 0] = p & 0xff;
+            row[x * 3 + 1] = (p >> 8) & 0xff;
+            row[x * 3 + 2] = (p >> 16) & 0xff;
+        }
+        std::fwrite(row.data(), 1, row.size(), file);
+    }
+    std::fclose(file);
+    return true;
+}
+
+#endif
@@ -0,0 +1,93 @@
+#ifndef IMAGE_LOADER_H
+#define IMAGE_LOADER_H
+
+// the demo's translation unit may already have pulled in the implementation
+#ifndef STBI_INCLUDE_STB_IMAGE_H
+#include <stb_image.h>
+#endif
+
+#include <learnopengl/job_system.h>
+#include <learnopengl/mapped_file.h>
+#include <learnopengl/resource_pack.h>
+
+// stb_image parallel-for on the process job system; the calling thread runs
+// tasks too while it waits.
+inline void stbiJobParallelFor(void* user, int count, void (*task)(void* taskData, int index), void* taskData)
+{
+    (void)user;
+    jobSystem().parallelFor(0, (size_t)count, 1, [task, taskData](size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; i++)
+            task(taskData, (int)i);
+    });
+}
+
+// Encoded bytes of an image: its span of the resource pack when one is open,
+// else the mapped loose file. Also installs the parallel-for above, once.
+class ImageFile
+{
+public:
+    explicit ImageFile(const char* path)
+    {
+        static bool parallel = (stbi_set_parallel_for(stbiJobParallelFor, NULL), true);
+        (void)parallel;
+
+        ResourceSpan packed = findResource(path);
+        if (packed)
+        {
+            mData = packed.data;
+            mSize = packed.size;
+        }
+        else if (file.open(path))
+        {
+            mData = file.data();
+            mSize = file.size();
+        }
+    }
+
+    const stbi_uc* data() const { return (const stbi_uc*)mData; }
+    int size() const { return (int)mSize; }
+    bool empty() const { return mSize == 0; }
+
+private:
+    MappedFile file;
+    const char* mData = nullptr;
+    size_t mSize = 0;
+};
+
+// stbi_load on the mapped bytes. stb_image only splits JPEG restart intervals
+// across threads when it can see the whole stream, which it can't through the
+// FILE* reader stbi_load uses.
+inline unsigned char* loadImage(const char* path, int* width, int* height, int* channels, int desiredChannels = 0)
+{
+    ImageFile file(path);
+    if (file.empty())
+        return NULL;
+    return stbi_load_from_memory(file.data(), file.size(), width, height, channels, desiredChannels);
+}
+
+// Size in bytes loadImageInto needs for the file, 0 if it can't be read:
+// width * height * desiredChannels, or with desiredChannels 0 the channels
+// the decoder writes, which aren't always the file's own. A grey or RGB PNG
+// with a tRNS chunk decodes with an alpha channel, so it takes 2 or 4.
+inline size_t imageSize(const char* path, int desiredChannels = 0)
+{
+    ImageFile file(path);
+    int width, height, channels;
+    if (file.empty() || !stbi_info_from_memory(file.data(), file.size(), &width, &height, &channels))
+        return 0;
+    return (size_t)width * height * (desiredChannels ? desiredChannels : channels);
+}
+
+// Decodes into memory the caller owns, e.g. a pixel unpack buffer mapped with
+// glMapBufferRange, so the pixels aren't copied out of a temporary allocation.
+// outSize must be at least imageSize(path, desiredChannels); *channels gets
+// the count imageSize used when desiredChannels is 0.
+inline bool loadImageInto(const char* path, unsigned char* out, size_t outSize, int* width, int* height, int* channels, int desiredChannels = 0)
+{
+    ImageFile file(path);
+    if (file.empty())
+        return false;
+    return stbi_load_from_memory_into(file.data(), file.size(), out, (int)outSize, width, height, channels, desiredChannels) != 0;
+}
+#endif
@@ -0,0 +1,411 @@
+#ifndef INPUT_TRACE_H
+#define INPUT_TRACE_H
+
+#include <GLFW/glfw3.h>
+
+#include <learnopengl/mapped_file.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+// Records every key, mouse button, cursor and scroll event of a window into
+// a compact binary log, or plays such a log back through the same callbacks
+// with no one at the keyboard, as fast as the program runs. A program reads
+// the clock and the input state through the trace instead of GLFW, so a
+// replayed session makes exactly the decisions the recorded one made:
+//
+//   InputTrace input;                            // the callbacks use it too
+//   input.open(argc, argv);                      // --record <log> or --replay <log>
+//   ... create the window, input.windowHints() first ...
+//   ... set the callbacks, then input.attach(window) ...
+//   while (!glfwWindowShouldClose(window)) {
+//       input.pollEvents();                      // or waitEventsTimeout()
+//       float now = (float)input.time();         // for glfwGetTime()
+//       if (input.key(window, GLFW_KEY_W) == GLFW_PRESS) ...
+//
+// The log is a sequence of ticks, one per pollEvents() or
+// waitEventsTimeout(): the events that arrived during it, then the tick's
+// time in microseconds since attach(). Both the recording and the replaying
+// program see times and cursor positions rounded the way the log stores
+// them, so the two runs agree exactly.
+class InputTrace
+{
+public:
+    enum Mode { LIVE, RECORD, REPLAY };
+
+    InputTrace() {}
+    ~InputTrace() { close(); }
+
+    InputTrace(const InputTrace&) = delete;
+    InputTrace& operator=(const InputTrace&) = delete;
+
+    // picks the mode from --record <log> or --replay <log>; without them
+    // everything goes straight to GLFW
+    bool open(int argc, char** argv)
+    {
+        for (int i = 1; i + 1 < argc; i++)
+        {
+            if (std::strcmp(argv[i], "--record") == 0)
+                return record(argv[i + 1]);
+            if (std::strcmp(argv[i], "--replay") == 0)
+                return replay(argv[i + 1]);
+        }
+        return true;
+    }
+
+    bool record(const char* path)
+    {
+        close();
+        file = std::fopen(path, "wb");
+        if (!file)
+        {
+            std::cout << "ERROR::INPUT_TRACE::CANNOT_WRITE " << path << std::endl;
+            return false;
+        }
+        // the trace buffers itself; stdio's buffer would be allocated mid-run
+        std::setvbuf(file, NULL, _IONBF, 0);
+        std::fwrite(MAGIC, 1, sizeof(MAGIC), file);
+        restart();
+        mode = RECORD;
+        return true;
+    }
+
+    bool replay(const char* path)
+    {
+        close();
+        if (!log.open(path) || log.size() < sizeof(MAGIC) || std::memcmp(log.data(), MAGIC, sizeof(MAGIC)) != 0)
+        {
+            std::cout << "ERROR::INPUT_TRACE::NOT_A_LOG " << path << std::endl;
+            return false;
+        }
+        readAt = sizeof(MAGIC);
+        restart();
+        mode = REPLAY;
+        replayStart = std::chrono::steady_clock::now();
+        return true;
+    }
+
+    // a replay runs in a hidden window, call before glfwCreateWindow()
+    void windowHints()
+    {
+        if (mode == REPLAY)
+            glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    }
+
+    // Takes over the window's key, mouse button, cursor and scroll callbacks,
+    // which must be set by now. Recording logs each event before passing it
+    // on; replaying leaves the window with none and calls them from the log.
+    void attach(GLFWwindow* target)
+    {
+        window = target;
+        if (mode == LIVE)
+            return;
+        active = this;
+        keyCallback = glfwSetKeyCallback(window, mode == RECORD ? recordKey : NULL);
+        mouseButtonCallback = glfwSetMouseButtonCallback(window, mode == RECORD ? recordMouseButton : NULL);
+        cursorCallback = glfwSetCursorPosCallback(window, mode == RECORD ? recordCursor : NULL);
+        scrollCallback = glfwSetScrollCallback(window, mode == RECORD ? recordScroll : NULL);
+        if (mode == RECORD)
+        {
+            start = glfwGetTime();
+            double x, y;
+            glfwGetCursorPos(window, &x, &y);
+            cursorX = (float)x;
+            cursorY = (float)y;
+            put(CURSOR_STATE);
+            putFloat(cursorX);
+            putFloat(cursorY);
+        }
+        else
+        {
+            // every frame as soon as the last one is done
+            glfwSwapInterval(0);
+        }
+    }
+
+    // one tick, in place of glfwPollEvents()
+    void pollEvents() { waitEventsTimeout(0.0); }
+
+    // one tick, in place of glfwWaitEventsTimeout(); a replay never waits
+    void waitEventsTimeout(double timeout)
+    {
+        if (mode == REPLAY)
+        {
+            replayTick();
+            return;
+        }
+        if (timeout > 0.0)
+            glfwWaitEventsTimeout(timeout);
+        else
+            glfwPollEvents();
+        if (mode == RECORD)
+        {
+            uint64_t now = (uint64_t)std::llround((glfwGetTime() - start) * 1e6);
+            put(TICK);
+            putVarint(now - tickMicroseconds);
+            tickMicroseconds = now;
+            ticks++;
+        }
+    }
+
+    // in place of glfwGetTime(): the current tick's time when tracing
+    double time() const
+    {
+        if (mode == LIVE)
+            return glfwGetTime();
+        return tickMicroseconds * 1e-6;
+    }
+
+    // in place of glfwGetKey(), from the events seen so far when tracing
+    int key(GLFWwindow* target, int k) const
+    {
+        if (mode == LIVE)
+            return glfwGetKey(target, k);
+        return k >= 0 && k <= GLFW_KEY_LAST ? keys[k] : GLFW_RELEASE;
+    }
+
+    // in place of glfwGetCursorPos()
+    void cursorPos(GLFWwindow* target, double* x, double* y) const
+    {
+        if (mode == LIVE)
+        {
+            glfwGetCursorPos(target, x, y);
+            return;
+        }
+        *x = cursorX;
+        *y = cursorY;
+    }
+
+    // writes out the rest of a recording, reports a finished replay
+    void close()
+    {
+        if (file)
+        {
+            flush();
+            std::fclose(file);
+            file = NULL;
+        }
+        log.close();
+        if (active == this)
+            active = NULL;
+        mode = LIVE;
+    }
+
+    Mode traceMode() const { return mode; }
+    unsigned long tickCount() const { return ticks; }
+
+private:
+    enum Record : uint8_t { TICK = 1, KEY, MOUSE_BUTTON, CURSOR, SCROLL, CURSOR_STATE };
+    static constexpr char MAGIC[8] = { 'L', 'O', 'G', 'L', 'I', 'N', 'P', '1' };
+    static constexpr size_t BUFFER_SIZE = 64 * 1024;
+
+    static inline InputTrace* active = NULL;
+
+    Mode mode = LIVE;
+    GLFWwindow* window = NULL;
+    GLFWkeyfun keyCallback = NULL;
+    GLFWmousebuttonfun mouseButtonCallback = NULL;
+    GLFWcursorposfun cursorCallback = NULL;
+    GLFWscrollfun scrollCallback = NULL;
+    double start = 0.0;
+    uint64_t tickMicroseconds = 0;
+    unsigned long ticks = 0;
+    unsigned char keys[GLFW_KEY_LAST + 1] = {};
+    float cursorX = 0.0f, cursorY = 0.0f;
+
+    // recording goes through a fixed buffer, so it never allocates
+    FILE* file = NULL;
+    unsigned char buffer[BUFFER_SIZE];
+    size_t buffered = 0;
+
+    MappedFile log;
+    size_t readAt = 0;
+    bool finished = false;
+    std::chrono::steady_clock::time_point replayStart;
+
+    void restart()
+    {
+        tickMicroseconds = 0;
+        ticks = 0;
+        std::memset(keys, GLFW_RELEASE, sizeof(keys));
+        cursorX = cursorY = 0.0f;
+        finished = false;
+    }
+
+    void flush()
+    {
+        std::fwrite(buffer, 1, buffered, file);
+        buffered = 0;
+    }
+
+    void put(uint8_t byte)
+    {
+        if (buffered == BUFFER_SIZE)
+            flush();
+        buffer[buffered++] = byte;
+    }
+
+    void putVarint(uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            put((uint8_t)(value | 0x80));
+            value >>= 7;
+        }
+        put((uint8_t)value);
+    }
+
+    // small negative numbers (GLFW_KEY_UNKNOWN) stay one byte
+    void putSigned(int value) { putVarint(((uint64_t)(int64_t)value << 1) ^ (uint64_t)((int64_t)value >> 63)); }
+
+    void putFloat(float value)
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &value, 4);
+        for (int i = 0; i < 4; i++)
+            put((uint8_t)(bits >> (i * 8)));
+    }
+
+    bool more() const { return readAt < log.size(); }
+    uint8_t get() { return more() ? (uint8_t)log.data()[readAt++] : 0; }
+
+    uint64_t getVarint()
+    {
+        uint64_t value = 0;
+        for (int shift = 0; more() && shift < 64; shift += 7)
+        {
+            uint8_t byte = get();
+            value |= (uint64_t)(byte & 0x7f) << shift;
+            if (!(byte & 0x80))
+                break;
+        }
+        return value;
+    }
+
+    int getSigned()
+    {
+        uint64_t v = getVarint();
+        return (int)(int64_t)((v >> 1) ^ (~(v & 1) + 1));
+    }
+
+    float getFloat()
+    {
+        uint32_t bits = 0;
+        for (int i = 0; i < 4; i++)
+            bits |= (uint32_t)get() << (i * 8);
+        float value;
+        std::memcpy(&value, &bits, 4);
+        return value;
+    }
+
+    // delivers the events of the next tick, then moves the clock to it
+    void replayTick()
+    {
+        while (more())
+        {
+            uint8_t type = get();
+            if (type == TICK)
+            {
+                tickMicroseconds += getVarint();
+                ticks++;
+                return;
+            }
+            if (type == KEY)
+            {
+                int k = getSigned(), scancode = getSigned(), action = get(), mods = get();
+                setKey(k, action);
+                if (keyCallback)
+                    keyCallback(window, k, scancode, action, mods);
+            }
+            else if (type == MOUSE_BUTTON)
+            {
+                int button = get(), action = get(), mods = get();
+                if (mouseButtonCallback)
+                    mouseButtonCallback(window, button, action, mods);
+            }
+            else if (type == CURSOR || type == CURSOR_STATE)
+            {
+                cursorX = getFloat();
+                cursorY = getFloat();
+                if (type == CURSOR && cursorCallback)
+                    cursorCallback(window, cursorX, cursorY);
+            }
+            else if (type == SCROLL)
+            {
+                float x = getFloat(), y = getFloat();
+                if (scrollCallback)
+                    scrollCallback(window, x, y);
+            }
+            else
+            {
+                std::cout << "ERROR::INPUT_TRACE::BAD_RECORD " << (int)type << std::endl;
+                readAt = log.size();
+            }
+        }
+        // the log is over: report how long it took and end the program
+        if (finished)
+            return;
+        finished = true;
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - replayStart;
+        std::printf("{\"replay_ticks\":%lu,\"recorded_s\":%.3f,\"replayed_s\":%.3f}\n", ticks, tickMicroseconds * 1e-6, elapsed.count());
+        glfwSetWindowShouldClose(window, true);
+    }
+
+    void setKey(int k, int action)
+    {
+        if (k >= 0 && k <= GLFW_KEY_LAST)
+            keys[k] = action == GLFW_RELEASE ? GLFW_RELEASE : GLFW_PRESS;
+    }
+
+    static void recordKey(GLFWwindow* w, int k, int scancode, int action, int mods)
+    {
+        InputTrace& t = *active;
+        t.put(KEY);
+        t.putSigned(k);
+        t.putSigned(scancode);
+        t.put((uint8_t)action);
+        t.put((uint8_t)mods);
+        t.setKey(k, action);
+        if (t.keyCallback)
+            t.keyCallback(w, k, scancode, action, mods);
+    }
+
+    static void recordMouseButton(GLFWwindow* w, int button, int action, int mods)
+    {
+        InputTrace& t = *active;
+        t.put(MOUSE_BUTTON);
+        t.put((uint8_t)button);
+        t.put((uint8_t)action);
+        t.put((uint8_t)mods);
+        if (t.mouseButtonCallback)
+            t.mouseButtonCallback(w, button, action, mods);
+    }
+
+    static void recordCursor(GLFWwindow* w, double x, double y)
+    {
+        InputTrace& t = *active;
+        t.cursorX = (float)x;
+        t.cursorY = (float)y;
+        t.put(CURSOR);
+        t.putFloat(t.cursorX);
+        t.putFloat(t.cursorY);
+        if (t.cursorCallback)
+            t.cursorCallback(w, t.cursorX, t.cursorY);
+    }
+
+    static void recordScroll(GLFWwindow* w, double x, double y)
+    {
+        InputTrace& t = *active;
+        t.put(SCROLL);
+        t.putFloat((float)x);
+        t.putFloat((float)y);
+        if (t.scrollCallback)
+            t.scrollCallback(w, (float)x, (float)y);
+    }
+};
+
+#endif
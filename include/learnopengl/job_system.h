@@ -0,0 +1,543 @@
+#ifndef JOB_SYSTEM_H
+#define JOB_SYSTEM_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#if defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64)
+#include <immintrin.h>
+#define JOB_SYSTEM_PAUSE() _mm_pause()
+#else
+#define JOB_SYSTEM_PAUSE() std::this_thread::yield()
+#endif
+
+// Work stealing job system. Every worker and the owner thread (the one that
+// created the system, which holds the GL context in the demos) has a
+// Chase-Lev deque: it pushes and pops jobs at the bottom, idle threads steal
+// from the top of the others'. Jobs run to completion; waiting on a counter
+// runs other jobs instead of blocking, so jobs may wait on jobs they spawn.
+//
+//   JobCounter done;
+//   jobs.run(done, [&]() { decode(a); });
+//   jobs.run(done, [&]() { decode(b); });
+//   jobs.runOnMain(done, [&]() { glTexImage2D(...); });   // owner thread only
+//   jobs.wait(done);
+//
+//   jobs.parallelFor(0, count, 1024, [&](size_t begin, size_t end) { ... });
+
+class JobSystem;
+struct JobCounter;
+
+const size_t JOB_PAYLOAD_SIZE = 64;
+const size_t JOB_RING_SIZE = 4096;
+
+struct Job
+{
+    void (*function)(Job&);
+    void (*destroy)(Job&);
+    JobCounter* counter;
+    std::atomic<bool> busy{false};
+    bool heap;
+    alignas(16) unsigned char payload[JOB_PAYLOAD_SIZE];
+};
+
+// Number of jobs still to finish. Jobs added with the counter raise it and
+// lower it when they are done; an optional continuation is queued the moment
+// it reaches zero. A counter must outlive its jobs: wait on it, or on the
+// counter of its continuation, before it goes out of scope.
+struct JobCounter
+{
+    std::atomic<int> pending{0};
+    std::atomic<Job*> continuation{nullptr};
+    // threads still inside finish(); the counter may live on a waiter's
+    // stack, so it only counts as done once nobody touches it anymore
+    std::atomic<int> finishing{0};
+
+    JobCounter() {}
+    JobCounter(const JobCounter&) = delete;
+    JobCounter& operator=(const JobCounter&) = delete;
+
+    bool done() const { return pending.load() == 0 && finishing.load() == 0; }
+};
+
+// Chase-Lev deque (Le, Pop, Cohen, Zappa Nardelli, "Correct and Efficient
+// Work-Stealing for Weak Memory Models"). push/pop from the owner only,
+// steal from any thread. Rings that were outgrown stay alive until the deque
+// dies, a thief may still be reading one.
+class JobDeque
+{
+public:
+    JobDeque() : ring(new Ring(256)) {}
+    ~JobDeque()
+    {
+        delete ring.load(std::memory_order_relaxed);
+        for (Ring* r : retired)
+            delete r;
+    }
+
+    JobDeque(const JobDeque&) = delete;
+    JobDeque& operator=(const JobDeque&) = delete;
+
+    void push(Job* job)
+    {
+        int64_t b = bottom.load(std::memory_order_relaxed);
+        int64_t t = top.load(std::memory_order_acquire);
+        Ring* r = ring.load(std::memory_order_relaxed);
+        if (b - t > (int64_t)r->mask)
+            r = grow(r, t, b);
+        r->put(b, job);
+        bottom.store(b + 1, std::memory_order_release);
+    }
+
+    Job* pop()
+    {
+        int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+        Ring* r = ring.load(std::memory_order_relaxed);
+        // seq_cst store then load: a thief must see the claim on b before
+        // this thread reads top
+        bottom.store(b, std::memory_order_seq_cst);
+        int64_t t = top.load(std::memory_order_seq_cst);
+        if (t > b)
+        {
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        Job* job = r->get(b);
+        if (t == b)
+        {
+            // last job, race the thieves for it
+            if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                job = nullptr;
+            bottom.store(b + 1, std::memory_order_relaxed);
+        }
+        return job;
+    }
+
+    Job* steal()
+    {
+        int64_t t = top.load(std::memory_order_seq_cst);
+        int64_t b = bottom.load(std::memory_order_seq_cst);
+        if (t >= b)
+            return nullptr;
+        Ring* r = ring.load(std::memory_order_acquire);
+        Job* job = r->get(t);
+        if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            return nullptr;
+        return job;
+    }
+
+    bool empty() const
+    {
+        return bottom.load(std::memory_order_relaxed) <= top.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct Ring
+    {
+        size_t mask;
+        std::atomic<Job*>* slots;
+
+        explicit Ring(size_t capacity) : mask(capacity - 1), slots(new std::atomic<Job*>[capacity]) {}
+        ~Ring() { delete[] slots; }
+
+        Job* get(int64_t i) const { return slots[(size_t)i & mask].load(std::memory_order_relaxed); }
+        void put(int64_t i, Job* job) { slots[(size_t)i & mask].store(job, std::memory_order_relaxed); }
+    };
+
+    alignas(64) std::atomic<int64_t> top{0};
+    alignas(64) std::atomic<int64_t> bottom{0};
+    std::atomic<Ring*> ring;
+    std::vector<Ring*> retired;
+
+    Ring* grow(Ring* old, int64_t t, int64_t b)
+    {
+        Ring* r = new Ring((old->mask + 1) * 2);
+        for (int64_t i = t; i < b; i++)
+            r->put(i, old->get(i));
+        retired.push_back(old);
+        ring.store(r, std::memory_order_release);
+        return r;
+    }
+};
+
+class JobSystem
+{
+public:
+    // workerThreads extra threads beside the owner; pinThreads binds thread i
+    // to CPU i (Linux), the owner to CPU 0
+    explicit JobSystem(unsigned workerThreads = defaultWorkerCount(), bool pinThreads = false)
+        : owner(std::this_thread::get_id()), contexts(workerThreads + 1)
+    {
+        if (pinThreads)
+            pinCurrentThread(0);
+        for (unsigned i = 1; i <= workerThreads; i++)
+            threads.emplace_back([this, i, pinThreads]() { workerLoop(i, pinThreads); });
+    }
+
+    ~JobSystem()
+    {
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            quit.store(true, std::memory_order_release);
+        }
+        sleepCondition.notify_all();
+        for (std::thread& t : threads)
+            t.join();
+        for (Context& c : contexts)
+            for (Job& job : c.jobs)
+                if (job.busy.load(std::memory_order_relaxed) && job.destroy)
+                    job.destroy(job);
+    }
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    static unsigned defaultWorkerCount()
+    {
+        unsigned n = std::thread::hardware_concurrency();
+        return n > 1 ? n - 1 : 0;
+    }
+
+    // owner plus workers
+    unsigned threadCount() const { return (unsigned)contexts.size(); }
+    bool isOwnerThread() const { return std::this_thread::get_id() == owner; }
+
+    // queues fn() on the calling thread's deque, where other threads can steal it
+    template<typename F>
+    void run(JobCounter& counter, F&& fn)
+    {
+        submit(make(counter, std::forward<F>(fn)));
+    }
+
+    // queues fn() for the owner thread, e.g. GL calls; it runs inside the
+    // owner's wait() or runOwnerJobs()
+    template<typename F>
+    void runOnMain(JobCounter& counter, F&& fn)
+    {
+        pushShared(ownerQueue, make(counter, std::forward<F>(fn)));
+    }
+
+    // runs fn() once counter reaches zero, counting it on next
+    template<typename F>
+    void then(JobCounter& counter, JobCounter& next, F&& fn)
+    {
+        Job* job = make(next, std::forward<F>(fn));
+        // hold the counter so it can't reach zero before the continuation is set
+        counter.pending.fetch_add(1, std::memory_order_relaxed);
+        Job* previous = counter.continuation.exchange(job, std::memory_order_acq_rel);
+        if (previous)
+        {
+            std::cout << "ERROR::JOB_SYSTEM::CONTINUATION_ALREADY_SET" << std::endl;
+            submit(previous);
+        }
+        finish(counter);
+    }
+
+    // Runs queued jobs until counter reaches zero.
+    void wait(JobCounter& counter)
+    {
+        int index = contextIndex();
+        unsigned idle = 0;
+        while (!counter.done())
+        {
+            if (runOne(index))
+                idle = 0;
+            else if (++idle < 64)
+                JOB_SYSTEM_PAUSE();
+            else
+                std::this_thread::yield();
+        }
+    }
+
+    // fn(begin, end) over [begin, end) in pieces of at most grain items. The
+    // range is halved recursively, so thieves take the biggest pieces left.
+    template<typename F>
+    void parallelFor(size_t begin, size_t end, size_t grain, const F& fn)
+    {
+        if (grain == 0)
+            grain = 1;
+        JobCounter counter;
+        split(counter, begin, end, grain, &fn);
+        wait(counter);
+    }
+
+    // drains the jobs queued with runOnMain; call from the owner's loop when
+    // it isn't waiting anyway
+    void runOwnerJobs()
+    {
+        while (Job* job = popShared(ownerQueue))
+            execute(job);
+    }
+
+private:
+    struct Context
+    {
+        JobDeque deque;
+        Job jobs[JOB_RING_SIZE];
+        size_t next = 0;
+    };
+
+    std::thread::id owner;
+    std::vector<Context> contexts;
+    std::vector<std::thread> threads;
+
+    struct SharedQueue
+    {
+        std::mutex mutex;
+        std::vector<Job*> jobs;
+        std::atomic<size_t> size{0};
+    };
+    SharedQueue ownerQueue;
+    SharedQueue injected;
+
+    std::atomic<bool> quit{false};
+    std::atomic<int> sleepers{0};
+    std::mutex sleepMutex;
+    std::condition_variable sleepCondition;
+
+    static const JobSystem*& currentSystem()
+    {
+        thread_local const JobSystem* system = nullptr;
+        return system;
+    }
+    static int& currentWorker()
+    {
+        thread_local int worker = -1;
+        return worker;
+    }
+    static uint32_t& stealSeed()
+    {
+        thread_local uint32_t seed = (uint32_t)std::hash<std::thread::id>()(std::this_thread::get_id());
+        return seed;
+    }
+
+    // 0 for the owner, 1.. for workers, -1 for any other thread
+    int contextIndex() const
+    {
+        if (currentSystem() == this)
+            return currentWorker();
+        return isOwnerThread() ? 0 : -1;
+    }
+
+    static void pinCurrentThread(unsigned cpu)
+    {
+#ifdef __linux__
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu % CPU_SETSIZE, &set);
+        pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+        (void)cpu;
+#endif
+    }
+
+    template<typename F>
+    Job* make(JobCounter& counter, F&& fn)
+    {
+        typedef typename std::decay<F>::type Function;
+        static_assert(sizeof(Function) <= JOB_PAYLOAD_SIZE, "job captures too much, capture by reference or pointer");
+        static_assert(alignof(Function) <= 16, "job capture alignment");
+
+        Job* job = allocate();
+        new (job->payload) Function(std::forward<F>(fn));
+        job->function = [](Job& j) { (*(Function*)j.payload)(); };
+        job->destroy = nullptr;
+        if (!std::is_trivially_destructible<Function>::value)
+            job->destroy = [](Job& j) { ((Function*)j.payload)->~Function(); };
+        job->counter = &counter;
+        counter.pending.fetch_add(1, std::memory_order_relaxed);
+        return job;
+    }
+
+    // Jobs come from the calling thread's ring. A slot whose job hasn't
+    // finished yet is skipped by running other work until it has.
+    Job* allocate()
+    {
+        int index = contextIndex();
+        if (index < 0)
+        {
+            Job* job = new Job;
+            job->busy.store(true, std::memory_order_relaxed);
+            job->heap = true;
+            return job;
+        }
+        Context& c = contexts[index];
+        for (;;)
+        {
+            Job& job = c.jobs[c.next];
+            if (!job.busy.load(std::memory_order_acquire))
+            {
+                c.next = (c.next + 1) % JOB_RING_SIZE;
+                job.busy.store(true, std::memory_order_relaxed);
+                job.heap = false;
+                return &job;
+            }
+            if (!runOne(index))
+                JOB_SYSTEM_PAUSE();
+        }
+    }
+
+    void execute(Job* job)
+    {
+        job->function(*job);
+        if (job->destroy)
+            job->destroy(*job);
+        JobCounter* counter = job->counter;
+        if (job->heap)
+            delete job;
+        else
+            job->busy.store(false, std::memory_order_release);
+        finish(*counter);
+    }
+
+    void finish(JobCounter& counter)
+    {
+        counter.finishing.fetch_add(1);
+        Job* continuation = nullptr;
+        if (counter.pending.fetch_sub(1) == 1)
+        {
+            // let the other finishers leave first, once the continuation
+            // runs nothing may touch the counter anymore
+            while (counter.finishing.load() != 1)
+                JOB_SYSTEM_PAUSE();
+            continuation = counter.continuation.exchange(nullptr);
+        }
+        counter.finishing.fetch_sub(1);   // last access to the counter
+        if (continuation)
+            submit(continuation);
+    }
+
+    void submit(Job* job)
+    {
+        int index = contextIndex();
+        if (index >= 0)
+            contexts[index].deque.push(job);
+        else
+            pushShared(injected, job);
+        wake();
+    }
+
+    void wake()
+    {
+        if (sleepers.load(std::memory_order_relaxed) > 0)
+            sleepCondition.notify_one();
+    }
+
+    static void pushShared(SharedQueue& queue, Job* job)
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.jobs.push_back(job);
+        queue.size.store(queue.jobs.size(), std::memory_order_release);
+    }
+
+    static Job* popShared(SharedQueue& queue)
+    {
+        if (queue.size.load(std::memory_order_acquire) == 0)
+            return nullptr;
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.jobs.empty())
+            return nullptr;
+        Job* job = queue.jobs.back();
+        queue.jobs.pop_back();
+        queue.size.store(queue.jobs.size(), std::memory_order_release);
+        return job;
+    }
+
+    // own deque first, then owner jobs (owner only), shared jobs, and steals
+    // starting at a random victim
+    bool runOne(int index)
+    {
+        Job* job = nullptr;
+        if (index >= 0)
+            job = contexts[index].deque.pop();
+        if (!job && index == 0)
+            job = popShared(ownerQueue);
+        if (!job)
+            job = popShared(injected);
+        if (!job)
+        {
+            size_t count = contexts.size();
+            uint32_t& random = stealSeed();
+            random = random * 1664525u + 1013904223u;
+            size_t start = (random >> 8) % count;
+            for (size_t i = 0; i < count && !job; i++)
+            {
+                size_t victim = (start + i) % count;
+                if ((int)victim != index)
+                    job = contexts[victim].deque.steal();
+            }
+        }
+        if (!job)
+            return false;
+        execute(job);
+        return true;
+    }
+
+    void workerLoop(unsigned index, bool pin)
+    {
+        currentSystem() = this;
+        currentWorker() = (int)index;
+        if (pin)
+            pinCurrentThread(index);
+
+        unsigned idle = 0;
+        while (!quit.load(std::memory_order_acquire))
+        {
+            if (runOne((int)index))
+            {
+                idle = 0;
+                continue;
+            }
+            if (++idle < 256)
+            {
+                JOB_SYSTEM_PAUSE();
+                continue;
+            }
+            // nothing to steal for a while; sleep, waking up now and then in
+            // case a push raced with falling asleep
+            std::unique_lock<std::mutex> lock(sleepMutex);
+            sleepers.fetch_add(1, std::memory_order_relaxed);
+            if (!quit.load(std::memory_order_acquire))
+                sleepCondition.wait_for(lock, std::chrono::milliseconds(1));
+            sleepers.fetch_sub(1, std::memory_order_relaxed);
+            idle = 0;
+        }
+    }
+
+    template<typename F>
+    void split(JobCounter& counter, size_t begin, size_t end, size_t grain, const F* fn)
+    {
+        while (end - begin > grain)
+        {
+            size_t mid = begin + (end - begin) / 2;
+            run(counter, [this, &counter, mid, end, grain, fn]() { split(counter, mid, end, grain, fn); });
+            end = mid;
+        }
+        (*fn)(begin, end);
+    }
+};
+
+// Process wide job system with a worker per extra hardware thread. The first
+// call makes the calling thread its owner: call it from the GL thread.
+inline JobSystem& jobSystem()
+{
+    static JobSystem system;
+    return system;
+}
+#endif
@@ -0,0 +1,145 @@
+#ifndef LAYER_CACHE_H
+#define LAYER_CACHE_H
+
+#include <glad/glad.h>
+
+#include <glm/glm.hpp>
+
+#include <learnopengl/gpu_resources.h>
+
+#include <functional>
+#include <iostream>
+#include <vector>
+
+// The static layers of a 2D scene (the board's grid, background tiles)
+// rendered once into a texture and composited into the frame with a single
+// framebuffer blit. The layers share one cached image, so they are redrawn,
+// in the order they were added, only after invalidate() or when the viewport
+// changes size; every other frame costs one blit however much they draw.
+//
+//   LayerCache layers;
+//   layers.add([&]() { grid.draw(); });
+//   ... each frame, in place of glClear and the static draws:
+//   layers.composite();
+//   player.draw();
+class LayerCache
+{
+public:
+    LayerCache() {}
+    ~LayerCache() { destroy(); }
+
+    LayerCache(const LayerCache&) = delete;
+    LayerCache& operator=(const LayerCache&) = delete;
+
+    // what the cached image is cleared to before the layers draw
+    glm::vec4 clearColor = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+
+    // a layer draws with the same calls and projection it would use on the
+    // window; returns its index
+    size_t add(std::function<void()> draw)
+    {
+        layers.push_back(draw);
+        dirty = true;
+        return layers.size() - 1;
+    }
+
+    // an input of a layer changed, redraw them at the next composite()
+    void invalidate() { dirty = true; }
+
+    // Covers the viewport of the bound draw framebuffer with the layers,
+    // redrawing them first if they are invalid. Leaves the framebuffer
+    // bindings, viewport and clear color as they were.
+    void composite()
+    {
+        GLint viewport[4], drawTarget, readTarget;
+        glGetIntegerv(GL_VIEWPORT, viewport);
+        glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &drawTarget);
+        glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &readTarget);
+
+        if (viewport[2] != width || viewport[3] != height)
+        {
+            if (!resize(viewport[2], viewport[3]))
+                return;
+        }
+        if (dirty)
+        {
+            GLfloat previousClear[4];
+            glGetFloatv(GL_COLOR_CLEAR_VALUE, previousClear);
+            glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+            glViewport(0, 0, width, height);
+            glClearColor(clearColor.r, clearColor.g, clearColor.b, clearColor.a);
+            glClear(GL_COLOR_BUFFER_BIT);
+            for (const std::function<void()>& draw : layers)
+                draw();
+            glClearColor(previousClear[0], previousClear[1], previousClear[2], previousClear[3]);
+            glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+            dirty = false;
+            redraws++;
+        }
+
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, drawTarget);
+        glBlitFramebuffer(0, 0, width, height, viewport[0], viewport[1], viewport[0] + width, viewport[1] + height,
+                          GL_COLOR_BUFFER_BIT, GL_NEAREST);
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, readTarget);
+    }
+
+    void destroy()
+    {
+        if (framebuffer)
+        {
+            glDeleteFramebuffers(1, &framebuffer);
+            texture.reset();
+            framebuffer = 0;
+        }
+        width = height = 0;
+    }
+
+    // how often the layers have been drawn, against the number of frames
+    // composited this is the cache's miss count
+    unsigned int redrawCount() const { return redraws; }
+    GLuint colorTexture() const { return texture.id(); }
+
+private:
+    std::vector<std::function<void()>> layers;
+    GLuint framebuffer = 0;
+    GpuTexture texture;
+    int width = 0, height = 0;
+    bool dirty = true;
+    unsigned int redraws = 0;
+
+    bool resize(int newWidth, int newHeight)
+    {
+        width = newWidth;
+        height = newHeight;
+        dirty = true;
+
+        GLint previousTexture, previousFramebuffer;
+        glGetIntegerv(GL_TEXTURE_BINDING_2D, &previousTexture);
+        glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previousFramebuffer);
+        if (!framebuffer)
+        {
+            glGenFramebuffers(1, &framebuffer);
+            texture = gpuResources().createTexture(GPU_RENDER_TARGETS, GL_TEXTURE_2D, "layer cache");
+        }
+        glBindTexture(GL_TEXTURE_2D, texture.id());
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+        gpuResources().setTextureBytes(texture, (size_t)width * height * 4);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glBindTexture(GL_TEXTURE_2D, previousTexture);
+
+        glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture.id(), 0);
+        bool complete = glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+        glBindFramebuffer(GL_FRAMEBUFFER, previousFramebuffer);
+        if (!complete)
+        {
+            std::cout << "ERROR::LAYER_CACHE::FRAMEBUFFER_INCOMPLETE" << std::endl;
+            destroy();
+        }
+        return complete;
+    }
+};
+
+#endif
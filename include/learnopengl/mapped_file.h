@@ -0,0 +1,97 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef>
+#include <cstdio>
+
+#ifdef _WIN32
+#include <cstdlib>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+// A read-only view of a whole file. On POSIX the file is mmap'd so shader
+// text, images and resource packs are used straight from the page cache.
+class MappedFile
+{
+public:
+    MappedFile() {}
+    explicit MappedFile(const char* path) { open(path); }
+    ~MappedFile() { close(); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool open(const char* path)
+    {
+        close();
+#ifdef _WIN32
+        FILE* f = std::fopen(path, "rb");
+        if (!f)
+            return false;
+        std::fseek(f, 0, SEEK_END);
+        long len = std::ftell(f);
+        std::fseek(f, 0, SEEK_SET);
+        if (len > 0)
+        {
+            buffer = (char*)std::malloc(len);
+            mSize = std::fread(buffer, 1, len, f);
+            mData = buffer;
+        }
+        std::fclose(f);
+        return true;
+#else
+        int fd = ::open(path, O_RDONLY);
+        if (fd < 0)
+            return false;
+        struct stat st;
+        if (fstat(fd, &st) != 0)
+        {
+            ::close(fd);
+            return false;
+        }
+        mSize = (size_t)st.st_size;
+        if (mSize > 0)
+        {
+            void* p = mmap(NULL, mSize, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p == MAP_FAILED)
+            {
+                ::close(fd);
+                mSize = 0;
+                return false;
+            }
+            mData = (const char*)p;
+        }
+        // the mapping keeps the file alive, the descriptor is no longer needed
+        ::close(fd);
+        return true;
+#endif
+    }
+
+    void close()
+    {
+#ifdef _WIN32
+        std::free(buffer);
+        buffer = nullptr;
+#else
+        if (mData)
+            munmap((void*)mData, mSize);
+#endif
+        mData = nullptr;
+        mSize = 0;
+    }
+
+    const char* data() const { return mData; }
+    size_t size() const { return mSize; }
+
+private:
+    const char* mData = nullptr;
+    size_t mSize = 0;
+#ifdef _WIN32
+    char* buffer = nullptr;
+#endif
+};
+#endif
@@ -0,0 +1,91 @@
+#ifndef REDRAW_SCHEDULER_H
+#define REDRAW_SCHEDULER_H
+
+#include <algorithm>
+#include <limits>
+
+// Decides when an on-demand render loop draws. Input that changes the scene
+// invalidates it, an animation asks for frames at a fixed rate until it ends,
+// a timer asks for one frame at a given time; with none of those pending the
+// loop sleeps in the window system and neither the CPU nor the GPU does any
+// work. Times are seconds on the glfwGetTime() clock.
+//
+//   while (!glfwWindowShouldClose(window))
+//   {
+//       glfwWaitEventsTimeout(redraw.timeout(glfwGetTime()));
+//       if (!redraw.shouldDraw(glfwGetTime()))
+//           continue;
+//       ... draw and swap ...
+//   }
+class RedrawScheduler
+{
+public:
+    static constexpr double NEVER = std::numeric_limits<double>::infinity();
+
+    // frame rate while an animation runs
+    double frameInterval = 1.0 / 60.0;
+    // longest single wait, so a loop that is idle still checks in now and then
+    double idleTimeout = 1.0;
+    // draw on every iteration, the way the loops ran before
+    bool continuous = false;
+
+    // the scene changed, draw it as soon as possible
+    void invalidate() { dirty = true; }
+
+    // draw at the fixed rate until the given time, NEVER for an animation
+    // that runs until stopAnimation()
+    void animate(double until) { animationEnd = std::max(animationEnd, until); }
+    void stopAnimation() { animationEnd = -NEVER; dirty = true; }
+    bool animating(double now) const { return animationEnd > now; }
+
+    // draw once at the given time; only the earliest pending timer is kept
+    void wakeAt(double time) { timer = std::min(timer, time); }
+
+    // when the next frame is due; -NEVER for now, NEVER when nothing is pending
+    double nextFrame() const
+    {
+        if (continuous)
+            return -NEVER;
+        // a running animation, or one that ended after the last frame and
+        // still needs its final one; input and timers meanwhile wait for
+        // its next frame, so the fixed rate is never exceeded
+        if (animationEnd > lastDraw)
+            return std::min(lastDraw + frameInterval, animationEnd);
+        return dirty ? -NEVER : timer;
+    }
+
+    // how long the loop may block waiting for events before a frame is due
+    double timeout(double now) const
+    {
+        return std::max(0.0, std::min(nextFrame() - now, idleTimeout));
+    }
+
+    // true when a frame is due now; the loop is then expected to draw it, and
+    // the invalidation and timer it answers are cleared
+    bool shouldDraw(double now)
+    {
+        wakeups++;
+        if (now < nextFrame())
+            return false;
+        if (now >= timer)
+            timer = NEVER;
+        dirty = false;
+        lastDraw = now;
+        frames++;
+        return true;
+    }
+
+    // frames drawn and times the loop woke up, since the start
+    unsigned long frameCount() const { return frames; }
+    unsigned long wakeupCount() const { return wakeups; }
+
+private:
+    bool dirty = true;
+    double animationEnd = -NEVER;
+    double timer = NEVER;
+    double lastDraw = -NEVER;
+    unsigned long frames = 0;
+    unsigned long wakeups = 0;
+};
+
+#endif
@@ -0,0 +1,240 @@
+#ifndef RESOURCE_PACK_H
+#define RESOURCE_PACK_H
+
+#include <learnopengl/mapped_file.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+// Pack file layout, little-endian, offsets from the start of the file:
+//
+//   ResourcePackHeader
+//   ResourcePackEntry[count]   sorted by hash
+//   names                      entry paths, '/' separated, not terminated
+//   data                       each file starts on a RESOURCE_PACK_ALIGN boundary
+//
+// Entries are looked up by the 64-bit FNV-1a hash of the path relative to
+// resources/, e.g. "textures/container.jpg". src/tools/pack_resources.cpp
+// writes the file and refuses paths whose hashes collide.
+
+const char RESOURCE_PACK_MAGIC[8] = { 'L', 'O', 'G', 'L', 'P', 'A', 'K', 0 };
+const uint32_t RESOURCE_PACK_VERSION = 1;
+const uint64_t RESOURCE_PACK_ALIGN = 64;
+
+struct ResourcePackHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t count;
+    uint64_t namesOffset;
+    uint64_t namesSize;
+};
+
+struct ResourcePackEntry
+{
+    uint64_t hash;
+    uint64_t offset;
+    uint64_t size;
+    uint32_t nameOffset;
+    uint32_t nameLength;
+};
+
+// Part of a path the pack knows it by: whatever follows the last
+// "resources/", so "../../resources/textures/container.jpg" and
+// "textures/container.jpg" name the same entry.
+inline const char* resourceName(const char* path)
+{
+    const char* name = path;
+    for (const char* p = path; *p; p++)
+        if (std::strncmp(p, "resources", 9) == 0 && (p[9] == '/' || p[9] == '\\') && (p == path || p[-1] == '/' || p[-1] == '\\'))
+            name = p + 10;
+    while (name[0] == '.' && (name[1] == '/' || name[1] == '\\'))
+        name += 2;
+    return name;
+}
+
+// FNV-1a over the name with '\' read as '/'
+inline uint64_t resourceHash(const char* name, size_t length)
+{
+    uint64_t hash = 14695981039346656037ull;
+    for (size_t i = 0; i < length; i++)
+    {
+        unsigned char c = (unsigned char)(name[i] == '\\' ? '/' : name[i]);
+        hash = (hash ^ c) * 1099511628211ull;
+    }
+    return hash;
+}
+
+inline uint64_t resourceHash(const char* name)
+{
+    return resourceHash(name, std::strlen(name));
+}
+
+// A file inside the pack. The bytes stay valid while the pack is open.
+struct ResourceSpan
+{
+    const char* data = nullptr;
+    size_t size = 0;
+
+    explicit operator bool() const { return data != nullptr; }
+};
+
+// Read-only view of a pack: the whole file is mapped once and lookups are a
+// binary search over the index, so no file is opened, read or copied per
+// asset and pages are only touched when their data is used.
+class ResourcePack
+{
+public:
+    ResourcePack() {}
+    explicit ResourcePack(const char* path) { open(path); }
+
+    ResourcePack(const ResourcePack&) = delete;
+    ResourcePack& operator=(const ResourcePack&) = delete;
+
+    bool open(const char* path)
+    {
+        close();
+        if (!file.open(path))
+            return false;
+        if (!validate())
+        {
+            std::cout << "ERROR::RESOURCE_PACK::INVALID: " << path << std::endl;
+            close();
+            return false;
+        }
+        return true;
+    }
+
+    void close()
+    {
+        file.close();
+        entries = nullptr;
+        names = nullptr;
+        entryCount = 0;
+    }
+
+    bool isOpen() const { return entries != nullptr; }
+    size_t count() const { return entryCount; }
+
+    // entry by hash alone; the caller vouches for the hash
+    ResourceSpan find(uint64_t hash) const
+    {
+        const ResourcePackEntry* e = lookup(hash);
+        return e ? span(*e) : ResourceSpan();
+    }
+
+    // entry by path, see resourceName(); the stored name is compared too, so
+    // a missing file whose hash matches another entry isn't mistaken for it
+    ResourceSpan find(const char* path) const
+    {
+        const char* name = resourceName(path);
+        size_t length = std::strlen(name);
+        const ResourcePackEntry* e = lookup(resourceHash(name, length));
+        if (!e || e->nameLength != length)
+            return ResourceSpan();
+        const char* stored = names + e->nameOffset;
+        for (size_t i = 0; i < length; i++)
+            if (stored[i] != (name[i] == '\\' ? '/' : name[i]))
+                return ResourceSpan();
+        return span(*e);
+    }
+
+    // i-th entry in hash order, for listing
+    ResourceSpan entry(size_t i, const char** name, size_t* nameLength) const
+    {
+        *name = names + entries[i].nameOffset;
+        *nameLength = entries[i].nameLength;
+        return span(entries[i]);
+    }
+
+private:
+    MappedFile file;
+    const ResourcePackEntry* entries = nullptr;
+    const char* names = nullptr;
+    size_t entryCount = 0;
+
+    ResourceSpan span(const ResourcePackEntry& e) const
+    {
+        ResourceSpan s;
+        s.data = file.data() + e.offset;
+        s.size = (size_t)e.size;
+        return s;
+    }
+
+    const ResourcePackEntry* lookup(uint64_t hash) const
+    {
+        size_t lo = 0, hi = entryCount;
+        while (lo < hi)
+        {
+            size_t mid = lo + (hi - lo) / 2;
+            if (entries[mid].hash < hash)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        return lo < entryCount && entries[lo].hash == hash ? &entries[lo] : nullptr;
+    }
+
+    // checks every offset once at open so lookups need no bounds checks
+    bool validate()
+    {
+        ResourcePackHeader header;
+        uint64_t size = file.size();
+        if (size < sizeof(header))
+            return false;
+        std::memcpy(&header, file.data(), sizeof(header));
+        if (std::memcmp(header.magic, RESOURCE_PACK_MAGIC, sizeof(header.magic)) != 0 || header.version != RESOURCE_PACK_VERSION)
+            return false;
+        uint64_t indexEnd = sizeof(header) + (uint64_t)header.count * sizeof(ResourcePackEntry);
+        if (indexEnd > size || header.namesOffset < indexEnd || header.namesOffset > size ||
+            header.namesSize > size - header.namesOffset)
+            return false;
+
+        const ResourcePackEntry* index = (const ResourcePackEntry*)(file.data() + sizeof(header));
+        for (uint32_t i = 0; i < header.count; i++)
+        {
+            const ResourcePackEntry& e = index[i];
+            if (i > 0 && index[i - 1].hash >= e.hash)
+                return false;
+            if ((uint64_t)e.nameOffset + e.nameLength > header.namesSize)
+                return false;
+            if (e.offset > size || e.size > size - e.offset)
+                return false;
+        }
+        entries = index;
+        names = file.data() + header.namesOffset;
+        entryCount = header.count;
+        return true;
+    }
+};
+
+// Opens the pack named by LOGL_RESOURCE_PACK, or else the first resources.pak
+// found in the working directory or up to two levels above it (the demos run
+// from src/ or src/<demo>/).
+inline bool openDefaultResourcePack(ResourcePack& pack)
+{
+    const char* env = std::getenv("LOGL_RESOURCE_PACK");
+    if (env)
+        return pack.open(env);
+    return pack.open("resources.pak") || pack.open("../resources.pak") || pack.open("../../resources.pak");
+}
+
+// process wide pack, opened on first use; not open when there is none and
+// callers then read the loose files under resources/
+inline const ResourcePack& resourcePack()
+{
+    static ResourcePack pack;
+    static bool opened = openDefaultResourcePack(pack);
+    (void)opened;
+    return pack;
+}
+
+// resourcePack().find(path) when a pack is open
+inline ResourceSpan findResource(const char* path)
+{
+    const ResourcePack& pack = resourcePack();
+    return pack.isOpen() ? pack.find(path) : ResourceSpan();
+}
+#endif
@@ -0,0 +1,134 @@
+#ifndef SHADER_CACHE_H
+#define SHADER_CACHE_H
+
+#include <glad/glad.h>
+
+#include <learnopengl/gpu_resources.h>
+#include <learnopengl/shader_source.h>
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+#include <iostream>
+
+// Feature toggles that select a shader permutation. Every set bit becomes a
+// '#define' in both stages, so the program is specialized at compile time
+// instead of branching on a uniform at run time.
+enum Shader_Feature {
+    SHADER_TEXTURED     = 1 << 0,
+    SHADER_INSTANCED    = 1 << 1,
+    SHADER_VERTEX_COLOR = 1 << 2,
+    SHADER_INSTANCED_RECT = 1 << 3,
+    SHADER_QUANTIZED    = 1 << 4,
+};
+
+inline std::vector<std::string> shaderFeatureDefines(unsigned int features)
+{
+    std::vector<std::string> defines;
+    if (features & SHADER_TEXTURED)
+        defines.push_back("TEXTURED 1");
+    if (features & SHADER_INSTANCED)
+        defines.push_back("INSTANCED 1");
+    if (features & SHADER_VERTEX_COLOR)
+        defines.push_back("VERTEX_COLOR 1");
+    if (features & SHADER_INSTANCED_RECT)
+        defines.push_back("INSTANCED_RECT 1");
+    if (features & SHADER_QUANTIZED)
+        defines.push_back("QUANTIZED 1");
+    return defines;
+}
+
+// Maps (vertex path, fragment path, feature bits) to a linked program so each
+// permutation is compiled once no matter how many objects ask for it.
+class ShaderCache
+{
+public:
+    GLuint get(const char* vertexPath, const char* fragmentPath, unsigned int features = 0)
+    {
+        std::string key = std::string(vertexPath) + '\n' + fragmentPath + '\n' + std::to_string(features);
+        auto it = programs.find(key);
+        if (it != programs.end())
+        {
+            if (broken.count(it->second.id()))
+                errors++;
+            return it->second.id();
+        }
+
+        std::vector<std::string> defines = shaderFeatureDefines(features);
+        ShaderSource vs(vertexPath, defines);
+        ShaderSource fs(fragmentPath, defines);
+
+        GLuint vertex = vs.compile(GL_VERTEX_SHADER);
+        bool linked = checkCompileErrors(vertex, "VERTEX", vertexPath);
+        GLuint fragment = fs.compile(GL_FRAGMENT_SHADER);
+        linked &= checkCompileErrors(fragment, "FRAGMENT", fragmentPath);
+
+        GLuint program = glCreateProgram();
+        glAttachShader(program, vertex);
+        glAttachShader(program, fragment);
+        glLinkProgram(program);
+        linked &= checkCompileErrors(program, "PROGRAM", vertexPath);
+        if (!linked)
+            broken.insert(program);
+        glDeleteShader(vertex);
+        glDeleteShader(fragment);
+
+        // the path outlives the cache, the primitives pass constants
+        programs.emplace(std::move(key), gpuResources().adoptProgram(program, vertexPath));
+        return program;
+    }
+
+    // deletes every cached program, call before the GL context goes away
+    void clear()
+    {
+        programs.clear();
+        broken.clear();
+    }
+
+    size_t size() const { return programs.size(); }
+
+    // compile and link errors since the cache was created; a failed program
+    // stays cached and counts one more each time it is asked for again
+    size_t errorCount() const { return errors; }
+
+private:
+    std::unordered_map<std::string, GpuProgram> programs;
+    std::unordered_set<GLuint> broken;
+    size_t errors = 0;
+
+    bool checkCompileErrors(GLuint shader, const std::string& type, const char* path)
+    {
+        GLint success;
+        GLchar infoLog[1024];
+        if (type != "PROGRAM")
+        {
+            glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+            if (!success)
+            {
+                errors++;
+                glGetShaderInfoLog(shader, 1024, NULL, infoLog);
+                std::cout << "ERROR::SHADER_COMPILATION_ERROR of type: " << type << " (" << path << ")\n" << infoLog << "\n -- --------------------------------------------------- -- " << std::endl;
+            }
+        }
+        else
+        {
+            glGetProgramiv(shader, GL_LINK_STATUS, &success);
+            if (!success)
+            {
+                errors++;
+                glGetProgramInfoLog(shader, 1024, NULL, infoLog);
+                std::cout << "ERROR::PROGRAM_LINKING_ERROR of type: " << type << " (" << path << ")\n" << infoLog << "\n -- --------------------------------------------------- -- " << std::endl;
+            }
+        }
+        return success != 0;
+    }
+};
+
+// process wide cache shared by the primitives
+inline ShaderCache& shaderCache()
+{
+    static ShaderCache cache;
+    return cache;
+}
+#endif
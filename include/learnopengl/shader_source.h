@@ -0,0 +1,192 @@
+#ifndef SHADER_SOURCE_H
+#define SHADER_SOURCE_H
+
+#include <glad/glad.h>
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstring>
+#include <cstdio>
+#include <iostream>
+
+#include <learnopengl/mapped_file.h>
+#include <learnopengl/resource_pack.h>
+
+// Resolves '#include "file"' directives and injects '#define' lines right
+// after '#version'. The result is kept as a list of (pointer, length)
+// segments into the resource pack or the mapped files so it can be handed to
+// glShaderSource in a single call without ever building one concatenated
+// string.
+//
+// Includes are resolved relative to the including file and each file is only
+// pulled in once per shader, like '#pragma once'.
+class ShaderSource
+{
+public:
+    ShaderSource() {}
+    ShaderSource(const char* path, const std::vector<std::string>& defines = {}) { load(path, defines); }
+
+    ShaderSource(const ShaderSource&) = delete;
+    ShaderSource& operator=(const ShaderSource&) = delete;
+
+    bool load(const char* path, const std::vector<std::string>& defines = {})
+    {
+        files.clear();
+        paths.clear();
+        strings.clear();
+        pointers.clear();
+        lengths.clear();
+        headerDefines = defines;
+        versionDone = false;
+        return append(path, 0);
+    }
+
+    // compiles the collected segments into a new shader object of the given type
+    GLuint compile(GLenum type) const
+    {
+        GLuint shader = glCreateShader(type);
+        glShaderSource(shader, (GLsizei)pointers.size(), pointers.data(), lengths.data());
+        glCompileShader(shader);
+        return shader;
+    }
+
+    // flattened text, only meant for debugging and error reports
+    std::string str() const
+    {
+        std::string out;
+        for (size_t i = 0; i < pointers.size(); i++)
+            out.append(pointers[i], lengths[i]);
+        return out;
+    }
+
+    size_t segmentCount() const { return pointers.size(); }
+
+private:
+    std::vector<std::unique_ptr<MappedFile>> files;
+    std::vector<std::string> paths;
+    // generated text (defines, #line) must outlive the segment list
+    std::vector<std::unique_ptr<std::string>> strings;
+    std::vector<const GLchar*> pointers;
+    std::vector<GLint> lengths;
+    std::vector<std::string> headerDefines;
+    bool versionDone = false;
+
+    void emit(const char* p, size_t n)
+    {
+        if (n == 0)
+            return;
+        // merge with the previous segment when contiguous in the same mapping
+        if (!pointers.empty() && pointers.back() + lengths.back() == p)
+        {
+            lengths.back() += (GLint)n;
+            return;
+        }
+        pointers.push_back(p);
+        lengths.push_back((GLint)n);
+    }
+
+    void emitText(std::string text)
+    {
+        strings.emplace_back(new std::string(std::move(text)));
+        emit(strings.back()->data(), strings.back()->size());
+    }
+
+    static std::string directoryOf(const std::string& path)
+    {
+        size_t slash = path.find_last_of("/\\");
+        return slash == std::string::npos ? std::string() : path.substr(0, slash + 1);
+    }
+
+    // returns the first non-blank character of the line starting at p
+    static const char* skipBlanks(const char* p, const char* end)
+    {
+        while (p < end && (*p == ' ' || *p == '\t'))
+            p++;
+        return p;
+    }
+
+    static bool startsWith(const char* p, const char* end, const char* word)
+    {
+        size_t n = std::strlen(word);
+        return (size_t)(end - p) >= n && std::memcmp(p, word, n) == 0;
+    }
+
+    bool append(const std::string& path, int depth)
+    {
+        if (depth > 16)
+        {
+            std::cout << "ERROR::SHADER::INCLUDE_TOO_DEEP: " << path << std::endl;
+            return false;
+        }
+        for (const std::string& seen : paths)
+            if (seen == path)
+                return true;
+
+        // the resource pack when there is one, else the loose file
+        ResourceSpan packed = findResource(path.c_str());
+        const char* begin = packed.data;
+        const char* end = begin + packed.size;
+        if (!packed)
+        {
+            files.emplace_back(new MappedFile());
+            MappedFile& file = *files.back();
+            if (!file.open(path.c_str()))
+            {
+                std::cout << "ERROR::SHADER::FILE_NOT_SUCCESFULLY_READ: " << path << std::endl;
+                files.pop_back();
+                return false;
+            }
+            begin = file.data();
+            end = begin + file.size();
+        }
+        paths.push_back(path);
+        int fileIndex = (int)paths.size() - 1;
+
+        const char* chunk = begin;
+        int line = 1;
+        bool ok = true;
+
+        for (const char* p = begin; p < end; line++)
+        {
+            const char* eol = (const char*)std::memchr(p, '\n', end - p);
+            const char* next = eol ? eol + 1 : end;
+            const char* d = skipBlanks(p, next);
+
+            if (!versionDone && startsWith(d, next, "#version"))
+            {
+                // keep the #version line, then put the permutation defines after it
+                emit(chunk, next - chunk);
+                if (!eol)
+                    emitText("\n");
+                std::string header;
+                for (const std::string& def : headerDefines)
+                    header += "#define " + def + "\n";
+                header += "#line " + std::to_string(line + 1) + " " + std::to_string(fileIndex) + "\n";
+                emitText(header);
+                versionDone = true;
+                chunk = next;
+            }
+            else if (startsWith(d, next, "#include"))
+            {
+                const char* q0 = (const char*)std::memchr(d, '"', next - d);
+                const char* q1 = q0 ? (const char*)std::memchr(q0 + 1, '"', next - q0 - 1) : nullptr;
+                if (!q1)
+                {
+                    std::cout << "ERROR::SHADER::BAD_INCLUDE: " << path << ":" << line << std::endl;
+                    return false;
+                }
+                emit(chunk, p - chunk);
+                std::string target = directoryOf(path) + std::string(q0 + 1, q1);
+                emitText("#line 1 " + std::to_string(paths.size()) + "\n");
+                ok = append(target, depth + 1) && ok;
+                emitText("\n#line " + std::to_string(line + 1) + " " + std::to_string(fileIndex) + "\n");
+                chunk = next;
+            }
+            p = next;
+        }
+        emit(chunk, end - chunk);
+        return ok;
+    }
+};
+#endif
@@ -0,0 +1,529 @@
+#ifndef SOFT_RASTER_H
+#define SOFT_RASTER_H
+
+#include <glm/glm.hpp>
+
+#include <learnopengl/job_system.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SOFT_RASTER_SSE2
+#endif
+
+// CPU rasterizer for the demos' draws, for rendering without a GPU. It takes
+// the same vertex arrays the VAOs are filled from (position at attribute 0,
+// optional texture coordinates) and the same clip-from-object transform the
+// shaders compute, and follows GL where it matters for comparing images:
+// pixel centers at +0.5, top-left fill rule, window depth 0..1 tested LESS,
+// row 0 at the bottom as glReadPixels returns it.
+//
+// Draws are transformed, clipped against the near plane and set up as edge
+// equations immediately; flush() then rasterizes every screen tile as a job,
+// each tile running its triangles in submission order, four pixels at a time.
+//
+//   SoftTarget target(512, 512);
+//   SoftRasterizer raster(target);
+//   raster.clear(glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
+//   raster.draw(state, SOFT_TRIANGLE_STRIP, vertices, SoftVertexLayout{ 3 }, 0, 4);
+//   raster.flush();
+
+// RGBA8 color (r in the low byte) and float depth. Rows are padded to a
+// multiple of four pixels so spans can be loaded whole.
+class SoftTarget
+{
+public:
+    SoftTarget(int width, int height)
+        : width(width), height(height), pitch((width + 3) & ~3),
+          color((size_t)pitch * height), depth((size_t)pitch * height) {}
+
+    void clear(glm::vec4 rgba, float clearDepth = 1.0f);
+
+    uint32_t pixel(int x, int y) const { return color[(size_t)y * pitch + x]; }
+
+    int width, height, pitch;
+    std::vector<uint32_t> color;
+    std::vector<float> depth;
+};
+
+inline uint32_t softPackColor(glm::vec4 c)
+{
+    c = glm::clamp(c, 0.0f, 1.0f) * 255.0f + 0.5f;
+    return (uint32_t)c.r | (uint32_t)c.g << 8 | (uint32_t)c.b << 16 | (uint32_t)c.a << 24;
+}
+
+inline void SoftTarget::clear(glm::vec4 rgba, float clearDepth)
+{
+    std::fill(color.begin(), color.end(), softPackColor(rgba));
+    std::fill(depth.begin(), depth.end(), clearDepth);
+}
+
+// RGBA8 texture sampled bilinearly with GL_REPEAT, the demos' sampler state.
+// Row 0 is t = 0, the first row glTexImage2D uploads.
+class SoftTexture
+{
+public:
+    SoftTexture() : width(0), height(0) {}
+    SoftTexture(const unsigned char* pixels, int width, int height, int channels)
+        : width(width), height(height), texels((size_t)width * height)
+    {
+        for (size_t i = 0; i < texels.size(); i++)
+        {
+            const unsigned char* p = pixels + i * channels;
+            uint32_t r = p[0];
+            uint32_t g = channels >= 3 ? p[1] : (channels == 2 ? p[0] : r);
+            uint32_t b = channels >= 3 ? p[2] : r;
+            uint32_t a = channels == 4 ? p[3] : (channels == 2 ? p[1] : 255);
+            texels[i] = r | g << 8 | b << 16 | a << 24;
+        }
+    }
+
+    bool empty() const { return texels.empty(); }
+
+    // 8 bit weights are as fine as the filtering of most GPUs
+    uint32_t sample(float u, float v) const
+    {
+        float x = u * width - 0.5f, y = v * height - 0.5f;
+        float fx = std::floor(x), fy = std::floor(y);
+        uint32_t wx = (uint32_t)((x - fx) * 256.0f), wy = (uint32_t)((y - fy) * 256.0f);
+        int x0 = wrap((int)fx, width), y0 = wrap((int)fy, height);
+        int x1 = x0 + 1 == width ? 0 : x0 + 1, y1 = y0 + 1 == height ? 0 : y0 + 1;
+        uint32_t top = lerp(texels[(size_t)y0 * width + x0], texels[(size_t)y0 * width + x1], wx);
+        uint32_t bottom = lerp(texels[(size_t)y1 * width + x0], texels[(size_t)y1 * width + x1], wx);
+        return lerp(top, bottom, wy);
+    }
+
+    int width, height;
+    std::vector<uint32_t> texels;
+
+private:
+    static int wrap(int i, int size)
+    {
+        i %= size;
+        return i < 0 ? i + size : i;
+    }
+
+    // both channel pairs (r, b) and (g, a) at once, w in 0..256
+    static uint32_t lerp(uint32_t a, uint32_t b, uint32_t w)
+    {
+        uint32_t rbA = a & 0x00ff00ff, gaA = (a >> 8) & 0x00ff00ff;
+        uint32_t rbB = b & 0x00ff00ff, gaB = (b >> 8) & 0x00ff00ff;
+        uint32_t rb = (rbA * (256 - w) + rbB * w) >> 8 & 0x00ff00ff;
+        uint32_t ga = (gaA * (256 - w) + gaB * w) & 0xff00ff00;
+        return rb | ga;
+    }
+};
+
+enum Soft_Primitive {
+    SOFT_TRIANGLES,
+    SOFT_TRIANGLE_STRIP,
+    SOFT_LINES,        // one pixel wide, drawn as thin quads
+};
+
+// Floats per vertex and where the texture coordinates start, -1 for none;
+// the position is always the first three floats, as at attribute 0.
+struct SoftVertexLayout
+{
+    int stride;
+    int texCoordOffset = -1;
+};
+
+// What the vertex and fragment stages of primitive.vs/fs and camera.vs/fs
+// need: FragColor = color * mix(texture, texture2, mixAmount).
+struct SoftDrawState
+{
+    glm::mat4 transform = glm::mat4(1.0f);   // projection * view * model
+    glm::vec4 color = glm::vec4(1.0f);
+    const SoftTexture* texture = nullptr;
+    const SoftTexture* texture2 = nullptr;
+    float mixAmount = 0.0f;
+    bool depthTest = false;
+};
+
+class SoftRasterizer
+{
+public:
+    static const int TILE_SIZE = 64;
+
+    explicit SoftRasterizer(SoftTarget& target, JobSystem& jobs = jobSystem())
+        : target(target), jobs(jobs),
+          tilesX((target.width + TILE_SIZE - 1) / TILE_SIZE), tilesY((target.height + TILE_SIZE - 1) / TILE_SIZE),
+          bins((size_t)tilesX * tilesY) {}
+
+    SoftRasterizer(const SoftRasterizer&) = delete;
+    SoftRasterizer& operator=(const SoftRasterizer&) = delete;
+
+    // runs whatever was drawn before, then clears like glClear
+    void clear(glm::vec4 rgba, float clearDepth = 1.0f)
+    {
+        flush();
+        target.clear(rgba, clearDepth);
+    }
+
+    // glDrawArrays(mode, first, count) with the vertices of the bound VAO
+    void draw(const SoftDrawState& state, Soft_Primitive mode, const float* vertices, const SoftVertexLayout& layout, int first, int count);
+
+    // rasterizes everything drawn since the last flush, one job per tile
+    void flush();
+
+    size_t triangleCount() const { return triangles.size(); }
+
+private:
+    // clip space vertex with the attributes the fragment stage reads
+    struct ClipVertex { glm::vec4 position; glm::vec2 texCoord; };
+    // window space vertex: x, y in pixels, z in 0..1, plus 1/w and the
+    // perspective divided texture coordinates
+    struct WindowVertex { float x, y, z, invW, u, v; };
+
+    // Edge equations E(x, y) = a x + b y + c, positive inside, and
+    // attribute planes value(x, y) = dx x + dy y + c.
+    struct Triangle
+    {
+        float edgeA[3], edgeB[3], edgeC[3];
+        bool topLeft[3];
+        glm::vec3 z, invW, u, v;
+        int minX, minY, maxX, maxY;
+        int state;
+        bool textured;
+    };
+
+    void triangle(const ClipVertex& a, const ClipVertex& b, const ClipVertex& c, bool textured);
+    void line(const ClipVertex& a, const ClipVertex& b, bool textured);
+    WindowVertex toWindow(const ClipVertex& v) const;
+    void setup(const WindowVertex& a, const WindowVertex& b, const WindowVertex& c, bool textured);
+    void rasterizeTile(int tile);
+    void span(const Triangle& t, const SoftDrawState& state, int y, int x0, int x1, int clipX0, int clipX1);
+    uint32_t shade(const Triangle& t, const SoftDrawState& state, float px, float py) const;
+
+    SoftTarget& target;
+    JobSystem& jobs;
+    int tilesX, tilesY;
+    std::vector<SoftDrawState> states;
+    std::vector<Triangle> triangles;
+    std::vector<std::vector<uint32_t>> bins;
+    std::vector<ClipVertex> clipVertices;
+};
+
+inline void SoftRasterizer::draw(const SoftDrawState& state, Soft_Primitive mode, const float* vertices, const SoftVertexLayout& layout, int first, int count)
+{
+    // vertex stage
+    bool textured = layout.texCoordOffset >= 0;
+    clipVertices.resize(count);
+    for (int i = 0; i < count; i++)
+    {
+        const float* v = vertices + (size_t)(first + i) * layout.stride;
+        clipVertices[i].position = state.transform * glm::vec4(v[0], v[1], v[2], 1.0f);
+        clipVertices[i].texCoord = textured ? glm::vec2(v[layout.texCoordOffset], v[layout.texCoordOffset + 1]) : glm::vec2(0.0f);
+    }
+
+    states.push_back(state);
+    const ClipVertex* cv = clipVertices.data();
+    switch (mode)
+    {
+    case SOFT_TRIANGLES:
+        for (int i = 0; i + 2 < count; i += 3)
+            triangle(cv[i], cv[i + 1], cv[i + 2], textured);
+        break;
+    case SOFT_TRIANGLE_STRIP:
+        // every other triangle swaps its first two vertices to keep the winding
+        for (int i = 0; i + 2 < count; i++)
+        {
+            if (i & 1)
+                triangle(cv[i + 1], cv[i], cv[i + 2], textured);
+            else
+                triangle(cv[i], cv[i + 1], cv[i + 2], textured);
+        }
+        break;
+    case SOFT_LINES:
+        for (int i = 0; i + 1 < count; i += 2)
+            line(cv[i], cv[i + 1], textured);
+        break;
+    }
+}
+
+inline SoftRasterizer::WindowVertex SoftRasterizer::toWindow(const ClipVertex& v) const
+{
+    float invW = 1.0f / v.position.w;
+    WindowVertex out;
+    out.x = (v.position.x * invW * 0.5f + 0.5f) * target.width;
+    out.y = (v.position.y * invW * 0.5f + 0.5f) * target.height;
+    out.z = v.position.z * invW * 0.5f + 0.5f;
+    out.invW = invW;
+    out.u = v.texCoord.x * invW;
+    out.v = v.texCoord.y * invW;
+    return out;
+}
+
+inline void SoftRasterizer::triangle(const ClipVertex& a, const ClipVertex& b, const ClipVertex& c, bool textured)
+{
+    // near plane z >= -w; the other planes are left to the tile bounds
+    const ClipVertex* in[3] = { &a, &b, &c };
+    float d[3];
+    int inside = 0;
+    for (int i = 0; i < 3; i++)
+    {
+        d[i] = in[i]->position.z + in[i]->position.w;
+        inside += d[i] >= 0.0f;
+    }
+    if (inside == 0)
+        return;
+    if (inside == 3)
+    {
+        setup(toWindow(a), toWindow(b), toWindow(c), textured);
+        return;
+    }
+
+    ClipVertex polygon[4];
+    int n = 0;
+    for (int i = 0; i < 3; i++)
+    {
+        int j = i == 2 ? 0 : i + 1;
+        if (d[i] >= 0.0f)
+            polygon[n++] = *in[i];
+        if ((d[i] >= 0.0f) != (d[j] >= 0.0f))
+        {
+            float t = d[i] / (d[i] - d[j]);
+            polygon[n].position = glm::mix(in[i]->position, in[j]->position, t);
+            polygon[n].texCoord = glm::mix(in[i]->texCoord, in[j]->texCoord, t);
+            n++;
+        }
+    }
+    WindowVertex w0 = toWindow(polygon[0]);
+    for (int i = 1; i + 1 < n; i++)
+        setup(w0, toWindow(polygon[i]), toWindow(polygon[i + 1]), textured);
+}
+
+inline void SoftRasterizer::line(const ClipVertex& a, const ClipVertex& b, bool textured)
+{
+    // lines only come from the 2D board, which never crosses the near plane
+    if (a.position.z + a.position.w < 0.0f || b.position.z + b.position.w < 0.0f)
+        return;
+    WindowVertex p = toWindow(a), q = toWindow(b);
+    float dx = q.x - p.x, dy = q.y - p.y;
+    float length = std::sqrt(dx * dx + dy * dy);
+    if (length == 0.0f)
+        return;
+    // half a pixel to either side
+    float nx = -dy / length * 0.5f, ny = dx / length * 0.5f;
+    WindowVertex p0 = p, p1 = p, q0 = q, q1 = q;
+    p0.x += nx; p0.y += ny; p1.x -= nx; p1.y -= ny;
+    q0.x += nx; q0.y += ny; q1.x -= nx; q1.y -= ny;
+    setup(p0, p1, q0, textured);
+    setup(p1, q1, q0, textured);
+}
+
+inline void SoftRasterizer::setup(const WindowVertex& a, const WindowVertex& b, const WindowVertex& c, bool textured)
+{
+    const WindowVertex* v[3] = { &a, &b, &c };
+    float area = (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+    if (area == 0.0f || !std::isfinite(area))
+        return;
+
+    Triangle t;
+    t.minX = std::max(0, (int)std::floor(std::min({ a.x, b.x, c.x })));
+    t.minY = std::max(0, (int)std::floor(std::min({ a.y, b.y, c.y })));
+    t.maxX = std::min(target.width - 1, (int)std::ceil(std::max({ a.x, b.x, c.x })));
+    t.maxY = std::min(target.height - 1, (int)std::ceil(std::max({ a.y, b.y, c.y })));
+    if (t.minX > t.maxX || t.minY > t.maxY)
+        return;
+
+    // edge i is opposite vertex i; both windings are drawn, as with culling off
+    float sign = area > 0.0f ? 1.0f : -1.0f;
+    for (int i = 0; i < 3; i++)
+    {
+        const WindowVertex& p = *v[(i + 1) % 3];
+        const WindowVertex& q = *v[(i + 2) % 3];
+        t.edgeA[i] = (p.y - q.y) * sign;
+        t.edgeB[i] = (q.x - p.x) * sign;
+        t.edgeC[i] = (p.x * q.y - p.y * q.x) * sign;
+        // GL's top-left rule for a counter-clockwise triangle with y up
+        t.topLeft[i] = t.edgeA[i] > 0.0f || (t.edgeA[i] == 0.0f && t.edgeB[i] < 0.0f);
+    }
+
+    // barycentric weight of vertex i is E_i / |area|
+    float invArea = 1.0f / std::fabs(area);
+    auto plane = [&](float WindowVertex::*attribute) {
+        glm::vec3 p(0.0f);
+        for (int i = 0; i < 3; i++)
+        {
+            float value = v[i]->*attribute * invArea;
+            p += glm::vec3(t.edgeA[i], t.edgeB[i], t.edgeC[i]) * value;
+        }
+        return p;
+    };
+    t.z = plane(&WindowVertex::z);
+    t.invW = plane(&WindowVertex::invW);
+    if (textured)
+    {
+        t.u = plane(&WindowVertex::u);
+        t.v = plane(&WindowVertex::v);
+    }
+    t.state = (int)states.size() - 1;
+    t.textured = textured;
+
+    uint32_t index = (uint32_t)triangles.size();
+    triangles.push_back(t);
+    for (int ty = t.minY / TILE_SIZE; ty <= t.maxY / TILE_SIZE; ty++)
+        for (int tx = t.minX / TILE_SIZE; tx <= t.maxX / TILE_SIZE; tx++)
+            bins[(size_t)ty * tilesX + tx].push_back(index);
+}
+
+inline void SoftRasterizer::flush()
+{
+    if (triangles.empty())
+    {
+        states.clear();
+        return;
+    }
+    jobs.parallelFor(0, bins.size(), 1, [this](size_t begin, size_t end)
+    {
+        for (size_t tile = begin; tile < end; tile++)
+            rasterizeTile((int)tile);
+    });
+    triangles.clear();
+    states.clear();
+    for (std::vector<uint32_t>& bin : bins)
+        bin.clear();
+}
+
+inline void SoftRasterizer::rasterizeTile(int tile)
+{
+    int tileX0 = (tile % tilesX) * TILE_SIZE, tileY0 = (tile / tilesX) * TILE_SIZE;
+    int tileX1 = std::min(tileX0 + TILE_SIZE, target.width) - 1;
+    int tileY1 = std::min(tileY0 + TILE_SIZE, target.height) - 1;
+    for (uint32_t index : bins[tile])
+    {
+        const Triangle& t = triangles[index];
+        const SoftDrawState& state = states[t.state];
+        int x0 = std::max(t.minX, tileX0), x1 = std::min(t.maxX, tileX1);
+        int y0 = std::max(t.minY, tileY0), y1 = std::min(t.maxY, tileY1);
+        // spans start on a multiple of four, the tile origin is one
+        int alignedX0 = x0 & ~3;
+        for (int y = y0; y <= y1; y++)
+            span(t, state, y, alignedX0, x1, x0, x1);
+    }
+}
+
+inline uint32_t SoftRasterizer::shade(const Triangle& t, const SoftDrawState& state, float px, float py) const
+{
+    glm::vec4 c = state.color;
+    if (t.textured && state.texture)
+    {
+        float w = 1.0f / (t.invW.x * px + t.invW.y * py + t.invW.z);
+        float u = (t.u.x * px + t.u.y * py + t.u.z) * w;
+        float v = (t.v.x * px + t.v.y * py + t.v.z) * w;
+        uint32_t texel = state.texture->sample(u, v);
+        glm::vec4 sampled = glm::vec4(texel & 0xff, texel >> 8 & 0xff, texel >> 16 & 0xff, texel >> 24) * (1.0f / 255.0f);
+        if (state.texture2 && state.mixAmount > 0.0f)
+        {
+            uint32_t texel2 = state.texture2->sample(u, v);
+            glm::vec4 sampled2 = glm::vec4(texel2 & 0xff, texel2 >> 8 & 0xff, texel2 >> 16 & 0xff, texel2 >> 24) * (1.0f / 255.0f);
+            sampled = glm::mix(sampled, sampled2, state.mixAmount);
+        }
+        c *= sampled;
+    }
+    return softPackColor(c);
+}
+
+#ifdef SOFT_RASTER_SSE2
+
+// Four pixels per step: edge equations, coverage and the depth test in SSE2,
+// shading per covered pixel. Flat colored triangles store the span directly.
+inline void SoftRasterizer::span(const Triangle& t, const SoftDrawState& state, int y, int x0, int x1, int clipX0, int clipX1)
+{
+    float py = (float)y + 0.5f;
+    const __m128 offsets = _mm_set_ps(3.5f, 2.5f, 1.5f, 0.5f);
+    __m128 px = _mm_add_ps(_mm_set1_ps((float)x0), offsets);
+    const __m128 four = _mm_set1_ps(4.0f);
+    const __m128 zero = _mm_setzero_ps();
+
+    // evaluated from scratch at every step rather than stepped, so the
+    // coverage matches the scalar path bit for bit
+    __m128 a[3], row[3], topLeft[3];
+    for (int i = 0; i < 3; i++)
+    {
+        a[i] = _mm_set1_ps(t.edgeA[i]);
+        row[i] = _mm_set1_ps(t.edgeB[i] * py + t.edgeC[i]);
+        topLeft[i] = _mm_castsi128_ps(_mm_set1_epi32(t.topLeft[i] ? -1 : 0));
+    }
+    const __m128 zA = _mm_set1_ps(t.z.x), zRow = _mm_set1_ps(t.z.y * py + t.z.z);
+    const __m128 lo = _mm_set1_ps((float)clipX0), hi = _mm_set1_ps((float)clipX1 + 1.0f);
+    bool flat = !(t.textured && state.texture);
+    const __m128i flatColor = _mm_set1_epi32((int)softPackColor(state.color));
+
+    uint32_t* colorRow = target.color.data() + (size_t)y * target.pitch;
+    float* depthRow = target.depth.data() + (size_t)y * target.pitch;
+    for (int x = x0; x <= x1; x += 4)
+    {
+        __m128 mask = _mm_and_ps(_mm_cmpgt_ps(px, lo), _mm_cmplt_ps(px, hi));
+        for (int i = 0; i < 3; i++)
+        {
+            __m128 e = _mm_add_ps(_mm_mul_ps(a[i], px), row[i]);
+            __m128 covered = _mm_or_ps(_mm_cmpgt_ps(e, zero), _mm_and_ps(_mm_cmpeq_ps(e, zero), topLeft[i]));
+            mask = _mm_and_ps(mask, covered);
+        }
+        if (_mm_movemask_ps(mask))
+        {
+            if (state.depthTest)
+            {
+                __m128 z = _mm_add_ps(_mm_mul_ps(zA, px), zRow);
+                __m128 stored = _mm_loadu_ps(depthRow + x);
+                mask = _mm_and_ps(mask, _mm_cmplt_ps(z, stored));
+                _mm_storeu_ps(depthRow + x, _mm_or_ps(_mm_and_ps(mask, z), _mm_andnot_ps(mask, stored)));
+            }
+            int bits = _mm_movemask_ps(mask);
+            if (flat)
+            {
+                __m128i m = _mm_castps_si128(mask);
+                __m128i old = _mm_loadu_si128((const __m128i*)(colorRow + x));
+                _mm_storeu_si128((__m128i*)(colorRow + x), _mm_or_si128(_mm_and_si128(m, flatColor), _mm_andnot_si128(m, old)));
+            }
+            else
+            {
+                for (int lane = 0; lane < 4; lane++)
+                    if (bits & (1 << lane))
+                        colorRow[x + lane] = shade(t, state, (float)(x + lane) + 0.5f, py);
+            }
+        }
+        px = _mm_add_ps(px, four);
+    }
+}
+
+#else
+
+inline void SoftRasterizer::span(const Triangle& t, const SoftDrawState& state, int y, int x0, int x1, int clipX0, int clipX1)
+{
+    (void)x0;
+    float py = (float)y + 0.5f;
+    uint32_t* colorRow = target.color.data() + (size_t)y * target.pitch;
+    float* depthRow = target.depth.data() + (size_t)y * target.pitch;
+    for (int x = clipX0; x <= clipX1; x++)
+    {
+        float px = (float)x + 0.5f;
+        bool covered = true;
+        for (int i = 0; i < 3 && covered; i++)
+        {
+            float e = t.edgeA[i] * px + (t.edgeB[i] * py + t.edgeC[i]);
+            covered = e > 0.0f || (e == 0.0f && t.topLeft[i]);
+        }
+        if (!covered)
+            continue;
+        if (state.depthTest)
+        {
+            float z = t.z.x * px + (t.z.y * py + t.z.z);
+            if (!(z < depthRow[x]))
+                continue;
+            depthRow[x] = z;
+        }
+        colorRow[x] = shade(t, state, px, py);
+    }
+}
+
+#endif
+
+#endif
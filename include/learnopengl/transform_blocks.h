@@ -0,0 +1,33 @@
+#ifndef TRANSFORM_BLOCKS_H
+#define TRANSFORM_BLOCKS_H
+
+#include <learnopengl/uniform_block.h>
+
+// The blocks resources/shaders/common/transform.glsl declares when built
+// with TRANSFORM_BLOCKS, and the binding points they are given.
+
+const GLuint FRAME_TRANSFORMS_BINDING = 0;
+const GLuint OBJECT_TRANSFORM_BINDING = 1;
+
+struct FrameTransforms
+{
+    glm::mat4 projection;
+    glm::mat4 view;
+};
+UNIFORM_BLOCK(FrameTransforms, STD140, projection, view);
+
+struct ObjectTransform
+{
+    glm::mat4 model;
+};
+UNIFORM_BLOCK(ObjectTransform, STD140, model);
+
+// checks both blocks of a linked program and binds them
+inline bool bindTransformBlocks(GLuint program)
+{
+    bool frame = bindUniformBlock<FrameTransforms>(program, "FrameTransforms", FRAME_TRANSFORMS_BINDING);
+    bool object = bindUniformBlock<ObjectTransform>(program, "ObjectTransform", OBJECT_TRANSFORM_BINDING);
+    return frame && object;
+}
+
+#endif
@@ -0,0 +1,440 @@
+#ifndef UNIFORM_BLOCK_H
+#define UNIFORM_BLOCK_H
+
+#include <glad/glad.h>
+
+#include <glm/glm.hpp>
+
+#include <learnopengl/gpu_resources.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Plain C++ structs as uniform and shader storage blocks. UNIFORM_BLOCK()
+// lists a struct's members in the order the GLSL block declares them; the
+// offsets std140 or std430 gives them are worked out at compile time and
+// every member that isn't there fails a static_assert naming it, so the
+// struct is the block byte for byte and goes to the GPU with one memcpy:
+//
+//   struct Lights                          // layout (std140) uniform Lights
+//   {                                      // {
+//       glm::vec3 direction;               //     vec3 direction;
+//       float intensity;                   //     float intensity;
+//       alignas(16) glm::vec3 color;       //     vec3 color;
+//       UniformArray<float, 4, STD140> falloff;  // float falloff[4];
+//       UniformMat3 normalMatrix;          //     mat3 normalMatrix;
+//   };                                     // };
+//   UNIFORM_BLOCK(Lights, STD140, direction, intensity, color, falloff, normalMatrix);
+//
+// After linking, bindUniformBlock<Lights>(program, "Lights", binding) (or
+// bindStorageBlock for std430 buffers) checks the layout against what the
+// driver reflects and assigns the binding point. UniformBuffer<Lights> then
+// holds any number of them in one buffer, uploaded together and bound by
+// range, so a draw's uniforms are one glBindBufferRange.
+
+enum UniformLayoutRule { STD140, STD430 };
+
+// where a member sits and what the driver should say about it; alignment 0
+// for a type the rule can't lay out
+struct UniformMember
+{
+    size_t alignment;
+    size_t size;
+    GLenum type;
+    GLint arraySize;
+    size_t arrayStride;
+    size_t matrixStride;
+};
+
+constexpr size_t uniformAlignUp(size_t value, size_t alignment)
+{
+    return alignment ? (value + alignment - 1) / alignment * alignment : value;
+}
+
+// Layout of each GLSL type a member may have; types without one don't compile.
+template<typename T>
+struct UniformType;
+
+template<>
+struct UniformType<float>
+{
+    static constexpr UniformMember member(UniformLayoutRule) { return { 4, 4, GL_FLOAT, 0, 0, 0 }; }
+};
+
+template<>
+struct UniformType<int32_t>
+{
+    static constexpr UniformMember member(UniformLayoutRule) { return { 4, 4, GL_INT, 0, 0, 0 }; }
+};
+
+template<>
+struct UniformType<uint32_t>
+{
+    static constexpr UniformMember member(UniformLayoutRule) { return { 4, 4, GL_UNSIGNED_INT, 0, 0, 0 }; }
+};
+
+// vec2 aligns to 8 bytes, vec3 and vec4 to 16
+template<glm::length_t L, typename T, glm::qualifier Q>
+struct UniformType<glm::vec<L, T, Q>>
+{
+    static constexpr UniformMember member(UniformLayoutRule)
+    {
+        GLenum floats[] = { GL_FLOAT_VEC2, GL_FLOAT_VEC3, GL_FLOAT_VEC4 };
+        GLenum ints[] = { GL_INT_VEC2, GL_INT_VEC3, GL_INT_VEC4 };
+        GLenum uints[] = { GL_UNSIGNED_INT_VEC2, GL_UNSIGNED_INT_VEC3, GL_UNSIGNED_INT_VEC4 };
+        GLenum type = std::is_same<T, float>::value ? floats[L - 2] : std::is_same<T, int32_t>::value ? ints[L - 2] : uints[L - 2];
+        bool supported = L >= 2 && sizeof(T) == 4;
+        return { supported ? (L == 2 ? 8u : 16u) : 0u, 4u * L, type, 0, 0, 0 };
+    }
+};
+
+// four vec4 columns in both layouts
+template<glm::qualifier Q>
+struct UniformType<glm::mat<4, 4, float, Q>>
+{
+    static constexpr UniformMember member(UniformLayoutRule) { return { 16, 64, GL_FLOAT_MAT4, 0, 0, 16 }; }
+};
+
+// A mat3 the way both layouts store it: each column padded to a vec4.
+struct UniformMat3
+{
+    glm::vec4 columns[3];
+
+    UniformMat3() {}
+    UniformMat3(const glm::mat3& m) { *this = m; }
+    UniformMat3& operator=(const glm::mat3& m)
+    {
+        for (int c = 0; c < 3; c++)
+            columns[c] = glm::vec4(m[c], 0.0f);
+        return *this;
+    }
+};
+
+template<>
+struct UniformType<UniformMat3>
+{
+    static constexpr UniformMember member(UniformLayoutRule) { return { 16, 48, GL_FLOAT_MAT3, 0, 0, 16 }; }
+};
+
+// An array with the element stride its layout needs: std140 rounds every
+// element up to 16 bytes, std430 only to the element's own alignment.
+template<typename T, size_t N, UniformLayoutRule Rule>
+struct UniformArray
+{
+    static constexpr size_t ALIGNMENT = Rule == STD140 ? 16 : UniformType<T>::member(Rule).alignment;
+
+    struct alignas(ALIGNMENT) Element
+    {
+        T value;
+    };
+    Element elements[N];
+
+    T& operator[](size_t i) { return elements[i].value; }
+    const T& operator[](size_t i) const { return elements[i].value; }
+};
+
+template<typename T, size_t N, UniformLayoutRule Rule>
+struct UniformType<UniformArray<T, N, Rule>>
+{
+    static constexpr UniformMember member(UniformLayoutRule rule)
+    {
+        UniformMember element = UniformType<T>::member(rule);
+        size_t stride = sizeof(typename UniformArray<T, N, Rule>::Element);
+        // an array declared for the other layout has the wrong stride
+        size_t alignment = rule == Rule && element.arraySize == 0 ? UniformArray<T, N, Rule>::ALIGNMENT : 0;
+        return { alignment, N * stride, element.type, (GLint)N, stride, element.matrixStride };
+    }
+};
+
+// filled in by UNIFORM_BLOCK()
+template<typename S>
+struct UniformBlockTraits;
+
+// where member i of S belongs under its block's layout rule
+template<typename S>
+constexpr size_t uniformLayoutOffset(size_t i)
+{
+    size_t offset = 0;
+    for (size_t k = 0; k <= i; k++)
+    {
+        offset = uniformAlignUp(offset, UniformBlockTraits<S>::members[k].alignment);
+        if (k < i)
+            offset += UniformBlockTraits<S>::members[k].size;
+    }
+    return offset;
+}
+
+// bytes the block takes, its end rounded up to the block's own alignment:
+// 16 under std140, the largest member's under std430
+template<typename S>
+constexpr size_t uniformBlockSize()
+{
+    typedef UniformBlockTraits<S> Traits;
+    size_t alignment = Traits::rule == STD140 ? 16 : 4;
+    for (size_t k = 0; k < Traits::count; k++)
+        alignment = alignment > Traits::members[k].alignment ? alignment : Traits::members[k].alignment;
+    size_t last = Traits::count - 1;
+    return uniformAlignUp(uniformLayoutOffset<S>(last) + Traits::members[last].size, alignment);
+}
+
+#define UNIFORM_BLOCK_EXPAND(x) x
+#define UNIFORM_BLOCK_EACH_1(M, S, i, f) M(S, i, f)
+#define UNIFORM_BLOCK_EACH_2(M, S, i, f, ...) M(S, i, f) UNIFORM_BLOCK_EXPAND(UNIFORM_BLOCK_EACH_1(M, S, i + 1, __VA_ARGS__))
+#define UNIFORM_BLOCK_EACH_3(M, S, i, f, ...) M(S, i, f) UNIFORM_BLOCK_EXPAND(UNIFORM_BLOCK_EACH_2(M, S, i + 1, __VA_ARGS__))
+#define UNIFORM_BLOCK_EACH_4(M, S, i, f, ...) M(S, i, f) UNIFORM_BLOCK_EXPAND(UNIFORM_BLOCK_EACH_3(M, S, i + 1, __VA_ARGS__))
+#define UNIFORM_BLOCK_EACH_5(M, S, i, f, ...) M(S, i, f) UNIFORM_BLOCK_EXPAND(UNIFORM_BLOCK_EACH_4(M, S, i + 1, __VA_ARGS__))
+#define UNIFORM_BLOCK_EACH_6(M, S, i, f, ...) M(S, i, f) UNIFORM_BLOCK_EXPAND(UNIFORM_BLOCK_EACH_5(M, S, i + 1, __VA_ARGS__))
+#define UNIFORM_BLOCK_EACH_7(M, S, i, f, ...) M(S, i, f) UNIFORM_BLOCK_EXPAND(UNIFORM_BLOCK_EACH_6(M, S, i + 1, __VA_ARGS__))
+#define UNIFORM_BLOCK_EACH_8(M, S, i, f, ...) M(S, i, f) UNIFORM_BLOCK_EXPAND(UNIFORM_BLOCK_EACH_7(M, S, i + 1, __VA_ARGS__))
+#define UNIFORM_BLOCK_EACH_9(M, S, i, f, ...) M(S, i, f) UNIFORM_BLOCK_EXPAND(UNIFORM_BLOCK_EACH_8(M, S, i + 1, __VA_ARGS__))
+#define UNIFORM_BLOCK_EACH_10(M, S, i, f, ...) M(S, i, f) UNIFORM_BLOCK_EXPAND(UNIFORM_BLOCK_EACH_9(M, S, i + 1, __VA_ARGS__))
+#define UNIFORM_BLOCK_EACH_11(M, S, i, f, ...) M(S, i, f) UNIFORM_BLOCK_EXPAND(UNIFORM_BLOCK_EACH_10(M, S, i + 1, __VA_ARGS__))
+#define UNIFORM_BLOCK_EACH_12(M, S, i, f, ...) M(S, i, f) UNIFORM_BLOCK_EXPAND(UNIFORM_BLOCK_EACH_11(M, S, i + 1, __VA_ARGS__))
+#define UNIFORM_BLOCK_EACH_13(M, S, i, f, ...) M(S, i, f) UNIFORM_BLOCK_EXPAND(UNIFORM_BLOCK_EACH_12(M, S, i + 1, __VA_ARGS__))
+#define UNIFORM_BLOCK_EACH_14(M, S, i, f, ...) M(S, i, f) UNIFORM_BLOCK_EXPAND(UNIFORM_BLOCK_EACH_13(M, S, i + 1, __VA_ARGS__))
+#define UNIFORM_BLOCK_EACH_15(M, S, i, f, ...) M(S, i, f) UNIFORM_BLOCK_EXPAND(UNIFORM_BLOCK_EACH_14(M, S, i + 1, __VA_ARGS__))
+#define UNIFORM_BLOCK_EACH_16(M, S, i, f, ...) M(S, i, f) UNIFORM_BLOCK_EXPAND(UNIFORM_BLOCK_EACH_15(M, S, i + 1, __VA_ARGS__))
+#define UNIFORM_BLOCK_PICK(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, NAME, ...) NAME
+#define UNIFORM_BLOCK_EACH(M, S, ...) UNIFORM_BLOCK_EXPAND(UNIFORM_BLOCK_PICK(__VA_ARGS__, \
+    UNIFORM_BLOCK_EACH_16, UNIFORM_BLOCK_EACH_15, UNIFORM_BLOCK_EACH_14, UNIFORM_BLOCK_EACH_13, \
+    UNIFORM_BLOCK_EACH_12, UNIFORM_BLOCK_EACH_11, UNIFORM_BLOCK_EACH_10, UNIFORM_BLOCK_EACH_9, \
+    UNIFORM_BLOCK_EACH_8, UNIFORM_BLOCK_EACH_7, UNIFORM_BLOCK_EACH_6, UNIFORM_BLOCK_EACH_5, \
+    UNIFORM_BLOCK_EACH_4, UNIFORM_BLOCK_EACH_3, UNIFORM_BLOCK_EACH_2, UNIFORM_BLOCK_EACH_1)(M, S, 0, __VA_ARGS__))
+
+#define UNIFORM_BLOCK_NAME(S, i, f) #f,
+#define UNIFORM_BLOCK_MEMBER(S, i, f) UniformType<decltype(S::f)>::member(rule),
+#define UNIFORM_BLOCK_CHECK(S, i, f) \
+    static_assert(UniformBlockTraits<S>::members[i].alignment != 0, #S "::" #f " has no layout under the block's rule"); \
+    static_assert(offsetof(S, f) == uniformLayoutOffset<S>(i), #S "::" #f " is not where the block layout puts it, pad or align it");
+
+// Lays the struct S out as a block under RULE (STD140 or STD430), members
+// in declaration order, at most 16. Use at global scope after S.
+#define UNIFORM_BLOCK(S, RULE, ...) \
+    template<> \
+    struct UniformBlockTraits<S> \
+    { \
+        static constexpr UniformLayoutRule rule = RULE; \
+        static constexpr const char* names[] = { UNIFORM_BLOCK_EACH(UNIFORM_BLOCK_NAME, S, __VA_ARGS__) }; \
+        static constexpr UniformMember members[] = { UNIFORM_BLOCK_EACH(UNIFORM_BLOCK_MEMBER, S, __VA_ARGS__) }; \
+        static constexpr size_t count = sizeof(members) / sizeof(members[0]); \
+    }; \
+    UNIFORM_BLOCK_EACH(UNIFORM_BLOCK_CHECK, S, __VA_ARGS__) \
+    static_assert(sizeof(S) <= uniformBlockSize<S>(), #S " has more in it than its block")
+
+// what the driver reports about one block member
+struct ReflectedUniform
+{
+    GLint offset, type, arraySize, arrayStride, matrixStride;
+};
+
+// compares the driver's view of every member with S's, and its data size
+template<typename S>
+bool checkUniformLayout(const char* blockName, GLint dataSize, const ReflectedUniform* reflected)
+{
+    typedef UniformBlockTraits<S> Traits;
+    bool ok = true;
+    if (dataSize != (GLint)uniformBlockSize<S>())
+    {
+        std::cout << "ERROR::UNIFORM_BLOCK::SIZE " << blockName << " is " << dataSize << " bytes, expected "
+                  << uniformBlockSize<S>() << std::endl;
+        ok = false;
+    }
+    for (size_t k = 0; k < Traits::count; k++)
+    {
+        const UniformMember& m = Traits::members[k];
+        const ReflectedUniform& r = reflected[k];
+        if (r.offset < 0)
+        {
+            std::cout << "ERROR::UNIFORM_BLOCK::MISSING " << blockName << "." << Traits::names[k] << std::endl;
+            ok = false;
+            continue;
+        }
+        if (r.offset != (GLint)uniformLayoutOffset<S>(k) || (GLenum)r.type != m.type || r.arraySize != (m.arraySize ? m.arraySize : 1) ||
+            r.arrayStride != (GLint)m.arrayStride || r.matrixStride != (GLint)m.matrixStride)
+        {
+            std::cout << "ERROR::UNIFORM_BLOCK::LAYOUT " << blockName << "." << Traits::names[k] << " at " << r.offset
+                      << " (type 0x" << std::hex << r.type << std::dec << ", array " << r.arraySize << " stride " << r.arrayStride
+                      << ", matrix stride " << r.matrixStride << "), expected " << uniformLayoutOffset<S>(k) << " (type 0x"
+                      << std::hex << m.type << std::dec << ", array " << (m.arraySize ? m.arraySize : 1) << " stride " << m.arrayStride
+                      << ", matrix stride " << m.matrixStride << ")" << std::endl;
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+// member names as the driver knows them: arrays by their first element, and
+// members of a block with an instance name behind the block's name
+inline std::string reflectedUniformName(const char* blockName, const char* member, bool array, bool qualified)
+{
+    std::string name = qualified ? std::string(blockName) + "." + member : std::string(member);
+    return array ? name + "[0]" : name;
+}
+
+// Checks the uniform block blockName of a linked program against S and
+// assigns it the binding point. Reports what doesn't match.
+template<typename S>
+bool bindUniformBlock(GLuint program, const char* blockName, GLuint binding)
+{
+    typedef UniformBlockTraits<S> Traits;
+    static_assert(Traits::rule == STD140, "uniform blocks take the std140 layout");
+    GLuint block = glGetUniformBlockIndex(program, blockName);
+    if (block == GL_INVALID_INDEX)
+    {
+        std::cout << "ERROR::UNIFORM_BLOCK::NOT_FOUND " << blockName << std::endl;
+        return false;
+    }
+    GLint dataSize = 0;
+    glGetActiveUniformBlockiv(program, block, GL_UNIFORM_BLOCK_DATA_SIZE, &dataSize);
+
+    ReflectedUniform reflected[Traits::count];
+    for (size_t k = 0; k < Traits::count; k++)
+    {
+        reflected[k].offset = -1;
+        GLuint index = GL_INVALID_INDEX;
+        for (int qualified = 0; qualified < 2 && index == GL_INVALID_INDEX; qualified++)
+        {
+            std::string name = reflectedUniformName(blockName, Traits::names[k], Traits::members[k].arraySize != 0, qualified != 0);
+            const char* names[] = { name.c_str() };
+            glGetUniformIndices(program, 1, names, &index);
+        }
+        if (index == GL_INVALID_INDEX)
+            continue;
+        GLint memberBlock;
+        glGetActiveUniformsiv(program, 1, &index, GL_UNIFORM_BLOCK_INDEX, &memberBlock);
+        if (memberBlock != (GLint)block)
+            continue;
+        glGetActiveUniformsiv(program, 1, &index, GL_UNIFORM_OFFSET, &reflected[k].offset);
+        glGetActiveUniformsiv(program, 1, &index, GL_UNIFORM_TYPE, &reflected[k].type);
+        glGetActiveUniformsiv(program, 1, &index, GL_UNIFORM_SIZE, &reflected[k].arraySize);
+        glGetActiveUniformsiv(program, 1, &index, GL_UNIFORM_ARRAY_STRIDE, &reflected[k].arrayStride);
+        glGetActiveUniformsiv(program, 1, &index, GL_UNIFORM_MATRIX_STRIDE, &reflected[k].matrixStride);
+    }
+    bool ok = checkUniformLayout<S>(blockName, dataSize, reflected);
+    glUniformBlockBinding(program, block, binding);
+    return ok;
+}
+
+// The same for a shader storage block (GL 4.3), std430 or std140.
+template<typename S>
+bool bindStorageBlock(GLuint program, const char* blockName, GLuint binding)
+{
+    typedef UniformBlockTraits<S> Traits;
+    if (!GLAD_GL_VERSION_4_3)
+    {
+        std::cout << "ERROR::UNIFORM_BLOCK::NO_STORAGE_BUFFERS" << std::endl;
+        return false;
+    }
+    GLuint block = glGetProgramResourceIndex(program, GL_SHADER_STORAGE_BLOCK, blockName);
+    if (block == GL_INVALID_INDEX)
+    {
+        std::cout << "ERROR::UNIFORM_BLOCK::NOT_FOUND " << blockName << std::endl;
+        return false;
+    }
+    GLenum sizeProperty = GL_BUFFER_DATA_SIZE;
+    GLint dataSize = 0;
+    glGetProgramResourceiv(program, GL_SHADER_STORAGE_BLOCK, block, 1, &sizeProperty, 1, NULL, &dataSize);
+
+    ReflectedUniform reflected[Traits::count];
+    for (size_t k = 0; k < Traits::count; k++)
+    {
+        reflected[k].offset = -1;
+        GLuint index = GL_INVALID_INDEX;
+        for (int qualified = 0; qualified < 2 && index == GL_INVALID_INDEX; qualified++)
+        {
+            std::string name = reflectedUniformName(blockName, Traits::names[k], Traits::members[k].arraySize != 0, qualified != 0);
+            index = glGetProgramResourceIndex(program, GL_BUFFER_VARIABLE, name.c_str());
+        }
+        if (index == GL_INVALID_INDEX)
+            continue;
+        const GLenum properties[] = { GL_BLOCK_INDEX, GL_OFFSET, GL_TYPE, GL_ARRAY_SIZE, GL_ARRAY_STRIDE, GL_MATRIX_STRIDE };
+        GLint values[6];
+        glGetProgramResourceiv(program, GL_BUFFER_VARIABLE, index, 6, properties, 6, NULL, values);
+        if (values[0] != (GLint)block)
+            continue;
+        reflected[k] = ReflectedUniform{ values[1], values[2], values[3], values[4], values[5] };
+    }
+    bool ok = checkUniformLayout<S>(blockName, dataSize, reflected);
+    glShaderStorageBlockBinding(program, block, binding);
+    return ok;
+}
+
+// Any number of blocks S in one GL buffer, each at a multiple of the GL's
+// offset alignment. set() writes one with a single memcpy into a CPU copy,
+// upload() hands them all to the GL in one mapping, bind() points a binding
+// at one of them:
+//
+//   UniformBuffer<ObjectTransform> objects;
+//   objects.create(count);
+//   for (i...) objects.set(i, { model[i] });
+//   objects.upload();
+//   for (i...) { objects.bind(OBJECT_BINDING, i); glDrawArrays(...); }
+template<typename S>
+class UniformBuffer
+{
+public:
+    UniformBuffer() {}
+    ~UniformBuffer() { destroy(); }
+
+    UniformBuffer(const UniformBuffer&) = delete;
+    UniformBuffer& operator=(const UniformBuffer&) = delete;
+
+    // target is GL_UNIFORM_BUFFER or GL_SHADER_STORAGE_BUFFER
+    void create(GLsizei count, GLenum target = GL_UNIFORM_BUFFER)
+    {
+        destroy();
+        this->target = target;
+        capacity = count;
+        GLint alignment = 16;
+        glGetIntegerv(target == GL_UNIFORM_BUFFER ? GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT : GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &alignment);
+        blockStride = uniformAlignUp(uniformBlockSize<S>(), (size_t)std::max(alignment, 16));
+        staging.assign(blockStride * count, 0);
+        buffer = gpuResources().createDynamicBuffer(GPU_UNIFORMS, target, staging.size(), NULL, GL_DYNAMIC_DRAW, "uniform blocks");
+        glBindBuffer(target, 0);
+    }
+
+    void destroy()
+    {
+        buffer.reset();
+        capacity = 0;
+    }
+
+    void set(GLsizei i, const S& block) { std::memcpy(&staging[i * blockStride], &block, sizeof(S)); }
+
+    // the first count blocks, all of them by default, in one copy
+    void upload(GLsizei count = -1)
+    {
+        size_t bytes = blockStride * (count < 0 ? capacity : count);
+        glBindBuffer(target, buffer.id());
+        void* mapped = glMapBufferRange(target, 0, bytes, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+        if (mapped)
+        {
+            std::memcpy(mapped, staging.data(), bytes);
+            glUnmapBuffer(target);
+        }
+        glBindBuffer(target, 0);
+    }
+
+    void bind(GLuint binding, GLsizei i) const
+    {
+        glBindBufferRange(target, binding, buffer.id(), i * blockStride, uniformBlockSize<S>());
+    }
+
+    GLuint id() const { return buffer.id(); }
+    size_t stride() const { return blockStride; }
+
+private:
+    GLenum target = GL_UNIFORM_BUFFER;
+    GpuBuffer buffer;
+    GLsizei capacity = 0;
+    size_t blockStride = 0;
+    std::vector<unsigned char> staging;
+};
+
+#endif
@@ -0,0 +1,367 @@
+#ifndef VERTEX_FORMAT_H
+#define VERTEX_FORMAT_H
+
+#include <glad/glad.h>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/packing.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+// How one vertex attribute is stored in the buffer.
+enum VertexEncoding
+{
+    VERTEX_FLOAT,       // 4 bytes a component, as given
+    VERTEX_INT16,       // 2 bytes a component on a per-mesh grid: positions
+    VERTEX_HALF,        // 2 bytes a component: texture coordinates
+    VERTEX_UNORM8,      // 1 byte a component, for values in 0..1: colors
+    VERTEX_OCTAHEDRAL   // a unit vector folded onto an octahedron, two snorm16: normals
+};
+
+// Packs interleaved float vertices into a smaller interleaved layout and
+// sets up the matching attribute pointers:
+//
+//   VertexFormat format;
+//   format.add(0, 3, VERTEX_INT16, 0)        // position from floats 0..2
+//         .add(1, 3, VERTEX_UNORM8, 3)       // color from floats 3..5
+//         .add(2, 2, VERTEX_HALF, 6);        // texture coordinates from 6..7
+//   std::vector<unsigned char> packed(4 * format.stride());
+//   format.encode(vertices, 4, 8, packed.data());
+//   glBufferData(GL_ARRAY_BUFFER, packed.size(), packed.data(), GL_STATIC_DRAW);
+//   format.setAttributes();
+//
+// An INT16 attribute reaches the shader as whole numbers; scale(location)
+// and offset(location), or dequantize(location) as a matrix to put in front
+// of the model matrix, turn them back into the mesh's units. The scale is a
+// power of two, so values on a binary grid (pixel positions, +-0.5) come
+// back exactly. Normals are decoded with octahedralDecode() in
+// resources/shaders/common/quantized.glsl.
+//
+// encode() decodes what it wrote and compares it with the source; an
+// attribute off by more than its encoding allows is reported, and
+// error(location) holds the largest difference either way.
+class VertexFormat
+{
+public:
+    VertexFormat& add(GLuint location, int components, VertexEncoding encoding, int source)
+    {
+        Attribute a;
+        a.location = location;
+        a.components = encoding == VERTEX_OCTAHEDRAL ? 3 : components;
+        a.encoding = encoding;
+        a.source = source;
+        a.offset = vertexSize;
+        attributes.push_back(a);
+        vertexSize += storedSize(a);
+        return *this;
+    }
+
+    // bytes an encoded vertex takes
+    GLsizei stride() const { return vertexSize; }
+
+    // Packs count vertices, sourceStride floats apart, into
+    // count * stride() bytes at out.
+    void encode(const float* vertices, size_t count, int sourceStride, unsigned char* out)
+    {
+        for (Attribute& a : attributes)
+        {
+            if (a.encoding == VERTEX_INT16)
+                fitGrid(a, vertices, count, sourceStride);
+            for (size_t i = 0; i < count; i++)
+                encodeValue(a, vertices + i * sourceStride + a.source, out + i * vertexSize + a.offset);
+            checkError(a, vertices, count, sourceStride, out);
+        }
+    }
+
+    // the value encode() stored for one attribute of vertex i, as the shader
+    // ends up with it after dequantization
+    glm::vec4 decode(const unsigned char* encoded, size_t i, GLuint location) const
+    {
+        const Attribute* a = find(location);
+        return a ? decodeValue(*a, encoded + i * vertexSize + a->offset) : glm::vec4(0.0f);
+    }
+
+    // attribute pointers into the buffer bound to GL_ARRAY_BUFFER, for the
+    // bound vertex array
+    void setAttributes() const
+    {
+        for (const Attribute& a : attributes)
+        {
+            const void* offset = (const void*)(uintptr_t)a.offset;
+            switch (a.encoding)
+            {
+            case VERTEX_FLOAT:
+                glVertexAttribPointer(a.location, a.components, GL_FLOAT, GL_FALSE, vertexSize, offset);
+                break;
+            case VERTEX_INT16:
+                glVertexAttribPointer(a.location, a.components, GL_SHORT, GL_FALSE, vertexSize, offset);
+                break;
+            case VERTEX_HALF:
+                glVertexAttribPointer(a.location, a.components, GL_HALF_FLOAT, GL_FALSE, vertexSize, offset);
+                break;
+            case VERTEX_UNORM8:
+                glVertexAttribPointer(a.location, a.components, GL_UNSIGNED_BYTE, GL_TRUE, vertexSize, offset);
+                break;
+            case VERTEX_OCTAHEDRAL:
+                glVertexAttribPointer(a.location, 2, GL_SHORT, GL_TRUE, vertexSize, offset);
+                break;
+            }
+            glEnableVertexAttribArray(a.location);
+        }
+    }
+
+    // what an INT16 attribute is multiplied by and then offset by in the
+    // shader; 1 and 0 for the others
+    glm::vec3 scale(GLuint location) const
+    {
+        const Attribute* a = find(location);
+        return a ? glm::vec3(a->scale) : glm::vec3(1.0f);
+    }
+    glm::vec3 offset(GLuint location) const
+    {
+        const Attribute* a = find(location);
+        return a ? glm::vec3(a->origin) : glm::vec3(0.0f);
+    }
+    glm::mat4 dequantize(GLuint location) const
+    {
+        return glm::scale(glm::translate(glm::mat4(1.0f), offset(location)), scale(location));
+    }
+
+    // largest difference between a source value and its decoded one, and
+    // the most the encoding may lose, from the last encode()
+    float error(GLuint location) const
+    {
+        const Attribute* a = find(location);
+        return a ? a->maxError : 0.0f;
+    }
+    float errorBound(GLuint location) const
+    {
+        const Attribute* a = find(location);
+        return a ? a->errorBound : 0.0f;
+    }
+
+private:
+    struct Attribute
+    {
+        GLuint location;
+        int components;
+        VertexEncoding encoding;
+        int source;
+        GLsizei offset;
+        glm::vec4 scale = glm::vec4(1.0f);
+        glm::vec4 origin = glm::vec4(0.0f);
+        float step = 0.0f;
+        float maxError = 0.0f;
+        float errorBound = 0.0f;
+    };
+
+    std::vector<Attribute> attributes;
+    GLsizei vertexSize = 0;
+
+    const Attribute* find(GLuint location) const
+    {
+        for (const Attribute& a : attributes)
+            if (a.location == location)
+                return &a;
+        return NULL;
+    }
+
+    // every attribute starts 4-byte aligned: 16 bit ones round up to an
+    // even number of components
+    static GLsizei storedSize(const Attribute& a)
+    {
+        switch (a.encoding)
+        {
+        case VERTEX_FLOAT: return 4 * a.components;
+        case VERTEX_INT16:
+        case VERTEX_HALF: return 2 * ((a.components + 1) & ~1);
+        case VERTEX_UNORM8:
+        case VERTEX_OCTAHEDRAL: return 4;
+        }
+        return 0;
+    }
+
+    // centers the grid on the values' bounds, with the smallest power of two
+    // step that still reaches both ends; a component that never changes is
+    // all offset
+    static void fitGrid(Attribute& a, const float* vertices, size_t count, int sourceStride)
+    {
+        a.step = 0.0f;
+        for (int c = 0; c < a.components; c++)
+        {
+            float lo = INFINITY, hi = -INFINITY;
+            for (size_t i = 0; i < count; i++)
+            {
+                lo = std::min(lo, vertices[i * sourceStride + a.source + c]);
+                hi = std::max(hi, vertices[i * sourceStride + a.source + c]);
+            }
+            if (count == 0)
+                lo = hi = 0.0f;
+            float halfExtent = (hi - lo) * 0.5f;
+            if (!(halfExtent > 0.0f))
+            {
+                a.origin[c] = lo;
+                a.scale[c] = 1.0f;
+                continue;
+            }
+            a.origin[c] = lo + halfExtent;
+            a.scale[c] = std::exp2(std::ceil(std::log2(halfExtent / 32767.0f)));
+            // the center rounded to the grid, so exact values stay exact
+            a.origin[c] = std::round(a.origin[c] / a.scale[c]) * a.scale[c];
+            if (std::abs(hi - a.origin[c]) > 32767.0f * a.scale[c] || std::abs(lo - a.origin[c]) > 32767.0f * a.scale[c])
+                a.scale[c] *= 2.0f;
+            a.step = std::max(a.step, a.scale[c]);
+        }
+    }
+
+    static void encodeValue(const Attribute& a, const float* v, unsigned char* out)
+    {
+        switch (a.encoding)
+        {
+        case VERTEX_FLOAT:
+            std::memcpy(out, v, 4 * a.components);
+            break;
+        case VERTEX_INT16:
+            for (int c = 0; c < a.components; c++)
+            {
+                float q = std::round((v[c] - a.origin[c]) / a.scale[c]);
+                int16_t s = (int16_t)std::max(-32767.0f, std::min(32767.0f, q));
+                std::memcpy(out + 2 * c, &s, 2);
+            }
+            break;
+        case VERTEX_HALF:
+            for (int c = 0; c < a.components; c++)
+            {
+                uint16_t h = (uint16_t)glm::packHalf1x16(v[c]);
+                std::memcpy(out + 2 * c, &h, 2);
+            }
+            break;
+        case VERTEX_UNORM8:
+            for (int c = 0; c < 4; c++)
+            {
+                float value = c < a.components ? v[c] : 1.0f;
+                out[c] = (unsigned char)std::round(std::max(0.0f, std::min(1.0f, value)) * 255.0f);
+            }
+            break;
+        case VERTEX_OCTAHEDRAL:
+        {
+            glm::vec2 e = octahedralEncode(glm::vec3(v[0], v[1], v[2]));
+            for (int c = 0; c < 2; c++)
+            {
+                int16_t s = (int16_t)std::round(std::max(-1.0f, std::min(1.0f, e[c])) * 32767.0f);
+                std::memcpy(out + 2 * c, &s, 2);
+            }
+            break;
+        }
+        }
+    }
+
+    static glm::vec4 decodeValue(const Attribute& a, const unsigned char* in)
+    {
+        glm::vec4 value(0.0f);
+        switch (a.encoding)
+        {
+        case VERTEX_FLOAT:
+            std::memcpy(&value[0], in, 4 * a.components);
+            break;
+        case VERTEX_INT16:
+            for (int c = 0; c < a.components; c++)
+            {
+                int16_t s;
+                std::memcpy(&s, in + 2 * c, 2);
+                value[c] = s * a.scale[c] + a.origin[c];
+            }
+            break;
+        case VERTEX_HALF:
+            for (int c = 0; c < a.components; c++)
+            {
+                uint16_t h;
+                std::memcpy(&h, in + 2 * c, 2);
+                value[c] = glm::unpackHalf1x16(h);
+            }
+            break;
+        case VERTEX_UNORM8:
+            for (int c = 0; c < a.components; c++)
+                value[c] = in[c] / 255.0f;
+            break;
+        case VERTEX_OCTAHEDRAL:
+        {
+            int16_t s[2];
+            std::memcpy(s, in, 4);
+            glm::vec3 n = octahedralDecode(glm::vec2(std::max(s[0] / 32767.0f, -1.0f), std::max(s[1] / 32767.0f, -1.0f)));
+            value = glm::vec4(n, 0.0f);
+            break;
+        }
+        }
+        return value;
+    }
+
+    // the unit vector projected onto |x| + |y| + |z| = 1, the lower half
+    // folded over the upper one's corners
+    static glm::vec2 octahedralEncode(glm::vec3 n)
+    {
+        n /= std::abs(n.x) + std::abs(n.y) + std::abs(n.z);
+        glm::vec2 e(n.x, n.y);
+        if (n.z < 0.0f)
+            e = (1.0f - glm::abs(glm::vec2(e.y, e.x))) * glm::vec2(e.x >= 0.0f ? 1.0f : -1.0f, e.y >= 0.0f ? 1.0f : -1.0f);
+        return e;
+    }
+
+    static glm::vec3 octahedralDecode(glm::vec2 e)
+    {
+        glm::vec3 n(e.x, e.y, 1.0f - std::abs(e.x) - std::abs(e.y));
+        float t = std::max(-n.z, 0.0f);
+        n.x += n.x >= 0.0f ? -t : t;
+        n.y += n.y >= 0.0f ? -t : t;
+        return glm::normalize(n);
+    }
+
+    // compares every decoded value with its source
+    void checkError(Attribute& a, const float* vertices, size_t count, int sourceStride, const unsigned char* out)
+    {
+        float largest = 0.0f;
+        a.maxError = 0.0f;
+        for (size_t i = 0; i < count; i++)
+        {
+            const float* v = vertices + i * sourceStride + a.source;
+            glm::vec4 decoded = decodeValue(a, out + i * vertexSize + a.offset);
+            glm::vec4 expected(0.0f);
+            for (int c = 0; c < a.components; c++)
+                expected[c] = v[c];
+            if (a.encoding == VERTEX_OCTAHEDRAL)
+                expected = glm::vec4(glm::normalize(glm::vec3(expected)), 0.0f);
+            for (int c = 0; c < a.components; c++)
+            {
+                float difference = std::abs(decoded[c] - expected[c]);
+                // NaN counts as the worst error there is
+                a.maxError = difference > a.maxError || difference != difference ? difference : a.maxError;
+                largest = std::max(largest, std::abs(expected[c]));
+            }
+        }
+
+        switch (a.encoding)
+        {
+        case VERTEX_FLOAT: a.errorBound = 0.0f; break;
+        // half a step, and the float rounding of adding the offset back
+        case VERTEX_INT16: a.errorBound = 0.5f * a.step + largest * 0x1p-23f; break;
+        // half a unit in the last of 11 significant bits, or of the
+        // smallest subnormal
+        case VERTEX_HALF: a.errorBound = largest * 0x1p-11f + 0x1p-25f; break;
+        case VERTEX_UNORM8: a.errorBound = 0.5f / 255.0f + 0x1p-23f; break;
+        // half a step of the octahedron's grid, stretched by at most
+        // sqrt(2) each way by the projection back onto the sphere
+        case VERTEX_OCTAHEDRAL: a.errorBound = 2.0f / 32767.0f; break;
+        }
+        if (!(a.maxError <= a.errorBound))
+            std::cout << "ERROR::VERTEX_FORMAT::PRECISION location " << a.location << " off by " << a.maxError
+                      << ", more than " << a.errorBound << std::endl;
+    }
+};
+
+#endif
@@ -271,6 +271,36 @@ RECENT REVISION HISTORY:
 // you have issues compiling it, you can disable it entirely by
 // defining STBI_NO_SIMD.
 //
+// With GCC, Clang and VC++ 2012 or later the x86 JPEG decoder also has AVX2
+// kernels (two blocks per IDCT, dequantization, YCbCr-to-RGB) that are
+// selected by a run-time CPUID test and produce the same bits as the SSE2
+// ones. Define STBI_NO_AVX2 to leave them out.
+//
+// The PNG decoder uses SSE2 too, for the Sub, Up, Average and Paeth filters
+// of 8-bit RGB and RGBA rows (Up for every format), after the same run-time
+// test. Its inflater refills a 64-bit bit buffer once per symbol and decodes
+// two literals per table lookup where the codes are short enough.
+//
+// ===========================================================================
+//
+// Parallel JPEG decoding
+//
+// Baseline JPEGs that contain restart markers (DRI) can have their restart
+// intervals entropy-decoded on several threads. stb_image doesn't create
+// threads itself; give it a parallel-for with
+//
+//     stbi_set_parallel_for(my_parallel_for, my_user_data);
+//
+// which must call task(task_data, i) once for every i in [0,count), on any
+// threads, and return once all calls have returned. It is only used for
+// images loaded from memory (stbi_load_from_memory and friends), since the
+// intervals are located by scanning ahead in the compressed data; other
+// streams, and streams whose markers don't match the restart interval, go
+// through the serial decoder. So does a scan in which any interval fails to
+// decode or doesn't end at its marker: it is decoded again serially, so a
+// corrupt stream gives the serial decoder's error or image. The output is
+// identical either way.
+//
 // ===========================================================================
 //
 // HDR image support   (disable by defining STBI_NO_HDR)
@@ -420,6 +450,17 @@ typedef struct
 STBIDEF stbi_uc *stbi_load_from_memory   (stbi_uc           const *buffer, int len   , int *x, int *y, int *channels_in_file, int desired_channels);
 STBIDEF stbi_uc *stbi_load_from_callbacks(stbi_io_callbacks const *clbk  , void *user, int *x, int *y, int *channels_in_file, int desired_channels);
 
+// Same as stbi_load_from_memory, but the pixels are written to 'out' (for
+// example a mapped pixel buffer object) instead of a new allocation. 'out_len'
+// must hold x*y*(desired_channels ? desired_channels : channels_in_file)
+// bytes; use stbi_info_from_memory to size it, which reports the channels a
+// decode with desired_channels == 0 writes, including the alpha a tRNS chunk
+// adds to a grey or RGB PNG. Returns 1 on success, 0 on
+// failure, including "buffer too small". Non-interlaced 8-bit PNGs that need
+// no conversion are unfiltered straight into 'out', other images are decoded
+// as usual and copied.
+STBIDEF int      stbi_load_from_memory_into(stbi_uc const *buffer, int len, stbi_uc *out, int out_len, int *x, int *y, int *channels_in_file, int desired_channels);
+
 #ifndef STBI_NO_STDIO
 STBIDEF stbi_uc *stbi_load            (char const *filename, int *x, int *y, int *channels_in_file, int desired_channels);
 STBIDEF stbi_uc *stbi_load_from_file  (FILE *f, int *x, int *y, int *channels_in_file, int desired_channels);
@@ -514,6 +555,10 @@ STBIDEF void stbi_convert_iphone_png_to_rgb(int flag_true_if_should_convert);
 // flip the image vertically, so the first pixel in the output array is the bottom left
 STBIDEF void stbi_set_flip_vertically_on_load(int flag_true_if_should_flip);
 
+// decode the restart intervals of in-memory JPEGs through 'func', see "Parallel JPEG decoding"; NULL (the default) decodes serially
+typedef void stbi_parallel_for_func(void *user, int count, void (*task)(void *task_data, int index), void *task_data);
+STBIDEF void stbi_set_parallel_for(stbi_parallel_for_func *func, void *user);
+
 // as above, but only applies to images loaded on the thread that calls the function
 // this function is only available if your compiler supports thread-local variables;
 // calling it will fail to link if your compiler doesn't
@@ -747,7 +792,7 @@ static int stbi__cpuid3(void)
 
 #define STBI_SIMD_ALIGN(type, name) __declspec(align(16)) type name
 
-#if !defined(STBI_NO_JPEG) && defined(STBI_SSE2)
+#if (!defined(STBI_NO_JPEG) || !defined(STBI_NO_PNG)) && defined(STBI_SSE2)
 static int stbi__sse2_available(void)
 {
    int info3 = stbi__cpuid3();
@@ -758,7 +803,7 @@ static int stbi__sse2_available(void)
 #else // assume GCC-style if not VC++
 #define STBI_SIMD_ALIGN(type, name) type name __attribute__((aligned(16)))
 
-#if !defined(STBI_NO_JPEG) && defined(STBI_SSE2)
+#if (!defined(STBI_NO_JPEG) || !defined(STBI_NO_PNG)) && defined(STBI_SSE2)
 static int stbi__sse2_available(void)
 {
    // If we're even attempting to compile this on GCC/Clang, that means
@@ -771,6 +816,35 @@ static int stbi__sse2_available(void)
 #endif
 #endif
 
+// AVX2 kernels are compiled with a per-function target attribute and picked at
+// run time, so unlike SSE2 they don't need any compiler flag
+#if defined(STBI_SSE2) && !defined(STBI_NO_AVX2) && !defined(STBI_NO_JPEG) && (defined(__GNUC__) || (defined(_MSC_VER) && _MSC_VER >= 1700))
+#define STBI_AVX2
+#include <immintrin.h>
+
+#ifdef _MSC_VER
+#define STBI__AVX2_TARGET
+
+static int stbi__avx2_available(void)
+{
+   int info[4];
+   __cpuid(info, 1);
+   // the OS must support AVX (OSXSAVE, AVX) and save the ymm registers
+   if (((info[2] >> 27) & 1) == 0 || ((info[2] >> 28) & 1) == 0) return 0;
+   if ((_xgetbv(0) & 6) != 6) return 0;
+   __cpuidex(info, 7, 0);
+   return ((info[1] >> 5) & 1) != 0;
+}
+#else
+#define STBI__AVX2_TARGET __attribute__((target("avx2")))
+
+static int stbi__avx2_available(void)
+{
+   return __builtin_cpu_supports("avx2");
+}
+#endif
+#endif
+
 // ARM NEON
 #if defined(STBI_NO_SIMD) && defined(STBI_NEON)
 #undef STBI_NEON
@@ -814,6 +888,10 @@ typedef struct
 
    stbi_uc *img_buffer, *img_buffer_end;
    stbi_uc *img_buffer_original, *img_buffer_original_end;
+
+   // caller's pixel buffer from stbi_load_from_memory_into, or NULL
+   stbi_uc *out_buffer;
+   int out_buffer_len;
 } stbi__context;
 
 
@@ -827,6 +905,8 @@ static void stbi__start_mem(stbi__context *s, stbi_uc const *buffer, int len)
    s->callback_already_read = 0;
    s->img_buffer = s->img_buffer_original = (stbi_uc *) buffer;
    s->img_buffer_end = s->img_buffer_original_end = (stbi_uc *) buffer+len;
+   s->out_buffer = NULL;
+   s->out_buffer_len = 0;
 }
 
 // initialize a callback-based context
@@ -840,6 +920,8 @@ static void stbi__start_callbacks(stbi__context *s, stbi_io_callbacks *c, void *
    s->img_buffer = s->img_buffer_original = s->buffer_start;
    stbi__refill_buffer(s);
    s->img_buffer_original_end = s->img_buffer_end;
+   s->out_buffer = NULL;
+   s->out_buffer_len = 0;
 }
 
 #ifndef STBI_NO_STDIO
@@ -1098,6 +1180,15 @@ STBIDEF void stbi_set_flip_vertically_on_load(int flag_true_if_should_flip)
    stbi__vertically_flip_on_load_global = flag_true_if_should_flip;
 }
 
+static stbi_parallel_for_func *stbi__parallel_for = NULL;
+static void *stbi__parallel_for_user = NULL;
+
+STBIDEF void stbi_set_parallel_for(stbi_parallel_for_func *func, void *user)
+{
+   stbi__parallel_for = func;
+   stbi__parallel_for_user = user;
+}
+
 #ifndef STBI_THREAD_LOCAL
 #define stbi__vertically_flip_on_load  stbi__vertically_flip_on_load_global
 #else
@@ -1413,6 +1504,33 @@ STBIDEF stbi_uc *stbi_load_from_memory(stbi_uc const *buffer, int len, int *x, i
    return stbi__load_and_postprocess_8bit(&s,x,y,comp,req_comp);
 }
 
+STBIDEF int stbi_load_from_memory_into(stbi_uc const *buffer, int len, stbi_uc *out, int out_len, int *x, int *y, int *comp, int req_comp)
+{
+   stbi__context s;
+   stbi_uc *result;
+   int w, h, n, channels;
+   stbi__start_mem(&s,buffer,len);
+   s.out_buffer = out;
+   s.out_buffer_len = out_len;
+   result = stbi__load_and_postprocess_8bit(&s,&w,&h,&n,req_comp);
+   if (result == NULL) return 0;
+   if (result != out) {
+      // decoded into a buffer of its own: req_comp channels, or else the n
+      // it reports, which is also what stbi_info_from_memory reports
+      channels = req_comp ? req_comp : n;
+      if (!stbi__mad3sizes_valid(w, h, channels, 0) || w*h*channels > out_len) {
+         STBI_FREE(result);
+         return stbi__err("buffer too small", "Output buffer too small");
+      }
+      memcpy(out, result, w*h*channels);
+      STBI_FREE(result);
+   }
+   if (x) *x = w;
+   if (y) *y = h;
+   if (comp) *comp = n;
+   return 1;
+}
+
 STBIDEF stbi_uc *stbi_load_from_callbacks(stbi_io_callbacks const *clbk, void *user, int *x, int *y, int *comp, int req_comp)
 {
    stbi__context s;
@@ -1976,6 +2094,9 @@ typedef struct
 
 // kernels
    void (*idct_block_kernel)(stbi_uc *out, int out_stride, short data[64]);
+   // two blocks at once, NULL if there is no such kernel
+   void (*idct_block2_kernel)(stbi_uc *out0, int out_stride0, short data0[64], stbi_uc *out1, int out_stride1, short data1[64]);
+   void (*dequantize_kernel)(short *data, stbi__uint16 *dequant);
    void (*YCbCr_to_RGB_kernel)(stbi_uc *out, const stbi_uc *y, const stbi_uc *pcb, const stbi_uc *pcr, int count, int step);
    stbi_uc *(*resample_row_hv_2_kernel)(stbi_uc *out, stbi_uc *in_near, stbi_uc *in_far, int w, int hs);
 } stbi__jpeg;
@@ -2670,6 +2791,204 @@ static void stbi__idct_simd(stbi_uc *out, int out_stride, short data[64])
 
 #endif // STBI_SSE2
 
+#ifdef STBI_AVX2
+// avx2 version of the sse2 IDCT above for two blocks at a time, one in each
+// 128-bit lane. Every instruction used works within lanes, so each block goes
+// through exactly the sse2 arithmetic and the output is bit-identical.
+static STBI__AVX2_TARGET void stbi__idct_avx2_2(stbi_uc *out0, int out_stride0, short data0[64], stbi_uc *out1, int out_stride1, short data1[64])
+{
+   __m256i row0, row1, row2, row3, row4, row5, row6, row7;
+   __m256i tmp;
+
+   // dot product constant: even elems=x, odd elems=y
+   #define dct_const(x,y)  _mm256_set1_epi32((int) (((unsigned int) (y) << 16) | ((unsigned int) (x) & 0xffff)))
+
+   // out(0) = c0[even]*x + c0[odd]*y   (c0, x, y 16-bit, out 32-bit)
+   // out(1) = c1[even]*x + c1[odd]*y
+   #define dct_rot(out0,out1, x,y,c0,c1) \
+      __m256i c0##lo = _mm256_unpacklo_epi16((x),(y)); \
+      __m256i c0##hi = _mm256_unpackhi_epi16((x),(y)); \
+      __m256i out0##_l = _mm256_madd_epi16(c0##lo, c0); \
+      __m256i out0##_h = _mm256_madd_epi16(c0##hi, c0); \
+      __m256i out1##_l = _mm256_madd_epi16(c0##lo, c1); \
+      __m256i out1##_h = _mm256_madd_epi16(c0##hi, c1)
+
+   // out = in << 12  (in 16-bit, out 32-bit)
+   #define dct_widen(out, in) \
+      __m256i out##_l = _mm256_srai_epi32(_mm256_unpacklo_epi16(_mm256_setzero_si256(), (in)), 4); \
+      __m256i out##_h = _mm256_srai_epi32(_mm256_unpackhi_epi16(_mm256_setzero_si256(), (in)), 4)
+
+   // wide add
+   #define dct_wadd(out, a, b) \
+      __m256i out##_l = _mm256_add_epi32(a##_l, b##_l); \
+      __m256i out##_h = _mm256_add_epi32(a##_h, b##_h)
+
+   // wide sub
+   #define dct_wsub(out, a, b) \
+      __m256i out##_l = _mm256_sub_epi32(a##_l, b##_l); \
+      __m256i out##_h = _mm256_sub_epi32(a##_h, b##_h)
+
+   // butterfly a/b, add bias, then shift by "s" and pack
+   #define dct_bfly32o(out0, out1, a,b,bias,s) \
+      { \
+         __m256i abiased_l = _mm256_add_epi32(a##_l, bias); \
+         __m256i abiased_h = _mm256_add_epi32(a##_h, bias); \
+         dct_wadd(sum, abiased, b); \
+         dct_wsub(dif, abiased, b); \
+         out0 = _mm256_packs_epi32(_mm256_srai_epi32(sum_l, s), _mm256_srai_epi32(sum_h, s)); \
+         out1 = _mm256_packs_epi32(_mm256_srai_epi32(dif_l, s), _mm256_srai_epi32(dif_h, s)); \
+      }
+
+   // 8-bit interleave step (for transposes)
+   #define dct_interleave8(a, b) \
+      tmp = a; \
+      a = _mm256_unpacklo_epi8(a, b); \
+      b = _mm256_unpackhi_epi8(tmp, b)
+
+   // 16-bit interleave step (for transposes)
+   #define dct_interleave16(a, b) \
+      tmp = a; \
+      a = _mm256_unpacklo_epi16(a, b); \
+      b = _mm256_unpackhi_epi16(tmp, b)
+
+   #define dct_pass(bias,shift) \
+      { \
+         /* even part */ \
+         dct_rot(t2e,t3e, row2,row6, rot0_0,rot0_1); \
+         __m256i sum04 = _mm256_add_epi16(row0, row4); \
+         __m256i dif04 = _mm256_sub_epi16(row0, row4); \
+         dct_widen(t0e, sum04); \
+         dct_widen(t1e, dif04); \
+         dct_wadd(x0, t0e, t3e); \
+         dct_wsub(x3, t0e, t3e); \
+         dct_wadd(x1, t1e, t2e); \
+         dct_wsub(x2, t1e, t2e); \
+         /* odd part */ \
+         dct_rot(y0o,y2o, row7,row3, rot2_0,rot2_1); \
+         dct_rot(y1o,y3o, row5,row1, rot3_0,rot3_1); \
+         __m256i sum17 = _mm256_add_epi16(row1, row7); \
+         __m256i sum35 = _mm256_add_epi16(row3, row5); \
+         dct_rot(y4o,y5o, sum17,sum35, rot1_0,rot1_1); \
+         dct_wadd(x4, y0o, y4o); \
+         dct_wadd(x5, y1o, y5o); \
+         dct_wadd(x6, y2o, y5o); \
+         dct_wadd(x7, y3o, y4o); \
+         dct_bfly32o(row0,row7, x0,x7,bias,shift); \
+         dct_bfly32o(row1,row6, x1,x6,bias,shift); \
+         dct_bfly32o(row2,row5, x2,x5,bias,shift); \
+         dct_bfly32o(row3,row4, x3,x4,bias,shift); \
+      }
+
+   __m256i rot0_0 = dct_const(stbi__f2f(0.5411961f), stbi__f2f(0.5411961f) + stbi__f2f(-1.847759065f));
+   __m256i rot0_1 = dct_const(stbi__f2f(0.5411961f) + stbi__f2f( 0.765366865f), stbi__f2f(0.5411961f));
+   __m256i rot1_0 = dct_const(stbi__f2f(1.175875602f) + stbi__f2f(-0.899976223f), stbi__f2f(1.175875602f));
+   __m256i rot1_1 = dct_const(stbi__f2f(1.175875602f), stbi__f2f(1.175875602f) + stbi__f2f(-2.562915447f));
+   __m256i rot2_0 = dct_const(stbi__f2f(-1.961570560f) + stbi__f2f( 0.298631336f), stbi__f2f(-1.961570560f));
+   __m256i rot2_1 = dct_const(stbi__f2f(-1.961570560f), stbi__f2f(-1.961570560f) + stbi__f2f( 3.072711026f));
+   __m256i rot3_0 = dct_const(stbi__f2f(-0.390180644f) + stbi__f2f( 2.053119869f), stbi__f2f(-0.390180644f));
+   __m256i rot3_1 = dct_const(stbi__f2f(-0.390180644f), stbi__f2f(-0.390180644f) + stbi__f2f( 1.501321110f));
+
+   // rounding biases in column/row passes, see stbi__idct_block for explanation.
+   __m256i bias_0 = _mm256_set1_epi32(512);
+   __m256i bias_1 = _mm256_set1_epi32(65536 + (128<<17));
+
+   // load, block 0 in the low lane and block 1 in the high lane
+   #define dct_load(row, k) \
+      row = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_load_si128((const __m128i *) (data0 + (k)*8))), \
+                                    _mm_load_si128((const __m128i *) (data1 + (k)*8)), 1)
+   dct_load(row0, 0);
+   dct_load(row1, 1);
+   dct_load(row2, 2);
+   dct_load(row3, 3);
+   dct_load(row4, 4);
+   dct_load(row5, 5);
+   dct_load(row6, 6);
+   dct_load(row7, 7);
+
+   // column pass
+   dct_pass(bias_0, 10);
+
+   {
+      // 16bit 8x8 transpose pass 1
+      dct_interleave16(row0, row4);
+      dct_interleave16(row1, row5);
+      dct_interleave16(row2, row6);
+      dct_interleave16(row3, row7);
+
+      // transpose pass 2
+      dct_interleave16(row0, row2);
+      dct_interleave16(row1, row3);
+      dct_interleave16(row4, row6);
+      dct_interleave16(row5, row7);
+
+      // transpose pass 3
+      dct_interleave16(row0, row1);
+      dct_interleave16(row2, row3);
+      dct_interleave16(row4, row5);
+      dct_interleave16(row6, row7);
+   }
+
+   // row pass
+   dct_pass(bias_1, 17);
+
+   {
+      // pack
+      __m256i p0 = _mm256_packus_epi16(row0, row1);
+      __m256i p1 = _mm256_packus_epi16(row2, row3);
+      __m256i p2 = _mm256_packus_epi16(row4, row5);
+      __m256i p3 = _mm256_packus_epi16(row6, row7);
+
+      // 8bit 8x8 transpose pass 1
+      dct_interleave8(p0, p2);
+      dct_interleave8(p1, p3);
+
+      // transpose pass 2
+      dct_interleave8(p0, p1);
+      dct_interleave8(p2, p3);
+
+      // transpose pass 3
+      dct_interleave8(p0, p2);
+      dct_interleave8(p1, p3);
+
+      // store each lane to its block
+      #define dct_store(out, out_stride, q0, q1, q2, q3) \
+         _mm_storel_epi64((__m128i *) out, q0); out += out_stride; \
+         _mm_storel_epi64((__m128i *) out, _mm_shuffle_epi32(q0, 0x4e)); out += out_stride; \
+         _mm_storel_epi64((__m128i *) out, q2); out += out_stride; \
+         _mm_storel_epi64((__m128i *) out, _mm_shuffle_epi32(q2, 0x4e)); out += out_stride; \
+         _mm_storel_epi64((__m128i *) out, q1); out += out_stride; \
+         _mm_storel_epi64((__m128i *) out, _mm_shuffle_epi32(q1, 0x4e)); out += out_stride; \
+         _mm_storel_epi64((__m128i *) out, q3); out += out_stride; \
+         _mm_storel_epi64((__m128i *) out, _mm_shuffle_epi32(q3, 0x4e))
+      dct_store(out0, out_stride0, _mm256_castsi256_si128(p0), _mm256_castsi256_si128(p1), _mm256_castsi256_si128(p2), _mm256_castsi256_si128(p3));
+      dct_store(out1, out_stride1, _mm256_extracti128_si256(p0, 1), _mm256_extracti128_si256(p1, 1), _mm256_extracti128_si256(p2, 1), _mm256_extracti128_si256(p3, 1));
+   }
+
+#undef dct_const
+#undef dct_rot
+#undef dct_widen
+#undef dct_wadd
+#undef dct_wsub
+#undef dct_bfly32o
+#undef dct_interleave8
+#undef dct_interleave16
+#undef dct_pass
+#undef dct_load
+#undef dct_store
+}
+
+static STBI__AVX2_TARGET void stbi__jpeg_dequantize_avx2(short *data, stbi__uint16 *dequant)
+{
+   int i;
+   // the low 16 bits of the product, like the truncation in the C version
+   for (i=0; i < 64; i += 16) {
+      __m256i d = _mm256_loadu_si256((__m256i const *) (data + i));
+      __m256i q = _mm256_loadu_si256((__m256i const *) (dequant + i));
+      _mm256_storeu_si256((__m256i *) (data + i), _mm256_mullo_epi16(d, q));
+   }
+}
+#endif // STBI_AVX2
+
 #ifdef STBI_NEON
 
 // NEON integer IDCT. should produce bit-identical
@@ -2912,67 +3231,234 @@ static void stbi__jpeg_reset(stbi__jpeg *j)
    // since we don't even allow 1<<30 pixels
 }
 
-static int stbi__parse_entropy_coded_data(stbi__jpeg *z)
+// IDCTs blocks in pairs when there is a two-block kernel, otherwise one by one
+typedef struct
 {
-   stbi__jpeg_reset(z);
-   if (!z->progressive) {
-      if (z->scan_n == 1) {
-         int i,j;
-         STBI_SIMD_ALIGN(short, data[64]);
-         int n = z->order[0];
-         // non-interleaved data, we just need to process one block at a time,
-         // in trivial scanline order
-         // number of blocks to do just depends on how many actual "pixels" this
-         // component has, independent of interleaved MCU blocking and such
-         int w = (z->img_comp[n].x+7) >> 3;
-         int h = (z->img_comp[n].y+7) >> 3;
-         for (j=0; j < h; ++j) {
-            for (i=0; i < w; ++i) {
+   STBI_SIMD_ALIGN(short, data[2][64]); // decode buffers for baseline blocks
+   short *pending_data;
+   stbi_uc *pending_out;
+   int pending_stride;
+   int pending;
+} stbi__idct_queue;
+
+static void stbi__idct_queue_init(stbi__idct_queue *q)
+{
+   q->pending = 0;
+}
+
+// buffer the next baseline block should be decoded into
+static short *stbi__idct_queue_buffer(stbi__idct_queue *q)
+{
+   return q->data[q->pending];
+}
+
+// data must stay untouched until the queue is flushed or the next block is pushed
+static void stbi__idct_queue_push(stbi__jpeg *z, stbi__idct_queue *q, stbi_uc *out, int out_stride, short *data)
+{
+   if (!z->idct_block2_kernel) {
+      z->idct_block_kernel(out, out_stride, data);
+   } else if (q->pending) {
+      z->idct_block2_kernel(q->pending_out, q->pending_stride, q->pending_data, out, out_stride, data);
+      q->pending = 0;
+   } else {
+      q->pending_data = data;
+      q->pending_out = out;
+      q->pending_stride = out_stride;
+      q->pending = 1;
+   }
+}
+
+static void stbi__idct_queue_flush(stbi__jpeg *z, stbi__idct_queue *q)
+{
+   if (q->pending)
+      z->idct_block_kernel(q->pending_out, q->pending_stride, q->pending_data);
+   q->pending = 0;
+}
+
+// number of MCUs in a baseline scan; in a non-interleaved scan every block is an MCU
+static int stbi__jpeg_mcu_count(stbi__jpeg *z)
+{
+   if (z->scan_n == 1) {
+      int n = z->order[0];
+      // number of blocks to do just depends on how many actual "pixels" this
+      // component has, independent of interleaved MCU blocking and such
+      return ((z->img_comp[n].x+7) >> 3) * ((z->img_comp[n].y+7) >> 3);
+   }
+   return z->img_mcu_x * z->img_mcu_y;
+}
+
+// decode and IDCT MCU number 'mcu' of a baseline scan
+static int stbi__jpeg_decode_mcu(stbi__jpeg *z, stbi__idct_queue *q, int mcu)
+{
+   if (z->scan_n == 1) {
+      // non-interleaved data, we just need to process one block at a time,
+      // in trivial scanline order
+      int n = z->order[0];
+      int w = (z->img_comp[n].x+7) >> 3;
+      int i = mcu % w, j = mcu / w;
+      int ha = z->img_comp[n].ha;
+      short *data = stbi__idct_queue_buffer(q);
+      if (!stbi__jpeg_decode_block(z, data, z->huff_dc+z->img_comp[n].hd, z->huff_ac+ha, z->fast_ac[ha], n, z->dequant[z->img_comp[n].tq])) return 0;
+      stbi__idct_queue_push(z, q, z->img_comp[n].data+z->img_comp[n].w2*j*8+i*8, z->img_comp[n].w2, data);
+   } else { // interleaved
+      int k,x,y;
+      int i = mcu % z->img_mcu_x, j = mcu / z->img_mcu_x;
+      // scan an interleaved mcu... process scan_n components in order
+      for (k=0; k < z->scan_n; ++k) {
+         int n = z->order[k];
+         // scan out an mcu's worth of this component; that's just determined
+         // by the basic H and V specified for the component
+         for (y=0; y < z->img_comp[n].v; ++y) {
+            for (x=0; x < z->img_comp[n].h; ++x) {
+               int x2 = (i*z->img_comp[n].h + x)*8;
+               int y2 = (j*z->img_comp[n].v + y)*8;
                int ha = z->img_comp[n].ha;
+               short *data = stbi__idct_queue_buffer(q);
                if (!stbi__jpeg_decode_block(z, data, z->huff_dc+z->img_comp[n].hd, z->huff_ac+ha, z->fast_ac[ha], n, z->dequant[z->img_comp[n].tq])) return 0;
-               z->idct_block_kernel(z->img_comp[n].data+z->img_comp[n].w2*j*8+i*8, z->img_comp[n].w2, data);
-               // every data block is an MCU, so countdown the restart interval
-               if (--z->todo <= 0) {
-                  if (z->code_bits < 24) stbi__grow_buffer_unsafe(z);
-                  // if it's NOT a restart, then just bail, so we get corrupt data
-                  // rather than no data
-                  if (!STBI__RESTART(z->marker)) return 1;
-                  stbi__jpeg_reset(z);
-               }
+               stbi__idct_queue_push(z, q, z->img_comp[n].data+z->img_comp[n].w2*y2+x2, z->img_comp[n].w2, data);
             }
          }
-         return 1;
-      } else { // interleaved
-         int i,j,k,x,y;
-         STBI_SIMD_ALIGN(short, data[64]);
-         for (j=0; j < z->img_mcu_y; ++j) {
-            for (i=0; i < z->img_mcu_x; ++i) {
-               // scan an interleaved mcu... process scan_n components in order
-               for (k=0; k < z->scan_n; ++k) {
-                  int n = z->order[k];
-                  // scan out an mcu's worth of this component; that's just determined
-                  // by the basic H and V specified for the component
-                  for (y=0; y < z->img_comp[n].v; ++y) {
-                     for (x=0; x < z->img_comp[n].h; ++x) {
-                        int x2 = (i*z->img_comp[n].h + x)*8;
-                        int y2 = (j*z->img_comp[n].v + y)*8;
-                        int ha = z->img_comp[n].ha;
-                        if (!stbi__jpeg_decode_block(z, data, z->huff_dc+z->img_comp[n].hd, z->huff_ac+ha, z->fast_ac[ha], n, z->dequant[z->img_comp[n].tq])) return 0;
-                        z->idct_block_kernel(z->img_comp[n].data+z->img_comp[n].w2*y2+x2, z->img_comp[n].w2, data);
-                     }
-                  }
-               }
-               // after all interleaved components, that's an interleaved MCU,
-               // so now count down the restart interval
-               if (--z->todo <= 0) {
-                  if (z->code_bits < 24) stbi__grow_buffer_unsafe(z);
-                  if (!STBI__RESTART(z->marker)) return 1;
-                  stbi__jpeg_reset(z);
-               }
-            }
+      }
+   }
+   return 1;
+}
+
+// restart intervals handed to one task are decoded with a private copy of the
+// decoder state, so there is a memcpy of stbi__jpeg per task
+#define STBI__JPEG_MAX_TASKS 64
+
+typedef struct
+{
+   stbi__jpeg *z;
+   stbi_uc **starts;   // first entropy-coded byte of every restart interval
+   int intervals;
+   int tasks;
+   int mcu_count;
+   int *ok;            // result of every task
+} stbi__jpeg_restart_job;
+
+static void stbi__jpeg_decode_restart_task(void *task_data, int task)
+{
+   stbi__jpeg_restart_job *job = (stbi__jpeg_restart_job *) task_data;
+   // spread the remainder over the first tasks
+   int per_task = job->intervals / job->tasks, extra = job->intervals % job->tasks;
+   int first = task * per_task + (task < extra ? task : extra);
+   int last = first + per_task + (task < extra ? 1 : 0);
+   int r, mcu, ok = 1;
+   stbi__idct_queue q;
+   stbi__context s;
+   stbi__jpeg *j = (stbi__jpeg *) stbi__malloc(sizeof(stbi__jpeg));
+   if (!j) { job->ok[task] = 0; return; }
+   memcpy(j, job->z, sizeof(*j));
+   memset(&s, 0, sizeof(s));
+   s.img_buffer_end = job->z->s->img_buffer_end;
+   j->s = &s;
+   stbi__idct_queue_init(&q);
+   for (r = first; r < last && ok; ++r) {
+      int end = (r+1) * j->restart_interval;
+      if (end > job->mcu_count) end = job->mcu_count;
+      s.img_buffer = job->starts[r];
+      stbi__jpeg_reset(j);
+      for (mcu = r * j->restart_interval; mcu < end; ++mcu) {
+         if (!stbi__jpeg_decode_mcu(j, &q, mcu)) { ok = 0; break; }
+      }
+      // the serial decoder stops at an interval that doesn't end at its restart marker
+      if (ok && r+1 < job->intervals) {
+         if (j->code_bits < 24) stbi__grow_buffer_unsafe(j);
+         if (!STBI__RESTART(j->marker)) ok = 0;
+      }
+   }
+   stbi__idct_queue_flush(j, &q);
+   STBI_FREE(j);
+   job->ok[task] = ok;
+}
+
+// Decodes a baseline scan with one task per group of restart intervals.
+// Returns -1 without consuming anything if the scan can't be split, or if any
+// interval failed to decode or didn't end at its marker, in which case the
+// serial decoder runs as usual and gives its own result for the corrupt stream.
+static int stbi__jpeg_parallel_restarts(stbi__jpeg *z)
+{
+   stbi__context *s = z->s;
+   stbi__jpeg_restart_job job;
+   stbi_uc *p, *scan_end = NULL;
+   int i, n, ok = 1;
+
+   if (!stbi__parallel_for || !z->restart_interval || s->read_from_callbacks)
+      return -1;
+   job.mcu_count = stbi__jpeg_mcu_count(z);
+   job.intervals = (job.mcu_count + z->restart_interval - 1) / z->restart_interval;
+   if (job.intervals < 2)
+      return -1;
+   job.starts = (stbi_uc **) stbi__malloc_mad2(job.intervals, sizeof(stbi_uc *), 0);
+   if (!job.starts)
+      return -1;
+
+   // find the restart markers; a 0xff data byte is always followed by a
+   // stuffed 0, anything else after 0xff (and fill bytes) is a marker
+   job.starts[0] = s->img_buffer;
+   n = 1;
+   p = s->img_buffer;
+   while (p < s->img_buffer_end) {
+      stbi_uc *q = (stbi_uc *) memchr(p, 0xff, s->img_buffer_end - p);
+      if (!q) break;
+      p = q + 1;
+      while (p < s->img_buffer_end && *p == 0xff) ++p;
+      if (p == s->img_buffer_end) break;
+      if (*p == 0) { ++p; continue; }
+      if (!STBI__RESTART(*p)) { scan_end = q; break; }
+      if (n == job.intervals) break; // more markers than intervals
+      job.starts[n++] = ++p;
+   }
+   if (n != job.intervals || !scan_end) {
+      STBI_FREE(job.starts);
+      return -1;
+   }
+
+   job.z = z;
+   job.tasks = job.intervals < STBI__JPEG_MAX_TASKS ? job.intervals : STBI__JPEG_MAX_TASKS;
+   job.ok = (int *) stbi__malloc_mad2(job.tasks, sizeof(int), 0);
+   if (!job.ok) {
+      STBI_FREE(job.starts);
+      return -1;
+   }
+   stbi__parallel_for(stbi__parallel_for_user, job.tasks, stbi__jpeg_decode_restart_task, &job);
+   for (i=0; i < job.tasks; ++i)
+      ok &= job.ok[i];
+   STBI_FREE(job.ok);
+   STBI_FREE(job.starts);
+   if (!ok) return -1;
+
+   // leave the stream where the serial decoder would: at the marker ending the scan
+   stbi__jpeg_reset(z);
+   s->img_buffer = scan_end;
+   return 1;
+}
+
+static int stbi__parse_entropy_coded_data(stbi__jpeg *z)
+{
+   stbi__jpeg_reset(z);
+   if (!z->progressive) {
+      stbi__idct_queue q;
+      int mcu, mcu_count;
+      int parallel = stbi__jpeg_parallel_restarts(z);
+      if (parallel >= 0) return parallel;
+
+      mcu_count = stbi__jpeg_mcu_count(z);
+      stbi__idct_queue_init(&q);
+      for (mcu=0; mcu < mcu_count; ++mcu) {
+         if (!stbi__jpeg_decode_mcu(z, &q, mcu)) return 0;
+         // count down the restart interval after every MCU
+         if (--z->todo <= 0) {
+            if (z->code_bits < 24) stbi__grow_buffer_unsafe(z);
+            // if it's NOT a restart, then just bail, so we get corrupt data
+            // rather than no data
+            if (!STBI__RESTART(z->marker)) break;
+            stbi__jpeg_reset(z);
          }
-         return 1;
       }
+      stbi__idct_queue_flush(z, &q);
+      return 1;
    } else {
       if (z->scan_n == 1) {
          int i,j;
@@ -3048,17 +3534,20 @@ static void stbi__jpeg_finish(stbi__jpeg *z)
    if (z->progressive) {
       // dequantize and idct the data
       int i,j,n;
+      stbi__idct_queue q;
+      stbi__idct_queue_init(&q);
       for (n=0; n < z->s->img_n; ++n) {
          int w = (z->img_comp[n].x+7) >> 3;
          int h = (z->img_comp[n].y+7) >> 3;
          for (j=0; j < h; ++j) {
             for (i=0; i < w; ++i) {
                short *data = z->img_comp[n].coeff + 64 * (i + j * z->img_comp[n].coeff_w);
-               stbi__jpeg_dequantize(data, z->dequant[z->img_comp[n].tq]);
-               z->idct_block_kernel(z->img_comp[n].data+z->img_comp[n].w2*j*8+i*8, z->img_comp[n].w2, data);
+               z->dequantize_kernel(data, z->dequant[z->img_comp[n].tq]);
+               stbi__idct_queue_push(z, &q, z->img_comp[n].data+z->img_comp[n].w2*j*8+i*8, z->img_comp[n].w2, data);
             }
          }
       }
+      stbi__idct_queue_flush(z, &q);
    }
 }
 
@@ -3763,10 +4252,76 @@ static void stbi__YCbCr_to_RGB_simd(stbi_uc *out, stbi_uc const *y, stbi_uc cons
 }
 #endif
 
+#ifdef STBI_AVX2
+// the sse2 step == 4 loop above on 16 pixels at a time: pixels 0-7 go through
+// the low lane and 8-15 through the high lane with the same arithmetic
+static STBI__AVX2_TARGET void stbi__YCbCr_to_RGB_avx2(stbi_uc *out, stbi_uc const *y, stbi_uc const *pcb, stbi_uc const *pcr, int count, int step)
+{
+   int i = 0;
+   if (step == 4) {
+      __m256i signflip  = _mm256_set1_epi8(-0x80);
+      __m256i cr_const0 = _mm256_set1_epi16(   (short) ( 1.40200f*4096.0f+0.5f));
+      __m256i cr_const1 = _mm256_set1_epi16( - (short) ( 0.71414f*4096.0f+0.5f));
+      __m256i cb_const0 = _mm256_set1_epi16( - (short) ( 0.34414f*4096.0f+0.5f));
+      __m256i cb_const1 = _mm256_set1_epi16(   (short) ( 1.77200f*4096.0f+0.5f));
+      __m256i y_bias = _mm256_set1_epi8((char) (unsigned char) 128);
+      __m256i xw = _mm256_set1_epi16(255); // alpha channel
+
+      for (; i+15 < count; i += 16) {
+         // load, and move bytes 8-15 to the bottom of the high lane
+         __m256i y_bytes  = _mm256_permute4x64_epi64(_mm256_castsi128_si256(_mm_loadu_si128((__m128i const *) (y+i))), 0x50);
+         __m256i cr_bytes = _mm256_permute4x64_epi64(_mm256_castsi128_si256(_mm_loadu_si128((__m128i const *) (pcr+i))), 0x50);
+         __m256i cb_bytes = _mm256_permute4x64_epi64(_mm256_castsi128_si256(_mm_loadu_si128((__m128i const *) (pcb+i))), 0x50);
+         __m256i cr_biased = _mm256_xor_si256(cr_bytes, signflip); // -128
+         __m256i cb_biased = _mm256_xor_si256(cb_bytes, signflip); // -128
+
+         // unpack to short (and left-shift cr, cb by 8)
+         __m256i yw  = _mm256_unpacklo_epi8(y_bias, y_bytes);
+         __m256i crw = _mm256_unpacklo_epi8(_mm256_setzero_si256(), cr_biased);
+         __m256i cbw = _mm256_unpacklo_epi8(_mm256_setzero_si256(), cb_biased);
+
+         // color transform
+         __m256i yws = _mm256_srli_epi16(yw, 4);
+         __m256i cr0 = _mm256_mulhi_epi16(cr_const0, crw);
+         __m256i cb0 = _mm256_mulhi_epi16(cb_const0, cbw);
+         __m256i cb1 = _mm256_mulhi_epi16(cbw, cb_const1);
+         __m256i cr1 = _mm256_mulhi_epi16(crw, cr_const1);
+         __m256i rws = _mm256_add_epi16(cr0, yws);
+         __m256i gwt = _mm256_add_epi16(cb0, yws);
+         __m256i bws = _mm256_add_epi16(yws, cb1);
+         __m256i gws = _mm256_add_epi16(gwt, cr1);
+
+         // descale
+         __m256i rw = _mm256_srai_epi16(rws, 4);
+         __m256i bw = _mm256_srai_epi16(bws, 4);
+         __m256i gw = _mm256_srai_epi16(gws, 4);
+
+         // back to byte, set up for transpose
+         __m256i brb = _mm256_packus_epi16(rw, bw);
+         __m256i gxb = _mm256_packus_epi16(gw, xw);
+
+         // transpose to interleave channels
+         __m256i t0 = _mm256_unpacklo_epi8(brb, gxb);
+         __m256i t1 = _mm256_unpackhi_epi8(brb, gxb);
+         __m256i o0 = _mm256_unpacklo_epi16(t0, t1); // pixels 0-3 | 8-11
+         __m256i o1 = _mm256_unpackhi_epi16(t0, t1); // pixels 4-7 | 12-15
+
+         // store
+         _mm256_storeu_si256((__m256i *) (out + 0), _mm256_permute2x128_si256(o0, o1, 0x20));
+         _mm256_storeu_si256((__m256i *) (out + 32), _mm256_permute2x128_si256(o0, o1, 0x31));
+         out += 64;
+      }
+   }
+   stbi__YCbCr_to_RGB_simd(out, y+i, pcb+i, pcr+i, count-i, step);
+}
+#endif
+
 // set up the kernels
 static void stbi__setup_jpeg(stbi__jpeg *j)
 {
    j->idct_block_kernel = stbi__idct_block;
+   j->idct_block2_kernel = NULL;
+   j->dequantize_kernel = stbi__jpeg_dequantize;
    j->YCbCr_to_RGB_kernel = stbi__YCbCr_to_RGB_row;
    j->resample_row_hv_2_kernel = stbi__resample_row_hv_2;
 
@@ -3775,6 +4330,13 @@ static void stbi__setup_jpeg(stbi__jpeg *j)
       j->idct_block_kernel = stbi__idct_simd;
       j->YCbCr_to_RGB_kernel = stbi__YCbCr_to_RGB_simd;
       j->resample_row_hv_2_kernel = stbi__resample_row_hv_2_simd;
+#ifdef STBI_AVX2
+      if (stbi__avx2_available()) {
+         j->idct_block2_kernel = stbi__idct_avx2_2;
+         j->dequantize_kernel = stbi__jpeg_dequantize_avx2;
+         j->YCbCr_to_RGB_kernel = stbi__YCbCr_to_RGB_avx2;
+      }
+#endif
    }
 #endif
 
@@ -4027,6 +4589,8 @@ static int stbi__jpeg_info(stbi__context *s, int *x, int *y, int *comp)
 //      - all output is written to a single output buffer (can malloc/realloc)
 //    performance
 //      - fast huffman
+//      - 64-bit bit buffer, refilled 8 bytes at a time away from the ends
+//      - literal pairs decoded with one table lookup
 
 #ifndef STBI_NO_ZLIB
 
@@ -4034,6 +4598,14 @@ static int stbi__jpeg_info(stbi__context *s, int *x, int *y, int *comp)
 #define STBI__ZFAST_BITS  9 // accelerate all cases in default tables
 #define STBI__ZFAST_MASK  ((1 << STBI__ZFAST_BITS) - 1)
 #define STBI__ZNSYMS 288 // number of symbols in literal/length alphabet
+#define STBI__ZPAIR_BITS  11 // literal pair table, see stbi__zbuild_pairs
+#define STBI__ZPAIR_MASK  ((1 << STBI__ZPAIR_BITS) - 1)
+
+#ifdef _MSC_VER
+typedef unsigned __int64 stbi__zbits;
+#else
+typedef unsigned long long stbi__zbits;
+#endif
 
 // zlib-style huffman encoding
 // (jpegs packs from left, zlib from right, so can't share code)
@@ -4121,7 +4693,7 @@ typedef struct
 {
    stbi_uc *zbuffer, *zbuffer_end;
    int num_bits;
-   stbi__uint32 code_buffer;
+   stbi__zbits code_buffer;
 
    char *zout;
    char *zout_start;
@@ -4129,6 +4701,7 @@ typedef struct
    int   z_expandable;
 
    stbi__zhuffman z_length, z_distance;
+   stbi__uint32 z_pair[1 << STBI__ZPAIR_BITS];
 } stbi__zbuf;
 
 stbi_inline static int stbi__zeof(stbi__zbuf *z)
@@ -4144,20 +4717,39 @@ stbi_inline static stbi_uc stbi__zget8(stbi__zbuf *z)
 static void stbi__fill_bits(stbi__zbuf *z)
 {
    do {
-      if (z->code_buffer >= (1U << z->num_bits)) {
+      if (z->code_buffer >= ((stbi__zbits) 1 << z->num_bits)) {
         z->zbuffer = z->zbuffer_end;  /* treat this as EOF so we fail. */
         return;
       }
-      z->code_buffer |= (unsigned int) stbi__zget8(z) << z->num_bits;
+      z->code_buffer |= (stbi__zbits) stbi__zget8(z) << z->num_bits;
       z->num_bits += 8;
    } while (z->num_bits <= 24);
 }
 
+// tops the bit buffer up to 56..63 bits with one unaligned 8-byte read;
+// needs 8 readable bytes. The bytes past the ones counted in num_bits are
+// read again by the next refill, which ORs the same values over them.
+stbi_inline static void stbi__fill_bits_wide(stbi__zbuf *z)
+{
+   stbi__zbits v;
+#if (defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) || defined(_M_IX86) || defined(_M_X64) || defined(_M_ARM64)
+   memcpy(&v, z->zbuffer, 8);
+#else
+   int i;
+   v = 0;
+   for (i=7; i >= 0; --i)
+      v = (v << 8) | z->zbuffer[i];
+#endif
+   z->code_buffer |= v << z->num_bits;
+   z->zbuffer += (63 - z->num_bits) >> 3;
+   z->num_bits |= 56;
+}
+
 stbi_inline static unsigned int stbi__zreceive(stbi__zbuf *z, int n)
 {
    unsigned int k;
    if (z->num_bits < n) stbi__fill_bits(z);
-   k = z->code_buffer & ((1 << n) - 1);
+   k = (unsigned int) (z->code_buffer & ((1 << n) - 1));
    z->code_buffer >>= n;
    z->num_bits -= n;
    return k;
@@ -4168,7 +4760,7 @@ static int stbi__zhuffman_decode_slowpath(stbi__zbuf *a, stbi__zhuffman *z)
    int b,s,k;
    // not resolved by fast table, so compute it the slow way
    // use jpeg approach, which requires MSbits at top
-   k = stbi__bit_reverse(a->code_buffer, 16);
+   k = stbi__bit_reverse((int) (a->code_buffer & 0xffff), 16);
    for (s=STBI__ZFAST_BITS+1; ; ++s)
       if (k < z->maxcode[s])
          break;
@@ -4237,11 +4829,107 @@ static const int stbi__zdist_base[32] = { 1,2,3,4,5,7,9,13,17,25,33,49,65,97,129
 static const int stbi__zdist_extra[32] =
 { 0,0,0,0,1,1,2,2,3,3,4,4,5,5,6,6,7,7,8,8,9,9,10,10,11,11,12,12,13,13};
 
+// z_pair[i] holds the literals that the low STBI__ZPAIR_BITS bits i decode
+// to: sym1 | sym2 << 8 | count << 16 | bits << 24, with count 1 or 2, or 0
+// if the first code is no literal or too long for the fast table
+static void stbi__zbuild_pairs(stbi__zbuf *a)
+{
+   int i;
+   for (i=0; i < (1 << STBI__ZPAIR_BITS); ++i) {
+      int b1 = a->z_length.fast[i & STBI__ZFAST_MASK];
+      stbi__uint32 e = 0;
+      if (b1 && (b1 & 511) < 256) {
+         int s1 = b1 >> 9;
+         int b2 = a->z_length.fast[(i >> s1) & STBI__ZFAST_MASK];
+         int s2 = b2 >> 9;
+         if (b2 && (b2 & 511) < 256 && s1 + s2 <= STBI__ZPAIR_BITS)
+            e = (stbi__uint32) (b1 & 255) | ((stbi__uint32) (b2 & 255) << 8) | (2 << 16) | ((stbi__uint32) (s1 + s2) << 24);
+         else
+            e = (stbi__uint32) (b1 & 255) | (1 << 16) | ((stbi__uint32) s1 << 24);
+      }
+      a->z_pair[i] = e;
+   }
+}
+
+// room for the longest match plus the 8-byte overshoot of the match copy
+#define STBI__ZFAST_OUT_SLACK  (258 + 8)
+
+// Inner loop for the bulk of a block: with 8 bytes of input left every
+// symbol gets by with one unchecked refill (a length/distance pair takes at
+// most 48 bits), and with STBI__ZFAST_OUT_SLACK bytes of output the stores
+// need no bounds checks. Returns 1 at the end of the block, 0 on error and
+// 2 when either end comes near, for the careful loop to continue.
+static int stbi__parse_huffman_block_fast(stbi__zbuf *a, char **pzout)
+{
+   char *zout = *pzout;
+   int result = 2;
+   while (a->zout_end - zout >= STBI__ZFAST_OUT_SLACK && a->zbuffer_end - a->zbuffer >= 8) {
+      stbi__uint32 e;
+      int z, len, dist;
+      char *p;
+      stbi__fill_bits_wide(a);
+      e = a->z_pair[a->code_buffer & STBI__ZPAIR_MASK];
+      if (e) {
+         zout[0] = (char) (e & 255);
+         zout[1] = (char) ((e >> 8) & 255);
+         zout += (e >> 16) & 3;
+         a->code_buffer >>= e >> 24;
+         a->num_bits -= e >> 24;
+         continue;
+      }
+      z = stbi__zhuffman_decode(a, &a->z_length);
+      if (z < 256) {
+         if (z < 0) { result = stbi__err("bad huffman code","Corrupt PNG"); break; }
+         *zout++ = (char) z;
+         continue;
+      }
+      if (z == 256) { result = 1; break; }
+      z -= 257;
+      len = stbi__zlength_base[z];
+      if (stbi__zlength_extra[z]) len += stbi__zreceive(a, stbi__zlength_extra[z]);
+      z = stbi__zhuffman_decode(a, &a->z_distance);
+      if (z < 0) { result = stbi__err("bad huffman code","Corrupt PNG"); break; }
+      dist = stbi__zdist_base[z];
+      if (stbi__zdist_extra[z]) dist += stbi__zreceive(a, stbi__zdist_extra[z]);
+      if (zout - a->zout_start < dist) { result = stbi__err("bad dist","Corrupt PNG"); break; }
+      p = zout - dist;
+      if (dist >= 8) { // 8-byte chunks never overlap their source
+         char *end = zout + len;
+         do {
+            memcpy(zout, p, 8);
+            zout += 8;
+            p += 8;
+         } while (zout < end);
+         zout = end;
+      } else if (dist == 1) {
+         memset(zout, *p, len);
+         zout += len;
+      } else {
+         if (len) { do *zout++ = *p++; while (--len); }
+      }
+   }
+   // hand the whole bytes still in the bit buffer back to the input, so the
+   // careful loop and stored blocks see the state they expect
+   a->zbuffer -= a->num_bits >> 3;
+   a->num_bits &= 7;
+   a->code_buffer &= ((stbi__zbits) 1 << a->num_bits) - 1;
+   *pzout = zout;
+   return result;
+}
+
 static int stbi__parse_huffman_block(stbi__zbuf *a)
 {
    char *zout = a->zout;
    for(;;) {
-      int z = stbi__zhuffman_decode(a, &a->z_length);
+      int z;
+      if (a->zout_end - zout >= STBI__ZFAST_OUT_SLACK && a->zbuffer_end - a->zbuffer >= 8) {
+         int r = stbi__parse_huffman_block_fast(a, &zout);
+         if (r != 2) {
+            a->zout = zout;
+            return r;
+         }
+      }
+      z = stbi__zhuffman_decode(a, &a->z_length);
       if (z < 256) {
          if (z < 0) return stbi__err("bad huffman code","Corrupt PNG"); // error in huffman codes
          if (zout >= a->zout_end) {
@@ -4423,6 +5111,7 @@ static int stbi__parse_zlib(stbi__zbuf *a, int parse_header)
          } else {
             if (!stbi__compute_huffman_codes(a)) return 0;
          }
+         stbi__zbuild_pairs(a);
          if (!stbi__parse_huffman_block(a)) return 0;
       }
    } while (!final);
@@ -4554,6 +5243,7 @@ typedef struct
    stbi__context *s;
    stbi_uc *idata, *expanded, *out;
    int depth;
+   int out_is_caller_buffer; // out is s->out_buffer, don't free it
 } stbi__png;
 
 
@@ -4588,6 +5278,102 @@ static int stbi__paeth(int a, int b, int c)
    return c;
 }
 
+#ifdef STBI_SSE2
+stbi_inline static __m128i stbi__png_load_pixel(const stbi_uc *p, int n)
+{
+   int v = 0;
+   if (n == 4) memcpy(&v, p, 4); else memcpy(&v, p, 3);
+   return _mm_cvtsi32_si128(v);
+}
+
+stbi_inline static void stbi__png_store_pixel(stbi_uc *p, __m128i v, int n)
+{
+   int x = _mm_cvtsi128_si32(v);
+   if (n == 4) memcpy(p, &x, 4); else memcpy(p, &x, 3);
+}
+
+// Sub, Avg and Paeth depend on the pixel to the left, so they go one pixel
+// of n bytes per step, loading and storing 'bytes' (n, or 4 while there is
+// room behind the pixel); both are constants after inlining
+stbi_inline static void stbi__png_unfilter_pixels_sse2(int filter, stbi_uc *cur, const stbi_uc *prior, const stbi_uc *raw, int nk, int n, int bytes)
+{
+   __m128i zero = _mm_setzero_si128();
+   __m128i a = stbi__png_load_pixel(cur - n, n);
+   int k;
+   if (filter == STBI__F_sub) {
+      for (k=0; k < nk; k += n) {
+         a = _mm_add_epi8(a, stbi__png_load_pixel(raw + k, bytes));
+         stbi__png_store_pixel(cur + k, a, bytes);
+      }
+   } else if (filter == STBI__F_avg) {
+      // pavgb rounds up, the filter rounds down
+      __m128i one = _mm_set1_epi8(1);
+      for (k=0; k < nk; k += n) {
+         __m128i b = stbi__png_load_pixel(prior + k, bytes);
+         __m128i avg = _mm_sub_epi8(_mm_avg_epu8(a, b), _mm_and_si128(_mm_xor_si128(a, b), one));
+         a = _mm_add_epi8(avg, stbi__png_load_pixel(raw + k, bytes));
+         stbi__png_store_pixel(cur + k, a, bytes);
+      }
+   } else {
+      // in 16-bit lanes: pa = |b-c|, pb = |a-c|, pc = |a+b-2c|; ties go a, b, c
+      __m128i c = _mm_unpacklo_epi8(stbi__png_load_pixel(prior - n, n), zero);
+      a = _mm_unpacklo_epi8(a, zero);
+      for (k=0; k < nk; k += n) {
+         __m128i b = _mm_unpacklo_epi8(stbi__png_load_pixel(prior + k, bytes), zero);
+         __m128i pa = _mm_sub_epi16(b, c);
+         __m128i pb = _mm_sub_epi16(a, c);
+         __m128i pc = _mm_add_epi16(pa, pb);
+         __m128i smallest, use_a, use_b, nearest;
+         pa = _mm_max_epi16(pa, _mm_sub_epi16(zero, pa));
+         pb = _mm_max_epi16(pb, _mm_sub_epi16(zero, pb));
+         pc = _mm_max_epi16(pc, _mm_sub_epi16(zero, pc));
+         smallest = _mm_min_epi16(pc, _mm_min_epi16(pa, pb));
+         use_a = _mm_cmpeq_epi16(smallest, pa);
+         use_b = _mm_cmpeq_epi16(smallest, pb);
+         nearest = _mm_or_si128(_mm_and_si128(use_b, b), _mm_andnot_si128(use_b, c));
+         nearest = _mm_or_si128(_mm_and_si128(use_a, a), _mm_andnot_si128(use_a, nearest));
+         a = _mm_add_epi8(_mm_packus_epi16(nearest, nearest), stbi__png_load_pixel(raw + k, bytes));
+         stbi__png_store_pixel(cur + k, a, bytes);
+         a = _mm_unpacklo_epi8(a, zero);
+         c = b;
+      }
+   }
+}
+
+// unfilters the pixels after the first of a row; returns 0 for the filters
+// and pixel sizes it leaves to the scalar loops
+static int stbi__png_unfilter_sse2(int filter, stbi_uc *cur, const stbi_uc *prior, const stbi_uc *raw, int nk, int filter_bytes)
+{
+   int k = 0;
+   if (filter == STBI__F_up) {
+      for (; k + 16 <= nk; k += 16) {
+         __m128i d = _mm_loadu_si128((const __m128i *) (raw + k));
+         __m128i b = _mm_loadu_si128((const __m128i *) (prior + k));
+         _mm_storeu_si128((__m128i *) (cur + k), _mm_add_epi8(d, b));
+      }
+      for (; k < nk; ++k)
+         cur[k] = STBI__BYTECAST(raw[k] + prior[k]);
+      return 1;
+   }
+   if (filter != STBI__F_sub && filter != STBI__F_avg && filter != STBI__F_paeth)
+      return 0;
+   if (filter_bytes == 4) {
+      stbi__png_unfilter_pixels_sse2(filter, cur, prior, raw, nk, 4, 4);
+   } else if (filter_bytes == 3) {
+      // 4-byte accesses spill into the next pixel, which is rewritten next;
+      // only the row's last pixel has to stay within 3 bytes
+      int body = nk - 3;
+      if (body > 0)
+         stbi__png_unfilter_pixels_sse2(filter, cur, prior, raw, body, 3, 4);
+      if (nk > 0)
+         stbi__png_unfilter_pixels_sse2(filter, cur + body, prior + body, raw + body, 3, 3, 3);
+   } else {
+      return 0;
+   }
+   return 1;
+}
+#endif
+
 static const stbi_uc stbi__depth_scale_table[9] = { 0, 0xff, 0x55, 0, 0x11, 0,0,0, 0x01 };
 
 // create the png data from post-deflated data
@@ -4603,10 +5389,19 @@ static int stbi__create_png_image_raw(stbi__png *a, stbi_uc *raw, stbi__uint32 r
    int output_bytes = out_n*bytes;
    int filter_bytes = img_n*bytes;
    int width = x;
+#ifdef STBI_SSE2
+   int sse2 = stbi__sse2_available();
+#endif
 
    STBI_ASSERT(out_n == s->img_n || out_n == s->img_n+1);
-   a->out = (stbi_uc *) stbi__malloc_mad3(x, y, output_bytes, 0); // extra bytes to write off the end into
-   if (!a->out) return stbi__err("outofmem", "Out of memory");
+   if (a->out_is_caller_buffer) {
+      if (!stbi__mad3sizes_valid(x, y, output_bytes, 0) || x*y*output_bytes > (stbi__uint32) s->out_buffer_len)
+         return stbi__err("buffer too small", "Output buffer too small");
+      a->out = s->out_buffer;
+   } else {
+      a->out = (stbi_uc *) stbi__malloc_mad3(x, y, output_bytes, 0); // extra bytes to write off the end into
+      if (!a->out) return stbi__err("outofmem", "Out of memory");
+   }
 
    if (!stbi__mad3sizes_valid(img_n, x, depth, 7)) return stbi__err("too large", "Corrupt PNG");
    img_width_bytes = (((img_n * x * depth) + 7) >> 3);
@@ -4675,6 +5470,9 @@ static int stbi__create_png_image_raw(stbi__png *a, stbi_uc *raw, stbi__uint32 r
          #define STBI__CASE(f) \
              case f:     \
                 for (k=0; k < nk; ++k)
+#ifdef STBI_SSE2
+         if (!(sse2 && stbi__png_unfilter_sse2(filter, cur, prior, raw, nk, filter_bytes)))
+#endif
          switch (filter) {
             // "none" filter turns into a memcpy here; make that explicit.
             case STBI__F_none:         memcpy(cur, raw, nk); break;
@@ -5032,6 +5830,7 @@ static int stbi__parse_png_file(stbi__png *z, int scan, int req_comp)
    z->expanded = NULL;
    z->idata = NULL;
    z->out = NULL;
+   z->out_is_caller_buffer = 0;
 
    if (!stbi__check_png_header(s)) return 0;
 
@@ -5064,7 +5863,7 @@ static int stbi__parse_png_file(stbi__png *z, int scan, int req_comp)
             if (!pal_img_n) {
                s->img_n = (color & 2 ? 3 : 1) + (color & 4 ? 1 : 0);
                if ((1 << 30) / s->img_x / s->img_n < s->img_y) return stbi__err("too large", "Image too large to decode");
-               if (scan == STBI__SCAN_header) return 1;
+               // if SCAN_header, scan on for a tRNS, which adds an alpha channel
             } else {
                // if paletted, then pal_n is our final components, and
                // img_n is # components to decompress/filter.
@@ -5103,6 +5902,7 @@ static int stbi__parse_png_file(stbi__png *z, int scan, int req_comp)
                if (!(s->img_n & 1)) return stbi__err("tRNS with alpha","Corrupt PNG");
                if (c.length != (stbi__uint32) s->img_n*2) return stbi__err("bad tRNS len","Corrupt PNG");
                has_trans = 1;
+               if (scan == STBI__SCAN_header) { ++s->img_n; return 1; }
                if (z->depth == 16) {
                   for (k = 0; k < s->img_n; ++k) tc16[k] = (stbi__uint16)stbi__get16be(s); // copy the values as-is
                } else {
@@ -5115,7 +5915,7 @@ static int stbi__parse_png_file(stbi__png *z, int scan, int req_comp)
          case STBI__PNG_TYPE('I','D','A','T'): {
             if (first) return stbi__err("first not IHDR", "Corrupt PNG");
             if (pal_img_n && !pal_len) return stbi__err("no PLTE","Corrupt PNG");
-            if (scan == STBI__SCAN_header) { s->img_n = pal_img_n; return 1; }
+            if (scan == STBI__SCAN_header) { if (pal_img_n) s->img_n = pal_img_n; return 1; }
             if ((int)(ioff + c.length) < (int)ioff) return 0;
             if (ioff + c.length > idata_limit) {
                stbi__uint32 idata_limit_old = idata_limit;
@@ -5147,6 +5947,9 @@ static int stbi__parse_png_file(stbi__png *z, int scan, int req_comp)
                s->img_out_n = s->img_n+1;
             else
                s->img_out_n = s->img_n;
+            // unfilter straight into the caller's buffer when no later pass
+            // needs a buffer of a different size
+            z->out_is_caller_buffer = s->out_buffer && !interlace && z->depth == 8 && !pal_img_n && (req_comp == 0 || req_comp == s->img_out_n);
             if (!stbi__create_png_image(z, z->expanded, raw_len, s->img_out_n, z->depth, color, interlace)) return 0;
             if (has_trans) {
                if (z->depth == 16) {
@@ -5221,7 +6024,8 @@ static void *stbi__do_png(stbi__png *p, int *x, int *y, int *n, int req_comp, st
       *y = p->s->img_y;
       if (n) *n = p->s->img_n;
    }
-   STBI_FREE(p->out);      p->out      = NULL;
+   if (!p->out_is_caller_buffer) STBI_FREE(p->out);
+   p->out = NULL;
    STBI_FREE(p->expanded); p->expanded = NULL;
    STBI_FREE(p->idata);    p->idata    = NULL;
 
@@ -6,9 +6,13 @@ layout (location = 2) in vec2 aTexCoord;
 out vec3 ourColor;
 out vec2 TexCoord;
 
+// the position's grid (VertexFormat's VERTEX_INT16)
+uniform vec3 positionScale;
+uniform vec3 positionOffset;
+
 void main()
 {
-	gl_Position = vec4(aPos, 1.0);
+	gl_Position = vec4(aPos * positionScale + positionOffset, 1.0);
 	ourColor = aColor;
 	TexCoord = vec2(aTexCoord.x, aTexCoord.y);
 }
@@ -0,0 +1,19 @@
+// decoding of the compact vertex encodings (learnopengl/vertex_format.h)
+
+// an INT16 position arrives in steps of the mesh's grid
+uniform vec3 positionScale;
+uniform vec3 positionOffset;
+
+vec3 dequantizePosition(vec3 p)
+{
+	return p * positionScale + positionOffset;
+}
+
+// an OCTAHEDRAL normal, unfolded back onto the sphere
+vec3 octahedralDecode(vec2 e)
+{
+	vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+	float t = max(-n.z, 0.0);
+	n.xy += mix(vec2(t), vec2(-t), greaterThanEqual(n.xy, vec2(0.0)));
+	return normalize(n);
+}
@@ -0,0 +1,18 @@
+// shared model/view/projection uniforms; with TRANSFORM_BLOCKS they come in
+// two uniform blocks (learnopengl/transform_blocks.h), one set per frame and
+// one per object
+#ifdef TRANSFORM_BLOCKS
+layout (std140) uniform FrameTransforms
+{
+	mat4 projection;
+	mat4 view;
+};
+layout (std140) uniform ObjectTransform
+{
+	mat4 model;
+};
+#else
+uniform mat4 model;
+uniform mat4 view;
+uniform mat4 projection;
+#endif
@@ -0,0 +1,17 @@
+#version 330 core
+out vec4 FragColor;
+
+in vec2 Texel;
+flat in int Glyph;
+flat in vec4 Color;
+
+uniform sampler2D atlas;                // one bit glyphs side by side, as 0 or 1
+uniform ivec2 glyphSize;
+
+void main()
+{
+	ivec2 texel = min(ivec2(Texel), glyphSize - 1);
+	if (texelFetch(atlas, ivec2(Glyph * glyphSize.x + texel.x, texel.y), 0).r < 0.5)
+		discard;
+	FragColor = Color;
+}
@@ -0,0 +1,24 @@
+#version 330 core
+// HUD text (Hud.hpp): one instance per glyph, drawn as a 4 vertex triangle
+// strip whose corners come from gl_VertexID, so only the instances are stored.
+layout (location = 0) in ivec2 aCell;   // top left corner, pixels from the top left
+layout (location = 1) in int aGlyph;    // column of the glyph in the atlas
+layout (location = 2) in vec4 aColor;
+
+uniform vec2 viewport;                  // framebuffer size in pixels
+uniform ivec2 glyphSize;
+uniform int scale;
+
+out vec2 Texel;
+flat out int Glyph;
+flat out vec4 Color;
+
+void main()
+{
+	vec2 corner = vec2(gl_VertexID & 1, gl_VertexID >> 1);
+	vec2 pixel = vec2(aCell) + corner * vec2(glyphSize * scale);
+	gl_Position = vec4(pixel.x / viewport.x * 2.0 - 1.0, 1.0 - pixel.y / viewport.y * 2.0, 0.0, 1.0);
+	Texel = corner * vec2(glyphSize);
+	Glyph = aGlyph;
+	Color = aColor;
+}
@@ -0,0 +1,16 @@
+#version 330 core
+out vec4 FragColor;
+
+in vec3 Normal;
+in vec2 TexCoord;
+in vec4 Color;
+
+uniform vec3 lightDirection;
+
+void main()
+{
+	// a checker in texture space, so the texture coordinates show
+	float checker = mod(floor(TexCoord.x) + floor(TexCoord.y), 2.0);
+	float light = 0.25 + 0.75 * max(dot(normalize(Normal), -lightDirection), 0.0);
+	FragColor = vec4(Color.rgb * light * (0.75 + 0.25 * checker), Color.a);
+}
@@ -0,0 +1,35 @@
+#version 330 core
+// A lit, vertex colored, textured mesh (the vertex format benchmark).
+// Permutations: QUANTIZED, with an INT16 position and an OCTAHEDRAL normal
+layout (location = 0) in vec3 aPos;
+#ifdef QUANTIZED
+layout (location = 1) in vec2 aNormal;
+#else
+layout (location = 1) in vec3 aNormal;
+#endif
+layout (location = 2) in vec2 aTexCoord;
+layout (location = 3) in vec4 aColor;
+
+out vec3 Normal;
+out vec2 TexCoord;
+out vec4 Color;
+
+#include "common/transform.glsl"
+#ifdef QUANTIZED
+#include "common/quantized.glsl"
+#endif
+
+void main()
+{
+#ifdef QUANTIZED
+	vec3 position = dequantizePosition(aPos);
+	vec3 normal = octahedralDecode(aNormal);
+#else
+	vec3 position = aPos;
+	vec3 normal = aNormal;
+#endif
+	gl_Position = projection * view * model * vec4(position, 1.0);
+	Normal = mat3(model) * normal;
+	TexCoord = aTexCoord;
+	Color = aColor;
+}
@@ -0,0 +1,23 @@
+#version 420 core
+out vec4 FragColor;
+#ifdef VERTEX_COLOR
+in vec4 vColor;
+#endif
+#ifdef TEXTURED
+in vec2 TexCoord;
+uniform sampler2D texture1;
+#endif
+
+uniform vec4 color;
+
+void main()
+{
+	vec4 c = color;
+#ifdef VERTEX_COLOR
+	c *= vColor;
+#endif
+#ifdef TEXTURED
+	c *= texture(texture1, TexCoord);
+#endif
+	FragColor = c;
+}
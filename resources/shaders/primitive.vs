@@ -0,0 +1,40 @@
+#version 420 core
+// 2D primitives drawn under an orthographic projection (Quad, Player, LineGrid).
+// Permutations: TEXTURED, INSTANCED, INSTANCED_RECT, VERTEX_COLOR
+layout (location = 0) in vec3 aPos;
+#ifdef VERTEX_COLOR
+layout (location = 1) in vec4 aColor;
+out vec4 vColor;
+#endif
+#ifdef TEXTURED
+layout (location = 2) in vec2 aTexCoord;
+out vec2 TexCoord;
+#endif
+#ifdef INSTANCED
+// per-instance model matrix, occupies locations 3..6
+layout (location = 3) in mat4 aModel;
+#endif
+#ifdef INSTANCED_RECT
+// per-instance axis aligned square: center in xy, edge length in z
+layout (location = 7) in vec3 aRect;
+#endif
+
+uniform mat4 model;
+uniform mat4 projection;
+
+void main()
+{
+#ifdef INSTANCED
+	gl_Position = projection * aModel * vec4(aPos.x, aPos.y, 0.0, 1.0);
+#elif defined(INSTANCED_RECT)
+	gl_Position = projection * vec4(aRect.xy + aPos.xy * aRect.z, 0.0, 1.0);
+#else
+	gl_Position = projection * model * vec4(aPos.x, aPos.y, 0.0, 1.0);
+#endif
+#ifdef VERTEX_COLOR
+	vColor = aColor;
+#endif
+#ifdef TEXTURED
+	TexCoord = aTexCoord;
+#endif
+}
@@ -0,0 +1,28 @@
+#version 330 core
+out vec4 FragColor;
+
+uniform usampler2D cells;               // tile IDs of the resident chunks, the board wrapped around it
+uniform sampler2D atlas;                // tiles of tilePixels squared, atlasColumns to a row; tile 0 is empty
+uniform vec4 viewport;                  // x, y, width, height in pixels
+uniform ivec2 originCell;               // board cell at the viewport's top left
+uniform vec2 originFraction;            // and where in that cell the corner is
+uniform float cellPixels;
+uniform ivec2 boardSize;
+uniform int atlasColumns;
+uniform int tilePixels;
+
+void main()
+{
+	// the origin is split so cells far out on the board keep their precision
+	vec2 pixel = vec2(gl_FragCoord.x - viewport.x, viewport.y + viewport.w - gl_FragCoord.y);
+	vec2 board = originFraction + pixel / cellPixels;
+	ivec2 cell = originCell + ivec2(floor(board));
+	if (any(lessThan(cell, ivec2(0))) || any(greaterThanEqual(cell, boardSize)))
+		discard;
+
+	int id = int(texelFetch(cells, cell % textureSize(cells, 0), 0).r);
+	if (id == 0)
+		discard;
+	ivec2 inTile = min(ivec2(fract(board) * float(tilePixels)), ivec2(tilePixels - 1));
+	FragColor = texelFetch(atlas, ivec2(id % atlasColumns, id / atlasColumns) * tilePixels + inTile, 0);
+}
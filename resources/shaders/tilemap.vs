@@ -0,0 +1,9 @@
+#version 330 core
+// Tile map (TileMap.hpp): one triangle covering the viewport, its corners
+// from gl_VertexID; every tile is resolved per pixel in the fragment shader.
+
+void main()
+{
+	vec2 corner = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+	gl_Position = vec4(corner * 2.0 - 1.0, 0.0, 1.0);
+}
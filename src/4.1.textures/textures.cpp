@@ -5,6 +5,8 @@
 
 //#include <learnopengl/filesystem.h>
 #include <learnopengl/shader_s.h>
+#include <learnopengl/image_loader.h>
+#include <learnopengl/vertex_format.h>
 
 #include <iostream>
 
@@ -50,7 +52,7 @@ int main()
 
     // build and compile our shader zprogram
     // ------------------------------------
-    Shader ourShader("4.1.texture.vs", "4.1.texture.fs"); 
+    Shader ourShader("../../resources/shaders/4.1.texture.vs", "../../resources/shaders/4.1.texture.fs");
 
     // set up vertex data (and buffer(s)) and configure vertex attributes
     // ------------------------------------------------------------------
@@ -72,21 +74,23 @@ int main()
 
     glBindVertexArray(VAO);
 
+    // packed to 16 bytes a vertex from 32: the position as int16, the color
+    // as bytes and the texture coords as half floats
+    VertexFormat format;
+    format.add(0, 3, VERTEX_INT16, 0)
+          .add(1, 3, VERTEX_UNORM8, 3)
+          .add(2, 2, VERTEX_HALF, 6);
+    unsigned char packed[4 * 16];
+    format.encode(vertices, 4, 8, packed);
+
     glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(packed), packed, GL_STATIC_DRAW);
 
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
     glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
 
-    // position attribute
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    // color attribute
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-    // texture coord attribute
-    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(6 * sizeof(float)));
-    glEnableVertexAttribArray(2);
+    // position, color and texture coord attributes
+    format.setAttributes();
 
 
     // load and create a texture 
@@ -103,7 +107,7 @@ int main()
     // load image, create texture and generate mipmaps
     int width, height, nrChannels;
     // The FileSystem::getPath(...) is part of the GitHub repository so we can find files on any IDE/platform; replace it with your own image path.
-    unsigned char *data = stbi_load("../resources/textures/container.jpg", &width, &height, &nrChannels, 0);
+    unsigned char *data = loadImage("../resources/textures/container.jpg", &width, &height, &nrChannels, 0);
     if (data)
     {
         glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, data);
@@ -116,6 +120,12 @@ int main()
     stbi_image_free(data);
 
 
+    // the position comes in grid steps, the shader scales it back
+    ourShader.use();
+    glm::vec3 positionScale = format.scale(0), positionOffset = format.offset(0);
+    glUniform3fv(glGetUniformLocation(ourShader.ID, "positionScale"), 1, &positionScale[0]);
+    glUniform3fv(glGetUniformLocation(ourShader.ID, "positionOffset"), 1, &positionOffset[0]);
+
     // render loop
     // -----------
     while (!glfwWindowShouldClose(window))
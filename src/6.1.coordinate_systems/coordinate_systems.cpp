@@ -51,7 +51,7 @@ int main()
 
     // build and compile our shader zprogram
     // ------------------------------------
-    Shader ourShader("vs", "fs");
+    Shader ourShader("../../resources/shaders/6.1.coordinate_systems.vs", "../../resources/shaders/6.1.coordinate_systems.fs");
 
     // set up vertex data (and buffer(s)) and configure vertex attributes
     // ------------------------------------------------------------------
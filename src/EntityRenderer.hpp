@@ -0,0 +1,107 @@
+#ifndef MY_ENTITY_RENDERER_HPP
+#define MY_ENTITY_RENDERER_HPP
+
+#include <glad/glad.h>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "Shaders.hpp"
+#include "GridEntities.hpp"
+
+#include <cstddef>
+
+namespace myGame {
+
+// Draws every entity with a Position, Extent and Tint as one instanced
+// triangle strip. The per-instance buffer is refilled each frame straight
+// from the component arrays, in parallel, into the mapped buffer.
+class EntityRenderer {
+    GpuVertexArray VAO;
+    GpuBuffer quadVBO;
+    GpuBuffer instanceVBO;
+    size_t capacity = 0;
+    GLuint shaderProgram;
+    GLint colorLoc;
+public:
+    EntityRenderer() {};
+    ~EntityRenderer() { destroy(); };
+
+    /* ONCE */
+    void initialize();
+    // gives the vertex array and buffers back, before the context goes away
+    void destroy();
+
+    void draw(EntityWorld& world, unsigned threads = 0);
+};
+
+void EntityRenderer::initialize()
+{
+    shaderProgram = shaderCache().get(myPrimitive::PRIMITIVE_VS, myPrimitive::PRIMITIVE_FS, SHADER_INSTANCED_RECT | SHADER_VERTEX_COLOR);
+    colorLoc = glGetUniformLocation(shaderProgram, "color");
+
+    VAO = gpuResources().createVertexArray("entities");
+    glBindVertexArray(VAO.id());
+
+    quadVBO = gpuResources().createStaticBuffer(GPU_VERTICES, GL_ARRAY_BUFFER, sizeof(myPrimitive::QUAD_VERTICES),
+                                                myPrimitive::QUAD_VERTICES, "entity quad");
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+
+    // center and size feed INSTANCED_RECT, the packed tint VERTEX_COLOR;
+    // sized by the first draw
+    instanceVBO = gpuResources().createDynamicBuffer(GPU_INSTANCES, GL_ARRAY_BUFFER, 0, NULL, GL_STREAM_DRAW, "entity instances");
+    glVertexAttribPointer(7, 3, GL_FLOAT, GL_FALSE, sizeof(EntityInstance), (void*)offsetof(EntityInstance, x));
+    glEnableVertexAttribArray(7);
+    glVertexAttribDivisor(7, 1);
+    glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(EntityInstance), (void*)offsetof(EntityInstance, rgba));
+    glEnableVertexAttribArray(1);
+    glVertexAttribDivisor(1, 1);
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+
+    glm::mat4 projection = myPrimitive::primitiveProjection();
+    glUseProgram(shaderProgram);
+    glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "projection"), 1, GL_FALSE, &projection[0][0]);
+}
+
+void EntityRenderer::destroy()
+{
+    VAO.reset();
+    quadVBO.reset();
+    instanceVBO.reset();
+    capacity = 0;
+}
+
+void EntityRenderer::draw(EntityWorld& world, unsigned threads)
+{
+    size_t count = drawableEntities(world);
+    if (count == 0)
+        return;
+
+    glBindBuffer(GL_ARRAY_BUFFER, instanceVBO.id());
+    if (count > capacity) {
+        capacity = count + count / 4;
+        gpuResources().respecify(instanceVBO, GL_ARRAY_BUFFER, capacity * sizeof(EntityInstance), NULL, GL_STREAM_DRAW);
+    }
+    // invalidating lets the driver hand out fresh memory instead of waiting
+    // for last frame's draw to finish reading
+    void* mapped = glMapBufferRange(GL_ARRAY_BUFFER, 0, count * sizeof(EntityInstance), GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+    if (mapped) {
+        gatherInstances(world, (EntityInstance*)mapped, threads);
+        glUnmapBuffer(GL_ARRAY_BUFFER);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    // the program is shared with the other primitives, so reset our uniforms
+    glUseProgram(shaderProgram);
+    glUniform4f(colorLoc, 1.0f, 1.0f, 1.0f, 1.0f);
+    glBindVertexArray(VAO.id());
+    glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, (GLsizei)count);
+    glBindVertexArray(0);
+}
+
+}
+
+#endif
@@ -0,0 +1,83 @@
+#ifndef MY_GRID_ENTITIES_HPP
+#define MY_GRID_ENTITIES_HPP
+
+#include <learnopengl/entity_world.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace myGame {
+
+// Components of the squares moving over the board. Each one is its own array
+// in the world, so moving touches positions and velocities only.
+struct Position { float x, y; };
+struct Velocity { float x, y; };
+struct Extent { float size; };
+struct Tint { uint32_t rgba; };   // r in the low byte, as GL reads 4 unsigned bytes
+
+// area the squares wrap around in, the same bounds Player::move uses
+struct Board {
+    float min_x, min_y;
+    float max_x, max_y;
+};
+
+// one instance of the EntityRenderer's instanced draw
+struct EntityInstance {
+    float x, y;
+    float size;
+    uint32_t rgba;
+};
+
+inline void moveEntities(EntityWorld& world, float deltaTime, unsigned threads = 0)
+{
+    world.eachParallel<Position, const Velocity>([deltaTime](size_t count, Position* p, const Velocity* v) {
+        for (size_t i = 0; i < count; i++) {
+            p[i].x += v[i].x * deltaTime;
+            p[i].y += v[i].y * deltaTime;
+        }
+    }, threads);
+}
+
+// leaving the board on one side enters it on the opposite one
+inline void wrapEntities(EntityWorld& world, const Board& board, unsigned threads = 0)
+{
+    float width = board.max_x - board.min_x;
+    float height = board.max_y - board.min_y;
+    world.eachParallel<Position>([board, width, height](size_t count, Position* p) {
+        for (size_t i = 0; i < count; i++) {
+            float x = p[i].x, y = p[i].y;
+            x = x < board.min_x ? x + width : (x > board.max_x ? x - width : x);
+            y = y < board.min_y ? y + height : (y > board.max_y ? y - height : y);
+            p[i].x = x;
+            p[i].y = y;
+        }
+    }, threads);
+}
+
+// Packs every drawable entity into out, which holds
+// world.countWith<Position, Extent, Tint>() instances.
+inline void gatherInstances(EntityWorld& world, EntityInstance* out, unsigned threads = 0)
+{
+    size_t base = 0;
+    world.each<const Position, const Extent, const Tint>([&](size_t count, const Position* p, const Extent* e, const Tint* t) {
+        EntityInstance* dst = out + base;
+        parallelRanges(count, threads, [=](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                dst[i].x = p[i].x;
+                dst[i].y = p[i].y;
+                dst[i].size = e[i].size;
+                dst[i].rgba = t[i].rgba;
+            }
+        });
+        base += count;
+    });
+}
+
+inline size_t drawableEntities(EntityWorld& world)
+{
+    return world.countWith<Position, Extent, Tint>();
+}
+
+}
+
+#endif
@@ -0,0 +1,238 @@
+#ifndef MY_HUD_HPP
+#define MY_HUD_HPP
+
+#include <glad/glad.h>
+
+#include <glm/glm.hpp>
+
+#include "Shaders.hpp"
+#include "HudFont.hpp"
+
+#include <learnopengl/frame_memory.h>
+
+#include <algorithm>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace myPrimitive {
+
+// Times of the last HISTORY frames in milliseconds, for the HUD's percentiles.
+class FrameTimes {
+public:
+    static const int HISTORY = 240;
+
+    void add(float ms) {
+        times[next] = ms;
+        next = (next + 1) % HISTORY;
+        count = std::min(count + 1, HISTORY);
+    }
+
+    float last() const { return count ? times[(next + HISTORY - 1) % HISTORY] : 0.0f; }
+
+    float mean() const {
+        float sum = 0.0f;
+        for (int i = 0; i < count; i++)
+            sum += times[i];
+        return count ? sum / count : 0.0f;
+    }
+
+    // nearest rank, p in 0..1
+    float percentile(float p) const {
+        if (count == 0)
+            return 0.0f;
+        float sorted[HISTORY];
+        std::copy(times, times + count, sorted);
+        int rank = std::min(count - 1, (int)(p * count));
+        std::nth_element(sorted, sorted + rank, sorted + count);
+        return sorted[rank];
+    }
+
+private:
+    float times[HISTORY] = {};
+    int next = 0;
+    int count = 0;
+};
+
+// Text overlay drawn over the frame. text() only appends glyph instances to
+// a buffer reserved up front; draw() uploads them into one stream buffer and
+// draws them all with a single instanced call, so neither allocates nor
+// talks to the window system.
+class Hud {
+    struct Glyph {
+        int16_t x, y;
+        uint16_t glyph;
+        uint16_t pad;
+        uint32_t rgba;
+    };
+
+    GpuVertexArray VAO;
+    GpuBuffer instanceVBO;
+    GpuTexture atlas;
+    GLuint shaderProgram;
+    GLint viewportLoc;
+    GLint scaleLoc;
+    std::vector<Glyph> glyphs;
+public:
+    Hud() {};
+    ~Hud() { destroy(); };
+
+    /* ONCE */
+    void initialize(size_t maxGlyphs = 4096);
+    // gives the atlas, vertex array and buffer back, before the context goes away
+    void destroy();
+
+    // printf into the overlay at x, y pixels from the top left of the
+    // framebuffer; '\n' starts a new line. Glyphs past maxGlyphs are dropped.
+#if defined(__GNUC__) || defined(__clang__)
+    __attribute__((format(printf, 5, 6)))
+#endif
+    void text(int x, int y, glm::vec4 color, const char* format, ...);
+
+    // draws everything queued since the last draw on a width x height framebuffer
+    void draw(int width, int height);
+
+    // frame time, its percentiles, the frame memory counters and the GPU
+    // memory in use; returns the y below the last line
+    int frameStats(int x, int y, const FrameTimes& times);
+
+    size_t glyphCount() const { return glyphs.size(); }
+    int lineHeight() const { return HUD_GLYPH_HEIGHT * scale + 2; }
+
+    int scale = 1;
+};
+
+void Hud::initialize(size_t maxGlyphs)
+{
+    shaderProgram = shaderCache().get(HUD_VS, HUD_FS);
+    viewportLoc = glGetUniformLocation(shaderProgram, "viewport");
+    scaleLoc = glGetUniformLocation(shaderProgram, "scale");
+    glyphs.reserve(maxGlyphs);
+
+    // expand the one bit font into a single row R8 atlas
+    const int atlasWidth = HUD_GLYPH_COUNT * HUD_GLYPH_WIDTH;
+    std::vector<uint8_t> texels((size_t)atlasWidth * HUD_GLYPH_HEIGHT);
+    for (int g = 0; g < HUD_GLYPH_COUNT; g++)
+        for (int row = 0; row < HUD_GLYPH_HEIGHT; row++)
+            for (int column = 0; column < HUD_GLYPH_WIDTH; column++)
+                texels[(size_t)row * atlasWidth + g * HUD_GLYPH_WIDTH + column] = (HUD_FONT[g * HUD_GLYPH_HEIGHT + row] >> column & 1) ? 255 : 0;
+
+    atlas = gpuResources().createTexture(GPU_TEXTURES, GL_TEXTURE_2D, "hud font");
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, atlasWidth, HUD_GLYPH_HEIGHT, 0, GL_RED, GL_UNSIGNED_BYTE, texels.data());
+    gpuResources().setTextureBytes(atlas, texels.size());
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    VAO = gpuResources().createVertexArray("hud");
+    glBindVertexArray(VAO.id());
+    instanceVBO = gpuResources().createDynamicBuffer(GPU_INSTANCES, GL_ARRAY_BUFFER, maxGlyphs * sizeof(Glyph), NULL, GL_STREAM_DRAW, "hud glyphs");
+    glVertexAttribIPointer(0, 2, GL_SHORT, sizeof(Glyph), (void*)offsetof(Glyph, x));
+    glEnableVertexAttribArray(0);
+    glVertexAttribDivisor(0, 1);
+    glVertexAttribIPointer(1, 1, GL_UNSIGNED_SHORT, sizeof(Glyph), (void*)offsetof(Glyph, glyph));
+    glEnableVertexAttribArray(1);
+    glVertexAttribDivisor(1, 1);
+    glVertexAttribPointer(2, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Glyph), (void*)offsetof(Glyph, rgba));
+    glEnableVertexAttribArray(2);
+    glVertexAttribDivisor(2, 1);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+
+    glUseProgram(shaderProgram);
+    glUniform1i(glGetUniformLocation(shaderProgram, "atlas"), 0);
+    glUniform2i(glGetUniformLocation(shaderProgram, "glyphSize"), HUD_GLYPH_WIDTH, HUD_GLYPH_HEIGHT);
+}
+
+void Hud::destroy()
+{
+    VAO.reset();
+    instanceVBO.reset();
+    atlas.reset();
+}
+
+void Hud::text(int x, int y, glm::vec4 color, const char* format, ...)
+{
+    char line[256];
+    va_list args;
+    va_start(args, format);
+    int length = std::vsnprintf(line, sizeof(line), format, args);
+    va_end(args);
+    length = std::min(length, (int)sizeof(line) - 1);
+
+    glm::vec4 c = glm::clamp(color, 0.0f, 1.0f) * 255.0f + 0.5f;
+    uint32_t rgba = (uint32_t)c.r | (uint32_t)c.g << 8 | (uint32_t)c.b << 16 | (uint32_t)c.a << 24;
+    int penX = x;
+    for (int i = 0; i < length; i++) {
+        unsigned char ch = (unsigned char)line[i];
+        if (ch == '\n') {
+            penX = x;
+            y += lineHeight();
+            continue;
+        }
+        // spaces only move the pen
+        if (ch > ' ' && ch < HUD_FIRST_GLYPH + HUD_GLYPH_COUNT) {
+            if (glyphs.size() == glyphs.capacity())
+                return;
+            glyphs.push_back(Glyph{ (int16_t)penX, (int16_t)y, (uint16_t)(ch - HUD_FIRST_GLYPH), 0, rgba });
+        }
+        penX += HUD_GLYPH_WIDTH * scale;
+    }
+}
+
+void Hud::draw(int width, int height)
+{
+    if (glyphs.empty())
+        return;
+
+    glBindBuffer(GL_ARRAY_BUFFER, instanceVBO.id());
+    void* mapped = glMapBufferRange(GL_ARRAY_BUFFER, 0, glyphs.size() * sizeof(Glyph), GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+    if (mapped) {
+        std::memcpy(mapped, glyphs.data(), glyphs.size() * sizeof(Glyph));
+        glUnmapBuffer(GL_ARRAY_BUFFER);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    // the overlay is always on top
+    GLboolean depthTest = glIsEnabled(GL_DEPTH_TEST);
+    if (depthTest)
+        glDisable(GL_DEPTH_TEST);
+
+    glUseProgram(shaderProgram);
+    glUniform2f(viewportLoc, (float)width, (float)height);
+    glUniform1i(scaleLoc, scale);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, atlas.id());
+    glBindVertexArray(VAO.id());
+    glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, (GLsizei)glyphs.size());
+    glBindVertexArray(0);
+
+    if (depthTest)
+        glEnable(GL_DEPTH_TEST);
+    glyphs.clear();
+}
+
+int Hud::frameStats(int x, int y, const FrameTimes& times)
+{
+    const glm::vec4 white(1.0f), grey(0.7f, 0.7f, 0.7f, 1.0f);
+    float mean = times.mean();
+    text(x, y, white, "%5.2f ms  %4.0f fps", times.last(), mean > 0.0f ? 1000.0f / mean : 0.0f);
+    y += lineHeight();
+    text(x, y, grey, "p50 %.2f  p95 %.2f  p99 %.2f ms", times.percentile(0.5f), times.percentile(0.95f), times.percentile(0.99f));
+    y += lineHeight();
+    const MemoryCounters& memory = frameMemory().lastFrame();
+    text(x, y, grey, "heap %zu  arena %zu / %zu B  shaders %zu", memory.heapAllocations, memory.arenaAllocations, memory.arenaBytes, shaderCache().size());
+    y += lineHeight();
+    text(x, y, grey, "gpu %.1f KB in %zu objects", gpuResources().totalBytes() / 1024.0, gpuResources().liveCount());
+    return y + lineHeight();
+}
+
+}
+
+#endif
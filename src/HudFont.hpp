@@ -0,0 +1,116 @@
+#ifndef MY_HUD_FONT_HPP
+#define MY_HUD_FONT_HPP
+
+#include <cstdint>
+
+namespace myPrimitive {
+
+// Glyph atlas of the HUD: printable ASCII (32..126) from DejaVu Sans Mono at
+// 12 px, thresholded to one bit. Each glyph is HUD_GLYPH_HEIGHT rows from the
+// top, bit x of a row is column x from the left.
+const int HUD_GLYPH_WIDTH = 7;
+const int HUD_GLYPH_HEIGHT = 14;
+const int HUD_FIRST_GLYPH = 32;
+const int HUD_GLYPH_COUNT = 95;
+
+const uint8_t HUD_FONT[HUD_GLYPH_COUNT * HUD_GLYPH_HEIGHT] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // space
+    0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x08, 0x08, 0x00, 0x00, 0x00,  // !
+    0x00, 0x00, 0x14, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // "
+    0x00, 0x00, 0x00, 0x28, 0x28, 0x7e, 0x34, 0x14, 0x7f, 0x12, 0x0a, 0x00, 0x00, 0x00,  // #
+    0x00, 0x00, 0x08, 0x1c, 0x2e, 0x0a, 0x0c, 0x38, 0x68, 0x2a, 0x3c, 0x08, 0x08, 0x00,  // $
+    0x00, 0x00, 0x06, 0x09, 0x09, 0x66, 0x18, 0x32, 0x48, 0x48, 0x30, 0x00, 0x00, 0x00,  // %
+    0x00, 0x00, 0x1c, 0x06, 0x06, 0x04, 0x0e, 0x5b, 0x73, 0x32, 0x7e, 0x00, 0x00, 0x00,  // &
+    0x00, 0x00, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '
+    0x00, 0x10, 0x18, 0x08, 0x08, 0x0c, 0x0c, 0x0c, 0x08, 0x08, 0x18, 0x10, 0x00, 0x00,  // (
+    0x00, 0x04, 0x08, 0x08, 0x18, 0x18, 0x18, 0x18, 0x18, 0x08, 0x08, 0x04, 0x00, 0x00,  // )
+    0x00, 0x00, 0x08, 0x2a, 0x1c, 0x1c, 0x2a, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // *
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x7f, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00,  // +
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x08, 0x0c, 0x00, 0x00,  // ,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // -
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x00,  // .
+    0x00, 0x00, 0x20, 0x30, 0x10, 0x18, 0x08, 0x08, 0x04, 0x04, 0x06, 0x02, 0x00, 0x00,  // /
+    0x00, 0x00, 0x1c, 0x36, 0x22, 0x62, 0x6a, 0x62, 0x22, 0x36, 0x1c, 0x00, 0x00, 0x00,  // 0
+    0x00, 0x00, 0x1e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x00, 0x00, 0x00,  // 1
+    0x00, 0x00, 0x1c, 0x32, 0x20, 0x20, 0x10, 0x18, 0x0c, 0x06, 0x3e, 0x00, 0x00, 0x00,  // 2
+    0x00, 0x00, 0x1c, 0x32, 0x20, 0x30, 0x1c, 0x30, 0x20, 0x22, 0x1e, 0x00, 0x00, 0x00,  // 3
+    0x00, 0x00, 0x30, 0x38, 0x3c, 0x34, 0x36, 0x32, 0x7f, 0x30, 0x30, 0x00, 0x00, 0x00,  // 4
+    0x00, 0x00, 0x3e, 0x02, 0x02, 0x1e, 0x30, 0x20, 0x20, 0x32, 0x1e, 0x00, 0x00, 0x00,  // 5
+    0x00, 0x00, 0x1c, 0x26, 0x02, 0x1e, 0x26, 0x22, 0x22, 0x26, 0x1c, 0x00, 0x00, 0x00,  // 6
+    0x00, 0x00, 0x3e, 0x20, 0x30, 0x10, 0x10, 0x18, 0x08, 0x0c, 0x04, 0x00, 0x00, 0x00,  // 7
+    0x00, 0x00, 0x1c, 0x26, 0x22, 0x26, 0x1c, 0x26, 0x62, 0x26, 0x3c, 0x00, 0x00, 0x00,  // 8
+    0x00, 0x00, 0x1c, 0x36, 0x22, 0x22, 0x76, 0x3c, 0x20, 0x32, 0x1c, 0x00, 0x00, 0x00,  // 9
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x00,  // :
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x18, 0x08, 0x0c, 0x00, 0x00,  // ;
+    0x00, 0x00, 0x00, 0x00, 0x60, 0x38, 0x06, 0x06, 0x38, 0x60, 0x00, 0x00, 0x00, 0x00,  // <
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00,  // =
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x0e, 0x70, 0x70, 0x1e, 0x03, 0x00, 0x00, 0x00, 0x00,  // >
+    0x00, 0x00, 0x1c, 0x32, 0x20, 0x10, 0x08, 0x08, 0x00, 0x08, 0x08, 0x00, 0x00, 0x00,  // ?
+    0x00, 0x00, 0x00, 0x3c, 0x66, 0x43, 0x79, 0x4d, 0x4d, 0x79, 0x02, 0x06, 0x3c, 0x00,  // @
+    0x00, 0x00, 0x18, 0x1c, 0x14, 0x14, 0x36, 0x26, 0x3e, 0x62, 0x43, 0x00, 0x00, 0x00,  // A
+    0x00, 0x00, 0x1e, 0x22, 0x22, 0x22, 0x3e, 0x22, 0x62, 0x62, 0x3e, 0x00, 0x00, 0x00,  // B
+    0x00, 0x00, 0x3c, 0x26, 0x02, 0x02, 0x02, 0x02, 0x02, 0x26, 0x3c, 0x00, 0x00, 0x00,  // C
+    0x00, 0x00, 0x1e, 0x32, 0x22, 0x62, 0x62, 0x62, 0x22, 0x32, 0x1e, 0x00, 0x00, 0x00,  // D
+    0x00, 0x00, 0x3e, 0x02, 0x02, 0x02, 0x3e, 0x02, 0x02, 0x02, 0x7e, 0x00, 0x00, 0x00,  // E
+    0x00, 0x00, 0x7e, 0x06, 0x06, 0x06, 0x3e, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00,  // F
+    0x00, 0x00, 0x3c, 0x26, 0x02, 0x02, 0x72, 0x62, 0x62, 0x66, 0x3c, 0x00, 0x00, 0x00,  // G
+    0x00, 0x00, 0x62, 0x62, 0x62, 0x62, 0x7e, 0x62, 0x62, 0x62, 0x62, 0x00, 0x00, 0x00,  // H
+    0x00, 0x00, 0x3e, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x3e, 0x00, 0x00, 0x00,  // I
+    0x00, 0x00, 0x3c, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x12, 0x1e, 0x00, 0x00, 0x00,  // J
+    0x00, 0x00, 0x62, 0x32, 0x1a, 0x0e, 0x0e, 0x1a, 0x32, 0x22, 0x62, 0x00, 0x00, 0x00,  // K
+    0x00, 0x00, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x7e, 0x00, 0x00, 0x00,  // L
+    0x00, 0x00, 0x63, 0x67, 0x77, 0x77, 0x7b, 0x6b, 0x63, 0x63, 0x63, 0x00, 0x00, 0x00,  // M
+    0x00, 0x00, 0x66, 0x66, 0x66, 0x6a, 0x6a, 0x7a, 0x72, 0x72, 0x62, 0x00, 0x00, 0x00,  // N
+    0x00, 0x00, 0x1c, 0x36, 0x22, 0x62, 0x62, 0x62, 0x22, 0x36, 0x1c, 0x00, 0x00, 0x00,  // O
+    0x00, 0x00, 0x3e, 0x62, 0x62, 0x62, 0x3e, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00,  // P
+    0x00, 0x00, 0x1c, 0x36, 0x22, 0x62, 0x62, 0x62, 0x22, 0x36, 0x1c, 0x30, 0x20, 0x00,  // Q
+    0x00, 0x00, 0x1e, 0x32, 0x22, 0x32, 0x1e, 0x32, 0x22, 0x62, 0x42, 0x00, 0x00, 0x00,  // R
+    0x00, 0x00, 0x1c, 0x26, 0x02, 0x06, 0x1c, 0x20, 0x60, 0x22, 0x3c, 0x00, 0x00, 0x00,  // S
+    0x00, 0x00, 0x7f, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00,  // T
+    0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x26, 0x1c, 0x00, 0x00, 0x00,  // U
+    0x00, 0x00, 0x63, 0x62, 0x22, 0x26, 0x36, 0x14, 0x14, 0x1c, 0x18, 0x00, 0x00, 0x00,  // V
+    0x00, 0x00, 0x41, 0x41, 0x4b, 0x5b, 0x7e, 0x76, 0x36, 0x36, 0x26, 0x00, 0x00, 0x00,  // W
+    0x00, 0x00, 0x62, 0x26, 0x14, 0x1c, 0x18, 0x1c, 0x34, 0x22, 0x63, 0x00, 0x00, 0x00,  // X
+    0x00, 0x00, 0x63, 0x22, 0x34, 0x1c, 0x18, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00,  // Y
+    0x00, 0x00, 0x7e, 0x20, 0x30, 0x10, 0x18, 0x0c, 0x04, 0x06, 0x7e, 0x00, 0x00, 0x00,  // Z
+    0x00, 0x18, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x18, 0x00, 0x00,  // [
+    0x00, 0x00, 0x02, 0x06, 0x04, 0x04, 0x08, 0x08, 0x18, 0x10, 0x30, 0x20, 0x00, 0x00,  // backslash
+    0x00, 0x1c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1c, 0x00, 0x00,  // ]
+    0x00, 0x00, 0x18, 0x34, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // ^
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f,  // _
+    0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // `
+    0x00, 0x00, 0x00, 0x00, 0x1e, 0x20, 0x20, 0x3c, 0x22, 0x32, 0x3e, 0x00, 0x00, 0x00,  // a
+    0x00, 0x02, 0x02, 0x02, 0x1e, 0x26, 0x62, 0x62, 0x62, 0x26, 0x1e, 0x00, 0x00, 0x00,  // b
+    0x00, 0x00, 0x00, 0x00, 0x3c, 0x04, 0x06, 0x02, 0x06, 0x04, 0x3c, 0x00, 0x00, 0x00,  // c
+    0x00, 0x20, 0x20, 0x20, 0x3c, 0x36, 0x22, 0x22, 0x22, 0x36, 0x3c, 0x00, 0x00, 0x00,  // d
+    0x00, 0x00, 0x00, 0x00, 0x1c, 0x26, 0x62, 0x7e, 0x02, 0x26, 0x3c, 0x00, 0x00, 0x00,  // e
+    0x00, 0x38, 0x08, 0x08, 0x3e, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00,  // f
+    0x00, 0x00, 0x00, 0x00, 0x3c, 0x36, 0x22, 0x22, 0x22, 0x36, 0x3c, 0x20, 0x32, 0x1c,  // g
+    0x00, 0x02, 0x02, 0x02, 0x3e, 0x26, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00,  // h
+    0x00, 0x08, 0x00, 0x00, 0x0e, 0x08, 0x08, 0x08, 0x08, 0x08, 0x7e, 0x00, 0x00, 0x00,  // i
+    0x00, 0x18, 0x00, 0x00, 0x1c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x0e,  // j
+    0x00, 0x06, 0x06, 0x06, 0x26, 0x16, 0x0e, 0x1e, 0x16, 0x26, 0x66, 0x00, 0x00, 0x00,  // k
+    0x00, 0x0e, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x38, 0x00, 0x00, 0x00,  // l
+    0x00, 0x00, 0x00, 0x00, 0x3e, 0x6a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x00, 0x00, 0x00,  // m
+    0x00, 0x00, 0x00, 0x00, 0x3e, 0x26, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00,  // n
+    0x00, 0x00, 0x00, 0x00, 0x1c, 0x26, 0x22, 0x62, 0x22, 0x26, 0x1c, 0x00, 0x00, 0x00,  // o
+    0x00, 0x00, 0x00, 0x00, 0x1e, 0x26, 0x22, 0x62, 0x22, 0x26, 0x1e, 0x02, 0x02, 0x02,  // p
+    0x00, 0x00, 0x00, 0x00, 0x3c, 0x36, 0x22, 0x22, 0x22, 0x36, 0x3c, 0x20, 0x20, 0x20,  // q
+    0x00, 0x00, 0x00, 0x00, 0x7c, 0x0c, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00,  // r
+    0x00, 0x00, 0x00, 0x00, 0x1c, 0x26, 0x06, 0x1c, 0x20, 0x22, 0x1c, 0x00, 0x00, 0x00,  // s
+    0x00, 0x00, 0x0c, 0x0c, 0x3e, 0x0c, 0x0c, 0x0c, 0x0c, 0x08, 0x38, 0x00, 0x00, 0x00,  // t
+    0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x36, 0x3c, 0x00, 0x00, 0x00,  // u
+    0x00, 0x00, 0x00, 0x00, 0x62, 0x22, 0x26, 0x34, 0x14, 0x1c, 0x18, 0x00, 0x00, 0x00,  // v
+    0x00, 0x00, 0x00, 0x00, 0x41, 0x41, 0x4b, 0x7a, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00,  // w
+    0x00, 0x00, 0x00, 0x00, 0x22, 0x34, 0x1c, 0x18, 0x1c, 0x36, 0x62, 0x00, 0x00, 0x00,  // x
+    0x00, 0x00, 0x00, 0x00, 0x62, 0x22, 0x26, 0x34, 0x14, 0x1c, 0x18, 0x08, 0x0c, 0x06,  // y
+    0x00, 0x00, 0x00, 0x00, 0x3e, 0x30, 0x10, 0x08, 0x0c, 0x06, 0x3e, 0x00, 0x00, 0x00,  // z
+    0x00, 0x30, 0x18, 0x08, 0x08, 0x08, 0x0e, 0x08, 0x08, 0x08, 0x18, 0x30, 0x00, 0x00,  // {
+    0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00,  // |
+    0x00, 0x0e, 0x08, 0x08, 0x08, 0x18, 0x30, 0x18, 0x08, 0x08, 0x08, 0x0e, 0x00, 0x00,  // }
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // ~
+};
+
+}
+
+#endif
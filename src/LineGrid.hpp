@@ -1,9 +1,15 @@
 #include <glad/glad.h>
 #include <vector>
+#include <memory_resource>
 
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 
+#include "Shaders.hpp"
+
+#include <learnopengl/frame_memory.h>
+#include <learnopengl/soft_raster.h>
+
 #include <string>
 #include <iostream>
 #include <ostream>
@@ -11,7 +17,8 @@
 namespace myPrimitive {
 
 class LineGrid {
-    GLuint VAO;
+    GpuVertexArray VAO;
+    GpuBuffer VBO;
 
     float padding;
     float step;
@@ -22,6 +29,7 @@ class LineGrid {
     float max_x;
     float max_y;
     GLuint n;
+    glm::mat4 dequantize;
 public:
     LineGrid(float a_SCR_WIDTH, float a_SCR_HEIGHT, float a_padding, float a_step) {
         SCR_WIDTH = a_SCR_WIDTH;
@@ -29,82 +37,42 @@ public:
         padding = a_padding;
         step = a_step;
     };
-    ~LineGrid() {};
+    ~LineGrid() { destroy(); };
 
     /* ONCE */
     void compile_shader();
     void initialize();
+    // gives the vertex array and buffer back, before the context goes away
+    void destroy();
     void draw();
+    void draw(SoftRasterizer& raster);
     GLuint shaderProgram;
+    GLint modelLoc;
+    GLint colorLoc;
+private:
+    void build_vertices(std::pmr::vector<float>& lines_vertices);
 };
 
 void LineGrid::compile_shader()
 {
-    const char *vertexShaderSource = "#version 420 core\n"
-        "layout (location = 0) in vec3 aPos;\n"
-        "uniform mat4 projection;\n"
-        "void main()\n"
-        "{\n"
-        "   gl_Position = projection * vec4(aPos.x, aPos.y, 0.0, 1.0);\n"
-        "}\0";
-
-    const char *fragmentShaderSource = "#version 420 core\n"
-        "out vec4 FragColor;\n"
-        "void main()\n"
-        "{\n"
-        "   FragColor = vec4(0.16f, 0.16f, 0.16f, 1.0f);\n"
-        "}\n\0";
-
-    // build aand compile our shader program
-    // ------------------------------------
-    // vertex shader
-    GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
-    glShaderSource(vertexShader, 1, &vertexShaderSource, NULL);
-    glCompileShader(vertexShader);
-    // check for shader compile errors
-    int success;
-    char infoLog[512];
-    glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &success);
-    if (!success)
-    {
-        glGetShaderInfoLog(vertexShader, 512, NULL, infoLog);
-        std::cout << "ERROR::SHADER::VERTEX::COMPILATION_FAILED\n" << infoLog << std::endl;
-    }
-    // fragment shader
-    GLuint fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
-    glShaderSource(fragmentShader, 1, &fragmentShaderSource, NULL);
-    glCompileShader(fragmentShader);
-    // check for shader compile errors
-    glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &success);
-    if (!success)
-    {
-        glGetShaderInfoLog(fragmentShader, 512, NULL, infoLog);
-        std::cout << "ERROR::SHADER::FRAGMENT::COMPILATION_FAILED\n" << infoLog << std::endl;
-    }
-    // link shaders
-    shaderProgram = glCreateProgram();
-    glAttachShader(shaderProgram, vertexShader);
-    glAttachShader(shaderProgram, fragmentShader);
-    glLinkProgram(shaderProgram);
-    // check for linking errors
-    glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
-    if (!success) {
-        glGetProgramInfoLog(shaderProgram, 512, NULL, infoLog);
-        std::cout << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n" << infoLog << std::endl;
-    }
-    glDeleteShader(vertexShader);
-    glDeleteShader(fragmentShader);
+    // every primitive shares one permutation of the same program
+    shaderProgram = shaderCache().get(PRIMITIVE_VS, PRIMITIVE_FS);
+    modelLoc = glGetUniformLocation(shaderProgram, "model");
+    colorLoc = glGetUniformLocation(shaderProgram, "color");
 }
 
 
 
-void LineGrid::initialize()
+void LineGrid::build_vertices(std::pmr::vector<float>& lines_vertices)
 {
     max_x = SCR_WIDTH - padding;
     max_y = SCR_HEIGHT - padding;
-    this->compile_shader();
 
-    std::vector<float> lines_vertices;
+    // sized up front for both line families (+2 for float rounding)
+    size_t rows = (size_t)((max_y - padding) / step) + 2;
+    size_t columns = (size_t)((max_x - padding) / step) + 2;
+    lines_vertices.reserve((rows + columns) * 2 * 3);
+    n = 0;
 
     float min_x = padding;
     for (float y = padding; y <= max_y; y += step) {
@@ -128,35 +96,66 @@ void LineGrid::initialize()
         lines_vertices.push_back(0.0f);
         n++;
     }
+}
 
-    GLuint VBO;
-    glGenVertexArrays(1, &VAO);
-    glGenBuffers(1, &VBO);
+void LineGrid::initialize()
+{
+    this->compile_shader();
 
-    glBindVertexArray(VAO);
+    // the vertices only live until glBufferData, so they come from the frame
+    // arena
+    std::pmr::vector<float> lines_vertices(frameMemory().resource());
+    build_vertices(lines_vertices);
 
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, lines_vertices.size() * sizeof(float), &lines_vertices[0], GL_STATIC_DRAW);
+    VAO = gpuResources().createVertexArray("board lines");
+    glBindVertexArray(VAO.id());
 
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
+    // x and y as int16 on the board, a third of the floats' size
+    VertexFormat format;
+    format.add(0, 2, VERTEX_INT16, 0);
+    std::pmr::vector<unsigned char> packed(n * format.stride(), frameMemory().resource());
+    format.encode(lines_vertices.data(), n, 3, packed.data());
+    VBO = gpuResources().createStaticBuffer(GPU_VERTICES, GL_ARRAY_BUFFER, packed.size(), packed.data(), "board lines");
+    format.setAttributes();
+    dequantize = format.dequantize(0);
 
     glBindBuffer(GL_ARRAY_BUFFER, 0); 
     glBindVertexArray(0); 
 
-    glm::mat4 projection = glm::ortho(0.0f, 512.0f, 512.0f, 0.0f, -1.0f, 1.0f);
+    glm::mat4 projection = primitiveProjection();
     glUseProgram(shaderProgram);
     glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "projection"), 1, GL_FALSE, &projection[0][0]);
 }
 
 void LineGrid::draw()
 {
+    // the program is shared with the other primitives, so reset our uniforms;
+    // the model matrix only scales the packed vertices back
     glUseProgram(shaderProgram);
-    glBindVertexArray(VAO);
+    glUniformMatrix4fv(modelLoc, 1, GL_FALSE, &dequantize[0][0]);
+    glUniform4f(colorLoc, 0.16f, 0.16f, 0.16f, 1.0f);
+    glBindVertexArray(VAO.id());
     glDrawArrays(GL_LINES, 0, n);
     glBindVertexArray(0);
 }
 
+void LineGrid::destroy()
+{
+    VAO.reset();
+    VBO.reset();
+}
+
+// the same lines on the CPU rasterizer, rebuilt on the frame arena each call
+void LineGrid::draw(SoftRasterizer& raster)
+{
+    std::pmr::vector<float> lines_vertices(frameMemory().resource());
+    build_vertices(lines_vertices);
 
+    SoftDrawState state;
+    state.transform = primitiveProjection();
+    state.color = glm::vec4(0.16f, 0.16f, 0.16f, 1.0f);
+    raster.draw(state, SOFT_LINES, lines_vertices.data(), SoftVertexLayout{ 3 }, 0, (int)n);
 }
 
+
+}
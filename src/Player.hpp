@@ -3,6 +3,11 @@
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 
+#include "Shaders.hpp"
+
+#include <learnopengl/bvh.h>
+#include <learnopengl/soft_raster.h>
+
 namespace myGame {
 
 enum MOVE_DIR {
@@ -13,18 +18,27 @@ enum MOVE_DIR {
 };
 
 class Player {
-    GLuint VAO;
+    GpuVertexArray VAO;
+    GpuBuffer VBO;
     GLuint shaderProgram;
+    GLint modelLoc;
+    GLint colorLoc;
+    glm::mat4 dequantize;
 public:
 
     Player() {};
-    ~Player() {};
+    ~Player() { destroy(); };
 
     /* ONCE */
     void compile_shader();
     void initialize();
+    // gives the vertex array and buffer back, before the context goes away
+    void destroy();
 
     void draw();
+    void draw(SoftRasterizer& raster);
+    // the triangles draw() covers, for picking
+    void addTo(Bvh& bvh, int object) const;
 
     void move(unsigned int dir);
 
@@ -37,105 +51,66 @@ public:
     float max_x_pos;
     float max_y_pos;
     
+private:
+    glm::mat4 model_matrix() const;
 };
 
 
-void Player::draw()
+glm::mat4 Player::model_matrix() const
 {
     glm::mat4 model = glm::mat4(1.0f);
     model = glm::translate(model, p_pos);
     //model = glm::rotate(model, glm::radians(angle), glm::vec3(0.0f, 0.0f, 1.0f));
     model = glm::scale(model, glm::vec3(size, size, 0.0f));
+    return model;
+}
+
+
+void Player::draw()
+{
+    glm::mat4 model = model_matrix() * dequantize;
 
     glUseProgram(shaderProgram);
-    glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "model"), 1, GL_FALSE, &model[0][0]);
+    glUniformMatrix4fv(modelLoc, 1, GL_FALSE, &model[0][0]);
+    glUniform4f(colorLoc, 1.0f, 0.0f, 1.0f, 1.0f);
 
-    glBindVertexArray(VAO);
+    glBindVertexArray(VAO.id());
     glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
     glBindVertexArray(0);
 }
 
+// the same quad and transform on the CPU rasterizer
+void Player::draw(SoftRasterizer& raster)
+{
+    SoftDrawState state;
+    state.transform = myPrimitive::primitiveProjection() * model_matrix();
+    state.color = glm::vec4(1.0f, 0.0f, 1.0f, 1.0f);
+    raster.draw(state, SOFT_TRIANGLE_STRIP, myPrimitive::QUAD_VERTICES, SoftVertexLayout{ 3 }, 0, 4);
+}
+
+void Player::addTo(Bvh& bvh, int object) const
+{
+    bvh.addMesh(object, myPrimitive::QUAD_VERTICES, 3, myPrimitive::QUAD_TRIANGLES, 2, model_matrix());
+}
+
 void Player::compile_shader()
 {
-    const char *vertexShaderSource = "#version 420 core\n"
-        "layout (location = 0) in vec3 aPos;\n"
-        "uniform mat4 model;\n"
-        "uniform mat4 projection;\n"
-        "void main()\n"
-        "{\n"
-    "       gl_Position = projection * model * vec4(aPos.x, aPos.y, 0.0, 1.0);\n"
-        "}\0";
-
-    const char *fragmentShaderSource = "#version 420 core\n"
-        "out vec4 FragColor;\n"
-        "void main()\n"
-        "{\n"
-        "   FragColor = vec4(1.0f, 0.0f, 1.0f, 1.0f);\n"
-        "}\n\0";
-
-    // build and compile our shader program
-    // ------------------------------------
-    // vertex shader
-    GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
-    glShaderSource(vertexShader, 1, &vertexShaderSource, NULL);
-    glCompileShader(vertexShader);
-    // check for shader compile errors
-    int success;
-    char infoLog[512];
-    glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &success);
-    if (!success)
-    {
-        glGetShaderInfoLog(vertexShader, 512, NULL, infoLog);
-        std::cout << "ERROR::SHADER::VERTEX::COMPILATION_FAILED\n" << infoLog << std::endl;
-    }
-    // fragment shader
-    GLuint fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
-    glShaderSource(fragmentShader, 1, &fragmentShaderSource, NULL);
-    glCompileShader(fragmentShader);
-    // check for shader compile errors
-    glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &success);
-    if (!success)
-    {
-        glGetShaderInfoLog(fragmentShader, 512, NULL, infoLog);
-        std::cout << "ERROR::SHADER::FRAGMENT::COMPILATION_FAILED\n" << infoLog << std::endl;
-    }
-    // link shaders
-    shaderProgram = glCreateProgram();
-    glAttachShader(shaderProgram, vertexShader);
-    glAttachShader(shaderProgram, fragmentShader);
-    glLinkProgram(shaderProgram);
-    // check for linking errors
-    glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
-    if (!success) {
-        glGetProgramInfoLog(shaderProgram, 512, NULL, infoLog);
-        std::cout << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n" << infoLog << std::endl;
-    }
-    glDeleteShader(vertexShader);
-    glDeleteShader(fragmentShader);
+    // every primitive shares one permutation of the same program
+    shaderProgram = shaderCache().get(myPrimitive::PRIMITIVE_VS, myPrimitive::PRIMITIVE_FS);
+    modelLoc = glGetUniformLocation(shaderProgram, "model");
+    colorLoc = glGetUniformLocation(shaderProgram, "color");
 }
 
 
 void Player::initialize()
 {
     this->compile_shader();
-    float quad_vertices[] = {
-       -0.5f,  0.5f, 0.0f,  // lt
-        0.5f,  0.5f, 0.0f, // rt
-       -0.5f, -0.5f, 0.0f, // lb
-        0.5f, -0.5f, 0.0f, // rb
-    }; 
-
-    GLuint VBO;
-    glGenVertexArrays(1, &VAO);
-    glGenBuffers(1, &VBO);
-    // bind the Vertex Array Object first, then bind and set vertex buffer(s), and then configure vertex attributes(s).
-    glBindVertexArray(VAO);
 
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(quad_vertices), quad_vertices, GL_STATIC_DRAW);
+    VAO = gpuResources().createVertexArray("player");
+    // bind the Vertex Array Object first, then bind and set vertex buffer(s), and then configure vertex attributes(s).
+    glBindVertexArray(VAO.id());
 
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
+    dequantize = myPrimitive::uploadQuadVertices(VBO, "player");
 
     // note that this is allowed, the call to glVertexAttribPointer registered VBO as the vertex attribute's bound vertex buffer object so afterwards we can safely unbind
     glBindBuffer(GL_ARRAY_BUFFER, 0); 
@@ -143,11 +118,17 @@ void Player::initialize()
     // You can unbind the VAO afterwards so other VAO calls won't accidentally modify this VAO, but this rarely happens. Modifying other
     // VAOs requires a call to glBindVertexArray anyways so we generally don't unbind VAOs (nor VBOs) when it's not directly necessary.
     glBindVertexArray(0); 
-    glm::mat4 projection = glm::ortho(0.0f, 512.0f, 512.0f, 0.0f, -1.0f, 1.0f);
+    glm::mat4 projection = myPrimitive::primitiveProjection();
     glUseProgram(shaderProgram);
     glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "projection"), 1, GL_FALSE, &projection[0][0]);
 }
 
+void Player::destroy()
+{
+    VAO.reset();
+    VBO.reset();
+}
+
 void Player::move(unsigned int dir)
 {
     switch (dir) {
@@ -3,120 +3,95 @@
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 
+#include "Shaders.hpp"
+
+#include <learnopengl/bvh.h>
+#include <learnopengl/soft_raster.h>
+
 namespace myPrimitive {
 
 class Quad {
-    GLuint VAO;
+    GpuVertexArray VAO;
+    GpuBuffer VBO;
     GLuint shaderProgram;
+    GLint modelLoc;
+    GLint colorLoc;
+    glm::mat4 dequantize;
 public:
     Quad() {};
-    ~Quad() {};
+    ~Quad() { destroy(); };
 
     /* ONCE */
     void compile_shader();
     void initialize();
+    // gives the vertex array and buffer back, before the context goes away
+    void destroy();
 
     void draw(glm::vec3 pos, float angle, unsigned int size);
+    void draw(SoftRasterizer& raster, glm::vec3 pos, float angle, unsigned int size);
+    // the triangles draw() covers, for picking
+    void addTo(Bvh& bvh, int object, glm::vec3 pos, float angle, unsigned int size);
+
+private:
+    static glm::mat4 model_matrix(glm::vec3 pos, float angle, unsigned int size);
 };
 
 
-void Quad::draw(glm::vec3 pos, float angle, unsigned int size)
+glm::mat4 Quad::model_matrix(glm::vec3 pos, float angle, unsigned int size)
 {
     glm::mat4 model = glm::mat4(1.0f);
     model = glm::translate(model, pos);
     model = glm::rotate(model, glm::radians(angle), glm::vec3(0.0f, 0.0f, 1.0f));
     model = glm::scale(model, glm::vec3(size, size, 0.0f));
+    return model;
+}
+
+
+void Quad::draw(glm::vec3 pos, float angle, unsigned int size)
+{
+    glm::mat4 model = model_matrix(pos, angle, size) * dequantize;
 
     glUseProgram(shaderProgram);
-    glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "model"), 1, GL_FALSE, &model[0][0]);
+    glUniformMatrix4fv(modelLoc, 1, GL_FALSE, &model[0][0]);
+    glUniform4f(colorLoc, 1.0f, 0.0f, 1.0f, 1.0f);
 
-    glBindVertexArray(VAO);
+    glBindVertexArray(VAO.id());
     glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
     glBindVertexArray(0);
 }
 
+// the same quad and transform on the CPU rasterizer
+void Quad::draw(SoftRasterizer& raster, glm::vec3 pos, float angle, unsigned int size)
+{
+    SoftDrawState state;
+    state.transform = primitiveProjection() * model_matrix(pos, angle, size);
+    state.color = glm::vec4(1.0f, 0.0f, 1.0f, 1.0f);
+    raster.draw(state, SOFT_TRIANGLE_STRIP, QUAD_VERTICES, SoftVertexLayout{ 3 }, 0, 4);
+}
+
+void Quad::addTo(Bvh& bvh, int object, glm::vec3 pos, float angle, unsigned int size)
+{
+    bvh.addMesh(object, QUAD_VERTICES, 3, QUAD_TRIANGLES, 2, model_matrix(pos, angle, size));
+}
+
 void Quad::compile_shader()
 {
-    const char *vertexShaderSource = "#version 420 core\n"
-        "layout (location = 0) in vec3 aPos;\n"
-        "uniform mat4 model;\n"
-        "uniform mat4 view;\n"
-        "uniform mat4 projection;\n"
-        "void main()\n"
-        "{\n"
-    "       gl_Position = projection * model * vec4(aPos.x, aPos.y, 0.0, 1.0);\n"
-        "}\0";
-
-    const char *fragmentShaderSource = "#version 420 core\n"
-        "out vec4 FragColor;\n"
-        "void main()\n"
-        "{\n"
-        "   FragColor = vec4(1.0f, 0.0f, 1.0f, 1.0f);\n"
-        "}\n\0";
-
-    // build and compile our shader program
-    // ------------------------------------
-    // vertex shader
-    GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
-    glShaderSource(vertexShader, 1, &vertexShaderSource, NULL);
-    glCompileShader(vertexShader);
-    // check for shader compile errors
-    int success;
-    char infoLog[512];
-    glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &success);
-    if (!success)
-    {
-        glGetShaderInfoLog(vertexShader, 512, NULL, infoLog);
-        std::cout << "ERROR::SHADER::VERTEX::COMPILATION_FAILED\n" << infoLog << std::endl;
-    }
-    // fragment shader
-    GLuint fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
-    glShaderSource(fragmentShader, 1, &fragmentShaderSource, NULL);
-    glCompileShader(fragmentShader);
-    // check for shader compile errors
-    glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &success);
-    if (!success)
-    {
-        glGetShaderInfoLog(fragmentShader, 512, NULL, infoLog);
-        std::cout << "ERROR::SHADER::FRAGMENT::COMPILATION_FAILED\n" << infoLog << std::endl;
-    }
-    // link shaders
-    shaderProgram = glCreateProgram();
-    glAttachShader(shaderProgram, vertexShader);
-    glAttachShader(shaderProgram, fragmentShader);
-    glLinkProgram(shaderProgram);
-    // check for linking errors
-    glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
-    if (!success) {
-        glGetProgramInfoLog(shaderProgram, 512, NULL, infoLog);
-        std::cout << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n" << infoLog << std::endl;
-    }
-    glDeleteShader(vertexShader);
-    glDeleteShader(fragmentShader);
+    // every primitive shares one permutation of the same program
+    shaderProgram = shaderCache().get(PRIMITIVE_VS, PRIMITIVE_FS);
+    modelLoc = glGetUniformLocation(shaderProgram, "model");
+    colorLoc = glGetUniformLocation(shaderProgram, "color");
 }
 
 
 void Quad::initialize()
 {
     this->compile_shader();
-    float quad_vertices[] = {
-       -0.5f,  0.5f, 0.0f,  // lt
-        0.5f,  0.5f, 0.0f, // rt
-       -0.5f, -0.5f, 0.0f, // lb
-        0.5f, -0.5f, 0.0f, // rb
-    }; 
-
-    GLuint VBO;
-    glGenVertexArrays(1, &VAO);
-    glGenBuffers(1, &VBO);
-    // bind the Vertex Array Object first, then bind and set vertex buffer(s), and then configure vertex attributes(s).
-    glBindVertexArray(VAO);
 
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(quad_vertices), quad_vertices, GL_STATIC_DRAW);
+    VAO = gpuResources().createVertexArray("quad");
+    // bind the Vertex Array Object first, then bind and set vertex buffer(s), and then configure vertex attributes(s).
+    glBindVertexArray(VAO.id());
 
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
+    dequantize = uploadQuadVertices(VBO, "quad");
 
     // note that this is allowed, the call to glVertexAttribPointer registered VBO as the vertex attribute's bound vertex buffer object so afterwards we can safely unbind
     glBindBuffer(GL_ARRAY_BUFFER, 0); 
@@ -124,11 +99,17 @@ void Quad::initialize()
     // You can unbind the VAO afterwards so other VAO calls won't accidentally modify this VAO, but this rarely happens. Modifying other
     // VAOs requires a call to glBindVertexArray anyways so we generally don't unbind VAOs (nor VBOs) when it's not directly necessary.
     glBindVertexArray(0); 
-    glm::mat4 projection = glm::ortho(0.0f, 512.0f, 512.0f, 0.0f, -1.0f, 1.0f);
+    glm::mat4 projection = primitiveProjection();
     glUseProgram(shaderProgram);
     glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "projection"), 1, GL_FALSE, &projection[0][0]);
 }
 
+void Quad::destroy()
+{
+    VAO.reset();
+    VBO.reset();
+}
+
 
 }
 
@@ -0,0 +1,59 @@
+#ifndef MY_SHADERS_HPP
+#define MY_SHADERS_HPP
+
+#include <learnopengl/shader_cache.h>
+#include <learnopengl/vertex_format.h>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace myPrimitive {
+
+// shared sources for the 2D primitives, relative to src/ where the programs
+// using them run; ones built elsewhere define the directory first
+#ifndef PRIMITIVE_SHADER_DIR
+#define PRIMITIVE_SHADER_DIR "../resources/shaders/"
+#endif
+const char* const PRIMITIVE_VS = PRIMITIVE_SHADER_DIR "primitive.vs";
+const char* const PRIMITIVE_FS = PRIMITIVE_SHADER_DIR "primitive.fs";
+const char* const HUD_VS = PRIMITIVE_SHADER_DIR "hud.vs";
+const char* const HUD_FS = PRIMITIVE_SHADER_DIR "hud.fs";
+const char* const TILEMAP_VS = PRIMITIVE_SHADER_DIR "tilemap.vs";
+const char* const TILEMAP_FS = PRIMITIVE_SHADER_DIR "tilemap.fs";
+
+// unit square around the origin as a triangle strip, scaled and placed by
+// the model matrix
+const float QUAD_VERTICES[] = {
+   -0.5f,  0.5f, 0.0f, // lt
+    0.5f,  0.5f, 0.0f, // rt
+   -0.5f, -0.5f, 0.0f, // lb
+    0.5f, -0.5f, 0.0f, // rb
+};
+
+// the strip's two triangles as a list, for picking
+const uint32_t QUAD_TRIANGLES[] = { 0, 2, 1, 1, 2, 3 };
+
+// Uploads QUAD_VERTICES' x and y as int16, 16 bytes in place of 48, into a
+// static buffer bound to GL_ARRAY_BUFFER and points location 0 of the bound
+// vertex array at them. The returned matrix scales them back and goes in
+// front of the model matrix.
+inline glm::mat4 uploadQuadVertices(GpuBuffer& buffer, const char* label)
+{
+    VertexFormat format;
+    format.add(0, 2, VERTEX_INT16, 0);
+    unsigned char packed[4 * 4];
+    format.encode(QUAD_VERTICES, 4, 3, packed);
+    buffer = gpuResources().createStaticBuffer(GPU_VERTICES, GL_ARRAY_BUFFER, sizeof(packed), packed, label);
+    format.setAttributes();
+    return format.dequantize(0);
+}
+
+// the 512x512 board in pixels, y down
+inline glm::mat4 primitiveProjection()
+{
+    return glm::ortho(0.0f, 512.0f, 512.0f, 0.0f, -1.0f, 1.0f);
+}
+
+}
+
+#endif
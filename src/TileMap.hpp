@@ -0,0 +1,263 @@
+#ifndef MY_TILE_MAP_HPP
+#define MY_TILE_MAP_HPP
+
+#include <glad/glad.h>
+
+#include <glm/glm.hpp>
+
+#include "Shaders.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <unordered_map>
+#include <vector>
+
+namespace myPrimitive {
+
+// Where a TileMap is looked at from: the board position, in cells, at the
+// top left of the viewport, and how many pixels a cell covers.
+struct TileView {
+    glm::dvec2 origin;
+    float cellPixels;
+};
+
+// A board of width x height cells, each a 16 bit tile ID (0 is empty),
+// drawn as one triangle over the viewport whose fragment shader looks the
+// tiles up. The IDs live in CHUNK x CHUNK chunks: on the CPU only the ones
+// that were edited, on the GPU a residentChunks squared window of them in an
+// R16UI texture the board wraps around, so a chunk coming into view is one
+// sub-image upload into the slot of one that left. Cost per frame depends on
+// the pixels drawn and the chunks newly in view, not on the board's size.
+class TileMap {
+public:
+    static constexpr int CHUNK = 64;
+
+    // cells of chunks that were never edited come from here, or are empty
+    typedef uint16_t (*Generator)(int x, int y);
+
+    TileMap(int width, int height) : width(width), height(height) {};
+    ~TileMap() { destroy(); };
+
+    /* ONCE */
+    // the view may show up to (residentChunks - 1) * CHUNK cells across
+    void initialize(int residentChunks = 16);
+    // gives the textures and vertex array back, before the context goes away
+    void destroy();
+
+    // tiles tilePixels squared, columns to a row, tile 0 unused; replaces
+    // the generated one
+    void setAtlas(GLuint texture, int columns, int tilePixels);
+
+    uint16_t get(int x, int y) const;
+    // one texel upload when the cell's chunk is resident
+    void set(int x, int y, uint16_t id);
+
+    // uploads the chunks that came into view, then draws
+    void draw(const TileView& view);
+
+    Generator generator = nullptr;
+
+    // since initialize()
+    size_t chunkUploads() const { return uploadedChunks; }
+    size_t cellUploads() const { return uploadedCells; }
+    size_t storedChunks() const { return chunks.size(); }
+
+    const int width, height;
+
+private:
+    static constexpr uint64_t NO_CHUNK = ~0ull;
+
+    GpuVertexArray VAO;
+    GpuTexture cellTexture;
+    GpuTexture generatedAtlas;
+    GLuint atlasTexture;
+    GLuint shaderProgram;
+    GLint viewportLoc, originCellLoc, originFractionLoc, cellPixelsLoc;
+    int resident = 0;
+    std::vector<uint64_t> slots;
+    std::unordered_map<uint64_t, std::vector<uint16_t>> chunks;
+    std::vector<uint16_t> scratch;
+    size_t uploadedChunks = 0, uploadedCells = 0;
+    bool reportedTooLarge = false;
+
+    static uint64_t chunkKey(int cx, int cy) { return (uint64_t)(uint32_t)cy << 32 | (uint32_t)cx; }
+    int slotOf(int cx, int cy) const { return (cy % resident) * resident + cx % resident; }
+    void fillChunk(int cx, int cy, uint16_t* cells) const;
+    void uploadChunk(int cx, int cy);
+};
+
+void TileMap::initialize(int residentChunks)
+{
+    resident = residentChunks;
+    slots.assign((size_t)resident * resident, NO_CHUNK);
+    scratch.resize(CHUNK * CHUNK);
+
+    shaderProgram = shaderCache().get(TILEMAP_VS, TILEMAP_FS);
+    viewportLoc = glGetUniformLocation(shaderProgram, "viewport");
+    originCellLoc = glGetUniformLocation(shaderProgram, "originCell");
+    originFractionLoc = glGetUniformLocation(shaderProgram, "originFraction");
+    cellPixelsLoc = glGetUniformLocation(shaderProgram, "cellPixels");
+
+    // integer textures are only complete with nearest filtering
+    cellTexture = gpuResources().createTexture(GPU_TEXTURES, GL_TEXTURE_2D, "tile cells");
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_R16UI, resident * CHUNK, resident * CHUNK, 0, GL_RED_INTEGER, GL_UNSIGNED_SHORT, NULL);
+    gpuResources().setTextureBytes(cellTexture, (size_t)resident * CHUNK * resident * CHUNK * sizeof(uint16_t));
+
+    // a default atlas of 16 flat tiles with a darker border
+    const int tilePixels = 16, columns = 16;
+    std::vector<uint32_t> texels(columns * tilePixels * tilePixels, 0);
+    for (int t = 1; t < columns; t++) {
+        glm::vec3 color = glm::vec3(0.35f) + 0.6f * glm::vec3((t & 1) ? 1.0f : 0.3f, (t & 2) ? 1.0f : 0.3f, (t & 4) ? 1.0f : 0.3f);
+        if (t & 8)
+            color *= 0.6f;
+        for (int y = 0; y < tilePixels; y++)
+            for (int x = 0; x < tilePixels; x++) {
+                bool border = x == 0 || y == 0 || x == tilePixels - 1 || y == tilePixels - 1;
+                glm::vec3 c = (border ? 0.5f : 1.0f) * color * 255.0f;
+                texels[y * columns * tilePixels + t * tilePixels + x] = (uint32_t)c.r | (uint32_t)c.g << 8 | (uint32_t)c.b << 16 | 255u << 24;
+            }
+    }
+    generatedAtlas = gpuResources().createTexture(GPU_TEXTURES, GL_TEXTURE_2D, "tile atlas");
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, columns * tilePixels, tilePixels, 0, GL_RGBA, GL_UNSIGNED_BYTE, texels.data());
+    gpuResources().setTextureBytes(generatedAtlas, texels.size() * sizeof(uint32_t));
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    VAO = gpuResources().createVertexArray("tile map");
+
+    glUseProgram(shaderProgram);
+    glUniform1i(glGetUniformLocation(shaderProgram, "cells"), 0);
+    glUniform1i(glGetUniformLocation(shaderProgram, "atlas"), 1);
+    glUniform2i(glGetUniformLocation(shaderProgram, "boardSize"), width, height);
+    setAtlas(generatedAtlas.id(), columns, tilePixels);
+}
+
+void TileMap::destroy()
+{
+    VAO.reset();
+    cellTexture.reset();
+    generatedAtlas.reset();
+    // set() and draw() do nothing without resident chunks
+    resident = 0;
+}
+
+void TileMap::setAtlas(GLuint texture, int columns, int tilePixels)
+{
+    atlasTexture = texture;
+    glUseProgram(shaderProgram);
+    glUniform1i(glGetUniformLocation(shaderProgram, "atlasColumns"), columns);
+    glUniform1i(glGetUniformLocation(shaderProgram, "tilePixels"), tilePixels);
+}
+
+uint16_t TileMap::get(int x, int y) const
+{
+    if (x < 0 || y < 0 || x >= width || y >= height)
+        return 0;
+    auto it = chunks.find(chunkKey(x / CHUNK, y / CHUNK));
+    if (it != chunks.end())
+        return it->second[(y % CHUNK) * CHUNK + x % CHUNK];
+    return generator ? generator(x, y) : 0;
+}
+
+void TileMap::set(int x, int y, uint16_t id)
+{
+    if (x < 0 || y < 0 || x >= width || y >= height)
+        return;
+    int cx = x / CHUNK, cy = y / CHUNK;
+    uint64_t key = chunkKey(cx, cy);
+    auto it = chunks.find(key);
+    if (it == chunks.end()) {
+        it = chunks.emplace(key, std::vector<uint16_t>(CHUNK * CHUNK)).first;
+        fillChunk(cx, cy, it->second.data());
+    }
+    it->second[(y % CHUNK) * CHUNK + x % CHUNK] = id;
+
+    if (resident && slots[slotOf(cx, cy)] == key) {
+        int size = resident * CHUNK;
+        glBindTexture(GL_TEXTURE_2D, cellTexture.id());
+        glTexSubImage2D(GL_TEXTURE_2D, 0, x % size, y % size, 1, 1, GL_RED_INTEGER, GL_UNSIGNED_SHORT, &id);
+        uploadedCells++;
+    }
+}
+
+void TileMap::fillChunk(int cx, int cy, uint16_t* cells) const
+{
+    for (int y = 0; y < CHUNK; y++)
+        for (int x = 0; x < CHUNK; x++) {
+            int bx = cx * CHUNK + x, by = cy * CHUNK + y;
+            bool inside = bx < width && by < height;
+            cells[y * CHUNK + x] = inside && generator ? generator(bx, by) : 0;
+        }
+}
+
+void TileMap::uploadChunk(int cx, int cy)
+{
+    auto it = chunks.find(chunkKey(cx, cy));
+    const uint16_t* cells = scratch.data();
+    if (it != chunks.end())
+        cells = it->second.data();
+    else
+        fillChunk(cx, cy, scratch.data());
+    glTexSubImage2D(GL_TEXTURE_2D, 0, (cx % resident) * CHUNK, (cy % resident) * CHUNK, CHUNK, CHUNK,
+                    GL_RED_INTEGER, GL_UNSIGNED_SHORT, cells);
+    slots[slotOf(cx, cy)] = chunkKey(cx, cy);
+    uploadedChunks++;
+}
+
+void TileMap::draw(const TileView& view)
+{
+    // nothing on the GPU before initialize() or after destroy()
+    if (resident == 0)
+        return;
+
+    GLint viewport[4];
+    glGetIntegerv(GL_VIEWPORT, viewport);
+
+    // chunks under the viewport, clipped to the board
+    double right = view.origin.x + viewport[2] / view.cellPixels;
+    double bottom = view.origin.y + viewport[3] / view.cellPixels;
+    int cx0 = std::max(0, (int)std::floor(view.origin.x) / CHUNK);
+    int cy0 = std::max(0, (int)std::floor(view.origin.y) / CHUNK);
+    int cx1 = std::min((width - 1) / CHUNK, (int)std::floor(right) / CHUNK);
+    int cy1 = std::min((height - 1) / CHUNK, (int)std::floor(bottom) / CHUNK);
+    if (cx1 < cx0 || cy1 < cy0)
+        return;
+    if ((cx1 - cx0 >= resident || cy1 - cy0 >= resident) && !reportedTooLarge) {
+        std::cout << "ERROR::TILE_MAP::VIEW_LARGER_THAN_RESIDENT_CHUNKS" << std::endl;
+        reportedTooLarge = true;
+    }
+    cx1 = std::min(cx1, cx0 + resident - 1);
+    cy1 = std::min(cy1, cy0 + resident - 1);
+
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, cellTexture.id());
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 2);
+    for (int cy = cy0; cy <= cy1; cy++)
+        for (int cx = cx0; cx <= cx1; cx++)
+            if (slots[slotOf(cx, cy)] != chunkKey(cx, cy))
+                uploadChunk(cx, cy);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+    glm::dvec2 originCell = glm::floor(view.origin);
+    glm::vec2 originFraction = glm::vec2(view.origin - originCell);
+    glUseProgram(shaderProgram);
+    glUniform4f(viewportLoc, (float)viewport[0], (float)viewport[1], (float)viewport[2], (float)viewport[3]);
+    glUniform2i(originCellLoc, (int)originCell.x, (int)originCell.y);
+    glUniform2f(originFractionLoc, originFraction.x, originFraction.y);
+    glUniform1f(cellPixelsLoc, view.cellPixels);
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, atlasTexture);
+    glActiveTexture(GL_TEXTURE0);
+    glBindVertexArray(VAO.id());
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    glBindVertexArray(0);
+}
+
+}
+
+#endif
@@ -0,0 +1,244 @@
+// Sweep and prune (learnopengl/broadphase.h) over boxes spinning and moving
+// across a board: the time of a tick, the pairs found a second, and what
+// teleporting boxes and adding them in bulk cost. The pairs are checked
+// against testing every pair on a smaller board, through moves, teleports,
+// additions and removals; exits with 1 when they differ.
+//
+//   g++ -O2 broadphase.cpp -I../../include -lpthread -o broadphase
+//   ./broadphase [count]
+
+#include <learnopengl/broadphase.h>
+
+#include <glm/gtc/random.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+const int TICKS = 100;
+const float DELTA_TIME = 1.0f / 60.0f;
+
+double secondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// quads of side 8 to 16 on a square board sized for about 0.2 of board
+// covered, moving up to 60 units and turning up to 90 degrees a second
+struct Spinner
+{
+    glm::vec2 position, velocity;
+    float angle, spin, half;
+    uint32_t box;
+};
+
+struct Scene
+{
+    std::vector<Spinner> spinners;
+    float side;
+
+    Scene(size_t count) : side(std::sqrt((float)count * 144.0f / 0.2f)) {}
+
+    Spinner make() const
+    {
+        Spinner s;
+        s.position = glm::linearRand(glm::vec2(0.0f), glm::vec2(side));
+        s.velocity = glm::circularRand(glm::linearRand(0.0f, 60.0f));
+        s.angle = glm::linearRand(0.0f, 6.2831853f);
+        s.spin = glm::linearRand(-1.5707963f, 1.5707963f);
+        s.half = glm::linearRand(4.0f, 8.0f);
+        return s;
+    }
+
+    static void bounds(const Spinner& s, glm::vec2& min, glm::vec2& max) { obbBounds(s.position, glm::vec2(s.half), s.angle, min, max); }
+
+    void add(SweepAndPrune& broadphase, size_t count)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            Spinner s = make();
+            glm::vec2 min, max;
+            bounds(s, min, max);
+            s.box = broadphase.add(min, max);
+            spinners.push_back(s);
+        }
+    }
+
+    // boxes bounce off the edges of the board
+    void tick(SweepAndPrune& broadphase)
+    {
+        for (Spinner& s : spinners)
+        {
+            s.position += s.velocity * DELTA_TIME;
+            for (int axis = 0; axis < 2; axis++)
+                if (s.position[axis] < 0.0f || s.position[axis] > side)
+                {
+                    s.position[axis] = glm::clamp(s.position[axis], 0.0f, side);
+                    s.velocity[axis] = -s.velocity[axis];
+                }
+            s.angle += s.spin * DELTA_TIME;
+            glm::vec2 min, max;
+            bounds(s, min, max);
+            broadphase.move(s.box, min, max);
+        }
+    }
+
+    void teleport(SweepAndPrune& broadphase, size_t count)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            Spinner& s = spinners[std::rand() % spinners.size()];
+            s.position = glm::linearRand(glm::vec2(0.0f), glm::vec2(side));
+            glm::vec2 min, max;
+            bounds(s, min, max);
+            broadphase.move(s.box, min, max);
+        }
+    }
+
+    void remove(SweepAndPrune& broadphase, size_t count)
+    {
+        for (size_t i = 0; i < count && !spinners.empty(); i++)
+        {
+            size_t k = std::rand() % spinners.size();
+            broadphase.remove(spinners[k].box);
+            spinners[k] = spinners.back();
+            spinners.pop_back();
+        }
+    }
+};
+
+// every pair of boxes, the smaller id first, in order
+std::vector<glm::uvec2> allPairs(const Scene& scene)
+{
+    std::vector<glm::uvec2> pairs;
+    for (size_t i = 0; i < scene.spinners.size(); i++)
+    {
+        glm::vec2 amin, amax;
+        Scene::bounds(scene.spinners[i], amin, amax);
+        for (size_t j = i + 1; j < scene.spinners.size(); j++)
+        {
+            glm::vec2 bmin, bmax;
+            Scene::bounds(scene.spinners[j], bmin, bmax);
+            if (amin.x <= bmax.x && bmin.x <= amax.x && amin.y <= bmax.y && bmin.y <= amax.y)
+            {
+                uint32_t a = scene.spinners[i].box, b = scene.spinners[j].box;
+                pairs.push_back(a < b ? glm::uvec2(a, b) : glm::uvec2(b, a));
+            }
+        }
+    }
+    return pairs;
+}
+
+bool samePairs(std::vector<glm::uvec2> expected, std::vector<glm::uvec2> actual)
+{
+    auto order = [](glm::uvec2 a, glm::uvec2 b) { return a.x < b.x || (a.x == b.x && a.y < b.y); };
+    std::sort(expected.begin(), expected.end(), order);
+    std::sort(actual.begin(), actual.end(), order);
+    return expected == actual;
+}
+
+// moves, teleports, bulk additions and removals on a board small enough to
+// test every pair of
+bool check()
+{
+    glm::seedRandom(5);
+    std::srand(5);
+    SweepAndPrune broadphase;
+    Scene scene(4000);
+    scene.add(broadphase, 4000);
+    bool ok = true;
+    size_t pairs = 0;
+    for (int t = 0; t < 40; t++)
+    {
+        scene.tick(broadphase);
+        if (t == 10)
+            scene.teleport(broadphase, 1000);
+        if (t == 20)
+            scene.add(broadphase, 3000);
+        if (t == 25)
+            scene.add(broadphase, 20);
+        if (t == 30)
+            scene.remove(broadphase, 2500);
+        if (t == 35)
+        {
+            scene.remove(broadphase, 10);
+            scene.add(broadphase, 10);
+        }
+        broadphase.update();
+        pairs += broadphase.pairs().size();
+        if (!samePairs(allPairs(scene), broadphase.pairs()))
+        {
+            std::printf("tick %d: %zu pairs, every pair gives %zu\n", t, broadphase.pairs().size(), allPairs(scene).size());
+            ok = false;
+        }
+    }
+    std::printf("40 ticks of 4000 to 7000 boxes: %zu pairs, %s\n", pairs, ok ? "all agree with testing every pair" : "MISMATCH");
+    return ok;
+}
+
+int main(int argc, char** argv)
+{
+    size_t count = argc > 1 ? (size_t)std::atol(argv[1]) : 100000;
+    bool ok = check();
+
+    glm::seedRandom(1);
+    std::srand(1);
+    SweepAndPrune broadphase;
+    Scene scene(count);
+    scene.add(broadphase, count);
+    auto start = std::chrono::steady_clock::now();
+    broadphase.update();
+    std::printf("%zu boxes, %u threads: first update (radix sort) %.2f ms, %zu pairs\n", count, jobSystem().threadCount(),
+                secondsSince(start) * 1e3, broadphase.pairs().size());
+
+    // moving: the insertion sorts
+    double moving = 0.0;
+    size_t pairs = 0, shifts = 0;
+    int rebuilds = 0;
+    for (int t = 0; t < TICKS; t++)
+    {
+        scene.tick(broadphase);
+        start = std::chrono::steady_clock::now();
+        broadphase.update();
+        moving += secondsSince(start);
+        pairs += broadphase.pairs().size();
+        shifts += broadphase.shiftCount();
+        rebuilds += broadphase.rebuildCount();
+    }
+    std::printf("moving:      %.3f ms a tick, %zu pairs, %.1f shifts a box, %d rebuilds, %.1f Mpairs/s\n", moving / TICKS * 1e3,
+                pairs / TICKS, (double)shifts / TICKS / count, rebuilds, pairs / moving / 1e6);
+
+    // a tenth teleported every tick: the radix sort rebuilds
+    double teleporting = 0.0;
+    rebuilds = 0;
+    for (int t = 0; t < TICKS; t++)
+    {
+        scene.tick(broadphase);
+        scene.teleport(broadphase, count / 10);
+        start = std::chrono::steady_clock::now();
+        broadphase.update();
+        teleporting += secondsSince(start);
+        rebuilds += broadphase.rebuildCount();
+    }
+    std::printf("teleporting: %.3f ms a tick, %d rebuilds\n", teleporting / TICKS * 1e3, rebuilds);
+
+    // as many again at once
+    scene.add(broadphase, count);
+    start = std::chrono::steady_clock::now();
+    broadphase.update();
+    std::printf("adding %zu:  %.3f ms, %d rebuilds, %zu pairs\n", count, secondsSince(start) * 1e3, broadphase.rebuildCount(),
+                broadphase.pairs().size());
+
+    // every pair, on a tenth of the boxes
+    Scene few(count / 10);
+    SweepAndPrune unused;
+    few.add(unused, count / 10);
+    start = std::chrono::steady_clock::now();
+    size_t allCount = allPairs(few).size();
+    double all = secondsSince(start);
+    std::printf("every pair of %zu boxes: %.1f ms for %zu pairs, so about %.0f s for %zu\n", count / 10, all * 1e3, allCount, all * 100.0,
+                count);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,130 @@
+// Picking in a million triangles with Bvh (learnopengl/bvh.h): the time to
+// build the hierarchy, to pick with one ray through the cursor and with
+// packets of sixteen rays around it. A few hundred of the rays are checked
+// against every triangle; exits with 1 when the hierarchy finds another hit.
+//
+//   g++ -O2 bvh_pick.cpp -I../../include -o bvh_pick
+
+#include <learnopengl/bvh.h>
+#include <learnopengl/camera.h>
+
+#include "terrain_mesh.hpp"
+
+#include <glm/gtc/type_ptr.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+// 708 x 708 vertices, 1000818 triangles
+const int GRID = 708;
+const glm::vec2 VIEWPORT(1280.0f, 720.0f);
+
+double secondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// the nearest hit over every triangle, the answer the hierarchy must give
+RayHit bruteForce(const std::vector<float>& vertices, const std::vector<uint32_t>& indices, const Ray& ray)
+{
+    RayHit hit;
+    for (size_t t = 0; t * 3 < indices.size(); t++)
+    {
+        glm::vec3 v[3];
+        for (int c = 0; c < 3; c++)
+            v[c] = glm::make_vec3(&vertices[(size_t)indices[t * 3 + c] * TERRAIN_FLOATS]);
+        glm::vec2 barycentric;
+        float distance;
+        if (glm::intersectRayTriangle(ray.origin, ray.direction, v[0], v[1], v[2], barycentric, distance) && distance >= 0.0f &&
+            (!hit.hit || distance < hit.distance))
+        {
+            hit.hit = true;
+            hit.distance = distance;
+            hit.object = 0;
+            hit.triangle = (uint32_t)t;
+            hit.barycentric = barycentric;
+        }
+    }
+    return hit;
+}
+
+bool same(const RayHit& a, const RayHit& b)
+{
+    if (a.hit != b.hit)
+        return false;
+    // a ray through a shared edge may take either triangle at the same distance
+    return !a.hit || glm::abs(a.distance - b.distance) <= 1e-4f * b.distance;
+}
+
+int main()
+{
+    std::vector<float> vertices = terrainVertices(GRID);
+    std::vector<uint32_t> indices = terrainIndices(GRID);
+    size_t triangles = indices.size() / 3;
+
+    Bvh bvh;
+    auto start = std::chrono::steady_clock::now();
+    bvh.addMesh(0, vertices.data(), TERRAIN_FLOATS, indices.data(), triangles);
+    double gather = secondsSince(start);
+    start = std::chrono::steady_clock::now();
+    bvh.build();
+    double build = secondsSince(start);
+    std::printf("%zu triangles, %zu nodes: gathered in %.1f ms, built in %.1f ms\n", bvh.triangleCount(), bvh.nodeCount(),
+                gather * 1e3, build * 1e3);
+
+    // a camera above the terrain, looking down on most of it
+    Camera camera(glm::vec3(0.0f, 3.0f, 1.5f), glm::vec3(0.0f, 1.0f, 0.0f), -90.0f, -70.0f);
+    camera.SetPerspective(VIEWPORT.x / VIEWPORT.y);
+    glm::mat4 inverseViewProjection = camera.GetInverseViewProjectionMatrix();
+
+    // cursors on a grid over the window, each with a packet of the 4 x 4
+    // pixels from it, the first of which is the cursor's own ray
+    const int CURSORS = 64 * 36;
+    std::vector<Ray> rays;
+    std::vector<Ray> packets;
+    for (int y = 0; y < 36; y++)
+        for (int x = 0; x < 64; x++)
+        {
+            glm::vec2 cursor((x + 0.5f) * VIEWPORT.x / 64.0f, (y + 0.5f) * VIEWPORT.y / 36.0f);
+            rays.push_back(cursorRay(inverseViewProjection, cursor, VIEWPORT));
+            for (int p = 0; p < Bvh::PACKET; p++)
+                packets.push_back(cursorRay(inverseViewProjection, cursor + glm::vec2(p % 4, p / 4), VIEWPORT));
+        }
+
+    bool ok = true;
+    size_t checked = 0, hits = 0;
+    std::vector<RayHit> packetHits(packets.size());
+    bvh.intersect(packets.data(), packetHits.data(), packets.size());
+    for (int i = 0; i < CURSORS; i += 7)
+    {
+        RayHit expected = bruteForce(vertices, indices, rays[i]);
+        RayHit single = bvh.intersect(rays[i]);
+        if (!same(single, expected) || !same(packetHits[i * Bvh::PACKET], expected))
+        {
+            std::printf("cursor %d: the hierarchy hit %d at %f, every triangle %d at %f\n", i, single.hit, single.distance,
+                        expected.hit, expected.distance);
+            ok = false;
+        }
+        checked++;
+        hits += expected.hit;
+    }
+    std::printf("%zu rays checked against every triangle, %zu hit, %s\n", checked, hits, ok ? "all agree" : "MISMATCH");
+
+    const int REPEAT = 20;
+    size_t picked = 0;
+    start = std::chrono::steady_clock::now();
+    for (int r = 0; r < REPEAT; r++)
+        for (const Ray& ray : rays)
+            picked += bvh.intersect(ray).hit;
+    double single = secondsSince(start) / (REPEAT * rays.size());
+
+    start = std::chrono::steady_clock::now();
+    for (int r = 0; r < REPEAT; r++)
+        bvh.intersect(packets.data(), packetHits.data(), packets.size());
+    double packet = secondsSince(start) / (REPEAT * packets.size());
+
+    std::printf("one ray:      %.2f us a pick, %zu of %zu hit\n", single * 1e6, picked / REPEAT, rays.size());
+    std::printf("packets of %d: %.2f us a ray, %.2f us a packet\n", Bvh::PACKET, packet * 1e6, packet * Bvh::PACKET * 1e6);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,118 @@
+// Frame of the entity grid without a window: move, wrap and gather the draw
+// instances of many squares, through the EntityWorld (learnopengl/entity_world.h,
+// src/GridEntities.hpp) and through an array of Player-like objects that each
+// carry their bounds and GL handles, single and multi threaded.
+//
+//   g++ -O2 entities.cpp -I../../include -lpthread -o entities
+//   ./entities [count]
+
+#include "../GridEntities.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+const int REPEAT = 20;
+const float DELTA_TIME = 1.0f / 60.0f;
+const myGame::Board BOARD = { 64.0f, 64.0f, 448.0f, 448.0f };
+
+// what one Player holds, plus the velocity and tint the squares need
+struct PlayerLike
+{
+    unsigned int VAO, shaderProgram;
+    int modelLoc, colorLoc;
+    float p_pos[3];
+    unsigned int size;
+    bool isMove;
+    float min_x_pos, min_y_pos, max_x_pos, max_y_pos;
+    float velocity[2];
+    uint32_t rgba;
+};
+
+template<typename F>
+double run(F f)
+{
+    f(); // warm up
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < REPEAT; i++)
+        f();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    // milliseconds per frame
+    return elapsed.count() * 1000.0 / REPEAT;
+}
+
+int main(int argc, char** argv)
+{
+    size_t count = argc > 1 ? std::strtoul(argv[1], NULL, 10) : 1000000;
+
+    EntityWorld world;
+    world.reserve<myGame::Position, myGame::Velocity, myGame::Extent, myGame::Tint>(count);
+    std::vector<PlayerLike> players(count);
+    std::srand(1);
+    for (size_t i = 0; i < count; i++)
+    {
+        float x = BOARD.min_x + (float)std::rand() / RAND_MAX * (BOARD.max_x - BOARD.min_x);
+        float y = BOARD.min_y + (float)std::rand() / RAND_MAX * (BOARD.max_y - BOARD.min_y);
+        float vx = (float)std::rand() / RAND_MAX * 128.0f - 64.0f, vy = (float)std::rand() / RAND_MAX * 128.0f - 64.0f;
+        world.create(myGame::Position{ x, y }, myGame::Velocity{ vx, vy }, myGame::Extent{ 2.0f }, myGame::Tint{ 0xffffffffu });
+        PlayerLike& p = players[i];
+        p.p_pos[0] = x; p.p_pos[1] = y; p.p_pos[2] = 0.0f;
+        p.size = 2;
+        p.min_x_pos = BOARD.min_x; p.min_y_pos = BOARD.min_y; p.max_x_pos = BOARD.max_x; p.max_y_pos = BOARD.max_y;
+        p.velocity[0] = vx; p.velocity[1] = vy;
+        p.rgba = 0xffffffffu;
+    }
+    std::vector<myGame::EntityInstance> instances(count);
+
+    double objects = run([&]()
+    {
+        for (PlayerLike& p : players)
+        {
+            p.p_pos[0] += p.velocity[0] * DELTA_TIME;
+            p.p_pos[1] += p.velocity[1] * DELTA_TIME;
+        }
+        for (PlayerLike& p : players)
+        {
+            float w = p.max_x_pos - p.min_x_pos, h = p.max_y_pos - p.min_y_pos;
+            if (p.p_pos[0] < p.min_x_pos) p.p_pos[0] += w;
+            else if (p.p_pos[0] > p.max_x_pos) p.p_pos[0] -= w;
+            if (p.p_pos[1] < p.min_y_pos) p.p_pos[1] += h;
+            else if (p.p_pos[1] > p.max_y_pos) p.p_pos[1] -= h;
+        }
+        for (size_t i = 0; i < players.size(); i++)
+        {
+            instances[i].x = players[i].p_pos[0];
+            instances[i].y = players[i].p_pos[1];
+            instances[i].size = (float)players[i].size;
+            instances[i].rgba = players[i].rgba;
+        }
+    });
+
+    double move = 0.0, wrap = 0.0, gather = 0.0;
+    auto frame = [&](unsigned threads)
+    {
+        move = run([&]() { myGame::moveEntities(world, DELTA_TIME, threads); });
+        wrap = run([&]() { myGame::wrapEntities(world, BOARD, threads); });
+        gather = run([&]() { myGame::gatherInstances(world, instances.data(), threads); });
+    };
+
+    std::printf("%zu entities, ms per frame (budget 16.7)\n", count);
+    std::printf("player objects        %7.2f\n", objects);
+    frame(1);
+    std::printf("world, 1 thread       %7.2f  (move %.2f, wrap %.2f, gather %.2f)\n", move + wrap + gather, move, wrap, gather);
+    unsigned threads = std::thread::hardware_concurrency();
+    if (threads > 1)
+    {
+        frame(threads);
+        std::printf("world, %2u threads     %7.2f  (move %.2f, wrap %.2f, gather %.2f)\n", threads, move + wrap + gather, move, wrap, gather);
+    }
+
+    // instances come out in creation order while nothing was destroyed
+    double check = 0.0;
+    for (size_t i = 0; i < count; i += 997)
+        check += instances[i].x + instances[i].y;
+    std::printf("(check %.1f)\n", check);
+    return 0;
+}
@@ -0,0 +1,156 @@
+// Frame memory (learnopengl/frame_memory.h): runs a simulated frame that
+// builds scratch vertex arrays and strings, churns pooled objects and decodes
+// both demo textures through the stb_image hooks, and fails when a frame past
+// the warm-up still allocates from the heap. Then compares arena and pool
+// allocation against new/delete.
+//
+//   g++ -O2 frame_memory.cpp -I../../include -o frame_memory
+//   ./frame_memory && echo ok
+
+#define LOGL_COUNT_HEAP_ALLOCATIONS
+#define LOGL_STBI_FRAME_MEMORY
+#include <learnopengl/frame_memory.h>
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+
+#include <learnopengl/mapped_file.h>
+
+#include <chrono>
+#include <cstdio>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+const int FRAMES = 200;
+const int WARMUP = 5;
+const int PARTICLES = 1000;
+const int REPEAT = 2000;
+
+struct Particle
+{
+    float position[3];
+    float velocity[3];
+    float life;
+};
+
+MappedFile textures[2];
+
+// Returns a value depending on everything the frame computed, so none of it is optimized out.
+unsigned frame(ObjectPool<Particle>& particles, std::vector<Particle*>& live, int index)
+{
+    FrameMemory& memory = frameMemory();
+    unsigned check = 0;
+
+    // grid lines, as LineGrid::initialize builds them
+    std::pmr::vector<float> vertices(memory.resource());
+    for (float y = 0.0f; y < 512.0f; y += 8.0f)
+    {
+        float line[6] = { 0.0f, y, 0.0f, 512.0f, y, 0.0f };
+        vertices.insert(vertices.end(), line, line + 6);
+    }
+    check += (unsigned)vertices.size();
+
+    // a title longer than the small string buffer
+    std::pmr::string title("frame memory benchmark, frame ", memory.resource());
+    char number[16];
+    std::snprintf(number, sizeof(number), "%d", index);
+    title += number;
+    check += (unsigned)title.size();
+
+    // half the particles die and are replaced every frame
+    for (size_t i = 0; i < live.size(); i += 2)
+    {
+        particles.destroy(live[i]);
+        live[i] = particles.create(Particle{ { 0.0f, 0.0f, 0.0f }, { 1.0f, 0.0f, 0.0f }, (float)index });
+    }
+    check += (unsigned)live[index % live.size()]->life;
+
+    ArenaScope decodeScope(memory.arena());
+    for (MappedFile& file : textures)
+    {
+        int width, height, channels;
+        unsigned char* pixels = stbi_load_from_memory((const stbi_uc*)file.data(), (int)file.size(), &width, &height, &channels, 0);
+        if (pixels)
+            check += pixels[width * height * channels / 2];
+        stbi_image_free(pixels);
+    }
+    return check;
+}
+
+template<typename F>
+double run(F f)
+{
+    f(); // warm up
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < REPEAT; i++)
+        f();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    // million allocations per second
+    return (double)PARTICLES * REPEAT / elapsed.count() / 1e6;
+}
+
+int main()
+{
+    if (!textures[0].open("../../resources/textures/container.jpg") || !textures[1].open("../../resources/textures/awesomeface.png"))
+    {
+        std::printf("run from src/bench, the textures are read from ../../resources\n");
+        return 1;
+    }
+
+    ObjectPool<Particle> particles;
+    std::vector<Particle*> live(PARTICLES);
+    for (Particle*& p : live)
+        p = particles.create();
+
+    unsigned check = 0;
+    int failures = 0;
+    for (int i = 0; i < FRAMES; i++)
+    {
+        frameMemory().beginFrame();
+        if (i > WARMUP && frameMemory().lastFrame().heapAllocations != 0)
+        {
+            std::printf("frame %d: %zu heap allocations, %zu bytes\n", i - 1, frameMemory().lastFrame().heapAllocations, frameMemory().lastFrame().heapBytes);
+            failures++;
+        }
+        check += frame(particles, live, i);
+    }
+    frameMemory().beginFrame();
+    const MemoryCounters& last = frameMemory().lastFrame();
+    std::printf("steady frame: %zu heap, %zu arena allocations (%zu bytes); arena capacity %zu bytes\n",
+                last.heapAllocations, last.arenaAllocations, last.arenaBytes, frameMemory().arena().capacity());
+
+    // allocation throughput, million per second; new/delete includes the counting hook
+    std::vector<Particle*> pointers(PARTICLES);
+    double heap = run([&]()
+    {
+        for (Particle*& p : pointers)
+            p = new Particle();
+        for (Particle* p : pointers)
+            delete p;
+    });
+    double pool = run([&]()
+    {
+        for (Particle*& p : pointers)
+            p = particles.create();
+        for (Particle* p : pointers)
+            particles.destroy(p);
+    });
+    LinearArena arena(PARTICLES * sizeof(Particle));
+    double bump = run([&]()
+    {
+        arena.reset();
+        for (Particle*& p : pointers)
+            p = new (arena.allocate<Particle>(1)) Particle();
+    });
+    for (Particle* p : pointers)
+        check += (unsigned)p->life;
+    std::printf("new/delete %8.1f M/s\npool       %8.1f M/s\narena      %8.1f M/s\n", heap, pool, bump);
+    std::printf("(check %u)\n", check);
+
+    if (failures)
+    {
+        std::printf("FAILED: %d of %d steady frames allocated from the heap\n", failures, FRAMES - WARMUP - 1);
+        return 1;
+    }
+    return 0;
+}
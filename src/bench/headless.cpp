@@ -0,0 +1,615 @@
+// The demo scenes rendered offscreen (learnopengl/headless.h) for a fixed
+// number of frames, each read back before the next starts, on whatever EGL
+// offers: the GPU, or Mesa's llvmpipe on a machine without one. Every scene
+// is a pure function of the frame number, so the checksum of the last frame
+// is the same on every run with the same driver. Exits with 1 when a scene
+// leaves GPU resources behind, or fails to load a file, link a shader or find
+// a uniform block (run it from src/bench/), which also replaces the scene's
+// numbers with its error count. One JSON object per scene:
+//
+//   {"scene":"grid_player","width":512,"height":512,"frames":300,"renderer":"...",
+//    "min_ms":..,"mean_ms":..,"median_ms":..,"p95_ms":..,"p99_ms":..,"max_ms":..,"checksum":"..."}
+//
+//   g++ -O2 headless.cpp ../glad.c -I../../include -lpthread -lEGL -o headless
+//
+// Built with glad's traced loader mode, each scene is followed on stderr by
+// its most expensive GL calls a frame (learnopengl/gl_trace.h):
+//
+//   g++ -O2 -DGLAD_TRACE headless.cpp ../glad.c ../glad_trace.c -I../../include -lpthread -lEGL -o headless_trace
+//   ./headless [grid_player|quad_field|tiles_redrawn|tiles_cached|tile_map_near|tile_map_far|hud_overlay|mesh_float|mesh_quantized|camera_cubes|cube_crowd_uniforms|cube_crowd_blocks|all] [frames] [capture directory]
+
+#define PRIMITIVE_SHADER_DIR "../../resources/shaders/"
+
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+
+#include <learnopengl/headless.h>
+#include <learnopengl/camera.h>
+#include <learnopengl/gl_trace.h>
+#include <learnopengl/image_loader.h>
+#include <learnopengl/layer_cache.h>
+#include <learnopengl/shader_m.h>
+#include <learnopengl/transform_blocks.h>
+#include <learnopengl/vertex_format.h>
+
+#include "../LineGrid.hpp"
+#include "../Player.hpp"
+#include "../Quad.hpp"
+#include "../Hud.hpp"
+#include "../TileMap.hpp"
+#include "cube_scene.hpp"
+#include "terrain_mesh.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+const int WARMUP = 10;
+const int TRACE_TOP = 12;
+const float FRAME_TIME = 1.0f / 60.0f;
+
+// loads and block lookups that failed in the scene being run; shader errors
+// are counted by shaderCache() and Shader::Linked
+int sceneErrors = 0;
+
+// the board of test_my_quad and player_test
+const float BOARD_SIZE = 512.0f;
+const float PADDING = 64.0f;
+const float CELL = 48.0f;
+
+struct SceneResult
+{
+    FrameStats stats;
+    uint64_t checksum;
+};
+
+// Renders frames 0..frames-1 after WARMUP untimed ones; the time of a frame
+// runs from its clear to its pixels being back in memory.
+template<typename F>
+SceneResult runScene(HeadlessContext& gl, int frames, F drawFrame, std::vector<uint32_t>& pixels)
+{
+    std::vector<double> ms;
+    ms.reserve(frames);
+    GLTrace trace;
+    for (int i = -WARMUP; i < frames; i++)
+    {
+        if (i >= 0)
+            trace.beginFrame();
+        auto start = std::chrono::steady_clock::now();
+        gl.bind();
+        drawFrame(i < 0 ? 0 : i);
+        gl.readPixels(pixels);
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        if (i >= 0)
+        {
+            trace.endFrame();
+            ms.push_back(elapsed.count());
+        }
+    }
+    trace.report(stderr, TRACE_TOP);
+    SceneResult result;
+    result.stats = frameStats(ms);
+    result.checksum = frameChecksum(pixels);
+    return result;
+}
+
+// grid and a player stepping one cell to the right every 8 frames
+SceneResult gridPlayer(HeadlessContext& gl, int frames, std::vector<uint32_t>& pixels)
+{
+    myPrimitive::LineGrid grid(BOARD_SIZE, BOARD_SIZE, PADDING, CELL);
+    grid.initialize();
+    myGame::Player player;
+    player.size = (unsigned int)CELL;
+    player.initialize();
+    int columns = (int)((BOARD_SIZE - 2.0f * PADDING) / CELL);
+
+    return runScene(gl, frames, [&](int frame) {
+        frameMemory().beginFrame();
+        glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        int step = frame / 8;
+        player.p_pos = glm::vec3(PADDING + CELL * (step % columns) + CELL / 2.0f,
+                                 PADDING + CELL * ((step / columns) % columns) + CELL / 2.0f, 0.0f);
+        grid.draw();
+        player.draw();
+    }, pixels);
+}
+
+// the spinning quads test_my_quad has commented out
+SceneResult quadField(HeadlessContext& gl, int frames, std::vector<uint32_t>& pixels)
+{
+    myPrimitive::LineGrid grid(BOARD_SIZE, BOARD_SIZE, PADDING, CELL);
+    grid.initialize();
+    myPrimitive::Quad quad;
+    quad.initialize();
+    float min_grid = PADDING + CELL / 2.0f;
+    float max_grid = BOARD_SIZE - PADDING - CELL / 2.0f;
+
+    return runScene(gl, frames, [&](int frame) {
+        frameMemory().beginFrame();
+        glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        grid.draw();
+        float angle = frame * FRAME_TIME * 64.0f;
+        for (float y = min_grid; y < max_grid; y += 2.0f * CELL) {
+            for (float x = min_grid; x < max_grid; x += 2.0f * CELL) {
+                quad.draw(glm::vec3(x, y, 0.0f), angle, (unsigned int)CELL);
+                quad.draw(glm::vec3(x + CELL, y + CELL, 0.0f), -angle, (unsigned int)CELL);
+            }
+        }
+    }, pixels);
+}
+
+// The board under a tile on every cell, the tiles turning a step every 60
+// frames, and the player walking over it. With cached set the grid and the
+// tiles are static layers in a LayerCache, redrawn only when the tiles turn.
+SceneResult tiledBoard(HeadlessContext& gl, int frames, std::vector<uint32_t>& pixels, bool cached)
+{
+    myPrimitive::LineGrid grid(BOARD_SIZE, BOARD_SIZE, PADDING, CELL);
+    grid.initialize();
+    myPrimitive::Quad quad;
+    quad.initialize();
+    myGame::Player player;
+    player.size = (unsigned int)CELL;
+    player.initialize();
+    int columns = (int)((BOARD_SIZE - 2.0f * PADDING) / CELL);
+
+    int tileStep = 0;
+    auto drawTiles = [&]() {
+        for (int row = 0; row < columns; row++)
+            for (int column = 0; column < columns; column++)
+                quad.draw(glm::vec3(PADDING + CELL * column + CELL / 2.0f, PADDING + CELL * row + CELL / 2.0f, 0.0f),
+                          (float)((row + column + tileStep) % 4) * 22.5f, (unsigned int)(CELL * 0.75f));
+    };
+    LayerCache layers;
+    layers.add([&]() { grid.draw(); });
+    layers.add(drawTiles);
+
+    SceneResult result = runScene(gl, frames, [&](int frame) {
+        frameMemory().beginFrame();
+        if (frame / 60 != tileStep)
+        {
+            tileStep = frame / 60;
+            layers.invalidate();
+        }
+        if (cached)
+        {
+            layers.composite();
+        }
+        else
+        {
+            glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT);
+            grid.draw();
+            drawTiles();
+        }
+        int step = frame / 8;
+        player.p_pos = glm::vec3(PADDING + CELL * (step % columns) + CELL / 2.0f,
+                                 PADDING + CELL * ((step / columns) % columns) + CELL / 2.0f, 0.0f);
+        player.draw();
+    }, pixels);
+    return result;
+}
+
+SceneResult tilesRedrawn(HeadlessContext& gl, int frames, std::vector<uint32_t>& pixels)
+{
+    return tiledBoard(gl, frames, pixels, false);
+}
+
+SceneResult tilesCached(HeadlessContext& gl, int frames, std::vector<uint32_t>& pixels)
+{
+    return tiledBoard(gl, frames, pixels, true);
+}
+
+// a quarter of the cells empty, the rest one of the 15 generated tiles
+uint16_t boardTile(int x, int y)
+{
+    uint32_t h = (uint32_t)x * 73856093u ^ (uint32_t)y * 19349663u;
+    h ^= h >> 13;
+    h *= 0x5bd1e995u;
+    h ^= h >> 15;
+    return (h & 3) == 0 ? 0 : (uint16_t)(1 + h % 15);
+}
+
+// A 65536 x 65536 cell TileMap panned diagonally 8 pixels a frame, painting
+// one cell in view every frame. Near and far differ 256 times in the cells
+// they show, not in the pixels they cover.
+SceneResult tileMap(HeadlessContext& gl, int frames, std::vector<uint32_t>& pixels, float cellPixels, int residentChunks)
+{
+    myPrimitive::TileMap tiles(65536, 65536);
+    tiles.generator = boardTile;
+    tiles.initialize(residentChunks);
+
+    return runScene(gl, frames, [&](int frame) {
+        glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        double pan = 8.0 / cellPixels * frame;
+        myPrimitive::TileView view = { glm::dvec2(30000.0 + pan, 20000.0 + pan * 0.5), cellPixels };
+        tiles.set((int)view.origin.x + frame % 16, (int)view.origin.y + frame % 16, (uint16_t)(1 + frame % 15));
+        tiles.draw(view);
+    }, pixels);
+}
+
+SceneResult tileMapNear(HeadlessContext& gl, int frames, std::vector<uint32_t>& pixels)
+{
+    return tileMap(gl, frames, pixels, 16.0f, 4);
+}
+
+SceneResult tileMapFar(HeadlessContext& gl, int frames, std::vector<uint32_t>& pixels)
+{
+    return tileMap(gl, frames, pixels, 1.0f, 10);
+}
+
+// grid_player with a HUD of some 600 glyphs on top: the difference between
+// the two is what the overlay costs a frame
+SceneResult hudOverlay(HeadlessContext& gl, int frames, std::vector<uint32_t>& pixels)
+{
+    myPrimitive::LineGrid grid(BOARD_SIZE, BOARD_SIZE, PADDING, CELL);
+    grid.initialize();
+    myGame::Player player;
+    player.size = (unsigned int)CELL;
+    player.p_pos = glm::vec3(PADDING + CELL / 2.0f, PADDING + CELL / 2.0f, 0.0f);
+    player.initialize();
+    myPrimitive::Hud hud;
+    hud.initialize();
+    myPrimitive::FrameTimes frameTimes;
+
+    return runScene(gl, frames, [&](int frame) {
+        frameMemory().beginFrame();
+        glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        grid.draw();
+        player.draw();
+        // synthetic times so the text, like the rest, depends on the frame only
+        frameTimes.add(16.0f + (frame * 7 % 13) * 0.1f);
+        int y = hud.frameStats(8, 8, frameTimes);
+        for (int line = 0; line < 16; line++, y += hud.lineHeight())
+            hud.text(8, y, glm::vec4(0.4f, 1.0f, 0.4f, 1.0f), "system %02d %8.3f ms %6d entities", line, frame * 0.001f * line, frame * line);
+        hud.draw(gl.width, gl.height);
+    }, pixels);
+}
+
+// A 128 x 128 vertex terrain drawn nine times, the camera circling it, from
+// 48 byte float vertices or from the 20 byte packed ones; the two differ in
+// the bytes fetched a vertex and in the last bits of the pixels.
+SceneResult terrainMesh(HeadlessContext& gl, int frames, std::vector<uint32_t>& pixels, bool quantized)
+{
+    const int N = 128;
+    std::vector<float> vertices = terrainVertices(N);
+    std::vector<uint32_t> indices = terrainIndices(N);
+    glEnable(GL_DEPTH_TEST);
+    GLuint program = shaderCache().get(PRIMITIVE_SHADER_DIR "mesh.vs", PRIMITIVE_SHADER_DIR "mesh.fs", quantized ? SHADER_QUANTIZED : 0);
+
+    GLuint VAO, VBO, EBO;
+    glGenVertexArrays(1, &VAO);
+    glGenBuffers(1, &VBO);
+    glGenBuffers(1, &EBO);
+    glBindVertexArray(VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+    VertexFormat format;
+    if (quantized)
+        format.add(0, 3, VERTEX_INT16, 0).add(1, 3, VERTEX_OCTAHEDRAL, 3).add(2, 2, VERTEX_HALF, 6).add(3, 4, VERTEX_UNORM8, 8);
+    else
+        format.add(0, 3, VERTEX_FLOAT, 0).add(1, 3, VERTEX_FLOAT, 3).add(2, 2, VERTEX_FLOAT, 6).add(3, 4, VERTEX_FLOAT, 8);
+    std::vector<unsigned char> packed((size_t)N * N * format.stride());
+    format.encode(vertices.data(), (size_t)N * N, TERRAIN_FLOATS, packed.data());
+    glBufferData(GL_ARRAY_BUFFER, packed.size(), packed.data(), GL_STATIC_DRAW);
+    format.setAttributes();
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(uint32_t), indices.data(), GL_STATIC_DRAW);
+
+    glUseProgram(program);
+    glm::vec3 positionScale = format.scale(0), positionOffset = format.offset(0);
+    glm::vec3 light = glm::normalize(glm::vec3(-0.4f, -1.0f, -0.3f));
+    glUniform3fv(glGetUniformLocation(program, "positionScale"), 1, &positionScale[0]);
+    glUniform3fv(glGetUniformLocation(program, "positionOffset"), 1, &positionOffset[0]);
+    glUniform3fv(glGetUniformLocation(program, "lightDirection"), 1, &light[0]);
+    glm::mat4 projection = glm::perspective(glm::radians(45.0f), (float)gl.width / (float)gl.height, 0.1f, 100.0f);
+    glUniformMatrix4fv(glGetUniformLocation(program, "projection"), 1, GL_FALSE, &projection[0][0]);
+    GLint viewLoc = glGetUniformLocation(program, "view"), modelLoc = glGetUniformLocation(program, "model");
+
+    SceneResult result = runScene(gl, frames, [&](int frame) {
+        glClearColor(0.5f, 0.6f, 0.7f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        float angle = glm::radians(frame * 0.5f);
+        glm::mat4 view = glm::lookAt(glm::vec3(18.0f * std::cos(angle), 10.0f, 18.0f * std::sin(angle)), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+        glUseProgram(program);
+        glUniformMatrix4fv(viewLoc, 1, GL_FALSE, &view[0][0]);
+        glBindVertexArray(VAO);
+        for (int z = -1; z <= 1; z++)
+            for (int x = -1; x <= 1; x++)
+            {
+                glm::mat4 model = glm::translate(glm::mat4(1.0f), glm::vec3(x * 9.0f, 0.0f, z * 9.0f));
+                glUniformMatrix4fv(modelLoc, 1, GL_FALSE, &model[0][0]);
+                glDrawElements(GL_TRIANGLES, (GLsizei)indices.size(), GL_UNSIGNED_INT, 0);
+            }
+    }, pixels);
+
+    glDeleteVertexArrays(1, &VAO);
+    glDeleteBuffers(1, &VBO);
+    glDeleteBuffers(1, &EBO);
+    glDisable(GL_DEPTH_TEST);
+    return result;
+}
+
+SceneResult meshFloat(HeadlessContext& gl, int frames, std::vector<uint32_t>& pixels)
+{
+    return terrainMesh(gl, frames, pixels, false);
+}
+
+SceneResult meshQuantized(HeadlessContext& gl, int frames, std::vector<uint32_t>& pixels)
+{
+    return terrainMesh(gl, frames, pixels, true);
+}
+
+unsigned int loadTexture(const char* path, GLenum format)
+{
+    unsigned int texture;
+    glGenTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    int width, height, channels;
+    unsigned char* data = loadImage(path, &width, &height, &channels);
+    if (data)
+    {
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, format, GL_UNSIGNED_BYTE, data);
+        glGenerateMipmap(GL_TEXTURE_2D);
+    }
+    else
+    {
+        std::printf("Failed to load %s\n", path);
+        sceneErrors++;
+    }
+    stbi_image_free(data);
+    return texture;
+}
+
+// the camera demo's cube, its two textures bound, for the scenes below
+struct CubeScene
+{
+    unsigned int VBO, VAO, texture1, texture2;
+
+    void create()
+    {
+        glGenVertexArrays(1, &VAO);
+        glGenBuffers(1, &VBO);
+        glBindVertexArray(VAO);
+        glBindBuffer(GL_ARRAY_BUFFER, VBO);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(CUBE_VERTICES), CUBE_VERTICES, GL_STATIC_DRAW);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(3 * sizeof(float)));
+        glEnableVertexAttribArray(1);
+
+        stbi_set_flip_vertically_on_load(true);
+        texture1 = loadTexture("../../resources/textures/container.jpg", GL_RGB);
+        texture2 = loadTexture("../../resources/textures/awesomeface.png", GL_RGBA);
+    }
+
+    void begin(Shader& shader)
+    {
+        glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D, texture1);
+        glActiveTexture(GL_TEXTURE1);
+        glBindTexture(GL_TEXTURE_2D, texture2);
+        shader.use();
+        glBindVertexArray(VAO);
+    }
+
+    void destroy()
+    {
+        glDeleteTextures(1, &texture1);
+        glDeleteTextures(1, &texture2);
+        glDeleteVertexArrays(1, &VAO);
+        glDeleteBuffers(1, &VBO);
+    }
+};
+
+Shader cubeShader(bool blocks)
+{
+    Shader shader("../../resources/shaders/camera.vs", "../../resources/shaders/camera.fs",
+                  blocks ? std::vector<std::string>{ "TRANSFORM_BLOCKS 1" } : std::vector<std::string>{});
+    shader.use();
+    shader.setInt("texture1", 0);
+    shader.setInt("texture2", 1);
+    if (!shader.Linked || (blocks && !bindTransformBlocks(shader.ID)))
+        sceneErrors++;
+    return shader;
+}
+
+// the camera class demo, its camera turning a quarter degree a frame, the
+// matrices in uniform blocks as the demo sets them
+SceneResult cameraCubes(HeadlessContext& gl, int frames, std::vector<uint32_t>& pixels)
+{
+    glEnable(GL_DEPTH_TEST);
+    Shader shader = cubeShader(true);
+    CubeScene cubes;
+    cubes.create();
+    UniformBuffer<FrameTransforms> frameBlock;
+    frameBlock.create(1);
+    UniformBuffer<ObjectTransform> cubeBlocks;
+    cubeBlocks.create(10);
+    for (unsigned int i = 0; i < 10; i++)
+        cubeBlocks.set(i, ObjectTransform{ cubeModel(i) });
+    cubeBlocks.upload();
+
+    SceneResult result = runScene(gl, frames, [&](int frame) {
+        cubes.begin(shader);
+        Camera camera(glm::vec3(0.0f, 0.0f, 3.0f), glm::vec3(0.0f, 1.0f, 0.0f), YAW + frame * 0.25f);
+        camera.SetPerspective((float)gl.width / (float)gl.height);
+        frameBlock.set(0, FrameTransforms{ camera.GetProjectionMatrix(), camera.GetViewMatrix() });
+        frameBlock.upload();
+        frameBlock.bind(FRAME_TRANSFORMS_BINDING, 0);
+        for (unsigned int i = 0; i < 10; i++)
+        {
+            cubeBlocks.bind(OBJECT_TRANSFORM_BINDING, i);
+            glDrawArrays(GL_TRIANGLES, 0, 36);
+        }
+    }, pixels);
+
+    frameBlock.destroy();
+    cubeBlocks.destroy();
+    cubes.destroy();
+    glDisable(GL_DEPTH_TEST);
+    return result;
+}
+
+// a 64 x 64 wall of small cubes, each turning with the frame: the matrices as
+// one glUniformMatrix4fv a cube, or as one memcpy of all of them into a
+// uniform buffer and a range bind a cube
+const int CROWD_SIDE = 64;
+
+glm::mat4 crowdModel(int i, int frame)
+{
+    glm::vec3 position((i % CROWD_SIDE - CROWD_SIDE / 2) * 0.25f, (i / CROWD_SIDE - CROWD_SIDE / 2) * 0.25f, -12.0f);
+    glm::mat4 model = glm::translate(glm::mat4(1.0f), position);
+    model = glm::rotate(model, glm::radians(3.0f * (frame + i)), glm::vec3(1.0f, 0.3f, 0.5f));
+    return glm::scale(model, glm::vec3(0.15f));
+}
+
+SceneResult cubeCrowd(HeadlessContext& gl, int frames, std::vector<uint32_t>& pixels, bool blocks)
+{
+    const int count = CROWD_SIDE * CROWD_SIDE;
+    glEnable(GL_DEPTH_TEST);
+    Shader shader = cubeShader(blocks);
+    CubeScene cubes;
+    cubes.create();
+    UniformBuffer<FrameTransforms> frameBlock;
+    UniformBuffer<ObjectTransform> objectBlocks;
+    if (blocks)
+    {
+        frameBlock.create(1);
+        objectBlocks.create(count);
+    }
+
+    SceneResult result = runScene(gl, frames, [&](int frame) {
+        cubes.begin(shader);
+        Camera camera(glm::vec3(0.0f, 0.0f, 3.0f));
+        camera.SetPerspective((float)gl.width / (float)gl.height);
+        if (blocks)
+        {
+            frameBlock.set(0, FrameTransforms{ camera.GetProjectionMatrix(), camera.GetViewMatrix() });
+            frameBlock.upload();
+            frameBlock.bind(FRAME_TRANSFORMS_BINDING, 0);
+            for (int i = 0; i < count; i++)
+                objectBlocks.set(i, ObjectTransform{ crowdModel(i, frame) });
+            objectBlocks.upload();
+            for (int i = 0; i < count; i++)
+            {
+                objectBlocks.bind(OBJECT_TRANSFORM_BINDING, i);
+                glDrawArrays(GL_TRIANGLES, 0, 36);
+            }
+        }
+        else
+        {
+            shader.setMat4("projection", camera.GetProjectionMatrix());
+            shader.setMat4("view", camera.GetViewMatrix());
+            for (int i = 0; i < count; i++)
+            {
+                shader.setMat4("model", crowdModel(i, frame));
+                glDrawArrays(GL_TRIANGLES, 0, 36);
+            }
+        }
+    }, pixels);
+
+    if (blocks)
+    {
+        frameBlock.destroy();
+        objectBlocks.destroy();
+    }
+    cubes.destroy();
+    glDisable(GL_DEPTH_TEST);
+    return result;
+}
+
+SceneResult cubeCrowdUniforms(HeadlessContext& gl, int frames, std::vector<uint32_t>& pixels)
+{
+    return cubeCrowd(gl, frames, pixels, false);
+}
+
+SceneResult cubeCrowdBlocks(HeadlessContext& gl, int frames, std::vector<uint32_t>& pixels)
+{
+    return cubeCrowd(gl, frames, pixels, true);
+}
+
+struct Scene
+{
+    const char* name;
+    int width, height;
+    SceneResult (*run)(HeadlessContext&, int, std::vector<uint32_t>&);
+};
+
+const Scene SCENES[] = {
+    { "grid_player", 512, 512, gridPlayer },
+    { "quad_field", 512, 512, quadField },
+    { "tiles_redrawn", 512, 512, tilesRedrawn },
+    { "tiles_cached", 512, 512, tilesCached },
+    { "tile_map_near", 512, 512, tileMapNear },
+    { "tile_map_far", 512, 512, tileMapFar },
+    { "hud_overlay", 512, 512, hudOverlay },
+    { "mesh_float", 512, 512, meshFloat },
+    { "mesh_quantized", 512, 512, meshQuantized },
+    { "camera_cubes", 1980, 1020, cameraCubes },
+    { "cube_crowd_uniforms", 512, 512, cubeCrowdUniforms },
+    { "cube_crowd_blocks", 512, 512, cubeCrowdBlocks },
+};
+
+int main(int argc, char** argv)
+{
+    const char* only = argc > 1 ? argv[1] : "all";
+    int frames = argc > 2 ? std::atoi(argv[2]) : 300;
+    const char* capture = argc > 3 ? argv[3] : NULL;
+
+    HeadlessContext gl;
+    if (!gl.create(512, 512))
+        return 1;
+
+    bool found = false, failed = false;
+    std::vector<uint32_t> pixels;
+    for (const Scene& scene : SCENES)
+    {
+        if (std::strcmp(only, "all") != 0 && std::strcmp(only, scene.name) != 0)
+            continue;
+        found = true;
+        if (!gl.resize(scene.width, scene.height))
+            return 1;
+        sceneErrors = 0;
+        size_t shaderErrors = shaderCache().errorCount();
+        SceneResult result = scene.run(gl, frames, pixels);
+        int errors = sceneErrors + (int)(shaderCache().errorCount() - shaderErrors);
+        if (errors)
+        {
+            // the frames drew nothing worth timing or comparing
+            std::printf("{\"scene\":\"%s\",\"errors\":%d}\n", scene.name, errors);
+            failed = true;
+            continue;
+        }
+        const FrameStats& s = result.stats;
+        std::printf("{\"scene\":\"%s\",\"width\":%d,\"height\":%d,\"frames\":%zu,\"renderer\":\"%s\","
+                    "\"min_ms\":%.3f,\"mean_ms\":%.3f,\"median_ms\":%.3f,\"p95_ms\":%.3f,\"p99_ms\":%.3f,\"max_ms\":%.3f,"
+                    "\"checksum\":\"%016llx\"}\n",
+                    scene.name, scene.width, scene.height, s.frames, gl.renderer(),
+                    s.minMs, s.meanMs, s.medianMs, s.p95Ms, s.p99Ms, s.maxMs, (unsigned long long)result.checksum);
+        if (capture)
+        {
+            std::string path = std::string(capture) + "/" + scene.name + ".ppm";
+            writeFramePPM(path.c_str(), pixels, scene.width, scene.height);
+        }
+    }
+    if (!found)
+    {
+        std::printf("unknown scene %s\n", only);
+        return 1;
+    }
+    // every scene gave back what it created
+    shaderCache().clear();
+    return gpuResources().shutdown() == 0 && !failed ? 0 : 1;
+}
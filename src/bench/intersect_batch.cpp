@@ -0,0 +1,278 @@
+// Batched ray and line tests (glm/gtx/intersect_batch.hpp) against a loop over
+// glm::intersectRayTriangle / glm::intersectLineTriangle /
+// glm::intersectRaySphere. Every instruction set the machine has must find
+// the same hits as the loop, with the same distances and positions bit for
+// bit; exits with 1 otherwise.
+//
+//   g++ -O2 intersect_batch.cpp -I../../include -o intersect_batch
+
+// the reference loop must not fuse multiplies and adds either, whatever
+// -march enables
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC optimize("fp-contract=off")
+#endif
+
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/glm.hpp>
+#include <glm/gtc/random.hpp>
+#include <glm/gtx/intersect.hpp>
+#include <glm/gtx/intersect_batch.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+// not a multiple of 16, so every kernel leaves a tail to the scalar tests
+const size_t COUNT = (1 << 20) + 13;
+const int RAYS = 64;
+
+// triangles and spheres in a cube of side 2 around the origin, in arrays
+struct Scene
+{
+    std::vector<float> x[3], y[3], z[3];
+    std::vector<float> cx, cy, cz, radiusSquared;
+
+    Scene()
+    {
+        glm::seedRandom(3);
+        for (int k = 0; k < 3; k++)
+        {
+            x[k].resize(COUNT);
+            y[k].resize(COUNT);
+            z[k].resize(COUNT);
+        }
+        cx.resize(COUNT);
+        cy.resize(COUNT);
+        cz.resize(COUNT);
+        radiusSquared.resize(COUNT);
+        for (size_t i = 0; i < COUNT; i++)
+        {
+            glm::vec3 center = glm::linearRand(glm::vec3(-1.0f), glm::vec3(1.0f));
+            for (int k = 0; k < 3; k++)
+            {
+                // every 64th triangle is degenerate, a line
+                glm::vec3 v = i % 64 == 0 && k == 2 ? glm::vec3(x[1][i], y[1][i], z[1][i]) : center + glm::ballRand(0.3f);
+                x[k][i] = v.x;
+                y[k][i] = v.y;
+                z[k][i] = v.z;
+            }
+            cx[i] = center.x;
+            cy[i] = center.y;
+            cz[i] = center.z;
+            radiusSquared[i] = glm::linearRand(0.0f, 0.02f);
+        }
+    }
+
+    glm::triangleBatch triangles() const
+    {
+        glm::triangleBatch batch;
+        for (int k = 0; k < 3; k++)
+        {
+            batch.x[k] = x[k].data();
+            batch.y[k] = y[k].data();
+            batch.z[k] = z[k].data();
+        }
+        batch.count = COUNT;
+        return batch;
+    }
+
+    glm::sphereBatch spheres() const
+    {
+        return glm::sphereBatch{ cx.data(), cy.data(), cz.data(), radiusSquared.data(), COUNT };
+    }
+
+    glm::vec3 vertex(int k, size_t i) const { return glm::vec3(x[k][i], y[k][i], z[k][i]); }
+};
+
+struct Ray
+{
+    glm::vec3 origin, direction;
+};
+
+// from outside the cube towards a point inside it
+std::vector<Ray> makeRays()
+{
+    std::vector<Ray> rays;
+    for (int r = 0; r < RAYS; r++)
+    {
+        glm::vec3 origin = glm::sphericalRand(4.0f);
+        glm::vec3 target = glm::linearRand(glm::vec3(-0.5f), glm::vec3(0.5f));
+        rays.push_back(Ray{ origin, glm::normalize(target - origin) });
+    }
+    return rays;
+}
+
+bool bit(const std::vector<glm::uint32>& mask, size_t i)
+{
+    return (mask[i / 32] >> (i % 32) & 1u) != 0;
+}
+
+// the loop over gtx_intersect, the answer every kernel must give
+struct Expected
+{
+    std::vector<glm::uint32> rayTriangle, lineTriangle, raySphere;
+    std::vector<glm::vec2> bary;
+    std::vector<float> triangleDistance, sphereDistance;
+    std::vector<glm::vec3> position;
+};
+
+Expected scalar(const Scene& scene, const Ray& ray)
+{
+    Expected e;
+    size_t words = (COUNT + 31) / 32;
+    e.rayTriangle.assign(words, 0);
+    e.lineTriangle.assign(words, 0);
+    e.raySphere.assign(words, 0);
+    e.bary.resize(COUNT);
+    e.triangleDistance.resize(COUNT);
+    e.sphereDistance.resize(COUNT);
+    e.position.resize(COUNT);
+    for (size_t i = 0; i < COUNT; i++)
+    {
+        glm::vec3 v0 = scene.vertex(0, i), v1 = scene.vertex(1, i), v2 = scene.vertex(2, i);
+        if (glm::intersectRayTriangle(ray.origin, ray.direction, v0, v1, v2, e.bary[i], e.triangleDistance[i]))
+            e.rayTriangle[i / 32] |= 1u << (i % 32);
+        if (glm::intersectLineTriangle(ray.origin, ray.direction, v0, v1, v2, e.position[i]))
+            e.lineTriangle[i / 32] |= 1u << (i % 32);
+        glm::vec3 center(scene.cx[i], scene.cy[i], scene.cz[i]);
+        if (glm::intersectRaySphere(ray.origin, ray.direction, center, scene.radiusSquared[i], e.sphereDistance[i]))
+            e.raySphere[i / 32] |= 1u << (i % 32);
+    }
+    return e;
+}
+
+struct Kernels
+{
+    const char* isa;
+    glm::detail::intersect_ray_triangle_func rayTriangle;
+    glm::detail::intersect_line_triangle_func lineTriangle;
+    glm::detail::intersect_ray_sphere_func raySphere;
+};
+
+template<typename T>
+size_t differences(const std::vector<glm::uint32>& expectedMask, const std::vector<glm::uint32>& mask, const std::vector<T>& expected,
+                   const std::vector<T>& actual)
+{
+    size_t count = 0;
+    for (size_t i = 0; i < COUNT; i++)
+        if (bit(expectedMask, i) != bit(mask, i) || (bit(mask, i) && std::memcmp(&expected[i], &actual[i], sizeof(T)) != 0))
+            count++;
+    return count;
+}
+
+bool sameAsScalar(const Scene& scene, const std::vector<Ray>& rays, const Kernels& k)
+{
+    glm::triangleBatch triangles = scene.triangles();
+    glm::sphereBatch spheres = scene.spheres();
+    std::vector<glm::uint32> mask((COUNT + 31) / 32);
+    std::vector<glm::vec2> bary(COUNT);
+    std::vector<float> distance(COUNT);
+    std::vector<glm::vec3> position(COUNT);
+    size_t wrong = 0, hits = 0;
+    // a few rays are enough, the loop over every primitive is slow
+    for (int r = 0; r < 4; r++)
+    {
+        const Ray& ray = rays[r];
+        Expected e = scalar(scene, ray);
+        hits += glm::detail::intersect_ray_triangle_batch(k.rayTriangle, ray.origin, ray.direction, triangles, mask.data(), bary.data(),
+                                                          distance.data());
+        wrong += differences(e.rayTriangle, mask, e.bary, bary) + differences(e.rayTriangle, mask, e.triangleDistance, distance);
+        hits += glm::detail::intersect_line_triangle_batch(k.lineTriangle, ray.origin, ray.direction, triangles, mask.data(),
+                                                           position.data());
+        wrong += differences(e.lineTriangle, mask, e.position, position);
+        hits += glm::detail::intersect_ray_sphere_batch(k.raySphere, ray.origin, ray.direction, spheres, mask.data(), distance.data());
+        wrong += differences(e.raySphere, mask, e.sphereDistance, distance);
+    }
+    std::printf("%-8s %s the scalar tests (%zu hits, %zu differences)\n", k.isa, wrong ? "DIFFERS from" : "matches", hits, wrong);
+    return wrong == 0;
+}
+
+template<typename F>
+double run(const std::vector<Ray>& rays, F f)
+{
+    f(rays[0]); // warm up
+    auto start = std::chrono::steady_clock::now();
+    for (const Ray& ray : rays)
+        f(ray);
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    // million primitives tested per second
+    return (double)COUNT * rays.size() / elapsed.count() / 1e6;
+}
+
+void report(const char* name, double loop, double batch)
+{
+    std::printf("%-14s %8.1f %8.1f (x%5.2f)\n", name, loop, batch, batch / loop);
+}
+
+int main()
+{
+    std::printf("isa: %s, %zu triangles and spheres, %d rays\n", glm::intersectBatchIsa(), COUNT, RAYS);
+    Scene scene;
+    std::vector<Ray> rays = makeRays();
+
+    bool ok = sameAsScalar(scene, rays,
+                           Kernels{ "scalar", glm::detail::intersect_ray_triangle_scalar, glm::detail::intersect_line_triangle_scalar,
+                                    glm::detail::intersect_ray_sphere_scalar });
+#if GLM_SIMD_WIDE_KERNELS
+    int isa = glm_simd_isa();
+    if (isa & GLM_SIMD_ISA_SSE2)
+        ok &= sameAsScalar(scene, rays,
+                           Kernels{ "sse2", glm::detail::intersect_sse2::intersect_ray_triangle_groups,
+                                    glm::detail::intersect_sse2::intersect_line_triangle_groups,
+                                    glm::detail::intersect_sse2::intersect_ray_sphere_groups });
+    if (isa & GLM_SIMD_ISA_AVX2)
+        ok &= sameAsScalar(scene, rays,
+                           Kernels{ "avx2", glm::detail::intersect_avx2::intersect_ray_triangle_groups,
+                                    glm::detail::intersect_avx2::intersect_line_triangle_groups,
+                                    glm::detail::intersect_avx2::intersect_ray_sphere_groups });
+    if (isa & GLM_SIMD_ISA_AVX512F)
+        ok &= sameAsScalar(scene, rays,
+                           Kernels{ "avx512f", glm::detail::intersect_avx512f::intersect_ray_triangle_groups,
+                                    glm::detail::intersect_avx512f::intersect_line_triangle_groups,
+                                    glm::detail::intersect_avx512f::intersect_ray_sphere_groups });
+#endif
+
+    glm::triangleBatch triangles = scene.triangles();
+    glm::sphereBatch spheres = scene.spheres();
+    std::vector<glm::uint32> mask((COUNT + 31) / 32);
+    std::vector<glm::vec2> bary(COUNT);
+    std::vector<float> distance(COUNT);
+    std::vector<glm::vec3> position(COUNT);
+
+    std::printf("%-14s %8s %8s\n", "Mtest/s", "loop", "batch");
+    {
+        double loop = run(rays, [&](const Ray& ray) {
+            for (size_t i = 0; i < COUNT; i++)
+                glm::intersectRayTriangle(ray.origin, ray.direction, scene.vertex(0, i), scene.vertex(1, i), scene.vertex(2, i), bary[i],
+                                          distance[i]);
+        });
+        double batch = run(rays, [&](const Ray& ray) {
+            glm::intersectRayTriangleBatch(ray.origin, ray.direction, triangles, mask.data(), bary.data(), distance.data());
+        });
+        report("ray-triangle", loop, batch);
+    }
+    {
+        double loop = run(rays, [&](const Ray& ray) {
+            for (size_t i = 0; i < COUNT; i++)
+                glm::intersectLineTriangle(ray.origin, ray.direction, scene.vertex(0, i), scene.vertex(1, i), scene.vertex(2, i),
+                                           position[i]);
+        });
+        double batch = run(rays, [&](const Ray& ray) {
+            glm::intersectLineTriangleBatch(ray.origin, ray.direction, triangles, mask.data(), position.data());
+        });
+        report("line-triangle", loop, batch);
+    }
+    {
+        double loop = run(rays, [&](const Ray& ray) {
+            for (size_t i = 0; i < COUNT; i++)
+                glm::intersectRaySphere(ray.origin, ray.direction, glm::vec3(scene.cx[i], scene.cy[i], scene.cz[i]),
+                                        scene.radiusSquared[i], distance[i]);
+        });
+        double batch = run(rays, [&](const Ray& ray) {
+            glm::intersectRaySphereBatch(ray.origin, ray.direction, spheres, mask.data(), distance.data());
+        });
+        report("ray-sphere", loop, batch);
+    }
+    return ok ? 0 : 1;
+}
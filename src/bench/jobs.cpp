@@ -0,0 +1,95 @@
+// Job system (learnopengl/job_system.h) without a window: the cost of
+// scheduling one empty job, and how a parallelFor over a compute loop scales
+// from the owner thread alone to one worker per hardware thread, next to
+// starting a std::thread per chunk every frame.
+//
+//   g++ -O2 jobs.cpp -I../../include -lpthread -o jobs
+//   ./jobs [jobs per batch]
+
+#include <learnopengl/job_system.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+const int REPEAT = 20;
+const size_t ELEMENTS = 1 << 20;
+
+template<typename F>
+double run(F f)
+{
+    f(); // warm up
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < REPEAT; i++)
+        f();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    // milliseconds per batch
+    return elapsed.count() * 1000.0 / REPEAT;
+}
+
+// stand-in for building transforms: a few transcendental calls per element
+static void work(float* out, size_t begin, size_t end)
+{
+    for (size_t i = begin; i < end; i++)
+    {
+        float t = (float)i * 0.001f;
+        out[i] = std::sin(t) * std::cos(t * 0.5f) + std::sqrt(t);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    size_t batch = argc > 1 ? std::strtoul(argv[1], NULL, 10) : 10000;
+    unsigned hardware = std::thread::hardware_concurrency();
+    if (hardware == 0)
+        hardware = 1;
+    std::vector<float> out(ELEMENTS);
+
+    double serial = run([&]() { work(out.data(), 0, ELEMENTS); });
+    std::printf("%zu elements, serial loop %7.2f ms\n\n", ELEMENTS, serial);
+    std::printf("threads  ns/empty job  parallelFor ms  speedup  thread per chunk ms\n");
+
+    for (unsigned threads = 1; threads <= hardware; threads++)
+    {
+        JobSystem jobs(threads - 1);
+
+        // submit a batch of empty jobs from the owner and wait for them all
+        double empty = run([&]()
+        {
+            JobCounter done;
+            for (size_t i = 0; i < batch; i++)
+                jobs.run(done, []() {});
+            jobs.wait(done);
+        });
+
+        double parallel = run([&]()
+        {
+            jobs.parallelFor(0, ELEMENTS, 4096, [&](size_t begin, size_t end) { work(out.data(), begin, end); });
+        });
+
+        double spawned = run([&]()
+        {
+            std::vector<std::thread> pool;
+            size_t chunk = (ELEMENTS + threads - 1) / threads;
+            for (unsigned t = 1; t < threads; t++)
+            {
+                size_t begin = t * chunk, end = begin + chunk < ELEMENTS ? begin + chunk : ELEMENTS;
+                pool.emplace_back([&out, begin, end]() { work(out.data(), begin, end); });
+            }
+            work(out.data(), 0, chunk < ELEMENTS ? chunk : ELEMENTS);
+            for (std::thread& t : pool)
+                t.join();
+        });
+
+        std::printf("%7u  %12.1f  %14.2f  %6.2fx  %19.2f\n", threads, empty * 1e6 / batch, parallel, serial / parallel, spawned);
+    }
+
+    double check = 0.0;
+    for (size_t i = 0; i < ELEMENTS; i += 997)
+        check += out[i];
+    std::printf("(check %.1f)\n", check);
+    return 0;
+}
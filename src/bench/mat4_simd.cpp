@@ -0,0 +1,77 @@
+// Throughput of the batched mat4 kernels for every ISA the machine supports,
+// against the existing 128-bit SSE path (glm_mat4_mul / glm_mat4_inverse).
+//
+//   g++ -O2 mat4_simd.cpp -I../../include -o mat4_simd
+//
+// No -mavx flags are needed: the wide kernels are selected at run time.
+
+#define GLM_FORCE_INTRINSICS
+#include <glm/glm.hpp>
+#include <glm/simd/matrix_wide.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+const std::size_t COUNT = 4096;
+const int REPEAT = 2000;
+
+template<typename F>
+double run(F f)
+{
+    f(); // warm up
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < REPEAT; i++)
+        f();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    // million items per second
+    return (double)COUNT * REPEAT / elapsed.count() / 1e6;
+}
+
+int main()
+{
+    std::vector<glm::mat4> a(COUNT), b(COUNT), out(COUNT);
+    std::vector<glm::vec4> v(COUNT), vout(COUNT);
+    for (std::size_t i = 0; i < COUNT; i++)
+    {
+        for (int c = 0; c < 4; c++)
+            for (int r = 0; r < 4; r++)
+            {
+                a[i][c][r] = (float)rand() / RAND_MAX - 0.5f + (c == r ? 2.0f : 0.0f);
+                b[i][c][r] = (float)rand() / RAND_MAX - 0.5f + (c == r ? 2.0f : 0.0f);
+            }
+        v[i] = glm::vec4((float)i, 1.0f, -(float)i, 1.0f);
+    }
+
+    int detected = glm_simd_isa();
+    std::printf("detected: %s\n", glm_simd_isa_name(detected));
+    std::printf("%-8s %14s %14s %14s\n", "isa", "mul Mmat/s", "inverse Mmat/s", "xform Mvec/s");
+
+    const int isas[] = { GLM_SIMD_ISA_SSE2, GLM_SIMD_ISA_AVX, GLM_SIMD_ISA_AVX2, GLM_SIMD_ISA_AVX512F };
+    double base[3] = { 0.0, 0.0, 0.0 };
+    for (int isa : isas)
+    {
+        if ((detected & isa) == 0)
+            continue;
+        glm_mat4_batch_kernels k = glm_mat4_batch_kernels_for(isa);
+        // for SSE2 measure the existing per-matrix kernels, not the structure-of-arrays inverse
+        if (isa == GLM_SIMD_ISA_SSE2)
+            k.inverse = glm_mat4_inverse_batch_base;
+
+        double mul = run([&] { k.mul(&a[0][0][0], 16, &b[0][0][0], &out[0][0][0], COUNT); });
+        double inv = run([&] { k.inverse(&a[0][0][0], &out[0][0][0], COUNT); });
+        double xf  = run([&] { k.transform(&a[0][0][0], &v[0][0], &vout[0][0], COUNT); });
+        if (isa == GLM_SIMD_ISA_SSE2)
+        {
+            base[0] = mul;
+            base[1] = inv;
+            base[2] = xf;
+        }
+        std::printf("%-8s %8.1f (x%.2f) %8.1f (x%.2f) %8.1f (x%.2f)\n", glm_simd_isa_name(isa),
+            mul, base[0] > 0.0 ? mul / base[0] : 1.0,
+            inv, base[1] > 0.0 ? inv / base[1] : 1.0,
+            xf,  base[2] > 0.0 ? xf / base[2] : 1.0);
+    }
+    return 0;
+}
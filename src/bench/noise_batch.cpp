@@ -0,0 +1,130 @@
+// Batched grid noise (glm/gtx/noise_batch.hpp) against a per-point loop over
+// glm::perlin / glm::simplex, single and multi threaded, plus the largest
+// difference to the scalar result.
+//
+//   g++ -O2 noise_batch.cpp -I../../include -lpthread -o noise_batch
+
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/glm.hpp>
+#include <glm/gtc/noise.hpp>
+#include <glm/gtx/noise_batch.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+const int SIZE = 256;   // 256x256 for 2D, 64x64x64 for 3D
+const int DEPTH = 64;
+const int REPEAT = 10;
+const glm::noiseOctaves OCTAVES = { 4, 2.0f, 0.5f };
+
+template<typename F>
+double run(F f, double points)
+{
+    f(); // warm up
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < REPEAT; i++)
+        f();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    // million points per second
+    return points * REPEAT / elapsed.count() / 1e6;
+}
+
+template<typename Noise>
+void reference2(glm::vec2 origin, glm::vec2 step, float* out, Noise noise)
+{
+    for (int y = 0; y < SIZE; y++)
+        for (int x = 0; x < SIZE; x++)
+        {
+            glm::vec2 p(origin.x + (float)x * step.x, origin.y + (float)y * step.y);
+            float sum = 0.0f, frequency = 1.0f, amplitude = 1.0f;
+            for (int o = 0; o < OCTAVES.count; o++)
+            {
+                sum += amplitude * noise(p * frequency);
+                frequency *= OCTAVES.lacunarity;
+                amplitude *= OCTAVES.gain;
+            }
+            out[y * SIZE + x] = sum;
+        }
+}
+
+template<typename Noise>
+void reference3(glm::vec3 origin, glm::vec3 step, float* out, Noise noise)
+{
+    const int side = DEPTH;
+    for (int z = 0; z < side; z++)
+        for (int y = 0; y < side; y++)
+            for (int x = 0; x < side; x++)
+            {
+                glm::vec3 p(origin.x + (float)x * step.x, origin.y + (float)y * step.y, origin.z + (float)z * step.z);
+                float sum = 0.0f, frequency = 1.0f, amplitude = 1.0f;
+                for (int o = 0; o < OCTAVES.count; o++)
+                {
+                    sum += amplitude * noise(p * frequency);
+                    frequency *= OCTAVES.lacunarity;
+                    amplitude *= OCTAVES.gain;
+                }
+                out[(z * side + y) * side + x] = sum;
+            }
+}
+
+float maxError(const std::vector<float>& a, const std::vector<float>& b)
+{
+    float error = 0.0f;
+    for (size_t i = 0; i < a.size(); i++)
+        error = std::fmax(error, std::fabs(a[i] - b[i]));
+    return error;
+}
+
+void report(const char* name, double loop, double single, double multi, float error)
+{
+    std::printf("%-10s %8.2f %8.2f (x%5.2f) %8.2f (x%5.2f) %10.2e\n", name, loop, single, single / loop, multi, multi / loop, error);
+}
+
+int main()
+{
+    unsigned threads = std::thread::hardware_concurrency();
+    std::printf("isa: %s, threads: %u, octaves: %d\n", glm::noiseGridIsa(), threads, OCTAVES.count);
+    std::printf("%-10s %8s %18s %18s %10s\n", "Mpoint/s", "loop", "batch 1 thread", "batch all threads", "max error");
+
+    const double points2 = (double)SIZE * SIZE;
+    const double points3 = (double)DEPTH * DEPTH * DEPTH;
+    std::vector<float> expected(SIZE * SIZE), actual(SIZE * SIZE);
+    const glm::vec2 origin2(-37.3f, 12.1f), step2(0.071f, 0.053f);
+    const glm::vec3 origin3(5.2f, -8.9f, 101.7f), step3(0.093f, 0.067f, 0.11f);
+
+    {
+        auto noise = [](glm::vec2 p) { return glm::perlin(p); };
+        double loop = run([&] { reference2(origin2, step2, expected.data(), noise); }, points2);
+        double single = run([&] { glm::perlinGrid(origin2, step2, SIZE, SIZE, actual.data(), SIZE, OCTAVES, 1); }, points2);
+        double multi = run([&] { glm::perlinGrid(origin2, step2, SIZE, SIZE, actual.data(), SIZE, OCTAVES, threads); }, points2);
+        report("perlin2", loop, single, multi, maxError(expected, actual));
+    }
+    {
+        auto noise = [](glm::vec2 p) { return glm::simplex(p); };
+        double loop = run([&] { reference2(origin2, step2, expected.data(), noise); }, points2);
+        double single = run([&] { glm::simplexGrid(origin2, step2, SIZE, SIZE, actual.data(), SIZE, OCTAVES, 1); }, points2);
+        double multi = run([&] { glm::simplexGrid(origin2, step2, SIZE, SIZE, actual.data(), SIZE, OCTAVES, threads); }, points2);
+        report("simplex2", loop, single, multi, maxError(expected, actual));
+    }
+
+    expected.resize(DEPTH * DEPTH * DEPTH);
+    actual.resize(DEPTH * DEPTH * DEPTH);
+    {
+        auto noise = [](glm::vec3 p) { return glm::perlin(p); };
+        double loop = run([&] { reference3(origin3, step3, expected.data(), noise); }, points3);
+        double single = run([&] { glm::perlinGrid(origin3, step3, DEPTH, DEPTH, DEPTH, actual.data(), DEPTH, DEPTH * DEPTH, OCTAVES, 1); }, points3);
+        double multi = run([&] { glm::perlinGrid(origin3, step3, DEPTH, DEPTH, DEPTH, actual.data(), DEPTH, DEPTH * DEPTH, OCTAVES, threads); }, points3);
+        report("perlin3", loop, single, multi, maxError(expected, actual));
+    }
+    {
+        auto noise = [](glm::vec3 p) { return glm::simplex(p); };
+        double loop = run([&] { reference3(origin3, step3, expected.data(), noise); }, points3);
+        double single = run([&] { glm::simplexGrid(origin3, step3, DEPTH, DEPTH, DEPTH, actual.data(), DEPTH, DEPTH * DEPTH, OCTAVES, 1); }, points3);
+        double multi = run([&] { glm::simplexGrid(origin3, step3, DEPTH, DEPTH, DEPTH, actual.data(), DEPTH, DEPTH * DEPTH, OCTAVES, threads); }, points3);
+        report("simplex3", loop, single, multi, maxError(expected, actual));
+    }
+    return 0;
+}
@@ -0,0 +1,273 @@
+// PNG decoding into a caller's buffer (stbi_load_from_memory_into): PNGs of
+// every colour type, with and without a tRNS chunk, each row under another
+// filter, are built in memory and decoded for every desired channel count
+// into a buffer sized from stbi_info_from_memory, then compared with
+// stbi_load_from_memory. Exits with 1 when a decode fails, differs, writes
+// past the buffer or accepts one a byte short. Then times awesomeface.png
+// both ways.
+//
+//   g++ -O2 png_decode.cpp -I../../include -o png_decode
+//   ./png_decode && echo ok
+
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+
+#include <learnopengl/mapped_file.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+const int WIDTH = 37;
+const int HEIGHT = 23;
+const int REPEAT = 200;
+const unsigned char GUARD = 0xCD;
+
+double secondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+uint32_t crc32(const unsigned char* data, size_t size, uint32_t crc = 0)
+{
+    crc = ~crc;
+    for (size_t i = 0; i < size; i++)
+    {
+        crc ^= data[i];
+        for (int k = 0; k < 8; k++)
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+    }
+    return ~crc;
+}
+
+void put32(std::vector<unsigned char>& out, uint32_t v)
+{
+    unsigned char b[4] = { (unsigned char)(v >> 24), (unsigned char)(v >> 16), (unsigned char)(v >> 8), (unsigned char)v };
+    out.insert(out.end(), b, b + 4);
+}
+
+void chunk(std::vector<unsigned char>& png, const char* type, const std::vector<unsigned char>& data)
+{
+    put32(png, (uint32_t)data.size());
+    size_t start = png.size();
+    png.insert(png.end(), type, type + 4);
+    png.insert(png.end(), data.begin(), data.end());
+    put32(png, crc32(&png[start], png.size() - start));
+}
+
+// zlib stream of stored blocks
+std::vector<unsigned char> zlibStored(const std::vector<unsigned char>& raw)
+{
+    std::vector<unsigned char> z = { 0x78, 0x01 };
+    size_t pos = 0;
+    do
+    {
+        size_t n = raw.size() - pos < 65535 ? raw.size() - pos : 65535;
+        z.push_back(pos + n == raw.size() ? 1 : 0);
+        z.push_back((unsigned char)n);
+        z.push_back((unsigned char)(n >> 8));
+        z.push_back((unsigned char)~n);
+        z.push_back((unsigned char)(~n >> 8));
+        z.insert(z.end(), raw.begin() + pos, raw.begin() + pos + n);
+        pos += n;
+    } while (pos < raw.size());
+    uint32_t a = 1, b = 0;
+    for (unsigned char c : raw)
+    {
+        a = (a + c) % 65521;
+        b = (b + a) % 65521;
+    }
+    put32(z, (b << 16) | a);
+    return z;
+}
+
+int paeth(int a, int b, int c)
+{
+    int p = a + b - c, pa = std::abs(p - a), pb = std::abs(p - b), pc = std::abs(p - c);
+    return pa <= pb && pa <= pc ? a : pb <= pc ? b : c;
+}
+
+struct PngCase
+{
+    const char* name;
+    int color;      // PNG colour type: 0 grey, 2 RGB, 3 palette, 4 grey+alpha, 6 RGBA
+    int depth;      // 8 or 16
+    bool trns;
+};
+
+const PngCase CASES[] = {
+    { "grey 8", 0, 8, false },
+    { "grey 8 tRNS", 0, 8, true },
+    { "grey+alpha 8", 4, 8, false },
+    { "RGB 8", 2, 8, false },
+    { "RGB 8 tRNS", 2, 8, true },
+    { "RGBA 8", 6, 8, false },
+    { "palette 8", 3, 8, false },
+    { "palette 8 tRNS", 3, 8, true },
+    { "grey 16 tRNS", 0, 16, true },
+    { "RGB 16 tRNS", 2, 16, true },
+};
+
+// random samples where every third pixel repeats the first, which is the
+// colour the tRNS chunk names
+std::vector<unsigned char> makePng(const PngCase& c)
+{
+    int samples = c.color == 2 ? 3 : c.color == 4 ? 2 : c.color == 6 ? 4 : 1;
+    int pixelBytes = samples * c.depth / 8;
+    int rowBytes = WIDTH * pixelBytes;
+    std::vector<unsigned char> pixels((size_t)rowBytes * HEIGHT);
+    for (unsigned char& p : pixels)
+        p = (unsigned char)(std::rand() >> 4);
+    if (c.color == 3)
+        for (unsigned char& p : pixels)
+            p %= 16;
+    for (int i = 3; i < WIDTH * HEIGHT; i += 3)
+        std::memcpy(&pixels[(size_t)i * pixelBytes], &pixels[0], pixelBytes);
+
+    // row y under filter y % 5
+    std::vector<unsigned char> raw;
+    for (int y = 0; y < HEIGHT; y++)
+    {
+        int filter = y % 5;
+        raw.push_back((unsigned char)filter);
+        const unsigned char* row = &pixels[(size_t)y * rowBytes];
+        const unsigned char* up = y > 0 ? row - rowBytes : NULL;
+        for (int x = 0; x < rowBytes; x++)
+        {
+            int a = x >= pixelBytes ? row[x - pixelBytes] : 0;
+            int b = up ? up[x] : 0;
+            int d = up && x >= pixelBytes ? up[x - pixelBytes] : 0;
+            int predicted = filter == 1 ? a : filter == 2 ? b : filter == 3 ? (a + b) / 2 : filter == 4 ? paeth(a, b, d) : 0;
+            raw.push_back((unsigned char)(row[x] - predicted));
+        }
+    }
+
+    std::vector<unsigned char> png = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    std::vector<unsigned char> ihdr;
+    put32(ihdr, WIDTH);
+    put32(ihdr, HEIGHT);
+    ihdr.push_back((unsigned char)c.depth);
+    ihdr.push_back((unsigned char)c.color);
+    ihdr.push_back(0);
+    ihdr.push_back(0);
+    ihdr.push_back(0);
+    chunk(png, "IHDR", ihdr);
+    if (c.color == 3)
+    {
+        std::vector<unsigned char> palette;
+        for (int i = 0; i < 16 * 3; i++)
+            palette.push_back((unsigned char)(i * 37));
+        chunk(png, "PLTE", palette);
+    }
+    if (c.trns)
+    {
+        std::vector<unsigned char> trns;
+        if (c.color == 3)
+            for (int i = 0; i < 16; i++)
+                trns.push_back((unsigned char)(i * 16));
+        else
+            for (int s = 0; s < samples; s++)
+            {
+                // 16-bit samples as stored, 8-bit ones in the low byte
+                trns.push_back(c.depth == 16 ? pixels[s * 2] : 0);
+                trns.push_back(c.depth == 16 ? pixels[s * 2 + 1] : pixels[s]);
+            }
+        chunk(png, "tRNS", trns);
+    }
+    chunk(png, "IDAT", zlibStored(raw));
+    chunk(png, "IEND", std::vector<unsigned char>());
+    return png;
+}
+
+// one desired channel count of one PNG; prints what went wrong
+bool roundTrip(const char* name, const std::vector<unsigned char>& png, int desired)
+{
+    const stbi_uc* data = png.data();
+    int len = (int)png.size();
+    int w, h, n;
+    stbi_uc* expected = stbi_load_from_memory(data, len, &w, &h, &n, desired);
+    if (!expected)
+    {
+        std::printf("%s, %d channels: stbi_load_from_memory failed: %s\n", name, desired, stbi_failure_reason());
+        return false;
+    }
+    int iw, ih, in;
+    bool ok = stbi_info_from_memory(data, len, &iw, &ih, &in) != 0;
+    if (!ok || iw != w || ih != h || in != n)
+    {
+        std::printf("%s: stbi_info_from_memory gives %d channels, the decoder %d\n", name, ok ? in : 0, n);
+        stbi_image_free(expected);
+        return false;
+    }
+
+    int size = iw * ih * (desired ? desired : in);
+    std::vector<unsigned char> out(size + 16, GUARD);
+    int ow = 0, oh = 0, on = 0;
+    if (!stbi_load_from_memory_into(data, len, out.data(), size, &ow, &oh, &on, desired))
+    {
+        std::printf("%s, %d channels: failed into %d bytes: %s\n", name, desired, size, stbi_failure_reason());
+        ok = false;
+    }
+    else if (ow != w || oh != h || on != n || std::memcmp(out.data(), expected, size) != 0)
+    {
+        std::printf("%s, %d channels: differs from stbi_load_from_memory\n", name, desired);
+        ok = false;
+    }
+    for (int i = size; i < size + 16; i++)
+        if (out[i] != GUARD)
+        {
+            std::printf("%s, %d channels: wrote past %d bytes\n", name, desired, size);
+            ok = false;
+            break;
+        }
+    if (stbi_load_from_memory_into(data, len, out.data(), size - 1, &ow, &oh, &on, desired))
+    {
+        std::printf("%s, %d channels: accepted a buffer a byte short\n", name, desired);
+        ok = false;
+    }
+    stbi_image_free(expected);
+    return ok;
+}
+
+int main()
+{
+    std::srand(1);
+    bool ok = true;
+    for (const PngCase& c : CASES)
+    {
+        std::vector<unsigned char> png = makePng(c);
+        bool caseOk = true;
+        for (int desired = 0; desired <= 4; desired++)
+            caseOk &= roundTrip(c.name, png, desired);
+        int w, h, n;
+        stbi_info_from_memory(png.data(), (int)png.size(), &w, &h, &n);
+        std::printf("%-15s %d channels: %s\n", c.name, n, caseOk ? "ok" : "FAILED");
+        ok &= caseOk;
+    }
+
+    MappedFile file;
+    if (!file.open("../../resources/textures/awesomeface.png"))
+    {
+        std::printf("awesomeface.png not found, run from src/bench/\n");
+        return 1;
+    }
+    const stbi_uc* data = (const stbi_uc*)file.data();
+    int len = (int)file.size();
+    int w, h, n;
+    stbi_info_from_memory(data, len, &w, &h, &n);
+    std::vector<unsigned char> out((size_t)w * h * n);
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < REPEAT; i++)
+        stbi_image_free(stbi_load_from_memory(data, len, &w, &h, &n, 0));
+    double allocating = secondsSince(start);
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < REPEAT; i++)
+        ok &= stbi_load_from_memory_into(data, len, out.data(), (int)out.size(), &w, &h, &n, 0) != 0;
+    double into = secondsSince(start);
+    std::printf("awesomeface.png %dx%d: %.3f ms allocating, %.3f ms into a buffer\n", w, h, allocating / REPEAT * 1e3,
+                into / REPEAT * 1e3);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,193 @@
+// Batched random samples (glm/gtx/random_batch.hpp) against a loop over
+// glm::linearRand / glm::gaussRand / glm::sphericalRand, single and multi
+// threaded. Every instruction set the machine has must give the scalar
+// kernel's samples bit for bit, and the samples must have the moments of
+// their distribution; exits with 1 otherwise.
+//
+//   g++ -O2 random_batch.cpp -I../../include -lpthread -o random_batch
+
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/glm.hpp>
+#include <glm/gtc/random.hpp>
+#include <glm/gtx/random_batch.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+const size_t COUNT = 1 << 20;
+const int REPEAT = 10;
+
+template<typename F>
+double run(F f)
+{
+    f(); // warm up
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < REPEAT; i++)
+        f();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    // million samples per second
+    return (double)COUNT * REPEAT / elapsed.count() / 1e6;
+}
+
+// each thread fills its slice from its own streams
+template<typename T, typename F>
+void parallel(std::vector<T>& out, unsigned threads, F fill)
+{
+    std::vector<std::thread> workers;
+    size_t slice = out.size() / threads;
+    for (unsigned t = 0; t < threads; t++)
+    {
+        size_t begin = t * slice, count = t + 1 == threads ? out.size() - begin : slice;
+        workers.emplace_back([&out, fill, begin, count] { fill(glm::threadRandomStreams(), out.data() + begin, count); });
+    }
+    for (std::thread& worker : workers)
+        worker.join();
+}
+
+void report(const char* name, double loop, double single, double multi)
+{
+    std::printf("%-10s %8.1f %8.1f (x%5.2f) %8.1f (x%5.2f)\n", name, loop, single, single / loop, multi, multi / loop);
+}
+
+// the sample count, then the kernel of one instruction set against the scalar one
+typedef void (*LinearRounds)(glm::randomStreams&, float, float, float*, size_t);
+typedef void (*GaussRounds)(glm::randomStreams&, float, float, float*, size_t);
+typedef void (*SphereRounds)(glm::randomStreams&, float, glm::vec3*, size_t);
+
+bool sameAsScalar(const char* isa, LinearRounds linear, GaussRounds gauss, SphereRounds sphere)
+{
+    const size_t rounds = 4096;
+    std::vector<float> expected(rounds * 16), actual(rounds * 16);
+    std::vector<glm::vec3> expected3(rounds * 16), actual3(rounds * 16);
+    glm::randomStreams a, b;
+    bool same = true;
+
+    glm::seedRandomStreams(a, 7);
+    glm::seedRandomStreams(b, 7);
+    glm::detail::random_linear_scalar(a, -2.0f, 5.0f, expected.data(), rounds);
+    linear(b, -2.0f, 5.0f, actual.data(), rounds);
+    same &= std::memcmp(expected.data(), actual.data(), expected.size() * sizeof(float)) == 0;
+
+    glm::detail::random_gauss_scalar(a, 1.0f, 3.0f, expected.data(), rounds);
+    gauss(b, 1.0f, 3.0f, actual.data(), rounds);
+    same &= std::memcmp(expected.data(), actual.data(), expected.size() * sizeof(float)) == 0;
+
+    glm::detail::random_sphere_scalar(a, 2.0f, expected3.data(), rounds);
+    sphere(b, 2.0f, actual3.data(), rounds);
+    same &= std::memcmp(expected3.data(), actual3.data(), expected3.size() * sizeof(glm::vec3)) == 0;
+
+    same &= std::memcmp(&a, &b, sizeof(a)) == 0;
+    std::printf("%-8s %s the scalar samples\n", isa, same ? "matches" : "DIFFERS from");
+    return same;
+}
+
+// mean and variance of the samples, or of one coordinate of vec3s
+template<typename T>
+void moments(const std::vector<T>& samples, double& mean, double& variance, int component = 0)
+{
+    double sum = 0.0, squares = 0.0;
+    for (const T& s : samples)
+    {
+        double x = ((const float*)&s)[component];
+        sum += x;
+        squares += x * x;
+    }
+    mean = sum / samples.size();
+    variance = squares / samples.size() - mean * mean;
+}
+
+bool near(const char* what, double value, double expected, double tolerance)
+{
+    bool ok = std::fabs(value - expected) <= tolerance;
+    std::printf("  %-24s %10.5f  expected %8.5f%s\n", what, value, expected, ok ? "" : "  FAILED");
+    return ok;
+}
+
+int main()
+{
+    unsigned threads = std::thread::hardware_concurrency();
+    std::printf("isa: %s, threads: %u, %zu samples\n", glm::randomBatchIsa(), threads, COUNT);
+
+    bool ok = true;
+#if GLM_SIMD_WIDE_KERNELS
+    int isa = glm_simd_isa();
+    if (isa & GLM_SIMD_ISA_SSE2)
+        ok &= sameAsScalar("sse2", glm::detail::random_sse2::random_linear_rounds, glm::detail::random_sse2::random_gauss_rounds,
+                           glm::detail::random_sse2::random_sphere_rounds);
+    if (isa & GLM_SIMD_ISA_AVX2)
+        ok &= sameAsScalar("avx2", glm::detail::random_avx2::random_linear_rounds, glm::detail::random_avx2::random_gauss_rounds,
+                           glm::detail::random_avx2::random_sphere_rounds);
+    if (isa & GLM_SIMD_ISA_AVX512F)
+        ok &= sameAsScalar("avx512f", glm::detail::random_avx512f::random_linear_rounds, glm::detail::random_avx512f::random_gauss_rounds,
+                           glm::detail::random_avx512f::random_sphere_rounds);
+#endif
+
+    std::vector<float> values(COUNT);
+    std::vector<glm::vec3> points(COUNT);
+    glm::randomStreams streams;
+    glm::seedRandomStreams(streams, 1);
+    double mean, variance;
+
+    std::printf("moments\n");
+    glm::linearRandBatch(streams, -1.0f, 3.0f, values.data(), COUNT);
+    moments(values, mean, variance);
+    ok &= near("uniform [-1, 3) mean", mean, 1.0, 0.01);
+    ok &= near("uniform [-1, 3) variance", variance, 16.0 / 12.0, 0.01);
+
+    glm::gaussRandBatch(streams, 2.0f, 0.5f, values.data(), COUNT);
+    moments(values, mean, variance);
+    ok &= near("gauss (2, 0.5) mean", mean, 2.0, 0.005);
+    ok &= near("gauss (2, 0.5) variance", variance, 0.25, 0.005);
+    size_t beyond = 0;
+    for (float v : values)
+        beyond += std::fabs(v - 2.0f) > 1.5f;
+    ok &= near("gauss beyond 3 sigma", (double)beyond / COUNT, 0.0026998, 0.0003);
+
+    glm::sphericalRandBatch(streams, 2.0f, points.data(), COUNT);
+    double radiusError = 0.0;
+    for (const glm::vec3& p : points)
+        radiusError = std::fmax(radiusError, std::fabs(glm::length(p) - 2.0f));
+    ok &= near("sphere radius error", radiusError, 0.0, 1e-5);
+    for (int c = 0; c < 3; c++)
+    {
+        moments(points, mean, variance, c);
+        ok &= near(c == 0 ? "sphere x mean" : c == 1 ? "sphere y mean" : "sphere z mean", mean, 0.0, 0.01);
+        ok &= near(c == 0 ? "sphere x variance" : c == 1 ? "sphere y variance" : "sphere z variance", variance, 4.0 / 3.0, 0.01);
+    }
+
+    std::printf("%-10s %8s %18s %18s\n", "Msample/s", "loop", "batch 1 thread", "batch all threads");
+    {
+        double loop = run([&] { for (size_t i = 0; i < COUNT; i++) values[i] = (float)std::rand() / RAND_MAX; });
+        std::printf("%-10s %8.1f\n", "std::rand", loop);
+    }
+    {
+        double loop = run([&] { for (size_t i = 0; i < COUNT; i++) values[i] = glm::linearRand(-1.0f, 3.0f); });
+        double single = run([&] { glm::linearRandBatch(streams, -1.0f, 3.0f, values.data(), COUNT); });
+        double multi = run([&] {
+            parallel(values, threads, [](glm::randomStreams& s, float* out, size_t n) { glm::linearRandBatch(s, -1.0f, 3.0f, out, n); });
+        });
+        report("linear", loop, single, multi);
+    }
+    {
+        double loop = run([&] { for (size_t i = 0; i < COUNT; i++) values[i] = glm::gaussRand(2.0f, 0.5f); });
+        double single = run([&] { glm::gaussRandBatch(streams, 2.0f, 0.5f, values.data(), COUNT); });
+        double multi = run([&] {
+            parallel(values, threads, [](glm::randomStreams& s, float* out, size_t n) { glm::gaussRandBatch(s, 2.0f, 0.5f, out, n); });
+        });
+        report("gauss", loop, single, multi);
+    }
+    {
+        double loop = run([&] { for (size_t i = 0; i < COUNT; i++) points[i] = glm::sphericalRand(2.0f); });
+        double single = run([&] { glm::sphericalRandBatch(streams, 2.0f, points.data(), COUNT); });
+        double multi = run([&] {
+            parallel(points, threads, [](glm::randomStreams& s, glm::vec3* out, size_t n) { glm::sphericalRandBatch(s, 2.0f, out, n); });
+        });
+        report("sphere", loop, single, multi);
+    }
+    return ok ? 0 : 1;
+}
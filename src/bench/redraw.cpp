@@ -0,0 +1,136 @@
+// Redraw scheduler (learnopengl/redraw_scheduler.h) without a window: a
+// ten minute session of the grid game played on a simulated clock, with a
+// key press every few seconds that also arms a one second timer, and the
+// quads spinning for five seconds each minute. It runs through the
+// on-demand loop and through the continuous one the games used before. Reports frames drawn, wake-ups, the share of the
+// session spent drawing, and the intervals between the animation's frames.
+//
+//   g++ -O2 redraw.cpp -I../../include -o redraw
+//   ./redraw [draw ms]
+
+#include <learnopengl/redraw_scheduler.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+const double SESSION = 600.0;
+const double KEY_INTERVAL = 3.7;
+const double ANIMATION_PERIOD = 60.0;
+const double ANIMATION_LENGTH = 5.0;
+
+struct Event
+{
+    double time;
+    bool animation;
+};
+
+struct SessionResult
+{
+    unsigned long frames, wakeups;
+    double busy;
+    double minInterval, maxInterval;
+    bool finalFrames;
+};
+
+std::vector<Event> sessionEvents()
+{
+    std::vector<Event> events;
+    for (double t = 1.0; t < SESSION; t += KEY_INTERVAL)
+        events.push_back(Event{ t, false });
+    for (double t = 30.0; t < SESSION; t += ANIMATION_PERIOD)
+        events.push_back(Event{ t, true });
+    std::sort(events.begin(), events.end(), [](const Event& a, const Event& b) { return a.time < b.time; });
+    return events;
+}
+
+// The loop of player_test with glfwWaitEventsTimeout replaced by advancing
+// the clock to the timeout or the next event, whichever comes first, and a
+// frame taking drawMs.
+SessionResult playSession(bool continuous, double drawMs)
+{
+    std::vector<Event> events = sessionEvents();
+    RedrawScheduler redraw;
+    redraw.continuous = continuous;
+
+    SessionResult result = { 0, 0, 0.0, 1e9, 0.0, true };
+    std::vector<double> animationEnds;
+    size_t endsShown = 0;
+    double lastAnimationFrame = -1.0;
+    size_t next = 0;
+    double now = 0.0;
+    while (now < SESSION)
+    {
+        double wake = now + redraw.timeout(now);
+        if (next < events.size() && events[next].time < wake)
+        {
+            now = events[next].time;
+            if (events[next].animation)
+            {
+                redraw.animate(now + ANIMATION_LENGTH);
+                animationEnds.push_back(now + ANIMATION_LENGTH);
+            }
+            else
+            {
+                // the move shows now, and a hint it arms a second later
+                redraw.invalidate();
+                redraw.wakeAt(now + 1.0);
+            }
+            next++;
+        }
+        else
+        {
+            now = wake;
+        }
+        if (!redraw.shouldDraw(now))
+            continue;
+
+        if (!continuous && redraw.animating(now))
+        {
+            if (lastAnimationFrame >= 0.0)
+            {
+                result.minInterval = std::min(result.minInterval, now - lastAnimationFrame);
+                result.maxInterval = std::max(result.maxInterval, now - lastAnimationFrame);
+            }
+            lastAnimationFrame = now;
+        }
+        else
+        {
+            lastAnimationFrame = -1.0;
+        }
+        // the first frame after an animation ends shows where it stopped,
+        // and has to come at once
+        while (endsShown < animationEnds.size() && now >= animationEnds[endsShown])
+        {
+            if (now - animationEnds[endsShown] > redraw.frameInterval)
+                result.finalFrames = false;
+            endsShown++;
+        }
+        now += drawMs / 1000.0;
+        result.busy += drawMs / 1000.0;
+    }
+    result.frames = redraw.frameCount();
+    result.wakeups = redraw.wakeupCount();
+    result.busy /= SESSION;
+    return result;
+}
+
+int main(int argc, char** argv)
+{
+    double drawMs = argc > 1 ? std::atof(argv[1]) : 0.4;
+
+    std::printf("%.0f s session, %.2f ms a frame\n", SESSION, drawMs);
+    std::printf("mode          frames    wakeups   busy     animation frame interval\n");
+    SessionResult uncapped = playSession(true, drawMs);
+    std::printf("continuous  %8lu  %9lu  %5.1f%%\n", uncapped.frames, uncapped.wakeups, uncapped.busy * 100.0);
+    SessionResult onDemand = playSession(false, drawMs);
+    std::printf("on demand   %8lu  %9lu  %5.2f%%   %.2f..%.2f ms\n", onDemand.frames, onDemand.wakeups, onDemand.busy * 100.0,
+                onDemand.minInterval * 1000.0, onDemand.maxInterval * 1000.0);
+    if (!onDemand.finalFrames)
+    {
+        std::printf("an animation's final frame came late\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,128 @@
+// CPU rasterizer (learnopengl/soft_raster.h) without a GPU: renders the board
+// (LineGrid, a Player and a few thousand rotated Quads through their
+// SoftRasterizer draws) and the camera demo's ten textured cubes at its
+// 1980x1020, and reports frames per second from the owner thread alone up
+// to one worker per hardware thread.
+//
+//   g++ -O2 soft_raster.cpp ../glad.c -I../../include -lpthread -o soft_raster
+//   ./soft_raster [quads]
+
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+
+#include <learnopengl/camera.h>
+#include <learnopengl/image_loader.h>
+#include <learnopengl/soft_raster.h>
+
+#include "../LineGrid.hpp"
+#include "../Player.hpp"
+#include "../Quad.hpp"
+#include "cube_scene.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+const int REPEAT = 20;
+
+template<typename F>
+double run(F f)
+{
+    f(); // warm up
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < REPEAT; i++)
+        f();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    // milliseconds per frame
+    return elapsed.count() * 1000.0 / REPEAT;
+}
+
+SoftTexture loadTexture(const char* path)
+{
+    int width, height, channels;
+    unsigned char* data = loadImage(path, &width, &height, &channels);
+    if (!data)
+    {
+        std::printf("Failed to load %s\n", path);
+        return SoftTexture();
+    }
+    SoftTexture texture(data, width, height, channels);
+    stbi_image_free(data);
+    return texture;
+}
+
+int main(int argc, char** argv)
+{
+    int quads = argc > 1 ? std::atoi(argv[1]) : 4000;
+
+    stbi_set_flip_vertically_on_load(true);
+    SoftTexture container = loadTexture("../../resources/textures/container.jpg");
+    SoftTexture face = loadTexture("../../resources/textures/awesomeface.png");
+
+    myPrimitive::LineGrid grid(512.0f, 512.0f, 64.0f, 48.0f);
+    myPrimitive::Quad quad;
+    myGame::Player player;
+    player.p_pos = glm::vec3(64.0f + 24.0f, 64.0f + 24.0f, 0.0f);
+    player.size = 48;
+
+    std::vector<glm::vec3> quadPositions(quads);
+    std::srand(1);
+    for (glm::vec3& p : quadPositions)
+        p = glm::vec3(64.0f + std::rand() % 384, 64.0f + std::rand() % 384, 0.0f);
+
+    Camera camera(glm::vec3(0.0f, 0.0f, 3.0f));
+    camera.SetPerspective(1980.0f / 1020.0f);
+    glm::mat4 viewProjection = camera.GetProjectionMatrix() * camera.GetViewMatrix();
+
+    unsigned hardware = std::thread::hardware_concurrency();
+    if (hardware == 0)
+        hardware = 1;
+    std::printf("ms per frame (fps)\nthreads  board 512x512, %d quads     cubes 1980x1020\n", quads);
+    double boardOne = 0.0, cubesOne = 0.0;
+    for (unsigned threads = 1; threads <= hardware; threads++)
+    {
+        JobSystem jobs(threads - 1);
+
+        SoftTarget boardTarget(512, 512);
+        SoftRasterizer board(boardTarget, jobs);
+        double boardMs = run([&]()
+        {
+            frameMemory().beginFrame();
+            board.clear(glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
+            grid.draw(board);
+            for (int i = 0; i < quads; i++)
+                quad.draw(board, quadPositions[i], (float)(i % 90), 12);
+            player.draw(board);
+            board.flush();
+        });
+
+        SoftTarget cubeTarget(1980, 1020);
+        SoftRasterizer cubes(cubeTarget, jobs);
+        double cubeMs = run([&]()
+        {
+            cubes.clear(glm::vec4(0.2f, 0.3f, 0.3f, 1.0f));
+            SoftDrawState state;
+            state.texture = &container;
+            state.texture2 = &face;
+            state.mixAmount = 0.2f;
+            state.depthTest = true;
+            for (unsigned int i = 0; i < 10; i++)
+            {
+                state.transform = viewProjection * cubeModel(i);
+                cubes.draw(state, SOFT_TRIANGLES, CUBE_VERTICES, SoftVertexLayout{ 5, 3 }, 0, 36);
+            }
+            cubes.flush();
+        });
+
+        if (threads == 1)
+        {
+            boardOne = boardMs;
+            cubesOne = cubeMs;
+        }
+        std::printf("%7u  %7.2f (%6.1f) %5.2fx        %7.2f (%6.1f) %5.2fx\n", threads,
+                    boardMs, 1000.0 / boardMs, boardOne / boardMs, cubeMs, 1000.0 / cubeMs, cubesOne / cubeMs);
+    }
+    return 0;
+}
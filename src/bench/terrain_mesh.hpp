@@ -0,0 +1,58 @@
+#ifndef MY_TERRAIN_MESH_HPP
+#define MY_TERRAIN_MESH_HPP
+
+#include <glm/glm.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+// A rolling height field on an n x n vertex grid, 8 units across, for the
+// benchmarks that need a mesh with every kind of attribute.
+
+// floats a vertex: position, normal, texture coordinates, color
+const int TERRAIN_FLOATS = 12;
+
+inline float terrainHeight(float x, float z)
+{
+    return 0.6f * std::sin(0.9f * x) * std::cos(0.7f * z) + 0.15f * std::sin(3.1f * x + 2.3f * z);
+}
+
+inline std::vector<float> terrainVertices(int n)
+{
+    std::vector<float> vertices;
+    vertices.reserve((size_t)n * n * TERRAIN_FLOATS);
+    const float e = 1e-3f;
+    for (int j = 0; j < n; j++)
+        for (int i = 0; i < n; i++)
+        {
+            float u = (float)i / (n - 1), v = (float)j / (n - 1);
+            float x = -4.0f + 8.0f * u, z = -4.0f + 8.0f * v;
+            float y = terrainHeight(x, z);
+            glm::vec3 normal = glm::normalize(glm::vec3(terrainHeight(x - e, z) - terrainHeight(x + e, z), 2.0f * e,
+                                                        terrainHeight(x, z - e) - terrainHeight(x, z + e)));
+            float t = glm::clamp(y * 0.7f + 0.5f, 0.0f, 1.0f);
+            glm::vec3 color = glm::mix(glm::vec3(0.2f, 0.5f, 0.15f), glm::vec3(0.55f, 0.45f, 0.3f), t);
+            float vertex[TERRAIN_FLOATS] = { x, y, z, normal.x, normal.y, normal.z, u * 16.0f, v * 16.0f,
+                                             color.r, color.g, color.b, 1.0f };
+            vertices.insert(vertices.end(), vertex, vertex + TERRAIN_FLOATS);
+        }
+    return vertices;
+}
+
+// two triangles a grid cell
+inline std::vector<uint32_t> terrainIndices(int n)
+{
+    std::vector<uint32_t> indices;
+    indices.reserve((size_t)(n - 1) * (n - 1) * 6);
+    for (int j = 0; j + 1 < n; j++)
+        for (int i = 0; i + 1 < n; i++)
+        {
+            uint32_t a = j * n + i, b = a + 1, c = a + n, d = c + 1;
+            uint32_t cell[6] = { a, c, b, b, c, d };
+            indices.insert(indices.end(), cell, cell + 6);
+        }
+    return indices;
+}
+
+#endif
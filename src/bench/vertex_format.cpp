@@ -0,0 +1,124 @@
+// Compact vertex formats (learnopengl/vertex_format.h) on the repo's meshes
+// and on a million random vertices: bytes a vertex before and after, and for
+// every attribute the largest error against what its encoding allows. Exits
+// with 1 when an attribute loses more than that.
+//
+//   g++ -O2 vertex_format.cpp -I../../include -o vertex_format
+//   ./vertex_format
+
+#define PRIMITIVE_SHADER_DIR "../../resources/shaders/"
+
+#include <learnopengl/vertex_format.h>
+
+#include "../Shaders.hpp"
+#include "cube_scene.hpp"
+#include "terrain_mesh.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+const char* const ENCODING_NAMES[] = { "float", "int16", "half", "unorm8", "octahedral" };
+
+struct AttributeSpec
+{
+    GLuint location;
+    int components;
+    VertexEncoding encoding;
+    int source;
+};
+
+// encodes the mesh and prints one line for it and one for each attribute
+bool check(const char* name, const std::vector<float>& vertices, int sourceStride, std::vector<AttributeSpec> specs)
+{
+    VertexFormat format;
+    for (const AttributeSpec& s : specs)
+        format.add(s.location, s.components, s.encoding, s.source);
+    size_t count = vertices.size() / sourceStride;
+    std::vector<unsigned char> packed(count * format.stride());
+
+    auto start = std::chrono::steady_clock::now();
+    format.encode(vertices.data(), count, sourceStride, packed.data());
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::printf("%-16s %8zu vertices  %3d -> %2d bytes  %.2fx  %8.2f ms to encode and check\n", name, count,
+                sourceStride * 4, format.stride(), sourceStride * 4.0 / format.stride(), elapsed.count());
+    bool ok = true;
+    for (const AttributeSpec& s : specs)
+    {
+        float error = format.error(s.location), bound = format.errorBound(s.location);
+        bool within = error <= bound;
+        std::printf("    location %u %-10s  error %.3g  bound %.3g%s\n", s.location, ENCODING_NAMES[s.encoding],
+                    error, bound, within ? "" : "  TOO LARGE");
+        ok = ok && within;
+    }
+    return ok;
+}
+
+// the lines of the 512 x 512 board, as LineGrid builds them
+std::vector<float> boardLines()
+{
+    std::vector<float> vertices;
+    for (float y = 64.0f; y <= 448.0f; y += 48.0f)
+        vertices.insert(vertices.end(), { 64.0f, y, 0.0f, 448.0f, y, 0.0f });
+    for (float x = 64.0f; x <= 448.0f; x += 48.0f)
+        vertices.insert(vertices.end(), { x, 64.0f, 0.0f, x, 448.0f, 0.0f });
+    return vertices;
+}
+
+// positions over a few thousand units, texture coordinates repeating up to
+// 64 times, any color and any direction
+std::vector<float> randomVertices(size_t count)
+{
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> position(-2000.0f, 1500.0f), uv(-64.0f, 64.0f), unit(0.0f, 1.0f),
+        signedUnit(-1.0f, 1.0f);
+    std::vector<float> vertices;
+    vertices.reserve(count * TERRAIN_FLOATS);
+    for (size_t i = 0; i < count; i++)
+    {
+        glm::vec3 n(signedUnit(rng), signedUnit(rng), signedUnit(rng));
+        // every 16th exactly on an axis or a diagonal, the octahedron's edges
+        if (i % 16 == 0)
+            n = glm::vec3((float)(i / 16 % 3) - 1.0f, (float)(i / 48 % 3) - 1.0f, (float)(i / 144 % 3) - 1.0f);
+        if (glm::length(n) < 1e-3f)
+            n = glm::vec3(0.0f, 0.0f, -1.0f);
+        n = glm::normalize(n);
+        float vertex[TERRAIN_FLOATS] = { position(rng), position(rng) * 0.01f, position(rng) * 100.0f, n.x, n.y, n.z,
+                                         uv(rng), uv(rng), unit(rng), unit(rng), unit(rng), unit(rng) };
+        vertices.insert(vertices.end(), vertex, vertex + TERRAIN_FLOATS);
+    }
+    return vertices;
+}
+
+int main()
+{
+    std::vector<AttributeSpec> full = {
+        { 0, 3, VERTEX_INT16, 0 }, { 1, 3, VERTEX_OCTAHEDRAL, 3 }, { 2, 2, VERTEX_HALF, 6 }, { 3, 4, VERTEX_UNORM8, 8 }
+    };
+    std::vector<float> textureQuad = {
+         0.5f,  0.5f, 0.0f,   1.0f, 0.0f, 0.0f,   1.0f, 1.0f,
+         0.5f, -0.5f, 0.0f,   0.0f, 1.0f, 0.0f,   1.0f, 0.0f,
+        -0.5f, -0.5f, 0.0f,   0.0f, 0.0f, 1.0f,   0.0f, 0.0f,
+        -0.5f,  0.5f, 0.0f,   1.0f, 1.0f, 0.0f,   0.0f, 1.0f,
+    };
+
+    bool ok = true;
+    ok &= check("quad", std::vector<float>(std::begin(myPrimitive::QUAD_VERTICES), std::end(myPrimitive::QUAD_VERTICES)), 3,
+                { { 0, 2, VERTEX_INT16, 0 } });
+    ok &= check("board lines", boardLines(), 3, { { 0, 2, VERTEX_INT16, 0 } });
+    ok &= check("textures quad", textureQuad, 8,
+                { { 0, 3, VERTEX_INT16, 0 }, { 1, 3, VERTEX_UNORM8, 3 }, { 2, 2, VERTEX_HALF, 6 } });
+    ok &= check("cube", std::vector<float>(std::begin(CUBE_VERTICES), std::end(CUBE_VERTICES)), 5,
+                { { 0, 3, VERTEX_INT16, 0 }, { 1, 2, VERTEX_HALF, 3 } });
+    ok &= check("terrain 512", terrainVertices(512), TERRAIN_FLOATS, full);
+    ok &= check("random", randomVertices(1000000), TERRAIN_FLOATS, full);
+
+    if (!ok)
+    {
+        std::printf("an encoding lost more than it may\n");
+        return 1;
+    }
+    return 0;
+}
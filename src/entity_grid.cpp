@@ -0,0 +1,181 @@
+#include <learnopengl/gpu_resources.h>
+#include <learnopengl/layer_cache.h>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <glm/glm.hpp>
+
+#include <cstdlib>
+#include <iostream>
+
+#include "LineGrid.hpp"
+#include "Hud.hpp"
+#include "GridEntities.hpp"
+#include "EntityRenderer.hpp"
+
+// Many squares drifting over the board, stored in an EntityWorld instead of
+// one Player object each. Pass the count as the first argument:
+//   ./entity_grid 1000000
+
+void framebuffer_size_callback(GLFWwindow* window, int width, int height);
+void key_callback(GLFWwindow* window, int key, int scancode, int action, int mods);
+
+// settings
+const unsigned int SCR_WIDTH = 512;
+const unsigned int SCR_HEIGHT = 512;
+
+
+int main(int argc, char** argv)
+{
+    size_t entityCount = argc > 1 ? std::strtoul(argv[1], NULL, 10) : 1000000;
+
+    // glfw: initialize and configure
+    // ------------------------------
+    glfwInit();
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+#ifdef __APPLE__
+    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+#endif
+
+    // glfw window creation
+    // --------------------
+    GLFWwindow* window = glfwCreateWindow(SCR_WIDTH, SCR_HEIGHT, "ENTITIES", NULL, NULL);
+    if (window == NULL)
+    {
+        std::cout << "Failed to create GLFW window" << std::endl;
+        glfwTerminate();
+        return -1;
+    }
+    glfwMakeContextCurrent(window);
+    glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
+    glfwSetKeyCallback(window, key_callback);
+
+    // glad: load all OpenGL function pointers
+    // ---------------------------------------
+    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+    {
+        std::cout << "Failed to initialize GLAD" << std::endl;
+        return -1;
+    }
+
+    // the first use makes this thread, the one with the GL context, the
+    // owner of the job system the systems below run on
+    jobSystem();
+
+    float q_a = 48.0f;
+    float padding = 64.0f;
+
+    myPrimitive::LineGrid grid((float)SCR_WIDTH, (float)SCR_HEIGHT, padding, q_a);
+    grid.initialize();
+
+    // the grid never changes, so it is drawn once into the layer cache
+    LayerCache layers;
+    layers.add([&]() { grid.draw(); });
+
+    myGame::EntityRenderer renderer;
+    renderer.initialize();
+
+    myPrimitive::Hud hud;
+    hud.initialize();
+
+    myGame::Board board = { padding, padding, (float)SCR_WIDTH - padding, (float)SCR_HEIGHT - padding };
+
+    // squares start spread over the board with a random heading and speed
+    EntityWorld world;
+    world.reserve<myGame::Position, myGame::Velocity, myGame::Extent, myGame::Tint>(entityCount);
+    std::srand(1);
+    for (size_t i = 0; i < entityCount; i++) {
+        float u = (float)std::rand() / RAND_MAX, v = (float)std::rand() / RAND_MAX;
+        float vx = (float)std::rand() / RAND_MAX * 2.0f - 1.0f, vy = (float)std::rand() / RAND_MAX * 2.0f - 1.0f;
+        uint32_t shade = 64 + std::rand() % 192;
+        world.create(myGame::Position{ board.min_x + u * (board.max_x - board.min_x), board.min_y + v * (board.max_y - board.min_y) },
+                     myGame::Velocity{ vx * 64.0f, vy * 64.0f },
+                     myGame::Extent{ 2.0f },
+                     myGame::Tint{ shade | (uint32_t)(255 - shade) << 8 | 255u << 16 | 255u << 24 });
+    }
+
+    // time management
+    GLfloat currentFrame = 0.0f, deltaTime = 0.0f, lastFrame = 0.0f;
+    myPrimitive::FrameTimes frameTimes;
+
+    // moving and wrapping both write positions, so they run one after the
+    // other; drawing reads them and has to stay on the GL thread
+    EntitySchedule schedule;
+    schedule.add(entitySystem<myGame::Position, const myGame::Velocity>("move", [&](EntityWorld& w) {
+        myGame::moveEntities(w, deltaTime);
+    }));
+    schedule.add(entitySystem<myGame::Position>("wrap", [&](EntityWorld& w) {
+        myGame::wrapEntities(w, board);
+    }));
+    schedule.add(entitySystem<const myGame::Position, const myGame::Extent, const myGame::Tint>("draw", [&](EntityWorld& w) {
+        renderer.draw(w);
+    }, true));
+
+    /* -----------
+     *  Main loop
+     * ----------- */
+    while (!glfwWindowShouldClose(window))
+    {
+        // - calculate time spent on last frame
+        currentFrame = glfwGetTime();
+        deltaTime = currentFrame - lastFrame;
+        lastFrame = currentFrame;
+
+        // - frame time history for the HUD
+        frameTimes.add(deltaTime * 1000.0f);
+
+        // - the static layers in one blit, then what moves
+        layers.composite();
+        schedule.run(world);
+
+        // - frame statistics over everything else
+        int hudY = hud.frameStats(8, 8, frameTimes);
+        hud.text(8, hudY, glm::vec4(0.7f, 0.7f, 0.7f, 1.0f), "%zu entities", world.count());
+        // at the framebuffer's current size, which a resize changes
+        int framebufferWidth, framebufferHeight;
+        glfwGetFramebufferSize(window, &framebufferWidth, &framebufferHeight);
+        hud.draw(framebufferWidth, framebufferHeight);
+
+        glfwSwapBuffers(window);
+        glfwPollEvents();
+    }
+
+    // de-allocate all resources once they've outlived their purpose; what is
+    // still alive on the GPU after that is a leak and gets reported
+    // ------------------------------------------------------------------------
+    hud.destroy();
+    renderer.destroy();
+    layers.destroy();
+    grid.destroy();
+    shaderCache().clear();
+    gpuResources().shutdown();
+
+    // glfw: terminate, clearing all previously allocated GLFW resources.
+    // ------------------------------------------------------------------
+    glfwTerminate();
+    return 0;
+}
+
+void key_callback(GLFWwindow* window, int key, int scancode, int action, int mods)
+{
+    if (key == GLFW_KEY_M && action == GLFW_PRESS) {
+        gpuResources().report(stdout);
+    }
+
+    if (key == GLFW_KEY_Q && action == GLFW_PRESS) {
+        glfwSetWindowShouldClose(window, true);
+    }
+}
+
+// glfw: whenever the window size changed (by OS or user resize) this callback function executes
+// ---------------------------------------------------------------------------------------------
+void framebuffer_size_callback(GLFWwindow* window, int width, int height)
+{
+    // make sure the viewport matches the new window dimensions; note that width and
+    // height will be significantly larger than specified on retina displays.
+    glViewport(0, 0, width, height);
+}
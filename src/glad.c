@@ -639,6 +639,9 @@
 #include <stdlib.h>
 #include <string.h>
 #include <glad/glad.h>
+#ifdef GLAD_TRACE
+#include <glad/glad_trace.h>
+#endif
 
 static void* get_proc(const char *namez);
 
@@ -10111,6 +10114,9 @@ int gladLoadGLLoader(GLADloadproc load) {
 	load_GL_SUN_mesh_array(load);
 	load_GL_SUN_triangle_list(load);
 	load_GL_SUN_vertex(load);
+#ifdef GLAD_TRACE
+	glad_trace_install();
+#endif
 	return GLVersion.major != 0 || GLVersion.minor != 0;
 }
 
@@ -0,0 +1,8524 @@
+/*
+
+    Traced loader mode of glad, generated by src/tools/glad_trace.cpp from
+    include/glad/glad.h. Built only with GLAD_TRACE defined, see
+    glad/glad_trace.h.
+
+*/
+
+#ifdef GLAD_TRACE
+
+#define GLAD_TRACE_ENTRY_POINTS 1048
+#define GLAD_TRACE_GET_ERROR 36
+
+#include <stdio.h>
+#include <string.h>
+#include <glad/glad_trace.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define GLAD_TRACE_CLOCK() __rdtsc()
+#elif defined(_MSC_VER)
+#include <intrin.h>
+#define GLAD_TRACE_CLOCK() __rdtsc()
+#else
+#include <time.h>
+static unsigned long long glad_trace_clock(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (unsigned long long)now.tv_sec * 1000000000ull + (unsigned long long)now.tv_nsec;
+}
+#define GLAD_TRACE_CLOCK() glad_trace_clock()
+#endif
+
+#if defined(__GNUC__)
+#define GLAD_TRACE_LOG2(ticks) ((ticks) ? 63 - __builtin_clzll(ticks) : 0)
+#else
+static int glad_trace_log2(unsigned long long ticks) {
+    int bits = 0;
+    while (ticks >>= 1) bits++;
+    return bits;
+}
+#define GLAD_TRACE_LOG2(ticks) glad_trace_log2(ticks)
+#endif
+
+int glad_trace_check_errors = 0;
+int glad_trace_touched[GLAD_TRACE_ENTRY_POINTS];
+int glad_trace_touched_count = 0;
+
+static PFNGLGETERRORPROC glad_trace_real_glGetError;
+
+unsigned long long glad_trace_ticks(void) {
+    return GLAD_TRACE_CLOCK();
+}
+
+static void glad_trace_record(int id, unsigned long long start) {
+    unsigned long long ticks = GLAD_TRACE_CLOCK() - start;
+    GLADtraceentry* entry = &glad_trace_entries[id];
+    int bucket = GLAD_TRACE_LOG2(ticks);
+    if (entry->calls == 0) glad_trace_touched[glad_trace_touched_count++] = id;
+    entry->calls++;
+    entry->ticks += ticks;
+    entry->histogram[bucket < GLAD_TRACE_BUCKETS ? bucket : GLAD_TRACE_BUCKETS - 1]++;
+    if (glad_trace_check_errors && id != GLAD_TRACE_GET_ERROR) {
+        GLenum error;
+        while ((error = glad_trace_real_glGetError()) != GL_NO_ERROR)
+            fprintf(stderr, "ERROR::GL::%s 0x%04x\n", entry->name, error);
+    }
+}
+
+void glad_trace_reset(void) {
+    int i;
+    for (i = 0; i < glad_trace_touched_count; i++) {
+        GLADtraceentry* entry = &glad_trace_entries[glad_trace_touched[i]];
+        entry->calls = 0;
+        entry->ticks = 0;
+        memset(entry->histogram, 0, sizeof(entry->histogram));
+    }
+    glad_trace_touched_count = 0;
+}
+
+GLADtraceentry glad_trace_entries[GLAD_TRACE_ENTRY_POINTS] = {
+    { "glCullFace", 0, 0, {0} },
+    { "glFrontFace", 0, 0, {0} },
+    { "glHint", 0, 0, {0} },
+    { "glLineWidth", 0, 0, {0} },
+    { "glPointSize", 0, 0, {0} },
+    { "glPolygonMode", 0, 0, {0} },
+    { "glScissor", 0, 0, {0} },
+    { "glTexParameterf", 0, 0, {0} },
+    { "glTexParameterfv", 0, 0, {0} },
+    { "glTexParameteri", 0, 0, {0} },
+    { "glTexParameteriv", 0, 0, {0} },
+    { "glTexImage1D", 0, 0, {0} },
+    { "glTexImage2D", 0, 0, {0} },
+    { "glDrawBuffer", 0, 0, {0} },
+    { "glClear", 0, 0, {0} },
+    { "glClearColor", 0, 0, {0} },
+    { "glClearStencil", 0, 0, {0} },
+    { "glClearDepth", 0, 0, {0} },
+    { "glStencilMask", 0, 0, {0} },
+    { "glColorMask", 0, 0, {0} },
+    { "glDepthMask", 0, 0, {0} },
+    { "glDisable", 0, 0, {0} },
+    { "glEnable", 0, 0, {0} },
+    { "glFinish", 0, 0, {0} },
+    { "glFlush", 0, 0, {0} },
+    { "glBlendFunc", 0, 0, {0} },
+    { "glLogicOp", 0, 0, {0} },
+    { "glStencilFunc", 0, 0, {0} },
+    { "glStencilOp", 0, 0, {0} },
+    { "glDepthFunc", 0, 0, {0} },
+    { "glPixelStoref", 0, 0, {0} },
+    { "glPixelStorei", 0, 0, {0} },
+    { "glReadBuffer", 0, 0, {0} },
+    { "glReadPixels", 0, 0, {0} },
+    { "glGetBooleanv", 0, 0, {0} },
+    { "glGetDoublev", 0, 0, {0} },
+    { "glGetError", 0, 0, {0} },
+    { "glGetFloatv", 0, 0, {0} },
+    { "glGetIntegerv", 0, 0, {0} },
+    { "glGetString", 0, 0, {0} },
+    { "glGetTexImage", 0, 0, {0} },
+    { "glGetTexParameterfv", 0, 0, {0} },
+    { "glGetTexParameteriv", 0, 0, {0} },
+    { "glGetTexLevelParameterfv", 0, 0, {0} },
+    { "glGetTexLevelParameteriv", 0, 0, {0} },
+    { "glIsEnabled", 0, 0, {0} },
+    { "glDepthRange", 0, 0, {0} },
+    { "glViewport", 0, 0, {0} },
+    { "glNewList", 0, 0, {0} },
+    { "glEndList", 0, 0, {0} },
+    { "glCallList", 0, 0, {0} },
+    { "glCallLists", 0, 0, {0} },
+    { "glDeleteLists", 0, 0, {0} },
+    { "glGenLists", 0, 0, {0} },
+    { "glListBase", 0, 0, {0} },
+    { "glBegin", 0, 0, {0} },
+    { "glBitmap", 0, 0, {0} },
+    { "glColor3b", 0, 0, {0} },
+    { "glColor3bv", 0, 0, {0} },
+    { "glColor3d", 0, 0, {0} },
+    { "glColor3dv", 0, 0, {0} },
+    { "glColor3f", 0, 0, {0} },
+    { "glColor3fv", 0, 0, {0} },
+    { "glColor3i", 0, 0, {0} },
+    { "glColor3iv", 0, 0, {0} },
+    { "glColor3s", 0, 0, {0} },
+    { "glColor3sv", 0, 0, {0} },
+    { "glColor3ub", 0, 0, {0} },
+    { "glColor3ubv", 0, 0, {0} },
+    { "glColor3ui", 0, 0, {0} },
+    { "glColor3uiv", 0, 0, {0} },
+    { "glColor3us", 0, 0, {0} },
+    { "glColor3usv", 0, 0, {0} },
+    { "glColor4b", 0, 0, {0} },
+    { "glColor4bv", 0, 0, {0} },
+    { "glColor4d", 0, 0, {0} },
+    { "glColor4dv", 0, 0, {0} },
+    { "glColor4f", 0, 0, {0} },
+    { "glColor4fv", 0, 0, {0} },
+    { "glColor4i", 0, 0, {0} },
+    { "glColor4iv", 0, 0, {0} },
+    { "glColor4s", 0, 0, {0} },
+    { "glColor4sv", 0, 0, {0} },
+    { "glColor4ub", 0, 0, {0} },
+    { "glColor4ubv", 0, 0, {0} },
+    { "glColor4ui", 0, 0, {0} },
+    { "glColor4uiv", 0, 0, {0} },
+    { "glColor4us", 0, 0, {0} },
+    { "glColor4usv", 0, 0, {0} },
+    { "glEdgeFlag", 0, 0, {0} },
+    { "glEdgeFlagv", 0, 0, {0} },
+    { "glEnd", 0, 0, {0} },
+    { "glIndexd", 0, 0, {0} },
+    { "glIndexdv", 0, 0, {0} },
+    { "glIndexf", 0, 0, {0} },
+    { "glIndexfv", 0, 0, {0} },
+    { "glIndexi", 0, 0, {0} },
+    { "glIndexiv", 0, 0, {0} },
+    { "glIndexs", 0, 0, {0} },
+    { "glIndexsv", 0, 0, {0} },
+    { "glNormal3b", 0, 0, {0} },
+    { "glNormal3bv", 0, 0, {0} },
+    { "glNormal3d", 0, 0, {0} },
+    { "glNormal3dv", 0, 0, {0} },
+    { "glNormal3f", 0, 0, {0} },
+    { "glNormal3fv", 0, 0, {0} },
+    { "glNormal3i", 0, 0, {0} },
+    { "glNormal3iv", 0, 0, {0} },
+    { "glNormal3s", 0, 0, {0} },
+    { "glNormal3sv", 0, 0, {0} },
+    { "glRasterPos2d", 0, 0, {0} },
+    { "glRasterPos2dv", 0, 0, {0} },
+    { "glRasterPos2f", 0, 0, {0} },
+    { "glRasterPos2fv", 0, 0, {0} },
+    { "glRasterPos2i", 0, 0, {0} },
+    { "glRasterPos2iv", 0, 0, {0} },
+    { "glRasterPos2s", 0, 0, {0} },
+    { "glRasterPos2sv", 0, 0, {0} },
+    { "glRasterPos3d", 0, 0, {0} },
+    { "glRasterPos3dv", 0, 0, {0} },
+    { "glRasterPos3f", 0, 0, {0} },
+    { "glRasterPos3fv", 0, 0, {0} },
+    { "glRasterPos3i", 0, 0, {0} },
+    { "glRasterPos3iv", 0, 0, {0} },
+    { "glRasterPos3s", 0, 0, {0} },
+    { "glRasterPos3sv", 0, 0, {0} },
+    { "glRasterPos4d", 0, 0, {0} },
+    { "glRasterPos4dv", 0, 0, {0} },
+    { "glRasterPos4f", 0, 0, {0} },
+    { "glRasterPos4fv", 0, 0, {0} },
+    { "glRasterPos4i", 0, 0, {0} },
+    { "glRasterPos4iv", 0, 0, {0} },
+    { "glRasterPos4s", 0, 0, {0} },
+    { "glRasterPos4sv", 0, 0, {0} },
+    { "glRectd", 0, 0, {0} },
+    { "glRectdv", 0, 0, {0} },
+    { "glRectf", 0, 0, {0} },
+    { "glRectfv", 0, 0, {0} },
+    { "glRecti", 0, 0, {0} },
+    { "glRectiv", 0, 0, {0} },
+    { "glRects", 0, 0, {0} },
+    { "glRectsv", 0, 0, {0} },
+    { "glTexCoord1d", 0, 0, {0} },
+    { "glTexCoord1dv", 0, 0, {0} },
+    { "glTexCoord1f", 0, 0, {0} },
+    { "glTexCoord1fv", 0, 0, {0} },
+    { "glTexCoord1i", 0, 0, {0} },
+    { "glTexCoord1iv", 0, 0, {0} },
+    { "glTexCoord1s", 0, 0, {0} },
+    { "glTexCoord1sv", 0, 0, {0} },
+    { "glTexCoord2d", 0, 0, {0} },
+    { "glTexCoord2dv", 0, 0, {0} },
+    { "glTexCoord2f", 0, 0, {0} },
+    { "glTexCoord2fv", 0, 0, {0} },
+    { "glTexCoord2i", 0, 0, {0} },
+    { "glTexCoord2iv", 0, 0, {0} },
+    { "glTexCoord2s", 0, 0, {0} },
+    { "glTexCoord2sv", 0, 0, {0} },
+    { "glTexCoord3d", 0, 0, {0} },
+    { "glTexCoord3dv", 0, 0, {0} },
+    { "glTexCoord3f", 0, 0, {0} },
+    { "glTexCoord3fv", 0, 0, {0} },
+    { "glTexCoord3i", 0, 0, {0} },
+    { "glTexCoord3iv", 0, 0, {0} },
+    { "glTexCoord3s", 0, 0, {0} },
+    { "glTexCoord3sv", 0, 0, {0} },
+    { "glTexCoord4d", 0, 0, {0} },
+    { "glTexCoord4dv", 0, 0, {0} },
+    { "glTexCoord4f", 0, 0, {0} },
+    { "glTexCoord4fv", 0, 0, {0} },
+    { "glTexCoord4i", 0, 0, {0} },
+    { "glTexCoord4iv", 0, 0, {0} },
+    { "glTexCoord4s", 0, 0, {0} },
+    { "glTexCoord4sv", 0, 0, {0} },
+    { "glVertex2d", 0, 0, {0} },
+    { "glVertex2dv", 0, 0, {0} },
+    { "glVertex2f", 0, 0, {0} },
+    { "glVertex2fv", 0, 0, {0} },
+    { "glVertex2i", 0, 0, {0} },
+    { "glVertex2iv", 0, 0, {0} },
+    { "glVertex2s", 0, 0, {0} },
+    { "glVertex2sv", 0, 0, {0} },
+    { "glVertex3d", 0, 0, {0} },
+    { "glVertex3dv", 0, 0, {0} },
+    { "glVertex3f", 0, 0, {0} },
+    { "glVertex3fv", 0, 0, {0} },
+    { "glVertex3i", 0, 0, {0} },
+    { "glVertex3iv", 0, 0, {0} },
+    { "glVertex3s", 0, 0, {0} },
+    { "glVertex3sv", 0, 0, {0} },
+    { "glVertex4d", 0, 0, {0} },
+    { "glVertex4dv", 0, 0, {0} },
+    { "glVertex4f", 0, 0, {0} },
+    { "glVertex4fv", 0, 0, {0} },
+    { "glVertex4i", 0, 0, {0} },
+    { "glVertex4iv", 0, 0, {0} },
+    { "glVertex4s", 0, 0, {0} },
+    { "glVertex4sv", 0, 0, {0} },
+    { "glClipPlane", 0, 0, {0} },
+    { "glColorMaterial", 0, 0, {0} },
+    { "glFogf", 0, 0, {0} },
+    { "glFogfv", 0, 0, {0} },
+    { "glFogi", 0, 0, {0} },
+    { "glFogiv", 0, 0, {0} },
+    { "glLightf", 0, 0, {0} },
+    { "glLightfv", 0, 0, {0} },
+    { "glLighti", 0, 0, {0} },
+    { "glLightiv", 0, 0, {0} },
+    { "glLightModelf", 0, 0, {0} },
+    { "glLightModelfv", 0, 0, {0} },
+    { "glLightModeli", 0, 0, {0} },
+    { "glLightModeliv", 0, 0, {0} },
+    { "glLineStipple", 0, 0, {0} },
+    { "glMaterialf", 0, 0, {0} },
+    { "glMaterialfv", 0, 0, {0} },
+    { "glMateriali", 0, 0, {0} },
+    { "glMaterialiv", 0, 0, {0} },
+    { "glPolygonStipple", 0, 0, {0} },
+    { "glShadeModel", 0, 0, {0} },
+    { "glTexEnvf", 0, 0, {0} },
+    { "glTexEnvfv", 0, 0, {0} },
+    { "glTexEnvi", 0, 0, {0} },
+    { "glTexEnviv", 0, 0, {0} },
+    { "glTexGend", 0, 0, {0} },
+    { "glTexGendv", 0, 0, {0} },
+    { "glTexGenf", 0, 0, {0} },
+    { "glTexGenfv", 0, 0, {0} },
+    { "glTexGeni", 0, 0, {0} },
+    { "glTexGeniv", 0, 0, {0} },
+    { "glFeedbackBuffer", 0, 0, {0} },
+    { "glSelectBuffer", 0, 0, {0} },
+    { "glRenderMode", 0, 0, {0} },
+    { "glInitNames", 0, 0, {0} },
+    { "glLoadName", 0, 0, {0} },
+    { "glPassThrough", 0, 0, {0} },
+    { "glPopName", 0, 0, {0} },
+    { "glPushName", 0, 0, {0} },
+    { "glClearAccum", 0, 0, {0} },
+    { "glClearIndex", 0, 0, {0} },
+    { "glIndexMask", 0, 0, {0} },
+    { "glAccum", 0, 0, {0} },
+    { "glPopAttrib", 0, 0, {0} },
+    { "glPushAttrib", 0, 0, {0} },
+    { "glMap1d", 0, 0, {0} },
+    { "glMap1f", 0, 0, {0} },
+    { "glMap2d", 0, 0, {0} },
+    { "glMap2f", 0, 0, {0} },
+    { "glMapGrid1d", 0, 0, {0} },
+    { "glMapGrid1f", 0, 0, {0} },
+    { "glMapGrid2d", 0, 0, {0} },
+    { "glMapGrid2f", 0, 0, {0} },
+    { "glEvalCoord1d", 0, 0, {0} },
+    { "glEvalCoord1dv", 0, 0, {0} },
+    { "glEvalCoord1f", 0, 0, {0} },
+    { "glEvalCoord1fv", 0, 0, {0} },
+    { "glEvalCoord2d", 0, 0, {0} },
+    { "glEvalCoord2dv", 0, 0, {0} },
+    { "glEvalCoord2f", 0, 0, {0} },
+    { "glEvalCoord2fv", 0, 0, {0} },
+    { "glEvalMesh1", 0, 0, {0} },
+    { "glEvalPoint1", 0, 0, {0} },
+    { "glEvalMesh2", 0, 0, {0} },
+    { "glEvalPoint2", 0, 0, {0} },
+    { "glAlphaFunc", 0, 0, {0} },
+    { "glPixelZoom", 0, 0, {0} },
+    { "glPixelTransferf", 0, 0, {0} },
+    { "glPixelTransferi", 0, 0, {0} },
+    { "glPixelMapfv", 0, 0, {0} },
+    { "glPixelMapuiv", 0, 0, {0} },
+    { "glPixelMapusv", 0, 0, {0} },
+    { "glCopyPixels", 0, 0, {0} },
+    { "glDrawPixels", 0, 0, {0} },
+    { "glGetClipPlane", 0, 0, {0} },
+    { "glGetLightfv", 0, 0, {0} },
+    { "glGetLightiv", 0, 0, {0} },
+    { "glGetMapdv", 0, 0, {0} },
+    { "glGetMapfv", 0, 0, {0} },
+    { "glGetMapiv", 0, 0, {0} },
+    { "glGetMaterialfv", 0, 0, {0} },
+    { "glGetMaterialiv", 0, 0, {0} },
+    { "glGetPixelMapfv", 0, 0, {0} },
+    { "glGetPixelMapuiv", 0, 0, {0} },
+    { "glGetPixelMapusv", 0, 0, {0} },
+    { "glGetPolygonStipple", 0, 0, {0} },
+    { "glGetTexEnvfv", 0, 0, {0} },
+    { "glGetTexEnviv", 0, 0, {0} },
+    { "glGetTexGendv", 0, 0, {0} },
+    { "glGetTexGenfv", 0, 0, {0} },
+    { "glGetTexGeniv", 0, 0, {0} },
+    { "glIsList", 0, 0, {0} },
+    { "glFrustum", 0, 0, {0} },
+    { "glLoadIdentity", 0, 0, {0} },
+    { "glLoadMatrixf", 0, 0, {0} },
+    { "glLoadMatrixd", 0, 0, {0} },
+    { "glMatrixMode", 0, 0, {0} },
+    { "glMultMatrixf", 0, 0, {0} },
+    { "glMultMatrixd", 0, 0, {0} },
+    { "glOrtho", 0, 0, {0} },
+    { "glPopMatrix", 0, 0, {0} },
+    { "glPushMatrix", 0, 0, {0} },
+    { "glRotated", 0, 0, {0} },
+    { "glRotatef", 0, 0, {0} },
+    { "glScaled", 0, 0, {0} },
+    { "glScalef", 0, 0, {0} },
+    { "glTranslated", 0, 0, {0} },
+    { "glTranslatef", 0, 0, {0} },
+    { "glDrawArrays", 0, 0, {0} },
+    { "glDrawElements", 0, 0, {0} },
+    { "glGetPointerv", 0, 0, {0} },
+    { "glPolygonOffset", 0, 0, {0} },
+    { "glCopyTexImage1D", 0, 0, {0} },
+    { "glCopyTexImage2D", 0, 0, {0} },
+    { "glCopyTexSubImage1D", 0, 0, {0} },
+    { "glCopyTexSubImage2D", 0, 0, {0} },
+    { "glTexSubImage1D", 0, 0, {0} },
+    { "glTexSubImage2D", 0, 0, {0} },
+    { "glBindTexture", 0, 0, {0} },
+    { "glDeleteTextures", 0, 0, {0} },
+    { "glGenTextures", 0, 0, {0} },
+    { "glIsTexture", 0, 0, {0} },
+    { "glArrayElement", 0, 0, {0} },
+    { "glColorPointer", 0, 0, {0} },
+    { "glDisableClientState", 0, 0, {0} },
+    { "glEdgeFlagPointer", 0, 0, {0} },
+    { "glEnableClientState", 0, 0, {0} },
+    { "glIndexPointer", 0, 0, {0} },
+    { "glInterleavedArrays", 0, 0, {0} },
+    { "glNormalPointer", 0, 0, {0} },
+    { "glTexCoordPointer", 0, 0, {0} },
+    { "glVertexPointer", 0, 0, {0} },
+    { "glAreTexturesResident", 0, 0, {0} },
+    { "glPrioritizeTextures", 0, 0, {0} },
+    { "glIndexub", 0, 0, {0} },
+    { "glIndexubv", 0, 0, {0} },
+    { "glPopClientAttrib", 0, 0, {0} },
+    { "glPushClientAttrib", 0, 0, {0} },
+    { "glDrawRangeElements", 0, 0, {0} },
+    { "glTexImage3D", 0, 0, {0} },
+    { "glTexSubImage3D", 0, 0, {0} },
+    { "glCopyTexSubImage3D", 0, 0, {0} },
+    { "glActiveTexture", 0, 0, {0} },
+    { "glSampleCoverage", 0, 0, {0} },
+    { "glCompressedTexImage3D", 0, 0, {0} },
+    { "glCompressedTexImage2D", 0, 0, {0} },
+    { "glCompressedTexImage1D", 0, 0, {0} },
+    { "glCompressedTexSubImage3D", 0, 0, {0} },
+    { "glCompressedTexSubImage2D", 0, 0, {0} },
+    { "glCompressedTexSubImage1D", 0, 0, {0} },
+    { "glGetCompressedTexImage", 0, 0, {0} },
+    { "glClientActiveTexture", 0, 0, {0} },
+    { "glMultiTexCoord1d", 0, 0, {0} },
+    { "glMultiTexCoord1dv", 0, 0, {0} },
+    { "glMultiTexCoord1f", 0, 0, {0} },
+    { "glMultiTexCoord1fv", 0, 0, {0} },
+    { "glMultiTexCoord1i", 0, 0, {0} },
+    { "glMultiTexCoord1iv", 0, 0, {0} },
+    { "glMultiTexCoord1s", 0, 0, {0} },
+    { "glMultiTexCoord1sv", 0, 0, {0} },
+    { "glMultiTexCoord2d", 0, 0, {0} },
+    { "glMultiTexCoord2dv", 0, 0, {0} },
+    { "glMultiTexCoord2f", 0, 0, {0} },
+    { "glMultiTexCoord2fv", 0, 0, {0} },
+    { "glMultiTexCoord2i", 0, 0, {0} },
+    { "glMultiTexCoord2iv", 0, 0, {0} },
+    { "glMultiTexCoord2s", 0, 0, {0} },
+    { "glMultiTexCoord2sv", 0, 0, {0} },
+    { "glMultiTexCoord3d", 0, 0, {0} },
+    { "glMultiTexCoord3dv", 0, 0, {0} },
+    { "glMultiTexCoord3f", 0, 0, {0} },
+    { "glMultiTexCoord3fv", 0, 0, {0} },
+    { "glMultiTexCoord3i", 0, 0, {0} },
+    { "glMultiTexCoord3iv", 0, 0, {0} },
+    { "glMultiTexCoord3s", 0, 0, {0} },
+    { "glMultiTexCoord3sv", 0, 0, {0} },
+    { "glMultiTexCoord4d", 0, 0, {0} },
+    { "glMultiTexCoord4dv", 0, 0, {0} },
+    { "glMultiTexCoord4f", 0, 0, {0} },
+    { "glMultiTexCoord4fv", 0, 0, {0} },
+    { "glMultiTexCoord4i", 0, 0, {0} },
+    { "glMultiTexCoord4iv", 0, 0, {0} },
+    { "glMultiTexCoord4s", 0, 0, {0} },
+    { "glMultiTexCoord4sv", 0, 0, {0} },
+    { "glLoadTransposeMatrixf", 0, 0, {0} },
+    { "glLoadTransposeMatrixd", 0, 0, {0} },
+    { "glMultTransposeMatrixf", 0, 0, {0} },
+    { "glMultTransposeMatrixd", 0, 0, {0} },
+    { "glBlendFuncSeparate", 0, 0, {0} },
+    { "glMultiDrawArrays", 0, 0, {0} },
+    { "glMultiDrawElements", 0, 0, {0} },
+    { "glPointParameterf", 0, 0, {0} },
+    { "glPointParameterfv", 0, 0, {0} },
+    { "glPointParameteri", 0, 0, {0} },
+    { "glPointParameteriv", 0, 0, {0} },
+    { "glFogCoordf", 0, 0, {0} },
+    { "glFogCoordfv", 0, 0, {0} },
+    { "glFogCoordd", 0, 0, {0} },
+    { "glFogCoorddv", 0, 0, {0} },
+    { "glFogCoordPointer", 0, 0, {0} },
+    { "glSecondaryColor3b", 0, 0, {0} },
+    { "glSecondaryColor3bv", 0, 0, {0} },
+    { "glSecondaryColor3d", 0, 0, {0} },
+    { "glSecondaryColor3dv", 0, 0, {0} },
+    { "glSecondaryColor3f", 0, 0, {0} },
+    { "glSecondaryColor3fv", 0, 0, {0} },
+    { "glSecondaryColor3i", 0, 0, {0} },
+    { "glSecondaryColor3iv", 0, 0, {0} },
+    { "glSecondaryColor3s", 0, 0, {0} },
+    { "glSecondaryColor3sv", 0, 0, {0} },
+    { "glSecondaryColor3ub", 0, 0, {0} },
+    { "glSecondaryColor3ubv", 0, 0, {0} },
+    { "glSecondaryColor3ui", 0, 0, {0} },
+    { "glSecondaryColor3uiv", 0, 0, {0} },
+    { "glSecondaryColor3us", 0, 0, {0} },
+    { "glSecondaryColor3usv", 0, 0, {0} },
+    { "glSecondaryColorPointer", 0, 0, {0} },
+    { "glWindowPos2d", 0, 0, {0} },
+    { "glWindowPos2dv", 0, 0, {0} },
+    { "glWindowPos2f", 0, 0, {0} },
+    { "glWindowPos2fv", 0, 0, {0} },
+    { "glWindowPos2i", 0, 0, {0} },
+    { "glWindowPos2iv", 0, 0, {0} },
+    { "glWindowPos2s", 0, 0, {0} },
+    { "glWindowPos2sv", 0, 0, {0} },
+    { "glWindowPos3d", 0, 0, {0} },
+    { "glWindowPos3dv", 0, 0, {0} },
+    { "glWindowPos3f", 0, 0, {0} },
+    { "glWindowPos3fv", 0, 0, {0} },
+    { "glWindowPos3i", 0, 0, {0} },
+    { "glWindowPos3iv", 0, 0, {0} },
+    { "glWindowPos3s", 0, 0, {0} },
+    { "glWindowPos3sv", 0, 0, {0} },
+    { "glBlendColor", 0, 0, {0} },
+    { "glBlendEquation", 0, 0, {0} },
+    { "glGenQueries", 0, 0, {0} },
+    { "glDeleteQueries", 0, 0, {0} },
+    { "glIsQuery", 0, 0, {0} },
+    { "glBeginQuery", 0, 0, {0} },
+    { "glEndQuery", 0, 0, {0} },
+    { "glGetQueryiv", 0, 0, {0} },
+    { "glGetQueryObjectiv", 0, 0, {0} },
+    { "glGetQueryObjectuiv", 0, 0, {0} },
+    { "glBindBuffer", 0, 0, {0} },
+    { "glDeleteBuffers", 0, 0, {0} },
+    { "glGenBuffers", 0, 0, {0} },
+    { "glIsBuffer", 0, 0, {0} },
+    { "glBufferData", 0, 0, {0} },
+    { "glBufferSubData", 0, 0, {0} },
+    { "glGetBufferSubData", 0, 0, {0} },
+    { "glMapBuffer", 0, 0, {0} },
+    { "glUnmapBuffer", 0, 0, {0} },
+    { "glGetBufferParameteriv", 0, 0, {0} },
+    { "glGetBufferPointerv", 0, 0, {0} },
+    { "glBlendEquationSeparate", 0, 0, {0} },
+    { "glDrawBuffers", 0, 0, {0} },
+    { "glStencilOpSeparate", 0, 0, {0} },
+    { "glStencilFuncSeparate", 0, 0, {0} },
+    { "glStencilMaskSeparate", 0, 0, {0} },
+    { "glAttachShader", 0, 0, {0} },
+    { "glBindAttribLocation", 0, 0, {0} },
+    { "glCompileShader", 0, 0, {0} },
+    { "glCreateProgram", 0, 0, {0} },
+    { "glCreateShader", 0, 0, {0} },
+    { "glDeleteProgram", 0, 0, {0} },
+    { "glDeleteShader", 0, 0, {0} },
+    { "glDetachShader", 0, 0, {0} },
+    { "glDisableVertexAttribArray", 0, 0, {0} },
+    { "glEnableVertexAttribArray", 0, 0, {0} },
+    { "glGetActiveAttrib", 0, 0, {0} },
+    { "glGetActiveUniform", 0, 0, {0} },
+    { "glGetAttachedShaders", 0, 0, {0} },
+    { "glGetAttribLocation", 0, 0, {0} },
+    { "glGetProgramiv", 0, 0, {0} },
+    { "glGetProgramInfoLog", 0, 0, {0} },
+    { "glGetShaderiv", 0, 0, {0} },
+    { "glGetShaderInfoLog", 0, 0, {0} },
+    { "glGetShaderSource", 0, 0, {0} },
+    { "glGetUniformLocation", 0, 0, {0} },
+    { "glGetUniformfv", 0, 0, {0} },
+    { "glGetUniformiv", 0, 0, {0} },
+    { "glGetVertexAttribdv", 0, 0, {0} },
+    { "glGetVertexAttribfv", 0, 0, {0} },
+    { "glGetVertexAttribiv", 0, 0, {0} },
+    { "glGetVertexAttribPointerv", 0, 0, {0} },
+    { "glIsProgram", 0, 0, {0} },
+    { "glIsShader", 0, 0, {0} },
+    { "glLinkProgram", 0, 0, {0} },
+    { "glShaderSource", 0, 0, {0} },
+    { "glUseProgram", 0, 0, {0} },
+    { "glUniform1f", 0, 0, {0} },
+    { "glUniform2f", 0, 0, {0} },
+    { "glUniform3f", 0, 0, {0} },
+    { "glUniform4f", 0, 0, {0} },
+    { "glUniform1i", 0, 0, {0} },
+    { "glUniform2i", 0, 0, {0} },
+    { "glUniform3i", 0, 0, {0} },
+    { "glUniform4i", 0, 0, {0} },
+    { "glUniform1fv", 0, 0, {0} },
+    { "glUniform2fv", 0, 0, {0} },
+    { "glUniform3fv", 0, 0, {0} },
+    { "glUniform4fv", 0, 0, {0} },
+    { "glUniform1iv", 0, 0, {0} },
+    { "glUniform2iv", 0, 0, {0} },
+    { "glUniform3iv", 0, 0, {0} },
+    { "glUniform4iv", 0, 0, {0} },
+    { "glUniformMatrix2fv", 0, 0, {0} },
+    { "glUniformMatrix3fv", 0, 0, {0} },
+    { "glUniformMatrix4fv", 0, 0, {0} },
+    { "glValidateProgram", 0, 0, {0} },
+    { "glVertexAttrib1d", 0, 0, {0} },
+    { "glVertexAttrib1dv", 0, 0, {0} },
+    { "glVertexAttrib1f", 0, 0, {0} },
+    { "glVertexAttrib1fv", 0, 0, {0} },
+    { "glVertexAttrib1s", 0, 0, {0} },
+    { "glVertexAttrib1sv", 0, 0, {0} },
+    { "glVertexAttrib2d", 0, 0, {0} },
+    { "glVertexAttrib2dv", 0, 0, {0} },
+    { "glVertexAttrib2f", 0, 0, {0} },
+    { "glVertexAttrib2fv", 0, 0, {0} },
+    { "glVertexAttrib2s", 0, 0, {0} },
+    { "glVertexAttrib2sv", 0, 0, {0} },
+    { "glVertexAttrib3d", 0, 0, {0} },
+    { "glVertexAttrib3dv", 0, 0, {0} },
+    { "glVertexAttrib3f", 0, 0, {0} },
+    { "glVertexAttrib3fv", 0, 0, {0} },
+    { "glVertexAttrib3s", 0, 0, {0} },
+    { "glVertexAttrib3sv", 0, 0, {0} },
+    { "glVertexAttrib4Nbv", 0, 0, {0} },
+    { "glVertexAttrib4Niv", 0, 0, {0} },
+    { "glVertexAttrib4Nsv", 0, 0, {0} },
+    { "glVertexAttrib4Nub", 0, 0, {0} },
+    { "glVertexAttrib4Nubv", 0, 0, {0} },
+    { "glVertexAttrib4Nuiv", 0, 0, {0} },
+    { "glVertexAttrib4Nusv", 0, 0, {0} },
+    { "glVertexAttrib4bv", 0, 0, {0} },
+    { "glVertexAttrib4d", 0, 0, {0} },
+    { "glVertexAttrib4dv", 0, 0, {0} },
+    { "glVertexAttrib4f", 0, 0, {0} },
+    { "glVertexAttrib4fv", 0, 0, {0} },
+    { "glVertexAttrib4iv", 0, 0, {0} },
+    { "glVertexAttrib4s", 0, 0, {0} },
+    { "glVertexAttrib4sv", 0, 0, {0} },
+    { "glVertexAttrib4ubv", 0, 0, {0} },
+    { "glVertexAttrib4uiv", 0, 0, {0} },
+    { "glVertexAttrib4usv", 0, 0, {0} },
+    { "glVertexAttribPointer", 0, 0, {0} },
+    { "glUniformMatrix2x3fv", 0, 0, {0} },
+    { "glUniformMatrix3x2fv", 0, 0, {0} },
+    { "glUniformMatrix2x4fv", 0, 0, {0} },
+    { "glUniformMatrix4x2fv", 0, 0, {0} },
+    { "glUniformMatrix3x4fv", 0, 0, {0} },
+    { "glUniformMatrix4x3fv", 0, 0, {0} },
+    { "glColorMaski", 0, 0, {0} },
+    { "glGetBooleani_v", 0, 0, {0} },
+    { "glGetIntegeri_v", 0, 0, {0} },
+    { "glEnablei", 0, 0, {0} },
+    { "glDisablei", 0, 0, {0} },
+    { "glIsEnabledi", 0, 0, {0} },
+    { "glBeginTransformFeedback", 0, 0, {0} },
+    { "glEndTransformFeedback", 0, 0, {0} },
+    { "glBindBufferRange", 0, 0, {0} },
+    { "glBindBufferBase", 0, 0, {0} },
+    { "glTransformFeedbackVaryings", 0, 0, {0} },
+    { "glGetTransformFeedbackVarying", 0, 0, {0} },
+    { "glClampColor", 0, 0, {0} },
+    { "glBeginConditionalRender", 0, 0, {0} },
+    { "glEndConditionalRender", 0, 0, {0} },
+    { "glVertexAttribIPointer", 0, 0, {0} },
+    { "glGetVertexAttribIiv", 0, 0, {0} },
+    { "glGetVertexAttribIuiv", 0, 0, {0} },
+    { "glVertexAttribI1i", 0, 0, {0} },
+    { "glVertexAttribI2i", 0, 0, {0} },
+    { "glVertexAttribI3i", 0, 0, {0} },
+    { "glVertexAttribI4i", 0, 0, {0} },
+    { "glVertexAttribI1ui", 0, 0, {0} },
+    { "glVertexAttribI2ui", 0, 0, {0} },
+    { "glVertexAttribI3ui", 0, 0, {0} },
+    { "glVertexAttribI4ui", 0, 0, {0} },
+    { "glVertexAttribI1iv", 0, 0, {0} },
+    { "glVertexAttribI2iv", 0, 0, {0} },
+    { "glVertexAttribI3iv", 0, 0, {0} },
+    { "glVertexAttribI4iv", 0, 0, {0} },
+    { "glVertexAttribI1uiv", 0, 0, {0} },
+    { "glVertexAttribI2uiv", 0, 0, {0} },
+    { "glVertexAttribI3uiv", 0, 0, {0} },
+    { "glVertexAttribI4uiv", 0, 0, {0} },
+    { "glVertexAttribI4bv", 0, 0, {0} },
+    { "glVertexAttribI4sv", 0, 0, {0} },
+    { "glVertexAttribI4ubv", 0, 0, {0} },
+    { "glVertexAttribI4usv", 0, 0, {0} },
+    { "glGetUniformuiv", 0, 0, {0} },
+    { "glBindFragDataLocation", 0, 0, {0} },
+    { "glGetFragDataLocation", 0, 0, {0} },
+    { "glUniform1ui", 0, 0, {0} },
+    { "glUniform2ui", 0, 0, {0} },
+    { "glUniform3ui", 0, 0, {0} },
+    { "glUniform4ui", 0, 0, {0} },
+    { "glUniform1uiv", 0, 0, {0} },
+    { "glUniform2uiv", 0, 0, {0} },
+    { "glUniform3uiv", 0, 0, {0} },
+    { "glUniform4uiv", 0, 0, {0} },
+    { "glTexParameterIiv", 0, 0, {0} },
+    { "glTexParameterIuiv", 0, 0, {0} },
+    { "glGetTexParameterIiv", 0, 0, {0} },
+    { "glGetTexParameterIuiv", 0, 0, {0} },
+    { "glClearBufferiv", 0, 0, {0} },
+    { "glClearBufferuiv", 0, 0, {0} },
+    { "glClearBufferfv", 0, 0, {0} },
+    { "glClearBufferfi", 0, 0, {0} },
+    { "glGetStringi", 0, 0, {0} },
+    { "glIsRenderbuffer", 0, 0, {0} },
+    { "glBindRenderbuffer", 0, 0, {0} },
+    { "glDeleteRenderbuffers", 0, 0, {0} },
+    { "glGenRenderbuffers", 0, 0, {0} },
+    { "glRenderbufferStorage", 0, 0, {0} },
+    { "glGetRenderbufferParameteriv", 0, 0, {0} },
+    { "glIsFramebuffer", 0, 0, {0} },
+    { "glBindFramebuffer", 0, 0, {0} },
+    { "glDeleteFramebuffers", 0, 0, {0} },
+    { "glGenFramebuffers", 0, 0, {0} },
+    { "glCheckFramebufferStatus", 0, 0, {0} },
+    { "glFramebufferTexture1D", 0, 0, {0} },
+    { "glFramebufferTexture2D", 0, 0, {0} },
+    { "glFramebufferTexture3D", 0, 0, {0} },
+    { "glFramebufferRenderbuffer", 0, 0, {0} },
+    { "glGetFramebufferAttachmentParameteriv", 0, 0, {0} },
+    { "glGenerateMipmap", 0, 0, {0} },
+    { "glBlitFramebuffer", 0, 0, {0} },
+    { "glRenderbufferStorageMultisample", 0, 0, {0} },
+    { "glFramebufferTextureLayer", 0, 0, {0} },
+    { "glMapBufferRange", 0, 0, {0} },
+    { "glFlushMappedBufferRange", 0, 0, {0} },
+    { "glBindVertexArray", 0, 0, {0} },
+    { "glDeleteVertexArrays", 0, 0, {0} },
+    { "glGenVertexArrays", 0, 0, {0} },
+    { "glIsVertexArray", 0, 0, {0} },
+    { "glDrawArraysInstanced", 0, 0, {0} },
+    { "glDrawElementsInstanced", 0, 0, {0} },
+    { "glTexBuffer", 0, 0, {0} },
+    { "glPrimitiveRestartIndex", 0, 0, {0} },
+    { "glCopyBufferSubData", 0, 0, {0} },
+    { "glGetUniformIndices", 0, 0, {0} },
+    { "glGetActiveUniformsiv", 0, 0, {0} },
+    { "glGetActiveUniformName", 0, 0, {0} },
+    { "glGetUniformBlockIndex", 0, 0, {0} },
+    { "glGetActiveUniformBlockiv", 0, 0, {0} },
+    { "glGetActiveUniformBlockName", 0, 0, {0} },
+    { "glUniformBlockBinding", 0, 0, {0} },
+    { "glDrawElementsBaseVertex", 0, 0, {0} },
+    { "glDrawRangeElementsBaseVertex", 0, 0, {0} },
+    { "glDrawElementsInstancedBaseVertex", 0, 0, {0} },
+    { "glMultiDrawElementsBaseVertex", 0, 0, {0} },
+    { "glProvokingVertex", 0, 0, {0} },
+    { "glFenceSync", 0, 0, {0} },
+    { "glIsSync", 0, 0, {0} },
+    { "glDeleteSync", 0, 0, {0} },
+    { "glClientWaitSync", 0, 0, {0} },
+    { "glWaitSync", 0, 0, {0} },
+    { "glGetInteger64v", 0, 0, {0} },
+    { "glGetSynciv", 0, 0, {0} },
+    { "glGetInteger64i_v", 0, 0, {0} },
+    { "glGetBufferParameteri64v", 0, 0, {0} },
+    { "glFramebufferTexture", 0, 0, {0} },
+    { "glTexImage2DMultisample", 0, 0, {0} },
+    { "glTexImage3DMultisample", 0, 0, {0} },
+    { "glGetMultisamplefv", 0, 0, {0} },
+    { "glSampleMaski", 0, 0, {0} },
+    { "glBindFragDataLocationIndexed", 0, 0, {0} },
+    { "glGetFragDataIndex", 0, 0, {0} },
+    { "glGenSamplers", 0, 0, {0} },
+    { "glDeleteSamplers", 0, 0, {0} },
+    { "glIsSampler", 0, 0, {0} },
+    { "glBindSampler", 0, 0, {0} },
+    { "glSamplerParameteri", 0, 0, {0} },
+    { "glSamplerParameteriv", 0, 0, {0} },
+    { "glSamplerParameterf", 0, 0, {0} },
+    { "glSamplerParameterfv", 0, 0, {0} },
+    { "glSamplerParameterIiv", 0, 0, {0} },
+    { "glSamplerParameterIuiv", 0, 0, {0} },
+    { "glGetSamplerParameteriv", 0, 0, {0} },
+    { "glGetSamplerParameterIiv", 0, 0, {0} },
+    { "glGetSamplerParameterfv", 0, 0, {0} },
+    { "glGetSamplerParameterIuiv", 0, 0, {0} },
+    { "glQueryCounter", 0, 0, {0} },
+    { "glGetQueryObjecti64v", 0, 0, {0} },
+    { "glGetQueryObjectui64v", 0, 0, {0} },
+    { "glVertexAttribDivisor", 0, 0, {0} },
+    { "glVertexAttribP1ui", 0, 0, {0} },
+    { "glVertexAttribP1uiv", 0, 0, {0} },
+    { "glVertexAttribP2ui", 0, 0, {0} },
+    { "glVertexAttribP2uiv", 0, 0, {0} },
+    { "glVertexAttribP3ui", 0, 0, {0} },
+    { "glVertexAttribP3uiv", 0, 0, {0} },
+    { "glVertexAttribP4ui", 0, 0, {0} },
+    { "glVertexAttribP4uiv", 0, 0, {0} },
+    { "glVertexP2ui", 0, 0, {0} },
+    { "glVertexP2uiv", 0, 0, {0} },
+    { "glVertexP3ui", 0, 0, {0} },
+    { "glVertexP3uiv", 0, 0, {0} },
+    { "glVertexP4ui", 0, 0, {0} },
+    { "glVertexP4uiv", 0, 0, {0} },
+    { "glTexCoordP1ui", 0, 0, {0} },
+    { "glTexCoordP1uiv", 0, 0, {0} },
+    { "glTexCoordP2ui", 0, 0, {0} },
+    { "glTexCoordP2uiv", 0, 0, {0} },
+    { "glTexCoordP3ui", 0, 0, {0} },
+    { "glTexCoordP3uiv", 0, 0, {0} },
+    { "glTexCoordP4ui", 0, 0, {0} },
+    { "glTexCoordP4uiv", 0, 0, {0} },
+    { "glMultiTexCoordP1ui", 0, 0, {0} },
+    { "glMultiTexCoordP1uiv", 0, 0, {0} },
+    { "glMultiTexCoordP2ui", 0, 0, {0} },
+    { "glMultiTexCoordP2uiv", 0, 0, {0} },
+    { "glMultiTexCoordP3ui", 0, 0, {0} },
+    { "glMultiTexCoordP3uiv", 0, 0, {0} },
+    { "glMultiTexCoordP4ui", 0, 0, {0} },
+    { "glMultiTexCoordP4uiv", 0, 0, {0} },
+    { "glNormalP3ui", 0, 0, {0} },
+    { "glNormalP3uiv", 0, 0, {0} },
+    { "glColorP3ui", 0, 0, {0} },
+    { "glColorP3uiv", 0, 0, {0} },
+    { "glColorP4ui", 0, 0, {0} },
+    { "glColorP4uiv", 0, 0, {0} },
+    { "glSecondaryColorP3ui", 0, 0, {0} },
+    { "glSecondaryColorP3uiv", 0, 0, {0} },
+    { "glMinSampleShading", 0, 0, {0} },
+    { "glBlendEquationi", 0, 0, {0} },
+    { "glBlendEquationSeparatei", 0, 0, {0} },
+    { "glBlendFunci", 0, 0, {0} },
+    { "glBlendFuncSeparatei", 0, 0, {0} },
+    { "glDrawArraysIndirect", 0, 0, {0} },
+    { "glDrawElementsIndirect", 0, 0, {0} },
+    { "glUniform1d", 0, 0, {0} },
+    { "glUniform2d", 0, 0, {0} },
+    { "glUniform3d", 0, 0, {0} },
+    { "glUniform4d", 0, 0, {0} },
+    { "glUniform1dv", 0, 0, {0} },
+    { "glUniform2dv", 0, 0, {0} },
+    { "glUniform3dv", 0, 0, {0} },
+    { "glUniform4dv", 0, 0, {0} },
+    { "glUniformMatrix2dv", 0, 0, {0} },
+    { "glUniformMatrix3dv", 0, 0, {0} },
+    { "glUniformMatrix4dv", 0, 0, {0} },
+    { "glUniformMatrix2x3dv", 0, 0, {0} },
+    { "glUniformMatrix2x4dv", 0, 0, {0} },
+    { "glUniformMatrix3x2dv", 0, 0, {0} },
+    { "glUniformMatrix3x4dv", 0, 0, {0} },
+    { "glUniformMatrix4x2dv", 0, 0, {0} },
+    { "glUniformMatrix4x3dv", 0, 0, {0} },
+    { "glGetUniformdv", 0, 0, {0} },
+    { "glGetSubroutineUniformLocation", 0, 0, {0} },
+    { "glGetSubroutineIndex", 0, 0, {0} },
+    { "glGetActiveSubroutineUniformiv", 0, 0, {0} },
+    { "glGetActiveSubroutineUniformName", 0, 0, {0} },
+    { "glGetActiveSubroutineName", 0, 0, {0} },
+    { "glUniformSubroutinesuiv", 0, 0, {0} },
+    { "glGetUniformSubroutineuiv", 0, 0, {0} },
+    { "glGetProgramStageiv", 0, 0, {0} },
+    { "glPatchParameteri", 0, 0, {0} },
+    { "glPatchParameterfv", 0, 0, {0} },
+    { "glBindTransformFeedback", 0, 0, {0} },
+    { "glDeleteTransformFeedbacks", 0, 0, {0} },
+    { "glGenTransformFeedbacks", 0, 0, {0} },
+    { "glIsTransformFeedback", 0, 0, {0} },
+    { "glPauseTransformFeedback", 0, 0, {0} },
+    { "glResumeTransformFeedback", 0, 0, {0} },
+    { "glDrawTransformFeedback", 0, 0, {0} },
+    { "glDrawTransformFeedbackStream", 0, 0, {0} },
+    { "glBeginQueryIndexed", 0, 0, {0} },
+    { "glEndQueryIndexed", 0, 0, {0} },
+    { "glGetQueryIndexediv", 0, 0, {0} },
+    { "glReleaseShaderCompiler", 0, 0, {0} },
+    { "glShaderBinary", 0, 0, {0} },
+    { "glGetShaderPrecisionFormat", 0, 0, {0} },
+    { "glDepthRangef", 0, 0, {0} },
+    { "glClearDepthf", 0, 0, {0} },
+    { "glGetProgramBinary", 0, 0, {0} },
+    { "glProgramBinary", 0, 0, {0} },
+    { "glProgramParameteri", 0, 0, {0} },
+    { "glUseProgramStages", 0, 0, {0} },
+    { "glActiveShaderProgram", 0, 0, {0} },
+    { "glCreateShaderProgramv", 0, 0, {0} },
+    { "glBindProgramPipeline", 0, 0, {0} },
+    { "glDeleteProgramPipelines", 0, 0, {0} },
+    { "glGenProgramPipelines", 0, 0, {0} },
+    { "glIsProgramPipeline", 0, 0, {0} },
+    { "glGetProgramPipelineiv", 0, 0, {0} },
+    { "glProgramUniform1i", 0, 0, {0} },
+    { "glProgramUniform1iv", 0, 0, {0} },
+    { "glProgramUniform1f", 0, 0, {0} },
+    { "glProgramUniform1fv", 0, 0, {0} },
+    { "glProgramUniform1d", 0, 0, {0} },
+    { "glProgramUniform1dv", 0, 0, {0} },
+    { "glProgramUniform1ui", 0, 0, {0} },
+    { "glProgramUniform1uiv", 0, 0, {0} },
+    { "glProgramUniform2i", 0, 0, {0} },
+    { "glProgramUniform2iv", 0, 0, {0} },
+    { "glProgramUniform2f", 0, 0, {0} },
+    { "glProgramUniform2fv", 0, 0, {0} },
+    { "glProgramUniform2d", 0, 0, {0} },
+    { "glProgramUniform2dv", 0, 0, {0} },
+    { "glProgramUniform2ui", 0, 0, {0} },
+    { "glProgramUniform2uiv", 0, 0, {0} },
+    { "glProgramUniform3i", 0, 0, {0} },
+    { "glProgramUniform3iv", 0, 0, {0} },
+    { "glProgramUniform3f", 0, 0, {0} },
+    { "glProgramUniform3fv", 0, 0, {0} },
+    { "glProgramUniform3d", 0, 0, {0} },
+    { "glProgramUniform3dv", 0, 0, {0} },
+    { "glProgramUniform3ui", 0, 0, {0} },
+    { "glProgramUniform3uiv", 0, 0, {0} },
+    { "glProgramUniform4i", 0, 0, {0} },
+    { "glProgramUniform4iv", 0, 0, {0} },
+    { "glProgramUniform4f", 0, 0, {0} },
+    { "glProgramUniform4fv", 0, 0, {0} },
+    { "glProgramUniform4d", 0, 0, {0} },
+    { "glProgramUniform4dv", 0, 0, {0} },
+    { "glProgramUniform4ui", 0, 0, {0} },
+    { "glProgramUniform4uiv", 0, 0, {0} },
+    { "glProgramUniformMatrix2fv", 0, 0, {0} },
+    { "glProgramUniformMatrix3fv", 0, 0, {0} },
+    { "glProgramUniformMatrix4fv", 0, 0, {0} },
+    { "glProgramUniformMatrix2dv", 0, 0, {0} },
+    { "glProgramUniformMatrix3dv", 0, 0, {0} },
+    { "glProgramUniformMatrix4dv", 0, 0, {0} },
+    { "glProgramUniformMatrix2x3fv", 0, 0, {0} },
+    { "glProgramUniformMatrix3x2fv", 0, 0, {0} },
+    { "glProgramUniformMatrix2x4fv", 0, 0, {0} },
+    { "glProgramUniformMatrix4x2fv", 0, 0, {0} },
+    { "glProgramUniformMatrix3x4fv", 0, 0, {0} },
+    { "glProgramUniformMatrix4x3fv", 0, 0, {0} },
+    { "glProgramUniformMatrix2x3dv", 0, 0, {0} },
+    { "glProgramUniformMatrix3x2dv", 0, 0, {0} },
+    { "glProgramUniformMatrix2x4dv", 0, 0, {0} },
+    { "glProgramUniformMatrix4x2dv", 0, 0, {0} },
+    { "glProgramUniformMatrix3x4dv", 0, 0, {0} },
+    { "glProgramUniformMatrix4x3dv", 0, 0, {0} },
+    { "glValidateProgramPipeline", 0, 0, {0} },
+    { "glGetProgramPipelineInfoLog", 0, 0, {0} },
+    { "glVertexAttribL1d", 0, 0, {0} },
+    { "glVertexAttribL2d", 0, 0, {0} },
+    { "glVertexAttribL3d", 0, 0, {0} },
+    { "glVertexAttribL4d", 0, 0, {0} },
+    { "glVertexAttribL1dv", 0, 0, {0} },
+    { "glVertexAttribL2dv", 0, 0, {0} },
+    { "glVertexAttribL3dv", 0, 0, {0} },
+    { "glVertexAttribL4dv", 0, 0, {0} },
+    { "glVertexAttribLPointer", 0, 0, {0} },
+    { "glGetVertexAttribLdv", 0, 0, {0} },
+    { "glViewportArrayv", 0, 0, {0} },
+    { "glViewportIndexedf", 0, 0, {0} },
+    { "glViewportIndexedfv", 0, 0, {0} },
+    { "glScissorArrayv", 0, 0, {0} },
+    { "glScissorIndexed", 0, 0, {0} },
+    { "glScissorIndexedv", 0, 0, {0} },
+    { "glDepthRangeArrayv", 0, 0, {0} },
+    { "glDepthRangeIndexed", 0, 0, {0} },
+    { "glGetFloati_v", 0, 0, {0} },
+    { "glGetDoublei_v", 0, 0, {0} },
+    { "glDrawArraysInstancedBaseInstance", 0, 0, {0} },
+    { "glDrawElementsInstancedBaseInstance", 0, 0, {0} },
+    { "glDrawElementsInstancedBaseVertexBaseInstance", 0, 0, {0} },
+    { "glGetInternalformativ", 0, 0, {0} },
+    { "glGetActiveAtomicCounterBufferiv", 0, 0, {0} },
+    { "glBindImageTexture", 0, 0, {0} },
+    { "glMemoryBarrier", 0, 0, {0} },
+    { "glTexStorage1D", 0, 0, {0} },
+    { "glTexStorage2D", 0, 0, {0} },
+    { "glTexStorage3D", 0, 0, {0} },
+    { "glDrawTransformFeedbackInstanced", 0, 0, {0} },
+    { "glDrawTransformFeedbackStreamInstanced", 0, 0, {0} },
+    { "glClearBufferData", 0, 0, {0} },
+    { "glClearBufferSubData", 0, 0, {0} },
+    { "glDispatchCompute", 0, 0, {0} },
+    { "glDispatchComputeIndirect", 0, 0, {0} },
+    { "glCopyImageSubData", 0, 0, {0} },
+    { "glFramebufferParameteri", 0, 0, {0} },
+    { "glGetFramebufferParameteriv", 0, 0, {0} },
+    { "glGetInternalformati64v", 0, 0, {0} },
+    { "glInvalidateTexSubImage", 0, 0, {0} },
+    { "glInvalidateTexImage", 0, 0, {0} },
+    { "glInvalidateBufferSubData", 0, 0, {0} },
+    { "glInvalidateBufferData", 0, 0, {0} },
+    { "glInvalidateFramebuffer", 0, 0, {0} },
+    { "glInvalidateSubFramebuffer", 0, 0, {0} },
+    { "glMultiDrawArraysIndirect", 0, 0, {0} },
+    { "glMultiDrawElementsIndirect", 0, 0, {0} },
+    { "glGetProgramInterfaceiv", 0, 0, {0} },
+    { "glGetProgramResourceIndex", 0, 0, {0} },
+    { "glGetProgramResourceName", 0, 0, {0} },
+    { "glGetProgramResourceiv", 0, 0, {0} },
+    { "glGetProgramResourceLocation", 0, 0, {0} },
+    { "glGetProgramResourceLocationIndex", 0, 0, {0} },
+    { "glShaderStorageBlockBinding", 0, 0, {0} },
+    { "glTexBufferRange", 0, 0, {0} },
+    { "glTexStorage2DMultisample", 0, 0, {0} },
+    { "glTexStorage3DMultisample", 0, 0, {0} },
+    { "glTextureView", 0, 0, {0} },
+    { "glBindVertexBuffer", 0, 0, {0} },
+    { "glVertexAttribFormat", 0, 0, {0} },
+    { "glVertexAttribIFormat", 0, 0, {0} },
+    { "glVertexAttribLFormat", 0, 0, {0} },
+    { "glVertexAttribBinding", 0, 0, {0} },
+    { "glVertexBindingDivisor", 0, 0, {0} },
+    { "glDebugMessageControl", 0, 0, {0} },
+    { "glDebugMessageInsert", 0, 0, {0} },
+    { "glDebugMessageCallback", 0, 0, {0} },
+    { "glGetDebugMessageLog", 0, 0, {0} },
+    { "glPushDebugGroup", 0, 0, {0} },
+    { "glPopDebugGroup", 0, 0, {0} },
+    { "glObjectLabel", 0, 0, {0} },
+    { "glGetObjectLabel", 0, 0, {0} },
+    { "glObjectPtrLabel", 0, 0, {0} },
+    { "glGetObjectPtrLabel", 0, 0, {0} },
+    { "glBufferStorage", 0, 0, {0} },
+    { "glClearTexImage", 0, 0, {0} },
+    { "glClearTexSubImage", 0, 0, {0} },
+    { "glBindBuffersBase", 0, 0, {0} },
+    { "glBindBuffersRange", 0, 0, {0} },
+    { "glBindTextures", 0, 0, {0} },
+    { "glBindSamplers", 0, 0, {0} },
+    { "glBindImageTextures", 0, 0, {0} },
+    { "glBindVertexBuffers", 0, 0, {0} },
+    { "glClipControl", 0, 0, {0} },
+    { "glCreateTransformFeedbacks", 0, 0, {0} },
+    { "glTransformFeedbackBufferBase", 0, 0, {0} },
+    { "glTransformFeedbackBufferRange", 0, 0, {0} },
+    { "glGetTransformFeedbackiv", 0, 0, {0} },
+    { "glGetTransformFeedbacki_v", 0, 0, {0} },
+    { "glGetTransformFeedbacki64_v", 0, 0, {0} },
+    { "glCreateBuffers", 0, 0, {0} },
+    { "glNamedBufferStorage", 0, 0, {0} },
+    { "glNamedBufferData", 0, 0, {0} },
+    { "glNamedBufferSubData", 0, 0, {0} },
+    { "glCopyNamedBufferSubData", 0, 0, {0} },
+    { "glClearNamedBufferData", 0, 0, {0} },
+    { "glClearNamedBufferSubData", 0, 0, {0} },
+    { "glMapNamedBuffer", 0, 0, {0} },
+    { "glMapNamedBufferRange", 0, 0, {0} },
+    { "glUnmapNamedBuffer", 0, 0, {0} },
+    { "glFlushMappedNamedBufferRange", 0, 0, {0} },
+    { "glGetNamedBufferParameteriv", 0, 0, {0} },
+    { "glGetNamedBufferParameteri64v", 0, 0, {0} },
+    { "glGetNamedBufferPointerv", 0, 0, {0} },
+    { "glGetNamedBufferSubData", 0, 0, {0} },
+    { "glCreateFramebuffers", 0, 0, {0} },
+    { "glNamedFramebufferRenderbuffer", 0, 0, {0} },
+    { "glNamedFramebufferParameteri", 0, 0, {0} },
+    { "glNamedFramebufferTexture", 0, 0, {0} },
+    { "glNamedFramebufferTextureLayer", 0, 0, {0} },
+    { "glNamedFramebufferDrawBuffer", 0, 0, {0} },
+    { "glNamedFramebufferDrawBuffers", 0, 0, {0} },
+    { "glNamedFramebufferReadBuffer", 0, 0, {0} },
+    { "glInvalidateNamedFramebufferData", 0, 0, {0} },
+    { "glInvalidateNamedFramebufferSubData", 0, 0, {0} },
+    { "glClearNamedFramebufferiv", 0, 0, {0} },
+    { "glClearNamedFramebufferuiv", 0, 0, {0} },
+    { "glClearNamedFramebufferfv", 0, 0, {0} },
+    { "glClearNamedFramebufferfi", 0, 0, {0} },
+    { "glBlitNamedFramebuffer", 0, 0, {0} },
+    { "glCheckNamedFramebufferStatus", 0, 0, {0} },
+    { "glGetNamedFramebufferParameteriv", 0, 0, {0} },
+    { "glGetNamedFramebufferAttachmentParameteriv", 0, 0, {0} },
+    { "glCreateRenderbuffers", 0, 0, {0} },
+    { "glNamedRenderbufferStorage", 0, 0, {0} },
+    { "glNamedRenderbufferStorageMultisample", 0, 0, {0} },
+    { "glGetNamedRenderbufferParameteriv", 0, 0, {0} },
+    { "glCreateTextures", 0, 0, {0} },
+    { "glTextureBuffer", 0, 0, {0} },
+    { "glTextureBufferRange", 0, 0, {0} },
+    { "glTextureStorage1D", 0, 0, {0} },
+    { "glTextureStorage2D", 0, 0, {0} },
+    { "glTextureStorage3D", 0, 0, {0} },
+    { "glTextureStorage2DMultisample", 0, 0, {0} },
+    { "glTextureStorage3DMultisample", 0, 0, {0} },
+    { "glTextureSubImage1D", 0, 0, {0} },
+    { "glTextureSubImage2D", 0, 0, {0} },
+    { "glTextureSubImage3D", 0, 0, {0} },
+    { "glCompressedTextureSubImage1D", 0, 0, {0} },
+    { "glCompressedTextureSubImage2D", 0, 0, {0} },
+    { "glCompressedTextureSubImage3D", 0, 0, {0} },
+    { "glCopyTextureSubImage1D", 0, 0, {0} },
+    { "glCopyTextureSubImage2D", 0, 0, {0} },
+    { "glCopyTextureSubImage3D", 0, 0, {0} },
+    { "glTextureParameterf", 0, 0, {0} },
+    { "glTextureParameterfv", 0, 0, {0} },
+    { "glTextureParameteri", 0, 0, {0} },
+    { "glTextureParameterIiv", 0, 0, {0} },
+    { "glTextureParameterIuiv", 0, 0, {0} },
+    { "glTextureParameteriv", 0, 0, {0} },
+    { "glGenerateTextureMipmap", 0, 0, {0} },
+    { "glBindTextureUnit", 0, 0, {0} },
+    { "glGetTextureImage", 0, 0, {0} },
+    { "glGetCompressedTextureImage", 0, 0, {0} },
+    { "glGetTextureLevelParameterfv", 0, 0, {0} },
+    { "glGetTextureLevelParameteriv", 0, 0, {0} },
+    { "glGetTextureParameterfv", 0, 0, {0} },
+    { "glGetTextureParameterIiv", 0, 0, {0} },
+    { "glGetTextureParameterIuiv", 0, 0, {0} },
+    { "glGetTextureParameteriv", 0, 0, {0} },
+    { "glCreateVertexArrays", 0, 0, {0} },
+    { "glDisableVertexArrayAttrib", 0, 0, {0} },
+    { "glEnableVertexArrayAttrib", 0, 0, {0} },
+    { "glVertexArrayElementBuffer", 0, 0, {0} },
+    { "glVertexArrayVertexBuffer", 0, 0, {0} },
+    { "glVertexArrayVertexBuffers", 0, 0, {0} },
+    { "glVertexArrayAttribBinding", 0, 0, {0} },
+    { "glVertexArrayAttribFormat", 0, 0, {0} },
+    { "glVertexArrayAttribIFormat", 0, 0, {0} },
+    { "glVertexArrayAttribLFormat", 0, 0, {0} },
+    { "glVertexArrayBindingDivisor", 0, 0, {0} },
+    { "glGetVertexArrayiv", 0, 0, {0} },
+    { "glGetVertexArrayIndexediv", 0, 0, {0} },
+    { "glGetVertexArrayIndexed64iv", 0, 0, {0} },
+    { "glCreateSamplers", 0, 0, {0} },
+    { "glCreateProgramPipelines", 0, 0, {0} },
+    { "glCreateQueries", 0, 0, {0} },
+    { "glGetQueryBufferObjecti64v", 0, 0, {0} },
+    { "glGetQueryBufferObjectiv", 0, 0, {0} },
+    { "glGetQueryBufferObjectui64v", 0, 0, {0} },
+    { "glGetQueryBufferObjectuiv", 0, 0, {0} },
+    { "glMemoryBarrierByRegion", 0, 0, {0} },
+    { "glGetTextureSubImage", 0, 0, {0} },
+    { "glGetCompressedTextureSubImage", 0, 0, {0} },
+    { "glGetGraphicsResetStatus", 0, 0, {0} },
+    { "glGetnCompressedTexImage", 0, 0, {0} },
+    { "glGetnTexImage", 0, 0, {0} },
+    { "glGetnUniformdv", 0, 0, {0} },
+    { "glGetnUniformfv", 0, 0, {0} },
+    { "glGetnUniformiv", 0, 0, {0} },
+    { "glGetnUniformuiv", 0, 0, {0} },
+    { "glReadnPixels", 0, 0, {0} },
+    { "glGetnMapdv", 0, 0, {0} },
+    { "glGetnMapfv", 0, 0, {0} },
+    { "glGetnMapiv", 0, 0, {0} },
+    { "glGetnPixelMapfv", 0, 0, {0} },
+    { "glGetnPixelMapuiv", 0, 0, {0} },
+    { "glGetnPixelMapusv", 0, 0, {0} },
+    { "glGetnPolygonStipple", 0, 0, {0} },
+    { "glGetnColorTable", 0, 0, {0} },
+    { "glGetnConvolutionFilter", 0, 0, {0} },
+    { "glGetnSeparableFilter", 0, 0, {0} },
+    { "glGetnHistogram", 0, 0, {0} },
+    { "glGetnMinmax", 0, 0, {0} },
+    { "glTextureBarrier", 0, 0, {0} },
+    { "glSpecializeShader", 0, 0, {0} },
+    { "glMultiDrawArraysIndirectCount", 0, 0, {0} },
+    { "glMultiDrawElementsIndirectCount", 0, 0, {0} },
+    { "glPolygonOffsetClamp", 0, 0, {0} },
+};
+const int glad_trace_entry_count = GLAD_TRACE_ENTRY_POINTS;
+
+static PFNGLCULLFACEPROC glad_trace_real_glCullFace;
+static void APIENTRY glad_trace_glCullFace(GLenum mode) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glCullFace(mode);
+    glad_trace_record(0, glad_start);
+}
+static PFNGLFRONTFACEPROC glad_trace_real_glFrontFace;
+static void APIENTRY glad_trace_glFrontFace(GLenum mode) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glFrontFace(mode);
+    glad_trace_record(1, glad_start);
+}
+static PFNGLHINTPROC glad_trace_real_glHint;
+static void APIENTRY glad_trace_glHint(GLenum target, GLenum mode) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glHint(target, mode);
+    glad_trace_record(2, glad_start);
+}
+static PFNGLLINEWIDTHPROC glad_trace_real_glLineWidth;
+static void APIENTRY glad_trace_glLineWidth(GLfloat width) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glLineWidth(width);
+    glad_trace_record(3, glad_start);
+}
+static PFNGLPOINTSIZEPROC glad_trace_real_glPointSize;
+static void APIENTRY glad_trace_glPointSize(GLfloat size) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glPointSize(size);
+    glad_trace_record(4, glad_start);
+}
+static PFNGLPOLYGONMODEPROC glad_trace_real_glPolygonMode;
+static void APIENTRY glad_trace_glPolygonMode(GLenum face, GLenum mode) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glPolygonMode(face, mode);
+    glad_trace_record(5, glad_start);
+}
+static PFNGLSCISSORPROC glad_trace_real_glScissor;
+static void APIENTRY glad_trace_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glScissor(x, y, width, height);
+    glad_trace_record(6, glad_start);
+}
+static PFNGLTEXPARAMETERFPROC glad_trace_real_glTexParameterf;
+static void APIENTRY glad_trace_glTexParameterf(GLenum target, GLenum pname, GLfloat param) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexParameterf(target, pname, param);
+    glad_trace_record(7, glad_start);
+}
+static PFNGLTEXPARAMETERFVPROC glad_trace_real_glTexParameterfv;
+static void APIENTRY glad_trace_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexParameterfv(target, pname, params);
+    glad_trace_record(8, glad_start);
+}
+static PFNGLTEXPARAMETERIPROC glad_trace_real_glTexParameteri;
+static void APIENTRY glad_trace_glTexParameteri(GLenum target, GLenum pname, GLint param) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexParameteri(target, pname, param);
+    glad_trace_record(9, glad_start);
+}
+static PFNGLTEXPARAMETERIVPROC glad_trace_real_glTexParameteriv;
+static void APIENTRY glad_trace_glTexParameteriv(GLenum target, GLenum pname, const GLint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexParameteriv(target, pname, params);
+    glad_trace_record(10, glad_start);
+}
+static PFNGLTEXIMAGE1DPROC glad_trace_real_glTexImage1D;
+static void APIENTRY glad_trace_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexImage1D(target, level, internalformat, width, border, format, type, pixels);
+    glad_trace_record(11, glad_start);
+}
+static PFNGLTEXIMAGE2DPROC glad_trace_real_glTexImage2D;
+static void APIENTRY glad_trace_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+    glad_trace_record(12, glad_start);
+}
+static PFNGLDRAWBUFFERPROC glad_trace_real_glDrawBuffer;
+static void APIENTRY glad_trace_glDrawBuffer(GLenum buf) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDrawBuffer(buf);
+    glad_trace_record(13, glad_start);
+}
+static PFNGLCLEARPROC glad_trace_real_glClear;
+static void APIENTRY glad_trace_glClear(GLbitfield mask) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glClear(mask);
+    glad_trace_record(14, glad_start);
+}
+static PFNGLCLEARCOLORPROC glad_trace_real_glClearColor;
+static void APIENTRY glad_trace_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glClearColor(red, green, blue, alpha);
+    glad_trace_record(15, glad_start);
+}
+static PFNGLCLEARSTENCILPROC glad_trace_real_glClearStencil;
+static void APIENTRY glad_trace_glClearStencil(GLint s) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glClearStencil(s);
+    glad_trace_record(16, glad_start);
+}
+static PFNGLCLEARDEPTHPROC glad_trace_real_glClearDepth;
+static void APIENTRY glad_trace_glClearDepth(GLdouble depth) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glClearDepth(depth);
+    glad_trace_record(17, glad_start);
+}
+static PFNGLSTENCILMASKPROC glad_trace_real_glStencilMask;
+static void APIENTRY glad_trace_glStencilMask(GLuint mask) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glStencilMask(mask);
+    glad_trace_record(18, glad_start);
+}
+static PFNGLCOLORMASKPROC glad_trace_real_glColorMask;
+static void APIENTRY glad_trace_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glColorMask(red, green, blue, alpha);
+    glad_trace_record(19, glad_start);
+}
+static PFNGLDEPTHMASKPROC glad_trace_real_glDepthMask;
+static void APIENTRY glad_trace_glDepthMask(GLboolean flag) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDepthMask(flag);
+    glad_trace_record(20, glad_start);
+}
+static PFNGLDISABLEPROC glad_trace_real_glDisable;
+static void APIENTRY glad_trace_glDisable(GLenum cap) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDisable(cap);
+    glad_trace_record(21, glad_start);
+}
+static PFNGLENABLEPROC glad_trace_real_glEnable;
+static void APIENTRY glad_trace_glEnable(GLenum cap) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glEnable(cap);
+    glad_trace_record(22, glad_start);
+}
+static PFNGLFINISHPROC glad_trace_real_glFinish;
+static void APIENTRY glad_trace_glFinish(void) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glFinish();
+    glad_trace_record(23, glad_start);
+}
+static PFNGLFLUSHPROC glad_trace_real_glFlush;
+static void APIENTRY glad_trace_glFlush(void) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glFlush();
+    glad_trace_record(24, glad_start);
+}
+static PFNGLBLENDFUNCPROC glad_trace_real_glBlendFunc;
+static void APIENTRY glad_trace_glBlendFunc(GLenum sfactor, GLenum dfactor) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glBlendFunc(sfactor, dfactor);
+    glad_trace_record(25, glad_start);
+}
+static PFNGLLOGICOPPROC glad_trace_real_glLogicOp;
+static void APIENTRY glad_trace_glLogicOp(GLenum opcode) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glLogicOp(opcode);
+    glad_trace_record(26, glad_start);
+}
+static PFNGLSTENCILFUNCPROC glad_trace_real_glStencilFunc;
+static void APIENTRY glad_trace_glStencilFunc(GLenum func, GLint ref, GLuint mask) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glStencilFunc(func, ref, mask);
+    glad_trace_record(27, glad_start);
+}
+static PFNGLSTENCILOPPROC glad_trace_real_glStencilOp;
+static void APIENTRY glad_trace_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glStencilOp(fail, zfail, zpass);
+    glad_trace_record(28, glad_start);
+}
+static PFNGLDEPTHFUNCPROC glad_trace_real_glDepthFunc;
+static void APIENTRY glad_trace_glDepthFunc(GLenum func) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDepthFunc(func);
+    glad_trace_record(29, glad_start);
+}
+static PFNGLPIXELSTOREFPROC glad_trace_real_glPixelStoref;
+static void APIENTRY glad_trace_glPixelStoref(GLenum pname, GLfloat param) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glPixelStoref(pname, param);
+    glad_trace_record(30, glad_start);
+}
+static PFNGLPIXELSTOREIPROC glad_trace_real_glPixelStorei;
+static void APIENTRY glad_trace_glPixelStorei(GLenum pname, GLint param) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glPixelStorei(pname, param);
+    glad_trace_record(31, glad_start);
+}
+static PFNGLREADBUFFERPROC glad_trace_real_glReadBuffer;
+static void APIENTRY glad_trace_glReadBuffer(GLenum src) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glReadBuffer(src);
+    glad_trace_record(32, glad_start);
+}
+static PFNGLREADPIXELSPROC glad_trace_real_glReadPixels;
+static void APIENTRY glad_trace_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glReadPixels(x, y, width, height, format, type, pixels);
+    glad_trace_record(33, glad_start);
+}
+static PFNGLGETBOOLEANVPROC glad_trace_real_glGetBooleanv;
+static void APIENTRY glad_trace_glGetBooleanv(GLenum pname, GLboolean *data) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetBooleanv(pname, data);
+    glad_trace_record(34, glad_start);
+}
+static PFNGLGETDOUBLEVPROC glad_trace_real_glGetDoublev;
+static void APIENTRY glad_trace_glGetDoublev(GLenum pname, GLdouble *data) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetDoublev(pname, data);
+    glad_trace_record(35, glad_start);
+}
+static GLenum APIENTRY glad_trace_glGetError(void) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    GLenum glad_result = glad_trace_real_glGetError();
+    glad_trace_record(36, glad_start);
+    return glad_result;
+}
+static PFNGLGETFLOATVPROC glad_trace_real_glGetFloatv;
+static void APIENTRY glad_trace_glGetFloatv(GLenum pname, GLfloat *data) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetFloatv(pname, data);
+    glad_trace_record(37, glad_start);
+}
+static PFNGLGETINTEGERVPROC glad_trace_real_glGetIntegerv;
+static void APIENTRY glad_trace_glGetIntegerv(GLenum pname, GLint *data) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetIntegerv(pname, data);
+    glad_trace_record(38, glad_start);
+}
+static PFNGLGETSTRINGPROC glad_trace_real_glGetString;
+static const GLubyte * APIENTRY glad_trace_glGetString(GLenum name) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    const GLubyte * glad_result = glad_trace_real_glGetString(name);
+    glad_trace_record(39, glad_start);
+    return glad_result;
+}
+static PFNGLGETTEXIMAGEPROC glad_trace_real_glGetTexImage;
+static void APIENTRY glad_trace_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetTexImage(target, level, format, type, pixels);
+    glad_trace_record(40, glad_start);
+}
+static PFNGLGETTEXPARAMETERFVPROC glad_trace_real_glGetTexParameterfv;
+static void APIENTRY glad_trace_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetTexParameterfv(target, pname, params);
+    glad_trace_record(41, glad_start);
+}
+static PFNGLGETTEXPARAMETERIVPROC glad_trace_real_glGetTexParameteriv;
+static void APIENTRY glad_trace_glGetTexParameteriv(GLenum target, GLenum pname, GLint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetTexParameteriv(target, pname, params);
+    glad_trace_record(42, glad_start);
+}
+static PFNGLGETTEXLEVELPARAMETERFVPROC glad_trace_real_glGetTexLevelParameterfv;
+static void APIENTRY glad_trace_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetTexLevelParameterfv(target, level, pname, params);
+    glad_trace_record(43, glad_start);
+}
+static PFNGLGETTEXLEVELPARAMETERIVPROC glad_trace_real_glGetTexLevelParameteriv;
+static void APIENTRY glad_trace_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetTexLevelParameteriv(target, level, pname, params);
+    glad_trace_record(44, glad_start);
+}
+static PFNGLISENABLEDPROC glad_trace_real_glIsEnabled;
+static GLboolean APIENTRY glad_trace_glIsEnabled(GLenum cap) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    GLboolean glad_result = glad_trace_real_glIsEnabled(cap);
+    glad_trace_record(45, glad_start);
+    return glad_result;
+}
+static PFNGLDEPTHRANGEPROC glad_trace_real_glDepthRange;
+static void APIENTRY glad_trace_glDepthRange(GLdouble n, GLdouble f) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDepthRange(n, f);
+    glad_trace_record(46, glad_start);
+}
+static PFNGLVIEWPORTPROC glad_trace_real_glViewport;
+static void APIENTRY glad_trace_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glViewport(x, y, width, height);
+    glad_trace_record(47, glad_start);
+}
+static PFNGLNEWLISTPROC glad_trace_real_glNewList;
+static void APIENTRY glad_trace_glNewList(GLuint list, GLenum mode) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glNewList(list, mode);
+    glad_trace_record(48, glad_start);
+}
+static PFNGLENDLISTPROC glad_trace_real_glEndList;
+static void APIENTRY glad_trace_glEndList(void) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glEndList();
+    glad_trace_record(49, glad_start);
+}
+static PFNGLCALLLISTPROC glad_trace_real_glCallList;
+static void APIENTRY glad_trace_glCallList(GLuint list) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glCallList(list);
+    glad_trace_record(50, glad_start);
+}
+static PFNGLCALLLISTSPROC glad_trace_real_glCallLists;
+static void APIENTRY glad_trace_glCallLists(GLsizei n, GLenum type, const void *lists) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glCallLists(n, type, lists);
+    glad_trace_record(51, glad_start);
+}
+static PFNGLDELETELISTSPROC glad_trace_real_glDeleteLists;
+static void APIENTRY glad_trace_glDeleteLists(GLuint list, GLsizei range) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDeleteLists(list, range);
+    glad_trace_record(52, glad_start);
+}
+static PFNGLGENLISTSPROC glad_trace_real_glGenLists;
+static GLuint APIENTRY glad_trace_glGenLists(GLsizei range) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    GLuint glad_result = glad_trace_real_glGenLists(range);
+    glad_trace_record(53, glad_start);
+    return glad_result;
+}
+static PFNGLLISTBASEPROC glad_trace_real_glListBase;
+static void APIENTRY glad_trace_glListBase(GLuint base) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glListBase(base);
+    glad_trace_record(54, glad_start);
+}
+static PFNGLBEGINPROC glad_trace_real_glBegin;
+static void APIENTRY glad_trace_glBegin(GLenum mode) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glBegin(mode);
+    glad_trace_record(55, glad_start);
+}
+static PFNGLBITMAPPROC glad_trace_real_glBitmap;
+static void APIENTRY glad_trace_glBitmap(GLsizei width, GLsizei height, GLfloat xorig, GLfloat yorig, GLfloat xmove, GLfloat ymove, const GLubyte *bitmap) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glBitmap(width, height, xorig, yorig, xmove, ymove, bitmap);
+    glad_trace_record(56, glad_start);
+}
+static PFNGLCOLOR3BPROC glad_trace_real_glColor3b;
+static void APIENTRY glad_trace_glColor3b(GLbyte red, GLbyte green, GLbyte blue) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glColor3b(red, green, blue);
+    glad_trace_record(57, glad_start);
+}
+static PFNGLCOLOR3BVPROC glad_trace_real_glColor3bv;
+static void APIENTRY glad_trace_glColor3bv(const GLbyte *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glColor3bv(v);
+    glad_trace_record(58, glad_start);
+}
+static PFNGLCOLOR3DPROC glad_trace_real_glColor3d;
+static void APIENTRY glad_trace_glColor3d(GLdouble red, GLdouble green, GLdouble blue) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glColor3d(red, green, blue);
+    glad_trace_record(59, glad_start);
+}
+static PFNGLCOLOR3DVPROC glad_trace_real_glColor3dv;
+static void APIENTRY glad_trace_glColor3dv(const GLdouble *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glColor3dv(v);
+    glad_trace_record(60, glad_start);
+}
+static PFNGLCOLOR3FPROC glad_trace_real_glColor3f;
+static void APIENTRY glad_trace_glColor3f(GLfloat red, GLfloat green, GLfloat blue) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glColor3f(red, green, blue);
+    glad_trace_record(61, glad_start);
+}
+static PFNGLCOLOR3FVPROC glad_trace_real_glColor3fv;
+static void APIENTRY glad_trace_glColor3fv(const GLfloat *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glColor3fv(v);
+    glad_trace_record(62, glad_start);
+}
+static PFNGLCOLOR3IPROC glad_trace_real_glColor3i;
+static void APIENTRY glad_trace_glColor3i(GLint red, GLint green, GLint blue) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glColor3i(red, green, blue);
+    glad_trace_record(63, glad_start);
+}
+static PFNGLCOLOR3IVPROC glad_trace_real_glColor3iv;
+static void APIENTRY glad_trace_glColor3iv(const GLint *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glColor3iv(v);
+    glad_trace_record(64, glad_start);
+}
+static PFNGLCOLOR3SPROC glad_trace_real_glColor3s;
+static void APIENTRY glad_trace_glColor3s(GLshort red, GLshort green, GLshort blue) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glColor3s(red, green, blue);
+    glad_trace_record(65, glad_start);
+}
+static PFNGLCOLOR3SVPROC glad_trace_real_glColor3sv;
+static void APIENTRY glad_trace_glColor3sv(const GLshort *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glColor3sv(v);
+    glad_trace_record(66, glad_start);
+}
+static PFNGLCOLOR3UBPROC glad_trace_real_glColor3ub;
+static void APIENTRY glad_trace_glColor3ub(GLubyte red, GLubyte green, GLubyte blue) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glColor3ub(red, green, blue);
+    glad_trace_record(67, glad_start);
+}
+static PFNGLCOLOR3UBVPROC glad_trace_real_glColor3ubv;
+static void APIENTRY glad_trace_glColor3ubv(const GLubyte *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glColor3ubv(v);
+    glad_trace_record(68, glad_start);
+}
+static PFNGLCOLOR3UIPROC glad_trace_real_glColor3ui;
+static void APIENTRY glad_trace_glColor3ui(GLuint red, GLuint green, GLuint blue) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glColor3ui(red, green, blue);
+    glad_trace_record(69, glad_start);
+}
+static PFNGLCOLOR3UIVPROC glad_trace_real_glColor3uiv;
+static void APIENTRY glad_trace_glColor3uiv(const GLuint *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glColor3uiv(v);
+    glad_trace_record(70, glad_start);
+}
+static PFNGLCOLOR3USPROC glad_trace_real_glColor3us;
+static void APIENTRY glad_trace_glColor3us(GLushort red, GLushort green, GLushort blue) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glColor3us(red, green, blue);
+    glad_trace_record(71, glad_start);
+}
+static PFNGLCOLOR3USVPROC glad_trace_real_glColor3usv;
+static void APIENTRY glad_trace_glColor3usv(const GLushort *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glColor3usv(v);
+    glad_trace_record(72, glad_start);
+}
+static PFNGLCOLOR4BPROC glad_trace_real_glColor4b;
+static void APIENTRY glad_trace_glColor4b(GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glColor4b(red, green, blue, alpha);
+    glad_trace_record(73, glad_start);
+}
+static PFNGLCOLOR4BVPROC glad_trace_real_glColor4bv;
+static void APIENTRY glad_trace_glColor4bv(const GLbyte *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glColor4bv(v);
+    glad_trace_record(74, glad_start);
+}
+static PFNGLCOLOR4DPROC glad_trace_real_glColor4d;
+static void APIENTRY glad_trace_glColor4d(GLdouble red, GLdouble green, GLdouble blue, GLdouble alpha) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glColor4d(red, green, blue, alpha);
+    glad_trace_record(75, glad_start);
+}
+static PFNGLCOLOR4DVPROC glad_trace_real_glColor4dv;
+static void APIENTRY glad_trace_glColor4dv(const GLdouble *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glColor4dv(v);
+    glad_trace_record(76, glad_start);
+}
+static PFNGLCOLOR4FPROC glad_trace_real_glColor4f;
+static void APIENTRY glad_trace_glColor4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glColor4f(red, green, blue, alpha);
+    glad_trace_record(77, glad_start);
+}
+static PFNGLCOLOR4FVPROC glad_trace_real_glColor4fv;
+static void APIENTRY glad_trace_glColor4fv(const GLfloat *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glColor4fv(v);
+    glad_trace_record(78, glad_start);
+}
+static PFNGLCOLOR4IPROC glad_trace_real_glColor4i;
+static void APIENTRY glad_trace_glColor4i(GLint red, GLint green, GLint blue, GLint alpha) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glColor4i(red, green, blue, alpha);
+    glad_trace_record(79, glad_start);
+}
+static PFNGLCOLOR4IVPROC glad_trace_real_glColor4iv;
+static void APIENTRY glad_trace_glColor4iv(const GLint *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glColor4iv(v);
+    glad_trace_record(80, glad_start);
+}
+static PFNGLCOLOR4SPROC glad_trace_real_glColor4s;
+static void APIENTRY glad_trace_glColor4s(GLshort red, GLshort green, GLshort blue, GLshort alpha) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glColor4s(red, green, blue, alpha);
+    glad_trace_record(81, glad_start);
+}
+static PFNGLCOLOR4SVPROC glad_trace_real_glColor4sv;
+static void APIENTRY glad_trace_glColor4sv(const GLshort *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glColor4sv(v);
+    glad_trace_record(82, glad_start);
+}
+static PFNGLCOLOR4UBPROC glad_trace_real_glColor4ub;
+static void APIENTRY glad_trace_glColor4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glColor4ub(red, green, blue, alpha);
+    glad_trace_record(83, glad_start);
+}
+static PFNGLCOLOR4UBVPROC glad_trace_real_glColor4ubv;
+static void APIENTRY glad_trace_glColor4ubv(const GLubyte *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glColor4ubv(v);
+    glad_trace_record(84, glad_start);
+}
+static PFNGLCOLOR4UIPROC glad_trace_real_glColor4ui;
+static void APIENTRY glad_trace_glColor4ui(GLuint red, GLuint green, GLuint blue, GLuint alpha) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glColor4ui(red, green, blue, alpha);
+    glad_trace_record(85, glad_start);
+}
+static PFNGLCOLOR4UIVPROC glad_trace_real_glColor4uiv;
+static void APIENTRY glad_trace_glColor4uiv(const GLuint *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glColor4uiv(v);
+    glad_trace_record(86, glad_start);
+}
+static PFNGLCOLOR4USPROC glad_trace_real_glColor4us;
+static void APIENTRY glad_trace_glColor4us(GLushort red, GLushort green, GLushort blue, GLushort alpha) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glColor4us(red, green, blue, alpha);
+    glad_trace_record(87, glad_start);
+}
+static PFNGLCOLOR4USVPROC glad_trace_real_glColor4usv;
+static void APIENTRY glad_trace_glColor4usv(const GLushort *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glColor4usv(v);
+    glad_trace_record(88, glad_start);
+}
+static PFNGLEDGEFLAGPROC glad_trace_real_glEdgeFlag;
+static void APIENTRY glad_trace_glEdgeFlag(GLboolean flag) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glEdgeFlag(flag);
+    glad_trace_record(89, glad_start);
+}
+static PFNGLEDGEFLAGVPROC glad_trace_real_glEdgeFlagv;
+static void APIENTRY glad_trace_glEdgeFlagv(const GLboolean *flag) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glEdgeFlagv(flag);
+    glad_trace_record(90, glad_start);
+}
+static PFNGLENDPROC glad_trace_real_glEnd;
+static void APIENTRY glad_trace_glEnd(void) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glEnd();
+    glad_trace_record(91, glad_start);
+}
+static PFNGLINDEXDPROC glad_trace_real_glIndexd;
+static void APIENTRY glad_trace_glIndexd(GLdouble c) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glIndexd(c);
+    glad_trace_record(92, glad_start);
+}
+static PFNGLINDEXDVPROC glad_trace_real_glIndexdv;
+static void APIENTRY glad_trace_glIndexdv(const GLdouble *c) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glIndexdv(c);
+    glad_trace_record(93, glad_start);
+}
+static PFNGLINDEXFPROC glad_trace_real_glIndexf;
+static void APIENTRY glad_trace_glIndexf(GLfloat c) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glIndexf(c);
+    glad_trace_record(94, glad_start);
+}
+static PFNGLINDEXFVPROC glad_trace_real_glIndexfv;
+static void APIENTRY glad_trace_glIndexfv(const GLfloat *c) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glIndexfv(c);
+    glad_trace_record(95, glad_start);
+}
+static PFNGLINDEXIPROC glad_trace_real_glIndexi;
+static void APIENTRY glad_trace_glIndexi(GLint c) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glIndexi(c);
+    glad_trace_record(96, glad_start);
+}
+static PFNGLINDEXIVPROC glad_trace_real_glIndexiv;
+static void APIENTRY glad_trace_glIndexiv(const GLint *c) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glIndexiv(c);
+    glad_trace_record(97, glad_start);
+}
+static PFNGLINDEXSPROC glad_trace_real_glIndexs;
+static void APIENTRY glad_trace_glIndexs(GLshort c) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glIndexs(c);
+    glad_trace_record(98, glad_start);
+}
+static PFNGLINDEXSVPROC glad_trace_real_glIndexsv;
+static void APIENTRY glad_trace_glIndexsv(const GLshort *c) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glIndexsv(c);
+    glad_trace_record(99, glad_start);
+}
+static PFNGLNORMAL3BPROC glad_trace_real_glNormal3b;
+static void APIENTRY glad_trace_glNormal3b(GLbyte nx, GLbyte ny, GLbyte nz) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glNormal3b(nx, ny, nz);
+    glad_trace_record(100, glad_start);
+}
+static PFNGLNORMAL3BVPROC glad_trace_real_glNormal3bv;
+static void APIENTRY glad_trace_glNormal3bv(const GLbyte *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glNormal3bv(v);
+    glad_trace_record(101, glad_start);
+}
+static PFNGLNORMAL3DPROC glad_trace_real_glNormal3d;
+static void APIENTRY glad_trace_glNormal3d(GLdouble nx, GLdouble ny, GLdouble nz) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glNormal3d(nx, ny, nz);
+    glad_trace_record(102, glad_start);
+}
+static PFNGLNORMAL3DVPROC glad_trace_real_glNormal3dv;
+static void APIENTRY glad_trace_glNormal3dv(const GLdouble *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glNormal3dv(v);
+    glad_trace_record(103, glad_start);
+}
+static PFNGLNORMAL3FPROC glad_trace_real_glNormal3f;
+static void APIENTRY glad_trace_glNormal3f(GLfloat nx, GLfloat ny, GLfloat nz) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glNormal3f(nx, ny, nz);
+    glad_trace_record(104, glad_start);
+}
+static PFNGLNORMAL3FVPROC glad_trace_real_glNormal3fv;
+static void APIENTRY glad_trace_glNormal3fv(const GLfloat *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glNormal3fv(v);
+    glad_trace_record(105, glad_start);
+}
+static PFNGLNORMAL3IPROC glad_trace_real_glNormal3i;
+static void APIENTRY glad_trace_glNormal3i(GLint nx, GLint ny, GLint nz) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glNormal3i(nx, ny, nz);
+    glad_trace_record(106, glad_start);
+}
+static PFNGLNORMAL3IVPROC glad_trace_real_glNormal3iv;
+static void APIENTRY glad_trace_glNormal3iv(const GLint *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glNormal3iv(v);
+    glad_trace_record(107, glad_start);
+}
+static PFNGLNORMAL3SPROC glad_trace_real_glNormal3s;
+static void APIENTRY glad_trace_glNormal3s(GLshort nx, GLshort ny, GLshort nz) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glNormal3s(nx, ny, nz);
+    glad_trace_record(108, glad_start);
+}
+static PFNGLNORMAL3SVPROC glad_trace_real_glNormal3sv;
+static void APIENTRY glad_trace_glNormal3sv(const GLshort *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glNormal3sv(v);
+    glad_trace_record(109, glad_start);
+}
+static PFNGLRASTERPOS2DPROC glad_trace_real_glRasterPos2d;
+static void APIENTRY glad_trace_glRasterPos2d(GLdouble x, GLdouble y) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glRasterPos2d(x, y);
+    glad_trace_record(110, glad_start);
+}
+static PFNGLRASTERPOS2DVPROC glad_trace_real_glRasterPos2dv;
+static void APIENTRY glad_trace_glRasterPos2dv(const GLdouble *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glRasterPos2dv(v);
+    glad_trace_record(111, glad_start);
+}
+static PFNGLRASTERPOS2FPROC glad_trace_real_glRasterPos2f;
+static void APIENTRY glad_trace_glRasterPos2f(GLfloat x, GLfloat y) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glRasterPos2f(x, y);
+    glad_trace_record(112, glad_start);
+}
+static PFNGLRASTERPOS2FVPROC glad_trace_real_glRasterPos2fv;
+static void APIENTRY glad_trace_glRasterPos2fv(const GLfloat *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glRasterPos2fv(v);
+    glad_trace_record(113, glad_start);
+}
+static PFNGLRASTERPOS2IPROC glad_trace_real_glRasterPos2i;
+static void APIENTRY glad_trace_glRasterPos2i(GLint x, GLint y) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glRasterPos2i(x, y);
+    glad_trace_record(114, glad_start);
+}
+static PFNGLRASTERPOS2IVPROC glad_trace_real_glRasterPos2iv;
+static void APIENTRY glad_trace_glRasterPos2iv(const GLint *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glRasterPos2iv(v);
+    glad_trace_record(115, glad_start);
+}
+static PFNGLRASTERPOS2SPROC glad_trace_real_glRasterPos2s;
+static void APIENTRY glad_trace_glRasterPos2s(GLshort x, GLshort y) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glRasterPos2s(x, y);
+    glad_trace_record(116, glad_start);
+}
+static PFNGLRASTERPOS2SVPROC glad_trace_real_glRasterPos2sv;
+static void APIENTRY glad_trace_glRasterPos2sv(const GLshort *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glRasterPos2sv(v);
+    glad_trace_record(117, glad_start);
+}
+static PFNGLRASTERPOS3DPROC glad_trace_real_glRasterPos3d;
+static void APIENTRY glad_trace_glRasterPos3d(GLdouble x, GLdouble y, GLdouble z) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glRasterPos3d(x, y, z);
+    glad_trace_record(118, glad_start);
+}
+static PFNGLRASTERPOS3DVPROC glad_trace_real_glRasterPos3dv;
+static void APIENTRY glad_trace_glRasterPos3dv(const GLdouble *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glRasterPos3dv(v);
+    glad_trace_record(119, glad_start);
+}
+static PFNGLRASTERPOS3FPROC glad_trace_real_glRasterPos3f;
+static void APIENTRY glad_trace_glRasterPos3f(GLfloat x, GLfloat y, GLfloat z) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glRasterPos3f(x, y, z);
+    glad_trace_record(120, glad_start);
+}
+static PFNGLRASTERPOS3FVPROC glad_trace_real_glRasterPos3fv;
+static void APIENTRY glad_trace_glRasterPos3fv(const GLfloat *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glRasterPos3fv(v);
+    glad_trace_record(121, glad_start);
+}
+static PFNGLRASTERPOS3IPROC glad_trace_real_glRasterPos3i;
+static void APIENTRY glad_trace_glRasterPos3i(GLint x, GLint y, GLint z) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glRasterPos3i(x, y, z);
+    glad_trace_record(122, glad_start);
+}
+static PFNGLRASTERPOS3IVPROC glad_trace_real_glRasterPos3iv;
+static void APIENTRY glad_trace_glRasterPos3iv(const GLint *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glRasterPos3iv(v);
+    glad_trace_record(123, glad_start);
+}
+static PFNGLRASTERPOS3SPROC glad_trace_real_glRasterPos3s;
+static void APIENTRY glad_trace_glRasterPos3s(GLshort x, GLshort y, GLshort z) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glRasterPos3s(x, y, z);
+    glad_trace_record(124, glad_start);
+}
+static PFNGLRASTERPOS3SVPROC glad_trace_real_glRasterPos3sv;
+static void APIENTRY glad_trace_glRasterPos3sv(const GLshort *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glRasterPos3sv(v);
+    glad_trace_record(125, glad_start);
+}
+static PFNGLRASTERPOS4DPROC glad_trace_real_glRasterPos4d;
+static void APIENTRY glad_trace_glRasterPos4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glRasterPos4d(x, y, z, w);
+    glad_trace_record(126, glad_start);
+}
+static PFNGLRASTERPOS4DVPROC glad_trace_real_glRasterPos4dv;
+static void APIENTRY glad_trace_glRasterPos4dv(const GLdouble *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glRasterPos4dv(v);
+    glad_trace_record(127, glad_start);
+}
+static PFNGLRASTERPOS4FPROC glad_trace_real_glRasterPos4f;
+static void APIENTRY glad_trace_glRasterPos4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glRasterPos4f(x, y, z, w);
+    glad_trace_record(128, glad_start);
+}
+static PFNGLRASTERPOS4FVPROC glad_trace_real_glRasterPos4fv;
+static void APIENTRY glad_trace_glRasterPos4fv(const GLfloat *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glRasterPos4fv(v);
+    glad_trace_record(129, glad_start);
+}
+static PFNGLRASTERPOS4IPROC glad_trace_real_glRasterPos4i;
+static void APIENTRY glad_trace_glRasterPos4i(GLint x, GLint y, GLint z, GLint w) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glRasterPos4i(x, y, z, w);
+    glad_trace_record(130, glad_start);
+}
+static PFNGLRASTERPOS4IVPROC glad_trace_real_glRasterPos4iv;
+static void APIENTRY glad_trace_glRasterPos4iv(const GLint *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glRasterPos4iv(v);
+    glad_trace_record(131, glad_start);
+}
+static PFNGLRASTERPOS4SPROC glad_trace_real_glRasterPos4s;
+static void APIENTRY glad_trace_glRasterPos4s(GLshort x, GLshort y, GLshort z, GLshort w) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glRasterPos4s(x, y, z, w);
+    glad_trace_record(132, glad_start);
+}
+static PFNGLRASTERPOS4SVPROC glad_trace_real_glRasterPos4sv;
+static void APIENTRY glad_trace_glRasterPos4sv(const GLshort *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glRasterPos4sv(v);
+    glad_trace_record(133, glad_start);
+}
+static PFNGLRECTDPROC glad_trace_real_glRectd;
+static void APIENTRY glad_trace_glRectd(GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glRectd(x1, y1, x2, y2);
+    glad_trace_record(134, glad_start);
+}
+static PFNGLRECTDVPROC glad_trace_real_glRectdv;
+static void APIENTRY glad_trace_glRectdv(const GLdouble *v1, const GLdouble *v2) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glRectdv(v1, v2);
+    glad_trace_record(135, glad_start);
+}
+static PFNGLRECTFPROC glad_trace_real_glRectf;
+static void APIENTRY glad_trace_glRectf(GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glRectf(x1, y1, x2, y2);
+    glad_trace_record(136, glad_start);
+}
+static PFNGLRECTFVPROC glad_trace_real_glRectfv;
+static void APIENTRY glad_trace_glRectfv(const GLfloat *v1, const GLfloat *v2) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glRectfv(v1, v2);
+    glad_trace_record(137, glad_start);
+}
+static PFNGLRECTIPROC glad_trace_real_glRecti;
+static void APIENTRY glad_trace_glRecti(GLint x1, GLint y1, GLint x2, GLint y2) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glRecti(x1, y1, x2, y2);
+    glad_trace_record(138, glad_start);
+}
+static PFNGLRECTIVPROC glad_trace_real_glRectiv;
+static void APIENTRY glad_trace_glRectiv(const GLint *v1, const GLint *v2) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glRectiv(v1, v2);
+    glad_trace_record(139, glad_start);
+}
+static PFNGLRECTSPROC glad_trace_real_glRects;
+static void APIENTRY glad_trace_glRects(GLshort x1, GLshort y1, GLshort x2, GLshort y2) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glRects(x1, y1, x2, y2);
+    glad_trace_record(140, glad_start);
+}
+static PFNGLRECTSVPROC glad_trace_real_glRectsv;
+static void APIENTRY glad_trace_glRectsv(const GLshort *v1, const GLshort *v2) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glRectsv(v1, v2);
+    glad_trace_record(141, glad_start);
+}
+static PFNGLTEXCOORD1DPROC glad_trace_real_glTexCoord1d;
+static void APIENTRY glad_trace_glTexCoord1d(GLdouble s) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexCoord1d(s);
+    glad_trace_record(142, glad_start);
+}
+static PFNGLTEXCOORD1DVPROC glad_trace_real_glTexCoord1dv;
+static void APIENTRY glad_trace_glTexCoord1dv(const GLdouble *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexCoord1dv(v);
+    glad_trace_record(143, glad_start);
+}
+static PFNGLTEXCOORD1FPROC glad_trace_real_glTexCoord1f;
+static void APIENTRY glad_trace_glTexCoord1f(GLfloat s) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexCoord1f(s);
+    glad_trace_record(144, glad_start);
+}
+static PFNGLTEXCOORD1FVPROC glad_trace_real_glTexCoord1fv;
+static void APIENTRY glad_trace_glTexCoord1fv(const GLfloat *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexCoord1fv(v);
+    glad_trace_record(145, glad_start);
+}
+static PFNGLTEXCOORD1IPROC glad_trace_real_glTexCoord1i;
+static void APIENTRY glad_trace_glTexCoord1i(GLint s) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexCoord1i(s);
+    glad_trace_record(146, glad_start);
+}
+static PFNGLTEXCOORD1IVPROC glad_trace_real_glTexCoord1iv;
+static void APIENTRY glad_trace_glTexCoord1iv(const GLint *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexCoord1iv(v);
+    glad_trace_record(147, glad_start);
+}
+static PFNGLTEXCOORD1SPROC glad_trace_real_glTexCoord1s;
+static void APIENTRY glad_trace_glTexCoord1s(GLshort s) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexCoord1s(s);
+    glad_trace_record(148, glad_start);
+}
+static PFNGLTEXCOORD1SVPROC glad_trace_real_glTexCoord1sv;
+static void APIENTRY glad_trace_glTexCoord1sv(const GLshort *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexCoord1sv(v);
+    glad_trace_record(149, glad_start);
+}
+static PFNGLTEXCOORD2DPROC glad_trace_real_glTexCoord2d;
+static void APIENTRY glad_trace_glTexCoord2d(GLdouble s, GLdouble t) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexCoord2d(s, t);
+    glad_trace_record(150, glad_start);
+}
+static PFNGLTEXCOORD2DVPROC glad_trace_real_glTexCoord2dv;
+static void APIENTRY glad_trace_glTexCoord2dv(const GLdouble *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexCoord2dv(v);
+    glad_trace_record(151, glad_start);
+}
+static PFNGLTEXCOORD2FPROC glad_trace_real_glTexCoord2f;
+static void APIENTRY glad_trace_glTexCoord2f(GLfloat s, GLfloat t) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexCoord2f(s, t);
+    glad_trace_record(152, glad_start);
+}
+static PFNGLTEXCOORD2FVPROC glad_trace_real_glTexCoord2fv;
+static void APIENTRY glad_trace_glTexCoord2fv(const GLfloat *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexCoord2fv(v);
+    glad_trace_record(153, glad_start);
+}
+static PFNGLTEXCOORD2IPROC glad_trace_real_glTexCoord2i;
+static void APIENTRY glad_trace_glTexCoord2i(GLint s, GLint t) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexCoord2i(s, t);
+    glad_trace_record(154, glad_start);
+}
+static PFNGLTEXCOORD2IVPROC glad_trace_real_glTexCoord2iv;
+static void APIENTRY glad_trace_glTexCoord2iv(const GLint *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexCoord2iv(v);
+    glad_trace_record(155, glad_start);
+}
+static PFNGLTEXCOORD2SPROC glad_trace_real_glTexCoord2s;
+static void APIENTRY glad_trace_glTexCoord2s(GLshort s, GLshort t) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexCoord2s(s, t);
+    glad_trace_record(156, glad_start);
+}
+static PFNGLTEXCOORD2SVPROC glad_trace_real_glTexCoord2sv;
+static void APIENTRY glad_trace_glTexCoord2sv(const GLshort *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexCoord2sv(v);
+    glad_trace_record(157, glad_start);
+}
+static PFNGLTEXCOORD3DPROC glad_trace_real_glTexCoord3d;
+static void APIENTRY glad_trace_glTexCoord3d(GLdouble s, GLdouble t, GLdouble r) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexCoord3d(s, t, r);
+    glad_trace_record(158, glad_start);
+}
+static PFNGLTEXCOORD3DVPROC glad_trace_real_glTexCoord3dv;
+static void APIENTRY glad_trace_glTexCoord3dv(const GLdouble *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexCoord3dv(v);
+    glad_trace_record(159, glad_start);
+}
+static PFNGLTEXCOORD3FPROC glad_trace_real_glTexCoord3f;
+static void APIENTRY glad_trace_glTexCoord3f(GLfloat s, GLfloat t, GLfloat r) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexCoord3f(s, t, r);
+    glad_trace_record(160, glad_start);
+}
+static PFNGLTEXCOORD3FVPROC glad_trace_real_glTexCoord3fv;
+static void APIENTRY glad_trace_glTexCoord3fv(const GLfloat *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexCoord3fv(v);
+    glad_trace_record(161, glad_start);
+}
+static PFNGLTEXCOORD3IPROC glad_trace_real_glTexCoord3i;
+static void APIENTRY glad_trace_glTexCoord3i(GLint s, GLint t, GLint r) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexCoord3i(s, t, r);
+    glad_trace_record(162, glad_start);
+}
+static PFNGLTEXCOORD3IVPROC glad_trace_real_glTexCoord3iv;
+static void APIENTRY glad_trace_glTexCoord3iv(const GLint *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexCoord3iv(v);
+    glad_trace_record(163, glad_start);
+}
+static PFNGLTEXCOORD3SPROC glad_trace_real_glTexCoord3s;
+static void APIENTRY glad_trace_glTexCoord3s(GLshort s, GLshort t, GLshort r) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexCoord3s(s, t, r);
+    glad_trace_record(164, glad_start);
+}
+static PFNGLTEXCOORD3SVPROC glad_trace_real_glTexCoord3sv;
+static void APIENTRY glad_trace_glTexCoord3sv(const GLshort *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexCoord3sv(v);
+    glad_trace_record(165, glad_start);
+}
+static PFNGLTEXCOORD4DPROC glad_trace_real_glTexCoord4d;
+static void APIENTRY glad_trace_glTexCoord4d(GLdouble s, GLdouble t, GLdouble r, GLdouble q) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexCoord4d(s, t, r, q);
+    glad_trace_record(166, glad_start);
+}
+static PFNGLTEXCOORD4DVPROC glad_trace_real_glTexCoord4dv;
+static void APIENTRY glad_trace_glTexCoord4dv(const GLdouble *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexCoord4dv(v);
+    glad_trace_record(167, glad_start);
+}
+static PFNGLTEXCOORD4FPROC glad_trace_real_glTexCoord4f;
+static void APIENTRY glad_trace_glTexCoord4f(GLfloat s, GLfloat t, GLfloat r, GLfloat q) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexCoord4f(s, t, r, q);
+    glad_trace_record(168, glad_start);
+}
+static PFNGLTEXCOORD4FVPROC glad_trace_real_glTexCoord4fv;
+static void APIENTRY glad_trace_glTexCoord4fv(const GLfloat *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexCoord4fv(v);
+    glad_trace_record(169, glad_start);
+}
+static PFNGLTEXCOORD4IPROC glad_trace_real_glTexCoord4i;
+static void APIENTRY glad_trace_glTexCoord4i(GLint s, GLint t, GLint r, GLint q) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexCoord4i(s, t, r, q);
+    glad_trace_record(170, glad_start);
+}
+static PFNGLTEXCOORD4IVPROC glad_trace_real_glTexCoord4iv;
+static void APIENTRY glad_trace_glTexCoord4iv(const GLint *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexCoord4iv(v);
+    glad_trace_record(171, glad_start);
+}
+static PFNGLTEXCOORD4SPROC glad_trace_real_glTexCoord4s;
+static void APIENTRY glad_trace_glTexCoord4s(GLshort s, GLshort t, GLshort r, GLshort q) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexCoord4s(s, t, r, q);
+    glad_trace_record(172, glad_start);
+}
+static PFNGLTEXCOORD4SVPROC glad_trace_real_glTexCoord4sv;
+static void APIENTRY glad_trace_glTexCoord4sv(const GLshort *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexCoord4sv(v);
+    glad_trace_record(173, glad_start);
+}
+static PFNGLVERTEX2DPROC glad_trace_real_glVertex2d;
+static void APIENTRY glad_trace_glVertex2d(GLdouble x, GLdouble y) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertex2d(x, y);
+    glad_trace_record(174, glad_start);
+}
+static PFNGLVERTEX2DVPROC glad_trace_real_glVertex2dv;
+static void APIENTRY glad_trace_glVertex2dv(const GLdouble *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertex2dv(v);
+    glad_trace_record(175, glad_start);
+}
+static PFNGLVERTEX2FPROC glad_trace_real_glVertex2f;
+static void APIENTRY glad_trace_glVertex2f(GLfloat x, GLfloat y) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertex2f(x, y);
+    glad_trace_record(176, glad_start);
+}
+static PFNGLVERTEX2FVPROC glad_trace_real_glVertex2fv;
+static void APIENTRY glad_trace_glVertex2fv(const GLfloat *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertex2fv(v);
+    glad_trace_record(177, glad_start);
+}
+static PFNGLVERTEX2IPROC glad_trace_real_glVertex2i;
+static void APIENTRY glad_trace_glVertex2i(GLint x, GLint y) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertex2i(x, y);
+    glad_trace_record(178, glad_start);
+}
+static PFNGLVERTEX2IVPROC glad_trace_real_glVertex2iv;
+static void APIENTRY glad_trace_glVertex2iv(const GLint *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertex2iv(v);
+    glad_trace_record(179, glad_start);
+}
+static PFNGLVERTEX2SPROC glad_trace_real_glVertex2s;
+static void APIENTRY glad_trace_glVertex2s(GLshort x, GLshort y) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertex2s(x, y);
+    glad_trace_record(180, glad_start);
+}
+static PFNGLVERTEX2SVPROC glad_trace_real_glVertex2sv;
+static void APIENTRY glad_trace_glVertex2sv(const GLshort *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertex2sv(v);
+    glad_trace_record(181, glad_start);
+}
+static PFNGLVERTEX3DPROC glad_trace_real_glVertex3d;
+static void APIENTRY glad_trace_glVertex3d(GLdouble x, GLdouble y, GLdouble z) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertex3d(x, y, z);
+    glad_trace_record(182, glad_start);
+}
+static PFNGLVERTEX3DVPROC glad_trace_real_glVertex3dv;
+static void APIENTRY glad_trace_glVertex3dv(const GLdouble *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertex3dv(v);
+    glad_trace_record(183, glad_start);
+}
+static PFNGLVERTEX3FPROC glad_trace_real_glVertex3f;
+static void APIENTRY glad_trace_glVertex3f(GLfloat x, GLfloat y, GLfloat z) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertex3f(x, y, z);
+    glad_trace_record(184, glad_start);
+}
+static PFNGLVERTEX3FVPROC glad_trace_real_glVertex3fv;
+static void APIENTRY glad_trace_glVertex3fv(const GLfloat *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertex3fv(v);
+    glad_trace_record(185, glad_start);
+}
+static PFNGLVERTEX3IPROC glad_trace_real_glVertex3i;
+static void APIENTRY glad_trace_glVertex3i(GLint x, GLint y, GLint z) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertex3i(x, y, z);
+    glad_trace_record(186, glad_start);
+}
+static PFNGLVERTEX3IVPROC glad_trace_real_glVertex3iv;
+static void APIENTRY glad_trace_glVertex3iv(const GLint *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertex3iv(v);
+    glad_trace_record(187, glad_start);
+}
+static PFNGLVERTEX3SPROC glad_trace_real_glVertex3s;
+static void APIENTRY glad_trace_glVertex3s(GLshort x, GLshort y, GLshort z) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertex3s(x, y, z);
+    glad_trace_record(188, glad_start);
+}
+static PFNGLVERTEX3SVPROC glad_trace_real_glVertex3sv;
+static void APIENTRY glad_trace_glVertex3sv(const GLshort *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertex3sv(v);
+    glad_trace_record(189, glad_start);
+}
+static PFNGLVERTEX4DPROC glad_trace_real_glVertex4d;
+static void APIENTRY glad_trace_glVertex4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertex4d(x, y, z, w);
+    glad_trace_record(190, glad_start);
+}
+static PFNGLVERTEX4DVPROC glad_trace_real_glVertex4dv;
+static void APIENTRY glad_trace_glVertex4dv(const GLdouble *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertex4dv(v);
+    glad_trace_record(191, glad_start);
+}
+static PFNGLVERTEX4FPROC glad_trace_real_glVertex4f;
+static void APIENTRY glad_trace_glVertex4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertex4f(x, y, z, w);
+    glad_trace_record(192, glad_start);
+}
+static PFNGLVERTEX4FVPROC glad_trace_real_glVertex4fv;
+static void APIENTRY glad_trace_glVertex4fv(const GLfloat *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertex4fv(v);
+    glad_trace_record(193, glad_start);
+}
+static PFNGLVERTEX4IPROC glad_trace_real_glVertex4i;
+static void APIENTRY glad_trace_glVertex4i(GLint x, GLint y, GLint z, GLint w) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertex4i(x, y, z, w);
+    glad_trace_record(194, glad_start);
+}
+static PFNGLVERTEX4IVPROC glad_trace_real_glVertex4iv;
+static void APIENTRY glad_trace_glVertex4iv(const GLint *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertex4iv(v);
+    glad_trace_record(195, glad_start);
+}
+static PFNGLVERTEX4SPROC glad_trace_real_glVertex4s;
+static void APIENTRY glad_trace_glVertex4s(GLshort x, GLshort y, GLshort z, GLshort w) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertex4s(x, y, z, w);
+    glad_trace_record(196, glad_start);
+}
+static PFNGLVERTEX4SVPROC glad_trace_real_glVertex4sv;
+static void APIENTRY glad_trace_glVertex4sv(const GLshort *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertex4sv(v);
+    glad_trace_record(197, glad_start);
+}
+static PFNGLCLIPPLANEPROC glad_trace_real_glClipPlane;
+static void APIENTRY glad_trace_glClipPlane(GLenum plane, const GLdouble *equation) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glClipPlane(plane, equation);
+    glad_trace_record(198, glad_start);
+}
+static PFNGLCOLORMATERIALPROC glad_trace_real_glColorMaterial;
+static void APIENTRY glad_trace_glColorMaterial(GLenum face, GLenum mode) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glColorMaterial(face, mode);
+    glad_trace_record(199, glad_start);
+}
+static PFNGLFOGFPROC glad_trace_real_glFogf;
+static void APIENTRY glad_trace_glFogf(GLenum pname, GLfloat param) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glFogf(pname, param);
+    glad_trace_record(200, glad_start);
+}
+static PFNGLFOGFVPROC glad_trace_real_glFogfv;
+static void APIENTRY glad_trace_glFogfv(GLenum pname, const GLfloat *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glFogfv(pname, params);
+    glad_trace_record(201, glad_start);
+}
+static PFNGLFOGIPROC glad_trace_real_glFogi;
+static void APIENTRY glad_trace_glFogi(GLenum pname, GLint param) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glFogi(pname, param);
+    glad_trace_record(202, glad_start);
+}
+static PFNGLFOGIVPROC glad_trace_real_glFogiv;
+static void APIENTRY glad_trace_glFogiv(GLenum pname, const GLint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glFogiv(pname, params);
+    glad_trace_record(203, glad_start);
+}
+static PFNGLLIGHTFPROC glad_trace_real_glLightf;
+static void APIENTRY glad_trace_glLightf(GLenum light, GLenum pname, GLfloat param) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glLightf(light, pname, param);
+    glad_trace_record(204, glad_start);
+}
+static PFNGLLIGHTFVPROC glad_trace_real_glLightfv;
+static void APIENTRY glad_trace_glLightfv(GLenum light, GLenum pname, const GLfloat *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glLightfv(light, pname, params);
+    glad_trace_record(205, glad_start);
+}
+static PFNGLLIGHTIPROC glad_trace_real_glLighti;
+static void APIENTRY glad_trace_glLighti(GLenum light, GLenum pname, GLint param) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glLighti(light, pname, param);
+    glad_trace_record(206, glad_start);
+}
+static PFNGLLIGHTIVPROC glad_trace_real_glLightiv;
+static void APIENTRY glad_trace_glLightiv(GLenum light, GLenum pname, const GLint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glLightiv(light, pname, params);
+    glad_trace_record(207, glad_start);
+}
+static PFNGLLIGHTMODELFPROC glad_trace_real_glLightModelf;
+static void APIENTRY glad_trace_glLightModelf(GLenum pname, GLfloat param) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glLightModelf(pname, param);
+    glad_trace_record(208, glad_start);
+}
+static PFNGLLIGHTMODELFVPROC glad_trace_real_glLightModelfv;
+static void APIENTRY glad_trace_glLightModelfv(GLenum pname, const GLfloat *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glLightModelfv(pname, params);
+    glad_trace_record(209, glad_start);
+}
+static PFNGLLIGHTMODELIPROC glad_trace_real_glLightModeli;
+static void APIENTRY glad_trace_glLightModeli(GLenum pname, GLint param) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glLightModeli(pname, param);
+    glad_trace_record(210, glad_start);
+}
+static PFNGLLIGHTMODELIVPROC glad_trace_real_glLightModeliv;
+static void APIENTRY glad_trace_glLightModeliv(GLenum pname, const GLint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glLightModeliv(pname, params);
+    glad_trace_record(211, glad_start);
+}
+static PFNGLLINESTIPPLEPROC glad_trace_real_glLineStipple;
+static void APIENTRY glad_trace_glLineStipple(GLint factor, GLushort pattern) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glLineStipple(factor, pattern);
+    glad_trace_record(212, glad_start);
+}
+static PFNGLMATERIALFPROC glad_trace_real_glMaterialf;
+static void APIENTRY glad_trace_glMaterialf(GLenum face, GLenum pname, GLfloat param) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMaterialf(face, pname, param);
+    glad_trace_record(213, glad_start);
+}
+static PFNGLMATERIALFVPROC glad_trace_real_glMaterialfv;
+static void APIENTRY glad_trace_glMaterialfv(GLenum face, GLenum pname, const GLfloat *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMaterialfv(face, pname, params);
+    glad_trace_record(214, glad_start);
+}
+static PFNGLMATERIALIPROC glad_trace_real_glMateriali;
+static void APIENTRY glad_trace_glMateriali(GLenum face, GLenum pname, GLint param) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMateriali(face, pname, param);
+    glad_trace_record(215, glad_start);
+}
+static PFNGLMATERIALIVPROC glad_trace_real_glMaterialiv;
+static void APIENTRY glad_trace_glMaterialiv(GLenum face, GLenum pname, const GLint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMaterialiv(face, pname, params);
+    glad_trace_record(216, glad_start);
+}
+static PFNGLPOLYGONSTIPPLEPROC glad_trace_real_glPolygonStipple;
+static void APIENTRY glad_trace_glPolygonStipple(const GLubyte *mask) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glPolygonStipple(mask);
+    glad_trace_record(217, glad_start);
+}
+static PFNGLSHADEMODELPROC glad_trace_real_glShadeModel;
+static void APIENTRY glad_trace_glShadeModel(GLenum mode) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glShadeModel(mode);
+    glad_trace_record(218, glad_start);
+}
+static PFNGLTEXENVFPROC glad_trace_real_glTexEnvf;
+static void APIENTRY glad_trace_glTexEnvf(GLenum target, GLenum pname, GLfloat param) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexEnvf(target, pname, param);
+    glad_trace_record(219, glad_start);
+}
+static PFNGLTEXENVFVPROC glad_trace_real_glTexEnvfv;
+static void APIENTRY glad_trace_glTexEnvfv(GLenum target, GLenum pname, const GLfloat *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexEnvfv(target, pname, params);
+    glad_trace_record(220, glad_start);
+}
+static PFNGLTEXENVIPROC glad_trace_real_glTexEnvi;
+static void APIENTRY glad_trace_glTexEnvi(GLenum target, GLenum pname, GLint param) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexEnvi(target, pname, param);
+    glad_trace_record(221, glad_start);
+}
+static PFNGLTEXENVIVPROC glad_trace_real_glTexEnviv;
+static void APIENTRY glad_trace_glTexEnviv(GLenum target, GLenum pname, const GLint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexEnviv(target, pname, params);
+    glad_trace_record(222, glad_start);
+}
+static PFNGLTEXGENDPROC glad_trace_real_glTexGend;
+static void APIENTRY glad_trace_glTexGend(GLenum coord, GLenum pname, GLdouble param) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexGend(coord, pname, param);
+    glad_trace_record(223, glad_start);
+}
+static PFNGLTEXGENDVPROC glad_trace_real_glTexGendv;
+static void APIENTRY glad_trace_glTexGendv(GLenum coord, GLenum pname, const GLdouble *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexGendv(coord, pname, params);
+    glad_trace_record(224, glad_start);
+}
+static PFNGLTEXGENFPROC glad_trace_real_glTexGenf;
+static void APIENTRY glad_trace_glTexGenf(GLenum coord, GLenum pname, GLfloat param) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexGenf(coord, pname, param);
+    glad_trace_record(225, glad_start);
+}
+static PFNGLTEXGENFVPROC glad_trace_real_glTexGenfv;
+static void APIENTRY glad_trace_glTexGenfv(GLenum coord, GLenum pname, const GLfloat *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexGenfv(coord, pname, params);
+    glad_trace_record(226, glad_start);
+}
+static PFNGLTEXGENIPROC glad_trace_real_glTexGeni;
+static void APIENTRY glad_trace_glTexGeni(GLenum coord, GLenum pname, GLint param) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexGeni(coord, pname, param);
+    glad_trace_record(227, glad_start);
+}
+static PFNGLTEXGENIVPROC glad_trace_real_glTexGeniv;
+static void APIENTRY glad_trace_glTexGeniv(GLenum coord, GLenum pname, const GLint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexGeniv(coord, pname, params);
+    glad_trace_record(228, glad_start);
+}
+static PFNGLFEEDBACKBUFFERPROC glad_trace_real_glFeedbackBuffer;
+static void APIENTRY glad_trace_glFeedbackBuffer(GLsizei size, GLenum type, GLfloat *buffer) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glFeedbackBuffer(size, type, buffer);
+    glad_trace_record(229, glad_start);
+}
+static PFNGLSELECTBUFFERPROC glad_trace_real_glSelectBuffer;
+static void APIENTRY glad_trace_glSelectBuffer(GLsizei size, GLuint *buffer) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glSelectBuffer(size, buffer);
+    glad_trace_record(230, glad_start);
+}
+static PFNGLRENDERMODEPROC glad_trace_real_glRenderMode;
+static GLint APIENTRY glad_trace_glRenderMode(GLenum mode) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    GLint glad_result = glad_trace_real_glRenderMode(mode);
+    glad_trace_record(231, glad_start);
+    return glad_result;
+}
+static PFNGLINITNAMESPROC glad_trace_real_glInitNames;
+static void APIENTRY glad_trace_glInitNames(void) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glInitNames();
+    glad_trace_record(232, glad_start);
+}
+static PFNGLLOADNAMEPROC glad_trace_real_glLoadName;
+static void APIENTRY glad_trace_glLoadName(GLuint name) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glLoadName(name);
+    glad_trace_record(233, glad_start);
+}
+static PFNGLPASSTHROUGHPROC glad_trace_real_glPassThrough;
+static void APIENTRY glad_trace_glPassThrough(GLfloat token) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glPassThrough(token);
+    glad_trace_record(234, glad_start);
+}
+static PFNGLPOPNAMEPROC glad_trace_real_glPopName;
+static void APIENTRY glad_trace_glPopName(void) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glPopName();
+    glad_trace_record(235, glad_start);
+}
+static PFNGLPUSHNAMEPROC glad_trace_real_glPushName;
+static void APIENTRY glad_trace_glPushName(GLuint name) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glPushName(name);
+    glad_trace_record(236, glad_start);
+}
+static PFNGLCLEARACCUMPROC glad_trace_real_glClearAccum;
+static void APIENTRY glad_trace_glClearAccum(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glClearAccum(red, green, blue, alpha);
+    glad_trace_record(237, glad_start);
+}
+static PFNGLCLEARINDEXPROC glad_trace_real_glClearIndex;
+static void APIENTRY glad_trace_glClearIndex(GLfloat c) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glClearIndex(c);
+    glad_trace_record(238, glad_start);
+}
+static PFNGLINDEXMASKPROC glad_trace_real_glIndexMask;
+static void APIENTRY glad_trace_glIndexMask(GLuint mask) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glIndexMask(mask);
+    glad_trace_record(239, glad_start);
+}
+static PFNGLACCUMPROC glad_trace_real_glAccum;
+static void APIENTRY glad_trace_glAccum(GLenum op, GLfloat value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glAccum(op, value);
+    glad_trace_record(240, glad_start);
+}
+static PFNGLPOPATTRIBPROC glad_trace_real_glPopAttrib;
+static void APIENTRY glad_trace_glPopAttrib(void) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glPopAttrib();
+    glad_trace_record(241, glad_start);
+}
+static PFNGLPUSHATTRIBPROC glad_trace_real_glPushAttrib;
+static void APIENTRY glad_trace_glPushAttrib(GLbitfield mask) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glPushAttrib(mask);
+    glad_trace_record(242, glad_start);
+}
+static PFNGLMAP1DPROC glad_trace_real_glMap1d;
+static void APIENTRY glad_trace_glMap1d(GLenum target, GLdouble u1, GLdouble u2, GLint stride, GLint order, const GLdouble *points) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMap1d(target, u1, u2, stride, order, points);
+    glad_trace_record(243, glad_start);
+}
+static PFNGLMAP1FPROC glad_trace_real_glMap1f;
+static void APIENTRY glad_trace_glMap1f(GLenum target, GLfloat u1, GLfloat u2, GLint stride, GLint order, const GLfloat *points) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMap1f(target, u1, u2, stride, order, points);
+    glad_trace_record(244, glad_start);
+}
+static PFNGLMAP2DPROC glad_trace_real_glMap2d;
+static void APIENTRY glad_trace_glMap2d(GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, const GLdouble *points) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMap2d(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+    glad_trace_record(245, glad_start);
+}
+static PFNGLMAP2FPROC glad_trace_real_glMap2f;
+static void APIENTRY glad_trace_glMap2f(GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, const GLfloat *points) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMap2f(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+    glad_trace_record(246, glad_start);
+}
+static PFNGLMAPGRID1DPROC glad_trace_real_glMapGrid1d;
+static void APIENTRY glad_trace_glMapGrid1d(GLint un, GLdouble u1, GLdouble u2) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMapGrid1d(un, u1, u2);
+    glad_trace_record(247, glad_start);
+}
+static PFNGLMAPGRID1FPROC glad_trace_real_glMapGrid1f;
+static void APIENTRY glad_trace_glMapGrid1f(GLint un, GLfloat u1, GLfloat u2) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMapGrid1f(un, u1, u2);
+    glad_trace_record(248, glad_start);
+}
+static PFNGLMAPGRID2DPROC glad_trace_real_glMapGrid2d;
+static void APIENTRY glad_trace_glMapGrid2d(GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdouble v1, GLdouble v2) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMapGrid2d(un, u1, u2, vn, v1, v2);
+    glad_trace_record(249, glad_start);
+}
+static PFNGLMAPGRID2FPROC glad_trace_real_glMapGrid2f;
+static void APIENTRY glad_trace_glMapGrid2f(GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloat v1, GLfloat v2) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMapGrid2f(un, u1, u2, vn, v1, v2);
+    glad_trace_record(250, glad_start);
+}
+static PFNGLEVALCOORD1DPROC glad_trace_real_glEvalCoord1d;
+static void APIENTRY glad_trace_glEvalCoord1d(GLdouble u) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glEvalCoord1d(u);
+    glad_trace_record(251, glad_start);
+}
+static PFNGLEVALCOORD1DVPROC glad_trace_real_glEvalCoord1dv;
+static void APIENTRY glad_trace_glEvalCoord1dv(const GLdouble *u) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glEvalCoord1dv(u);
+    glad_trace_record(252, glad_start);
+}
+static PFNGLEVALCOORD1FPROC glad_trace_real_glEvalCoord1f;
+static void APIENTRY glad_trace_glEvalCoord1f(GLfloat u) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glEvalCoord1f(u);
+    glad_trace_record(253, glad_start);
+}
+static PFNGLEVALCOORD1FVPROC glad_trace_real_glEvalCoord1fv;
+static void APIENTRY glad_trace_glEvalCoord1fv(const GLfloat *u) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glEvalCoord1fv(u);
+    glad_trace_record(254, glad_start);
+}
+static PFNGLEVALCOORD2DPROC glad_trace_real_glEvalCoord2d;
+static void APIENTRY glad_trace_glEvalCoord2d(GLdouble u, GLdouble v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glEvalCoord2d(u, v);
+    glad_trace_record(255, glad_start);
+}
+static PFNGLEVALCOORD2DVPROC glad_trace_real_glEvalCoord2dv;
+static void APIENTRY glad_trace_glEvalCoord2dv(const GLdouble *u) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glEvalCoord2dv(u);
+    glad_trace_record(256, glad_start);
+}
+static PFNGLEVALCOORD2FPROC glad_trace_real_glEvalCoord2f;
+static void APIENTRY glad_trace_glEvalCoord2f(GLfloat u, GLfloat v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glEvalCoord2f(u, v);
+    glad_trace_record(257, glad_start);
+}
+static PFNGLEVALCOORD2FVPROC glad_trace_real_glEvalCoord2fv;
+static void APIENTRY glad_trace_glEvalCoord2fv(const GLfloat *u) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glEvalCoord2fv(u);
+    glad_trace_record(258, glad_start);
+}
+static PFNGLEVALMESH1PROC glad_trace_real_glEvalMesh1;
+static void APIENTRY glad_trace_glEvalMesh1(GLenum mode, GLint i1, GLint i2) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glEvalMesh1(mode, i1, i2);
+    glad_trace_record(259, glad_start);
+}
+static PFNGLEVALPOINT1PROC glad_trace_real_glEvalPoint1;
+static void APIENTRY glad_trace_glEvalPoint1(GLint i) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glEvalPoint1(i);
+    glad_trace_record(260, glad_start);
+}
+static PFNGLEVALMESH2PROC glad_trace_real_glEvalMesh2;
+static void APIENTRY glad_trace_glEvalMesh2(GLenum mode, GLint i1, GLint i2, GLint j1, GLint j2) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glEvalMesh2(mode, i1, i2, j1, j2);
+    glad_trace_record(261, glad_start);
+}
+static PFNGLEVALPOINT2PROC glad_trace_real_glEvalPoint2;
+static void APIENTRY glad_trace_glEvalPoint2(GLint i, GLint j) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glEvalPoint2(i, j);
+    glad_trace_record(262, glad_start);
+}
+static PFNGLALPHAFUNCPROC glad_trace_real_glAlphaFunc;
+static void APIENTRY glad_trace_glAlphaFunc(GLenum func, GLfloat ref) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glAlphaFunc(func, ref);
+    glad_trace_record(263, glad_start);
+}
+static PFNGLPIXELZOOMPROC glad_trace_real_glPixelZoom;
+static void APIENTRY glad_trace_glPixelZoom(GLfloat xfactor, GLfloat yfactor) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glPixelZoom(xfactor, yfactor);
+    glad_trace_record(264, glad_start);
+}
+static PFNGLPIXELTRANSFERFPROC glad_trace_real_glPixelTransferf;
+static void APIENTRY glad_trace_glPixelTransferf(GLenum pname, GLfloat param) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glPixelTransferf(pname, param);
+    glad_trace_record(265, glad_start);
+}
+static PFNGLPIXELTRANSFERIPROC glad_trace_real_glPixelTransferi;
+static void APIENTRY glad_trace_glPixelTransferi(GLenum pname, GLint param) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glPixelTransferi(pname, param);
+    glad_trace_record(266, glad_start);
+}
+static PFNGLPIXELMAPFVPROC glad_trace_real_glPixelMapfv;
+static void APIENTRY glad_trace_glPixelMapfv(GLenum map, GLsizei mapsize, const GLfloat *values) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glPixelMapfv(map, mapsize, values);
+    glad_trace_record(267, glad_start);
+}
+static PFNGLPIXELMAPUIVPROC glad_trace_real_glPixelMapuiv;
+static void APIENTRY glad_trace_glPixelMapuiv(GLenum map, GLsizei mapsize, const GLuint *values) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glPixelMapuiv(map, mapsize, values);
+    glad_trace_record(268, glad_start);
+}
+static PFNGLPIXELMAPUSVPROC glad_trace_real_glPixelMapusv;
+static void APIENTRY glad_trace_glPixelMapusv(GLenum map, GLsizei mapsize, const GLushort *values) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glPixelMapusv(map, mapsize, values);
+    glad_trace_record(269, glad_start);
+}
+static PFNGLCOPYPIXELSPROC glad_trace_real_glCopyPixels;
+static void APIENTRY glad_trace_glCopyPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum type) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glCopyPixels(x, y, width, height, type);
+    glad_trace_record(270, glad_start);
+}
+static PFNGLDRAWPIXELSPROC glad_trace_real_glDrawPixels;
+static void APIENTRY glad_trace_glDrawPixels(GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDrawPixels(width, height, format, type, pixels);
+    glad_trace_record(271, glad_start);
+}
+static PFNGLGETCLIPPLANEPROC glad_trace_real_glGetClipPlane;
+static void APIENTRY glad_trace_glGetClipPlane(GLenum plane, GLdouble *equation) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetClipPlane(plane, equation);
+    glad_trace_record(272, glad_start);
+}
+static PFNGLGETLIGHTFVPROC glad_trace_real_glGetLightfv;
+static void APIENTRY glad_trace_glGetLightfv(GLenum light, GLenum pname, GLfloat *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetLightfv(light, pname, params);
+    glad_trace_record(273, glad_start);
+}
+static PFNGLGETLIGHTIVPROC glad_trace_real_glGetLightiv;
+static void APIENTRY glad_trace_glGetLightiv(GLenum light, GLenum pname, GLint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetLightiv(light, pname, params);
+    glad_trace_record(274, glad_start);
+}
+static PFNGLGETMAPDVPROC glad_trace_real_glGetMapdv;
+static void APIENTRY glad_trace_glGetMapdv(GLenum target, GLenum query, GLdouble *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetMapdv(target, query, v);
+    glad_trace_record(275, glad_start);
+}
+static PFNGLGETMAPFVPROC glad_trace_real_glGetMapfv;
+static void APIENTRY glad_trace_glGetMapfv(GLenum target, GLenum query, GLfloat *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetMapfv(target, query, v);
+    glad_trace_record(276, glad_start);
+}
+static PFNGLGETMAPIVPROC glad_trace_real_glGetMapiv;
+static void APIENTRY glad_trace_glGetMapiv(GLenum target, GLenum query, GLint *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetMapiv(target, query, v);
+    glad_trace_record(277, glad_start);
+}
+static PFNGLGETMATERIALFVPROC glad_trace_real_glGetMaterialfv;
+static void APIENTRY glad_trace_glGetMaterialfv(GLenum face, GLenum pname, GLfloat *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetMaterialfv(face, pname, params);
+    glad_trace_record(278, glad_start);
+}
+static PFNGLGETMATERIALIVPROC glad_trace_real_glGetMaterialiv;
+static void APIENTRY glad_trace_glGetMaterialiv(GLenum face, GLenum pname, GLint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetMaterialiv(face, pname, params);
+    glad_trace_record(279, glad_start);
+}
+static PFNGLGETPIXELMAPFVPROC glad_trace_real_glGetPixelMapfv;
+static void APIENTRY glad_trace_glGetPixelMapfv(GLenum map, GLfloat *values) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetPixelMapfv(map, values);
+    glad_trace_record(280, glad_start);
+}
+static PFNGLGETPIXELMAPUIVPROC glad_trace_real_glGetPixelMapuiv;
+static void APIENTRY glad_trace_glGetPixelMapuiv(GLenum map, GLuint *values) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetPixelMapuiv(map, values);
+    glad_trace_record(281, glad_start);
+}
+static PFNGLGETPIXELMAPUSVPROC glad_trace_real_glGetPixelMapusv;
+static void APIENTRY glad_trace_glGetPixelMapusv(GLenum map, GLushort *values) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetPixelMapusv(map, values);
+    glad_trace_record(282, glad_start);
+}
+static PFNGLGETPOLYGONSTIPPLEPROC glad_trace_real_glGetPolygonStipple;
+static void APIENTRY glad_trace_glGetPolygonStipple(GLubyte *mask) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetPolygonStipple(mask);
+    glad_trace_record(283, glad_start);
+}
+static PFNGLGETTEXENVFVPROC glad_trace_real_glGetTexEnvfv;
+static void APIENTRY glad_trace_glGetTexEnvfv(GLenum target, GLenum pname, GLfloat *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetTexEnvfv(target, pname, params);
+    glad_trace_record(284, glad_start);
+}
+static PFNGLGETTEXENVIVPROC glad_trace_real_glGetTexEnviv;
+static void APIENTRY glad_trace_glGetTexEnviv(GLenum target, GLenum pname, GLint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetTexEnviv(target, pname, params);
+    glad_trace_record(285, glad_start);
+}
+static PFNGLGETTEXGENDVPROC glad_trace_real_glGetTexGendv;
+static void APIENTRY glad_trace_glGetTexGendv(GLenum coord, GLenum pname, GLdouble *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetTexGendv(coord, pname, params);
+    glad_trace_record(286, glad_start);
+}
+static PFNGLGETTEXGENFVPROC glad_trace_real_glGetTexGenfv;
+static void APIENTRY glad_trace_glGetTexGenfv(GLenum coord, GLenum pname, GLfloat *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetTexGenfv(coord, pname, params);
+    glad_trace_record(287, glad_start);
+}
+static PFNGLGETTEXGENIVPROC glad_trace_real_glGetTexGeniv;
+static void APIENTRY glad_trace_glGetTexGeniv(GLenum coord, GLenum pname, GLint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetTexGeniv(coord, pname, params);
+    glad_trace_record(288, glad_start);
+}
+static PFNGLISLISTPROC glad_trace_real_glIsList;
+static GLboolean APIENTRY glad_trace_glIsList(GLuint list) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    GLboolean glad_result = glad_trace_real_glIsList(list);
+    glad_trace_record(289, glad_start);
+    return glad_result;
+}
+static PFNGLFRUSTUMPROC glad_trace_real_glFrustum;
+static void APIENTRY glad_trace_glFrustum(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glFrustum(left, right, bottom, top, zNear, zFar);
+    glad_trace_record(290, glad_start);
+}
+static PFNGLLOADIDENTITYPROC glad_trace_real_glLoadIdentity;
+static void APIENTRY glad_trace_glLoadIdentity(void) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glLoadIdentity();
+    glad_trace_record(291, glad_start);
+}
+static PFNGLLOADMATRIXFPROC glad_trace_real_glLoadMatrixf;
+static void APIENTRY glad_trace_glLoadMatrixf(const GLfloat *m) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glLoadMatrixf(m);
+    glad_trace_record(292, glad_start);
+}
+static PFNGLLOADMATRIXDPROC glad_trace_real_glLoadMatrixd;
+static void APIENTRY glad_trace_glLoadMatrixd(const GLdouble *m) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glLoadMatrixd(m);
+    glad_trace_record(293, glad_start);
+}
+static PFNGLMATRIXMODEPROC glad_trace_real_glMatrixMode;
+static void APIENTRY glad_trace_glMatrixMode(GLenum mode) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMatrixMode(mode);
+    glad_trace_record(294, glad_start);
+}
+static PFNGLMULTMATRIXFPROC glad_trace_real_glMultMatrixf;
+static void APIENTRY glad_trace_glMultMatrixf(const GLfloat *m) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultMatrixf(m);
+    glad_trace_record(295, glad_start);
+}
+static PFNGLMULTMATRIXDPROC glad_trace_real_glMultMatrixd;
+static void APIENTRY glad_trace_glMultMatrixd(const GLdouble *m) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultMatrixd(m);
+    glad_trace_record(296, glad_start);
+}
+static PFNGLORTHOPROC glad_trace_real_glOrtho;
+static void APIENTRY glad_trace_glOrtho(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glOrtho(left, right, bottom, top, zNear, zFar);
+    glad_trace_record(297, glad_start);
+}
+static PFNGLPOPMATRIXPROC glad_trace_real_glPopMatrix;
+static void APIENTRY glad_trace_glPopMatrix(void) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glPopMatrix();
+    glad_trace_record(298, glad_start);
+}
+static PFNGLPUSHMATRIXPROC glad_trace_real_glPushMatrix;
+static void APIENTRY glad_trace_glPushMatrix(void) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glPushMatrix();
+    glad_trace_record(299, glad_start);
+}
+static PFNGLROTATEDPROC glad_trace_real_glRotated;
+static void APIENTRY glad_trace_glRotated(GLdouble angle, GLdouble x, GLdouble y, GLdouble z) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glRotated(angle, x, y, z);
+    glad_trace_record(300, glad_start);
+}
+static PFNGLROTATEFPROC glad_trace_real_glRotatef;
+static void APIENTRY glad_trace_glRotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glRotatef(angle, x, y, z);
+    glad_trace_record(301, glad_start);
+}
+static PFNGLSCALEDPROC glad_trace_real_glScaled;
+static void APIENTRY glad_trace_glScaled(GLdouble x, GLdouble y, GLdouble z) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glScaled(x, y, z);
+    glad_trace_record(302, glad_start);
+}
+static PFNGLSCALEFPROC glad_trace_real_glScalef;
+static void APIENTRY glad_trace_glScalef(GLfloat x, GLfloat y, GLfloat z) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glScalef(x, y, z);
+    glad_trace_record(303, glad_start);
+}
+static PFNGLTRANSLATEDPROC glad_trace_real_glTranslated;
+static void APIENTRY glad_trace_glTranslated(GLdouble x, GLdouble y, GLdouble z) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTranslated(x, y, z);
+    glad_trace_record(304, glad_start);
+}
+static PFNGLTRANSLATEFPROC glad_trace_real_glTranslatef;
+static void APIENTRY glad_trace_glTranslatef(GLfloat x, GLfloat y, GLfloat z) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTranslatef(x, y, z);
+    glad_trace_record(305, glad_start);
+}
+static PFNGLDRAWARRAYSPROC glad_trace_real_glDrawArrays;
+static void APIENTRY glad_trace_glDrawArrays(GLenum mode, GLint first, GLsizei count) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDrawArrays(mode, first, count);
+    glad_trace_record(306, glad_start);
+}
+static PFNGLDRAWELEMENTSPROC glad_trace_real_glDrawElements;
+static void APIENTRY glad_trace_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDrawElements(mode, count, type, indices);
+    glad_trace_record(307, glad_start);
+}
+static PFNGLGETPOINTERVPROC glad_trace_real_glGetPointerv;
+static void APIENTRY glad_trace_glGetPointerv(GLenum pname, void **params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetPointerv(pname, params);
+    glad_trace_record(308, glad_start);
+}
+static PFNGLPOLYGONOFFSETPROC glad_trace_real_glPolygonOffset;
+static void APIENTRY glad_trace_glPolygonOffset(GLfloat factor, GLfloat units) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glPolygonOffset(factor, units);
+    glad_trace_record(309, glad_start);
+}
+static PFNGLCOPYTEXIMAGE1DPROC glad_trace_real_glCopyTexImage1D;
+static void APIENTRY glad_trace_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glCopyTexImage1D(target, level, internalformat, x, y, width, border);
+    glad_trace_record(310, glad_start);
+}
+static PFNGLCOPYTEXIMAGE2DPROC glad_trace_real_glCopyTexImage2D;
+static void APIENTRY glad_trace_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+    glad_trace_record(311, glad_start);
+}
+static PFNGLCOPYTEXSUBIMAGE1DPROC glad_trace_real_glCopyTexSubImage1D;
+static void APIENTRY glad_trace_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glCopyTexSubImage1D(target, level, xoffset, x, y, width);
+    glad_trace_record(312, glad_start);
+}
+static PFNGLCOPYTEXSUBIMAGE2DPROC glad_trace_real_glCopyTexSubImage2D;
+static void APIENTRY glad_trace_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+    glad_trace_record(313, glad_start);
+}
+static PFNGLTEXSUBIMAGE1DPROC glad_trace_real_glTexSubImage1D;
+static void APIENTRY glad_trace_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexSubImage1D(target, level, xoffset, width, format, type, pixels);
+    glad_trace_record(314, glad_start);
+}
+static PFNGLTEXSUBIMAGE2DPROC glad_trace_real_glTexSubImage2D;
+static void APIENTRY glad_trace_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+    glad_trace_record(315, glad_start);
+}
+static PFNGLBINDTEXTUREPROC glad_trace_real_glBindTexture;
+static void APIENTRY glad_trace_glBindTexture(GLenum target, GLuint texture) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glBindTexture(target, texture);
+    glad_trace_record(316, glad_start);
+}
+static PFNGLDELETETEXTURESPROC glad_trace_real_glDeleteTextures;
+static void APIENTRY glad_trace_glDeleteTextures(GLsizei n, const GLuint *textures) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDeleteTextures(n, textures);
+    glad_trace_record(317, glad_start);
+}
+static PFNGLGENTEXTURESPROC glad_trace_real_glGenTextures;
+static void APIENTRY glad_trace_glGenTextures(GLsizei n, GLuint *textures) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGenTextures(n, textures);
+    glad_trace_record(318, glad_start);
+}
+static PFNGLISTEXTUREPROC glad_trace_real_glIsTexture;
+static GLboolean APIENTRY glad_trace_glIsTexture(GLuint texture) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    GLboolean glad_result = glad_trace_real_glIsTexture(texture);
+    glad_trace_record(319, glad_start);
+    return glad_result;
+}
+static PFNGLARRAYELEMENTPROC glad_trace_real_glArrayElement;
+static void APIENTRY glad_trace_glArrayElement(GLint i) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glArrayElement(i);
+    glad_trace_record(320, glad_start);
+}
+static PFNGLCOLORPOINTERPROC glad_trace_real_glColorPointer;
+static void APIENTRY glad_trace_glColorPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glColorPointer(size, type, stride, pointer);
+    glad_trace_record(321, glad_start);
+}
+static PFNGLDISABLECLIENTSTATEPROC glad_trace_real_glDisableClientState;
+static void APIENTRY glad_trace_glDisableClientState(GLenum array) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDisableClientState(array);
+    glad_trace_record(322, glad_start);
+}
+static PFNGLEDGEFLAGPOINTERPROC glad_trace_real_glEdgeFlagPointer;
+static void APIENTRY glad_trace_glEdgeFlagPointer(GLsizei stride, const void *pointer) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glEdgeFlagPointer(stride, pointer);
+    glad_trace_record(323, glad_start);
+}
+static PFNGLENABLECLIENTSTATEPROC glad_trace_real_glEnableClientState;
+static void APIENTRY glad_trace_glEnableClientState(GLenum array) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glEnableClientState(array);
+    glad_trace_record(324, glad_start);
+}
+static PFNGLINDEXPOINTERPROC glad_trace_real_glIndexPointer;
+static void APIENTRY glad_trace_glIndexPointer(GLenum type, GLsizei stride, const void *pointer) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glIndexPointer(type, stride, pointer);
+    glad_trace_record(325, glad_start);
+}
+static PFNGLINTERLEAVEDARRAYSPROC glad_trace_real_glInterleavedArrays;
+static void APIENTRY glad_trace_glInterleavedArrays(GLenum format, GLsizei stride, const void *pointer) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glInterleavedArrays(format, stride, pointer);
+    glad_trace_record(326, glad_start);
+}
+static PFNGLNORMALPOINTERPROC glad_trace_real_glNormalPointer;
+static void APIENTRY glad_trace_glNormalPointer(GLenum type, GLsizei stride, const void *pointer) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glNormalPointer(type, stride, pointer);
+    glad_trace_record(327, glad_start);
+}
+static PFNGLTEXCOORDPOINTERPROC glad_trace_real_glTexCoordPointer;
+static void APIENTRY glad_trace_glTexCoordPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexCoordPointer(size, type, stride, pointer);
+    glad_trace_record(328, glad_start);
+}
+static PFNGLVERTEXPOINTERPROC glad_trace_real_glVertexPointer;
+static void APIENTRY glad_trace_glVertexPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexPointer(size, type, stride, pointer);
+    glad_trace_record(329, glad_start);
+}
+static PFNGLARETEXTURESRESIDENTPROC glad_trace_real_glAreTexturesResident;
+static GLboolean APIENTRY glad_trace_glAreTexturesResident(GLsizei n, const GLuint *textures, GLboolean *residences) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    GLboolean glad_result = glad_trace_real_glAreTexturesResident(n, textures, residences);
+    glad_trace_record(330, glad_start);
+    return glad_result;
+}
+static PFNGLPRIORITIZETEXTURESPROC glad_trace_real_glPrioritizeTextures;
+static void APIENTRY glad_trace_glPrioritizeTextures(GLsizei n, const GLuint *textures, const GLfloat *priorities) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glPrioritizeTextures(n, textures, priorities);
+    glad_trace_record(331, glad_start);
+}
+static PFNGLINDEXUBPROC glad_trace_real_glIndexub;
+static void APIENTRY glad_trace_glIndexub(GLubyte c) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glIndexub(c);
+    glad_trace_record(332, glad_start);
+}
+static PFNGLINDEXUBVPROC glad_trace_real_glIndexubv;
+static void APIENTRY glad_trace_glIndexubv(const GLubyte *c) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glIndexubv(c);
+    glad_trace_record(333, glad_start);
+}
+static PFNGLPOPCLIENTATTRIBPROC glad_trace_real_glPopClientAttrib;
+static void APIENTRY glad_trace_glPopClientAttrib(void) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glPopClientAttrib();
+    glad_trace_record(334, glad_start);
+}
+static PFNGLPUSHCLIENTATTRIBPROC glad_trace_real_glPushClientAttrib;
+static void APIENTRY glad_trace_glPushClientAttrib(GLbitfield mask) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glPushClientAttrib(mask);
+    glad_trace_record(335, glad_start);
+}
+static PFNGLDRAWRANGEELEMENTSPROC glad_trace_real_glDrawRangeElements;
+static void APIENTRY glad_trace_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDrawRangeElements(mode, start, end, count, type, indices);
+    glad_trace_record(336, glad_start);
+}
+static PFNGLTEXIMAGE3DPROC glad_trace_real_glTexImage3D;
+static void APIENTRY glad_trace_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+    glad_trace_record(337, glad_start);
+}
+static PFNGLTEXSUBIMAGE3DPROC glad_trace_real_glTexSubImage3D;
+static void APIENTRY glad_trace_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+    glad_trace_record(338, glad_start);
+}
+static PFNGLCOPYTEXSUBIMAGE3DPROC glad_trace_real_glCopyTexSubImage3D;
+static void APIENTRY glad_trace_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+    glad_trace_record(339, glad_start);
+}
+static PFNGLACTIVETEXTUREPROC glad_trace_real_glActiveTexture;
+static void APIENTRY glad_trace_glActiveTexture(GLenum texture) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glActiveTexture(texture);
+    glad_trace_record(340, glad_start);
+}
+static PFNGLSAMPLECOVERAGEPROC glad_trace_real_glSampleCoverage;
+static void APIENTRY glad_trace_glSampleCoverage(GLfloat value, GLboolean invert) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glSampleCoverage(value, invert);
+    glad_trace_record(341, glad_start);
+}
+static PFNGLCOMPRESSEDTEXIMAGE3DPROC glad_trace_real_glCompressedTexImage3D;
+static void APIENTRY glad_trace_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+    glad_trace_record(342, glad_start);
+}
+static PFNGLCOMPRESSEDTEXIMAGE2DPROC glad_trace_real_glCompressedTexImage2D;
+static void APIENTRY glad_trace_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+    glad_trace_record(343, glad_start);
+}
+static PFNGLCOMPRESSEDTEXIMAGE1DPROC glad_trace_real_glCompressedTexImage1D;
+static void APIENTRY glad_trace_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+    glad_trace_record(344, glad_start);
+}
+static PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glad_trace_real_glCompressedTexSubImage3D;
+static void APIENTRY glad_trace_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+    glad_trace_record(345, glad_start);
+}
+static PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glad_trace_real_glCompressedTexSubImage2D;
+static void APIENTRY glad_trace_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+    glad_trace_record(346, glad_start);
+}
+static PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glad_trace_real_glCompressedTexSubImage1D;
+static void APIENTRY glad_trace_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+    glad_trace_record(347, glad_start);
+}
+static PFNGLGETCOMPRESSEDTEXIMAGEPROC glad_trace_real_glGetCompressedTexImage;
+static void APIENTRY glad_trace_glGetCompressedTexImage(GLenum target, GLint level, void *img) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetCompressedTexImage(target, level, img);
+    glad_trace_record(348, glad_start);
+}
+static PFNGLCLIENTACTIVETEXTUREPROC glad_trace_real_glClientActiveTexture;
+static void APIENTRY glad_trace_glClientActiveTexture(GLenum texture) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glClientActiveTexture(texture);
+    glad_trace_record(349, glad_start);
+}
+static PFNGLMULTITEXCOORD1DPROC glad_trace_real_glMultiTexCoord1d;
+static void APIENTRY glad_trace_glMultiTexCoord1d(GLenum target, GLdouble s) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiTexCoord1d(target, s);
+    glad_trace_record(350, glad_start);
+}
+static PFNGLMULTITEXCOORD1DVPROC glad_trace_real_glMultiTexCoord1dv;
+static void APIENTRY glad_trace_glMultiTexCoord1dv(GLenum target, const GLdouble *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiTexCoord1dv(target, v);
+    glad_trace_record(351, glad_start);
+}
+static PFNGLMULTITEXCOORD1FPROC glad_trace_real_glMultiTexCoord1f;
+static void APIENTRY glad_trace_glMultiTexCoord1f(GLenum target, GLfloat s) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiTexCoord1f(target, s);
+    glad_trace_record(352, glad_start);
+}
+static PFNGLMULTITEXCOORD1FVPROC glad_trace_real_glMultiTexCoord1fv;
+static void APIENTRY glad_trace_glMultiTexCoord1fv(GLenum target, const GLfloat *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiTexCoord1fv(target, v);
+    glad_trace_record(353, glad_start);
+}
+static PFNGLMULTITEXCOORD1IPROC glad_trace_real_glMultiTexCoord1i;
+static void APIENTRY glad_trace_glMultiTexCoord1i(GLenum target, GLint s) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiTexCoord1i(target, s);
+    glad_trace_record(354, glad_start);
+}
+static PFNGLMULTITEXCOORD1IVPROC glad_trace_real_glMultiTexCoord1iv;
+static void APIENTRY glad_trace_glMultiTexCoord1iv(GLenum target, const GLint *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiTexCoord1iv(target, v);
+    glad_trace_record(355, glad_start);
+}
+static PFNGLMULTITEXCOORD1SPROC glad_trace_real_glMultiTexCoord1s;
+static void APIENTRY glad_trace_glMultiTexCoord1s(GLenum target, GLshort s) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiTexCoord1s(target, s);
+    glad_trace_record(356, glad_start);
+}
+static PFNGLMULTITEXCOORD1SVPROC glad_trace_real_glMultiTexCoord1sv;
+static void APIENTRY glad_trace_glMultiTexCoord1sv(GLenum target, const GLshort *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiTexCoord1sv(target, v);
+    glad_trace_record(357, glad_start);
+}
+static PFNGLMULTITEXCOORD2DPROC glad_trace_real_glMultiTexCoord2d;
+static void APIENTRY glad_trace_glMultiTexCoord2d(GLenum target, GLdouble s, GLdouble t) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiTexCoord2d(target, s, t);
+    glad_trace_record(358, glad_start);
+}
+static PFNGLMULTITEXCOORD2DVPROC glad_trace_real_glMultiTexCoord2dv;
+static void APIENTRY glad_trace_glMultiTexCoord2dv(GLenum target, const GLdouble *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiTexCoord2dv(target, v);
+    glad_trace_record(359, glad_start);
+}
+static PFNGLMULTITEXCOORD2FPROC glad_trace_real_glMultiTexCoord2f;
+static void APIENTRY glad_trace_glMultiTexCoord2f(GLenum target, GLfloat s, GLfloat t) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiTexCoord2f(target, s, t);
+    glad_trace_record(360, glad_start);
+}
+static PFNGLMULTITEXCOORD2FVPROC glad_trace_real_glMultiTexCoord2fv;
+static void APIENTRY glad_trace_glMultiTexCoord2fv(GLenum target, const GLfloat *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiTexCoord2fv(target, v);
+    glad_trace_record(361, glad_start);
+}
+static PFNGLMULTITEXCOORD2IPROC glad_trace_real_glMultiTexCoord2i;
+static void APIENTRY glad_trace_glMultiTexCoord2i(GLenum target, GLint s, GLint t) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiTexCoord2i(target, s, t);
+    glad_trace_record(362, glad_start);
+}
+static PFNGLMULTITEXCOORD2IVPROC glad_trace_real_glMultiTexCoord2iv;
+static void APIENTRY glad_trace_glMultiTexCoord2iv(GLenum target, const GLint *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiTexCoord2iv(target, v);
+    glad_trace_record(363, glad_start);
+}
+static PFNGLMULTITEXCOORD2SPROC glad_trace_real_glMultiTexCoord2s;
+static void APIENTRY glad_trace_glMultiTexCoord2s(GLenum target, GLshort s, GLshort t) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiTexCoord2s(target, s, t);
+    glad_trace_record(364, glad_start);
+}
+static PFNGLMULTITEXCOORD2SVPROC glad_trace_real_glMultiTexCoord2sv;
+static void APIENTRY glad_trace_glMultiTexCoord2sv(GLenum target, const GLshort *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiTexCoord2sv(target, v);
+    glad_trace_record(365, glad_start);
+}
+static PFNGLMULTITEXCOORD3DPROC glad_trace_real_glMultiTexCoord3d;
+static void APIENTRY glad_trace_glMultiTexCoord3d(GLenum target, GLdouble s, GLdouble t, GLdouble r) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiTexCoord3d(target, s, t, r);
+    glad_trace_record(366, glad_start);
+}
+static PFNGLMULTITEXCOORD3DVPROC glad_trace_real_glMultiTexCoord3dv;
+static void APIENTRY glad_trace_glMultiTexCoord3dv(GLenum target, const GLdouble *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiTexCoord3dv(target, v);
+    glad_trace_record(367, glad_start);
+}
+static PFNGLMULTITEXCOORD3FPROC glad_trace_real_glMultiTexCoord3f;
+static void APIENTRY glad_trace_glMultiTexCoord3f(GLenum target, GLfloat s, GLfloat t, GLfloat r) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiTexCoord3f(target, s, t, r);
+    glad_trace_record(368, glad_start);
+}
+static PFNGLMULTITEXCOORD3FVPROC glad_trace_real_glMultiTexCoord3fv;
+static void APIENTRY glad_trace_glMultiTexCoord3fv(GLenum target, const GLfloat *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiTexCoord3fv(target, v);
+    glad_trace_record(369, glad_start);
+}
+static PFNGLMULTITEXCOORD3IPROC glad_trace_real_glMultiTexCoord3i;
+static void APIENTRY glad_trace_glMultiTexCoord3i(GLenum target, GLint s, GLint t, GLint r) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiTexCoord3i(target, s, t, r);
+    glad_trace_record(370, glad_start);
+}
+static PFNGLMULTITEXCOORD3IVPROC glad_trace_real_glMultiTexCoord3iv;
+static void APIENTRY glad_trace_glMultiTexCoord3iv(GLenum target, const GLint *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiTexCoord3iv(target, v);
+    glad_trace_record(371, glad_start);
+}
+static PFNGLMULTITEXCOORD3SPROC glad_trace_real_glMultiTexCoord3s;
+static void APIENTRY glad_trace_glMultiTexCoord3s(GLenum target, GLshort s, GLshort t, GLshort r) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiTexCoord3s(target, s, t, r);
+    glad_trace_record(372, glad_start);
+}
+static PFNGLMULTITEXCOORD3SVPROC glad_trace_real_glMultiTexCoord3sv;
+static void APIENTRY glad_trace_glMultiTexCoord3sv(GLenum target, const GLshort *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiTexCoord3sv(target, v);
+    glad_trace_record(373, glad_start);
+}
+static PFNGLMULTITEXCOORD4DPROC glad_trace_real_glMultiTexCoord4d;
+static void APIENTRY glad_trace_glMultiTexCoord4d(GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiTexCoord4d(target, s, t, r, q);
+    glad_trace_record(374, glad_start);
+}
+static PFNGLMULTITEXCOORD4DVPROC glad_trace_real_glMultiTexCoord4dv;
+static void APIENTRY glad_trace_glMultiTexCoord4dv(GLenum target, const GLdouble *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiTexCoord4dv(target, v);
+    glad_trace_record(375, glad_start);
+}
+static PFNGLMULTITEXCOORD4FPROC glad_trace_real_glMultiTexCoord4f;
+static void APIENTRY glad_trace_glMultiTexCoord4f(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiTexCoord4f(target, s, t, r, q);
+    glad_trace_record(376, glad_start);
+}
+static PFNGLMULTITEXCOORD4FVPROC glad_trace_real_glMultiTexCoord4fv;
+static void APIENTRY glad_trace_glMultiTexCoord4fv(GLenum target, const GLfloat *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiTexCoord4fv(target, v);
+    glad_trace_record(377, glad_start);
+}
+static PFNGLMULTITEXCOORD4IPROC glad_trace_real_glMultiTexCoord4i;
+static void APIENTRY glad_trace_glMultiTexCoord4i(GLenum target, GLint s, GLint t, GLint r, GLint q) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiTexCoord4i(target, s, t, r, q);
+    glad_trace_record(378, glad_start);
+}
+static PFNGLMULTITEXCOORD4IVPROC glad_trace_real_glMultiTexCoord4iv;
+static void APIENTRY glad_trace_glMultiTexCoord4iv(GLenum target, const GLint *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiTexCoord4iv(target, v);
+    glad_trace_record(379, glad_start);
+}
+static PFNGLMULTITEXCOORD4SPROC glad_trace_real_glMultiTexCoord4s;
+static void APIENTRY glad_trace_glMultiTexCoord4s(GLenum target, GLshort s, GLshort t, GLshort r, GLshort q) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiTexCoord4s(target, s, t, r, q);
+    glad_trace_record(380, glad_start);
+}
+static PFNGLMULTITEXCOORD4SVPROC glad_trace_real_glMultiTexCoord4sv;
+static void APIENTRY glad_trace_glMultiTexCoord4sv(GLenum target, const GLshort *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiTexCoord4sv(target, v);
+    glad_trace_record(381, glad_start);
+}
+static PFNGLLOADTRANSPOSEMATRIXFPROC glad_trace_real_glLoadTransposeMatrixf;
+static void APIENTRY glad_trace_glLoadTransposeMatrixf(const GLfloat *m) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glLoadTransposeMatrixf(m);
+    glad_trace_record(382, glad_start);
+}
+static PFNGLLOADTRANSPOSEMATRIXDPROC glad_trace_real_glLoadTransposeMatrixd;
+static void APIENTRY glad_trace_glLoadTransposeMatrixd(const GLdouble *m) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glLoadTransposeMatrixd(m);
+    glad_trace_record(383, glad_start);
+}
+static PFNGLMULTTRANSPOSEMATRIXFPROC glad_trace_real_glMultTransposeMatrixf;
+static void APIENTRY glad_trace_glMultTransposeMatrixf(const GLfloat *m) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultTransposeMatrixf(m);
+    glad_trace_record(384, glad_start);
+}
+static PFNGLMULTTRANSPOSEMATRIXDPROC glad_trace_real_glMultTransposeMatrixd;
+static void APIENTRY glad_trace_glMultTransposeMatrixd(const GLdouble *m) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultTransposeMatrixd(m);
+    glad_trace_record(385, glad_start);
+}
+static PFNGLBLENDFUNCSEPARATEPROC glad_trace_real_glBlendFuncSeparate;
+static void APIENTRY glad_trace_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+    glad_trace_record(386, glad_start);
+}
+static PFNGLMULTIDRAWARRAYSPROC glad_trace_real_glMultiDrawArrays;
+static void APIENTRY glad_trace_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiDrawArrays(mode, first, count, drawcount);
+    glad_trace_record(387, glad_start);
+}
+static PFNGLMULTIDRAWELEMENTSPROC glad_trace_real_glMultiDrawElements;
+static void APIENTRY glad_trace_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiDrawElements(mode, count, type, indices, drawcount);
+    glad_trace_record(388, glad_start);
+}
+static PFNGLPOINTPARAMETERFPROC glad_trace_real_glPointParameterf;
+static void APIENTRY glad_trace_glPointParameterf(GLenum pname, GLfloat param) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glPointParameterf(pname, param);
+    glad_trace_record(389, glad_start);
+}
+static PFNGLPOINTPARAMETERFVPROC glad_trace_real_glPointParameterfv;
+static void APIENTRY glad_trace_glPointParameterfv(GLenum pname, const GLfloat *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glPointParameterfv(pname, params);
+    glad_trace_record(390, glad_start);
+}
+static PFNGLPOINTPARAMETERIPROC glad_trace_real_glPointParameteri;
+static void APIENTRY glad_trace_glPointParameteri(GLenum pname, GLint param) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glPointParameteri(pname, param);
+    glad_trace_record(391, glad_start);
+}
+static PFNGLPOINTPARAMETERIVPROC glad_trace_real_glPointParameteriv;
+static void APIENTRY glad_trace_glPointParameteriv(GLenum pname, const GLint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glPointParameteriv(pname, params);
+    glad_trace_record(392, glad_start);
+}
+static PFNGLFOGCOORDFPROC glad_trace_real_glFogCoordf;
+static void APIENTRY glad_trace_glFogCoordf(GLfloat coord) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glFogCoordf(coord);
+    glad_trace_record(393, glad_start);
+}
+static PFNGLFOGCOORDFVPROC glad_trace_real_glFogCoordfv;
+static void APIENTRY glad_trace_glFogCoordfv(const GLfloat *coord) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glFogCoordfv(coord);
+    glad_trace_record(394, glad_start);
+}
+static PFNGLFOGCOORDDPROC glad_trace_real_glFogCoordd;
+static void APIENTRY glad_trace_glFogCoordd(GLdouble coord) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glFogCoordd(coord);
+    glad_trace_record(395, glad_start);
+}
+static PFNGLFOGCOORDDVPROC glad_trace_real_glFogCoorddv;
+static void APIENTRY glad_trace_glFogCoorddv(const GLdouble *coord) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glFogCoorddv(coord);
+    glad_trace_record(396, glad_start);
+}
+static PFNGLFOGCOORDPOINTERPROC glad_trace_real_glFogCoordPointer;
+static void APIENTRY glad_trace_glFogCoordPointer(GLenum type, GLsizei stride, const void *pointer) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glFogCoordPointer(type, stride, pointer);
+    glad_trace_record(397, glad_start);
+}
+static PFNGLSECONDARYCOLOR3BPROC glad_trace_real_glSecondaryColor3b;
+static void APIENTRY glad_trace_glSecondaryColor3b(GLbyte red, GLbyte green, GLbyte blue) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glSecondaryColor3b(red, green, blue);
+    glad_trace_record(398, glad_start);
+}
+static PFNGLSECONDARYCOLOR3BVPROC glad_trace_real_glSecondaryColor3bv;
+static void APIENTRY glad_trace_glSecondaryColor3bv(const GLbyte *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glSecondaryColor3bv(v);
+    glad_trace_record(399, glad_start);
+}
+static PFNGLSECONDARYCOLOR3DPROC glad_trace_real_glSecondaryColor3d;
+static void APIENTRY glad_trace_glSecondaryColor3d(GLdouble red, GLdouble green, GLdouble blue) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glSecondaryColor3d(red, green, blue);
+    glad_trace_record(400, glad_start);
+}
+static PFNGLSECONDARYCOLOR3DVPROC glad_trace_real_glSecondaryColor3dv;
+static void APIENTRY glad_trace_glSecondaryColor3dv(const GLdouble *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glSecondaryColor3dv(v);
+    glad_trace_record(401, glad_start);
+}
+static PFNGLSECONDARYCOLOR3FPROC glad_trace_real_glSecondaryColor3f;
+static void APIENTRY glad_trace_glSecondaryColor3f(GLfloat red, GLfloat green, GLfloat blue) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glSecondaryColor3f(red, green, blue);
+    glad_trace_record(402, glad_start);
+}
+static PFNGLSECONDARYCOLOR3FVPROC glad_trace_real_glSecondaryColor3fv;
+static void APIENTRY glad_trace_glSecondaryColor3fv(const GLfloat *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glSecondaryColor3fv(v);
+    glad_trace_record(403, glad_start);
+}
+static PFNGLSECONDARYCOLOR3IPROC glad_trace_real_glSecondaryColor3i;
+static void APIENTRY glad_trace_glSecondaryColor3i(GLint red, GLint green, GLint blue) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glSecondaryColor3i(red, green, blue);
+    glad_trace_record(404, glad_start);
+}
+static PFNGLSECONDARYCOLOR3IVPROC glad_trace_real_glSecondaryColor3iv;
+static void APIENTRY glad_trace_glSecondaryColor3iv(const GLint *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glSecondaryColor3iv(v);
+    glad_trace_record(405, glad_start);
+}
+static PFNGLSECONDARYCOLOR3SPROC glad_trace_real_glSecondaryColor3s;
+static void APIENTRY glad_trace_glSecondaryColor3s(GLshort red, GLshort green, GLshort blue) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glSecondaryColor3s(red, green, blue);
+    glad_trace_record(406, glad_start);
+}
+static PFNGLSECONDARYCOLOR3SVPROC glad_trace_real_glSecondaryColor3sv;
+static void APIENTRY glad_trace_glSecondaryColor3sv(const GLshort *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glSecondaryColor3sv(v);
+    glad_trace_record(407, glad_start);
+}
+static PFNGLSECONDARYCOLOR3UBPROC glad_trace_real_glSecondaryColor3ub;
+static void APIENTRY glad_trace_glSecondaryColor3ub(GLubyte red, GLubyte green, GLubyte blue) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glSecondaryColor3ub(red, green, blue);
+    glad_trace_record(408, glad_start);
+}
+static PFNGLSECONDARYCOLOR3UBVPROC glad_trace_real_glSecondaryColor3ubv;
+static void APIENTRY glad_trace_glSecondaryColor3ubv(const GLubyte *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glSecondaryColor3ubv(v);
+    glad_trace_record(409, glad_start);
+}
+static PFNGLSECONDARYCOLOR3UIPROC glad_trace_real_glSecondaryColor3ui;
+static void APIENTRY glad_trace_glSecondaryColor3ui(GLuint red, GLuint green, GLuint blue) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glSecondaryColor3ui(red, green, blue);
+    glad_trace_record(410, glad_start);
+}
+static PFNGLSECONDARYCOLOR3UIVPROC glad_trace_real_glSecondaryColor3uiv;
+static void APIENTRY glad_trace_glSecondaryColor3uiv(const GLuint *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glSecondaryColor3uiv(v);
+    glad_trace_record(411, glad_start);
+}
+static PFNGLSECONDARYCOLOR3USPROC glad_trace_real_glSecondaryColor3us;
+static void APIENTRY glad_trace_glSecondaryColor3us(GLushort red, GLushort green, GLushort blue) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glSecondaryColor3us(red, green, blue);
+    glad_trace_record(412, glad_start);
+}
+static PFNGLSECONDARYCOLOR3USVPROC glad_trace_real_glSecondaryColor3usv;
+static void APIENTRY glad_trace_glSecondaryColor3usv(const GLushort *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glSecondaryColor3usv(v);
+    glad_trace_record(413, glad_start);
+}
+static PFNGLSECONDARYCOLORPOINTERPROC glad_trace_real_glSecondaryColorPointer;
+static void APIENTRY glad_trace_glSecondaryColorPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glSecondaryColorPointer(size, type, stride, pointer);
+    glad_trace_record(414, glad_start);
+}
+static PFNGLWINDOWPOS2DPROC glad_trace_real_glWindowPos2d;
+static void APIENTRY glad_trace_glWindowPos2d(GLdouble x, GLdouble y) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glWindowPos2d(x, y);
+    glad_trace_record(415, glad_start);
+}
+static PFNGLWINDOWPOS2DVPROC glad_trace_real_glWindowPos2dv;
+static void APIENTRY glad_trace_glWindowPos2dv(const GLdouble *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glWindowPos2dv(v);
+    glad_trace_record(416, glad_start);
+}
+static PFNGLWINDOWPOS2FPROC glad_trace_real_glWindowPos2f;
+static void APIENTRY glad_trace_glWindowPos2f(GLfloat x, GLfloat y) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glWindowPos2f(x, y);
+    glad_trace_record(417, glad_start);
+}
+static PFNGLWINDOWPOS2FVPROC glad_trace_real_glWindowPos2fv;
+static void APIENTRY glad_trace_glWindowPos2fv(const GLfloat *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glWindowPos2fv(v);
+    glad_trace_record(418, glad_start);
+}
+static PFNGLWINDOWPOS2IPROC glad_trace_real_glWindowPos2i;
+static void APIENTRY glad_trace_glWindowPos2i(GLint x, GLint y) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glWindowPos2i(x, y);
+    glad_trace_record(419, glad_start);
+}
+static PFNGLWINDOWPOS2IVPROC glad_trace_real_glWindowPos2iv;
+static void APIENTRY glad_trace_glWindowPos2iv(const GLint *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glWindowPos2iv(v);
+    glad_trace_record(420, glad_start);
+}
+static PFNGLWINDOWPOS2SPROC glad_trace_real_glWindowPos2s;
+static void APIENTRY glad_trace_glWindowPos2s(GLshort x, GLshort y) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glWindowPos2s(x, y);
+    glad_trace_record(421, glad_start);
+}
+static PFNGLWINDOWPOS2SVPROC glad_trace_real_glWindowPos2sv;
+static void APIENTRY glad_trace_glWindowPos2sv(const GLshort *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glWindowPos2sv(v);
+    glad_trace_record(422, glad_start);
+}
+static PFNGLWINDOWPOS3DPROC glad_trace_real_glWindowPos3d;
+static void APIENTRY glad_trace_glWindowPos3d(GLdouble x, GLdouble y, GLdouble z) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glWindowPos3d(x, y, z);
+    glad_trace_record(423, glad_start);
+}
+static PFNGLWINDOWPOS3DVPROC glad_trace_real_glWindowPos3dv;
+static void APIENTRY glad_trace_glWindowPos3dv(const GLdouble *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glWindowPos3dv(v);
+    glad_trace_record(424, glad_start);
+}
+static PFNGLWINDOWPOS3FPROC glad_trace_real_glWindowPos3f;
+static void APIENTRY glad_trace_glWindowPos3f(GLfloat x, GLfloat y, GLfloat z) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glWindowPos3f(x, y, z);
+    glad_trace_record(425, glad_start);
+}
+static PFNGLWINDOWPOS3FVPROC glad_trace_real_glWindowPos3fv;
+static void APIENTRY glad_trace_glWindowPos3fv(const GLfloat *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glWindowPos3fv(v);
+    glad_trace_record(426, glad_start);
+}
+static PFNGLWINDOWPOS3IPROC glad_trace_real_glWindowPos3i;
+static void APIENTRY glad_trace_glWindowPos3i(GLint x, GLint y, GLint z) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glWindowPos3i(x, y, z);
+    glad_trace_record(427, glad_start);
+}
+static PFNGLWINDOWPOS3IVPROC glad_trace_real_glWindowPos3iv;
+static void APIENTRY glad_trace_glWindowPos3iv(const GLint *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glWindowPos3iv(v);
+    glad_trace_record(428, glad_start);
+}
+static PFNGLWINDOWPOS3SPROC glad_trace_real_glWindowPos3s;
+static void APIENTRY glad_trace_glWindowPos3s(GLshort x, GLshort y, GLshort z) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glWindowPos3s(x, y, z);
+    glad_trace_record(429, glad_start);
+}
+static PFNGLWINDOWPOS3SVPROC glad_trace_real_glWindowPos3sv;
+static void APIENTRY glad_trace_glWindowPos3sv(const GLshort *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glWindowPos3sv(v);
+    glad_trace_record(430, glad_start);
+}
+static PFNGLBLENDCOLORPROC glad_trace_real_glBlendColor;
+static void APIENTRY glad_trace_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glBlendColor(red, green, blue, alpha);
+    glad_trace_record(431, glad_start);
+}
+static PFNGLBLENDEQUATIONPROC glad_trace_real_glBlendEquation;
+static void APIENTRY glad_trace_glBlendEquation(GLenum mode) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glBlendEquation(mode);
+    glad_trace_record(432, glad_start);
+}
+static PFNGLGENQUERIESPROC glad_trace_real_glGenQueries;
+static void APIENTRY glad_trace_glGenQueries(GLsizei n, GLuint *ids) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGenQueries(n, ids);
+    glad_trace_record(433, glad_start);
+}
+static PFNGLDELETEQUERIESPROC glad_trace_real_glDeleteQueries;
+static void APIENTRY glad_trace_glDeleteQueries(GLsizei n, const GLuint *ids) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDeleteQueries(n, ids);
+    glad_trace_record(434, glad_start);
+}
+static PFNGLISQUERYPROC glad_trace_real_glIsQuery;
+static GLboolean APIENTRY glad_trace_glIsQuery(GLuint id) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    GLboolean glad_result = glad_trace_real_glIsQuery(id);
+    glad_trace_record(435, glad_start);
+    return glad_result;
+}
+static PFNGLBEGINQUERYPROC glad_trace_real_glBeginQuery;
+static void APIENTRY glad_trace_glBeginQuery(GLenum target, GLuint id) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glBeginQuery(target, id);
+    glad_trace_record(436, glad_start);
+}
+static PFNGLENDQUERYPROC glad_trace_real_glEndQuery;
+static void APIENTRY glad_trace_glEndQuery(GLenum target) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glEndQuery(target);
+    glad_trace_record(437, glad_start);
+}
+static PFNGLGETQUERYIVPROC glad_trace_real_glGetQueryiv;
+static void APIENTRY glad_trace_glGetQueryiv(GLenum target, GLenum pname, GLint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetQueryiv(target, pname, params);
+    glad_trace_record(438, glad_start);
+}
+static PFNGLGETQUERYOBJECTIVPROC glad_trace_real_glGetQueryObjectiv;
+static void APIENTRY glad_trace_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetQueryObjectiv(id, pname, params);
+    glad_trace_record(439, glad_start);
+}
+static PFNGLGETQUERYOBJECTUIVPROC glad_trace_real_glGetQueryObjectuiv;
+static void APIENTRY glad_trace_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetQueryObjectuiv(id, pname, params);
+    glad_trace_record(440, glad_start);
+}
+static PFNGLBINDBUFFERPROC glad_trace_real_glBindBuffer;
+static void APIENTRY glad_trace_glBindBuffer(GLenum target, GLuint buffer) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glBindBuffer(target, buffer);
+    glad_trace_record(441, glad_start);
+}
+static PFNGLDELETEBUFFERSPROC glad_trace_real_glDeleteBuffers;
+static void APIENTRY glad_trace_glDeleteBuffers(GLsizei n, const GLuint *buffers) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDeleteBuffers(n, buffers);
+    glad_trace_record(442, glad_start);
+}
+static PFNGLGENBUFFERSPROC glad_trace_real_glGenBuffers;
+static void APIENTRY glad_trace_glGenBuffers(GLsizei n, GLuint *buffers) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGenBuffers(n, buffers);
+    glad_trace_record(443, glad_start);
+}
+static PFNGLISBUFFERPROC glad_trace_real_glIsBuffer;
+static GLboolean APIENTRY glad_trace_glIsBuffer(GLuint buffer) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    GLboolean glad_result = glad_trace_real_glIsBuffer(buffer);
+    glad_trace_record(444, glad_start);
+    return glad_result;
+}
+static PFNGLBUFFERDATAPROC glad_trace_real_glBufferData;
+static void APIENTRY glad_trace_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glBufferData(target, size, data, usage);
+    glad_trace_record(445, glad_start);
+}
+static PFNGLBUFFERSUBDATAPROC glad_trace_real_glBufferSubData;
+static void APIENTRY glad_trace_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glBufferSubData(target, offset, size, data);
+    glad_trace_record(446, glad_start);
+}
+static PFNGLGETBUFFERSUBDATAPROC glad_trace_real_glGetBufferSubData;
+static void APIENTRY glad_trace_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetBufferSubData(target, offset, size, data);
+    glad_trace_record(447, glad_start);
+}
+static PFNGLMAPBUFFERPROC glad_trace_real_glMapBuffer;
+static void * APIENTRY glad_trace_glMapBuffer(GLenum target, GLenum access) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    void * glad_result = glad_trace_real_glMapBuffer(target, access);
+    glad_trace_record(448, glad_start);
+    return glad_result;
+}
+static PFNGLUNMAPBUFFERPROC glad_trace_real_glUnmapBuffer;
+static GLboolean APIENTRY glad_trace_glUnmapBuffer(GLenum target) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    GLboolean glad_result = glad_trace_real_glUnmapBuffer(target);
+    glad_trace_record(449, glad_start);
+    return glad_result;
+}
+static PFNGLGETBUFFERPARAMETERIVPROC glad_trace_real_glGetBufferParameteriv;
+static void APIENTRY glad_trace_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetBufferParameteriv(target, pname, params);
+    glad_trace_record(450, glad_start);
+}
+static PFNGLGETBUFFERPOINTERVPROC glad_trace_real_glGetBufferPointerv;
+static void APIENTRY glad_trace_glGetBufferPointerv(GLenum target, GLenum pname, void **params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetBufferPointerv(target, pname, params);
+    glad_trace_record(451, glad_start);
+}
+static PFNGLBLENDEQUATIONSEPARATEPROC glad_trace_real_glBlendEquationSeparate;
+static void APIENTRY glad_trace_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glBlendEquationSeparate(modeRGB, modeAlpha);
+    glad_trace_record(452, glad_start);
+}
+static PFNGLDRAWBUFFERSPROC glad_trace_real_glDrawBuffers;
+static void APIENTRY glad_trace_glDrawBuffers(GLsizei n, const GLenum *bufs) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDrawBuffers(n, bufs);
+    glad_trace_record(453, glad_start);
+}
+static PFNGLSTENCILOPSEPARATEPROC glad_trace_real_glStencilOpSeparate;
+static void APIENTRY glad_trace_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glStencilOpSeparate(face, sfail, dpfail, dppass);
+    glad_trace_record(454, glad_start);
+}
+static PFNGLSTENCILFUNCSEPARATEPROC glad_trace_real_glStencilFuncSeparate;
+static void APIENTRY glad_trace_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glStencilFuncSeparate(face, func, ref, mask);
+    glad_trace_record(455, glad_start);
+}
+static PFNGLSTENCILMASKSEPARATEPROC glad_trace_real_glStencilMaskSeparate;
+static void APIENTRY glad_trace_glStencilMaskSeparate(GLenum face, GLuint mask) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glStencilMaskSeparate(face, mask);
+    glad_trace_record(456, glad_start);
+}
+static PFNGLATTACHSHADERPROC glad_trace_real_glAttachShader;
+static void APIENTRY glad_trace_glAttachShader(GLuint program, GLuint shader) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glAttachShader(program, shader);
+    glad_trace_record(457, glad_start);
+}
+static PFNGLBINDATTRIBLOCATIONPROC glad_trace_real_glBindAttribLocation;
+static void APIENTRY glad_trace_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glBindAttribLocation(program, index, name);
+    glad_trace_record(458, glad_start);
+}
+static PFNGLCOMPILESHADERPROC glad_trace_real_glCompileShader;
+static void APIENTRY glad_trace_glCompileShader(GLuint shader) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glCompileShader(shader);
+    glad_trace_record(459, glad_start);
+}
+static PFNGLCREATEPROGRAMPROC glad_trace_real_glCreateProgram;
+static GLuint APIENTRY glad_trace_glCreateProgram(void) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    GLuint glad_result = glad_trace_real_glCreateProgram();
+    glad_trace_record(460, glad_start);
+    return glad_result;
+}
+static PFNGLCREATESHADERPROC glad_trace_real_glCreateShader;
+static GLuint APIENTRY glad_trace_glCreateShader(GLenum type) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    GLuint glad_result = glad_trace_real_glCreateShader(type);
+    glad_trace_record(461, glad_start);
+    return glad_result;
+}
+static PFNGLDELETEPROGRAMPROC glad_trace_real_glDeleteProgram;
+static void APIENTRY glad_trace_glDeleteProgram(GLuint program) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDeleteProgram(program);
+    glad_trace_record(462, glad_start);
+}
+static PFNGLDELETESHADERPROC glad_trace_real_glDeleteShader;
+static void APIENTRY glad_trace_glDeleteShader(GLuint shader) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDeleteShader(shader);
+    glad_trace_record(463, glad_start);
+}
+static PFNGLDETACHSHADERPROC glad_trace_real_glDetachShader;
+static void APIENTRY glad_trace_glDetachShader(GLuint program, GLuint shader) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDetachShader(program, shader);
+    glad_trace_record(464, glad_start);
+}
+static PFNGLDISABLEVERTEXATTRIBARRAYPROC glad_trace_real_glDisableVertexAttribArray;
+static void APIENTRY glad_trace_glDisableVertexAttribArray(GLuint index) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDisableVertexAttribArray(index);
+    glad_trace_record(465, glad_start);
+}
+static PFNGLENABLEVERTEXATTRIBARRAYPROC glad_trace_real_glEnableVertexAttribArray;
+static void APIENTRY glad_trace_glEnableVertexAttribArray(GLuint index) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glEnableVertexAttribArray(index);
+    glad_trace_record(466, glad_start);
+}
+static PFNGLGETACTIVEATTRIBPROC glad_trace_real_glGetActiveAttrib;
+static void APIENTRY glad_trace_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetActiveAttrib(program, index, bufSize, length, size, type, name);
+    glad_trace_record(467, glad_start);
+}
+static PFNGLGETACTIVEUNIFORMPROC glad_trace_real_glGetActiveUniform;
+static void APIENTRY glad_trace_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetActiveUniform(program, index, bufSize, length, size, type, name);
+    glad_trace_record(468, glad_start);
+}
+static PFNGLGETATTACHEDSHADERSPROC glad_trace_real_glGetAttachedShaders;
+static void APIENTRY glad_trace_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetAttachedShaders(program, maxCount, count, shaders);
+    glad_trace_record(469, glad_start);
+}
+static PFNGLGETATTRIBLOCATIONPROC glad_trace_real_glGetAttribLocation;
+static GLint APIENTRY glad_trace_glGetAttribLocation(GLuint program, const GLchar *name) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    GLint glad_result = glad_trace_real_glGetAttribLocation(program, name);
+    glad_trace_record(470, glad_start);
+    return glad_result;
+}
+static PFNGLGETPROGRAMIVPROC glad_trace_real_glGetProgramiv;
+static void APIENTRY glad_trace_glGetProgramiv(GLuint program, GLenum pname, GLint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetProgramiv(program, pname, params);
+    glad_trace_record(471, glad_start);
+}
+static PFNGLGETPROGRAMINFOLOGPROC glad_trace_real_glGetProgramInfoLog;
+static void APIENTRY glad_trace_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetProgramInfoLog(program, bufSize, length, infoLog);
+    glad_trace_record(472, glad_start);
+}
+static PFNGLGETSHADERIVPROC glad_trace_real_glGetShaderiv;
+static void APIENTRY glad_trace_glGetShaderiv(GLuint shader, GLenum pname, GLint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetShaderiv(shader, pname, params);
+    glad_trace_record(473, glad_start);
+}
+static PFNGLGETSHADERINFOLOGPROC glad_trace_real_glGetShaderInfoLog;
+static void APIENTRY glad_trace_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetShaderInfoLog(shader, bufSize, length, infoLog);
+    glad_trace_record(474, glad_start);
+}
+static PFNGLGETSHADERSOURCEPROC glad_trace_real_glGetShaderSource;
+static void APIENTRY glad_trace_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetShaderSource(shader, bufSize, length, source);
+    glad_trace_record(475, glad_start);
+}
+static PFNGLGETUNIFORMLOCATIONPROC glad_trace_real_glGetUniformLocation;
+static GLint APIENTRY glad_trace_glGetUniformLocation(GLuint program, const GLchar *name) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    GLint glad_result = glad_trace_real_glGetUniformLocation(program, name);
+    glad_trace_record(476, glad_start);
+    return glad_result;
+}
+static PFNGLGETUNIFORMFVPROC glad_trace_real_glGetUniformfv;
+static void APIENTRY glad_trace_glGetUniformfv(GLuint program, GLint location, GLfloat *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetUniformfv(program, location, params);
+    glad_trace_record(477, glad_start);
+}
+static PFNGLGETUNIFORMIVPROC glad_trace_real_glGetUniformiv;
+static void APIENTRY glad_trace_glGetUniformiv(GLuint program, GLint location, GLint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetUniformiv(program, location, params);
+    glad_trace_record(478, glad_start);
+}
+static PFNGLGETVERTEXATTRIBDVPROC glad_trace_real_glGetVertexAttribdv;
+static void APIENTRY glad_trace_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetVertexAttribdv(index, pname, params);
+    glad_trace_record(479, glad_start);
+}
+static PFNGLGETVERTEXATTRIBFVPROC glad_trace_real_glGetVertexAttribfv;
+static void APIENTRY glad_trace_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetVertexAttribfv(index, pname, params);
+    glad_trace_record(480, glad_start);
+}
+static PFNGLGETVERTEXATTRIBIVPROC glad_trace_real_glGetVertexAttribiv;
+static void APIENTRY glad_trace_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetVertexAttribiv(index, pname, params);
+    glad_trace_record(481, glad_start);
+}
+static PFNGLGETVERTEXATTRIBPOINTERVPROC glad_trace_real_glGetVertexAttribPointerv;
+static void APIENTRY glad_trace_glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetVertexAttribPointerv(index, pname, pointer);
+    glad_trace_record(482, glad_start);
+}
+static PFNGLISPROGRAMPROC glad_trace_real_glIsProgram;
+static GLboolean APIENTRY glad_trace_glIsProgram(GLuint program) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    GLboolean glad_result = glad_trace_real_glIsProgram(program);
+    glad_trace_record(483, glad_start);
+    return glad_result;
+}
+static PFNGLISSHADERPROC glad_trace_real_glIsShader;
+static GLboolean APIENTRY glad_trace_glIsShader(GLuint shader) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    GLboolean glad_result = glad_trace_real_glIsShader(shader);
+    glad_trace_record(484, glad_start);
+    return glad_result;
+}
+static PFNGLLINKPROGRAMPROC glad_trace_real_glLinkProgram;
+static void APIENTRY glad_trace_glLinkProgram(GLuint program) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glLinkProgram(program);
+    glad_trace_record(485, glad_start);
+}
+static PFNGLSHADERSOURCEPROC glad_trace_real_glShaderSource;
+static void APIENTRY glad_trace_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glShaderSource(shader, count, string, length);
+    glad_trace_record(486, glad_start);
+}
+static PFNGLUSEPROGRAMPROC glad_trace_real_glUseProgram;
+static void APIENTRY glad_trace_glUseProgram(GLuint program) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUseProgram(program);
+    glad_trace_record(487, glad_start);
+}
+static PFNGLUNIFORM1FPROC glad_trace_real_glUniform1f;
+static void APIENTRY glad_trace_glUniform1f(GLint location, GLfloat v0) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniform1f(location, v0);
+    glad_trace_record(488, glad_start);
+}
+static PFNGLUNIFORM2FPROC glad_trace_real_glUniform2f;
+static void APIENTRY glad_trace_glUniform2f(GLint location, GLfloat v0, GLfloat v1) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniform2f(location, v0, v1);
+    glad_trace_record(489, glad_start);
+}
+static PFNGLUNIFORM3FPROC glad_trace_real_glUniform3f;
+static void APIENTRY glad_trace_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniform3f(location, v0, v1, v2);
+    glad_trace_record(490, glad_start);
+}
+static PFNGLUNIFORM4FPROC glad_trace_real_glUniform4f;
+static void APIENTRY glad_trace_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniform4f(location, v0, v1, v2, v3);
+    glad_trace_record(491, glad_start);
+}
+static PFNGLUNIFORM1IPROC glad_trace_real_glUniform1i;
+static void APIENTRY glad_trace_glUniform1i(GLint location, GLint v0) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniform1i(location, v0);
+    glad_trace_record(492, glad_start);
+}
+static PFNGLUNIFORM2IPROC glad_trace_real_glUniform2i;
+static void APIENTRY glad_trace_glUniform2i(GLint location, GLint v0, GLint v1) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniform2i(location, v0, v1);
+    glad_trace_record(493, glad_start);
+}
+static PFNGLUNIFORM3IPROC glad_trace_real_glUniform3i;
+static void APIENTRY glad_trace_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniform3i(location, v0, v1, v2);
+    glad_trace_record(494, glad_start);
+}
+static PFNGLUNIFORM4IPROC glad_trace_real_glUniform4i;
+static void APIENTRY glad_trace_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniform4i(location, v0, v1, v2, v3);
+    glad_trace_record(495, glad_start);
+}
+static PFNGLUNIFORM1FVPROC glad_trace_real_glUniform1fv;
+static void APIENTRY glad_trace_glUniform1fv(GLint location, GLsizei count, const GLfloat *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniform1fv(location, count, value);
+    glad_trace_record(496, glad_start);
+}
+static PFNGLUNIFORM2FVPROC glad_trace_real_glUniform2fv;
+static void APIENTRY glad_trace_glUniform2fv(GLint location, GLsizei count, const GLfloat *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniform2fv(location, count, value);
+    glad_trace_record(497, glad_start);
+}
+static PFNGLUNIFORM3FVPROC glad_trace_real_glUniform3fv;
+static void APIENTRY glad_trace_glUniform3fv(GLint location, GLsizei count, const GLfloat *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniform3fv(location, count, value);
+    glad_trace_record(498, glad_start);
+}
+static PFNGLUNIFORM4FVPROC glad_trace_real_glUniform4fv;
+static void APIENTRY glad_trace_glUniform4fv(GLint location, GLsizei count, const GLfloat *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniform4fv(location, count, value);
+    glad_trace_record(499, glad_start);
+}
+static PFNGLUNIFORM1IVPROC glad_trace_real_glUniform1iv;
+static void APIENTRY glad_trace_glUniform1iv(GLint location, GLsizei count, const GLint *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniform1iv(location, count, value);
+    glad_trace_record(500, glad_start);
+}
+static PFNGLUNIFORM2IVPROC glad_trace_real_glUniform2iv;
+static void APIENTRY glad_trace_glUniform2iv(GLint location, GLsizei count, const GLint *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniform2iv(location, count, value);
+    glad_trace_record(501, glad_start);
+}
+static PFNGLUNIFORM3IVPROC glad_trace_real_glUniform3iv;
+static void APIENTRY glad_trace_glUniform3iv(GLint location, GLsizei count, const GLint *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniform3iv(location, count, value);
+    glad_trace_record(502, glad_start);
+}
+static PFNGLUNIFORM4IVPROC glad_trace_real_glUniform4iv;
+static void APIENTRY glad_trace_glUniform4iv(GLint location, GLsizei count, const GLint *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniform4iv(location, count, value);
+    glad_trace_record(503, glad_start);
+}
+static PFNGLUNIFORMMATRIX2FVPROC glad_trace_real_glUniformMatrix2fv;
+static void APIENTRY glad_trace_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniformMatrix2fv(location, count, transpose, value);
+    glad_trace_record(504, glad_start);
+}
+static PFNGLUNIFORMMATRIX3FVPROC glad_trace_real_glUniformMatrix3fv;
+static void APIENTRY glad_trace_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniformMatrix3fv(location, count, transpose, value);
+    glad_trace_record(505, glad_start);
+}
+static PFNGLUNIFORMMATRIX4FVPROC glad_trace_real_glUniformMatrix4fv;
+static void APIENTRY glad_trace_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniformMatrix4fv(location, count, transpose, value);
+    glad_trace_record(506, glad_start);
+}
+static PFNGLVALIDATEPROGRAMPROC glad_trace_real_glValidateProgram;
+static void APIENTRY glad_trace_glValidateProgram(GLuint program) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glValidateProgram(program);
+    glad_trace_record(507, glad_start);
+}
+static PFNGLVERTEXATTRIB1DPROC glad_trace_real_glVertexAttrib1d;
+static void APIENTRY glad_trace_glVertexAttrib1d(GLuint index, GLdouble x) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttrib1d(index, x);
+    glad_trace_record(508, glad_start);
+}
+static PFNGLVERTEXATTRIB1DVPROC glad_trace_real_glVertexAttrib1dv;
+static void APIENTRY glad_trace_glVertexAttrib1dv(GLuint index, const GLdouble *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttrib1dv(index, v);
+    glad_trace_record(509, glad_start);
+}
+static PFNGLVERTEXATTRIB1FPROC glad_trace_real_glVertexAttrib1f;
+static void APIENTRY glad_trace_glVertexAttrib1f(GLuint index, GLfloat x) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttrib1f(index, x);
+    glad_trace_record(510, glad_start);
+}
+static PFNGLVERTEXATTRIB1FVPROC glad_trace_real_glVertexAttrib1fv;
+static void APIENTRY glad_trace_glVertexAttrib1fv(GLuint index, const GLfloat *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttrib1fv(index, v);
+    glad_trace_record(511, glad_start);
+}
+static PFNGLVERTEXATTRIB1SPROC glad_trace_real_glVertexAttrib1s;
+static void APIENTRY glad_trace_glVertexAttrib1s(GLuint index, GLshort x) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttrib1s(index, x);
+    glad_trace_record(512, glad_start);
+}
+static PFNGLVERTEXATTRIB1SVPROC glad_trace_real_glVertexAttrib1sv;
+static void APIENTRY glad_trace_glVertexAttrib1sv(GLuint index, const GLshort *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttrib1sv(index, v);
+    glad_trace_record(513, glad_start);
+}
+static PFNGLVERTEXATTRIB2DPROC glad_trace_real_glVertexAttrib2d;
+static void APIENTRY glad_trace_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttrib2d(index, x, y);
+    glad_trace_record(514, glad_start);
+}
+static PFNGLVERTEXATTRIB2DVPROC glad_trace_real_glVertexAttrib2dv;
+static void APIENTRY glad_trace_glVertexAttrib2dv(GLuint index, const GLdouble *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttrib2dv(index, v);
+    glad_trace_record(515, glad_start);
+}
+static PFNGLVERTEXATTRIB2FPROC glad_trace_real_glVertexAttrib2f;
+static void APIENTRY glad_trace_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttrib2f(index, x, y);
+    glad_trace_record(516, glad_start);
+}
+static PFNGLVERTEXATTRIB2FVPROC glad_trace_real_glVertexAttrib2fv;
+static void APIENTRY glad_trace_glVertexAttrib2fv(GLuint index, const GLfloat *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttrib2fv(index, v);
+    glad_trace_record(517, glad_start);
+}
+static PFNGLVERTEXATTRIB2SPROC glad_trace_real_glVertexAttrib2s;
+static void APIENTRY glad_trace_glVertexAttrib2s(GLuint index, GLshort x, GLshort y) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttrib2s(index, x, y);
+    glad_trace_record(518, glad_start);
+}
+static PFNGLVERTEXATTRIB2SVPROC glad_trace_real_glVertexAttrib2sv;
+static void APIENTRY glad_trace_glVertexAttrib2sv(GLuint index, const GLshort *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttrib2sv(index, v);
+    glad_trace_record(519, glad_start);
+}
+static PFNGLVERTEXATTRIB3DPROC glad_trace_real_glVertexAttrib3d;
+static void APIENTRY glad_trace_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttrib3d(index, x, y, z);
+    glad_trace_record(520, glad_start);
+}
+static PFNGLVERTEXATTRIB3DVPROC glad_trace_real_glVertexAttrib3dv;
+static void APIENTRY glad_trace_glVertexAttrib3dv(GLuint index, const GLdouble *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttrib3dv(index, v);
+    glad_trace_record(521, glad_start);
+}
+static PFNGLVERTEXATTRIB3FPROC glad_trace_real_glVertexAttrib3f;
+static void APIENTRY glad_trace_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttrib3f(index, x, y, z);
+    glad_trace_record(522, glad_start);
+}
+static PFNGLVERTEXATTRIB3FVPROC glad_trace_real_glVertexAttrib3fv;
+static void APIENTRY glad_trace_glVertexAttrib3fv(GLuint index, const GLfloat *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttrib3fv(index, v);
+    glad_trace_record(523, glad_start);
+}
+static PFNGLVERTEXATTRIB3SPROC glad_trace_real_glVertexAttrib3s;
+static void APIENTRY glad_trace_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttrib3s(index, x, y, z);
+    glad_trace_record(524, glad_start);
+}
+static PFNGLVERTEXATTRIB3SVPROC glad_trace_real_glVertexAttrib3sv;
+static void APIENTRY glad_trace_glVertexAttrib3sv(GLuint index, const GLshort *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttrib3sv(index, v);
+    glad_trace_record(525, glad_start);
+}
+static PFNGLVERTEXATTRIB4NBVPROC glad_trace_real_glVertexAttrib4Nbv;
+static void APIENTRY glad_trace_glVertexAttrib4Nbv(GLuint index, const GLbyte *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttrib4Nbv(index, v);
+    glad_trace_record(526, glad_start);
+}
+static PFNGLVERTEXATTRIB4NIVPROC glad_trace_real_glVertexAttrib4Niv;
+static void APIENTRY glad_trace_glVertexAttrib4Niv(GLuint index, const GLint *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttrib4Niv(index, v);
+    glad_trace_record(527, glad_start);
+}
+static PFNGLVERTEXATTRIB4NSVPROC glad_trace_real_glVertexAttrib4Nsv;
+static void APIENTRY glad_trace_glVertexAttrib4Nsv(GLuint index, const GLshort *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttrib4Nsv(index, v);
+    glad_trace_record(528, glad_start);
+}
+static PFNGLVERTEXATTRIB4NUBPROC glad_trace_real_glVertexAttrib4Nub;
+static void APIENTRY glad_trace_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttrib4Nub(index, x, y, z, w);
+    glad_trace_record(529, glad_start);
+}
+static PFNGLVERTEXATTRIB4NUBVPROC glad_trace_real_glVertexAttrib4Nubv;
+static void APIENTRY glad_trace_glVertexAttrib4Nubv(GLuint index, const GLubyte *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttrib4Nubv(index, v);
+    glad_trace_record(530, glad_start);
+}
+static PFNGLVERTEXATTRIB4NUIVPROC glad_trace_real_glVertexAttrib4Nuiv;
+static void APIENTRY glad_trace_glVertexAttrib4Nuiv(GLuint index, const GLuint *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttrib4Nuiv(index, v);
+    glad_trace_record(531, glad_start);
+}
+static PFNGLVERTEXATTRIB4NUSVPROC glad_trace_real_glVertexAttrib4Nusv;
+static void APIENTRY glad_trace_glVertexAttrib4Nusv(GLuint index, const GLushort *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttrib4Nusv(index, v);
+    glad_trace_record(532, glad_start);
+}
+static PFNGLVERTEXATTRIB4BVPROC glad_trace_real_glVertexAttrib4bv;
+static void APIENTRY glad_trace_glVertexAttrib4bv(GLuint index, const GLbyte *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttrib4bv(index, v);
+    glad_trace_record(533, glad_start);
+}
+static PFNGLVERTEXATTRIB4DPROC glad_trace_real_glVertexAttrib4d;
+static void APIENTRY glad_trace_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttrib4d(index, x, y, z, w);
+    glad_trace_record(534, glad_start);
+}
+static PFNGLVERTEXATTRIB4DVPROC glad_trace_real_glVertexAttrib4dv;
+static void APIENTRY glad_trace_glVertexAttrib4dv(GLuint index, const GLdouble *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttrib4dv(index, v);
+    glad_trace_record(535, glad_start);
+}
+static PFNGLVERTEXATTRIB4FPROC glad_trace_real_glVertexAttrib4f;
+static void APIENTRY glad_trace_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttrib4f(index, x, y, z, w);
+    glad_trace_record(536, glad_start);
+}
+static PFNGLVERTEXATTRIB4FVPROC glad_trace_real_glVertexAttrib4fv;
+static void APIENTRY glad_trace_glVertexAttrib4fv(GLuint index, const GLfloat *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttrib4fv(index, v);
+    glad_trace_record(537, glad_start);
+}
+static PFNGLVERTEXATTRIB4IVPROC glad_trace_real_glVertexAttrib4iv;
+static void APIENTRY glad_trace_glVertexAttrib4iv(GLuint index, const GLint *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttrib4iv(index, v);
+    glad_trace_record(538, glad_start);
+}
+static PFNGLVERTEXATTRIB4SPROC glad_trace_real_glVertexAttrib4s;
+static void APIENTRY glad_trace_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttrib4s(index, x, y, z, w);
+    glad_trace_record(539, glad_start);
+}
+static PFNGLVERTEXATTRIB4SVPROC glad_trace_real_glVertexAttrib4sv;
+static void APIENTRY glad_trace_glVertexAttrib4sv(GLuint index, const GLshort *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttrib4sv(index, v);
+    glad_trace_record(540, glad_start);
+}
+static PFNGLVERTEXATTRIB4UBVPROC glad_trace_real_glVertexAttrib4ubv;
+static void APIENTRY glad_trace_glVertexAttrib4ubv(GLuint index, const GLubyte *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttrib4ubv(index, v);
+    glad_trace_record(541, glad_start);
+}
+static PFNGLVERTEXATTRIB4UIVPROC glad_trace_real_glVertexAttrib4uiv;
+static void APIENTRY glad_trace_glVertexAttrib4uiv(GLuint index, const GLuint *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttrib4uiv(index, v);
+    glad_trace_record(542, glad_start);
+}
+static PFNGLVERTEXATTRIB4USVPROC glad_trace_real_glVertexAttrib4usv;
+static void APIENTRY glad_trace_glVertexAttrib4usv(GLuint index, const GLushort *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttrib4usv(index, v);
+    glad_trace_record(543, glad_start);
+}
+static PFNGLVERTEXATTRIBPOINTERPROC glad_trace_real_glVertexAttribPointer;
+static void APIENTRY glad_trace_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+    glad_trace_record(544, glad_start);
+}
+static PFNGLUNIFORMMATRIX2X3FVPROC glad_trace_real_glUniformMatrix2x3fv;
+static void APIENTRY glad_trace_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniformMatrix2x3fv(location, count, transpose, value);
+    glad_trace_record(545, glad_start);
+}
+static PFNGLUNIFORMMATRIX3X2FVPROC glad_trace_real_glUniformMatrix3x2fv;
+static void APIENTRY glad_trace_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniformMatrix3x2fv(location, count, transpose, value);
+    glad_trace_record(546, glad_start);
+}
+static PFNGLUNIFORMMATRIX2X4FVPROC glad_trace_real_glUniformMatrix2x4fv;
+static void APIENTRY glad_trace_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniformMatrix2x4fv(location, count, transpose, value);
+    glad_trace_record(547, glad_start);
+}
+static PFNGLUNIFORMMATRIX4X2FVPROC glad_trace_real_glUniformMatrix4x2fv;
+static void APIENTRY glad_trace_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniformMatrix4x2fv(location, count, transpose, value);
+    glad_trace_record(548, glad_start);
+}
+static PFNGLUNIFORMMATRIX3X4FVPROC glad_trace_real_glUniformMatrix3x4fv;
+static void APIENTRY glad_trace_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniformMatrix3x4fv(location, count, transpose, value);
+    glad_trace_record(549, glad_start);
+}
+static PFNGLUNIFORMMATRIX4X3FVPROC glad_trace_real_glUniformMatrix4x3fv;
+static void APIENTRY glad_trace_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniformMatrix4x3fv(location, count, transpose, value);
+    glad_trace_record(550, glad_start);
+}
+static PFNGLCOLORMASKIPROC glad_trace_real_glColorMaski;
+static void APIENTRY glad_trace_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glColorMaski(index, r, g, b, a);
+    glad_trace_record(551, glad_start);
+}
+static PFNGLGETBOOLEANI_VPROC glad_trace_real_glGetBooleani_v;
+static void APIENTRY glad_trace_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetBooleani_v(target, index, data);
+    glad_trace_record(552, glad_start);
+}
+static PFNGLGETINTEGERI_VPROC glad_trace_real_glGetIntegeri_v;
+static void APIENTRY glad_trace_glGetIntegeri_v(GLenum target, GLuint index, GLint *data) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetIntegeri_v(target, index, data);
+    glad_trace_record(553, glad_start);
+}
+static PFNGLENABLEIPROC glad_trace_real_glEnablei;
+static void APIENTRY glad_trace_glEnablei(GLenum target, GLuint index) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glEnablei(target, index);
+    glad_trace_record(554, glad_start);
+}
+static PFNGLDISABLEIPROC glad_trace_real_glDisablei;
+static void APIENTRY glad_trace_glDisablei(GLenum target, GLuint index) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDisablei(target, index);
+    glad_trace_record(555, glad_start);
+}
+static PFNGLISENABLEDIPROC glad_trace_real_glIsEnabledi;
+static GLboolean APIENTRY glad_trace_glIsEnabledi(GLenum target, GLuint index) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    GLboolean glad_result = glad_trace_real_glIsEnabledi(target, index);
+    glad_trace_record(556, glad_start);
+    return glad_result;
+}
+static PFNGLBEGINTRANSFORMFEEDBACKPROC glad_trace_real_glBeginTransformFeedback;
+static void APIENTRY glad_trace_glBeginTransformFeedback(GLenum primitiveMode) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glBeginTransformFeedback(primitiveMode);
+    glad_trace_record(557, glad_start);
+}
+static PFNGLENDTRANSFORMFEEDBACKPROC glad_trace_real_glEndTransformFeedback;
+static void APIENTRY glad_trace_glEndTransformFeedback(void) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glEndTransformFeedback();
+    glad_trace_record(558, glad_start);
+}
+static PFNGLBINDBUFFERRANGEPROC glad_trace_real_glBindBufferRange;
+static void APIENTRY glad_trace_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glBindBufferRange(target, index, buffer, offset, size);
+    glad_trace_record(559, glad_start);
+}
+static PFNGLBINDBUFFERBASEPROC glad_trace_real_glBindBufferBase;
+static void APIENTRY glad_trace_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glBindBufferBase(target, index, buffer);
+    glad_trace_record(560, glad_start);
+}
+static PFNGLTRANSFORMFEEDBACKVARYINGSPROC glad_trace_real_glTransformFeedbackVaryings;
+static void APIENTRY glad_trace_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTransformFeedbackVaryings(program, count, varyings, bufferMode);
+    glad_trace_record(561, glad_start);
+}
+static PFNGLGETTRANSFORMFEEDBACKVARYINGPROC glad_trace_real_glGetTransformFeedbackVarying;
+static void APIENTRY glad_trace_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+    glad_trace_record(562, glad_start);
+}
+static PFNGLCLAMPCOLORPROC glad_trace_real_glClampColor;
+static void APIENTRY glad_trace_glClampColor(GLenum target, GLenum clamp) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glClampColor(target, clamp);
+    glad_trace_record(563, glad_start);
+}
+static PFNGLBEGINCONDITIONALRENDERPROC glad_trace_real_glBeginConditionalRender;
+static void APIENTRY glad_trace_glBeginConditionalRender(GLuint id, GLenum mode) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glBeginConditionalRender(id, mode);
+    glad_trace_record(564, glad_start);
+}
+static PFNGLENDCONDITIONALRENDERPROC glad_trace_real_glEndConditionalRender;
+static void APIENTRY glad_trace_glEndConditionalRender(void) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glEndConditionalRender();
+    glad_trace_record(565, glad_start);
+}
+static PFNGLVERTEXATTRIBIPOINTERPROC glad_trace_real_glVertexAttribIPointer;
+static void APIENTRY glad_trace_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttribIPointer(index, size, type, stride, pointer);
+    glad_trace_record(566, glad_start);
+}
+static PFNGLGETVERTEXATTRIBIIVPROC glad_trace_real_glGetVertexAttribIiv;
+static void APIENTRY glad_trace_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetVertexAttribIiv(index, pname, params);
+    glad_trace_record(567, glad_start);
+}
+static PFNGLGETVERTEXATTRIBIUIVPROC glad_trace_real_glGetVertexAttribIuiv;
+static void APIENTRY glad_trace_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetVertexAttribIuiv(index, pname, params);
+    glad_trace_record(568, glad_start);
+}
+static PFNGLVERTEXATTRIBI1IPROC glad_trace_real_glVertexAttribI1i;
+static void APIENTRY glad_trace_glVertexAttribI1i(GLuint index, GLint x) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttribI1i(index, x);
+    glad_trace_record(569, glad_start);
+}
+static PFNGLVERTEXATTRIBI2IPROC glad_trace_real_glVertexAttribI2i;
+static void APIENTRY glad_trace_glVertexAttribI2i(GLuint index, GLint x, GLint y) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttribI2i(index, x, y);
+    glad_trace_record(570, glad_start);
+}
+static PFNGLVERTEXATTRIBI3IPROC glad_trace_real_glVertexAttribI3i;
+static void APIENTRY glad_trace_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttribI3i(index, x, y, z);
+    glad_trace_record(571, glad_start);
+}
+static PFNGLVERTEXATTRIBI4IPROC glad_trace_real_glVertexAttribI4i;
+static void APIENTRY glad_trace_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttribI4i(index, x, y, z, w);
+    glad_trace_record(572, glad_start);
+}
+static PFNGLVERTEXATTRIBI1UIPROC glad_trace_real_glVertexAttribI1ui;
+static void APIENTRY glad_trace_glVertexAttribI1ui(GLuint index, GLuint x) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttribI1ui(index, x);
+    glad_trace_record(573, glad_start);
+}
+static PFNGLVERTEXATTRIBI2UIPROC glad_trace_real_glVertexAttribI2ui;
+static void APIENTRY glad_trace_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttribI2ui(index, x, y);
+    glad_trace_record(574, glad_start);
+}
+static PFNGLVERTEXATTRIBI3UIPROC glad_trace_real_glVertexAttribI3ui;
+static void APIENTRY glad_trace_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttribI3ui(index, x, y, z);
+    glad_trace_record(575, glad_start);
+}
+static PFNGLVERTEXATTRIBI4UIPROC glad_trace_real_glVertexAttribI4ui;
+static void APIENTRY glad_trace_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttribI4ui(index, x, y, z, w);
+    glad_trace_record(576, glad_start);
+}
+static PFNGLVERTEXATTRIBI1IVPROC glad_trace_real_glVertexAttribI1iv;
+static void APIENTRY glad_trace_glVertexAttribI1iv(GLuint index, const GLint *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttribI1iv(index, v);
+    glad_trace_record(577, glad_start);
+}
+static PFNGLVERTEXATTRIBI2IVPROC glad_trace_real_glVertexAttribI2iv;
+static void APIENTRY glad_trace_glVertexAttribI2iv(GLuint index, const GLint *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttribI2iv(index, v);
+    glad_trace_record(578, glad_start);
+}
+static PFNGLVERTEXATTRIBI3IVPROC glad_trace_real_glVertexAttribI3iv;
+static void APIENTRY glad_trace_glVertexAttribI3iv(GLuint index, const GLint *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttribI3iv(index, v);
+    glad_trace_record(579, glad_start);
+}
+static PFNGLVERTEXATTRIBI4IVPROC glad_trace_real_glVertexAttribI4iv;
+static void APIENTRY glad_trace_glVertexAttribI4iv(GLuint index, const GLint *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttribI4iv(index, v);
+    glad_trace_record(580, glad_start);
+}
+static PFNGLVERTEXATTRIBI1UIVPROC glad_trace_real_glVertexAttribI1uiv;
+static void APIENTRY glad_trace_glVertexAttribI1uiv(GLuint index, const GLuint *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttribI1uiv(index, v);
+    glad_trace_record(581, glad_start);
+}
+static PFNGLVERTEXATTRIBI2UIVPROC glad_trace_real_glVertexAttribI2uiv;
+static void APIENTRY glad_trace_glVertexAttribI2uiv(GLuint index, const GLuint *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttribI2uiv(index, v);
+    glad_trace_record(582, glad_start);
+}
+static PFNGLVERTEXATTRIBI3UIVPROC glad_trace_real_glVertexAttribI3uiv;
+static void APIENTRY glad_trace_glVertexAttribI3uiv(GLuint index, const GLuint *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttribI3uiv(index, v);
+    glad_trace_record(583, glad_start);
+}
+static PFNGLVERTEXATTRIBI4UIVPROC glad_trace_real_glVertexAttribI4uiv;
+static void APIENTRY glad_trace_glVertexAttribI4uiv(GLuint index, const GLuint *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttribI4uiv(index, v);
+    glad_trace_record(584, glad_start);
+}
+static PFNGLVERTEXATTRIBI4BVPROC glad_trace_real_glVertexAttribI4bv;
+static void APIENTRY glad_trace_glVertexAttribI4bv(GLuint index, const GLbyte *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttribI4bv(index, v);
+    glad_trace_record(585, glad_start);
+}
+static PFNGLVERTEXATTRIBI4SVPROC glad_trace_real_glVertexAttribI4sv;
+static void APIENTRY glad_trace_glVertexAttribI4sv(GLuint index, const GLshort *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttribI4sv(index, v);
+    glad_trace_record(586, glad_start);
+}
+static PFNGLVERTEXATTRIBI4UBVPROC glad_trace_real_glVertexAttribI4ubv;
+static void APIENTRY glad_trace_glVertexAttribI4ubv(GLuint index, const GLubyte *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttribI4ubv(index, v);
+    glad_trace_record(587, glad_start);
+}
+static PFNGLVERTEXATTRIBI4USVPROC glad_trace_real_glVertexAttribI4usv;
+static void APIENTRY glad_trace_glVertexAttribI4usv(GLuint index, const GLushort *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttribI4usv(index, v);
+    glad_trace_record(588, glad_start);
+}
+static PFNGLGETUNIFORMUIVPROC glad_trace_real_glGetUniformuiv;
+static void APIENTRY glad_trace_glGetUniformuiv(GLuint program, GLint location, GLuint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetUniformuiv(program, location, params);
+    glad_trace_record(589, glad_start);
+}
+static PFNGLBINDFRAGDATALOCATIONPROC glad_trace_real_glBindFragDataLocation;
+static void APIENTRY glad_trace_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glBindFragDataLocation(program, color, name);
+    glad_trace_record(590, glad_start);
+}
+static PFNGLGETFRAGDATALOCATIONPROC glad_trace_real_glGetFragDataLocation;
+static GLint APIENTRY glad_trace_glGetFragDataLocation(GLuint program, const GLchar *name) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    GLint glad_result = glad_trace_real_glGetFragDataLocation(program, name);
+    glad_trace_record(591, glad_start);
+    return glad_result;
+}
+static PFNGLUNIFORM1UIPROC glad_trace_real_glUniform1ui;
+static void APIENTRY glad_trace_glUniform1ui(GLint location, GLuint v0) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniform1ui(location, v0);
+    glad_trace_record(592, glad_start);
+}
+static PFNGLUNIFORM2UIPROC glad_trace_real_glUniform2ui;
+static void APIENTRY glad_trace_glUniform2ui(GLint location, GLuint v0, GLuint v1) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniform2ui(location, v0, v1);
+    glad_trace_record(593, glad_start);
+}
+static PFNGLUNIFORM3UIPROC glad_trace_real_glUniform3ui;
+static void APIENTRY glad_trace_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniform3ui(location, v0, v1, v2);
+    glad_trace_record(594, glad_start);
+}
+static PFNGLUNIFORM4UIPROC glad_trace_real_glUniform4ui;
+static void APIENTRY glad_trace_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniform4ui(location, v0, v1, v2, v3);
+    glad_trace_record(595, glad_start);
+}
+static PFNGLUNIFORM1UIVPROC glad_trace_real_glUniform1uiv;
+static void APIENTRY glad_trace_glUniform1uiv(GLint location, GLsizei count, const GLuint *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniform1uiv(location, count, value);
+    glad_trace_record(596, glad_start);
+}
+static PFNGLUNIFORM2UIVPROC glad_trace_real_glUniform2uiv;
+static void APIENTRY glad_trace_glUniform2uiv(GLint location, GLsizei count, const GLuint *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniform2uiv(location, count, value);
+    glad_trace_record(597, glad_start);
+}
+static PFNGLUNIFORM3UIVPROC glad_trace_real_glUniform3uiv;
+static void APIENTRY glad_trace_glUniform3uiv(GLint location, GLsizei count, const GLuint *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniform3uiv(location, count, value);
+    glad_trace_record(598, glad_start);
+}
+static PFNGLUNIFORM4UIVPROC glad_trace_real_glUniform4uiv;
+static void APIENTRY glad_trace_glUniform4uiv(GLint location, GLsizei count, const GLuint *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniform4uiv(location, count, value);
+    glad_trace_record(599, glad_start);
+}
+static PFNGLTEXPARAMETERIIVPROC glad_trace_real_glTexParameterIiv;
+static void APIENTRY glad_trace_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexParameterIiv(target, pname, params);
+    glad_trace_record(600, glad_start);
+}
+static PFNGLTEXPARAMETERIUIVPROC glad_trace_real_glTexParameterIuiv;
+static void APIENTRY glad_trace_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexParameterIuiv(target, pname, params);
+    glad_trace_record(601, glad_start);
+}
+static PFNGLGETTEXPARAMETERIIVPROC glad_trace_real_glGetTexParameterIiv;
+static void APIENTRY glad_trace_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetTexParameterIiv(target, pname, params);
+    glad_trace_record(602, glad_start);
+}
+static PFNGLGETTEXPARAMETERIUIVPROC glad_trace_real_glGetTexParameterIuiv;
+static void APIENTRY glad_trace_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetTexParameterIuiv(target, pname, params);
+    glad_trace_record(603, glad_start);
+}
+static PFNGLCLEARBUFFERIVPROC glad_trace_real_glClearBufferiv;
+static void APIENTRY glad_trace_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glClearBufferiv(buffer, drawbuffer, value);
+    glad_trace_record(604, glad_start);
+}
+static PFNGLCLEARBUFFERUIVPROC glad_trace_real_glClearBufferuiv;
+static void APIENTRY glad_trace_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glClearBufferuiv(buffer, drawbuffer, value);
+    glad_trace_record(605, glad_start);
+}
+static PFNGLCLEARBUFFERFVPROC glad_trace_real_glClearBufferfv;
+static void APIENTRY glad_trace_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glClearBufferfv(buffer, drawbuffer, value);
+    glad_trace_record(606, glad_start);
+}
+static PFNGLCLEARBUFFERFIPROC glad_trace_real_glClearBufferfi;
+static void APIENTRY glad_trace_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glClearBufferfi(buffer, drawbuffer, depth, stencil);
+    glad_trace_record(607, glad_start);
+}
+static PFNGLGETSTRINGIPROC glad_trace_real_glGetStringi;
+static const GLubyte * APIENTRY glad_trace_glGetStringi(GLenum name, GLuint index) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    const GLubyte * glad_result = glad_trace_real_glGetStringi(name, index);
+    glad_trace_record(608, glad_start);
+    return glad_result;
+}
+static PFNGLISRENDERBUFFERPROC glad_trace_real_glIsRenderbuffer;
+static GLboolean APIENTRY glad_trace_glIsRenderbuffer(GLuint renderbuffer) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    GLboolean glad_result = glad_trace_real_glIsRenderbuffer(renderbuffer);
+    glad_trace_record(609, glad_start);
+    return glad_result;
+}
+static PFNGLBINDRENDERBUFFERPROC glad_trace_real_glBindRenderbuffer;
+static void APIENTRY glad_trace_glBindRenderbuffer(GLenum target, GLuint renderbuffer) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glBindRenderbuffer(target, renderbuffer);
+    glad_trace_record(610, glad_start);
+}
+static PFNGLDELETERENDERBUFFERSPROC glad_trace_real_glDeleteRenderbuffers;
+static void APIENTRY glad_trace_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDeleteRenderbuffers(n, renderbuffers);
+    glad_trace_record(611, glad_start);
+}
+static PFNGLGENRENDERBUFFERSPROC glad_trace_real_glGenRenderbuffers;
+static void APIENTRY glad_trace_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGenRenderbuffers(n, renderbuffers);
+    glad_trace_record(612, glad_start);
+}
+static PFNGLRENDERBUFFERSTORAGEPROC glad_trace_real_glRenderbufferStorage;
+static void APIENTRY glad_trace_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glRenderbufferStorage(target, internalformat, width, height);
+    glad_trace_record(613, glad_start);
+}
+static PFNGLGETRENDERBUFFERPARAMETERIVPROC glad_trace_real_glGetRenderbufferParameteriv;
+static void APIENTRY glad_trace_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetRenderbufferParameteriv(target, pname, params);
+    glad_trace_record(614, glad_start);
+}
+static PFNGLISFRAMEBUFFERPROC glad_trace_real_glIsFramebuffer;
+static GLboolean APIENTRY glad_trace_glIsFramebuffer(GLuint framebuffer) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    GLboolean glad_result = glad_trace_real_glIsFramebuffer(framebuffer);
+    glad_trace_record(615, glad_start);
+    return glad_result;
+}
+static PFNGLBINDFRAMEBUFFERPROC glad_trace_real_glBindFramebuffer;
+static void APIENTRY glad_trace_glBindFramebuffer(GLenum target, GLuint framebuffer) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glBindFramebuffer(target, framebuffer);
+    glad_trace_record(616, glad_start);
+}
+static PFNGLDELETEFRAMEBUFFERSPROC glad_trace_real_glDeleteFramebuffers;
+static void APIENTRY glad_trace_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDeleteFramebuffers(n, framebuffers);
+    glad_trace_record(617, glad_start);
+}
+static PFNGLGENFRAMEBUFFERSPROC glad_trace_real_glGenFramebuffers;
+static void APIENTRY glad_trace_glGenFramebuffers(GLsizei n, GLuint *framebuffers) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGenFramebuffers(n, framebuffers);
+    glad_trace_record(618, glad_start);
+}
+static PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_trace_real_glCheckFramebufferStatus;
+static GLenum APIENTRY glad_trace_glCheckFramebufferStatus(GLenum target) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    GLenum glad_result = glad_trace_real_glCheckFramebufferStatus(target);
+    glad_trace_record(619, glad_start);
+    return glad_result;
+}
+static PFNGLFRAMEBUFFERTEXTURE1DPROC glad_trace_real_glFramebufferTexture1D;
+static void APIENTRY glad_trace_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glFramebufferTexture1D(target, attachment, textarget, texture, level);
+    glad_trace_record(620, glad_start);
+}
+static PFNGLFRAMEBUFFERTEXTURE2DPROC glad_trace_real_glFramebufferTexture2D;
+static void APIENTRY glad_trace_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glFramebufferTexture2D(target, attachment, textarget, texture, level);
+    glad_trace_record(621, glad_start);
+}
+static PFNGLFRAMEBUFFERTEXTURE3DPROC glad_trace_real_glFramebufferTexture3D;
+static void APIENTRY glad_trace_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+    glad_trace_record(622, glad_start);
+}
+static PFNGLFRAMEBUFFERRENDERBUFFERPROC glad_trace_real_glFramebufferRenderbuffer;
+static void APIENTRY glad_trace_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+    glad_trace_record(623, glad_start);
+}
+static PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_trace_real_glGetFramebufferAttachmentParameteriv;
+static void APIENTRY glad_trace_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+    glad_trace_record(624, glad_start);
+}
+static PFNGLGENERATEMIPMAPPROC glad_trace_real_glGenerateMipmap;
+static void APIENTRY glad_trace_glGenerateMipmap(GLenum target) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGenerateMipmap(target);
+    glad_trace_record(625, glad_start);
+}
+static PFNGLBLITFRAMEBUFFERPROC glad_trace_real_glBlitFramebuffer;
+static void APIENTRY glad_trace_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+    glad_trace_record(626, glad_start);
+}
+static PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_trace_real_glRenderbufferStorageMultisample;
+static void APIENTRY glad_trace_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+    glad_trace_record(627, glad_start);
+}
+static PFNGLFRAMEBUFFERTEXTURELAYERPROC glad_trace_real_glFramebufferTextureLayer;
+static void APIENTRY glad_trace_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glFramebufferTextureLayer(target, attachment, texture, level, layer);
+    glad_trace_record(628, glad_start);
+}
+static PFNGLMAPBUFFERRANGEPROC glad_trace_real_glMapBufferRange;
+static void * APIENTRY glad_trace_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    void * glad_result = glad_trace_real_glMapBufferRange(target, offset, length, access);
+    glad_trace_record(629, glad_start);
+    return glad_result;
+}
+static PFNGLFLUSHMAPPEDBUFFERRANGEPROC glad_trace_real_glFlushMappedBufferRange;
+static void APIENTRY glad_trace_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glFlushMappedBufferRange(target, offset, length);
+    glad_trace_record(630, glad_start);
+}
+static PFNGLBINDVERTEXARRAYPROC glad_trace_real_glBindVertexArray;
+static void APIENTRY glad_trace_glBindVertexArray(GLuint array) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glBindVertexArray(array);
+    glad_trace_record(631, glad_start);
+}
+static PFNGLDELETEVERTEXARRAYSPROC glad_trace_real_glDeleteVertexArrays;
+static void APIENTRY glad_trace_glDeleteVertexArrays(GLsizei n, const GLuint *arrays) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDeleteVertexArrays(n, arrays);
+    glad_trace_record(632, glad_start);
+}
+static PFNGLGENVERTEXARRAYSPROC glad_trace_real_glGenVertexArrays;
+static void APIENTRY glad_trace_glGenVertexArrays(GLsizei n, GLuint *arrays) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGenVertexArrays(n, arrays);
+    glad_trace_record(633, glad_start);
+}
+static PFNGLISVERTEXARRAYPROC glad_trace_real_glIsVertexArray;
+static GLboolean APIENTRY glad_trace_glIsVertexArray(GLuint array) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    GLboolean glad_result = glad_trace_real_glIsVertexArray(array);
+    glad_trace_record(634, glad_start);
+    return glad_result;
+}
+static PFNGLDRAWARRAYSINSTANCEDPROC glad_trace_real_glDrawArraysInstanced;
+static void APIENTRY glad_trace_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDrawArraysInstanced(mode, first, count, instancecount);
+    glad_trace_record(635, glad_start);
+}
+static PFNGLDRAWELEMENTSINSTANCEDPROC glad_trace_real_glDrawElementsInstanced;
+static void APIENTRY glad_trace_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDrawElementsInstanced(mode, count, type, indices, instancecount);
+    glad_trace_record(636, glad_start);
+}
+static PFNGLTEXBUFFERPROC glad_trace_real_glTexBuffer;
+static void APIENTRY glad_trace_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexBuffer(target, internalformat, buffer);
+    glad_trace_record(637, glad_start);
+}
+static PFNGLPRIMITIVERESTARTINDEXPROC glad_trace_real_glPrimitiveRestartIndex;
+static void APIENTRY glad_trace_glPrimitiveRestartIndex(GLuint index) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glPrimitiveRestartIndex(index);
+    glad_trace_record(638, glad_start);
+}
+static PFNGLCOPYBUFFERSUBDATAPROC glad_trace_real_glCopyBufferSubData;
+static void APIENTRY glad_trace_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+    glad_trace_record(639, glad_start);
+}
+static PFNGLGETUNIFORMINDICESPROC glad_trace_real_glGetUniformIndices;
+static void APIENTRY glad_trace_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+    glad_trace_record(640, glad_start);
+}
+static PFNGLGETACTIVEUNIFORMSIVPROC glad_trace_real_glGetActiveUniformsiv;
+static void APIENTRY glad_trace_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+    glad_trace_record(641, glad_start);
+}
+static PFNGLGETACTIVEUNIFORMNAMEPROC glad_trace_real_glGetActiveUniformName;
+static void APIENTRY glad_trace_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+    glad_trace_record(642, glad_start);
+}
+static PFNGLGETUNIFORMBLOCKINDEXPROC glad_trace_real_glGetUniformBlockIndex;
+static GLuint APIENTRY glad_trace_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    GLuint glad_result = glad_trace_real_glGetUniformBlockIndex(program, uniformBlockName);
+    glad_trace_record(643, glad_start);
+    return glad_result;
+}
+static PFNGLGETACTIVEUNIFORMBLOCKIVPROC glad_trace_real_glGetActiveUniformBlockiv;
+static void APIENTRY glad_trace_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+    glad_trace_record(644, glad_start);
+}
+static PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC glad_trace_real_glGetActiveUniformBlockName;
+static void APIENTRY glad_trace_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+    glad_trace_record(645, glad_start);
+}
+static PFNGLUNIFORMBLOCKBINDINGPROC glad_trace_real_glUniformBlockBinding;
+static void APIENTRY glad_trace_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+    glad_trace_record(646, glad_start);
+}
+static PFNGLDRAWELEMENTSBASEVERTEXPROC glad_trace_real_glDrawElementsBaseVertex;
+static void APIENTRY glad_trace_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+    glad_trace_record(647, glad_start);
+}
+static PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glad_trace_real_glDrawRangeElementsBaseVertex;
+static void APIENTRY glad_trace_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+    glad_trace_record(648, glad_start);
+}
+static PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glad_trace_real_glDrawElementsInstancedBaseVertex;
+static void APIENTRY glad_trace_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+    glad_trace_record(649, glad_start);
+}
+static PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glad_trace_real_glMultiDrawElementsBaseVertex;
+static void APIENTRY glad_trace_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+    glad_trace_record(650, glad_start);
+}
+static PFNGLPROVOKINGVERTEXPROC glad_trace_real_glProvokingVertex;
+static void APIENTRY glad_trace_glProvokingVertex(GLenum mode) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProvokingVertex(mode);
+    glad_trace_record(651, glad_start);
+}
+static PFNGLFENCESYNCPROC glad_trace_real_glFenceSync;
+static GLsync APIENTRY glad_trace_glFenceSync(GLenum condition, GLbitfield flags) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    GLsync glad_result = glad_trace_real_glFenceSync(condition, flags);
+    glad_trace_record(652, glad_start);
+    return glad_result;
+}
+static PFNGLISSYNCPROC glad_trace_real_glIsSync;
+static GLboolean APIENTRY glad_trace_glIsSync(GLsync sync) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    GLboolean glad_result = glad_trace_real_glIsSync(sync);
+    glad_trace_record(653, glad_start);
+    return glad_result;
+}
+static PFNGLDELETESYNCPROC glad_trace_real_glDeleteSync;
+static void APIENTRY glad_trace_glDeleteSync(GLsync sync) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDeleteSync(sync);
+    glad_trace_record(654, glad_start);
+}
+static PFNGLCLIENTWAITSYNCPROC glad_trace_real_glClientWaitSync;
+static GLenum APIENTRY glad_trace_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    GLenum glad_result = glad_trace_real_glClientWaitSync(sync, flags, timeout);
+    glad_trace_record(655, glad_start);
+    return glad_result;
+}
+static PFNGLWAITSYNCPROC glad_trace_real_glWaitSync;
+static void APIENTRY glad_trace_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glWaitSync(sync, flags, timeout);
+    glad_trace_record(656, glad_start);
+}
+static PFNGLGETINTEGER64VPROC glad_trace_real_glGetInteger64v;
+static void APIENTRY glad_trace_glGetInteger64v(GLenum pname, GLint64 *data) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetInteger64v(pname, data);
+    glad_trace_record(657, glad_start);
+}
+static PFNGLGETSYNCIVPROC glad_trace_real_glGetSynciv;
+static void APIENTRY glad_trace_glGetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetSynciv(sync, pname, count, length, values);
+    glad_trace_record(658, glad_start);
+}
+static PFNGLGETINTEGER64I_VPROC glad_trace_real_glGetInteger64i_v;
+static void APIENTRY glad_trace_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetInteger64i_v(target, index, data);
+    glad_trace_record(659, glad_start);
+}
+static PFNGLGETBUFFERPARAMETERI64VPROC glad_trace_real_glGetBufferParameteri64v;
+static void APIENTRY glad_trace_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetBufferParameteri64v(target, pname, params);
+    glad_trace_record(660, glad_start);
+}
+static PFNGLFRAMEBUFFERTEXTUREPROC glad_trace_real_glFramebufferTexture;
+static void APIENTRY glad_trace_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glFramebufferTexture(target, attachment, texture, level);
+    glad_trace_record(661, glad_start);
+}
+static PFNGLTEXIMAGE2DMULTISAMPLEPROC glad_trace_real_glTexImage2DMultisample;
+static void APIENTRY glad_trace_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+    glad_trace_record(662, glad_start);
+}
+static PFNGLTEXIMAGE3DMULTISAMPLEPROC glad_trace_real_glTexImage3DMultisample;
+static void APIENTRY glad_trace_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+    glad_trace_record(663, glad_start);
+}
+static PFNGLGETMULTISAMPLEFVPROC glad_trace_real_glGetMultisamplefv;
+static void APIENTRY glad_trace_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetMultisamplefv(pname, index, val);
+    glad_trace_record(664, glad_start);
+}
+static PFNGLSAMPLEMASKIPROC glad_trace_real_glSampleMaski;
+static void APIENTRY glad_trace_glSampleMaski(GLuint maskNumber, GLbitfield mask) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glSampleMaski(maskNumber, mask);
+    glad_trace_record(665, glad_start);
+}
+static PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glad_trace_real_glBindFragDataLocationIndexed;
+static void APIENTRY glad_trace_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glBindFragDataLocationIndexed(program, colorNumber, index, name);
+    glad_trace_record(666, glad_start);
+}
+static PFNGLGETFRAGDATAINDEXPROC glad_trace_real_glGetFragDataIndex;
+static GLint APIENTRY glad_trace_glGetFragDataIndex(GLuint program, const GLchar *name) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    GLint glad_result = glad_trace_real_glGetFragDataIndex(program, name);
+    glad_trace_record(667, glad_start);
+    return glad_result;
+}
+static PFNGLGENSAMPLERSPROC glad_trace_real_glGenSamplers;
+static void APIENTRY glad_trace_glGenSamplers(GLsizei count, GLuint *samplers) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGenSamplers(count, samplers);
+    glad_trace_record(668, glad_start);
+}
+static PFNGLDELETESAMPLERSPROC glad_trace_real_glDeleteSamplers;
+static void APIENTRY glad_trace_glDeleteSamplers(GLsizei count, const GLuint *samplers) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDeleteSamplers(count, samplers);
+    glad_trace_record(669, glad_start);
+}
+static PFNGLISSAMPLERPROC glad_trace_real_glIsSampler;
+static GLboolean APIENTRY glad_trace_glIsSampler(GLuint sampler) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    GLboolean glad_result = glad_trace_real_glIsSampler(sampler);
+    glad_trace_record(670, glad_start);
+    return glad_result;
+}
+static PFNGLBINDSAMPLERPROC glad_trace_real_glBindSampler;
+static void APIENTRY glad_trace_glBindSampler(GLuint unit, GLuint sampler) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glBindSampler(unit, sampler);
+    glad_trace_record(671, glad_start);
+}
+static PFNGLSAMPLERPARAMETERIPROC glad_trace_real_glSamplerParameteri;
+static void APIENTRY glad_trace_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glSamplerParameteri(sampler, pname, param);
+    glad_trace_record(672, glad_start);
+}
+static PFNGLSAMPLERPARAMETERIVPROC glad_trace_real_glSamplerParameteriv;
+static void APIENTRY glad_trace_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glSamplerParameteriv(sampler, pname, param);
+    glad_trace_record(673, glad_start);
+}
+static PFNGLSAMPLERPARAMETERFPROC glad_trace_real_glSamplerParameterf;
+static void APIENTRY glad_trace_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glSamplerParameterf(sampler, pname, param);
+    glad_trace_record(674, glad_start);
+}
+static PFNGLSAMPLERPARAMETERFVPROC glad_trace_real_glSamplerParameterfv;
+static void APIENTRY glad_trace_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glSamplerParameterfv(sampler, pname, param);
+    glad_trace_record(675, glad_start);
+}
+static PFNGLSAMPLERPARAMETERIIVPROC glad_trace_real_glSamplerParameterIiv;
+static void APIENTRY glad_trace_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glSamplerParameterIiv(sampler, pname, param);
+    glad_trace_record(676, glad_start);
+}
+static PFNGLSAMPLERPARAMETERIUIVPROC glad_trace_real_glSamplerParameterIuiv;
+static void APIENTRY glad_trace_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glSamplerParameterIuiv(sampler, pname, param);
+    glad_trace_record(677, glad_start);
+}
+static PFNGLGETSAMPLERPARAMETERIVPROC glad_trace_real_glGetSamplerParameteriv;
+static void APIENTRY glad_trace_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetSamplerParameteriv(sampler, pname, params);
+    glad_trace_record(678, glad_start);
+}
+static PFNGLGETSAMPLERPARAMETERIIVPROC glad_trace_real_glGetSamplerParameterIiv;
+static void APIENTRY glad_trace_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetSamplerParameterIiv(sampler, pname, params);
+    glad_trace_record(679, glad_start);
+}
+static PFNGLGETSAMPLERPARAMETERFVPROC glad_trace_real_glGetSamplerParameterfv;
+static void APIENTRY glad_trace_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetSamplerParameterfv(sampler, pname, params);
+    glad_trace_record(680, glad_start);
+}
+static PFNGLGETSAMPLERPARAMETERIUIVPROC glad_trace_real_glGetSamplerParameterIuiv;
+static void APIENTRY glad_trace_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetSamplerParameterIuiv(sampler, pname, params);
+    glad_trace_record(681, glad_start);
+}
+static PFNGLQUERYCOUNTERPROC glad_trace_real_glQueryCounter;
+static void APIENTRY glad_trace_glQueryCounter(GLuint id, GLenum target) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glQueryCounter(id, target);
+    glad_trace_record(682, glad_start);
+}
+static PFNGLGETQUERYOBJECTI64VPROC glad_trace_real_glGetQueryObjecti64v;
+static void APIENTRY glad_trace_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetQueryObjecti64v(id, pname, params);
+    glad_trace_record(683, glad_start);
+}
+static PFNGLGETQUERYOBJECTUI64VPROC glad_trace_real_glGetQueryObjectui64v;
+static void APIENTRY glad_trace_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetQueryObjectui64v(id, pname, params);
+    glad_trace_record(684, glad_start);
+}
+static PFNGLVERTEXATTRIBDIVISORPROC glad_trace_real_glVertexAttribDivisor;
+static void APIENTRY glad_trace_glVertexAttribDivisor(GLuint index, GLuint divisor) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttribDivisor(index, divisor);
+    glad_trace_record(685, glad_start);
+}
+static PFNGLVERTEXATTRIBP1UIPROC glad_trace_real_glVertexAttribP1ui;
+static void APIENTRY glad_trace_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttribP1ui(index, type, normalized, value);
+    glad_trace_record(686, glad_start);
+}
+static PFNGLVERTEXATTRIBP1UIVPROC glad_trace_real_glVertexAttribP1uiv;
+static void APIENTRY glad_trace_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttribP1uiv(index, type, normalized, value);
+    glad_trace_record(687, glad_start);
+}
+static PFNGLVERTEXATTRIBP2UIPROC glad_trace_real_glVertexAttribP2ui;
+static void APIENTRY glad_trace_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttribP2ui(index, type, normalized, value);
+    glad_trace_record(688, glad_start);
+}
+static PFNGLVERTEXATTRIBP2UIVPROC glad_trace_real_glVertexAttribP2uiv;
+static void APIENTRY glad_trace_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttribP2uiv(index, type, normalized, value);
+    glad_trace_record(689, glad_start);
+}
+static PFNGLVERTEXATTRIBP3UIPROC glad_trace_real_glVertexAttribP3ui;
+static void APIENTRY glad_trace_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttribP3ui(index, type, normalized, value);
+    glad_trace_record(690, glad_start);
+}
+static PFNGLVERTEXATTRIBP3UIVPROC glad_trace_real_glVertexAttribP3uiv;
+static void APIENTRY glad_trace_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttribP3uiv(index, type, normalized, value);
+    glad_trace_record(691, glad_start);
+}
+static PFNGLVERTEXATTRIBP4UIPROC glad_trace_real_glVertexAttribP4ui;
+static void APIENTRY glad_trace_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttribP4ui(index, type, normalized, value);
+    glad_trace_record(692, glad_start);
+}
+static PFNGLVERTEXATTRIBP4UIVPROC glad_trace_real_glVertexAttribP4uiv;
+static void APIENTRY glad_trace_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttribP4uiv(index, type, normalized, value);
+    glad_trace_record(693, glad_start);
+}
+static PFNGLVERTEXP2UIPROC glad_trace_real_glVertexP2ui;
+static void APIENTRY glad_trace_glVertexP2ui(GLenum type, GLuint value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexP2ui(type, value);
+    glad_trace_record(694, glad_start);
+}
+static PFNGLVERTEXP2UIVPROC glad_trace_real_glVertexP2uiv;
+static void APIENTRY glad_trace_glVertexP2uiv(GLenum type, const GLuint *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexP2uiv(type, value);
+    glad_trace_record(695, glad_start);
+}
+static PFNGLVERTEXP3UIPROC glad_trace_real_glVertexP3ui;
+static void APIENTRY glad_trace_glVertexP3ui(GLenum type, GLuint value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexP3ui(type, value);
+    glad_trace_record(696, glad_start);
+}
+static PFNGLVERTEXP3UIVPROC glad_trace_real_glVertexP3uiv;
+static void APIENTRY glad_trace_glVertexP3uiv(GLenum type, const GLuint *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexP3uiv(type, value);
+    glad_trace_record(697, glad_start);
+}
+static PFNGLVERTEXP4UIPROC glad_trace_real_glVertexP4ui;
+static void APIENTRY glad_trace_glVertexP4ui(GLenum type, GLuint value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexP4ui(type, value);
+    glad_trace_record(698, glad_start);
+}
+static PFNGLVERTEXP4UIVPROC glad_trace_real_glVertexP4uiv;
+static void APIENTRY glad_trace_glVertexP4uiv(GLenum type, const GLuint *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexP4uiv(type, value);
+    glad_trace_record(699, glad_start);
+}
+static PFNGLTEXCOORDP1UIPROC glad_trace_real_glTexCoordP1ui;
+static void APIENTRY glad_trace_glTexCoordP1ui(GLenum type, GLuint coords) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexCoordP1ui(type, coords);
+    glad_trace_record(700, glad_start);
+}
+static PFNGLTEXCOORDP1UIVPROC glad_trace_real_glTexCoordP1uiv;
+static void APIENTRY glad_trace_glTexCoordP1uiv(GLenum type, const GLuint *coords) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexCoordP1uiv(type, coords);
+    glad_trace_record(701, glad_start);
+}
+static PFNGLTEXCOORDP2UIPROC glad_trace_real_glTexCoordP2ui;
+static void APIENTRY glad_trace_glTexCoordP2ui(GLenum type, GLuint coords) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexCoordP2ui(type, coords);
+    glad_trace_record(702, glad_start);
+}
+static PFNGLTEXCOORDP2UIVPROC glad_trace_real_glTexCoordP2uiv;
+static void APIENTRY glad_trace_glTexCoordP2uiv(GLenum type, const GLuint *coords) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexCoordP2uiv(type, coords);
+    glad_trace_record(703, glad_start);
+}
+static PFNGLTEXCOORDP3UIPROC glad_trace_real_glTexCoordP3ui;
+static void APIENTRY glad_trace_glTexCoordP3ui(GLenum type, GLuint coords) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexCoordP3ui(type, coords);
+    glad_trace_record(704, glad_start);
+}
+static PFNGLTEXCOORDP3UIVPROC glad_trace_real_glTexCoordP3uiv;
+static void APIENTRY glad_trace_glTexCoordP3uiv(GLenum type, const GLuint *coords) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexCoordP3uiv(type, coords);
+    glad_trace_record(705, glad_start);
+}
+static PFNGLTEXCOORDP4UIPROC glad_trace_real_glTexCoordP4ui;
+static void APIENTRY glad_trace_glTexCoordP4ui(GLenum type, GLuint coords) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexCoordP4ui(type, coords);
+    glad_trace_record(706, glad_start);
+}
+static PFNGLTEXCOORDP4UIVPROC glad_trace_real_glTexCoordP4uiv;
+static void APIENTRY glad_trace_glTexCoordP4uiv(GLenum type, const GLuint *coords) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexCoordP4uiv(type, coords);
+    glad_trace_record(707, glad_start);
+}
+static PFNGLMULTITEXCOORDP1UIPROC glad_trace_real_glMultiTexCoordP1ui;
+static void APIENTRY glad_trace_glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiTexCoordP1ui(texture, type, coords);
+    glad_trace_record(708, glad_start);
+}
+static PFNGLMULTITEXCOORDP1UIVPROC glad_trace_real_glMultiTexCoordP1uiv;
+static void APIENTRY glad_trace_glMultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint *coords) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiTexCoordP1uiv(texture, type, coords);
+    glad_trace_record(709, glad_start);
+}
+static PFNGLMULTITEXCOORDP2UIPROC glad_trace_real_glMultiTexCoordP2ui;
+static void APIENTRY glad_trace_glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiTexCoordP2ui(texture, type, coords);
+    glad_trace_record(710, glad_start);
+}
+static PFNGLMULTITEXCOORDP2UIVPROC glad_trace_real_glMultiTexCoordP2uiv;
+static void APIENTRY glad_trace_glMultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint *coords) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiTexCoordP2uiv(texture, type, coords);
+    glad_trace_record(711, glad_start);
+}
+static PFNGLMULTITEXCOORDP3UIPROC glad_trace_real_glMultiTexCoordP3ui;
+static void APIENTRY glad_trace_glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiTexCoordP3ui(texture, type, coords);
+    glad_trace_record(712, glad_start);
+}
+static PFNGLMULTITEXCOORDP3UIVPROC glad_trace_real_glMultiTexCoordP3uiv;
+static void APIENTRY glad_trace_glMultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint *coords) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiTexCoordP3uiv(texture, type, coords);
+    glad_trace_record(713, glad_start);
+}
+static PFNGLMULTITEXCOORDP4UIPROC glad_trace_real_glMultiTexCoordP4ui;
+static void APIENTRY glad_trace_glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiTexCoordP4ui(texture, type, coords);
+    glad_trace_record(714, glad_start);
+}
+static PFNGLMULTITEXCOORDP4UIVPROC glad_trace_real_glMultiTexCoordP4uiv;
+static void APIENTRY glad_trace_glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint *coords) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiTexCoordP4uiv(texture, type, coords);
+    glad_trace_record(715, glad_start);
+}
+static PFNGLNORMALP3UIPROC glad_trace_real_glNormalP3ui;
+static void APIENTRY glad_trace_glNormalP3ui(GLenum type, GLuint coords) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glNormalP3ui(type, coords);
+    glad_trace_record(716, glad_start);
+}
+static PFNGLNORMALP3UIVPROC glad_trace_real_glNormalP3uiv;
+static void APIENTRY glad_trace_glNormalP3uiv(GLenum type, const GLuint *coords) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glNormalP3uiv(type, coords);
+    glad_trace_record(717, glad_start);
+}
+static PFNGLCOLORP3UIPROC glad_trace_real_glColorP3ui;
+static void APIENTRY glad_trace_glColorP3ui(GLenum type, GLuint color) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glColorP3ui(type, color);
+    glad_trace_record(718, glad_start);
+}
+static PFNGLCOLORP3UIVPROC glad_trace_real_glColorP3uiv;
+static void APIENTRY glad_trace_glColorP3uiv(GLenum type, const GLuint *color) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glColorP3uiv(type, color);
+    glad_trace_record(719, glad_start);
+}
+static PFNGLCOLORP4UIPROC glad_trace_real_glColorP4ui;
+static void APIENTRY glad_trace_glColorP4ui(GLenum type, GLuint color) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glColorP4ui(type, color);
+    glad_trace_record(720, glad_start);
+}
+static PFNGLCOLORP4UIVPROC glad_trace_real_glColorP4uiv;
+static void APIENTRY glad_trace_glColorP4uiv(GLenum type, const GLuint *color) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glColorP4uiv(type, color);
+    glad_trace_record(721, glad_start);
+}
+static PFNGLSECONDARYCOLORP3UIPROC glad_trace_real_glSecondaryColorP3ui;
+static void APIENTRY glad_trace_glSecondaryColorP3ui(GLenum type, GLuint color) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glSecondaryColorP3ui(type, color);
+    glad_trace_record(722, glad_start);
+}
+static PFNGLSECONDARYCOLORP3UIVPROC glad_trace_real_glSecondaryColorP3uiv;
+static void APIENTRY glad_trace_glSecondaryColorP3uiv(GLenum type, const GLuint *color) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glSecondaryColorP3uiv(type, color);
+    glad_trace_record(723, glad_start);
+}
+static PFNGLMINSAMPLESHADINGPROC glad_trace_real_glMinSampleShading;
+static void APIENTRY glad_trace_glMinSampleShading(GLfloat value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMinSampleShading(value);
+    glad_trace_record(724, glad_start);
+}
+static PFNGLBLENDEQUATIONIPROC glad_trace_real_glBlendEquationi;
+static void APIENTRY glad_trace_glBlendEquationi(GLuint buf, GLenum mode) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glBlendEquationi(buf, mode);
+    glad_trace_record(725, glad_start);
+}
+static PFNGLBLENDEQUATIONSEPARATEIPROC glad_trace_real_glBlendEquationSeparatei;
+static void APIENTRY glad_trace_glBlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeAlpha) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glBlendEquationSeparatei(buf, modeRGB, modeAlpha);
+    glad_trace_record(726, glad_start);
+}
+static PFNGLBLENDFUNCIPROC glad_trace_real_glBlendFunci;
+static void APIENTRY glad_trace_glBlendFunci(GLuint buf, GLenum src, GLenum dst) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glBlendFunci(buf, src, dst);
+    glad_trace_record(727, glad_start);
+}
+static PFNGLBLENDFUNCSEPARATEIPROC glad_trace_real_glBlendFuncSeparatei;
+static void APIENTRY glad_trace_glBlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glBlendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+    glad_trace_record(728, glad_start);
+}
+static PFNGLDRAWARRAYSINDIRECTPROC glad_trace_real_glDrawArraysIndirect;
+static void APIENTRY glad_trace_glDrawArraysIndirect(GLenum mode, const void *indirect) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDrawArraysIndirect(mode, indirect);
+    glad_trace_record(729, glad_start);
+}
+static PFNGLDRAWELEMENTSINDIRECTPROC glad_trace_real_glDrawElementsIndirect;
+static void APIENTRY glad_trace_glDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDrawElementsIndirect(mode, type, indirect);
+    glad_trace_record(730, glad_start);
+}
+static PFNGLUNIFORM1DPROC glad_trace_real_glUniform1d;
+static void APIENTRY glad_trace_glUniform1d(GLint location, GLdouble x) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniform1d(location, x);
+    glad_trace_record(731, glad_start);
+}
+static PFNGLUNIFORM2DPROC glad_trace_real_glUniform2d;
+static void APIENTRY glad_trace_glUniform2d(GLint location, GLdouble x, GLdouble y) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniform2d(location, x, y);
+    glad_trace_record(732, glad_start);
+}
+static PFNGLUNIFORM3DPROC glad_trace_real_glUniform3d;
+static void APIENTRY glad_trace_glUniform3d(GLint location, GLdouble x, GLdouble y, GLdouble z) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniform3d(location, x, y, z);
+    glad_trace_record(733, glad_start);
+}
+static PFNGLUNIFORM4DPROC glad_trace_real_glUniform4d;
+static void APIENTRY glad_trace_glUniform4d(GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniform4d(location, x, y, z, w);
+    glad_trace_record(734, glad_start);
+}
+static PFNGLUNIFORM1DVPROC glad_trace_real_glUniform1dv;
+static void APIENTRY glad_trace_glUniform1dv(GLint location, GLsizei count, const GLdouble *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniform1dv(location, count, value);
+    glad_trace_record(735, glad_start);
+}
+static PFNGLUNIFORM2DVPROC glad_trace_real_glUniform2dv;
+static void APIENTRY glad_trace_glUniform2dv(GLint location, GLsizei count, const GLdouble *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniform2dv(location, count, value);
+    glad_trace_record(736, glad_start);
+}
+static PFNGLUNIFORM3DVPROC glad_trace_real_glUniform3dv;
+static void APIENTRY glad_trace_glUniform3dv(GLint location, GLsizei count, const GLdouble *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniform3dv(location, count, value);
+    glad_trace_record(737, glad_start);
+}
+static PFNGLUNIFORM4DVPROC glad_trace_real_glUniform4dv;
+static void APIENTRY glad_trace_glUniform4dv(GLint location, GLsizei count, const GLdouble *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniform4dv(location, count, value);
+    glad_trace_record(738, glad_start);
+}
+static PFNGLUNIFORMMATRIX2DVPROC glad_trace_real_glUniformMatrix2dv;
+static void APIENTRY glad_trace_glUniformMatrix2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniformMatrix2dv(location, count, transpose, value);
+    glad_trace_record(739, glad_start);
+}
+static PFNGLUNIFORMMATRIX3DVPROC glad_trace_real_glUniformMatrix3dv;
+static void APIENTRY glad_trace_glUniformMatrix3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniformMatrix3dv(location, count, transpose, value);
+    glad_trace_record(740, glad_start);
+}
+static PFNGLUNIFORMMATRIX4DVPROC glad_trace_real_glUniformMatrix4dv;
+static void APIENTRY glad_trace_glUniformMatrix4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniformMatrix4dv(location, count, transpose, value);
+    glad_trace_record(741, glad_start);
+}
+static PFNGLUNIFORMMATRIX2X3DVPROC glad_trace_real_glUniformMatrix2x3dv;
+static void APIENTRY glad_trace_glUniformMatrix2x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniformMatrix2x3dv(location, count, transpose, value);
+    glad_trace_record(742, glad_start);
+}
+static PFNGLUNIFORMMATRIX2X4DVPROC glad_trace_real_glUniformMatrix2x4dv;
+static void APIENTRY glad_trace_glUniformMatrix2x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniformMatrix2x4dv(location, count, transpose, value);
+    glad_trace_record(743, glad_start);
+}
+static PFNGLUNIFORMMATRIX3X2DVPROC glad_trace_real_glUniformMatrix3x2dv;
+static void APIENTRY glad_trace_glUniformMatrix3x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniformMatrix3x2dv(location, count, transpose, value);
+    glad_trace_record(744, glad_start);
+}
+static PFNGLUNIFORMMATRIX3X4DVPROC glad_trace_real_glUniformMatrix3x4dv;
+static void APIENTRY glad_trace_glUniformMatrix3x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniformMatrix3x4dv(location, count, transpose, value);
+    glad_trace_record(745, glad_start);
+}
+static PFNGLUNIFORMMATRIX4X2DVPROC glad_trace_real_glUniformMatrix4x2dv;
+static void APIENTRY glad_trace_glUniformMatrix4x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniformMatrix4x2dv(location, count, transpose, value);
+    glad_trace_record(746, glad_start);
+}
+static PFNGLUNIFORMMATRIX4X3DVPROC glad_trace_real_glUniformMatrix4x3dv;
+static void APIENTRY glad_trace_glUniformMatrix4x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniformMatrix4x3dv(location, count, transpose, value);
+    glad_trace_record(747, glad_start);
+}
+static PFNGLGETUNIFORMDVPROC glad_trace_real_glGetUniformdv;
+static void APIENTRY glad_trace_glGetUniformdv(GLuint program, GLint location, GLdouble *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetUniformdv(program, location, params);
+    glad_trace_record(748, glad_start);
+}
+static PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC glad_trace_real_glGetSubroutineUniformLocation;
+static GLint APIENTRY glad_trace_glGetSubroutineUniformLocation(GLuint program, GLenum shadertype, const GLchar *name) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    GLint glad_result = glad_trace_real_glGetSubroutineUniformLocation(program, shadertype, name);
+    glad_trace_record(749, glad_start);
+    return glad_result;
+}
+static PFNGLGETSUBROUTINEINDEXPROC glad_trace_real_glGetSubroutineIndex;
+static GLuint APIENTRY glad_trace_glGetSubroutineIndex(GLuint program, GLenum shadertype, const GLchar *name) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    GLuint glad_result = glad_trace_real_glGetSubroutineIndex(program, shadertype, name);
+    glad_trace_record(750, glad_start);
+    return glad_result;
+}
+static PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC glad_trace_real_glGetActiveSubroutineUniformiv;
+static void APIENTRY glad_trace_glGetActiveSubroutineUniformiv(GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint *values) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetActiveSubroutineUniformiv(program, shadertype, index, pname, values);
+    glad_trace_record(751, glad_start);
+}
+static PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC glad_trace_real_glGetActiveSubroutineUniformName;
+static void APIENTRY glad_trace_glGetActiveSubroutineUniformName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetActiveSubroutineUniformName(program, shadertype, index, bufSize, length, name);
+    glad_trace_record(752, glad_start);
+}
+static PFNGLGETACTIVESUBROUTINENAMEPROC glad_trace_real_glGetActiveSubroutineName;
+static void APIENTRY glad_trace_glGetActiveSubroutineName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetActiveSubroutineName(program, shadertype, index, bufSize, length, name);
+    glad_trace_record(753, glad_start);
+}
+static PFNGLUNIFORMSUBROUTINESUIVPROC glad_trace_real_glUniformSubroutinesuiv;
+static void APIENTRY glad_trace_glUniformSubroutinesuiv(GLenum shadertype, GLsizei count, const GLuint *indices) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUniformSubroutinesuiv(shadertype, count, indices);
+    glad_trace_record(754, glad_start);
+}
+static PFNGLGETUNIFORMSUBROUTINEUIVPROC glad_trace_real_glGetUniformSubroutineuiv;
+static void APIENTRY glad_trace_glGetUniformSubroutineuiv(GLenum shadertype, GLint location, GLuint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetUniformSubroutineuiv(shadertype, location, params);
+    glad_trace_record(755, glad_start);
+}
+static PFNGLGETPROGRAMSTAGEIVPROC glad_trace_real_glGetProgramStageiv;
+static void APIENTRY glad_trace_glGetProgramStageiv(GLuint program, GLenum shadertype, GLenum pname, GLint *values) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetProgramStageiv(program, shadertype, pname, values);
+    glad_trace_record(756, glad_start);
+}
+static PFNGLPATCHPARAMETERIPROC glad_trace_real_glPatchParameteri;
+static void APIENTRY glad_trace_glPatchParameteri(GLenum pname, GLint value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glPatchParameteri(pname, value);
+    glad_trace_record(757, glad_start);
+}
+static PFNGLPATCHPARAMETERFVPROC glad_trace_real_glPatchParameterfv;
+static void APIENTRY glad_trace_glPatchParameterfv(GLenum pname, const GLfloat *values) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glPatchParameterfv(pname, values);
+    glad_trace_record(758, glad_start);
+}
+static PFNGLBINDTRANSFORMFEEDBACKPROC glad_trace_real_glBindTransformFeedback;
+static void APIENTRY glad_trace_glBindTransformFeedback(GLenum target, GLuint id) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glBindTransformFeedback(target, id);
+    glad_trace_record(759, glad_start);
+}
+static PFNGLDELETETRANSFORMFEEDBACKSPROC glad_trace_real_glDeleteTransformFeedbacks;
+static void APIENTRY glad_trace_glDeleteTransformFeedbacks(GLsizei n, const GLuint *ids) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDeleteTransformFeedbacks(n, ids);
+    glad_trace_record(760, glad_start);
+}
+static PFNGLGENTRANSFORMFEEDBACKSPROC glad_trace_real_glGenTransformFeedbacks;
+static void APIENTRY glad_trace_glGenTransformFeedbacks(GLsizei n, GLuint *ids) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGenTransformFeedbacks(n, ids);
+    glad_trace_record(761, glad_start);
+}
+static PFNGLISTRANSFORMFEEDBACKPROC glad_trace_real_glIsTransformFeedback;
+static GLboolean APIENTRY glad_trace_glIsTransformFeedback(GLuint id) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    GLboolean glad_result = glad_trace_real_glIsTransformFeedback(id);
+    glad_trace_record(762, glad_start);
+    return glad_result;
+}
+static PFNGLPAUSETRANSFORMFEEDBACKPROC glad_trace_real_glPauseTransformFeedback;
+static void APIENTRY glad_trace_glPauseTransformFeedback(void) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glPauseTransformFeedback();
+    glad_trace_record(763, glad_start);
+}
+static PFNGLRESUMETRANSFORMFEEDBACKPROC glad_trace_real_glResumeTransformFeedback;
+static void APIENTRY glad_trace_glResumeTransformFeedback(void) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glResumeTransformFeedback();
+    glad_trace_record(764, glad_start);
+}
+static PFNGLDRAWTRANSFORMFEEDBACKPROC glad_trace_real_glDrawTransformFeedback;
+static void APIENTRY glad_trace_glDrawTransformFeedback(GLenum mode, GLuint id) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDrawTransformFeedback(mode, id);
+    glad_trace_record(765, glad_start);
+}
+static PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC glad_trace_real_glDrawTransformFeedbackStream;
+static void APIENTRY glad_trace_glDrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint stream) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDrawTransformFeedbackStream(mode, id, stream);
+    glad_trace_record(766, glad_start);
+}
+static PFNGLBEGINQUERYINDEXEDPROC glad_trace_real_glBeginQueryIndexed;
+static void APIENTRY glad_trace_glBeginQueryIndexed(GLenum target, GLuint index, GLuint id) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glBeginQueryIndexed(target, index, id);
+    glad_trace_record(767, glad_start);
+}
+static PFNGLENDQUERYINDEXEDPROC glad_trace_real_glEndQueryIndexed;
+static void APIENTRY glad_trace_glEndQueryIndexed(GLenum target, GLuint index) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glEndQueryIndexed(target, index);
+    glad_trace_record(768, glad_start);
+}
+static PFNGLGETQUERYINDEXEDIVPROC glad_trace_real_glGetQueryIndexediv;
+static void APIENTRY glad_trace_glGetQueryIndexediv(GLenum target, GLuint index, GLenum pname, GLint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetQueryIndexediv(target, index, pname, params);
+    glad_trace_record(769, glad_start);
+}
+static PFNGLRELEASESHADERCOMPILERPROC glad_trace_real_glReleaseShaderCompiler;
+static void APIENTRY glad_trace_glReleaseShaderCompiler(void) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glReleaseShaderCompiler();
+    glad_trace_record(770, glad_start);
+}
+static PFNGLSHADERBINARYPROC glad_trace_real_glShaderBinary;
+static void APIENTRY glad_trace_glShaderBinary(GLsizei count, const GLuint *shaders, GLenum binaryFormat, const void *binary, GLsizei length) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glShaderBinary(count, shaders, binaryFormat, binary, length);
+    glad_trace_record(771, glad_start);
+}
+static PFNGLGETSHADERPRECISIONFORMATPROC glad_trace_real_glGetShaderPrecisionFormat;
+static void APIENTRY glad_trace_glGetShaderPrecisionFormat(GLenum shadertype, GLenum precisiontype, GLint *range, GLint *precision) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetShaderPrecisionFormat(shadertype, precisiontype, range, precision);
+    glad_trace_record(772, glad_start);
+}
+static PFNGLDEPTHRANGEFPROC glad_trace_real_glDepthRangef;
+static void APIENTRY glad_trace_glDepthRangef(GLfloat n, GLfloat f) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDepthRangef(n, f);
+    glad_trace_record(773, glad_start);
+}
+static PFNGLCLEARDEPTHFPROC glad_trace_real_glClearDepthf;
+static void APIENTRY glad_trace_glClearDepthf(GLfloat d) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glClearDepthf(d);
+    glad_trace_record(774, glad_start);
+}
+static PFNGLGETPROGRAMBINARYPROC glad_trace_real_glGetProgramBinary;
+static void APIENTRY glad_trace_glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetProgramBinary(program, bufSize, length, binaryFormat, binary);
+    glad_trace_record(775, glad_start);
+}
+static PFNGLPROGRAMBINARYPROC glad_trace_real_glProgramBinary;
+static void APIENTRY glad_trace_glProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramBinary(program, binaryFormat, binary, length);
+    glad_trace_record(776, glad_start);
+}
+static PFNGLPROGRAMPARAMETERIPROC glad_trace_real_glProgramParameteri;
+static void APIENTRY glad_trace_glProgramParameteri(GLuint program, GLenum pname, GLint value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramParameteri(program, pname, value);
+    glad_trace_record(777, glad_start);
+}
+static PFNGLUSEPROGRAMSTAGESPROC glad_trace_real_glUseProgramStages;
+static void APIENTRY glad_trace_glUseProgramStages(GLuint pipeline, GLbitfield stages, GLuint program) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glUseProgramStages(pipeline, stages, program);
+    glad_trace_record(778, glad_start);
+}
+static PFNGLACTIVESHADERPROGRAMPROC glad_trace_real_glActiveShaderProgram;
+static void APIENTRY glad_trace_glActiveShaderProgram(GLuint pipeline, GLuint program) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glActiveShaderProgram(pipeline, program);
+    glad_trace_record(779, glad_start);
+}
+static PFNGLCREATESHADERPROGRAMVPROC glad_trace_real_glCreateShaderProgramv;
+static GLuint APIENTRY glad_trace_glCreateShaderProgramv(GLenum type, GLsizei count, const GLchar *const*strings) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    GLuint glad_result = glad_trace_real_glCreateShaderProgramv(type, count, strings);
+    glad_trace_record(780, glad_start);
+    return glad_result;
+}
+static PFNGLBINDPROGRAMPIPELINEPROC glad_trace_real_glBindProgramPipeline;
+static void APIENTRY glad_trace_glBindProgramPipeline(GLuint pipeline) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glBindProgramPipeline(pipeline);
+    glad_trace_record(781, glad_start);
+}
+static PFNGLDELETEPROGRAMPIPELINESPROC glad_trace_real_glDeleteProgramPipelines;
+static void APIENTRY glad_trace_glDeleteProgramPipelines(GLsizei n, const GLuint *pipelines) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDeleteProgramPipelines(n, pipelines);
+    glad_trace_record(782, glad_start);
+}
+static PFNGLGENPROGRAMPIPELINESPROC glad_trace_real_glGenProgramPipelines;
+static void APIENTRY glad_trace_glGenProgramPipelines(GLsizei n, GLuint *pipelines) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGenProgramPipelines(n, pipelines);
+    glad_trace_record(783, glad_start);
+}
+static PFNGLISPROGRAMPIPELINEPROC glad_trace_real_glIsProgramPipeline;
+static GLboolean APIENTRY glad_trace_glIsProgramPipeline(GLuint pipeline) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    GLboolean glad_result = glad_trace_real_glIsProgramPipeline(pipeline);
+    glad_trace_record(784, glad_start);
+    return glad_result;
+}
+static PFNGLGETPROGRAMPIPELINEIVPROC glad_trace_real_glGetProgramPipelineiv;
+static void APIENTRY glad_trace_glGetProgramPipelineiv(GLuint pipeline, GLenum pname, GLint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetProgramPipelineiv(pipeline, pname, params);
+    glad_trace_record(785, glad_start);
+}
+static PFNGLPROGRAMUNIFORM1IPROC glad_trace_real_glProgramUniform1i;
+static void APIENTRY glad_trace_glProgramUniform1i(GLuint program, GLint location, GLint v0) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniform1i(program, location, v0);
+    glad_trace_record(786, glad_start);
+}
+static PFNGLPROGRAMUNIFORM1IVPROC glad_trace_real_glProgramUniform1iv;
+static void APIENTRY glad_trace_glProgramUniform1iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniform1iv(program, location, count, value);
+    glad_trace_record(787, glad_start);
+}
+static PFNGLPROGRAMUNIFORM1FPROC glad_trace_real_glProgramUniform1f;
+static void APIENTRY glad_trace_glProgramUniform1f(GLuint program, GLint location, GLfloat v0) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniform1f(program, location, v0);
+    glad_trace_record(788, glad_start);
+}
+static PFNGLPROGRAMUNIFORM1FVPROC glad_trace_real_glProgramUniform1fv;
+static void APIENTRY glad_trace_glProgramUniform1fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniform1fv(program, location, count, value);
+    glad_trace_record(789, glad_start);
+}
+static PFNGLPROGRAMUNIFORM1DPROC glad_trace_real_glProgramUniform1d;
+static void APIENTRY glad_trace_glProgramUniform1d(GLuint program, GLint location, GLdouble v0) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniform1d(program, location, v0);
+    glad_trace_record(790, glad_start);
+}
+static PFNGLPROGRAMUNIFORM1DVPROC glad_trace_real_glProgramUniform1dv;
+static void APIENTRY glad_trace_glProgramUniform1dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniform1dv(program, location, count, value);
+    glad_trace_record(791, glad_start);
+}
+static PFNGLPROGRAMUNIFORM1UIPROC glad_trace_real_glProgramUniform1ui;
+static void APIENTRY glad_trace_glProgramUniform1ui(GLuint program, GLint location, GLuint v0) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniform1ui(program, location, v0);
+    glad_trace_record(792, glad_start);
+}
+static PFNGLPROGRAMUNIFORM1UIVPROC glad_trace_real_glProgramUniform1uiv;
+static void APIENTRY glad_trace_glProgramUniform1uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniform1uiv(program, location, count, value);
+    glad_trace_record(793, glad_start);
+}
+static PFNGLPROGRAMUNIFORM2IPROC glad_trace_real_glProgramUniform2i;
+static void APIENTRY glad_trace_glProgramUniform2i(GLuint program, GLint location, GLint v0, GLint v1) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniform2i(program, location, v0, v1);
+    glad_trace_record(794, glad_start);
+}
+static PFNGLPROGRAMUNIFORM2IVPROC glad_trace_real_glProgramUniform2iv;
+static void APIENTRY glad_trace_glProgramUniform2iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniform2iv(program, location, count, value);
+    glad_trace_record(795, glad_start);
+}
+static PFNGLPROGRAMUNIFORM2FPROC glad_trace_real_glProgramUniform2f;
+static void APIENTRY glad_trace_glProgramUniform2f(GLuint program, GLint location, GLfloat v0, GLfloat v1) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniform2f(program, location, v0, v1);
+    glad_trace_record(796, glad_start);
+}
+static PFNGLPROGRAMUNIFORM2FVPROC glad_trace_real_glProgramUniform2fv;
+static void APIENTRY glad_trace_glProgramUniform2fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniform2fv(program, location, count, value);
+    glad_trace_record(797, glad_start);
+}
+static PFNGLPROGRAMUNIFORM2DPROC glad_trace_real_glProgramUniform2d;
+static void APIENTRY glad_trace_glProgramUniform2d(GLuint program, GLint location, GLdouble v0, GLdouble v1) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniform2d(program, location, v0, v1);
+    glad_trace_record(798, glad_start);
+}
+static PFNGLPROGRAMUNIFORM2DVPROC glad_trace_real_glProgramUniform2dv;
+static void APIENTRY glad_trace_glProgramUniform2dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniform2dv(program, location, count, value);
+    glad_trace_record(799, glad_start);
+}
+static PFNGLPROGRAMUNIFORM2UIPROC glad_trace_real_glProgramUniform2ui;
+static void APIENTRY glad_trace_glProgramUniform2ui(GLuint program, GLint location, GLuint v0, GLuint v1) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniform2ui(program, location, v0, v1);
+    glad_trace_record(800, glad_start);
+}
+static PFNGLPROGRAMUNIFORM2UIVPROC glad_trace_real_glProgramUniform2uiv;
+static void APIENTRY glad_trace_glProgramUniform2uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniform2uiv(program, location, count, value);
+    glad_trace_record(801, glad_start);
+}
+static PFNGLPROGRAMUNIFORM3IPROC glad_trace_real_glProgramUniform3i;
+static void APIENTRY glad_trace_glProgramUniform3i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniform3i(program, location, v0, v1, v2);
+    glad_trace_record(802, glad_start);
+}
+static PFNGLPROGRAMUNIFORM3IVPROC glad_trace_real_glProgramUniform3iv;
+static void APIENTRY glad_trace_glProgramUniform3iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniform3iv(program, location, count, value);
+    glad_trace_record(803, glad_start);
+}
+static PFNGLPROGRAMUNIFORM3FPROC glad_trace_real_glProgramUniform3f;
+static void APIENTRY glad_trace_glProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniform3f(program, location, v0, v1, v2);
+    glad_trace_record(804, glad_start);
+}
+static PFNGLPROGRAMUNIFORM3FVPROC glad_trace_real_glProgramUniform3fv;
+static void APIENTRY glad_trace_glProgramUniform3fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniform3fv(program, location, count, value);
+    glad_trace_record(805, glad_start);
+}
+static PFNGLPROGRAMUNIFORM3DPROC glad_trace_real_glProgramUniform3d;
+static void APIENTRY glad_trace_glProgramUniform3d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniform3d(program, location, v0, v1, v2);
+    glad_trace_record(806, glad_start);
+}
+static PFNGLPROGRAMUNIFORM3DVPROC glad_trace_real_glProgramUniform3dv;
+static void APIENTRY glad_trace_glProgramUniform3dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniform3dv(program, location, count, value);
+    glad_trace_record(807, glad_start);
+}
+static PFNGLPROGRAMUNIFORM3UIPROC glad_trace_real_glProgramUniform3ui;
+static void APIENTRY glad_trace_glProgramUniform3ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniform3ui(program, location, v0, v1, v2);
+    glad_trace_record(808, glad_start);
+}
+static PFNGLPROGRAMUNIFORM3UIVPROC glad_trace_real_glProgramUniform3uiv;
+static void APIENTRY glad_trace_glProgramUniform3uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniform3uiv(program, location, count, value);
+    glad_trace_record(809, glad_start);
+}
+static PFNGLPROGRAMUNIFORM4IPROC glad_trace_real_glProgramUniform4i;
+static void APIENTRY glad_trace_glProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniform4i(program, location, v0, v1, v2, v3);
+    glad_trace_record(810, glad_start);
+}
+static PFNGLPROGRAMUNIFORM4IVPROC glad_trace_real_glProgramUniform4iv;
+static void APIENTRY glad_trace_glProgramUniform4iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniform4iv(program, location, count, value);
+    glad_trace_record(811, glad_start);
+}
+static PFNGLPROGRAMUNIFORM4FPROC glad_trace_real_glProgramUniform4f;
+static void APIENTRY glad_trace_glProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniform4f(program, location, v0, v1, v2, v3);
+    glad_trace_record(812, glad_start);
+}
+static PFNGLPROGRAMUNIFORM4FVPROC glad_trace_real_glProgramUniform4fv;
+static void APIENTRY glad_trace_glProgramUniform4fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniform4fv(program, location, count, value);
+    glad_trace_record(813, glad_start);
+}
+static PFNGLPROGRAMUNIFORM4DPROC glad_trace_real_glProgramUniform4d;
+static void APIENTRY glad_trace_glProgramUniform4d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniform4d(program, location, v0, v1, v2, v3);
+    glad_trace_record(814, glad_start);
+}
+static PFNGLPROGRAMUNIFORM4DVPROC glad_trace_real_glProgramUniform4dv;
+static void APIENTRY glad_trace_glProgramUniform4dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniform4dv(program, location, count, value);
+    glad_trace_record(815, glad_start);
+}
+static PFNGLPROGRAMUNIFORM4UIPROC glad_trace_real_glProgramUniform4ui;
+static void APIENTRY glad_trace_glProgramUniform4ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniform4ui(program, location, v0, v1, v2, v3);
+    glad_trace_record(816, glad_start);
+}
+static PFNGLPROGRAMUNIFORM4UIVPROC glad_trace_real_glProgramUniform4uiv;
+static void APIENTRY glad_trace_glProgramUniform4uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniform4uiv(program, location, count, value);
+    glad_trace_record(817, glad_start);
+}
+static PFNGLPROGRAMUNIFORMMATRIX2FVPROC glad_trace_real_glProgramUniformMatrix2fv;
+static void APIENTRY glad_trace_glProgramUniformMatrix2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniformMatrix2fv(program, location, count, transpose, value);
+    glad_trace_record(818, glad_start);
+}
+static PFNGLPROGRAMUNIFORMMATRIX3FVPROC glad_trace_real_glProgramUniformMatrix3fv;
+static void APIENTRY glad_trace_glProgramUniformMatrix3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniformMatrix3fv(program, location, count, transpose, value);
+    glad_trace_record(819, glad_start);
+}
+static PFNGLPROGRAMUNIFORMMATRIX4FVPROC glad_trace_real_glProgramUniformMatrix4fv;
+static void APIENTRY glad_trace_glProgramUniformMatrix4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniformMatrix4fv(program, location, count, transpose, value);
+    glad_trace_record(820, glad_start);
+}
+static PFNGLPROGRAMUNIFORMMATRIX2DVPROC glad_trace_real_glProgramUniformMatrix2dv;
+static void APIENTRY glad_trace_glProgramUniformMatrix2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniformMatrix2dv(program, location, count, transpose, value);
+    glad_trace_record(821, glad_start);
+}
+static PFNGLPROGRAMUNIFORMMATRIX3DVPROC glad_trace_real_glProgramUniformMatrix3dv;
+static void APIENTRY glad_trace_glProgramUniformMatrix3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniformMatrix3dv(program, location, count, transpose, value);
+    glad_trace_record(822, glad_start);
+}
+static PFNGLPROGRAMUNIFORMMATRIX4DVPROC glad_trace_real_glProgramUniformMatrix4dv;
+static void APIENTRY glad_trace_glProgramUniformMatrix4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniformMatrix4dv(program, location, count, transpose, value);
+    glad_trace_record(823, glad_start);
+}
+static PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC glad_trace_real_glProgramUniformMatrix2x3fv;
+static void APIENTRY glad_trace_glProgramUniformMatrix2x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniformMatrix2x3fv(program, location, count, transpose, value);
+    glad_trace_record(824, glad_start);
+}
+static PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC glad_trace_real_glProgramUniformMatrix3x2fv;
+static void APIENTRY glad_trace_glProgramUniformMatrix3x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniformMatrix3x2fv(program, location, count, transpose, value);
+    glad_trace_record(825, glad_start);
+}
+static PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC glad_trace_real_glProgramUniformMatrix2x4fv;
+static void APIENTRY glad_trace_glProgramUniformMatrix2x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniformMatrix2x4fv(program, location, count, transpose, value);
+    glad_trace_record(826, glad_start);
+}
+static PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC glad_trace_real_glProgramUniformMatrix4x2fv;
+static void APIENTRY glad_trace_glProgramUniformMatrix4x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniformMatrix4x2fv(program, location, count, transpose, value);
+    glad_trace_record(827, glad_start);
+}
+static PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC glad_trace_real_glProgramUniformMatrix3x4fv;
+static void APIENTRY glad_trace_glProgramUniformMatrix3x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniformMatrix3x4fv(program, location, count, transpose, value);
+    glad_trace_record(828, glad_start);
+}
+static PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC glad_trace_real_glProgramUniformMatrix4x3fv;
+static void APIENTRY glad_trace_glProgramUniformMatrix4x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniformMatrix4x3fv(program, location, count, transpose, value);
+    glad_trace_record(829, glad_start);
+}
+static PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC glad_trace_real_glProgramUniformMatrix2x3dv;
+static void APIENTRY glad_trace_glProgramUniformMatrix2x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniformMatrix2x3dv(program, location, count, transpose, value);
+    glad_trace_record(830, glad_start);
+}
+static PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC glad_trace_real_glProgramUniformMatrix3x2dv;
+static void APIENTRY glad_trace_glProgramUniformMatrix3x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniformMatrix3x2dv(program, location, count, transpose, value);
+    glad_trace_record(831, glad_start);
+}
+static PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC glad_trace_real_glProgramUniformMatrix2x4dv;
+static void APIENTRY glad_trace_glProgramUniformMatrix2x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniformMatrix2x4dv(program, location, count, transpose, value);
+    glad_trace_record(832, glad_start);
+}
+static PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC glad_trace_real_glProgramUniformMatrix4x2dv;
+static void APIENTRY glad_trace_glProgramUniformMatrix4x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniformMatrix4x2dv(program, location, count, transpose, value);
+    glad_trace_record(833, glad_start);
+}
+static PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC glad_trace_real_glProgramUniformMatrix3x4dv;
+static void APIENTRY glad_trace_glProgramUniformMatrix3x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniformMatrix3x4dv(program, location, count, transpose, value);
+    glad_trace_record(834, glad_start);
+}
+static PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC glad_trace_real_glProgramUniformMatrix4x3dv;
+static void APIENTRY glad_trace_glProgramUniformMatrix4x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glProgramUniformMatrix4x3dv(program, location, count, transpose, value);
+    glad_trace_record(835, glad_start);
+}
+static PFNGLVALIDATEPROGRAMPIPELINEPROC glad_trace_real_glValidateProgramPipeline;
+static void APIENTRY glad_trace_glValidateProgramPipeline(GLuint pipeline) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glValidateProgramPipeline(pipeline);
+    glad_trace_record(836, glad_start);
+}
+static PFNGLGETPROGRAMPIPELINEINFOLOGPROC glad_trace_real_glGetProgramPipelineInfoLog;
+static void APIENTRY glad_trace_glGetProgramPipelineInfoLog(GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetProgramPipelineInfoLog(pipeline, bufSize, length, infoLog);
+    glad_trace_record(837, glad_start);
+}
+static PFNGLVERTEXATTRIBL1DPROC glad_trace_real_glVertexAttribL1d;
+static void APIENTRY glad_trace_glVertexAttribL1d(GLuint index, GLdouble x) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttribL1d(index, x);
+    glad_trace_record(838, glad_start);
+}
+static PFNGLVERTEXATTRIBL2DPROC glad_trace_real_glVertexAttribL2d;
+static void APIENTRY glad_trace_glVertexAttribL2d(GLuint index, GLdouble x, GLdouble y) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttribL2d(index, x, y);
+    glad_trace_record(839, glad_start);
+}
+static PFNGLVERTEXATTRIBL3DPROC glad_trace_real_glVertexAttribL3d;
+static void APIENTRY glad_trace_glVertexAttribL3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttribL3d(index, x, y, z);
+    glad_trace_record(840, glad_start);
+}
+static PFNGLVERTEXATTRIBL4DPROC glad_trace_real_glVertexAttribL4d;
+static void APIENTRY glad_trace_glVertexAttribL4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttribL4d(index, x, y, z, w);
+    glad_trace_record(841, glad_start);
+}
+static PFNGLVERTEXATTRIBL1DVPROC glad_trace_real_glVertexAttribL1dv;
+static void APIENTRY glad_trace_glVertexAttribL1dv(GLuint index, const GLdouble *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttribL1dv(index, v);
+    glad_trace_record(842, glad_start);
+}
+static PFNGLVERTEXATTRIBL2DVPROC glad_trace_real_glVertexAttribL2dv;
+static void APIENTRY glad_trace_glVertexAttribL2dv(GLuint index, const GLdouble *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttribL2dv(index, v);
+    glad_trace_record(843, glad_start);
+}
+static PFNGLVERTEXATTRIBL3DVPROC glad_trace_real_glVertexAttribL3dv;
+static void APIENTRY glad_trace_glVertexAttribL3dv(GLuint index, const GLdouble *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttribL3dv(index, v);
+    glad_trace_record(844, glad_start);
+}
+static PFNGLVERTEXATTRIBL4DVPROC glad_trace_real_glVertexAttribL4dv;
+static void APIENTRY glad_trace_glVertexAttribL4dv(GLuint index, const GLdouble *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttribL4dv(index, v);
+    glad_trace_record(845, glad_start);
+}
+static PFNGLVERTEXATTRIBLPOINTERPROC glad_trace_real_glVertexAttribLPointer;
+static void APIENTRY glad_trace_glVertexAttribLPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttribLPointer(index, size, type, stride, pointer);
+    glad_trace_record(846, glad_start);
+}
+static PFNGLGETVERTEXATTRIBLDVPROC glad_trace_real_glGetVertexAttribLdv;
+static void APIENTRY glad_trace_glGetVertexAttribLdv(GLuint index, GLenum pname, GLdouble *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetVertexAttribLdv(index, pname, params);
+    glad_trace_record(847, glad_start);
+}
+static PFNGLVIEWPORTARRAYVPROC glad_trace_real_glViewportArrayv;
+static void APIENTRY glad_trace_glViewportArrayv(GLuint first, GLsizei count, const GLfloat *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glViewportArrayv(first, count, v);
+    glad_trace_record(848, glad_start);
+}
+static PFNGLVIEWPORTINDEXEDFPROC glad_trace_real_glViewportIndexedf;
+static void APIENTRY glad_trace_glViewportIndexedf(GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glViewportIndexedf(index, x, y, w, h);
+    glad_trace_record(849, glad_start);
+}
+static PFNGLVIEWPORTINDEXEDFVPROC glad_trace_real_glViewportIndexedfv;
+static void APIENTRY glad_trace_glViewportIndexedfv(GLuint index, const GLfloat *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glViewportIndexedfv(index, v);
+    glad_trace_record(850, glad_start);
+}
+static PFNGLSCISSORARRAYVPROC glad_trace_real_glScissorArrayv;
+static void APIENTRY glad_trace_glScissorArrayv(GLuint first, GLsizei count, const GLint *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glScissorArrayv(first, count, v);
+    glad_trace_record(851, glad_start);
+}
+static PFNGLSCISSORINDEXEDPROC glad_trace_real_glScissorIndexed;
+static void APIENTRY glad_trace_glScissorIndexed(GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glScissorIndexed(index, left, bottom, width, height);
+    glad_trace_record(852, glad_start);
+}
+static PFNGLSCISSORINDEXEDVPROC glad_trace_real_glScissorIndexedv;
+static void APIENTRY glad_trace_glScissorIndexedv(GLuint index, const GLint *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glScissorIndexedv(index, v);
+    glad_trace_record(853, glad_start);
+}
+static PFNGLDEPTHRANGEARRAYVPROC glad_trace_real_glDepthRangeArrayv;
+static void APIENTRY glad_trace_glDepthRangeArrayv(GLuint first, GLsizei count, const GLdouble *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDepthRangeArrayv(first, count, v);
+    glad_trace_record(854, glad_start);
+}
+static PFNGLDEPTHRANGEINDEXEDPROC glad_trace_real_glDepthRangeIndexed;
+static void APIENTRY glad_trace_glDepthRangeIndexed(GLuint index, GLdouble n, GLdouble f) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDepthRangeIndexed(index, n, f);
+    glad_trace_record(855, glad_start);
+}
+static PFNGLGETFLOATI_VPROC glad_trace_real_glGetFloati_v;
+static void APIENTRY glad_trace_glGetFloati_v(GLenum target, GLuint index, GLfloat *data) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetFloati_v(target, index, data);
+    glad_trace_record(856, glad_start);
+}
+static PFNGLGETDOUBLEI_VPROC glad_trace_real_glGetDoublei_v;
+static void APIENTRY glad_trace_glGetDoublei_v(GLenum target, GLuint index, GLdouble *data) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetDoublei_v(target, index, data);
+    glad_trace_record(857, glad_start);
+}
+static PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC glad_trace_real_glDrawArraysInstancedBaseInstance;
+static void APIENTRY glad_trace_glDrawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDrawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance);
+    glad_trace_record(858, glad_start);
+}
+static PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC glad_trace_real_glDrawElementsInstancedBaseInstance;
+static void APIENTRY glad_trace_glDrawElementsInstancedBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDrawElementsInstancedBaseInstance(mode, count, type, indices, instancecount, baseinstance);
+    glad_trace_record(859, glad_start);
+}
+static PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC glad_trace_real_glDrawElementsInstancedBaseVertexBaseInstance;
+static void APIENTRY glad_trace_glDrawElementsInstancedBaseVertexBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDrawElementsInstancedBaseVertexBaseInstance(mode, count, type, indices, instancecount, basevertex, baseinstance);
+    glad_trace_record(860, glad_start);
+}
+static PFNGLGETINTERNALFORMATIVPROC glad_trace_real_glGetInternalformativ;
+static void APIENTRY glad_trace_glGetInternalformativ(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetInternalformativ(target, internalformat, pname, count, params);
+    glad_trace_record(861, glad_start);
+}
+static PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC glad_trace_real_glGetActiveAtomicCounterBufferiv;
+static void APIENTRY glad_trace_glGetActiveAtomicCounterBufferiv(GLuint program, GLuint bufferIndex, GLenum pname, GLint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetActiveAtomicCounterBufferiv(program, bufferIndex, pname, params);
+    glad_trace_record(862, glad_start);
+}
+static PFNGLBINDIMAGETEXTUREPROC glad_trace_real_glBindImageTexture;
+static void APIENTRY glad_trace_glBindImageTexture(GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glBindImageTexture(unit, texture, level, layered, layer, access, format);
+    glad_trace_record(863, glad_start);
+}
+static PFNGLMEMORYBARRIERPROC glad_trace_real_glMemoryBarrier;
+static void APIENTRY glad_trace_glMemoryBarrier(GLbitfield barriers) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMemoryBarrier(barriers);
+    glad_trace_record(864, glad_start);
+}
+static PFNGLTEXSTORAGE1DPROC glad_trace_real_glTexStorage1D;
+static void APIENTRY glad_trace_glTexStorage1D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexStorage1D(target, levels, internalformat, width);
+    glad_trace_record(865, glad_start);
+}
+static PFNGLTEXSTORAGE2DPROC glad_trace_real_glTexStorage2D;
+static void APIENTRY glad_trace_glTexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexStorage2D(target, levels, internalformat, width, height);
+    glad_trace_record(866, glad_start);
+}
+static PFNGLTEXSTORAGE3DPROC glad_trace_real_glTexStorage3D;
+static void APIENTRY glad_trace_glTexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexStorage3D(target, levels, internalformat, width, height, depth);
+    glad_trace_record(867, glad_start);
+}
+static PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC glad_trace_real_glDrawTransformFeedbackInstanced;
+static void APIENTRY glad_trace_glDrawTransformFeedbackInstanced(GLenum mode, GLuint id, GLsizei instancecount) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDrawTransformFeedbackInstanced(mode, id, instancecount);
+    glad_trace_record(868, glad_start);
+}
+static PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC glad_trace_real_glDrawTransformFeedbackStreamInstanced;
+static void APIENTRY glad_trace_glDrawTransformFeedbackStreamInstanced(GLenum mode, GLuint id, GLuint stream, GLsizei instancecount) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDrawTransformFeedbackStreamInstanced(mode, id, stream, instancecount);
+    glad_trace_record(869, glad_start);
+}
+static PFNGLCLEARBUFFERDATAPROC glad_trace_real_glClearBufferData;
+static void APIENTRY glad_trace_glClearBufferData(GLenum target, GLenum internalformat, GLenum format, GLenum type, const void *data) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glClearBufferData(target, internalformat, format, type, data);
+    glad_trace_record(870, glad_start);
+}
+static PFNGLCLEARBUFFERSUBDATAPROC glad_trace_real_glClearBufferSubData;
+static void APIENTRY glad_trace_glClearBufferSubData(GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glClearBufferSubData(target, internalformat, offset, size, format, type, data);
+    glad_trace_record(871, glad_start);
+}
+static PFNGLDISPATCHCOMPUTEPROC glad_trace_real_glDispatchCompute;
+static void APIENTRY glad_trace_glDispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDispatchCompute(num_groups_x, num_groups_y, num_groups_z);
+    glad_trace_record(872, glad_start);
+}
+static PFNGLDISPATCHCOMPUTEINDIRECTPROC glad_trace_real_glDispatchComputeIndirect;
+static void APIENTRY glad_trace_glDispatchComputeIndirect(GLintptr indirect) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDispatchComputeIndirect(indirect);
+    glad_trace_record(873, glad_start);
+}
+static PFNGLCOPYIMAGESUBDATAPROC glad_trace_real_glCopyImageSubData;
+static void APIENTRY glad_trace_glCopyImageSubData(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glCopyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+    glad_trace_record(874, glad_start);
+}
+static PFNGLFRAMEBUFFERPARAMETERIPROC glad_trace_real_glFramebufferParameteri;
+static void APIENTRY glad_trace_glFramebufferParameteri(GLenum target, GLenum pname, GLint param) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glFramebufferParameteri(target, pname, param);
+    glad_trace_record(875, glad_start);
+}
+static PFNGLGETFRAMEBUFFERPARAMETERIVPROC glad_trace_real_glGetFramebufferParameteriv;
+static void APIENTRY glad_trace_glGetFramebufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetFramebufferParameteriv(target, pname, params);
+    glad_trace_record(876, glad_start);
+}
+static PFNGLGETINTERNALFORMATI64VPROC glad_trace_real_glGetInternalformati64v;
+static void APIENTRY glad_trace_glGetInternalformati64v(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint64 *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetInternalformati64v(target, internalformat, pname, count, params);
+    glad_trace_record(877, glad_start);
+}
+static PFNGLINVALIDATETEXSUBIMAGEPROC glad_trace_real_glInvalidateTexSubImage;
+static void APIENTRY glad_trace_glInvalidateTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glInvalidateTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth);
+    glad_trace_record(878, glad_start);
+}
+static PFNGLINVALIDATETEXIMAGEPROC glad_trace_real_glInvalidateTexImage;
+static void APIENTRY glad_trace_glInvalidateTexImage(GLuint texture, GLint level) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glInvalidateTexImage(texture, level);
+    glad_trace_record(879, glad_start);
+}
+static PFNGLINVALIDATEBUFFERSUBDATAPROC glad_trace_real_glInvalidateBufferSubData;
+static void APIENTRY glad_trace_glInvalidateBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr length) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glInvalidateBufferSubData(buffer, offset, length);
+    glad_trace_record(880, glad_start);
+}
+static PFNGLINVALIDATEBUFFERDATAPROC glad_trace_real_glInvalidateBufferData;
+static void APIENTRY glad_trace_glInvalidateBufferData(GLuint buffer) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glInvalidateBufferData(buffer);
+    glad_trace_record(881, glad_start);
+}
+static PFNGLINVALIDATEFRAMEBUFFERPROC glad_trace_real_glInvalidateFramebuffer;
+static void APIENTRY glad_trace_glInvalidateFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glInvalidateFramebuffer(target, numAttachments, attachments);
+    glad_trace_record(882, glad_start);
+}
+static PFNGLINVALIDATESUBFRAMEBUFFERPROC glad_trace_real_glInvalidateSubFramebuffer;
+static void APIENTRY glad_trace_glInvalidateSubFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glInvalidateSubFramebuffer(target, numAttachments, attachments, x, y, width, height);
+    glad_trace_record(883, glad_start);
+}
+static PFNGLMULTIDRAWARRAYSINDIRECTPROC glad_trace_real_glMultiDrawArraysIndirect;
+static void APIENTRY glad_trace_glMultiDrawArraysIndirect(GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiDrawArraysIndirect(mode, indirect, drawcount, stride);
+    glad_trace_record(884, glad_start);
+}
+static PFNGLMULTIDRAWELEMENTSINDIRECTPROC glad_trace_real_glMultiDrawElementsIndirect;
+static void APIENTRY glad_trace_glMultiDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiDrawElementsIndirect(mode, type, indirect, drawcount, stride);
+    glad_trace_record(885, glad_start);
+}
+static PFNGLGETPROGRAMINTERFACEIVPROC glad_trace_real_glGetProgramInterfaceiv;
+static void APIENTRY glad_trace_glGetProgramInterfaceiv(GLuint program, GLenum programInterface, GLenum pname, GLint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetProgramInterfaceiv(program, programInterface, pname, params);
+    glad_trace_record(886, glad_start);
+}
+static PFNGLGETPROGRAMRESOURCEINDEXPROC glad_trace_real_glGetProgramResourceIndex;
+static GLuint APIENTRY glad_trace_glGetProgramResourceIndex(GLuint program, GLenum programInterface, const GLchar *name) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    GLuint glad_result = glad_trace_real_glGetProgramResourceIndex(program, programInterface, name);
+    glad_trace_record(887, glad_start);
+    return glad_result;
+}
+static PFNGLGETPROGRAMRESOURCENAMEPROC glad_trace_real_glGetProgramResourceName;
+static void APIENTRY glad_trace_glGetProgramResourceName(GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetProgramResourceName(program, programInterface, index, bufSize, length, name);
+    glad_trace_record(888, glad_start);
+}
+static PFNGLGETPROGRAMRESOURCEIVPROC glad_trace_real_glGetProgramResourceiv;
+static void APIENTRY glad_trace_glGetProgramResourceiv(GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei count, GLsizei *length, GLint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetProgramResourceiv(program, programInterface, index, propCount, props, count, length, params);
+    glad_trace_record(889, glad_start);
+}
+static PFNGLGETPROGRAMRESOURCELOCATIONPROC glad_trace_real_glGetProgramResourceLocation;
+static GLint APIENTRY glad_trace_glGetProgramResourceLocation(GLuint program, GLenum programInterface, const GLchar *name) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    GLint glad_result = glad_trace_real_glGetProgramResourceLocation(program, programInterface, name);
+    glad_trace_record(890, glad_start);
+    return glad_result;
+}
+static PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC glad_trace_real_glGetProgramResourceLocationIndex;
+static GLint APIENTRY glad_trace_glGetProgramResourceLocationIndex(GLuint program, GLenum programInterface, const GLchar *name) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    GLint glad_result = glad_trace_real_glGetProgramResourceLocationIndex(program, programInterface, name);
+    glad_trace_record(891, glad_start);
+    return glad_result;
+}
+static PFNGLSHADERSTORAGEBLOCKBINDINGPROC glad_trace_real_glShaderStorageBlockBinding;
+static void APIENTRY glad_trace_glShaderStorageBlockBinding(GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glShaderStorageBlockBinding(program, storageBlockIndex, storageBlockBinding);
+    glad_trace_record(892, glad_start);
+}
+static PFNGLTEXBUFFERRANGEPROC glad_trace_real_glTexBufferRange;
+static void APIENTRY glad_trace_glTexBufferRange(GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexBufferRange(target, internalformat, buffer, offset, size);
+    glad_trace_record(893, glad_start);
+}
+static PFNGLTEXSTORAGE2DMULTISAMPLEPROC glad_trace_real_glTexStorage2DMultisample;
+static void APIENTRY glad_trace_glTexStorage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexStorage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+    glad_trace_record(894, glad_start);
+}
+static PFNGLTEXSTORAGE3DMULTISAMPLEPROC glad_trace_real_glTexStorage3DMultisample;
+static void APIENTRY glad_trace_glTexStorage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTexStorage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+    glad_trace_record(895, glad_start);
+}
+static PFNGLTEXTUREVIEWPROC glad_trace_real_glTextureView;
+static void APIENTRY glad_trace_glTextureView(GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTextureView(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
+    glad_trace_record(896, glad_start);
+}
+static PFNGLBINDVERTEXBUFFERPROC glad_trace_real_glBindVertexBuffer;
+static void APIENTRY glad_trace_glBindVertexBuffer(GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glBindVertexBuffer(bindingindex, buffer, offset, stride);
+    glad_trace_record(897, glad_start);
+}
+static PFNGLVERTEXATTRIBFORMATPROC glad_trace_real_glVertexAttribFormat;
+static void APIENTRY glad_trace_glVertexAttribFormat(GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttribFormat(attribindex, size, type, normalized, relativeoffset);
+    glad_trace_record(898, glad_start);
+}
+static PFNGLVERTEXATTRIBIFORMATPROC glad_trace_real_glVertexAttribIFormat;
+static void APIENTRY glad_trace_glVertexAttribIFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttribIFormat(attribindex, size, type, relativeoffset);
+    glad_trace_record(899, glad_start);
+}
+static PFNGLVERTEXATTRIBLFORMATPROC glad_trace_real_glVertexAttribLFormat;
+static void APIENTRY glad_trace_glVertexAttribLFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttribLFormat(attribindex, size, type, relativeoffset);
+    glad_trace_record(900, glad_start);
+}
+static PFNGLVERTEXATTRIBBINDINGPROC glad_trace_real_glVertexAttribBinding;
+static void APIENTRY glad_trace_glVertexAttribBinding(GLuint attribindex, GLuint bindingindex) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexAttribBinding(attribindex, bindingindex);
+    glad_trace_record(901, glad_start);
+}
+static PFNGLVERTEXBINDINGDIVISORPROC glad_trace_real_glVertexBindingDivisor;
+static void APIENTRY glad_trace_glVertexBindingDivisor(GLuint bindingindex, GLuint divisor) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexBindingDivisor(bindingindex, divisor);
+    glad_trace_record(902, glad_start);
+}
+static PFNGLDEBUGMESSAGECONTROLPROC glad_trace_real_glDebugMessageControl;
+static void APIENTRY glad_trace_glDebugMessageControl(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDebugMessageControl(source, type, severity, count, ids, enabled);
+    glad_trace_record(903, glad_start);
+}
+static PFNGLDEBUGMESSAGEINSERTPROC glad_trace_real_glDebugMessageInsert;
+static void APIENTRY glad_trace_glDebugMessageInsert(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDebugMessageInsert(source, type, id, severity, length, buf);
+    glad_trace_record(904, glad_start);
+}
+static PFNGLDEBUGMESSAGECALLBACKPROC glad_trace_real_glDebugMessageCallback;
+static void APIENTRY glad_trace_glDebugMessageCallback(GLDEBUGPROC callback, const void *userParam) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDebugMessageCallback(callback, userParam);
+    glad_trace_record(905, glad_start);
+}
+static PFNGLGETDEBUGMESSAGELOGPROC glad_trace_real_glGetDebugMessageLog;
+static GLuint APIENTRY glad_trace_glGetDebugMessageLog(GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    GLuint glad_result = glad_trace_real_glGetDebugMessageLog(count, bufSize, sources, types, ids, severities, lengths, messageLog);
+    glad_trace_record(906, glad_start);
+    return glad_result;
+}
+static PFNGLPUSHDEBUGGROUPPROC glad_trace_real_glPushDebugGroup;
+static void APIENTRY glad_trace_glPushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar *message) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glPushDebugGroup(source, id, length, message);
+    glad_trace_record(907, glad_start);
+}
+static PFNGLPOPDEBUGGROUPPROC glad_trace_real_glPopDebugGroup;
+static void APIENTRY glad_trace_glPopDebugGroup(void) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glPopDebugGroup();
+    glad_trace_record(908, glad_start);
+}
+static PFNGLOBJECTLABELPROC glad_trace_real_glObjectLabel;
+static void APIENTRY glad_trace_glObjectLabel(GLenum identifier, GLuint name, GLsizei length, const GLchar *label) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glObjectLabel(identifier, name, length, label);
+    glad_trace_record(909, glad_start);
+}
+static PFNGLGETOBJECTLABELPROC glad_trace_real_glGetObjectLabel;
+static void APIENTRY glad_trace_glGetObjectLabel(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetObjectLabel(identifier, name, bufSize, length, label);
+    glad_trace_record(910, glad_start);
+}
+static PFNGLOBJECTPTRLABELPROC glad_trace_real_glObjectPtrLabel;
+static void APIENTRY glad_trace_glObjectPtrLabel(const void *ptr, GLsizei length, const GLchar *label) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glObjectPtrLabel(ptr, length, label);
+    glad_trace_record(911, glad_start);
+}
+static PFNGLGETOBJECTPTRLABELPROC glad_trace_real_glGetObjectPtrLabel;
+static void APIENTRY glad_trace_glGetObjectPtrLabel(const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetObjectPtrLabel(ptr, bufSize, length, label);
+    glad_trace_record(912, glad_start);
+}
+static PFNGLBUFFERSTORAGEPROC glad_trace_real_glBufferStorage;
+static void APIENTRY glad_trace_glBufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glBufferStorage(target, size, data, flags);
+    glad_trace_record(913, glad_start);
+}
+static PFNGLCLEARTEXIMAGEPROC glad_trace_real_glClearTexImage;
+static void APIENTRY glad_trace_glClearTexImage(GLuint texture, GLint level, GLenum format, GLenum type, const void *data) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glClearTexImage(texture, level, format, type, data);
+    glad_trace_record(914, glad_start);
+}
+static PFNGLCLEARTEXSUBIMAGEPROC glad_trace_real_glClearTexSubImage;
+static void APIENTRY glad_trace_glClearTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *data) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glClearTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data);
+    glad_trace_record(915, glad_start);
+}
+static PFNGLBINDBUFFERSBASEPROC glad_trace_real_glBindBuffersBase;
+static void APIENTRY glad_trace_glBindBuffersBase(GLenum target, GLuint first, GLsizei count, const GLuint *buffers) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glBindBuffersBase(target, first, count, buffers);
+    glad_trace_record(916, glad_start);
+}
+static PFNGLBINDBUFFERSRANGEPROC glad_trace_real_glBindBuffersRange;
+static void APIENTRY glad_trace_glBindBuffersRange(GLenum target, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizeiptr *sizes) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glBindBuffersRange(target, first, count, buffers, offsets, sizes);
+    glad_trace_record(917, glad_start);
+}
+static PFNGLBINDTEXTURESPROC glad_trace_real_glBindTextures;
+static void APIENTRY glad_trace_glBindTextures(GLuint first, GLsizei count, const GLuint *textures) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glBindTextures(first, count, textures);
+    glad_trace_record(918, glad_start);
+}
+static PFNGLBINDSAMPLERSPROC glad_trace_real_glBindSamplers;
+static void APIENTRY glad_trace_glBindSamplers(GLuint first, GLsizei count, const GLuint *samplers) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glBindSamplers(first, count, samplers);
+    glad_trace_record(919, glad_start);
+}
+static PFNGLBINDIMAGETEXTURESPROC glad_trace_real_glBindImageTextures;
+static void APIENTRY glad_trace_glBindImageTextures(GLuint first, GLsizei count, const GLuint *textures) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glBindImageTextures(first, count, textures);
+    glad_trace_record(920, glad_start);
+}
+static PFNGLBINDVERTEXBUFFERSPROC glad_trace_real_glBindVertexBuffers;
+static void APIENTRY glad_trace_glBindVertexBuffers(GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glBindVertexBuffers(first, count, buffers, offsets, strides);
+    glad_trace_record(921, glad_start);
+}
+static PFNGLCLIPCONTROLPROC glad_trace_real_glClipControl;
+static void APIENTRY glad_trace_glClipControl(GLenum origin, GLenum depth) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glClipControl(origin, depth);
+    glad_trace_record(922, glad_start);
+}
+static PFNGLCREATETRANSFORMFEEDBACKSPROC glad_trace_real_glCreateTransformFeedbacks;
+static void APIENTRY glad_trace_glCreateTransformFeedbacks(GLsizei n, GLuint *ids) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glCreateTransformFeedbacks(n, ids);
+    glad_trace_record(923, glad_start);
+}
+static PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC glad_trace_real_glTransformFeedbackBufferBase;
+static void APIENTRY glad_trace_glTransformFeedbackBufferBase(GLuint xfb, GLuint index, GLuint buffer) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTransformFeedbackBufferBase(xfb, index, buffer);
+    glad_trace_record(924, glad_start);
+}
+static PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC glad_trace_real_glTransformFeedbackBufferRange;
+static void APIENTRY glad_trace_glTransformFeedbackBufferRange(GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTransformFeedbackBufferRange(xfb, index, buffer, offset, size);
+    glad_trace_record(925, glad_start);
+}
+static PFNGLGETTRANSFORMFEEDBACKIVPROC glad_trace_real_glGetTransformFeedbackiv;
+static void APIENTRY glad_trace_glGetTransformFeedbackiv(GLuint xfb, GLenum pname, GLint *param) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetTransformFeedbackiv(xfb, pname, param);
+    glad_trace_record(926, glad_start);
+}
+static PFNGLGETTRANSFORMFEEDBACKI_VPROC glad_trace_real_glGetTransformFeedbacki_v;
+static void APIENTRY glad_trace_glGetTransformFeedbacki_v(GLuint xfb, GLenum pname, GLuint index, GLint *param) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetTransformFeedbacki_v(xfb, pname, index, param);
+    glad_trace_record(927, glad_start);
+}
+static PFNGLGETTRANSFORMFEEDBACKI64_VPROC glad_trace_real_glGetTransformFeedbacki64_v;
+static void APIENTRY glad_trace_glGetTransformFeedbacki64_v(GLuint xfb, GLenum pname, GLuint index, GLint64 *param) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetTransformFeedbacki64_v(xfb, pname, index, param);
+    glad_trace_record(928, glad_start);
+}
+static PFNGLCREATEBUFFERSPROC glad_trace_real_glCreateBuffers;
+static void APIENTRY glad_trace_glCreateBuffers(GLsizei n, GLuint *buffers) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glCreateBuffers(n, buffers);
+    glad_trace_record(929, glad_start);
+}
+static PFNGLNAMEDBUFFERSTORAGEPROC glad_trace_real_glNamedBufferStorage;
+static void APIENTRY glad_trace_glNamedBufferStorage(GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glNamedBufferStorage(buffer, size, data, flags);
+    glad_trace_record(930, glad_start);
+}
+static PFNGLNAMEDBUFFERDATAPROC glad_trace_real_glNamedBufferData;
+static void APIENTRY glad_trace_glNamedBufferData(GLuint buffer, GLsizeiptr size, const void *data, GLenum usage) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glNamedBufferData(buffer, size, data, usage);
+    glad_trace_record(931, glad_start);
+}
+static PFNGLNAMEDBUFFERSUBDATAPROC glad_trace_real_glNamedBufferSubData;
+static void APIENTRY glad_trace_glNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glNamedBufferSubData(buffer, offset, size, data);
+    glad_trace_record(932, glad_start);
+}
+static PFNGLCOPYNAMEDBUFFERSUBDATAPROC glad_trace_real_glCopyNamedBufferSubData;
+static void APIENTRY glad_trace_glCopyNamedBufferSubData(GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glCopyNamedBufferSubData(readBuffer, writeBuffer, readOffset, writeOffset, size);
+    glad_trace_record(933, glad_start);
+}
+static PFNGLCLEARNAMEDBUFFERDATAPROC glad_trace_real_glClearNamedBufferData;
+static void APIENTRY glad_trace_glClearNamedBufferData(GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glClearNamedBufferData(buffer, internalformat, format, type, data);
+    glad_trace_record(934, glad_start);
+}
+static PFNGLCLEARNAMEDBUFFERSUBDATAPROC glad_trace_real_glClearNamedBufferSubData;
+static void APIENTRY glad_trace_glClearNamedBufferSubData(GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glClearNamedBufferSubData(buffer, internalformat, offset, size, format, type, data);
+    glad_trace_record(935, glad_start);
+}
+static PFNGLMAPNAMEDBUFFERPROC glad_trace_real_glMapNamedBuffer;
+static void * APIENTRY glad_trace_glMapNamedBuffer(GLuint buffer, GLenum access) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    void * glad_result = glad_trace_real_glMapNamedBuffer(buffer, access);
+    glad_trace_record(936, glad_start);
+    return glad_result;
+}
+static PFNGLMAPNAMEDBUFFERRANGEPROC glad_trace_real_glMapNamedBufferRange;
+static void * APIENTRY glad_trace_glMapNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    void * glad_result = glad_trace_real_glMapNamedBufferRange(buffer, offset, length, access);
+    glad_trace_record(937, glad_start);
+    return glad_result;
+}
+static PFNGLUNMAPNAMEDBUFFERPROC glad_trace_real_glUnmapNamedBuffer;
+static GLboolean APIENTRY glad_trace_glUnmapNamedBuffer(GLuint buffer) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    GLboolean glad_result = glad_trace_real_glUnmapNamedBuffer(buffer);
+    glad_trace_record(938, glad_start);
+    return glad_result;
+}
+static PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC glad_trace_real_glFlushMappedNamedBufferRange;
+static void APIENTRY glad_trace_glFlushMappedNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glFlushMappedNamedBufferRange(buffer, offset, length);
+    glad_trace_record(939, glad_start);
+}
+static PFNGLGETNAMEDBUFFERPARAMETERIVPROC glad_trace_real_glGetNamedBufferParameteriv;
+static void APIENTRY glad_trace_glGetNamedBufferParameteriv(GLuint buffer, GLenum pname, GLint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetNamedBufferParameteriv(buffer, pname, params);
+    glad_trace_record(940, glad_start);
+}
+static PFNGLGETNAMEDBUFFERPARAMETERI64VPROC glad_trace_real_glGetNamedBufferParameteri64v;
+static void APIENTRY glad_trace_glGetNamedBufferParameteri64v(GLuint buffer, GLenum pname, GLint64 *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetNamedBufferParameteri64v(buffer, pname, params);
+    glad_trace_record(941, glad_start);
+}
+static PFNGLGETNAMEDBUFFERPOINTERVPROC glad_trace_real_glGetNamedBufferPointerv;
+static void APIENTRY glad_trace_glGetNamedBufferPointerv(GLuint buffer, GLenum pname, void **params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetNamedBufferPointerv(buffer, pname, params);
+    glad_trace_record(942, glad_start);
+}
+static PFNGLGETNAMEDBUFFERSUBDATAPROC glad_trace_real_glGetNamedBufferSubData;
+static void APIENTRY glad_trace_glGetNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, void *data) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetNamedBufferSubData(buffer, offset, size, data);
+    glad_trace_record(943, glad_start);
+}
+static PFNGLCREATEFRAMEBUFFERSPROC glad_trace_real_glCreateFramebuffers;
+static void APIENTRY glad_trace_glCreateFramebuffers(GLsizei n, GLuint *framebuffers) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glCreateFramebuffers(n, framebuffers);
+    glad_trace_record(944, glad_start);
+}
+static PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC glad_trace_real_glNamedFramebufferRenderbuffer;
+static void APIENTRY glad_trace_glNamedFramebufferRenderbuffer(GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glNamedFramebufferRenderbuffer(framebuffer, attachment, renderbuffertarget, renderbuffer);
+    glad_trace_record(945, glad_start);
+}
+static PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC glad_trace_real_glNamedFramebufferParameteri;
+static void APIENTRY glad_trace_glNamedFramebufferParameteri(GLuint framebuffer, GLenum pname, GLint param) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glNamedFramebufferParameteri(framebuffer, pname, param);
+    glad_trace_record(946, glad_start);
+}
+static PFNGLNAMEDFRAMEBUFFERTEXTUREPROC glad_trace_real_glNamedFramebufferTexture;
+static void APIENTRY glad_trace_glNamedFramebufferTexture(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glNamedFramebufferTexture(framebuffer, attachment, texture, level);
+    glad_trace_record(947, glad_start);
+}
+static PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC glad_trace_real_glNamedFramebufferTextureLayer;
+static void APIENTRY glad_trace_glNamedFramebufferTextureLayer(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glNamedFramebufferTextureLayer(framebuffer, attachment, texture, level, layer);
+    glad_trace_record(948, glad_start);
+}
+static PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC glad_trace_real_glNamedFramebufferDrawBuffer;
+static void APIENTRY glad_trace_glNamedFramebufferDrawBuffer(GLuint framebuffer, GLenum buf) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glNamedFramebufferDrawBuffer(framebuffer, buf);
+    glad_trace_record(949, glad_start);
+}
+static PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC glad_trace_real_glNamedFramebufferDrawBuffers;
+static void APIENTRY glad_trace_glNamedFramebufferDrawBuffers(GLuint framebuffer, GLsizei n, const GLenum *bufs) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glNamedFramebufferDrawBuffers(framebuffer, n, bufs);
+    glad_trace_record(950, glad_start);
+}
+static PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC glad_trace_real_glNamedFramebufferReadBuffer;
+static void APIENTRY glad_trace_glNamedFramebufferReadBuffer(GLuint framebuffer, GLenum src) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glNamedFramebufferReadBuffer(framebuffer, src);
+    glad_trace_record(951, glad_start);
+}
+static PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC glad_trace_real_glInvalidateNamedFramebufferData;
+static void APIENTRY glad_trace_glInvalidateNamedFramebufferData(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glInvalidateNamedFramebufferData(framebuffer, numAttachments, attachments);
+    glad_trace_record(952, glad_start);
+}
+static PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC glad_trace_real_glInvalidateNamedFramebufferSubData;
+static void APIENTRY glad_trace_glInvalidateNamedFramebufferSubData(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glInvalidateNamedFramebufferSubData(framebuffer, numAttachments, attachments, x, y, width, height);
+    glad_trace_record(953, glad_start);
+}
+static PFNGLCLEARNAMEDFRAMEBUFFERIVPROC glad_trace_real_glClearNamedFramebufferiv;
+static void APIENTRY glad_trace_glClearNamedFramebufferiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glClearNamedFramebufferiv(framebuffer, buffer, drawbuffer, value);
+    glad_trace_record(954, glad_start);
+}
+static PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC glad_trace_real_glClearNamedFramebufferuiv;
+static void APIENTRY glad_trace_glClearNamedFramebufferuiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLuint *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glClearNamedFramebufferuiv(framebuffer, buffer, drawbuffer, value);
+    glad_trace_record(955, glad_start);
+}
+static PFNGLCLEARNAMEDFRAMEBUFFERFVPROC glad_trace_real_glClearNamedFramebufferfv;
+static void APIENTRY glad_trace_glClearNamedFramebufferfv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glClearNamedFramebufferfv(framebuffer, buffer, drawbuffer, value);
+    glad_trace_record(956, glad_start);
+}
+static PFNGLCLEARNAMEDFRAMEBUFFERFIPROC glad_trace_real_glClearNamedFramebufferfi;
+static void APIENTRY glad_trace_glClearNamedFramebufferfi(GLuint framebuffer, GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glClearNamedFramebufferfi(framebuffer, buffer, drawbuffer, depth, stencil);
+    glad_trace_record(957, glad_start);
+}
+static PFNGLBLITNAMEDFRAMEBUFFERPROC glad_trace_real_glBlitNamedFramebuffer;
+static void APIENTRY glad_trace_glBlitNamedFramebuffer(GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glBlitNamedFramebuffer(readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+    glad_trace_record(958, glad_start);
+}
+static PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC glad_trace_real_glCheckNamedFramebufferStatus;
+static GLenum APIENTRY glad_trace_glCheckNamedFramebufferStatus(GLuint framebuffer, GLenum target) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    GLenum glad_result = glad_trace_real_glCheckNamedFramebufferStatus(framebuffer, target);
+    glad_trace_record(959, glad_start);
+    return glad_result;
+}
+static PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC glad_trace_real_glGetNamedFramebufferParameteriv;
+static void APIENTRY glad_trace_glGetNamedFramebufferParameteriv(GLuint framebuffer, GLenum pname, GLint *param) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetNamedFramebufferParameteriv(framebuffer, pname, param);
+    glad_trace_record(960, glad_start);
+}
+static PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_trace_real_glGetNamedFramebufferAttachmentParameteriv;
+static void APIENTRY glad_trace_glGetNamedFramebufferAttachmentParameteriv(GLuint framebuffer, GLenum attachment, GLenum pname, GLint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetNamedFramebufferAttachmentParameteriv(framebuffer, attachment, pname, params);
+    glad_trace_record(961, glad_start);
+}
+static PFNGLCREATERENDERBUFFERSPROC glad_trace_real_glCreateRenderbuffers;
+static void APIENTRY glad_trace_glCreateRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glCreateRenderbuffers(n, renderbuffers);
+    glad_trace_record(962, glad_start);
+}
+static PFNGLNAMEDRENDERBUFFERSTORAGEPROC glad_trace_real_glNamedRenderbufferStorage;
+static void APIENTRY glad_trace_glNamedRenderbufferStorage(GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glNamedRenderbufferStorage(renderbuffer, internalformat, width, height);
+    glad_trace_record(963, glad_start);
+}
+static PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_trace_real_glNamedRenderbufferStorageMultisample;
+static void APIENTRY glad_trace_glNamedRenderbufferStorageMultisample(GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glNamedRenderbufferStorageMultisample(renderbuffer, samples, internalformat, width, height);
+    glad_trace_record(964, glad_start);
+}
+static PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC glad_trace_real_glGetNamedRenderbufferParameteriv;
+static void APIENTRY glad_trace_glGetNamedRenderbufferParameteriv(GLuint renderbuffer, GLenum pname, GLint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetNamedRenderbufferParameteriv(renderbuffer, pname, params);
+    glad_trace_record(965, glad_start);
+}
+static PFNGLCREATETEXTURESPROC glad_trace_real_glCreateTextures;
+static void APIENTRY glad_trace_glCreateTextures(GLenum target, GLsizei n, GLuint *textures) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glCreateTextures(target, n, textures);
+    glad_trace_record(966, glad_start);
+}
+static PFNGLTEXTUREBUFFERPROC glad_trace_real_glTextureBuffer;
+static void APIENTRY glad_trace_glTextureBuffer(GLuint texture, GLenum internalformat, GLuint buffer) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTextureBuffer(texture, internalformat, buffer);
+    glad_trace_record(967, glad_start);
+}
+static PFNGLTEXTUREBUFFERRANGEPROC glad_trace_real_glTextureBufferRange;
+static void APIENTRY glad_trace_glTextureBufferRange(GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTextureBufferRange(texture, internalformat, buffer, offset, size);
+    glad_trace_record(968, glad_start);
+}
+static PFNGLTEXTURESTORAGE1DPROC glad_trace_real_glTextureStorage1D;
+static void APIENTRY glad_trace_glTextureStorage1D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTextureStorage1D(texture, levels, internalformat, width);
+    glad_trace_record(969, glad_start);
+}
+static PFNGLTEXTURESTORAGE2DPROC glad_trace_real_glTextureStorage2D;
+static void APIENTRY glad_trace_glTextureStorage2D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTextureStorage2D(texture, levels, internalformat, width, height);
+    glad_trace_record(970, glad_start);
+}
+static PFNGLTEXTURESTORAGE3DPROC glad_trace_real_glTextureStorage3D;
+static void APIENTRY glad_trace_glTextureStorage3D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTextureStorage3D(texture, levels, internalformat, width, height, depth);
+    glad_trace_record(971, glad_start);
+}
+static PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC glad_trace_real_glTextureStorage2DMultisample;
+static void APIENTRY glad_trace_glTextureStorage2DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTextureStorage2DMultisample(texture, samples, internalformat, width, height, fixedsamplelocations);
+    glad_trace_record(972, glad_start);
+}
+static PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC glad_trace_real_glTextureStorage3DMultisample;
+static void APIENTRY glad_trace_glTextureStorage3DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTextureStorage3DMultisample(texture, samples, internalformat, width, height, depth, fixedsamplelocations);
+    glad_trace_record(973, glad_start);
+}
+static PFNGLTEXTURESUBIMAGE1DPROC glad_trace_real_glTextureSubImage1D;
+static void APIENTRY glad_trace_glTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTextureSubImage1D(texture, level, xoffset, width, format, type, pixels);
+    glad_trace_record(974, glad_start);
+}
+static PFNGLTEXTURESUBIMAGE2DPROC glad_trace_real_glTextureSubImage2D;
+static void APIENTRY glad_trace_glTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, type, pixels);
+    glad_trace_record(975, glad_start);
+}
+static PFNGLTEXTURESUBIMAGE3DPROC glad_trace_real_glTextureSubImage3D;
+static void APIENTRY glad_trace_glTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+    glad_trace_record(976, glad_start);
+}
+static PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC glad_trace_real_glCompressedTextureSubImage1D;
+static void APIENTRY glad_trace_glCompressedTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glCompressedTextureSubImage1D(texture, level, xoffset, width, format, imageSize, data);
+    glad_trace_record(977, glad_start);
+}
+static PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC glad_trace_real_glCompressedTextureSubImage2D;
+static void APIENTRY glad_trace_glCompressedTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glCompressedTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, imageSize, data);
+    glad_trace_record(978, glad_start);
+}
+static PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC glad_trace_real_glCompressedTextureSubImage3D;
+static void APIENTRY glad_trace_glCompressedTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glCompressedTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+    glad_trace_record(979, glad_start);
+}
+static PFNGLCOPYTEXTURESUBIMAGE1DPROC glad_trace_real_glCopyTextureSubImage1D;
+static void APIENTRY glad_trace_glCopyTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glCopyTextureSubImage1D(texture, level, xoffset, x, y, width);
+    glad_trace_record(980, glad_start);
+}
+static PFNGLCOPYTEXTURESUBIMAGE2DPROC glad_trace_real_glCopyTextureSubImage2D;
+static void APIENTRY glad_trace_glCopyTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glCopyTextureSubImage2D(texture, level, xoffset, yoffset, x, y, width, height);
+    glad_trace_record(981, glad_start);
+}
+static PFNGLCOPYTEXTURESUBIMAGE3DPROC glad_trace_real_glCopyTextureSubImage3D;
+static void APIENTRY glad_trace_glCopyTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glCopyTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, x, y, width, height);
+    glad_trace_record(982, glad_start);
+}
+static PFNGLTEXTUREPARAMETERFPROC glad_trace_real_glTextureParameterf;
+static void APIENTRY glad_trace_glTextureParameterf(GLuint texture, GLenum pname, GLfloat param) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTextureParameterf(texture, pname, param);
+    glad_trace_record(983, glad_start);
+}
+static PFNGLTEXTUREPARAMETERFVPROC glad_trace_real_glTextureParameterfv;
+static void APIENTRY glad_trace_glTextureParameterfv(GLuint texture, GLenum pname, const GLfloat *param) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTextureParameterfv(texture, pname, param);
+    glad_trace_record(984, glad_start);
+}
+static PFNGLTEXTUREPARAMETERIPROC glad_trace_real_glTextureParameteri;
+static void APIENTRY glad_trace_glTextureParameteri(GLuint texture, GLenum pname, GLint param) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTextureParameteri(texture, pname, param);
+    glad_trace_record(985, glad_start);
+}
+static PFNGLTEXTUREPARAMETERIIVPROC glad_trace_real_glTextureParameterIiv;
+static void APIENTRY glad_trace_glTextureParameterIiv(GLuint texture, GLenum pname, const GLint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTextureParameterIiv(texture, pname, params);
+    glad_trace_record(986, glad_start);
+}
+static PFNGLTEXTUREPARAMETERIUIVPROC glad_trace_real_glTextureParameterIuiv;
+static void APIENTRY glad_trace_glTextureParameterIuiv(GLuint texture, GLenum pname, const GLuint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTextureParameterIuiv(texture, pname, params);
+    glad_trace_record(987, glad_start);
+}
+static PFNGLTEXTUREPARAMETERIVPROC glad_trace_real_glTextureParameteriv;
+static void APIENTRY glad_trace_glTextureParameteriv(GLuint texture, GLenum pname, const GLint *param) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTextureParameteriv(texture, pname, param);
+    glad_trace_record(988, glad_start);
+}
+static PFNGLGENERATETEXTUREMIPMAPPROC glad_trace_real_glGenerateTextureMipmap;
+static void APIENTRY glad_trace_glGenerateTextureMipmap(GLuint texture) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGenerateTextureMipmap(texture);
+    glad_trace_record(989, glad_start);
+}
+static PFNGLBINDTEXTUREUNITPROC glad_trace_real_glBindTextureUnit;
+static void APIENTRY glad_trace_glBindTextureUnit(GLuint unit, GLuint texture) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glBindTextureUnit(unit, texture);
+    glad_trace_record(990, glad_start);
+}
+static PFNGLGETTEXTUREIMAGEPROC glad_trace_real_glGetTextureImage;
+static void APIENTRY glad_trace_glGetTextureImage(GLuint texture, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetTextureImage(texture, level, format, type, bufSize, pixels);
+    glad_trace_record(991, glad_start);
+}
+static PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC glad_trace_real_glGetCompressedTextureImage;
+static void APIENTRY glad_trace_glGetCompressedTextureImage(GLuint texture, GLint level, GLsizei bufSize, void *pixels) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetCompressedTextureImage(texture, level, bufSize, pixels);
+    glad_trace_record(992, glad_start);
+}
+static PFNGLGETTEXTURELEVELPARAMETERFVPROC glad_trace_real_glGetTextureLevelParameterfv;
+static void APIENTRY glad_trace_glGetTextureLevelParameterfv(GLuint texture, GLint level, GLenum pname, GLfloat *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetTextureLevelParameterfv(texture, level, pname, params);
+    glad_trace_record(993, glad_start);
+}
+static PFNGLGETTEXTURELEVELPARAMETERIVPROC glad_trace_real_glGetTextureLevelParameteriv;
+static void APIENTRY glad_trace_glGetTextureLevelParameteriv(GLuint texture, GLint level, GLenum pname, GLint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetTextureLevelParameteriv(texture, level, pname, params);
+    glad_trace_record(994, glad_start);
+}
+static PFNGLGETTEXTUREPARAMETERFVPROC glad_trace_real_glGetTextureParameterfv;
+static void APIENTRY glad_trace_glGetTextureParameterfv(GLuint texture, GLenum pname, GLfloat *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetTextureParameterfv(texture, pname, params);
+    glad_trace_record(995, glad_start);
+}
+static PFNGLGETTEXTUREPARAMETERIIVPROC glad_trace_real_glGetTextureParameterIiv;
+static void APIENTRY glad_trace_glGetTextureParameterIiv(GLuint texture, GLenum pname, GLint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetTextureParameterIiv(texture, pname, params);
+    glad_trace_record(996, glad_start);
+}
+static PFNGLGETTEXTUREPARAMETERIUIVPROC glad_trace_real_glGetTextureParameterIuiv;
+static void APIENTRY glad_trace_glGetTextureParameterIuiv(GLuint texture, GLenum pname, GLuint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetTextureParameterIuiv(texture, pname, params);
+    glad_trace_record(997, glad_start);
+}
+static PFNGLGETTEXTUREPARAMETERIVPROC glad_trace_real_glGetTextureParameteriv;
+static void APIENTRY glad_trace_glGetTextureParameteriv(GLuint texture, GLenum pname, GLint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetTextureParameteriv(texture, pname, params);
+    glad_trace_record(998, glad_start);
+}
+static PFNGLCREATEVERTEXARRAYSPROC glad_trace_real_glCreateVertexArrays;
+static void APIENTRY glad_trace_glCreateVertexArrays(GLsizei n, GLuint *arrays) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glCreateVertexArrays(n, arrays);
+    glad_trace_record(999, glad_start);
+}
+static PFNGLDISABLEVERTEXARRAYATTRIBPROC glad_trace_real_glDisableVertexArrayAttrib;
+static void APIENTRY glad_trace_glDisableVertexArrayAttrib(GLuint vaobj, GLuint index) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glDisableVertexArrayAttrib(vaobj, index);
+    glad_trace_record(1000, glad_start);
+}
+static PFNGLENABLEVERTEXARRAYATTRIBPROC glad_trace_real_glEnableVertexArrayAttrib;
+static void APIENTRY glad_trace_glEnableVertexArrayAttrib(GLuint vaobj, GLuint index) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glEnableVertexArrayAttrib(vaobj, index);
+    glad_trace_record(1001, glad_start);
+}
+static PFNGLVERTEXARRAYELEMENTBUFFERPROC glad_trace_real_glVertexArrayElementBuffer;
+static void APIENTRY glad_trace_glVertexArrayElementBuffer(GLuint vaobj, GLuint buffer) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexArrayElementBuffer(vaobj, buffer);
+    glad_trace_record(1002, glad_start);
+}
+static PFNGLVERTEXARRAYVERTEXBUFFERPROC glad_trace_real_glVertexArrayVertexBuffer;
+static void APIENTRY glad_trace_glVertexArrayVertexBuffer(GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexArrayVertexBuffer(vaobj, bindingindex, buffer, offset, stride);
+    glad_trace_record(1003, glad_start);
+}
+static PFNGLVERTEXARRAYVERTEXBUFFERSPROC glad_trace_real_glVertexArrayVertexBuffers;
+static void APIENTRY glad_trace_glVertexArrayVertexBuffers(GLuint vaobj, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexArrayVertexBuffers(vaobj, first, count, buffers, offsets, strides);
+    glad_trace_record(1004, glad_start);
+}
+static PFNGLVERTEXARRAYATTRIBBINDINGPROC glad_trace_real_glVertexArrayAttribBinding;
+static void APIENTRY glad_trace_glVertexArrayAttribBinding(GLuint vaobj, GLuint attribindex, GLuint bindingindex) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexArrayAttribBinding(vaobj, attribindex, bindingindex);
+    glad_trace_record(1005, glad_start);
+}
+static PFNGLVERTEXARRAYATTRIBFORMATPROC glad_trace_real_glVertexArrayAttribFormat;
+static void APIENTRY glad_trace_glVertexArrayAttribFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexArrayAttribFormat(vaobj, attribindex, size, type, normalized, relativeoffset);
+    glad_trace_record(1006, glad_start);
+}
+static PFNGLVERTEXARRAYATTRIBIFORMATPROC glad_trace_real_glVertexArrayAttribIFormat;
+static void APIENTRY glad_trace_glVertexArrayAttribIFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexArrayAttribIFormat(vaobj, attribindex, size, type, relativeoffset);
+    glad_trace_record(1007, glad_start);
+}
+static PFNGLVERTEXARRAYATTRIBLFORMATPROC glad_trace_real_glVertexArrayAttribLFormat;
+static void APIENTRY glad_trace_glVertexArrayAttribLFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexArrayAttribLFormat(vaobj, attribindex, size, type, relativeoffset);
+    glad_trace_record(1008, glad_start);
+}
+static PFNGLVERTEXARRAYBINDINGDIVISORPROC glad_trace_real_glVertexArrayBindingDivisor;
+static void APIENTRY glad_trace_glVertexArrayBindingDivisor(GLuint vaobj, GLuint bindingindex, GLuint divisor) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glVertexArrayBindingDivisor(vaobj, bindingindex, divisor);
+    glad_trace_record(1009, glad_start);
+}
+static PFNGLGETVERTEXARRAYIVPROC glad_trace_real_glGetVertexArrayiv;
+static void APIENTRY glad_trace_glGetVertexArrayiv(GLuint vaobj, GLenum pname, GLint *param) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetVertexArrayiv(vaobj, pname, param);
+    glad_trace_record(1010, glad_start);
+}
+static PFNGLGETVERTEXARRAYINDEXEDIVPROC glad_trace_real_glGetVertexArrayIndexediv;
+static void APIENTRY glad_trace_glGetVertexArrayIndexediv(GLuint vaobj, GLuint index, GLenum pname, GLint *param) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetVertexArrayIndexediv(vaobj, index, pname, param);
+    glad_trace_record(1011, glad_start);
+}
+static PFNGLGETVERTEXARRAYINDEXED64IVPROC glad_trace_real_glGetVertexArrayIndexed64iv;
+static void APIENTRY glad_trace_glGetVertexArrayIndexed64iv(GLuint vaobj, GLuint index, GLenum pname, GLint64 *param) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetVertexArrayIndexed64iv(vaobj, index, pname, param);
+    glad_trace_record(1012, glad_start);
+}
+static PFNGLCREATESAMPLERSPROC glad_trace_real_glCreateSamplers;
+static void APIENTRY glad_trace_glCreateSamplers(GLsizei n, GLuint *samplers) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glCreateSamplers(n, samplers);
+    glad_trace_record(1013, glad_start);
+}
+static PFNGLCREATEPROGRAMPIPELINESPROC glad_trace_real_glCreateProgramPipelines;
+static void APIENTRY glad_trace_glCreateProgramPipelines(GLsizei n, GLuint *pipelines) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glCreateProgramPipelines(n, pipelines);
+    glad_trace_record(1014, glad_start);
+}
+static PFNGLCREATEQUERIESPROC glad_trace_real_glCreateQueries;
+static void APIENTRY glad_trace_glCreateQueries(GLenum target, GLsizei n, GLuint *ids) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glCreateQueries(target, n, ids);
+    glad_trace_record(1015, glad_start);
+}
+static PFNGLGETQUERYBUFFEROBJECTI64VPROC glad_trace_real_glGetQueryBufferObjecti64v;
+static void APIENTRY glad_trace_glGetQueryBufferObjecti64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetQueryBufferObjecti64v(id, buffer, pname, offset);
+    glad_trace_record(1016, glad_start);
+}
+static PFNGLGETQUERYBUFFEROBJECTIVPROC glad_trace_real_glGetQueryBufferObjectiv;
+static void APIENTRY glad_trace_glGetQueryBufferObjectiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetQueryBufferObjectiv(id, buffer, pname, offset);
+    glad_trace_record(1017, glad_start);
+}
+static PFNGLGETQUERYBUFFEROBJECTUI64VPROC glad_trace_real_glGetQueryBufferObjectui64v;
+static void APIENTRY glad_trace_glGetQueryBufferObjectui64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetQueryBufferObjectui64v(id, buffer, pname, offset);
+    glad_trace_record(1018, glad_start);
+}
+static PFNGLGETQUERYBUFFEROBJECTUIVPROC glad_trace_real_glGetQueryBufferObjectuiv;
+static void APIENTRY glad_trace_glGetQueryBufferObjectuiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetQueryBufferObjectuiv(id, buffer, pname, offset);
+    glad_trace_record(1019, glad_start);
+}
+static PFNGLMEMORYBARRIERBYREGIONPROC glad_trace_real_glMemoryBarrierByRegion;
+static void APIENTRY glad_trace_glMemoryBarrierByRegion(GLbitfield barriers) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMemoryBarrierByRegion(barriers);
+    glad_trace_record(1020, glad_start);
+}
+static PFNGLGETTEXTURESUBIMAGEPROC glad_trace_real_glGetTextureSubImage;
+static void APIENTRY glad_trace_glGetTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, GLsizei bufSize, void *pixels) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels);
+    glad_trace_record(1021, glad_start);
+}
+static PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC glad_trace_real_glGetCompressedTextureSubImage;
+static void APIENTRY glad_trace_glGetCompressedTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei bufSize, void *pixels) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetCompressedTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels);
+    glad_trace_record(1022, glad_start);
+}
+static PFNGLGETGRAPHICSRESETSTATUSPROC glad_trace_real_glGetGraphicsResetStatus;
+static GLenum APIENTRY glad_trace_glGetGraphicsResetStatus(void) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    GLenum glad_result = glad_trace_real_glGetGraphicsResetStatus();
+    glad_trace_record(1023, glad_start);
+    return glad_result;
+}
+static PFNGLGETNCOMPRESSEDTEXIMAGEPROC glad_trace_real_glGetnCompressedTexImage;
+static void APIENTRY glad_trace_glGetnCompressedTexImage(GLenum target, GLint lod, GLsizei bufSize, void *pixels) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetnCompressedTexImage(target, lod, bufSize, pixels);
+    glad_trace_record(1024, glad_start);
+}
+static PFNGLGETNTEXIMAGEPROC glad_trace_real_glGetnTexImage;
+static void APIENTRY glad_trace_glGetnTexImage(GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetnTexImage(target, level, format, type, bufSize, pixels);
+    glad_trace_record(1025, glad_start);
+}
+static PFNGLGETNUNIFORMDVPROC glad_trace_real_glGetnUniformdv;
+static void APIENTRY glad_trace_glGetnUniformdv(GLuint program, GLint location, GLsizei bufSize, GLdouble *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetnUniformdv(program, location, bufSize, params);
+    glad_trace_record(1026, glad_start);
+}
+static PFNGLGETNUNIFORMFVPROC glad_trace_real_glGetnUniformfv;
+static void APIENTRY glad_trace_glGetnUniformfv(GLuint program, GLint location, GLsizei bufSize, GLfloat *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetnUniformfv(program, location, bufSize, params);
+    glad_trace_record(1027, glad_start);
+}
+static PFNGLGETNUNIFORMIVPROC glad_trace_real_glGetnUniformiv;
+static void APIENTRY glad_trace_glGetnUniformiv(GLuint program, GLint location, GLsizei bufSize, GLint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetnUniformiv(program, location, bufSize, params);
+    glad_trace_record(1028, glad_start);
+}
+static PFNGLGETNUNIFORMUIVPROC glad_trace_real_glGetnUniformuiv;
+static void APIENTRY glad_trace_glGetnUniformuiv(GLuint program, GLint location, GLsizei bufSize, GLuint *params) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetnUniformuiv(program, location, bufSize, params);
+    glad_trace_record(1029, glad_start);
+}
+static PFNGLREADNPIXELSPROC glad_trace_real_glReadnPixels;
+static void APIENTRY glad_trace_glReadnPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glReadnPixels(x, y, width, height, format, type, bufSize, data);
+    glad_trace_record(1030, glad_start);
+}
+static PFNGLGETNMAPDVPROC glad_trace_real_glGetnMapdv;
+static void APIENTRY glad_trace_glGetnMapdv(GLenum target, GLenum query, GLsizei bufSize, GLdouble *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetnMapdv(target, query, bufSize, v);
+    glad_trace_record(1031, glad_start);
+}
+static PFNGLGETNMAPFVPROC glad_trace_real_glGetnMapfv;
+static void APIENTRY glad_trace_glGetnMapfv(GLenum target, GLenum query, GLsizei bufSize, GLfloat *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetnMapfv(target, query, bufSize, v);
+    glad_trace_record(1032, glad_start);
+}
+static PFNGLGETNMAPIVPROC glad_trace_real_glGetnMapiv;
+static void APIENTRY glad_trace_glGetnMapiv(GLenum target, GLenum query, GLsizei bufSize, GLint *v) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetnMapiv(target, query, bufSize, v);
+    glad_trace_record(1033, glad_start);
+}
+static PFNGLGETNPIXELMAPFVPROC glad_trace_real_glGetnPixelMapfv;
+static void APIENTRY glad_trace_glGetnPixelMapfv(GLenum map, GLsizei bufSize, GLfloat *values) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetnPixelMapfv(map, bufSize, values);
+    glad_trace_record(1034, glad_start);
+}
+static PFNGLGETNPIXELMAPUIVPROC glad_trace_real_glGetnPixelMapuiv;
+static void APIENTRY glad_trace_glGetnPixelMapuiv(GLenum map, GLsizei bufSize, GLuint *values) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetnPixelMapuiv(map, bufSize, values);
+    glad_trace_record(1035, glad_start);
+}
+static PFNGLGETNPIXELMAPUSVPROC glad_trace_real_glGetnPixelMapusv;
+static void APIENTRY glad_trace_glGetnPixelMapusv(GLenum map, GLsizei bufSize, GLushort *values) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetnPixelMapusv(map, bufSize, values);
+    glad_trace_record(1036, glad_start);
+}
+static PFNGLGETNPOLYGONSTIPPLEPROC glad_trace_real_glGetnPolygonStipple;
+static void APIENTRY glad_trace_glGetnPolygonStipple(GLsizei bufSize, GLubyte *pattern) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetnPolygonStipple(bufSize, pattern);
+    glad_trace_record(1037, glad_start);
+}
+static PFNGLGETNCOLORTABLEPROC glad_trace_real_glGetnColorTable;
+static void APIENTRY glad_trace_glGetnColorTable(GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *table) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetnColorTable(target, format, type, bufSize, table);
+    glad_trace_record(1038, glad_start);
+}
+static PFNGLGETNCONVOLUTIONFILTERPROC glad_trace_real_glGetnConvolutionFilter;
+static void APIENTRY glad_trace_glGetnConvolutionFilter(GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *image) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetnConvolutionFilter(target, format, type, bufSize, image);
+    glad_trace_record(1039, glad_start);
+}
+static PFNGLGETNSEPARABLEFILTERPROC glad_trace_real_glGetnSeparableFilter;
+static void APIENTRY glad_trace_glGetnSeparableFilter(GLenum target, GLenum format, GLenum type, GLsizei rowBufSize, void *row, GLsizei columnBufSize, void *column, void *span) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetnSeparableFilter(target, format, type, rowBufSize, row, columnBufSize, column, span);
+    glad_trace_record(1040, glad_start);
+}
+static PFNGLGETNHISTOGRAMPROC glad_trace_real_glGetnHistogram;
+static void APIENTRY glad_trace_glGetnHistogram(GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetnHistogram(target, reset, format, type, bufSize, values);
+    glad_trace_record(1041, glad_start);
+}
+static PFNGLGETNMINMAXPROC glad_trace_real_glGetnMinmax;
+static void APIENTRY glad_trace_glGetnMinmax(GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glGetnMinmax(target, reset, format, type, bufSize, values);
+    glad_trace_record(1042, glad_start);
+}
+static PFNGLTEXTUREBARRIERPROC glad_trace_real_glTextureBarrier;
+static void APIENTRY glad_trace_glTextureBarrier(void) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glTextureBarrier();
+    glad_trace_record(1043, glad_start);
+}
+static PFNGLSPECIALIZESHADERPROC glad_trace_real_glSpecializeShader;
+static void APIENTRY glad_trace_glSpecializeShader(GLuint shader, const GLchar *pEntryPoint, GLuint numSpecializationConstants, const GLuint *pConstantIndex, const GLuint *pConstantValue) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glSpecializeShader(shader, pEntryPoint, numSpecializationConstants, pConstantIndex, pConstantValue);
+    glad_trace_record(1044, glad_start);
+}
+static PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC glad_trace_real_glMultiDrawArraysIndirectCount;
+static void APIENTRY glad_trace_glMultiDrawArraysIndirectCount(GLenum mode, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiDrawArraysIndirectCount(mode, indirect, drawcount, maxdrawcount, stride);
+    glad_trace_record(1045, glad_start);
+}
+static PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC glad_trace_real_glMultiDrawElementsIndirectCount;
+static void APIENTRY glad_trace_glMultiDrawElementsIndirectCount(GLenum mode, GLenum type, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glMultiDrawElementsIndirectCount(mode, type, indirect, drawcount, maxdrawcount, stride);
+    glad_trace_record(1046, glad_start);
+}
+static PFNGLPOLYGONOFFSETCLAMPPROC glad_trace_real_glPolygonOffsetClamp;
+static void APIENTRY glad_trace_glPolygonOffsetClamp(GLfloat factor, GLfloat units, GLfloat clamp) {
+    unsigned long long glad_start = GLAD_TRACE_CLOCK();
+    glad_trace_real_glPolygonOffsetClamp(factor, units, clamp);
+    glad_trace_record(1047, glad_start);
+}
+
+#define GLAD_TRACE_HOOK(name) \
+    if (glad_##name != NULL && glad_##name != glad_trace_##name) { \
+        glad_trace_real_##name = glad_##name; \
+        glad_##name = glad_trace_##name; \
+    }
+
+void glad_trace_install(void) {
+    GLAD_TRACE_HOOK(glCullFace);
+    GLAD_TRACE_HOOK(glFrontFace);
+    GLAD_TRACE_HOOK(glHint);
+    GLAD_TRACE_HOOK(glLineWidth);
+    GLAD_TRACE_HOOK(glPointSize);
+    GLAD_TRACE_HOOK(glPolygonMode);
+    GLAD_TRACE_HOOK(glScissor);
+    GLAD_TRACE_HOOK(glTexParameterf);
+    GLAD_TRACE_HOOK(glTexParameterfv);
+    GLAD_TRACE_HOOK(glTexParameteri);
+    GLAD_TRACE_HOOK(glTexParameteriv);
+    GLAD_TRACE_HOOK(glTexImage1D);
+    GLAD_TRACE_HOOK(glTexImage2D);
+    GLAD_TRACE_HOOK(glDrawBuffer);
+    GLAD_TRACE_HOOK(glClear);
+    GLAD_TRACE_HOOK(glClearColor);
+    GLAD_TRACE_HOOK(glClearStencil);
+    GLAD_TRACE_HOOK(glClearDepth);
+    GLAD_TRACE_HOOK(glStencilMask);
+    GLAD_TRACE_HOOK(glColorMask);
+    GLAD_TRACE_HOOK(glDepthMask);
+    GLAD_TRACE_HOOK(glDisable);
+    GLAD_TRACE_HOOK(glEnable);
+    GLAD_TRACE_HOOK(glFinish);
+    GLAD_TRACE_HOOK(glFlush);
+    GLAD_TRACE_HOOK(glBlendFunc);
+    GLAD_TRACE_HOOK(glLogicOp);
+    GLAD_TRACE_HOOK(glStencilFunc);
+    GLAD_TRACE_HOOK(glStencilOp);
+    GLAD_TRACE_HOOK(glDepthFunc);
+    GLAD_TRACE_HOOK(glPixelStoref);
+    GLAD_TRACE_HOOK(glPixelStorei);
+    GLAD_TRACE_HOOK(glReadBuffer);
+    GLAD_TRACE_HOOK(glReadPixels);
+    GLAD_TRACE_HOOK(glGetBooleanv);
+    GLAD_TRACE_HOOK(glGetDoublev);
+    GLAD_TRACE_HOOK(glGetError);
+    GLAD_TRACE_HOOK(glGetFloatv);
+    GLAD_TRACE_HOOK(glGetIntegerv);
+    GLAD_TRACE_HOOK(glGetString);
+    GLAD_TRACE_HOOK(glGetTexImage);
+    GLAD_TRACE_HOOK(glGetTexParameterfv);
+    GLAD_TRACE_HOOK(glGetTexParameteriv);
+    GLAD_TRACE_HOOK(glGetTexLevelParameterfv);
+    GLAD_TRACE_HOOK(glGetTexLevelParameteriv);
+    GLAD_TRACE_HOOK(glIsEnabled);
+    GLAD_TRACE_HOOK(glDepthRange);
+    GLAD_TRACE_HOOK(glViewport);
+    GLAD_TRACE_HOOK(glNewList);
+    GLAD_TRACE_HOOK(glEndList);
+    GLAD_TRACE_HOOK(glCallList);
+    GLAD_TRACE_HOOK(glCallLists);
+    GLAD_TRACE_HOOK(glDeleteLists);
+    GLAD_TRACE_HOOK(glGenLists);
+    GLAD_TRACE_HOOK(glListBase);
+    GLAD_TRACE_HOOK(glBegin);
+    GLAD_TRACE_HOOK(glBitmap);
+    GLAD_TRACE_HOOK(glColor3b);
+    GLAD_TRACE_HOOK(glColor3bv);
+    GLAD_TRACE_HOOK(glColor3d);
+    GLAD_TRACE_HOOK(glColor3dv);
+    GLAD_TRACE_HOOK(glColor3f);
+    GLAD_TRACE_HOOK(glColor3fv);
+    GLAD_TRACE_HOOK(glColor3i);
+    GLAD_TRACE_HOOK(glColor3iv);
+    GLAD_TRACE_HOOK(glColor3s);
+    GLAD_TRACE_HOOK(glColor3sv);
+    GLAD_TRACE_HOOK(glColor3ub);
+    GLAD_TRACE_HOOK(glColor3ubv);
+    GLAD_TRACE_HOOK(glColor3ui);
+    GLAD_TRACE_HOOK(glColor3uiv);
+    GLAD_TRACE_HOOK(glColor3us);
+    GLAD_TRACE_HOOK(glColor3usv);
+    GLAD_TRACE_HOOK(glColor4b);
+    GLAD_TRACE_HOOK(glColor4bv);
+    GLAD_TRACE_HOOK(glColor4d);
+    GLAD_TRACE_HOOK(glColor4dv);
+    GLAD_TRACE_HOOK(glColor4f);
+    GLAD_TRACE_HOOK(glColor4fv);
+    GLAD_TRACE_HOOK(glColor4i);
+    GLAD_TRACE_HOOK(glColor4iv);
+    GLAD_TRACE_HOOK(glColor4s);
+    GLAD_TRACE_HOOK(glColor4sv);
+    GLAD_TRACE_HOOK(glColor4ub);
+    GLAD_TRACE_HOOK(glColor4ubv);
+    GLAD_TRACE_HOOK(glColor4ui);
+    GLAD_TRACE_HOOK(glColor4uiv);
+    GLAD_TRACE_HOOK(glColor4us);
+    GLAD_TRACE_HOOK(glColor4usv);
+    GLAD_TRACE_HOOK(glEdgeFlag);
+    GLAD_TRACE_HOOK(glEdgeFlagv);
+    GLAD_TRACE_HOOK(glEnd);
+    GLAD_TRACE_HOOK(glIndexd);
+    GLAD_TRACE_HOOK(glIndexdv);
+    GLAD_TRACE_HOOK(glIndexf);
+    GLAD_TRACE_HOOK(glIndexfv);
+    GLAD_TRACE_HOOK(glIndexi);
+    GLAD_TRACE_HOOK(glIndexiv);
+    GLAD_TRACE_HOOK(glIndexs);
+    GLAD_TRACE_HOOK(glIndexsv);
+    GLAD_TRACE_HOOK(glNormal3b);
+    GLAD_TRACE_HOOK(glNormal3bv);
+    GLAD_TRACE_HOOK(glNormal3d);
+    GLAD_TRACE_HOOK(glNormal3dv);
+    GLAD_TRACE_HOOK(glNormal3f);
+    GLAD_TRACE_HOOK(glNormal3fv);
+    GLAD_TRACE_HOOK(glNormal3i);
+    GLAD_TRACE_HOOK(glNormal3iv);
+    GLAD_TRACE_HOOK(glNormal3s);
+    GLAD_TRACE_HOOK(glNormal3sv);
+    GLAD_TRACE_HOOK(glRasterPos2d);
+    GLAD_TRACE_HOOK(glRasterPos2dv);
+    GLAD_TRACE_HOOK(glRasterPos2f);
+    GLAD_TRACE_HOOK(glRasterPos2fv);
+    GLAD_TRACE_HOOK(glRasterPos2i);
+    GLAD_TRACE_HOOK(glRasterPos2iv);
+    GLAD_TRACE_HOOK(glRasterPos2s);
+    GLAD_TRACE_HOOK(glRasterPos2sv);
+    GLAD_TRACE_HOOK(glRasterPos3d);
+    GLAD_TRACE_HOOK(glRasterPos3dv);
+    GLAD_TRACE_HOOK(glRasterPos3f);
+    GLAD_TRACE_HOOK(glRasterPos3fv);
+    GLAD_TRACE_HOOK(glRasterPos3i);
+    GLAD_TRACE_HOOK(glRasterPos3iv);
+    GLAD_TRACE_HOOK(glRasterPos3s);
+    GLAD_TRACE_HOOK(glRasterPos3sv);
+    GLAD_TRACE_HOOK(glRasterPos4d);
+    GLAD_TRACE_HOOK(glRasterPos4dv);
+    GLAD_TRACE_HOOK(glRasterPos4f);
+    GLAD_TRACE_HOOK(glRasterPos4fv);
+    GLAD_TRACE_HOOK(glRasterPos4i);
+    GLAD_TRACE_HOOK(glRasterPos4iv);
+    GLAD_TRACE_HOOK(glRasterPos4s);
+    GLAD_TRACE_HOOK(glRasterPos4sv);
+    GLAD_TRACE_HOOK(glRectd);
+    GLAD_TRACE_HOOK(glRectdv);
+    GLAD_TRACE_HOOK(glRectf);
+    GLAD_TRACE_HOOK(glRectfv);
+    GLAD_TRACE_HOOK(glRecti);
+    GLAD_TRACE_HOOK(glRectiv);
+    GLAD_TRACE_HOOK(glRects);
+    GLAD_TRACE_HOOK(glRectsv);
+    GLAD_TRACE_HOOK(glTexCoord1d);
+    GLAD_TRACE_HOOK(glTexCoord1dv);
+    GLAD_TRACE_HOOK(glTexCoord1f);
+    GLAD_TRACE_HOOK(glTexCoord1fv);
+    GLAD_TRACE_HOOK(glTexCoord1i);
+    GLAD_TRACE_HOOK(glTexCoord1iv);
+    GLAD_TRACE_HOOK(glTexCoord1s);
+    GLAD_TRACE_HOOK(glTexCoord1sv);
+    GLAD_TRACE_HOOK(glTexCoord2d);
+    GLAD_TRACE_HOOK(glTexCoord2dv);
+    GLAD_TRACE_HOOK(glTexCoord2f);
+    GLAD_TRACE_HOOK(glTexCoord2fv);
+    GLAD_TRACE_HOOK(glTexCoord2i);
+    GLAD_TRACE_HOOK(glTexCoord2iv);
+    GLAD_TRACE_HOOK(glTexCoord2s);
+    GLAD_TRACE_HOOK(glTexCoord2sv);
+    GLAD_TRACE_HOOK(glTexCoord3d);
+    GLAD_TRACE_HOOK(glTexCoord3dv);
+    GLAD_TRACE_HOOK(glTexCoord3f);
+    GLAD_TRACE_HOOK(glTexCoord3fv);
+    GLAD_TRACE_HOOK(glTexCoord3i);
+    GLAD_TRACE_HOOK(glTexCoord3iv);
+    GLAD_TRACE_HOOK(glTexCoord3s);
+    GLAD_TRACE_HOOK(glTexCoord3sv);
+    GLAD_TRACE_HOOK(glTexCoord4d);
+    GLAD_TRACE_HOOK(glTexCoord4dv);
+    GLAD_TRACE_HOOK(glTexCoord4f);
+    GLAD_TRACE_HOOK(glTexCoord4fv);
+    GLAD_TRACE_HOOK(glTexCoord4i);
+    GLAD_TRACE_HOOK(glTexCoord4iv);
+    GLAD_TRACE_HOOK(glTexCoord4s);
+    GLAD_TRACE_HOOK(glTexCoord4sv);
+    GLAD_TRACE_HOOK(glVertex2d);
+    GLAD_TRACE_HOOK(glVertex2dv);
+    GLAD_TRACE_HOOK(glVertex2f);
+    GLAD_TRACE_HOOK(glVertex2fv);
+    GLAD_TRACE_HOOK(glVertex2i);
+    GLAD_TRACE_HOOK(glVertex2iv);
+    GLAD_TRACE_HOOK(glVertex2s);
+    GLAD_TRACE_HOOK(glVertex2sv);
+    GLAD_TRACE_HOOK(glVertex3d);
+    GLAD_TRACE_HOOK(glVertex3dv);
+    GLAD_TRACE_HOOK(glVertex3f);
+    GLAD_TRACE_HOOK(glVertex3fv);
+    GLAD_TRACE_HOOK(glVertex3i);
+    GLAD_TRACE_HOOK(glVertex3iv);
+    GLAD_TRACE_HOOK(glVertex3s);
+    GLAD_TRACE_HOOK(glVertex3sv);
+    GLAD_TRACE_HOOK(glVertex4d);
+    GLAD_TRACE_HOOK(glVertex4dv);
+    GLAD_TRACE_HOOK(glVertex4f);
+    GLAD_TRACE_HOOK(glVertex4fv);
+    GLAD_TRACE_HOOK(glVertex4i);
+    GLAD_TRACE_HOOK(glVertex4iv);
+    GLAD_TRACE_HOOK(glVertex4s);
+    GLAD_TRACE_HOOK(glVertex4sv);
+    GLAD_TRACE_HOOK(glClipPlane);
+    GLAD_TRACE_HOOK(glColorMaterial);
+    GLAD_TRACE_HOOK(glFogf);
+    GLAD_TRACE_HOOK(glFogfv);
+    GLAD_TRACE_HOOK(glFogi);
+    GLAD_TRACE_HOOK(glFogiv);
+    GLAD_TRACE_HOOK(glLightf);
+    GLAD_TRACE_HOOK(glLightfv);
+    GLAD_TRACE_HOOK(glLighti);
+    GLAD_TRACE_HOOK(glLightiv);
+    GLAD_TRACE_HOOK(glLightModelf);
+    GLAD_TRACE_HOOK(glLightModelfv);
+    GLAD_TRACE_HOOK(glLightModeli);
+    GLAD_TRACE_HOOK(glLightModeliv);
+    GLAD_TRACE_HOOK(glLineStipple);
+    GLAD_TRACE_HOOK(glMaterialf);
+    GLAD_TRACE_HOOK(glMaterialfv);
+    GLAD_TRACE_HOOK(glMateriali);
+    GLAD_TRACE_HOOK(glMaterialiv);
+    GLAD_TRACE_HOOK(glPolygonStipple);
+    GLAD_TRACE_HOOK(glShadeModel);
+    GLAD_TRACE_HOOK(glTexEnvf);
+    GLAD_TRACE_HOOK(glTexEnvfv);
+    GLAD_TRACE_HOOK(glTexEnvi);
+    GLAD_TRACE_HOOK(glTexEnviv);
+    GLAD_TRACE_HOOK(glTexGend);
+    GLAD_TRACE_HOOK(glTexGendv);
+    GLAD_TRACE_HOOK(glTexGenf);
+    GLAD_TRACE_HOOK(glTexGenfv);
+    GLAD_TRACE_HOOK(glTexGeni);
+    GLAD_TRACE_HOOK(glTexGeniv);
+    GLAD_TRACE_HOOK(glFeedbackBuffer);
+    GLAD_TRACE_HOOK(glSelectBuffer);
+    GLAD_TRACE_HOOK(glRenderMode);
+    GLAD_TRACE_HOOK(glInitNames);
+    GLAD_TRACE_HOOK(glLoadName);
+    GLAD_TRACE_HOOK(glPassThrough);
+    GLAD_TRACE_HOOK(glPopName);
+    GLAD_TRACE_HOOK(glPushName);
+    GLAD_TRACE_HOOK(glClearAccum);
+    GLAD_TRACE_HOOK(glClearIndex);
+    GLAD_TRACE_HOOK(glIndexMask);
+    GLAD_TRACE_HOOK(glAccum);
+    GLAD_TRACE_HOOK(glPopAttrib);
+    GLAD_TRACE_HOOK(glPushAttrib);
+    GLAD_TRACE_HOOK(glMap1d);
+    GLAD_TRACE_HOOK(glMap1f);
+    GLAD_TRACE_HOOK(glMap2d);
+    GLAD_TRACE_HOOK(glMap2f);
+    GLAD_TRACE_HOOK(glMapGrid1d);
+    GLAD_TRACE_HOOK(glMapGrid1f);
+    GLAD_TRACE_HOOK(glMapGrid2d);
+    GLAD_TRACE_HOOK(glMapGrid2f);
+    GLAD_TRACE_HOOK(glEvalCoord1d);
+    GLAD_TRACE_HOOK(glEvalCoord1dv);
+    GLAD_TRACE_HOOK(glEvalCoord1f);
+    GLAD_TRACE_HOOK(glEvalCoord1fv);
+    GLAD_TRACE_HOOK(glEvalCoord2d);
+    GLAD_TRACE_HOOK(glEvalCoord2dv);
+    GLAD_TRACE_HOOK(glEvalCoord2f);
+    GLAD_TRACE_HOOK(glEvalCoord2fv);
+    GLAD_TRACE_HOOK(glEvalMesh1);
+    GLAD_TRACE_HOOK(glEvalPoint1);
+    GLAD_TRACE_HOOK(glEvalMesh2);
+    GLAD_TRACE_HOOK(glEvalPoint2);
+    GLAD_TRACE_HOOK(glAlphaFunc);
+    GLAD_TRACE_HOOK(glPixelZoom);
+    GLAD_TRACE_HOOK(glPixelTransferf);
+    GLAD_TRACE_HOOK(glPixelTransferi);
+    GLAD_TRACE_HOOK(glPixelMapfv);
+    GLAD_TRACE_HOOK(glPixelMapuiv);
+    GLAD_TRACE_HOOK(glPixelMapusv);
+    GLAD_TRACE_HOOK(glCopyPixels);
+    GLAD_TRACE_HOOK(glDrawPixels);
+    GLAD_TRACE_HOOK(glGetClipPlane);
+    GLAD_TRACE_HOOK(glGetLightfv);
+    GLAD_TRACE_HOOK(glGetLightiv);
+    GLAD_TRACE_HOOK(glGetMapdv);
+    GLAD_TRACE_HOOK(glGetMapfv);
+    GLAD_TRACE_HOOK(glGetMapiv);
+    GLAD_TRACE_HOOK(glGetMaterialfv);
+    GLAD_TRACE_HOOK(glGetMaterialiv);
+    GLAD_TRACE_HOOK(glGetPixelMapfv);
+    GLAD_TRACE_HOOK(glGetPixelMapuiv);
+    GLAD_TRACE_HOOK(glGetPixelMapusv);
+    GLAD_TRACE_HOOK(glGetPolygonStipple);
+    GLAD_TRACE_HOOK(glGetTexEnvfv);
+    GLAD_TRACE_HOOK(glGetTexEnviv);
+    GLAD_TRACE_HOOK(glGetTexGendv);
+    GLAD_TRACE_HOOK(glGetTexGenfv);
+    GLAD_TRACE_HOOK(glGetTexGeniv);
+    GLAD_TRACE_HOOK(glIsList);
+    GLAD_TRACE_HOOK(glFrustum);
+    GLAD_TRACE_HOOK(glLoadIdentity);
+    GLAD_TRACE_HOOK(glLoadMatrixf);
+    GLAD_TRACE_HOOK(glLoadMatrixd);
+    GLAD_TRACE_HOOK(glMatrixMode);
+    GLAD_TRACE_HOOK(glMultMatrixf);
+    GLAD_TRACE_HOOK(glMultMatrixd);
+    GLAD_TRACE_HOOK(glOrtho);
+    GLAD_TRACE_HOOK(glPopMatrix);
+    GLAD_TRACE_HOOK(glPushMatrix);
+    GLAD_TRACE_HOOK(glRotated);
+    GLAD_TRACE_HOOK(glRotatef);
+    GLAD_TRACE_HOOK(glScaled);
+    GLAD_TRACE_HOOK(glScalef);
+    GLAD_TRACE_HOOK(glTranslated);
+    GLAD_TRACE_HOOK(glTranslatef);
+    GLAD_TRACE_HOOK(glDrawArrays);
+    GLAD_TRACE_HOOK(glDrawElements);
+    GLAD_TRACE_HOOK(glGetPointerv);
+    GLAD_TRACE_HOOK(glPolygonOffset);
+    GLAD_TRACE_HOOK(glCopyTexImage1D);
+    GLAD_TRACE_HOOK(glCopyTexImage2D);
+    GLAD_TRACE_HOOK(glCopyTexSubImage1D);
+    GLAD_TRACE_HOOK(glCopyTexSubImage2D);
+    GLAD_TRACE_HOOK(glTexSubImage1D);
+    GLAD_TRACE_HOOK(glTexSubImage2D);
+    GLAD_TRACE_HOOK(glBindTexture);
+    GLAD_TRACE_HOOK(glDeleteTextures);
+    GLAD_TRACE_HOOK(glGenTextures);
+    GLAD_TRACE_HOOK(glIsTexture);
+    GLAD_TRACE_HOOK(glArrayElement);
+    GLAD_TRACE_HOOK(glColorPointer);
+    GLAD_TRACE_HOOK(glDisableClientState);
+    GLAD_TRACE_HOOK(glEdgeFlagPointer);
+    GLAD_TRACE_HOOK(glEnableClientState);
+    GLAD_TRACE_HOOK(glIndexPointer);
+    GLAD_TRACE_HOOK(glInterleavedArrays);
+    GLAD_TRACE_HOOK(glNormalPointer);
+    GLAD_TRACE_HOOK(glTexCoordPointer);
+    GLAD_TRACE_HOOK(glVertexPointer);
+    GLAD_TRACE_HOOK(glAreTexturesResident);
+    GLAD_TRACE_HOOK(glPrioritizeTextures);
+    GLAD_TRACE_HOOK(glIndexub);
+    GLAD_TRACE_HOOK(glIndexubv);
+    GLAD_TRACE_HOOK(glPopClientAttrib);
+    GLAD_TRACE_HOOK(glPushClientAttrib);
+    GLAD_TRACE_HOOK(glDrawRangeElements);
+    GLAD_TRACE_HOOK(glTexImage3D);
+    GLAD_TRACE_HOOK(glTexSubImage3D);
+    GLAD_TRACE_HOOK(glCopyTexSubImage3D);
+    GLAD_TRACE_HOOK(glActiveTexture);
+    GLAD_TRACE_HOOK(glSampleCoverage);
+    GLAD_TRACE_HOOK(glCompressedTexImage3D);
+    GLAD_TRACE_HOOK(glCompressedTexImage2D);
+    GLAD_TRACE_HOOK(glCompressedTexImage1D);
+    GLAD_TRACE_HOOK(glCompressedTexSubImage3D);
+    GLAD_TRACE_HOOK(glCompressedTexSubImage2D);
+    GLAD_TRACE_HOOK(glCompressedTexSubImage1D);
+    GLAD_TRACE_HOOK(glGetCompressedTexImage);
+    GLAD_TRACE_HOOK(glClientActiveTexture);
+    GLAD_TRACE_HOOK(glMultiTexCoord1d);
+    GLAD_TRACE_HOOK(glMultiTexCoord1dv);
+    GLAD_TRACE_HOOK(glMultiTexCoord1f);
+    GLAD_TRACE_HOOK(glMultiTexCoord1fv);
+    GLAD_TRACE_HOOK(glMultiTexCoord1i);
+    GLAD_TRACE_HOOK(glMultiTexCoord1iv);
+    GLAD_TRACE_HOOK(glMultiTexCoord1s);
+    GLAD_TRACE_HOOK(glMultiTexCoord1sv);
+    GLAD_TRACE_HOOK(glMultiTexCoord2d);
+    GLAD_TRACE_HOOK(glMultiTexCoord2dv);
+    GLAD_TRACE_HOOK(glMultiTexCoord2f);
+    GLAD_TRACE_HOOK(glMultiTexCoord2fv);
+    GLAD_TRACE_HOOK(glMultiTexCoord2i);
+    GLAD_TRACE_HOOK(glMultiTexCoord2iv);
+    GLAD_TRACE_HOOK(glMultiTexCoord2s);
+    GLAD_TRACE_HOOK(glMultiTexCoord2sv);
+    GLAD_TRACE_HOOK(glMultiTexCoord3d);
+    GLAD_TRACE_HOOK(glMultiTexCoord3dv);
+    GLAD_TRACE_HOOK(glMultiTexCoord3f);
+    GLAD_TRACE_HOOK(glMultiTexCoord3fv);
+    GLAD_TRACE_HOOK(glMultiTexCoord3i);
+    GLAD_TRACE_HOOK(glMultiTexCoord3iv);
+    GLAD_TRACE_HOOK(glMultiTexCoord3s);
+    GLAD_TRACE_HOOK(glMultiTexCoord3sv);
+    GLAD_TRACE_HOOK(glMultiTexCoord4d);
+    GLAD_TRACE_HOOK(glMultiTexCoord4dv);
+    GLAD_TRACE_HOOK(glMultiTexCoord4f);
+    GLAD_TRACE_HOOK(glMultiTexCoord4fv);
+    GLAD_TRACE_HOOK(glMultiTexCoord4i);
+    GLAD_TRACE_HOOK(glMultiTexCoord4iv);
+    GLAD_TRACE_HOOK(glMultiTexCoord4s);
+    GLAD_TRACE_HOOK(glMultiTexCoord4sv);
+    GLAD_TRACE_HOOK(glLoadTransposeMatrixf);
+    GLAD_TRACE_HOOK(glLoadTransposeMatrixd);
+    GLAD_TRACE_HOOK(glMultTransposeMatrixf);
+    GLAD_TRACE_HOOK(glMultTransposeMatrixd);
+    GLAD_TRACE_HOOK(glBlendFuncSeparate);
+    GLAD_TRACE_HOOK(glMultiDrawArrays);
+    GLAD_TRACE_HOOK(glMultiDrawElements);
+    GLAD_TRACE_HOOK(glPointParameterf);
+    GLAD_TRACE_HOOK(glPointParameterfv);
+    GLAD_TRACE_HOOK(glPointParameteri);
+    GLAD_TRACE_HOOK(glPointParameteriv);
+    GLAD_TRACE_HOOK(glFogCoordf);
+    GLAD_TRACE_HOOK(glFogCoordfv);
+    GLAD_TRACE_HOOK(glFogCoordd);
+    GLAD_TRACE_HOOK(glFogCoorddv);
+    GLAD_TRACE_HOOK(glFogCoordPointer);
+    GLAD_TRACE_HOOK(glSecondaryColor3b);
+    GLAD_TRACE_HOOK(glSecondaryColor3bv);
+    GLAD_TRACE_HOOK(glSecondaryColor3d);
+    GLAD_TRACE_HOOK(glSecondaryColor3dv);
+    GLAD_TRACE_HOOK(glSecondaryColor3f);
+    GLAD_TRACE_HOOK(glSecondaryColor3fv);
+    GLAD_TRACE_HOOK(glSecondaryColor3i);
+    GLAD_TRACE_HOOK(glSecondaryColor3iv);
+    GLAD_TRACE_HOOK(glSecondaryColor3s);
+    GLAD_TRACE_HOOK(glSecondaryColor3sv);
+    GLAD_TRACE_HOOK(glSecondaryColor3ub);
+    GLAD_TRACE_HOOK(glSecondaryColor3ubv);
+    GLAD_TRACE_HOOK(glSecondaryColor3ui);
+    GLAD_TRACE_HOOK(glSecondaryColor3uiv);
+    GLAD_TRACE_HOOK(glSecondaryColor3us);
+    GLAD_TRACE_HOOK(glSecondaryColor3usv);
+    GLAD_TRACE_HOOK(glSecondaryColorPointer);
+    GLAD_TRACE_HOOK(glWindowPos2d);
+    GLAD_TRACE_HOOK(glWindowPos2dv);
+    GLAD_TRACE_HOOK(glWindowPos2f);
+    GLAD_TRACE_HOOK(glWindowPos2fv);
+    GLAD_TRACE_HOOK(glWindowPos2i);
+    GLAD_TRACE_HOOK(glWindowPos2iv);
+    GLAD_TRACE_HOOK(glWindowPos2s);
+    GLAD_TRACE_HOOK(glWindowPos2sv);
+    GLAD_TRACE_HOOK(glWindowPos3d);
+    GLAD_TRACE_HOOK(glWindowPos3dv);
+    GLAD_TRACE_HOOK(glWindowPos3f);
+    GLAD_TRACE_HOOK(glWindowPos3fv);
+    GLAD_TRACE_HOOK(glWindowPos3i);
+    GLAD_TRACE_HOOK(glWindowPos3iv);
+    GLAD_TRACE_HOOK(glWindowPos3s);
+    GLAD_TRACE_HOOK(glWindowPos3sv);
+    GLAD_TRACE_HOOK(glBlendColor);
+    GLAD_TRACE_HOOK(glBlendEquation);
+    GLAD_TRACE_HOOK(glGenQueries);
+    GLAD_TRACE_HOOK(glDeleteQueries);
+    GLAD_TRACE_HOOK(glIsQuery);
+    GLAD_TRACE_HOOK(glBeginQuery);
+    GLAD_TRACE_HOOK(glEndQuery);
+    GLAD_TRACE_HOOK(glGetQueryiv);
+    GLAD_TRACE_HOOK(glGetQueryObjectiv);
+    GLAD_TRACE_HOOK(glGetQueryObjectuiv);
+    GLAD_TRACE_HOOK(glBindBuffer);
+    GLAD_TRACE_HOOK(glDeleteBuffers);
+    GLAD_TRACE_HOOK(glGenBuffers);
+    GLAD_TRACE_HOOK(glIsBuffer);
+    GLAD_TRACE_HOOK(glBufferData);
+    GLAD_TRACE_HOOK(glBufferSubData);
+    GLAD_TRACE_HOOK(glGetBufferSubData);
+    GLAD_TRACE_HOOK(glMapBuffer);
+    GLAD_TRACE_HOOK(glUnmapBuffer);
+    GLAD_TRACE_HOOK(glGetBufferParameteriv);
+    GLAD_TRACE_HOOK(glGetBufferPointerv);
+    GLAD_TRACE_HOOK(glBlendEquationSeparate);
+    GLAD_TRACE_HOOK(glDrawBuffers);
+    GLAD_TRACE_HOOK(glStencilOpSeparate);
+    GLAD_TRACE_HOOK(glStencilFuncSeparate);
+    GLAD_TRACE_HOOK(glStencilMaskSeparate);
+    GLAD_TRACE_HOOK(glAttachShader);
+    GLAD_TRACE_HOOK(glBindAttribLocation);
+    GLAD_TRACE_HOOK(glCompileShader);
+    GLAD_TRACE_HOOK(glCreateProgram);
+    GLAD_TRACE_HOOK(glCreateShader);
+    GLAD_TRACE_HOOK(glDeleteProgram);
+    GLAD_TRACE_HOOK(glDeleteShader);
+    GLAD_TRACE_HOOK(glDetachShader);
+    GLAD_TRACE_HOOK(glDisableVertexAttribArray);
+    GLAD_TRACE_HOOK(glEnableVertexAttribArray);
+    GLAD_TRACE_HOOK(glGetActiveAttrib);
+    GLAD_TRACE_HOOK(glGetActiveUniform);
+    GLAD_TRACE_HOOK(glGetAttachedShaders);
+    GLAD_TRACE_HOOK(glGetAttribLocation);
+    GLAD_TRACE_HOOK(glGetProgramiv);
+    GLAD_TRACE_HOOK(glGetProgramInfoLog);
+    GLAD_TRACE_HOOK(glGetShaderiv);
+    GLAD_TRACE_HOOK(glGetShaderInfoLog);
+    GLAD_TRACE_HOOK(glGetShaderSource);
+    GLAD_TRACE_HOOK(glGetUniformLocation);
+    GLAD_TRACE_HOOK(glGetUniformfv);
+    GLAD_TRACE_HOOK(glGetUniformiv);
+    GLAD_TRACE_HOOK(glGetVertexAttribdv);
+    GLAD_TRACE_HOOK(glGetVertexAttribfv);
+    GLAD_TRACE_HOOK(glGetVertexAttribiv);
+    GLAD_TRACE_HOOK(glGetVertexAttribPointerv);
+    GLAD_TRACE_HOOK(glIsProgram);
+    GLAD_TRACE_HOOK(glIsShader);
+    GLAD_TRACE_HOOK(glLinkProgram);
+    GLAD_TRACE_HOOK(glShaderSource);
+    GLAD_TRACE_HOOK(glUseProgram);
+    GLAD_TRACE_HOOK(glUniform1f);
+    GLAD_TRACE_HOOK(glUniform2f);
+    GLAD_TRACE_HOOK(glUniform3f);
+    GLAD_TRACE_HOOK(glUniform4f);
+    GLAD_TRACE_HOOK(glUniform1i);
+    GLAD_TRACE_HOOK(glUniform2i);
+    GLAD_TRACE_HOOK(glUniform3i);
+    GLAD_TRACE_HOOK(glUniform4i);
+    GLAD_TRACE_HOOK(glUniform1fv);
+    GLAD_TRACE_HOOK(glUniform2fv);
+    GLAD_TRACE_HOOK(glUniform3fv);
+    GLAD_TRACE_HOOK(glUniform4fv);
+    GLAD_TRACE_HOOK(glUniform1iv);
+    GLAD_TRACE_HOOK(glUniform2iv);
+    GLAD_TRACE_HOOK(glUniform3iv);
+    GLAD_TRACE_HOOK(glUniform4iv);
+    GLAD_TRACE_HOOK(glUniformMatrix2fv);
+    GLAD_TRACE_HOOK(glUniformMatrix3fv);
+    GLAD_TRACE_HOOK(glUniformMatrix4fv);
+    GLAD_TRACE_HOOK(glValidateProgram);
+    GLAD_TRACE_HOOK(glVertexAttrib1d);
+    GLAD_TRACE_HOOK(glVertexAttrib1dv);
+    GLAD_TRACE_HOOK(glVertexAttrib1f);
+    GLAD_TRACE_HOOK(glVertexAttrib1fv);
+    GLAD_TRACE_HOOK(glVertexAttrib1s);
+    GLAD_TRACE_HOOK(glVertexAttrib1sv);
+    GLAD_TRACE_HOOK(glVertexAttrib2d);
+    GLAD_TRACE_HOOK(glVertexAttrib2dv);
+    GLAD_TRACE_HOOK(glVertexAttrib2f);
+    GLAD_TRACE_HOOK(glVertexAttrib2fv);
+    GLAD_TRACE_HOOK(glVertexAttrib2s);
+    GLAD_TRACE_HOOK(glVertexAttrib2sv);
+    GLAD_TRACE_HOOK(glVertexAttrib3d);
+    GLAD_TRACE_HOOK(glVertexAttrib3dv);
+    GLAD_TRACE_HOOK(glVertexAttrib3f);
+    GLAD_TRACE_HOOK(glVertexAttrib3fv);
+    GLAD_TRACE_HOOK(glVertexAttrib3s);
+    GLAD_TRACE_HOOK(glVertexAttrib3sv);
+    GLAD_TRACE_HOOK(glVertexAttrib4Nbv);
+    GLAD_TRACE_HOOK(glVertexAttrib4Niv);
+    GLAD_TRACE_HOOK(glVertexAttrib4Nsv);
+    GLAD_TRACE_HOOK(glVertexAttrib4Nub);
+    GLAD_TRACE_HOOK(glVertexAttrib4Nubv);
+    GLAD_TRACE_HOOK(glVertexAttrib4Nuiv);
+    GLAD_TRACE_HOOK(glVertexAttrib4Nusv);
+    GLAD_TRACE_HOOK(glVertexAttrib4bv);
+    GLAD_TRACE_HOOK(glVertexAttrib4d);
+    GLAD_TRACE_HOOK(glVertexAttrib4dv);
+    GLAD_TRACE_HOOK(glVertexAttrib4f);
+    GLAD_TRACE_HOOK(glVertexAttrib4fv);
+    GLAD_TRACE_HOOK(glVertexAttrib4iv);
+    GLAD_TRACE_HOOK(glVertexAttrib4s);
+    GLAD_TRACE_HOOK(glVertexAttrib4sv);
+    GLAD_TRACE_HOOK(glVertexAttrib4ubv);
+    GLAD_TRACE_HOOK(glVertexAttrib4uiv);
+    GLAD_TRACE_HOOK(glVertexAttrib4usv);
+    GLAD_TRACE_HOOK(glVertexAttribPointer);
+    GLAD_TRACE_HOOK(glUniformMatrix2x3fv);
+    GLAD_TRACE_HOOK(glUniformMatrix3x2fv);
+    GLAD_TRACE_HOOK(glUniformMatrix2x4fv);
+    GLAD_TRACE_HOOK(glUniformMatrix4x2fv);
+    GLAD_TRACE_HOOK(glUniformMatrix3x4fv);
+    GLAD_TRACE_HOOK(glUniformMatrix4x3fv);
+    GLAD_TRACE_HOOK(glColorMaski);
+    GLAD_TRACE_HOOK(glGetBooleani_v);
+    GLAD_TRACE_HOOK(glGetIntegeri_v);
+    GLAD_TRACE_HOOK(glEnablei);
+    GLAD_TRACE_HOOK(glDisablei);
+    GLAD_TRACE_HOOK(glIsEnabledi);
+    GLAD_TRACE_HOOK(glBeginTransformFeedback);
+    GLAD_TRACE_HOOK(glEndTransformFeedback);
+    GLAD_TRACE_HOOK(glBindBufferRange);
+    GLAD_TRACE_HOOK(glBindBufferBase);
+    GLAD_TRACE_HOOK(glTransformFeedbackVaryings);
+    GLAD_TRACE_HOOK(glGetTransformFeedbackVarying);
+    GLAD_TRACE_HOOK(glClampColor);
+    GLAD_TRACE_HOOK(glBeginConditionalRender);
+    GLAD_TRACE_HOOK(glEndConditionalRender);
+    GLAD_TRACE_HOOK(glVertexAttribIPointer);
+    GLAD_TRACE_HOOK(glGetVertexAttribIiv);
+    GLAD_TRACE_HOOK(glGetVertexAttribIuiv);
+    GLAD_TRACE_HOOK(glVertexAttribI1i);
+    GLAD_TRACE_HOOK(glVertexAttribI2i);
+    GLAD_TRACE_HOOK(glVertexAttribI3i);
+    GLAD_TRACE_HOOK(glVertexAttribI4i);
+    GLAD_TRACE_HOOK(glVertexAttribI1ui);
+    GLAD_TRACE_HOOK(glVertexAttribI2ui);
+    GLAD_TRACE_HOOK(glVertexAttribI3ui);
+    GLAD_TRACE_HOOK(glVertexAttribI4ui);
+    GLAD_TRACE_HOOK(glVertexAttribI1iv);
+    GLAD_TRACE_HOOK(glVertexAttribI2iv);
+    GLAD_TRACE_HOOK(glVertexAttribI3iv);
+    GLAD_TRACE_HOOK(glVertexAttribI4iv);
+    GLAD_TRACE_HOOK(glVertexAttribI1uiv);
+    GLAD_TRACE_HOOK(glVertexAttribI2uiv);
+    GLAD_TRACE_HOOK(glVertexAttribI3uiv);
+    GLAD_TRACE_HOOK(glVertexAttribI4uiv);
+    GLAD_TRACE_HOOK(glVertexAttribI4bv);
+    GLAD_TRACE_HOOK(glVertexAttribI4sv);
+    GLAD_TRACE_HOOK(glVertexAttribI4ubv);
+    GLAD_TRACE_HOOK(glVertexAttribI4usv);
+    GLAD_TRACE_HOOK(glGetUniformuiv);
+    GLAD_TRACE_HOOK(glBindFragDataLocation);
+    GLAD_TRACE_HOOK(glGetFragDataLocation);
+    GLAD_TRACE_HOOK(glUniform1ui);
+    GLAD_TRACE_HOOK(glUniform2ui);
+    GLAD_TRACE_HOOK(glUniform3ui);
+    GLAD_TRACE_HOOK(glUniform4ui);
+    GLAD_TRACE_HOOK(glUniform1uiv);
+    GLAD_TRACE_HOOK(glUniform2uiv);
+    GLAD_TRACE_HOOK(glUniform3uiv);
+    GLAD_TRACE_HOOK(glUniform4uiv);
+    GLAD_TRACE_HOOK(glTexParameterIiv);
+    GLAD_TRACE_HOOK(glTexParameterIuiv);
+    GLAD_TRACE_HOOK(glGetTexParameterIiv);
+    GLAD_TRACE_HOOK(glGetTexParameterIuiv);
+    GLAD_TRACE_HOOK(glClearBufferiv);
+    GLAD_TRACE_HOOK(glClearBufferuiv);
+    GLAD_TRACE_HOOK(glClearBufferfv);
+    GLAD_TRACE_HOOK(glClearBufferfi);
+    GLAD_TRACE_HOOK(glGetStringi);
+    GLAD_TRACE_HOOK(glIsRenderbuffer);
+    GLAD_TRACE_HOOK(glBindRenderbuffer);
+    GLAD_TRACE_HOOK(glDeleteRenderbuffers);
+    GLAD_TRACE_HOOK(glGenRenderbuffers);
+    GLAD_TRACE_HOOK(glRenderbufferStorage);
+    GLAD_TRACE_HOOK(glGetRenderbufferParameteriv);
+    GLAD_TRACE_HOOK(glIsFramebuffer);
+    GLAD_TRACE_HOOK(glBindFramebuffer);
+    GLAD_TRACE_HOOK(glDeleteFramebuffers);
+    GLAD_TRACE_HOOK(glGenFramebuffers);
+    GLAD_TRACE_HOOK(glCheckFramebufferStatus);
+    GLAD_TRACE_HOOK(glFramebufferTexture1D);
+    GLAD_TRACE_HOOK(glFramebufferTexture2D);
+    GLAD_TRACE_HOOK(glFramebufferTexture3D);
+    GLAD_TRACE_HOOK(glFramebufferRenderbuffer);
+    GLAD_TRACE_HOOK(glGetFramebufferAttachmentParameteriv);
+    GLAD_TRACE_HOOK(glGenerateMipmap);
+    GLAD_TRACE_HOOK(glBlitFramebuffer);
+    GLAD_TRACE_HOOK(glRenderbufferStorageMultisample);
+    GLAD_TRACE_HOOK(glFramebufferTextureLayer);
+    GLAD_TRACE_HOOK(glMapBufferRange);
+    GLAD_TRACE_HOOK(glFlushMappedBufferRange);
+    GLAD_TRACE_HOOK(glBindVertexArray);
+    GLAD_TRACE_HOOK(glDeleteVertexArrays);
+    GLAD_TRACE_HOOK(glGenVertexArrays);
+    GLAD_TRACE_HOOK(glIsVertexArray);
+    GLAD_TRACE_HOOK(glDrawArraysInstanced);
+    GLAD_TRACE_HOOK(glDrawElementsInstanced);
+    GLAD_TRACE_HOOK(glTexBuffer);
+    GLAD_TRACE_HOOK(glPrimitiveRestartIndex);
+    GLAD_TRACE_HOOK(glCopyBufferSubData);
+    GLAD_TRACE_HOOK(glGetUniformIndices);
+    GLAD_TRACE_HOOK(glGetActiveUniformsiv);
+    GLAD_TRACE_HOOK(glGetActiveUniformName);
+    GLAD_TRACE_HOOK(glGetUniformBlockIndex);
+    GLAD_TRACE_HOOK(glGetActiveUniformBlockiv);
+    GLAD_TRACE_HOOK(glGetActiveUniformBlockName);
+    GLAD_TRACE_HOOK(glUniformBlockBinding);
+    GLAD_TRACE_HOOK(glDrawElementsBaseVertex);
+    GLAD_TRACE_HOOK(glDrawRangeElementsBaseVertex);
+    GLAD_TRACE_HOOK(glDrawElementsInstancedBaseVertex);
+    GLAD_TRACE_HOOK(glMultiDrawElementsBaseVertex);
+    GLAD_TRACE_HOOK(glProvokingVertex);
+    GLAD_TRACE_HOOK(glFenceSync);
+    GLAD_TRACE_HOOK(glIsSync);
+    GLAD_TRACE_HOOK(glDeleteSync);
+    GLAD_TRACE_HOOK(glClientWaitSync);
+    GLAD_TRACE_HOOK(glWaitSync);
+    GLAD_TRACE_HOOK(glGetInteger64v);
+    GLAD_TRACE_HOOK(glGetSynciv);
+    GLAD_TRACE_HOOK(glGetInteger64i_v);
+    GLAD_TRACE_HOOK(glGetBufferParameteri64v);
+    GLAD_TRACE_HOOK(glFramebufferTexture);
+    GLAD_TRACE_HOOK(glTexImage2DMultisample);
+    GLAD_TRACE_HOOK(glTexImage3DMultisample);
+    GLAD_TRACE_HOOK(glGetMultisamplefv);
+    GLAD_TRACE_HOOK(glSampleMaski);
+    GLAD_TRACE_HOOK(glBindFragDataLocationIndexed);
+    GLAD_TRACE_HOOK(glGetFragDataIndex);
+    GLAD_TRACE_HOOK(glGenSamplers);
+    GLAD_TRACE_HOOK(glDeleteSamplers);
+    GLAD_TRACE_HOOK(glIsSampler);
+    GLAD_TRACE_HOOK(glBindSampler);
+    GLAD_TRACE_HOOK(glSamplerParameteri);
+    GLAD_TRACE_HOOK(glSamplerParameteriv);
+    GLAD_TRACE_HOOK(glSamplerParameterf);
+    GLAD_TRACE_HOOK(glSamplerParameterfv);
+    GLAD_TRACE_HOOK(glSamplerParameterIiv);
+    GLAD_TRACE_HOOK(glSamplerParameterIuiv);
+    GLAD_TRACE_HOOK(glGetSamplerParameteriv);
+    GLAD_TRACE_HOOK(glGetSamplerParameterIiv);
+    GLAD_TRACE_HOOK(glGetSamplerParameterfv);
+    GLAD_TRACE_HOOK(glGetSamplerParameterIuiv);
+    GLAD_TRACE_HOOK(glQueryCounter);
+    GLAD_TRACE_HOOK(glGetQueryObjecti64v);
+    GLAD_TRACE_HOOK(glGetQueryObjectui64v);
+    GLAD_TRACE_HOOK(glVertexAttribDivisor);
+    GLAD_TRACE_HOOK(glVertexAttribP1ui);
+    GLAD_TRACE_HOOK(glVertexAttribP1uiv);
+    GLAD_TRACE_HOOK(glVertexAttribP2ui);
+    GLAD_TRACE_HOOK(glVertexAttribP2uiv);
+    GLAD_TRACE_HOOK(glVertexAttribP3ui);
+    GLAD_TRACE_HOOK(glVertexAttribP3uiv);
+    GLAD_TRACE_HOOK(glVertexAttribP4ui);
+    GLAD_TRACE_HOOK(glVertexAttribP4uiv);
+    GLAD_TRACE_HOOK(glVertexP2ui);
+    GLAD_TRACE_HOOK(glVertexP2uiv);
+    GLAD_TRACE_HOOK(glVertexP3ui);
+    GLAD_TRACE_HOOK(glVertexP3uiv);
+    GLAD_TRACE_HOOK(glVertexP4ui);
+    GLAD_TRACE_HOOK(glVertexP4uiv);
+    GLAD_TRACE_HOOK(glTexCoordP1ui);
+    GLAD_TRACE_HOOK(glTexCoordP1uiv);
+    GLAD_TRACE_HOOK(glTexCoordP2ui);
+    GLAD_TRACE_HOOK(glTexCoordP2uiv);
+    GLAD_TRACE_HOOK(glTexCoordP3ui);
+    GLAD_TRACE_HOOK(glTexCoordP3uiv);
+    GLAD_TRACE_HOOK(glTexCoordP4ui);
+    GLAD_TRACE_HOOK(glTexCoordP4uiv);
+    GLAD_TRACE_HOOK(glMultiTexCoordP1ui);
+    GLAD_TRACE_HOOK(glMultiTexCoordP1uiv);
+    GLAD_TRACE_HOOK(glMultiTexCoordP2ui);
+    GLAD_TRACE_HOOK(glMultiTexCoordP2uiv);
+    GLAD_TRACE_HOOK(glMultiTexCoordP3ui);
+    GLAD_TRACE_HOOK(glMultiTexCoordP3uiv);
+    GLAD_TRACE_HOOK(glMultiTexCoordP4ui);
+    GLAD_TRACE_HOOK(glMultiTexCoordP4uiv);
+    GLAD_TRACE_HOOK(glNormalP3ui);
+    GLAD_TRACE_HOOK(glNormalP3uiv);
+    GLAD_TRACE_HOOK(glColorP3ui);
+    GLAD_TRACE_HOOK(glColorP3uiv);
+    GLAD_TRACE_HOOK(glColorP4ui);
+    GLAD_TRACE_HOOK(glColorP4uiv);
+    GLAD_TRACE_HOOK(glSecondaryColorP3ui);
+    GLAD_TRACE_HOOK(glSecondaryColorP3uiv);
+    GLAD_TRACE_HOOK(glMinSampleShading);
+    GLAD_TRACE_HOOK(glBlendEquationi);
+    GLAD_TRACE_HOOK(glBlendEquationSeparatei);
+    GLAD_TRACE_HOOK(glBlendFunci);
+    GLAD_TRACE_HOOK(glBlendFuncSeparatei);
+    GLAD_TRACE_HOOK(glDrawArraysIndirect);
+    GLAD_TRACE_HOOK(glDrawElementsIndirect);
+    GLAD_TRACE_HOOK(glUniform1d);
+    GLAD_TRACE_HOOK(glUniform2d);
+    GLAD_TRACE_HOOK(glUniform3d);
+    GLAD_TRACE_HOOK(glUniform4d);
+    GLAD_TRACE_HOOK(glUniform1dv);
+    GLAD_TRACE_HOOK(glUniform2dv);
+    GLAD_TRACE_HOOK(glUniform3dv);
+    GLAD_TRACE_HOOK(glUniform4dv);
+    GLAD_TRACE_HOOK(glUniformMatrix2dv);
+    GLAD_TRACE_HOOK(glUniformMatrix3dv);
+    GLAD_TRACE_HOOK(glUniformMatrix4dv);
+    GLAD_TRACE_HOOK(glUniformMatrix2x3dv);
+    GLAD_TRACE_HOOK(glUniformMatrix2x4dv);
+    GLAD_TRACE_HOOK(glUniformMatrix3x2dv);
+    GLAD_TRACE_HOOK(glUniformMatrix3x4dv);
+    GLAD_TRACE_HOOK(glUniformMatrix4x2dv);
+    GLAD_TRACE_HOOK(glUniformMatrix4x3dv);
+    GLAD_TRACE_HOOK(glGetUniformdv);
+    GLAD_TRACE_HOOK(glGetSubroutineUniformLocation);
+    GLAD_TRACE_HOOK(glGetSubroutineIndex);
+    GLAD_TRACE_HOOK(glGetActiveSubroutineUniformiv);
+    GLAD_TRACE_HOOK(glGetActiveSubroutineUniformName);
+    GLAD_TRACE_HOOK(glGetActiveSubroutineName);
+    GLAD_TRACE_HOOK(glUniformSubroutinesuiv);
+    GLAD_TRACE_HOOK(glGetUniformSubroutineuiv);
+    GLAD_TRACE_HOOK(glGetProgramStageiv);
+    GLAD_TRACE_HOOK(glPatchParameteri);
+    GLAD_TRACE_HOOK(glPatchParameterfv);
+    GLAD_TRACE_HOOK(glBindTransformFeedback);
+    GLAD_TRACE_HOOK(glDeleteTransformFeedbacks);
+    GLAD_TRACE_HOOK(glGenTransformFeedbacks);
+    GLAD_TRACE_HOOK(glIsTransformFeedback);
+    GLAD_TRACE_HOOK(glPauseTransformFeedback);
+    GLAD_TRACE_HOOK(glResumeTransformFeedback);
+    GLAD_TRACE_HOOK(glDrawTransformFeedback);
+    GLAD_TRACE_HOOK(glDrawTransformFeedbackStream);
+    GLAD_TRACE_HOOK(glBeginQueryIndexed);
+    GLAD_TRACE_HOOK(glEndQueryIndexed);
+    GLAD_TRACE_HOOK(glGetQueryIndexediv);
+    GLAD_TRACE_HOOK(glReleaseShaderCompiler);
+    GLAD_TRACE_HOOK(glShaderBinary);
+    GLAD_TRACE_HOOK(glGetShaderPrecisionFormat);
+    GLAD_TRACE_HOOK(glDepthRangef);
+    GLAD_TRACE_HOOK(glClearDepthf);
+    GLAD_TRACE_HOOK(glGetProgramBinary);
+    GLAD_TRACE_HOOK(glProgramBinary);
+    GLAD_TRACE_HOOK(glProgramParameteri);
+    GLAD_TRACE_HOOK(glUseProgramStages);
+    GLAD_TRACE_HOOK(glActiveShaderProgram);
+    GLAD_TRACE_HOOK(glCreateShaderProgramv);
+    GLAD_TRACE_HOOK(glBindProgramPipeline);
+    GLAD_TRACE_HOOK(glDeleteProgramPipelines);
+    GLAD_TRACE_HOOK(glGenProgramPipelines);
+    GLAD_TRACE_HOOK(glIsProgramPipeline);
+    GLAD_TRACE_HOOK(glGetProgramPipelineiv);
+    GLAD_TRACE_HOOK(glProgramUniform1i);
+    GLAD_TRACE_HOOK(glProgramUniform1iv);
+    GLAD_TRACE_HOOK(glProgramUniform1f);
+    GLAD_TRACE_HOOK(glProgramUniform1fv);
+    GLAD_TRACE_HOOK(glProgramUniform1d);
+    GLAD_TRACE_HOOK(glProgramUniform1dv);
+    GLAD_TRACE_HOOK(glProgramUniform1ui);
+    GLAD_TRACE_HOOK(glProgramUniform1uiv);
+    GLAD_TRACE_HOOK(glProgramUniform2i);
+    GLAD_TRACE_HOOK(glProgramUniform2iv);
+    GLAD_TRACE_HOOK(glProgramUniform2f);
+    GLAD_TRACE_HOOK(glProgramUniform2fv);
+    GLAD_TRACE_HOOK(glProgramUniform2d);
+    GLAD_TRACE_HOOK(glProgramUniform2dv);
+    GLAD_TRACE_HOOK(glProgramUniform2ui);
+    GLAD_TRACE_HOOK(glProgramUniform2uiv);
+    GLAD_TRACE_HOOK(glProgramUniform3i);
+    GLAD_TRACE_HOOK(glProgramUniform3iv);
+    GLAD_TRACE_HOOK(glProgramUniform3f);
+    GLAD_TRACE_HOOK(glProgramUniform3fv);
+    GLAD_TRACE_HOOK(glProgramUniform3d);
+    GLAD_TRACE_HOOK(glProgramUniform3dv);
+    GLAD_TRACE_HOOK(glProgramUniform3ui);
+    GLAD_TRACE_HOOK(glProgramUniform3uiv);
+    GLAD_TRACE_HOOK(glProgramUniform4i);
+    GLAD_TRACE_HOOK(glProgramUniform4iv);
+    GLAD_TRACE_HOOK(glProgramUniform4f);
+    GLAD_TRACE_HOOK(glProgramUniform4fv);
+    GLAD_TRACE_HOOK(glProgramUniform4d);
+    GLAD_TRACE_HOOK(glProgramUniform4dv);
+    GLAD_TRACE_HOOK(glProgramUniform4ui);
+    GLAD_TRACE_HOOK(glProgramUniform4uiv);
+    GLAD_TRACE_HOOK(glProgramUniformMatrix2fv);
+    GLAD_TRACE_HOOK(glProgramUniformMatrix3fv);
+    GLAD_TRACE_HOOK(glProgramUniformMatrix4fv);
+    GLAD_TRACE_HOOK(glProgramUniformMatrix2dv);
+    GLAD_TRACE_HOOK(glProgramUniformMatrix3dv);
+    GLAD_TRACE_HOOK(glProgramUniformMatrix4dv);
+    GLAD_TRACE_HOOK(glProgramUniformMatrix2x3fv);
+    GLAD_TRACE_HOOK(glProgramUniformMatrix3x2fv);
+    GLAD_TRACE_HOOK(glProgramUniformMatrix2x4fv);
+    GLAD_TRACE_HOOK(glProgramUniformMatrix4x2fv);
+    GLAD_TRACE_HOOK(glProgramUniformMatrix3x4fv);
+    GLAD_TRACE_HOOK(glProgramUniformMatrix4x3fv);
+    GLAD_TRACE_HOOK(glProgramUniformMatrix2x3dv);
+    GLAD_TRACE_HOOK(glProgramUniformMatrix3x2dv);
+    GLAD_TRACE_HOOK(glProgramUniformMatrix2x4dv);
+    GLAD_TRACE_HOOK(glProgramUniformMatrix4x2dv);
+    GLAD_TRACE_HOOK(glProgramUniformMatrix3x4dv);
+    GLAD_TRACE_HOOK(glProgramUniformMatrix4x3dv);
+    GLAD_TRACE_HOOK(glValidateProgramPipeline);
+    GLAD_TRACE_HOOK(glGetProgramPipelineInfoLog);
+    GLAD_TRACE_HOOK(glVertexAttribL1d);
+    GLAD_TRACE_HOOK(glVertexAttribL2d);
+    GLAD_TRACE_HOOK(glVertexAttribL3d);
+    GLAD_TRACE_HOOK(glVertexAttribL4d);
+    GLAD_TRACE_HOOK(glVertexAttribL1dv);
+    GLAD_TRACE_HOOK(glVertexAttribL2dv);
+    GLAD_TRACE_HOOK(glVertexAttribL3dv);
+    GLAD_TRACE_HOOK(glVertexAttribL4dv);
+    GLAD_TRACE_HOOK(glVertexAttribLPointer);
+    GLAD_TRACE_HOOK(glGetVertexAttribLdv);
+    GLAD_TRACE_HOOK(glViewportArrayv);
+    GLAD_TRACE_HOOK(glViewportIndexedf);
+    GLAD_TRACE_HOOK(glViewportIndexedfv);
+    GLAD_TRACE_HOOK(glScissorArrayv);
+    GLAD_TRACE_HOOK(glScissorIndexed);
+    GLAD_TRACE_HOOK(glScissorIndexedv);
+    GLAD_TRACE_HOOK(glDepthRangeArrayv);
+    GLAD_TRACE_HOOK(glDepthRangeIndexed);
+    GLAD_TRACE_HOOK(glGetFloati_v);
+    GLAD_TRACE_HOOK(glGetDoublei_v);
+    GLAD_TRACE_HOOK(glDrawArraysInstancedBaseInstance);
+    GLAD_TRACE_HOOK(glDrawElementsInstancedBaseInstance);
+    GLAD_TRACE_HOOK(glDrawElementsInstancedBaseVertexBaseInstance);
+    GLAD_TRACE_HOOK(glGetInternalformativ);
+    GLAD_TRACE_HOOK(glGetActiveAtomicCounterBufferiv);
+    GLAD_TRACE_HOOK(glBindImageTexture);
+    GLAD_TRACE_HOOK(glMemoryBarrier);
+    GLAD_TRACE_HOOK(glTexStorage1D);
+    GLAD_TRACE_HOOK(glTexStorage2D);
+    GLAD_TRACE_HOOK(glTexStorage3D);
+    GLAD_TRACE_HOOK(glDrawTransformFeedbackInstanced);
+    GLAD_TRACE_HOOK(glDrawTransformFeedbackStreamInstanced);
+    GLAD_TRACE_HOOK(glClearBufferData);
+    GLAD_TRACE_HOOK(glClearBufferSubData);
+    GLAD_TRACE_HOOK(glDispatchCompute);
+    GLAD_TRACE_HOOK(glDispatchComputeIndirect);
+    GLAD_TRACE_HOOK(glCopyImageSubData);
+    GLAD_TRACE_HOOK(glFramebufferParameteri);
+    GLAD_TRACE_HOOK(glGetFramebufferParameteriv);
+    GLAD_TRACE_HOOK(glGetInternalformati64v);
+    GLAD_TRACE_HOOK(glInvalidateTexSubImage);
+    GLAD_TRACE_HOOK(glInvalidateTexImage);
+    GLAD_TRACE_HOOK(glInvalidateBufferSubData);
+    GLAD_TRACE_HOOK(glInvalidateBufferData);
+    GLAD_TRACE_HOOK(glInvalidateFramebuffer);
+    GLAD_TRACE_HOOK(glInvalidateSubFramebuffer);
+    GLAD_TRACE_HOOK(glMultiDrawArraysIndirect);
+    GLAD_TRACE_HOOK(glMultiDrawElementsIndirect);
+    GLAD_TRACE_HOOK(glGetProgramInterfaceiv);
+    GLAD_TRACE_HOOK(glGetProgramResourceIndex);
+    GLAD_TRACE_HOOK(glGetProgramResourceName);
+    GLAD_TRACE_HOOK(glGetProgramResourceiv);
+    GLAD_TRACE_HOOK(glGetProgramResourceLocation);
+    GLAD_TRACE_HOOK(glGetProgramResourceLocationIndex);
+    GLAD_TRACE_HOOK(glShaderStorageBlockBinding);
+    GLAD_TRACE_HOOK(glTexBufferRange);
+    GLAD_TRACE_HOOK(glTexStorage2DMultisample);
+    GLAD_TRACE_HOOK(glTexStorage3DMultisample);
+    GLAD_TRACE_HOOK(glTextureView);
+    GLAD_TRACE_HOOK(glBindVertexBuffer);
+    GLAD_TRACE_HOOK(glVertexAttribFormat);
+    GLAD_TRACE_HOOK(glVertexAttribIFormat);
+    GLAD_TRACE_HOOK(glVertexAttribLFormat);
+    GLAD_TRACE_HOOK(glVertexAttribBinding);
+    GLAD_TRACE_HOOK(glVertexBindingDivisor);
+    GLAD_TRACE_HOOK(glDebugMessageControl);
+    GLAD_TRACE_HOOK(glDebugMessageInsert);
+    GLAD_TRACE_HOOK(glDebugMessageCallback);
+    GLAD_TRACE_HOOK(glGetDebugMessageLog);
+    GLAD_TRACE_HOOK(glPushDebugGroup);
+    GLAD_TRACE_HOOK(glPopDebugGroup);
+    GLAD_TRACE_HOOK(glObjectLabel);
+    GLAD_TRACE_HOOK(glGetObjectLabel);
+    GLAD_TRACE_HOOK(glObjectPtrLabel);
+    GLAD_TRACE_HOOK(glGetObjectPtrLabel);
+    GLAD_TRACE_HOOK(glBufferStorage);
+    GLAD_TRACE_HOOK(glClearTexImage);
+    GLAD_TRACE_HOOK(glClearTexSubImage);
+    GLAD_TRACE_HOOK(glBindBuffersBase);
+    GLAD_TRACE_HOOK(glBindBuffersRange);
+    GLAD_TRACE_HOOK(glBindTextures);
+    GLAD_TRACE_HOOK(glBindSamplers);
+    GLAD_TRACE_HOOK(glBindImageTextures);
+    GLAD_TRACE_HOOK(glBindVertexBuffers);
+    GLAD_TRACE_HOOK(glClipControl);
+    GLAD_TRACE_HOOK(glCreateTransformFeedbacks);
+    GLAD_TRACE_HOOK(glTransformFeedbackBufferBase);
+    GLAD_TRACE_HOOK(glTransformFeedbackBufferRange);
+    GLAD_TRACE_HOOK(glGetTransformFeedbackiv);
+    GLAD_TRACE_HOOK(glGetTransformFeedbacki_v);
+    GLAD_TRACE_HOOK(glGetTransformFeedbacki64_v);
+    GLAD_TRACE_HOOK(glCreateBuffers);
+    GLAD_TRACE_HOOK(glNamedBufferStorage);
+    GLAD_TRACE_HOOK(glNamedBufferData);
+    GLAD_TRACE_HOOK(glNamedBufferSubData);
+    GLAD_TRACE_HOOK(glCopyNamedBufferSubData);
+    GLAD_TRACE_HOOK(glClearNamedBufferData);
+    GLAD_TRACE_HOOK(glClearNamedBufferSubData);
+    GLAD_TRACE_HOOK(glMapNamedBuffer);
+    GLAD_TRACE_HOOK(glMapNamedBufferRange);
+    GLAD_TRACE_HOOK(glUnmapNamedBuffer);
+    GLAD_TRACE_HOOK(glFlushMappedNamedBufferRange);
+    GLAD_TRACE_HOOK(glGetNamedBufferParameteriv);
+    GLAD_TRACE_HOOK(glGetNamedBufferParameteri64v);
+    GLAD_TRACE_HOOK(glGetNamedBufferPointerv);
+    GLAD_TRACE_HOOK(glGetNamedBufferSubData);
+    GLAD_TRACE_HOOK(glCreateFramebuffers);
+    GLAD_TRACE_HOOK(glNamedFramebufferRenderbuffer);
+    GLAD_TRACE_HOOK(glNamedFramebufferParameteri);
+    GLAD_TRACE_HOOK(glNamedFramebufferTexture);
+    GLAD_TRACE_HOOK(glNamedFramebufferTextureLayer);
+    GLAD_TRACE_HOOK(glNamedFramebufferDrawBuffer);
+    GLAD_TRACE_HOOK(glNamedFramebufferDrawBuffers);
+    GLAD_TRACE_HOOK(glNamedFramebufferReadBuffer);
+    GLAD_TRACE_HOOK(glInvalidateNamedFramebufferData);
+    GLAD_TRACE_HOOK(glInvalidateNamedFramebufferSubData);
+    GLAD_TRACE_HOOK(glClearNamedFramebufferiv);
+    GLAD_TRACE_HOOK(glClearNamedFramebufferuiv);
+    GLAD_TRACE_HOOK(glClearNamedFramebufferfv);
+    GLAD_TRACE_HOOK(glClearNamedFramebufferfi);
+    GLAD_TRACE_HOOK(glBlitNamedFramebuffer);
+    GLAD_TRACE_HOOK(glCheckNamedFramebufferStatus);
+    GLAD_TRACE_HOOK(glGetNamedFramebufferParameteriv);
+    GLAD_TRACE_HOOK(glGetNamedFramebufferAttachmentParameteriv);
+    GLAD_TRACE_HOOK(glCreateRenderbuffers);
+    GLAD_TRACE_HOOK(glNamedRenderbufferStorage);
+    GLAD_TRACE_HOOK(glNamedRenderbufferStorageMultisample);
+    GLAD_TRACE_HOOK(glGetNamedRenderbufferParameteriv);
+    GLAD_TRACE_HOOK(glCreateTextures);
+    GLAD_TRACE_HOOK(glTextureBuffer);
+    GLAD_TRACE_HOOK(glTextureBufferRange);
+    GLAD_TRACE_HOOK(glTextureStorage1D);
+    GLAD_TRACE_HOOK(glTextureStorage2D);
+    GLAD_TRACE_HOOK(glTextureStorage3D);
+    GLAD_TRACE_HOOK(glTextureStorage2DMultisample);
+    GLAD_TRACE_HOOK(glTextureStorage3DMultisample);
+    GLAD_TRACE_HOOK(glTextureSubImage1D);
+    GLAD_TRACE_HOOK(glTextureSubImage2D);
+    GLAD_TRACE_HOOK(glTextureSubImage3D);
+    GLAD_TRACE_HOOK(glCompressedTextureSubImage1D);
+    GLAD_TRACE_HOOK(glCompressedTextureSubImage2D);
+    GLAD_TRACE_HOOK(glCompressedTextureSubImage3D);
+    GLAD_TRACE_HOOK(glCopyTextureSubImage1D);
+    GLAD_TRACE_HOOK(glCopyTextureSubImage2D);
+    GLAD_TRACE_HOOK(glCopyTextureSubImage3D);
+    GLAD_TRACE_HOOK(glTextureParameterf);
+    GLAD_TRACE_HOOK(glTextureParameterfv);
+    GLAD_TRACE_HOOK(glTextureParameteri);
+    GLAD_TRACE_HOOK(glTextureParameterIiv);
+    GLAD_TRACE_HOOK(glTextureParameterIuiv);
+    GLAD_TRACE_HOOK(glTextureParameteriv);
+    GLAD_TRACE_HOOK(glGenerateTextureMipmap);
+    GLAD_TRACE_HOOK(glBindTextureUnit);
+    GLAD_TRACE_HOOK(glGetTextureImage);
+    GLAD_TRACE_HOOK(glGetCompressedTextureImage);
+    GLAD_TRACE_HOOK(glGetTextureLevelParameterfv);
+    GLAD_TRACE_HOOK(glGetTextureLevelParameteriv);
+    GLAD_TRACE_HOOK(glGetTextureParameterfv);
+    GLAD_TRACE_HOOK(glGetTextureParameterIiv);
+    GLAD_TRACE_HOOK(glGetTextureParameterIuiv);
+    GLAD_TRACE_HOOK(glGetTextureParameteriv);
+    GLAD_TRACE_HOOK(glCreateVertexArrays);
+    GLAD_TRACE_HOOK(glDisableVertexArrayAttrib);
+    GLAD_TRACE_HOOK(glEnableVertexArrayAttrib);
+    GLAD_TRACE_HOOK(glVertexArrayElementBuffer);
+    GLAD_TRACE_HOOK(glVertexArrayVertexBuffer);
+    GLAD_TRACE_HOOK(glVertexArrayVertexBuffers);
+    GLAD_TRACE_HOOK(glVertexArrayAttribBinding);
+    GLAD_TRACE_HOOK(glVertexArrayAttribFormat);
+    GLAD_TRACE_HOOK(glVertexArrayAttribIFormat);
+    GLAD_TRACE_HOOK(glVertexArrayAttribLFormat);
+    GLAD_TRACE_HOOK(glVertexArrayBindingDivisor);
+    GLAD_TRACE_HOOK(glGetVertexArrayiv);
+    GLAD_TRACE_HOOK(glGetVertexArrayIndexediv);
+    GLAD_TRACE_HOOK(glGetVertexArrayIndexed64iv);
+    GLAD_TRACE_HOOK(glCreateSamplers);
+    GLAD_TRACE_HOOK(glCreateProgramPipelines);
+    GLAD_TRACE_HOOK(glCreateQueries);
+    GLAD_TRACE_HOOK(glGetQueryBufferObjecti64v);
+    GLAD_TRACE_HOOK(glGetQueryBufferObjectiv);
+    GLAD_TRACE_HOOK(glGetQueryBufferObjectui64v);
+    GLAD_TRACE_HOOK(glGetQueryBufferObjectuiv);
+    GLAD_TRACE_HOOK(glMemoryBarrierByRegion);
+    GLAD_TRACE_HOOK(glGetTextureSubImage);
+    GLAD_TRACE_HOOK(glGetCompressedTextureSubImage);
+    GLAD_TRACE_HOOK(glGetGraphicsResetStatus);
+    GLAD_TRACE_HOOK(glGetnCompressedTexImage);
+    GLAD_TRACE_HOOK(glGetnTexImage);
+    GLAD_TRACE_HOOK(glGetnUniformdv);
+    GLAD_TRACE_HOOK(glGetnUniformfv);
+    GLAD_TRACE_HOOK(glGetnUniformiv);
+    GLAD_TRACE_HOOK(glGetnUniformuiv);
+    GLAD_TRACE_HOOK(glReadnPixels);
+    GLAD_TRACE_HOOK(glGetnMapdv);
+    GLAD_TRACE_HOOK(glGetnMapfv);
+    GLAD_TRACE_HOOK(glGetnMapiv);
+    GLAD_TRACE_HOOK(glGetnPixelMapfv);
+    GLAD_TRACE_HOOK(glGetnPixelMapuiv);
+    GLAD_TRACE_HOOK(glGetnPixelMapusv);
+    GLAD_TRACE_HOOK(glGetnPolygonStipple);
+    GLAD_TRACE_HOOK(glGetnColorTable);
+    GLAD_TRACE_HOOK(glGetnConvolutionFilter);
+    GLAD_TRACE_HOOK(glGetnSeparableFilter);
+    GLAD_TRACE_HOOK(glGetnHistogram);
+    GLAD_TRACE_HOOK(glGetnMinmax);
+    GLAD_TRACE_HOOK(glTextureBarrier);
+    GLAD_TRACE_HOOK(glSpecializeShader);
+    GLAD_TRACE_HOOK(glMultiDrawArraysIndirectCount);
+    GLAD_TRACE_HOOK(glMultiDrawElementsIndirectCount);
+    GLAD_TRACE_HOOK(glPolygonOffsetClamp);
+}
+
+#endif
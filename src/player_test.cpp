@@ -1,3 +1,12 @@
+#define LOGL_COUNT_HEAP_ALLOCATIONS
+#include <learnopengl/frame_memory.h>
+#include <learnopengl/broadphase.h>
+#include <learnopengl/bvh.h>
+#include <learnopengl/gpu_resources.h>
+#include <learnopengl/input_trace.h>
+#include <learnopengl/layer_cache.h>
+#include <learnopengl/redraw_scheduler.h>
+
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
 
@@ -9,6 +18,7 @@
 
 #include "Quad.hpp"
 #include "LineGrid.hpp"
+#include "Hud.hpp"
 #include "Player.hpp"
 
 void framebuffer_size_callback(GLFWwindow* window, int width, int height);
@@ -17,14 +27,28 @@ void processInput(GLFWwindow *window, myGame::Player& player);
 myGame::Player player;
 void key_callback(GLFWwindow* window, int key, int scancode, int action, int mods);
 void mouse_button_callback(GLFWwindow* window, int button, int action, int mods);
+void window_refresh_callback(GLFWwindow* window);
+
+// the loop only draws when this says the scene changed
+RedrawScheduler redraw;
+// S spins the quads, which animates the board at the scheduler's fixed rate
+bool spinning = false;
+// --record <log> keeps the session's input, --replay <log> plays it back
+InputTrace input;
+// a right click picks what is under this cursor in the next frame
+bool pickPending = false;
+glm::vec2 pickCursor;
 
 // settings
 const unsigned int SCR_WIDTH = 512;
 const unsigned int SCR_HEIGHT = 512;
 
 
-int main()
+int main(int argc, char** argv)
 {
+    if (!input.open(argc, argv))
+        return -1;
+
     // glfw: initialize and configure
     // ------------------------------
     glfwInit();
@@ -35,6 +59,7 @@ int main()
 #ifdef __APPLE__
     glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
 #endif
+    input.windowHints();
 
     // glfw window creation
     // --------------------
@@ -67,6 +92,10 @@ int main()
     myPrimitive::LineGrid grid((float)SCR_WIDTH, (float)SCR_HEIGHT, padding, q_a);
     grid.initialize();
 
+    // the grid never changes, so it is drawn once into the layer cache
+    LayerCache layers;
+    layers.add([&]() { grid.draw(); });
+
     myPrimitive::Quad quad;
     quad.initialize();
 
@@ -75,8 +104,13 @@ int main()
     player.p_pos = glm::vec3(padding + q_a * 1 + q_a/2.0f, padding + q_a * 1 + q_a/2.0f, 0.0f);
     player.initialize();
 
+    myPrimitive::Hud hud;
+    hud.initialize();
+
     glfwSetKeyCallback(window, key_callback);
     glfwSetMouseButtonCallback(window, mouse_button_callback);
+    glfwSetWindowRefreshCallback(window, window_refresh_callback);
+    input.attach(window);
 
     float min_x_grid = padding + q_a/2.0f;
     float min_y_grid = padding + q_a/2.0f;
@@ -84,62 +118,143 @@ int main()
     float max_y_grid = (float)SCR_HEIGHT - padding - q_a/2.0f;
     float step_quads = 2.0f * q_a;
 
+    // the spinning quads' places and angles, as drawn and as picked
+    auto eachQuad = [&](float angle, auto visit) {
+        for (float y = min_y_grid; y < max_y_grid; y += step_quads) {
+            for (float x = min_x_grid; x < max_x_grid; x += step_quads) {
+                visit(glm::vec3(x      , y      , 0.0f),  angle);
+                visit(glm::vec3(x + q_a, y + q_a, 0.0f), -angle);
+            }
+        }
+    };
+
+    // a pick gathers the player and the quads into the hierarchy again, in
+    // memory kept from the start so the frame does not allocate
+    Bvh bvh;
+    size_t quadCount = 0;
+    eachQuad(0.0f, [&](glm::vec3, float) { quadCount++; });
+    bvh.reserve(2 * (1 + quadCount));
+
+    // the player's box and, while they spin, the quads': the pairs that touch
+    // each frame. Neighbouring quads touch at every angle, so a pair a quad
+    // on each side and a few for the player
+    SweepAndPrune broadphase;
+    broadphase.reserve(1 + quadCount, 8 * (1 + quadCount));
+    uint32_t playerBox = broadphase.add(glm::vec2(0.0f), glm::vec2(0.0f));
+    std::vector<uint32_t> quadBoxes;
+    quadBoxes.reserve(quadCount);
+
 
     // time management
-    GLfloat currentFrame = 0.0f, deltaTime = 0.0f, lastFrame = 0.0f;
-    GLfloat time = 0.0f;
-    GLuint  fps = 0;
-    GLuint  last_fps = 0;
+    GLfloat currentFrame = 0.0f;
+    myPrimitive::FrameTimes frameTimes;
 
     /* -----------
      *  Main loop
      * ----------- */
     while (!glfwWindowShouldClose(window))
     {
-        // - calculate time spent on last frame
-        currentFrame = glfwGetTime();
-        deltaTime = currentFrame - lastFrame;
-        lastFrame = currentFrame;
+        // - sleep until input, an animation or a timer needs a new frame
+        input.waitEventsTimeout(redraw.timeout(input.time()));
+        currentFrame = input.time();
+        if (!redraw.shouldDraw(currentFrame))
+            continue;
+        double frameStart = glfwGetTime();
+
+        // - recycle the previous frame's scratch memory; past the warm-up
+        //   frames the loop must not allocate from the heap
+        frameMemory().beginFrame();
+        checkFrameAllocations();
+
+        float timeValue = input.time();
+        float angle = timeValue * 64.0f;
 
-        // - periodcally display the FPS the game is running in
-        time += deltaTime;
-        ++fps;
-        if (time >= 1.0f) {
-            time = 1.0f - time;
-            if (fps != last_fps) {
-                glfwSetWindowTitle(window, std::string("FPS: " + std::to_string(fps)).c_str());
-                last_fps = fps;
-                std::cout << fps << "\n";
-            }
-            fps = 0;
+        // - what the cursor was over as this frame places it: the player is
+        //   object 0, the quads 1 and up
+        if (pickPending) {
+            bvh.clear();
+            player.addTo(bvh, 0);
+            int object = 1;
+            if (spinning)
+                eachQuad(angle, [&](glm::vec3 pos, float a) { quad.addTo(bvh, object++, pos, a, q_a); });
+            bvh.build();
+
+            int width, height;
+            glfwGetWindowSize(window, &width, &height);
+            glm::mat4 inverseProjection = glm::inverse(myPrimitive::primitiveProjection());
+            RayHit hit = bvh.intersect(cursorRay(inverseProjection, pickCursor, glm::vec2(width, height)));
+            std::cout << pickCursor.x << " " << pickCursor.y << ": ";
+            if (!hit.hit)
+                std::cout << "nothing\n";
+            else if (hit.object == 0)
+                std::cout << "player";
+            else
+                std::cout << "quad " << hit.object;
+            if (hit.hit)
+                std::cout << ", triangle " << hit.triangle << " at " << hit.barycentric.x << " " << hit.barycentric.y << "\n";
+            pickPending = false;
         }
 
-        glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
-        glClear(GL_COLOR_BUFFER_BIT);
-
-        float timeValue = glfwGetTime();
-        float angle = timeValue * 64.0f;
-
-        grid.draw();
-        /*
-        for (float y = min_y_grid; y < max_y_grid; y += step_quads) {
-            for (float x = min_x_grid; x < max_x_grid; x += step_quads) {
-                quad.draw(glm::vec3(x      , y      , 0.0f),  angle, q_a);
-                quad.draw(glm::vec3(x + q_a, y + q_a, 0.0f), -angle, q_a);
-            }
+        // - the boxes where this frame places them, then the pairs
+        if (spinning && quadBoxes.empty())
+            eachQuad(0.0f, [&](glm::vec3, float) { quadBoxes.push_back(broadphase.add(glm::vec2(0.0f), glm::vec2(0.0f))); });
+        if (!spinning && !quadBoxes.empty()) {
+            for (uint32_t box : quadBoxes)
+                broadphase.remove(box);
+            quadBoxes.clear();
         }
-        */
+        glm::vec2 boxMin, boxMax;
+        obbBounds(glm::vec2(player.p_pos), glm::vec2(player.size * 0.5f), 0.0f, boxMin, boxMax);
+        broadphase.move(playerBox, boxMin, boxMax);
+        size_t quadIndex = 0;
+        if (spinning)
+            eachQuad(angle, [&](glm::vec3 pos, float a) {
+                obbBounds(glm::vec2(pos), glm::vec2(q_a * 0.5f), glm::radians(a), boxMin, boxMax);
+                broadphase.move(quadBoxes[quadIndex++], boxMin, boxMax);
+            });
+        broadphase.update();
+        int playerContacts = 0;
+        for (glm::uvec2 pair : broadphase.pairs())
+            playerContacts += pair.x == playerBox || pair.y == playerBox;
+
+        // - the static layers in one blit, then what moves
+        layers.composite();
+        if (spinning)
+            eachQuad(angle, [&](glm::vec3 pos, float a) { quad.draw(pos, a, q_a); });
         player.draw();
 
+        // - frame statistics over everything else
+        int hudY = hud.frameStats(8, 8, frameTimes);
+        hud.text(8, hudY, glm::vec4(0.7f, 0.7f, 0.7f, 1.0f), "%s: %lu frames, %lu wakeups",
+                 redraw.continuous ? "continuous" : "on demand", redraw.frameCount(), redraw.wakeupCount());
+        hud.text(8, hudY + hud.lineHeight(), glm::vec4(0.7f, 0.7f, 0.7f, 1.0f), "%zu boxes, %zu touching pairs, %d on the player",
+                 broadphase.boxCount(), broadphase.pairs().size(), playerContacts);
+        // at the framebuffer's current size, which a resize changes
+        int framebufferWidth, framebufferHeight;
+        glfwGetFramebufferSize(window, &framebufferWidth, &framebufferHeight);
+        hud.draw(framebufferWidth, framebufferHeight);
+
         glfwSwapBuffers(window);
-        glfwPollEvents();
+
+        // - time from waking up to the frame being handed over
+        frameTimes.add((glfwGetTime() - frameStart) * 1000.0f);
     }
 
-    // optional: de-allocate all resources once they've outlived their purpose:
+    // a replay ends where its recording did, which this line shows
+    if (input.traceMode() == InputTrace::REPLAY)
+        std::cout << "player at " << player.p_pos.x << " " << player.p_pos.y << ", spinning " << spinning << std::endl;
+    input.close();
+
+    // de-allocate all resources once they've outlived their purpose; what is
+    // still alive on the GPU after that is a leak and gets reported
     // ------------------------------------------------------------------------
-    //glDeleteVertexArrays(1, &VAO);
-    //glDeleteBuffers(1, &VBO);
-    //glDeleteProgram(shaderProgram);
+    hud.destroy();
+    player.destroy();
+    quad.destroy();
+    layers.destroy();
+    grid.destroy();
+    shaderCache().clear();
+    gpuResources().shutdown();
 
     // glfw: terminate, clearing all previously allocated GLFW resources.
     // ------------------------------------------------------------------
@@ -166,7 +281,7 @@ void key_callback(GLFWwindow* window, int key, int scancode, int action, int mod
     */
     //GLfloat currentFrame = 0.0f, deltaTime = 0.0f, lastFrame = 0.0f;
 
-    currentFrame = glfwGetTime();
+    currentFrame = input.time();
     deltaTime = currentFrame - lastFrame;
     if ((action != GLFW_RELEASE) && deltaTime >= 0.08f) {
         switch (key) {
@@ -176,6 +291,7 @@ void key_callback(GLFWwindow* window, int key, int scancode, int action, int mod
         case GLFW_KEY_H: player.p_pos.x -= player.size; break;
         }
         lastFrame = currentFrame;
+        redraw.invalidate();
     }
 
 
@@ -203,6 +319,22 @@ void key_callback(GLFWwindow* window, int key, int scancode, int action, int mod
     }
     */
 
+    if (key == GLFW_KEY_S && action == GLFW_PRESS) {
+        spinning = !spinning;
+        if (spinning)
+            redraw.animate(RedrawScheduler::NEVER);
+        else
+            redraw.stopAnimation();
+    }
+
+    if (key == GLFW_KEY_C && action == GLFW_PRESS) {
+        redraw.continuous = !redraw.continuous;
+    }
+
+    if (key == GLFW_KEY_M && action == GLFW_PRESS) {
+        gpuResources().report(stdout);
+    }
+
     if (key == GLFW_KEY_Q && action == GLFW_PRESS) {
         glfwSetWindowShouldClose(window, true);
     }
@@ -212,8 +344,10 @@ void mouse_button_callback(GLFWwindow* window, int button, int action, int mods)
 {
     if (button == GLFW_MOUSE_BUTTON_RIGHT && action == GLFW_PRESS) {
         double xpos, ypos;
-        glfwGetCursorPos(window, &xpos, &ypos);
-        std::cout << xpos << " " << ypos << "\n";
+        input.cursorPos(window, &xpos, &ypos);
+        pickCursor = glm::vec2(xpos, ypos);
+        pickPending = true;
+        redraw.invalidate();
     }
 }
 
@@ -224,4 +358,12 @@ void framebuffer_size_callback(GLFWwindow* window, int width, int height)
     // make sure the viewport matches the new window dimensions; note that width and 
     // height will be significantly larger than specified on retina displays.
     glViewport(0, 0, width, height);
+    redraw.invalidate();
+}
+
+// glfw: the window's contents were damaged and have to be drawn again
+// ---------------------------------------------------------------------------------------------
+void window_refresh_callback(GLFWwindow* window)
+{
+    redraw.invalidate();
 }
@@ -1,3 +1,9 @@
+#define LOGL_COUNT_HEAP_ALLOCATIONS
+#include <learnopengl/frame_memory.h>
+#include <learnopengl/gpu_resources.h>
+#include <learnopengl/layer_cache.h>
+#include <learnopengl/redraw_scheduler.h>
+
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
 
@@ -9,6 +15,7 @@
 
 #include "Quad.hpp"
 #include "LineGrid.hpp"
+#include "Hud.hpp"
 #include "Player.hpp"
 
 void framebuffer_size_callback(GLFWwindow* window, int width, int height);
@@ -18,6 +25,10 @@ myGame::Player player;
 
 void key_callback(GLFWwindow* window, int key, int scancode, int action, int mods);
 void mouse_button_callback(GLFWwindow* window, int button, int action, int mods);
+void window_refresh_callback(GLFWwindow* window);
+
+// the loop only draws when this says the scene changed
+RedrawScheduler redraw;
 
 // settings
 const unsigned int SCR_WIDTH = 512;
@@ -68,6 +79,10 @@ int main()
     myPrimitive::LineGrid grid((float)SCR_WIDTH, (float)SCR_HEIGHT, padding, q_a);
     grid.initialize();
 
+    // the grid never changes, so it is drawn once into the layer cache
+    LayerCache layers;
+    layers.add([&]() { grid.draw(); });
+
     myPrimitive::Quad quad;
     quad.initialize();
 
@@ -80,8 +95,12 @@ int main()
     player.min_y_pos = padding + q_a/2.0f;
     player.initialize();
 
+    myPrimitive::Hud hud;
+    hud.initialize();
+
     glfwSetKeyCallback(window, key_callback);
     glfwSetMouseButtonCallback(window, mouse_button_callback);
+    glfwSetWindowRefreshCallback(window, window_refresh_callback);
 
     float min_x_grid = padding + q_a/2.0f;
     float min_y_grid = padding + q_a/2.0f;
@@ -91,10 +110,8 @@ int main()
 
 
     // time management
-    GLfloat currentFrame = 0.0f, deltaTime = 0.0f, lastFrame = 0.0f;
-    GLfloat time = 0.0f;
-    GLuint  fps = 0;
-    GLuint  last_fps = 0;
+    GLfloat currentFrame = 0.0f;
+    myPrimitive::FrameTimes frameTimes;
 
     /* -----------
      *  Main loop
@@ -102,26 +119,16 @@ int main()
     unsigned int n_loop = 0;
     while (!glfwWindowShouldClose(window))
     {
-        // - calculate time spent on last frame
+        // - sleep until input, an animation or a timer needs a new frame
+        glfwWaitEventsTimeout(redraw.timeout(glfwGetTime()));
         currentFrame = glfwGetTime();
-        deltaTime = currentFrame - lastFrame;
-        lastFrame = currentFrame;
+        if (!redraw.shouldDraw(currentFrame))
+            continue;
 
-        // - periodcally display the FPS the game is running in
-        time += deltaTime;
-        ++fps;
-        if (time >= 1.0f) {
-            time = 1.0f - time;
-            if (fps != last_fps) {
-                glfwSetWindowTitle(window, std::string("FPS: " + std::to_string(fps)).c_str());
-                last_fps = fps;
-                std::cout << fps << "\n";
-            }
-            fps = 0;
-        }
-
-        glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
-        glClear(GL_COLOR_BUFFER_BIT);
+        // - recycle the previous frame's scratch memory; past the warm-up
+        //   frames the loop must not allocate from the heap
+        frameMemory().beginFrame();
+        checkFrameAllocations();
 
         /*
         n_loop = (n_loop + 1) % 60;
@@ -129,7 +136,8 @@ int main()
         if (player.p_pos.x < min_x_grid) player.p_pos.x = max_x_grid;
         */
 
-        grid.draw();
+        // - the static layers in one blit, then what moves
+        layers.composite();
 
         /*
         float angle = currentFrame * 64.0f;
@@ -143,15 +151,31 @@ int main()
 
         player.draw();
 
+        // - frame statistics over everything else
+        int hudY = hud.frameStats(8, 8, frameTimes);
+        hud.text(8, hudY, glm::vec4(0.7f, 0.7f, 0.7f, 1.0f), "%s: %lu frames, %lu wakeups",
+                 redraw.continuous ? "continuous" : "on demand", redraw.frameCount(), redraw.wakeupCount());
+        // at the framebuffer's current size, which a resize changes
+        int framebufferWidth, framebufferHeight;
+        glfwGetFramebufferSize(window, &framebufferWidth, &framebufferHeight);
+        hud.draw(framebufferWidth, framebufferHeight);
+
         glfwSwapBuffers(window);
-        glfwPollEvents();
+
+        // - time from waking up to the frame being handed over
+        frameTimes.add((glfwGetTime() - currentFrame) * 1000.0f);
     }
 
-    // optional: de-allocate all resources once they've outlived their purpose:
+    // de-allocate all resources once they've outlived their purpose; what is
+    // still alive on the GPU after that is a leak and gets reported
     // ------------------------------------------------------------------------
-    //glDeleteVertexArrays(1, &VAO);
-    //glDeleteBuffers(1, &VBO);
-    //glDeleteProgram(shaderProgram);
+    hud.destroy();
+    player.destroy();
+    quad.destroy();
+    layers.destroy();
+    grid.destroy();
+    shaderCache().clear();
+    gpuResources().shutdown();
 
     // glfw: terminate, clearing all previously allocated GLFW resources.
     // ------------------------------------------------------------------
@@ -204,6 +228,7 @@ void key_callback(GLFWwindow* window, int key, int scancode, int action, int mod
         }
         player.move(dir);
         lastFrame = currentFrame;
+        redraw.invalidate();
         //std::cout << deltaTime << "\n";
     }
 
@@ -232,6 +257,14 @@ void key_callback(GLFWwindow* window, int key, int scancode, int action, int mod
     }
     */
 
+    if (key == GLFW_KEY_C && action == GLFW_PRESS) {
+        redraw.continuous = !redraw.continuous;
+    }
+
+    if (key == GLFW_KEY_M && action == GLFW_PRESS) {
+        gpuResources().report(stdout);
+    }
+
     if (key == GLFW_KEY_Q && action == GLFW_PRESS) {
         glfwSetWindowShouldClose(window, true);
     }
@@ -253,4 +286,12 @@ void framebuffer_size_callback(GLFWwindow* window, int width, int height)
     // make sure the viewport matches the new window dimensions; note that width and 
     // height will be significantly larger than specified on retina displays.
     glViewport(0, 0, width, height);
+    redraw.invalidate();
+}
+
+// glfw: the window's contents were damaged and have to be drawn again
+// ---------------------------------------------------------------------------------------------
+void window_refresh_callback(GLFWwindow* window)
+{
+    redraw.invalidate();
 }
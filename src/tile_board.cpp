@@ -0,0 +1,218 @@
+#include <learnopengl/gpu_resources.h>
+#include <learnopengl/redraw_scheduler.h>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+
+#include "Hud.hpp"
+#include "TileMap.hpp"
+
+// A 65536 x 65536 cell board drawn by a TileMap. HJKL pan, the scroll wheel
+// zooms around the cursor, the left button paints the cell under it with
+// the next tile and the right button clears it.
+
+void framebuffer_size_callback(GLFWwindow* window, int width, int height);
+void key_callback(GLFWwindow* window, int key, int scancode, int action, int mods);
+void mouse_button_callback(GLFWwindow* window, int button, int action, int mods);
+void scroll_callback(GLFWwindow* window, double xoffset, double yoffset);
+void window_refresh_callback(GLFWwindow* window);
+
+// settings
+const unsigned int SCR_WIDTH = 512;
+const unsigned int SCR_HEIGHT = 512;
+const int BOARD_CELLS = 65536;
+const float PAN_PIXELS_PER_SECOND = 512.0f;
+
+myPrimitive::TileMap tiles(BOARD_CELLS, BOARD_CELLS);
+myPrimitive::TileView view = { glm::dvec2(BOARD_CELLS / 2, BOARD_CELLS / 2), 16.0f };
+uint16_t brush = 1;
+RedrawScheduler redraw;
+
+// a quarter of the cells empty, the rest one of the 15 generated tiles
+uint16_t board_tile(int x, int y)
+{
+    uint32_t h = (uint32_t)x * 73856093u ^ (uint32_t)y * 19349663u;
+    h ^= h >> 13;
+    h *= 0x5bd1e995u;
+    h ^= h >> 15;
+    return (h & 3) == 0 ? 0 : (uint16_t)(1 + h % 15);
+}
+
+// the cursor in framebuffer pixels, which differ from window ones on retina displays
+glm::dvec2 cursor_pixel(GLFWwindow* window)
+{
+    double xpos, ypos;
+    int windowWidth, windowHeight, framebufferWidth, framebufferHeight;
+    glfwGetCursorPos(window, &xpos, &ypos);
+    glfwGetWindowSize(window, &windowWidth, &windowHeight);
+    glfwGetFramebufferSize(window, &framebufferWidth, &framebufferHeight);
+    return glm::dvec2(xpos * framebufferWidth / windowWidth, ypos * framebufferHeight / windowHeight);
+}
+
+
+int main()
+{
+    // glfw: initialize and configure
+    // ------------------------------
+    glfwInit();
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+#ifdef __APPLE__
+    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+#endif
+
+    // glfw window creation
+    // --------------------
+    GLFWwindow* window = glfwCreateWindow(SCR_WIDTH, SCR_HEIGHT, "TILES", NULL, NULL);
+    if (window == NULL)
+    {
+        std::cout << "Failed to create GLFW window" << std::endl;
+        glfwTerminate();
+        return -1;
+    }
+    glfwMakeContextCurrent(window);
+    glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
+    glfwSetKeyCallback(window, key_callback);
+    glfwSetMouseButtonCallback(window, mouse_button_callback);
+    glfwSetScrollCallback(window, scroll_callback);
+    glfwSetWindowRefreshCallback(window, window_refresh_callback);
+
+    // glad: load all OpenGL function pointers
+    // ---------------------------------------
+    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+    {
+        std::cout << "Failed to initialize GLAD" << std::endl;
+        return -1;
+    }
+
+    // enough resident chunks for the whole window at one pixel a cell
+    tiles.generator = board_tile;
+    tiles.initialize(SCR_WIDTH / myPrimitive::TileMap::CHUNK + 2);
+
+    myPrimitive::Hud hud;
+    hud.initialize();
+
+    // time management
+    GLfloat currentFrame = 0.0f, lastFrame = 0.0f;
+    myPrimitive::FrameTimes frameTimes;
+
+    /* -----------
+     *  Main loop
+     * ----------- */
+    while (!glfwWindowShouldClose(window))
+    {
+        // - sleep until input needs a new frame
+        glfwWaitEventsTimeout(redraw.timeout(glfwGetTime()));
+        currentFrame = glfwGetTime();
+        if (!redraw.shouldDraw(currentFrame))
+            continue;
+        float deltaTime = std::min(currentFrame - lastFrame, 0.1f);
+        lastFrame = currentFrame;
+
+        // - pan while a direction is held, at the scheduler's fixed rate
+        glm::dvec2 pan(0.0);
+        if (glfwGetKey(window, GLFW_KEY_H) == GLFW_PRESS) pan.x -= 1.0;
+        if (glfwGetKey(window, GLFW_KEY_L) == GLFW_PRESS) pan.x += 1.0;
+        if (glfwGetKey(window, GLFW_KEY_K) == GLFW_PRESS) pan.y -= 1.0;
+        if (glfwGetKey(window, GLFW_KEY_J) == GLFW_PRESS) pan.y += 1.0;
+        if (pan != glm::dvec2(0.0)) {
+            view.origin += pan * (double)(PAN_PIXELS_PER_SECOND * deltaTime / view.cellPixels);
+            redraw.animate(currentFrame + 2.0 * redraw.frameInterval);
+        }
+
+        glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        tiles.draw(view);
+
+        // - frame statistics and where we are
+        int hudY = hud.frameStats(8, 8, frameTimes);
+        glm::vec4 grey(0.7f, 0.7f, 0.7f, 1.0f);
+        hud.text(8, hudY, grey, "cell %d,%d  %.2f px a cell  brush %u", (int)view.origin.x, (int)view.origin.y, view.cellPixels, brush);
+        hud.text(8, hudY + hud.lineHeight(), grey, "%zu chunk uploads, %zu cell uploads, %zu chunks stored",
+                 tiles.chunkUploads(), tiles.cellUploads(), tiles.storedChunks());
+        // at the framebuffer's current size, which a resize changes
+        int framebufferWidth, framebufferHeight;
+        glfwGetFramebufferSize(window, &framebufferWidth, &framebufferHeight);
+        hud.draw(framebufferWidth, framebufferHeight);
+
+        glfwSwapBuffers(window);
+        frameTimes.add((glfwGetTime() - currentFrame) * 1000.0f);
+    }
+
+    // de-allocate all resources once they've outlived their purpose; what is
+    // still alive on the GPU after that is a leak and gets reported
+    // ------------------------------------------------------------------------
+    hud.destroy();
+    tiles.destroy();
+    shaderCache().clear();
+    gpuResources().shutdown();
+
+    // glfw: terminate, clearing all previously allocated GLFW resources.
+    // ------------------------------------------------------------------
+    glfwTerminate();
+    return 0;
+}
+
+void key_callback(GLFWwindow* window, int key, int scancode, int action, int mods)
+{
+    if (key == GLFW_KEY_M && action == GLFW_PRESS) {
+        gpuResources().report(stdout);
+    }
+
+    if (key == GLFW_KEY_Q && action == GLFW_PRESS) {
+        glfwSetWindowShouldClose(window, true);
+    }
+    // the loop polls the held keys once it wakes up
+    redraw.invalidate();
+}
+
+void mouse_button_callback(GLFWwindow* window, int button, int action, int mods)
+{
+    if (action != GLFW_PRESS)
+        return;
+    glm::ivec2 cell = glm::ivec2(glm::floor(view.origin + cursor_pixel(window) / (double)view.cellPixels));
+    if (button == GLFW_MOUSE_BUTTON_LEFT) {
+        tiles.set(cell.x, cell.y, brush);
+        brush = brush % 15 + 1;
+    }
+    if (button == GLFW_MOUSE_BUTTON_RIGHT) {
+        tiles.set(cell.x, cell.y, 0);
+    }
+    redraw.invalidate();
+}
+
+// zoom by a quarter a notch, keeping the cell under the cursor in place
+void scroll_callback(GLFWwindow* window, double xoffset, double yoffset)
+{
+    glm::dvec2 pixel = cursor_pixel(window);
+    glm::dvec2 anchor = view.origin + pixel / (double)view.cellPixels;
+    view.cellPixels = glm::clamp(view.cellPixels * std::pow(1.25f, (float)yoffset), 1.0f, 128.0f);
+    view.origin = anchor - pixel / (double)view.cellPixels;
+    redraw.invalidate();
+}
+
+// glfw: whenever the window size changed (by OS or user resize) this callback function executes
+// ---------------------------------------------------------------------------------------------
+void framebuffer_size_callback(GLFWwindow* window, int width, int height)
+{
+    // make sure the viewport matches the new window dimensions; note that width and
+    // height will be significantly larger than specified on retina displays.
+    glViewport(0, 0, width, height);
+    redraw.invalidate();
+}
+
+// glfw: the window's contents were damaged and have to be drawn again
+// ---------------------------------------------------------------------------------------------
+void window_refresh_callback(GLFWwindow* window)
+{
+    redraw.invalidate();
+}
@@ -0,0 +1,226 @@
+// Generates src/glad_trace.c, the traced loader mode of glad (see
+// glad/glad_trace.h), from the function pointer typedefs in glad.h. Every
+// core entry point, GL 1.0 to 4.6, gets a wrapper that times the call and
+// counts it. Extensions keep their untraced pointers. Rerun it whenever
+// glad is regenerated.
+//
+//   g++ -O2 glad_trace.cpp -o glad_trace
+//   ./glad_trace ../../include/glad/glad.h ../glad_trace.c
+
+#include <cstdio>
+#include <fstream>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+struct EntryPoint
+{
+    std::string name;      // glDrawArrays
+    std::string result;    // void
+    std::string proc;      // PFNGLDRAWARRAYSPROC
+    std::string params;    // GLenum mode, GLint first, GLsizei count
+    std::string arguments; // mode, first, count
+};
+
+std::string trim(const std::string& s)
+{
+    size_t first = s.find_first_not_of(" \t");
+    if (first == std::string::npos)
+        return "";
+    size_t last = s.find_last_not_of(" \t");
+    return s.substr(first, last - first + 1);
+}
+
+// the names of a parameter list, "const GLfloat *v, GLsizei count" -> "v, count"
+std::string argumentNames(const std::string& params)
+{
+    if (trim(params) == "void")
+        return "";
+    std::string names;
+    std::stringstream list(params);
+    std::string param;
+    while (std::getline(list, param, ','))
+    {
+        param = trim(param);
+        size_t start = param.find_last_not_of("abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_");
+        names += (names.empty() ? "" : ", ") + param.substr(start == std::string::npos ? 0 : start + 1);
+    }
+    return names;
+}
+
+const char* const PREAMBLE = R"(/*
+
+    Traced loader mode of glad, generated by src/tools/glad_trace.cpp from
+    include/glad/glad.h. Built only with GLAD_TRACE defined, see
+    glad/glad_trace.h.
+
+*/
+
+#ifdef GLAD_TRACE
+
+)";
+
+const char* const RUNTIME = R"(
+#include <stdio.h>
+#include <string.h>
+#include <glad/glad_trace.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define GLAD_TRACE_CLOCK() __rdtsc()
+#elif defined(_MSC_VER)
+#include <intrin.h>
+#define GLAD_TRACE_CLOCK() __rdtsc()
+#else
+#include <time.h>
+static unsigned long long glad_trace_clock(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (unsigned long long)now.tv_sec * 1000000000ull + (unsigned long long)now.tv_nsec;
+}
+#define GLAD_TRACE_CLOCK() glad_trace_clock()
+#endif
+
+#if defined(__GNUC__)
+#define GLAD_TRACE_LOG2(ticks) ((ticks) ? 63 - __builtin_clzll(ticks) : 0)
+#else
+static int glad_trace_log2(unsigned long long ticks) {
+    int bits = 0;
+    while (ticks >>= 1) bits++;
+    return bits;
+}
+#define GLAD_TRACE_LOG2(ticks) glad_trace_log2(ticks)
+#endif
+
+int glad_trace_check_errors = 0;
+int glad_trace_touched[GLAD_TRACE_ENTRY_POINTS];
+int glad_trace_touched_count = 0;
+
+static PFNGLGETERRORPROC glad_trace_real_glGetError;
+
+unsigned long long glad_trace_ticks(void) {
+    return GLAD_TRACE_CLOCK();
+}
+
+static void glad_trace_record(int id, unsigned long long start) {
+    unsigned long long ticks = GLAD_TRACE_CLOCK() - start;
+    GLADtraceentry* entry = &glad_trace_entries[id];
+    int bucket = GLAD_TRACE_LOG2(ticks);
+    if (entry->calls == 0) glad_trace_touched[glad_trace_touched_count++] = id;
+    entry->calls++;
+    entry->ticks += ticks;
+    entry->histogram[bucket < GLAD_TRACE_BUCKETS ? bucket : GLAD_TRACE_BUCKETS - 1]++;
+    if (glad_trace_check_errors && id != GLAD_TRACE_GET_ERROR) {
+        GLenum error;
+        while ((error = glad_trace_real_glGetError()) != GL_NO_ERROR)
+            fprintf(stderr, "ERROR::GL::%s 0x%04x\n", entry->name, error);
+    }
+}
+
+void glad_trace_reset(void) {
+    int i;
+    for (i = 0; i < glad_trace_touched_count; i++) {
+        GLADtraceentry* entry = &glad_trace_entries[glad_trace_touched[i]];
+        entry->calls = 0;
+        entry->ticks = 0;
+        memset(entry->histogram, 0, sizeof(entry->histogram));
+    }
+    glad_trace_touched_count = 0;
+}
+
+)";
+
+int main(int argc, char** argv)
+{
+    if (argc != 3)
+    {
+        std::printf("usage: glad_trace <glad.h> <glad_trace.c>\n");
+        return 1;
+    }
+    std::ifstream header(argv[1]);
+    if (!header)
+    {
+        std::printf("cannot open %s\n", argv[1]);
+        return 1;
+    }
+
+    // typedef void (APIENTRYP PFNGLDRAWARRAYSPROC)(GLenum mode, GLint first, GLsizei count);
+    std::regex typedefLine(R"(^typedef (.+) \(APIENTRYP (PFN\w+PROC)\)\((.*)\);$)");
+    // GLAPI PFNGLDRAWARRAYSPROC glad_glDrawArrays;
+    std::regex pointerLine(R"(^GLAPI (PFN\w+PROC) glad_(\w+);$)");
+    std::vector<EntryPoint> entries;
+    std::string line, section;
+    EntryPoint pending;
+    while (std::getline(header, line))
+    {
+        std::smatch match;
+        if (line.rfind("#ifndef GL_", 0) == 0)
+            section = line.substr(8);
+        else if (section.rfind("GL_VERSION_", 0) != 0)
+            continue;
+        else if (std::regex_match(line, match, typedefLine))
+        {
+            pending.result = match[1];
+            pending.proc = match[2];
+            pending.params = match[3];
+        }
+        else if (std::regex_match(line, match, pointerLine) && match[1] == pending.proc)
+        {
+            pending.name = match[2];
+            pending.arguments = argumentNames(pending.params);
+            entries.push_back(pending);
+        }
+    }
+    int getError = -1;
+    for (size_t i = 0; i < entries.size(); i++)
+        if (entries[i].name == "glGetError")
+            getError = (int)i;
+    if (entries.empty() || getError < 0)
+    {
+        std::printf("no GL_VERSION_ entry points in %s\n", argv[1]);
+        return 1;
+    }
+
+    std::ofstream out(argv[2]);
+    out << PREAMBLE;
+    out << "#define GLAD_TRACE_ENTRY_POINTS " << entries.size() << "\n";
+    out << "#define GLAD_TRACE_GET_ERROR " << getError << "\n";
+    out << RUNTIME;
+
+    out << "GLADtraceentry glad_trace_entries[GLAD_TRACE_ENTRY_POINTS] = {\n";
+    for (const EntryPoint& e : entries)
+        out << "    { \"" << e.name << "\", 0, 0, {0} },\n";
+    out << "};\n";
+    out << "const int glad_trace_entry_count = GLAD_TRACE_ENTRY_POINTS;\n\n";
+
+    for (size_t i = 0; i < entries.size(); i++)
+    {
+        const EntryPoint& e = entries[i];
+        bool returns = e.result != "void";
+        if (e.name != "glGetError")
+            out << "static " << e.proc << " glad_trace_real_" << e.name << ";\n";
+        out << "static " << e.result << " APIENTRY glad_trace_" << e.name << "(" << e.params << ") {\n";
+        // the locals are prefixed, a parameter could be called start
+        out << "    unsigned long long glad_start = GLAD_TRACE_CLOCK();\n";
+        out << "    " << (returns ? e.result + " glad_result = " : "") << "glad_trace_real_" << e.name << "("
+            << e.arguments << ");\n";
+        out << "    glad_trace_record(" << i << ", glad_start);\n";
+        if (returns)
+            out << "    return glad_result;\n";
+        out << "}\n";
+    }
+
+    out << "\n#define GLAD_TRACE_HOOK(name) \\\n"
+           "    if (glad_##name != NULL && glad_##name != glad_trace_##name) { \\\n"
+           "        glad_trace_real_##name = glad_##name; \\\n"
+           "        glad_##name = glad_trace_##name; \\\n"
+           "    }\n\n";
+    out << "void glad_trace_install(void) {\n";
+    for (const EntryPoint& e : entries)
+        out << "    GLAD_TRACE_HOOK(" << e.name << ");\n";
+    out << "}\n\n#endif\n";
+
+    std::printf("%zu entry points traced\n", entries.size());
+    return 0;
+}
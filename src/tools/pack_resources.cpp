@@ -0,0 +1,158 @@
+// Bundles asset directories into one pack for learnopengl/resource_pack.h.
+// Every regular file below a directory is stored under its path relative to
+// that directory, so packing resources/ gives "textures/container.jpg",
+// "shaders/camera.vs" and so on.
+//
+//   g++ -O2 pack_resources.cpp -I../../include -o pack_resources
+//   ./pack_resources ../../resources.pak ../../resources
+//   ./pack_resources --list ../../resources.pak
+
+#include <learnopengl/resource_pack.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+struct PackInput
+{
+    std::string name;
+    fs::path path;
+    uint64_t hash;
+    uint64_t size;
+};
+
+uint64_t alignUp(uint64_t value)
+{
+    return (value + RESOURCE_PACK_ALIGN - 1) / RESOURCE_PACK_ALIGN * RESOURCE_PACK_ALIGN;
+}
+
+int list(const char* packPath)
+{
+    ResourcePack pack;
+    if (!pack.open(packPath))
+    {
+        std::printf("cannot open %s\n", packPath);
+        return 1;
+    }
+    for (size_t i = 0; i < pack.count(); i++)
+    {
+        const char* name;
+        size_t length;
+        ResourceSpan span = pack.entry(i, &name, &length);
+        std::printf("%10zu  %.*s\n", span.size, (int)length, name);
+    }
+    std::printf("%zu files\n", pack.count());
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc == 3 && std::string(argv[1]) == "--list")
+        return list(argv[2]);
+    if (argc < 3)
+    {
+        std::printf("usage: %s <output.pak> <directory>...\n       %s --list <pack>\n", argv[0], argv[0]);
+        return 1;
+    }
+
+    std::vector<PackInput> inputs;
+    for (int i = 2; i < argc; i++)
+    {
+        fs::path root(argv[i]);
+        std::error_code error;
+        for (fs::recursive_directory_iterator it(root, error), end; !error && it != end; it.increment(error))
+        {
+            if (!it->is_regular_file())
+                continue;
+            PackInput input;
+            input.name = it->path().lexically_relative(root).generic_string();
+            input.path = it->path();
+            input.hash = resourceHash(input.name.c_str());
+            input.size = it->file_size();
+            inputs.push_back(input);
+        }
+        if (error)
+        {
+            std::printf("cannot read %s: %s\n", argv[i], error.message().c_str());
+            return 1;
+        }
+    }
+
+    std::sort(inputs.begin(), inputs.end(), [](const PackInput& a, const PackInput& b) { return a.hash < b.hash; });
+    for (size_t i = 1; i < inputs.size(); i++)
+    {
+        if (inputs[i].hash == inputs[i - 1].hash)
+        {
+            std::printf("hash collision: %s and %s\n", inputs[i - 1].name.c_str(), inputs[i].name.c_str());
+            return 1;
+        }
+    }
+
+    // header, index and names first, then every file on its own alignment boundary
+    ResourcePackHeader header;
+    std::memcpy(header.magic, RESOURCE_PACK_MAGIC, sizeof(header.magic));
+    header.version = RESOURCE_PACK_VERSION;
+    header.count = (uint32_t)inputs.size();
+    header.namesOffset = sizeof(header) + inputs.size() * sizeof(ResourcePackEntry);
+
+    std::string names;
+    std::vector<ResourcePackEntry> entries(inputs.size());
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        entries[i].hash = inputs[i].hash;
+        entries[i].size = inputs[i].size;
+        entries[i].nameOffset = (uint32_t)names.size();
+        entries[i].nameLength = (uint32_t)inputs[i].name.size();
+        names += inputs[i].name;
+    }
+    header.namesSize = names.size();
+
+    uint64_t offset = alignUp(header.namesOffset + header.namesSize);
+    for (ResourcePackEntry& e : entries)
+    {
+        e.offset = offset;
+        offset = alignUp(offset + e.size);
+    }
+
+    std::ofstream out(argv[1], std::ios::binary | std::ios::trunc);
+    if (!out)
+    {
+        std::printf("cannot write %s\n", argv[1]);
+        return 1;
+    }
+    out.write((const char*)&header, sizeof(header));
+    out.write((const char*)entries.data(), entries.size() * sizeof(ResourcePackEntry));
+    out.write(names.data(), names.size());
+
+    uint64_t written = header.namesOffset + header.namesSize;
+    std::vector<char> data;
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        data.assign(entries[i].offset - written, 0);
+        std::ifstream in(inputs[i].path, std::ios::binary);
+        data.resize(data.size() + inputs[i].size);
+        if (!in.read(data.data() + (entries[i].offset - written), inputs[i].size))
+        {
+            std::printf("cannot read %s\n", inputs[i].path.string().c_str());
+            return 1;
+        }
+        out.write(data.data(), data.size());
+        written = entries[i].offset + entries[i].size;
+    }
+    // pad the end too, so the last file is followed by zeros like the others
+    data.assign(alignUp(written) - written, 0);
+    out.write(data.data(), data.size());
+
+    if (!out)
+    {
+        std::printf("cannot write %s\n", argv[1]);
+        return 1;
+    }
+    std::printf("%zu files, %llu bytes -> %s\n", inputs.size(), (unsigned long long)alignUp(written), argv[1]);
+    return 0;
+}